@@ -19,7 +19,8 @@ enum class ConvertType {
     ExportScorePartsPdf,
     ExportScoreTranspose,
     SourceUpdate,
-    ExportScoreVideo
+    ExportScoreVideo,
+    JobStream
 };
 
 enum class DiagnosticType {
@@ -38,7 +39,8 @@ struct CmdOptions {
         ScoreTransposeOptions,
         ForceMode,
         SoundProfile,
-        ExtensionUri
+        ExtensionUri,
+        LayoutStatisticsPath
 
         // Video
     };
@@ -91,6 +93,7 @@ struct CmdOptions {
     struct {
         std::optional<bool> revertToFactorySettings;
         std::optional<muse::logger::Level> loggerLevel;
+        std::optional<muse::io::path_t> startupTracePath;
     } app;
 
     struct {
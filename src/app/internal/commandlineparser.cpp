@@ -86,7 +86,11 @@ void CommandLineParser::init()
     m_parser.addOption(QCommandLineOption({ "o", "export-to" }, "Export to 'file'. Format depends on file's extension", "file"));
     m_parser.addOption(QCommandLineOption({ "j", "job" }, "Process a conversion job", "file"));
     m_parser.addOption(QCommandLineOption("extension", "Use extension to process a conversion job", "uri"));
+    m_parser.addOption(QCommandLineOption("job-stream",
+                                          "Process conversion jobs read as JSON lines from stdin until it is closed, "
+                                          "print the result of each job as a JSON line to stdout"));
 
+    m_parser.addOption(QCommandLineOption("startup-trace", "Write a Chrome trace of the startup phases to 'file'", "file"));
     m_parser.addOption(QCommandLineOption({ "F", "factory-settings" }, "Use factory settings"));
     m_parser.addOption(QCommandLineOption({ "R", "revert-settings" }, "Revert to factory settings, but keep default preferences"));
     m_parser.addOption(QCommandLineOption({ "M", "midi-operations" }, "Specify MIDI import operations file", "file"));
@@ -116,6 +120,10 @@ void CommandLineParser::init()
                                           "Transpose the given score before executing the '-o' options",
                                           "options"));
 
+    m_parser.addOption(QCommandLineOption("layout-statistics",
+                                          "Collect layout pass timings and counters while converting and save them as JSON to the given file",
+                                          "file"));
+
     // MusicXML
     m_parser.addOption(QCommandLineOption("musicxml-use-default-font",
                                           "Apply default typeface (Edwin) to imported scores"));
@@ -318,6 +326,11 @@ void CommandLineParser::parse(int argc, char** argv)
         m_options.converterTask.inputFile = fromUserInputPath(m_parser.value("j"));
     }
 
+    if (m_parser.isSet("job-stream")) {
+        m_options.runMode = IApplication::RunMode::ConsoleApp;
+        m_options.converterTask.type = ConvertType::JobStream;
+    }
+
     if (m_parser.isSet("score-media")) {
         m_options.runMode = IApplication::RunMode::ConsoleApp;
         m_options.converterTask.type = ConvertType::ExportScoreMedia;
@@ -367,6 +380,11 @@ void CommandLineParser::parse(int argc, char** argv)
         }
     }
 
+    if (m_parser.isSet("layout-statistics")) {
+        m_options.converterTask.params[CmdOptions::ParamKey::LayoutStatisticsPath]
+            = fromUserInputPath(m_parser.value("layout-statistics"));
+    }
+
     // MusicXML
     if (m_parser.isSet("musicxml-use-default-font")) {
         m_options.importMusicXml.useDefaultFont = true;
@@ -414,6 +432,10 @@ void CommandLineParser::parse(int argc, char** argv)
     }
 #endif
 
+    if (m_parser.isSet("startup-trace")) {
+        m_options.app.startupTracePath = fromUserInputPath(m_parser.value("startup-trace"));
+    }
+
     if (m_parser.isSet("F") || m_parser.isSet("R")) {
         m_options.app.revertToFactorySettings = true;
     }
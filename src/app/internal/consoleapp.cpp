@@ -31,6 +31,10 @@
 
 #include "muse_framework_config.h"
 
+#include "io/file.h"
+#include "engraving/rendering/score/dumplayoutdata.h"
+#include "engraving/rendering/score/layoutstatistics.h"
+
 #include "log.h"
 
 using namespace muse;
@@ -269,6 +273,13 @@ int ConsoleApp::processConverter(const CmdOptions::ConverterTask& task)
     bool forceMode = task.params[CmdOptions::ParamKey::ForceMode].toBool();
     String soundProfile = task.params[CmdOptions::ParamKey::SoundProfile].toString();
     UriQuery extensionUri = UriQuery(task.params[CmdOptions::ParamKey::ExtensionUri].toString().toStdString());
+    muse::io::path_t layoutStatisticsPath = task.params[CmdOptions::ParamKey::LayoutStatisticsPath].toString();
+
+    using namespace mu::engraving::rendering::score;
+    if (!layoutStatisticsPath.empty()) {
+        LayoutStatistics::instance()->clear();
+        LayoutStatistics::instance()->setEnabled(true);
+    }
 
     if (!soundProfile.isEmpty() && !soundProfilesRepository()->containsProfile(soundProfile)) {
         LOGE() << "Unknown sound profile: " << soundProfile;
@@ -279,6 +290,9 @@ int ConsoleApp::processConverter(const CmdOptions::ConverterTask& task)
     case ConvertType::Batch:
         ret = converter()->batchConvert(task.inputFile, stylePath, forceMode, soundProfile, extensionUri);
         break;
+    case ConvertType::JobStream:
+        ret = converter()->streamConvert(stylePath, forceMode, soundProfile, extensionUri);
+        break;
     case ConvertType::File: {
         std::string transposeOptionsJson = task.params[CmdOptions::ParamKey::ScoreTransposeOptions].toString().toStdString();
         ret = converter()->fileConvert(task.inputFile, task.outputFile, stylePath, forceMode, soundProfile, extensionUri,
@@ -317,6 +331,15 @@ int ConsoleApp::processConverter(const CmdOptions::ConverterTask& task)
         LOGE() << "failed convert, error: " << ret.toString();
     }
 
+    if (!layoutStatisticsPath.empty()) {
+        LayoutStatistics::instance()->setEnabled(false);
+        std::string json = DumpLayoutData::dumpStatistics();
+        Ret wret = io::File::writeFile(layoutStatisticsPath, ByteArray(json.c_str(), json.size()));
+        if (!wret) {
+            LOGE() << "failed write layout statistics, error: " << wret.toString();
+        }
+    }
+
     return ret.code();
 }
 
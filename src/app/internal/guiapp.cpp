@@ -5,16 +5,20 @@
 #include <QThreadPool>
 #include <QQuickWindow>
 
+#include <optional>
+
 #include "appshell/view/internal/splashscreen/splashscreen.h"
 #include "ui/iuiengine.h"
 
 #include "muse_framework_config.h"
 #include "ui/graphicsapiprovider.h"
+#include "global/startuptrace.h"
 
 #include "log.h"
 
 using namespace muse;
 using namespace muse::ui;
+using namespace muse::profiler;
 using namespace mu;
 using namespace mu::app;
 using namespace mu::appshell;
@@ -40,10 +44,19 @@ void GuiApp::perform()
 
     setRunMode(runMode);
 
+    if (options.app.startupTracePath) {
+        StartupTrace::start(options.app.startupTracePath.value());
+    }
+
 #ifdef MUE_BUILD_APPSHELL_MODULE
+    const int64_t startupBeginUs = StartupTrace::nowUs();
+
     // ====================================================
     // Setup modules: Resources, Exports, Imports, UiTypes
     // ====================================================
+    std::optional<StartupTrace::Scope> setupScope;
+    setupScope.emplace("setup modules", "app");
+
     m_globalModule.setApplication(shared_from_this());
     m_globalModule.registerResources();
     m_globalModule.registerExports();
@@ -71,11 +84,17 @@ void GuiApp::perform()
     // ====================================================
     applyCommandLineOptions(options);
 
+    setupScope.reset();
+
     // ====================================================
     // Setup modules: onPreInit
     // ====================================================
-    m_globalModule.onPreInit(runMode);
+    {
+        StartupTrace::Scope scope(m_globalModule.moduleName(), "onPreInit");
+        m_globalModule.onPreInit(runMode);
+    }
     for (modularity::IModuleSetup* m : m_modules) {
+        StartupTrace::Scope scope(m->moduleName(), "onPreInit");
         m->onPreInit(runMode);
     }
 
@@ -104,16 +123,24 @@ void GuiApp::perform()
     // ====================================================
     // Setup modules: onInit
     // ====================================================
-    m_globalModule.onInit(runMode);
+    {
+        StartupTrace::Scope scope(m_globalModule.moduleName(), "onInit");
+        m_globalModule.onInit(runMode);
+    }
     for (modularity::IModuleSetup* m : m_modules) {
+        StartupTrace::Scope scope(m->moduleName(), "onInit");
         m->onInit(runMode);
     }
 
     // ====================================================
     // Setup modules: onAllInited
     // ====================================================
-    m_globalModule.onAllInited(runMode);
+    {
+        StartupTrace::Scope scope(m_globalModule.moduleName(), "onAllInited");
+        m_globalModule.onAllInited(runMode);
+    }
     for (modularity::IModuleSetup* m : m_modules) {
+        StartupTrace::Scope scope(m->moduleName(), "onAllInited");
         m->onAllInited(runMode);
     }
 
@@ -121,8 +148,12 @@ void GuiApp::perform()
     // Setup modules: onStartApp (on next event loop)
     // ====================================================
     QMetaObject::invokeMethod(qApp, [this]() {
-        m_globalModule.onStartApp();
+        {
+            StartupTrace::Scope scope(m_globalModule.moduleName(), "onStartApp");
+            m_globalModule.onStartApp();
+        }
         for (modularity::IModuleSetup* m : m_modules) {
+            StartupTrace::Scope scope(m->moduleName(), "onStartApp");
             m->onStartApp();
         }
     }, Qt::QueuedConnection);
@@ -172,7 +203,10 @@ void GuiApp::perform()
         }
     }
 
+    std::optional<StartupTrace::Scope> qmlEngineScope;
+    qmlEngineScope.emplace("create qml engine", "app");
     QQmlApplicationEngine* engine = ioc()->resolve<muse::ui::IUiEngine>("app")->qmlAppEngine();
+    qmlEngineScope.reset();
 
 #if defined(Q_OS_WIN)
     const QString mainQmlFile = "/platform/win/Main.qml";
@@ -201,7 +235,7 @@ void GuiApp::perform()
     }, Qt::DirectConnection);
 
     QObject::connect(engine, &QQmlApplicationEngine::objectCreated,
-                     qApp, [this, url, splashScreen](QObject* obj, const QUrl& objUrl) {
+                     qApp, [this, url, splashScreen, startupBeginUs](QObject* obj, const QUrl& objUrl) {
         if (!obj && url == objUrl) {
             LOGE() << "failed Qml load\n";
             QCoreApplication::exit(-1);
@@ -213,19 +247,44 @@ void GuiApp::perform()
             // Setup modules: onDelayedInit
             // ====================================================
 
-            m_globalModule.onDelayedInit();
+            {
+                StartupTrace::Scope scope(m_globalModule.moduleName(), "onDelayedInit");
+                m_globalModule.onDelayedInit();
+            }
             for (modularity::IModuleSetup* m : m_modules) {
+                StartupTrace::Scope scope(m->moduleName(), "onDelayedInit");
                 m->onDelayedInit();
             }
 
-            startupScenario()->runOnSplashScreen();
+            {
+                StartupTrace::Scope scope("run on splash screen", "app");
+                startupScenario()->runOnSplashScreen();
+            }
 
             if (splashScreen) {
                 splashScreen->close();
                 delete splashScreen;
             }
 
-            startupScenario()->runAfterSplashScreen();
+            {
+                StartupTrace::Scope scope("run after splash screen", "app");
+                startupScenario()->runAfterSplashScreen();
+            }
+
+            //! NOTE The trace is written once the main window has shown its first frame
+            QQuickWindow* window = qobject_cast<QQuickWindow*>(obj);
+            if (window && StartupTrace::isStarted()) {
+                auto connection = std::make_shared<QMetaObject::Connection>();
+                *connection = QObject::connect(window, &QQuickWindow::frameSwapped, qApp, [connection, startupBeginUs]() {
+                    QObject::disconnect(*connection);
+
+                    const int64_t durationUs = StartupTrace::nowUs() - startupBeginUs;
+                    LOGI() << "time to first frame: " << durationUs / 1000 << " ms";
+
+                    StartupTrace::addEvent("time to first frame", "app", startupBeginUs, durationUs);
+                    StartupTrace::finish();
+                }, Qt::QueuedConnection);
+            }
         }
     }, Qt::QueuedConnection);
 
@@ -239,7 +298,10 @@ void GuiApp::perform()
     // Load Main qml
     // ====================================================
 
-    engine->load(url);
+    {
+        StartupTrace::Scope scope("load main qml", "app");
+        engine->load(url);
+    }
 
 #endif // MUE_BUILD_APPSHELL_MODULE
 }
@@ -248,6 +310,9 @@ void GuiApp::finish()
 {
     PROFILER_PRINT;
 
+    //! NOTE In case the app is closed before the first frame
+    StartupTrace::finish();
+
 // Wait Thread Poll
 #ifndef Q_OS_WASM
     QThreadPool* globalThreadPool = QThreadPool::globalInstance();
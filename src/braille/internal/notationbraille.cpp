@@ -66,21 +66,32 @@ void NotationBraille::init()
     updateTableForLyricsFromPreferences();
     brailleConfiguration()->brailleTableChanged().onNotify(this, [this]() {
         updateTableForLyricsFromPreferences();
+        m_measureBrailleCache.clear();
     });
 
     setIntervalDirection(brailleConfiguration()->intervalDirection());
     brailleConfiguration()->intervalDirectionChanged().onNotify(this, [this]() {
         BrailleIntervalDirection direction = brailleConfiguration()->intervalDirection();
         setIntervalDirection(direction);
+        m_measureBrailleCache.clear();
     });
 
     globalContext()->currentNotationChanged().onNotify(this, [this]() {
+        m_measureBrailleCache.clear();
+        current_measure = nullptr;
+
         if (notation()) {
             notation()->interaction()->selectionChanged().onNotify(this, [this]() {
                 doBraille();
             });
 
             notation()->notationChanged().onNotify(this, [this]() {
+                //! NOTE: every mouse move of a drag notifies about the change, but dragging
+                //! only moves items and doesn't change the braille text until the drag ends
+                if (interaction()->isDragStarted()) {
+                    return;
+                }
+
                 setCurrentItemPosition(0, 0);
                 doBraille(true);
             });
@@ -168,10 +179,18 @@ void NotationBraille::doBraille(bool force)
                 }
                 current_measure = nullptr;
             } else {
+                if (force) {
+                    m_measureBrailleCache.clear();
+                }
                 if (m != current_measure || force) {
-                    brailleEngravingItemList()->clear();
-                    Braille lb(score());
-                    lb.convertMeasure(m, brailleEngravingItemList());
+                    auto it = m_measureBrailleCache.find(m);
+                    if (it == m_measureBrailleCache.end()) {
+                        BrailleEngravingItemList measureBraille;
+                        Braille lb(score());
+                        lb.convertMeasure(m, &measureBraille);
+                        it = m_measureBrailleCache.emplace(m, measureBraille).first;
+                    }
+                    m_beil = it->second;
                     setBrailleInfo(brailleEngravingItemList()->brailleStr());
                     current_measure = m;
                 }
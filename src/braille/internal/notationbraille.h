@@ -23,6 +23,8 @@
 #ifndef MU_BRAILLE_NOTATIONBRAILLE_H
 #define MU_BRAILLE_NOTATIONBRAILLE_H
 
+#include <map>
+
 #include "async/asyncable.h"
 #include "async/notification.h"
 #include "context/iglobalcontext.h"
@@ -121,6 +123,9 @@ private:
     EngravingItem* current_engraving_item = nullptr;
     BrailleEngravingItem* current_bei = nullptr;
     BrailleEngravingItemList m_beil;
+    // translated measures, so that navigating back and forth doesn't run the translation again;
+    // cleared whenever the notation or the braille settings change
+    std::map<const Measure*, BrailleEngravingItemList> m_measureBrailleCache;
     BrailleInputState m_braille_input;
 
     muse::ValCh<std::string> m_brailleInfo;
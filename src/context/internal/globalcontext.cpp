@@ -100,6 +100,13 @@ void GlobalContext::doSetCurrentNotation(const INotationPtr& notation)
     if (m_currentNotation) {
         m_currentNotation->setIsOpen(true);
     }
+
+    //! NOTE Parts that are open in background tabs are laid out when they are viewed again
+    if (IMasterNotationPtr master = currentMasterNotation()) {
+        for (const IExcerptNotationPtr& excerpt : master->excerpts()) {
+            excerpt->setLayoutDeferred(excerpt->notation() != m_currentNotation);
+        }
+    }
 }
 
 void GlobalContext::setCurrentPlayer(const muse::audio::IPlayerPtr& player)
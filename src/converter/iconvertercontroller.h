@@ -44,6 +44,12 @@ public:
                                    const muse::String& soundProfile = muse::String(),
                                    const muse::UriQuery& extensionUri = muse::UriQuery(), muse::ProgressPtr progress = nullptr) = 0;
 
+    //! NOTE Reads jobs (same objects as in a batch job file) as JSON lines from stdin
+    //! until it is closed, and writes one JSON line with the result of each job to stdout
+    virtual muse::Ret streamConvert(const muse::io::path_t& stylePath = muse::io::path_t(), bool forceMode = false,
+                                    const muse::String& soundProfile = muse::String(),
+                                    const muse::UriQuery& extensionUri = muse::UriQuery()) = 0;
+
     virtual muse::Ret convertScoreParts(const muse::io::path_t& in, const muse::io::path_t& out,
                                         const muse::io::path_t& stylePath = muse::io::path_t(), bool forceMode = false) = 0;
 
@@ -294,28 +294,11 @@ Ret BackendApi::exportScorePngs(const INotationPtr notation, BackendJsonWriter&
     jsonWriter.addKey("pngs");
     jsonWriter.openArray();
 
-    PageList notationPages = pages(notation);
-
-    bool result = true;
-    for (size_t i = 0; i < notationPages.size(); ++i) {
-        ByteArray pngData;
-        Buffer pngDevice(&pngData);
-        pngDevice.open(IODevice::ReadWrite);
-
-        INotationWriter::Options options = {
-            { INotationWriter::OptionKey::PAGE_NUMBER, Val(static_cast<int>(i)) },
-            { INotationWriter::OptionKey::TRANSPARENT_BACKGROUND, Val(false) }
-        };
-
-        Ret writeRet = pngWriter->write(notation, pngDevice, options);
-        if (!writeRet) {
-            LOGW() << writeRet.toString();
-            result = false;
-        }
+    INotationWriter::Options options = {
+        { INotationWriter::OptionKey::TRANSPARENT_BACKGROUND, Val(false) }
+    };
 
-        bool lastArrayValue = ((notationPages.size() - 1) == i);
-        jsonWriter.addValue(pngData.toQByteArrayNoCopy().toBase64(), !lastArrayValue);
-    }
+    bool result = writePages(pngWriter, notation, options, jsonWriter);
 
     jsonWriter.closeArray(addSeparator);
 
@@ -336,36 +319,52 @@ Ret BackendApi::exportScoreSvgs(const INotationPtr notation, const muse::io::pat
     jsonWriter.addKey("svgs");
     jsonWriter.openArray();
 
-    PageList notationPages = pages(notation);
     QVariantMap beatsColors = readBeatsColors(highlightConfigPath);
 
-    bool result = true;
-    for (size_t i = 0; i < notationPages.size(); ++i) {
-        ByteArray svgData;
-        Buffer svgDevice(&svgData);
-        svgDevice.open(IODevice::ReadWrite);
-
-        INotationWriter::Options options {
-            { INotationWriter::OptionKey::PAGE_NUMBER, Val(static_cast<int>(i)) },
-            { INotationWriter::OptionKey::TRANSPARENT_BACKGROUND, Val(false) },
-            { INotationWriter::OptionKey::BEATS_COLORS, Val::fromQVariant(beatsColors) }
-        };
-
-        Ret writeRet = svgWriter->write(notation, svgDevice, options);
-        if (!writeRet) {
-            LOGW() << writeRet.toString();
-            result = false;
-        }
+    INotationWriter::Options options {
+        { INotationWriter::OptionKey::TRANSPARENT_BACKGROUND, Val(false) },
+        { INotationWriter::OptionKey::BEATS_COLORS, Val::fromQVariant(beatsColors) }
+    };
 
-        bool lastArrayValue = ((notationPages.size() - 1) == i);
-        jsonWriter.addValue(svgData.toQByteArrayNoCopy().toBase64(), !lastArrayValue);
-    }
+    bool result = writePages(svgWriter, notation, options, jsonWriter);
 
     jsonWriter.closeArray(addSeparator);
 
     return result ? make_ret(Ret::Code::Ok) : make_ret(Ret::Code::InternalError);
 }
 
+Ret BackendApi::writePages(INotationWriterPtr writer, const INotationPtr notation, const INotationWriter::Options& options,
+                           BackendJsonWriter& jsonWriter)
+{
+    //! NOTE All pages go through writePages at once, so writers that can overlap
+    //! painting and encoding (e.g. PNG) do so instead of handling one page per call
+    const size_t pagesCount = pages(notation).size();
+
+    std::vector<ByteArray> pagesData(pagesCount);
+    std::vector<std::unique_ptr<Buffer> > buffers;
+    std::vector<IODevice*> devices;
+    buffers.reserve(pagesCount);
+    devices.reserve(pagesCount);
+
+    for (ByteArray& pageData : pagesData) {
+        buffers.push_back(std::make_unique<Buffer>(&pageData));
+        buffers.back()->open(IODevice::ReadWrite);
+        devices.push_back(buffers.back().get());
+    }
+
+    Ret writeRet = writer->writePages(notation, devices, options);
+    if (!writeRet) {
+        LOGW() << writeRet.toString();
+    }
+
+    for (size_t i = 0; i < pagesCount; ++i) {
+        bool lastArrayValue = ((pagesCount - 1) == i);
+        jsonWriter.addValue(pagesData[i].toQByteArrayNoCopy().toBase64(), !lastArrayValue);
+    }
+
+    return writeRet;
+}
+
 Ret BackendApi::exportScoreElementsPositions(const std::string& elementsPositionsWriterName, const std::string& elementsPositionsTagName,
                                              const INotationPtr notation, BackendJsonWriter& jsonWriter, bool addSeparator)
 {
@@ -707,8 +706,9 @@ void BackendApi::initPotentialExcerpts(notation::IMasterNotationPtr masterNotati
 {
     ExcerptNotationList potentialExcerpts = masterNotation->potentialExcerpts();
 
+    //! NOTE: Creating an excerpt already lays it out, and the existing excerpts
+    //!       were laid out when the project was opened, so no relayout is needed here
     masterNotation->initExcerpts(potentialExcerpts);
-    renderExcerptsContents(masterNotation);
 }
 
 Ret BackendApi::updateSource(const muse::io::path_t& in, const std::string& newSource, bool forceMode)
@@ -74,6 +74,8 @@ private:
     static muse::Ret exportScorePngs(const notation::INotationPtr notation, BackendJsonWriter& jsonWriter, bool addSeparator = false);
     static muse::Ret exportScoreSvgs(const notation::INotationPtr notation, const muse::io::path_t& highlightConfigPath,
                                      BackendJsonWriter& jsonWriter, bool addSeparator = false);
+    static muse::Ret writePages(project::INotationWriterPtr writer, const notation::INotationPtr notation,
+                                const project::INotationWriter::Options& options, BackendJsonWriter& jsonWriter);
     static muse::Ret exportScoreElementsPositions(const std::string& elementsPositionsWriterName,
                                                   const std::string& elementsPositionsTagName, const notation::INotationPtr notation,
                                                   BackendJsonWriter& jsonWriter, bool addSeparator = false);
@@ -27,8 +27,11 @@
 #include <QJsonObject>
 #include <QJsonDocument>
 
+#include "engraving/dom/masterscore.h"
+#include "engraving/dom/memoryusage.h"
 #include "engraving/dom/tempotext.h"
 #include "engraving/dom/text.h"
+#include "engraving/types/typesconv.h"
 
 #include "log.h"
 
@@ -78,6 +81,7 @@ RetVal<std::string> NotationMeta::metaJson(notation::INotationPtr notation)
     json["parts"] =  partsJsonArray(score);
     json["pageFormat"] = pageFormatJson(score->style());
     json["textFramesData"] =  typeDataJson(score);
+    json["memoryUsage"] = memoryUsageJson(score->masterScore());
 
     RetVal<std::string> result;
     result.ret = make_ret(Ret::Code::Ok);
@@ -260,3 +264,45 @@ QJsonObject NotationMeta::typeDataJson(mu::engraving::Score* score)
 
     return typesData;
 }
+
+static QJsonObject scoreMemoryUsageJson(const ScoreMemoryUsage& usage)
+{
+    QJsonObject types;
+    for (const auto& p : usage.types) {
+        QJsonObject type;
+        type["count"] = static_cast<qint64>(p.second.count);
+        type["bytes"] = static_cast<qint64>(p.second.bytes);
+        types[QString(TConv::toXml(p.first).ascii())] = type;
+    }
+
+    QJsonObject json;
+    json["objects"] = static_cast<qint64>(usage.objectCount);
+    json["objectsBytes"] = static_cast<qint64>(usage.objectBytes);
+    json["layoutData"] = static_cast<qint64>(usage.layoutDataCount);
+    json["shapeElements"] = static_cast<qint64>(usage.shapeElementCount);
+    json["shapesBytes"] = static_cast<qint64>(usage.shapeBytes);
+    json["types"] = types;
+
+    return json;
+}
+
+QJsonObject NotationMeta::memoryUsageJson(mu::engraving::MasterScore* score)
+{
+    MemoryUsage usage = MemoryUsage::collect(score);
+
+    QJsonObject excerpts;
+    for (const auto& excerpt : usage.excerpts) {
+        excerpts[excerpt.first.toQString()] = scoreMemoryUsageJson(excerpt.second);
+    }
+
+    QJsonObject json;
+    json["totalBytes"] = static_cast<qint64>(usage.totalBytes());
+    json["score"] = scoreMemoryUsageJson(usage.masterScore);
+    json["excerpts"] = excerpts;
+    json["undoCommands"] = static_cast<qint64>(usage.undoCommandCount);
+    json["undoBytes"] = static_cast<qint64>(usage.undoBytes);
+    json["images"] = static_cast<qint64>(usage.imageCount);
+    json["imagesBytes"] = static_cast<qint64>(usage.imageBytes);
+
+    return json;
+}
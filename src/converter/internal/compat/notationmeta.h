@@ -26,6 +26,7 @@
 
 namespace mu::engraving {
 class Score;
+class MasterScore;
 class MStyle;
 }
 
@@ -45,6 +46,7 @@ private:
     static QJsonArray partsJsonArray(const mu::engraving::Score* score);
     static QJsonObject pageFormatJson(const mu::engraving::MStyle& style);
     static QJsonObject typeDataJson(mu::engraving::Score* score);
+    static QJsonObject memoryUsageJson(mu::engraving::MasterScore* score);
 };
 }
 
@@ -21,6 +21,10 @@
  */
 #include "convertercontroller.h"
 
+#include <iostream>
+#include <memory>
+#include <vector>
+
 #include <QJsonDocument>
 #include <QJsonObject>
 #include <QJsonArray>
@@ -65,6 +69,8 @@ Ret ConverterController::batchConvert(const muse::io::path_t& batchJobFile, cons
 
     StringList errors;
 
+    LoadedProject loaded;
+
     int64_t current = 0;
     int64_t total = batchJob.val.size();
     for (const Job& job : batchJob.val) {
@@ -73,7 +79,7 @@ Ret ConverterController::batchConvert(const muse::io::path_t& batchJobFile, cons
             progress->progressChanged.send(current, total, job.in.toStdString());
         }
 
-        Ret ret = fileConvert(job.in, job.out, stylePath, forceMode, soundProfile, extensionUri, job.transposeOptions);
+        Ret ret = convertJob(job, stylePath, forceMode, soundProfile, extensionUri, loaded);
         if (!ret) {
             errors.emplace_back(String(u"failed convert, err: %1, in: %2, out: %3")
                                 .arg(String::fromStdString(ret.toString())).arg(job.in.toString()).arg(job.out.toString()));
@@ -94,6 +100,86 @@ Ret ConverterController::batchConvert(const muse::io::path_t& batchJobFile, cons
     return ret;
 }
 
+Ret ConverterController::streamConvert(const muse::io::path_t& stylePath, bool forceMode, const muse::String& soundProfile,
+                                       const muse::UriQuery& extensionUri)
+{
+    TRACEFUNC;
+
+    LoadedProject loaded;
+    bool allSucceeded = true;
+
+    std::string line;
+    while (std::getline(std::cin, line)) {
+        if (line.empty()) {
+            continue;
+        }
+
+        QJsonObject result;
+        Ret ret;
+
+        QJsonParseError err;
+        QJsonDocument doc = QJsonDocument::fromJson(QByteArray::fromStdString(line), &err);
+        if (err.error != QJsonParseError::NoError || !doc.isObject()) {
+            ret = make_ret(Err::BatchJobFileFailedParse, err.errorString().toStdString());
+        } else {
+            QJsonObject obj = doc.object();
+            result["in"] = obj["in"];
+            result["out"] = obj["out"];
+
+            RetVal<Job> job = parseJob(obj);
+            if (!job.ret) {
+                ret = job.ret;
+            } else if (job.val.in.empty() || job.val.out.empty()) {
+                ret = make_ret(Err::BatchJobFileFailedParse, "a job needs \"in\" and \"out\"");
+            } else {
+                ret = convertJob(job.val, stylePath, forceMode, soundProfile, extensionUri, loaded);
+            }
+        }
+
+        result["ok"] = ret.success();
+        if (!ret) {
+            allSucceeded = false;
+            result["error"] = QString::fromStdString(ret.toString());
+        }
+
+        std::cout << QJsonDocument(result).toJson(QJsonDocument::Compact).toStdString() << std::endl;
+    }
+
+    return allSucceeded ? make_ret(Ret::Code::Ok) : make_ret(Err::ConvertFailed);
+}
+
+Ret ConverterController::convertJob(const Job& job, const muse::io::path_t& stylePath, bool forceMode, const muse::String& soundProfile,
+                                    const muse::UriQuery& extensionUri, LoadedProject& loaded)
+{
+    LOGI() << "in: " << job.in << ", out: " << job.out;
+
+    const std::string suffix = io::suffix(job.out);
+    auto writer = writers()->writer(suffix);
+    if (!writer) {
+        return make_ret(Err::ConvertTypeUnknown);
+    }
+
+    //! NOTE Consecutive jobs with the same input reuse the loaded score,
+    //! unless the previous job may have modified it (transposition, extension, save)
+    if (!loaded.project || loaded.path != job.in) {
+        RetVal<INotationProjectPtr> project = loadProject(job.in, stylePath, forceMode, soundProfile);
+        loaded.project = project.val;
+        loaded.path = job.in;
+        if (!project.ret) {
+            return project.ret;
+        }
+    }
+
+    Ret ret = convertProject(loaded.project, writer, job.out, extensionUri, job.transposeOptions);
+
+    const bool scoreMayBeModified = job.transposeOptions.has_value() || extensionUri.isValid() || isSaveSuffix(suffix);
+    if (scoreMayBeModified) {
+        loaded.project = nullptr;
+    }
+
+    return ret;
+}
+
 Ret ConverterController::fileConvert(const muse::io::path_t& in, const muse::io::path_t& out,
                                      const muse::io::path_t& stylePath,
                                      bool forceMode,
@@ -126,21 +212,38 @@ Ret ConverterController::fileConvert(const muse::io::path_t& in, const muse::io:
 
     LOGI() << "in: " << in << ", out: " << out;
 
-    auto notationProject = notationCreator()->newProject(iocContext());
-    IF_ASSERT_FAILED(notationProject) {
-        return make_ret(Err::UnknownError);
-    }
-
     std::string suffix = io::suffix(out);
     auto writer = writers()->writer(suffix);
     if (!writer) {
         return make_ret(Err::ConvertTypeUnknown);
     }
 
+    RetVal<INotationProjectPtr> project = loadProject(in, stylePath, forceMode, soundProfile);
+    if (!project.ret) {
+        return project.ret;
+    }
+
+    return convertProject(project.val, writer, out, extensionUri, transposeOptions);
+}
+
+RetVal<INotationProjectPtr> ConverterController::loadProject(const muse::io::path_t& in, const muse::io::path_t& stylePath,
+                                                             bool forceMode, const muse::String& soundProfile)
+{
+    TRACEFUNC;
+
+    RetVal<INotationProjectPtr> rv;
+
+    auto notationProject = notationCreator()->newProject(iocContext());
+    IF_ASSERT_FAILED(notationProject) {
+        rv.ret = make_ret(Err::UnknownError);
+        return rv;
+    }
+
     Ret ret = notationProject->load(in, stylePath, forceMode);
     if (!ret) {
         LOGE() << "failed load notation, err: " << ret.toString() << ", path: " << in;
-        return make_ret(Err::InFileFailedLoad);
+        rv.ret = make_ret(Err::InFileFailedLoad);
+        return rv;
     }
 
     if (!soundProfile.isEmpty()) {
@@ -148,6 +251,20 @@ Ret ConverterController::fileConvert(const muse::io::path_t& in, const muse::io:
         notationProject->audioSettings()->setActiveSoundProfile(soundProfile);
     }
 
+    rv.ret = make_ret(Ret::Code::Ok);
+    rv.val = notationProject;
+    return rv;
+}
+
+Ret ConverterController::convertProject(INotationProjectPtr notationProject, INotationWriterPtr writer, const muse::io::path_t& out,
+                                        const muse::UriQuery& extensionUri,
+                                        const std::optional<notation::TransposeOptions>& transposeOptions)
+{
+    TRACEFUNC;
+
+    const std::string suffix = io::suffix(out);
+    Ret ret = make_ret(Ret::Code::Ok);
+
     if (transposeOptions.has_value()) {
         ret = ConverterUtils::applyTranspose(notationProject->masterNotation()->notation(), transposeOptions.value());
         if (!ret) {
@@ -167,7 +284,7 @@ Ret ConverterController::fileConvert(const muse::io::path_t& in, const muse::io:
     }
     // standart convert
     else {
-        if (suffix == engraving::MSCZ || suffix == engraving::MSCX || suffix == engraving::MSCS) {
+        if (isSaveSuffix(suffix)) {
             return notationProject->save(out);
         }
 
@@ -243,34 +360,47 @@ RetVal<ConverterController::BatchJob> ConverterController::parseBatchJob(const m
 
     QJsonArray arr = doc.array();
 
+    for (const QJsonValue& v : arr) {
+        RetVal<Job> job = parseJob(v.toObject());
+        if (!job.ret) {
+            rv.ret = job.ret;
+            return rv;
+        }
+
+        if (!job.val.in.empty() && !job.val.out.empty()) {
+            rv.val.push_back(std::move(job.val));
+        }
+    }
+
+    rv.ret = make_ret(Ret::Code::Ok);
+    return rv;
+}
+
+RetVal<ConverterController::Job> ConverterController::parseJob(const QJsonObject& obj) const
+{
+    RetVal<Job> rv;
+
     auto correctUserInputPath = [](const QString& path) -> QString {
         return io::Dir::fromNativeSeparators(path).toQString();
     };
 
-    for (const QJsonValue& v : arr) {
-        QJsonObject obj = v.toObject();
-
-        Job job;
-        job.in = correctUserInputPath(obj["in"].toString());
-        job.out = correctUserInputPath(obj["out"].toString());
-
-        QJsonObject transposeOptionsObj = obj["transpose"].toObject();
-        if (!transposeOptionsObj.isEmpty()) {
-            RetVal<TransposeOptions> transposeOptions = ConverterUtils::parseTransposeOptions(transposeOptionsObj);
-            if (!transposeOptions.ret) {
-                rv.ret = transposeOptions.ret;
-                return rv;
-            }
+    Job job;
+    job.in = correctUserInputPath(obj["in"].toString());
+    job.out = correctUserInputPath(obj["out"].toString());
 
-            job.transposeOptions = transposeOptions.val;
+    QJsonObject transposeOptionsObj = obj["transpose"].toObject();
+    if (!transposeOptionsObj.isEmpty()) {
+        RetVal<TransposeOptions> transposeOptions = ConverterUtils::parseTransposeOptions(transposeOptionsObj);
+        if (!transposeOptions.ret) {
+            rv.ret = transposeOptions.ret;
+            return rv;
         }
 
-        if (!job.in.empty() && !job.out.empty()) {
-            rv.val.push_back(std::move(job));
-        }
+        job.transposeOptions = transposeOptions.val;
     }
 
     rv.ret = make_ret(Ret::Code::Ok);
+    rv.val = std::move(job);
     return rv;
 }
 
@@ -300,6 +430,11 @@ Ret ConverterController::convertByExtension(INotationWriterPtr writer, INotation
     return make_ret(Ret::Code::Ok);
 }
 
+bool ConverterController::isSaveSuffix(const std::string& suffix) const
+{
+    return suffix == engraving::MSCZ || suffix == engraving::MSCX || suffix == engraving::MSCS;
+}
+
 bool ConverterController::isConvertPageByPage(const std::string& suffix) const
 {
     QList<std::string> types {
@@ -314,30 +449,39 @@ Ret ConverterController::convertPageByPage(INotationWriterPtr writer, INotationP
 {
     TRACEFUNC;
 
-    for (size_t i = 0; i < notation->elements()->pages().size(); i++) {
+    const size_t pageCount = notation->elements()->pages().size();
+
+    std::vector<std::unique_ptr<File> > files;
+    std::vector<IODevice*> devices;
+    files.reserve(pageCount);
+    devices.reserve(pageCount);
+
+    for (size_t i = 0; i < pageCount; i++) {
         const String filePath = muse::io::path_t(io::dirpath(out) + "/"
                                                  + io::completeBasename(out) + "-%1."
                                                  + io::suffix(out)).toString().arg(i + 1);
 
-        File file(filePath);
-        if (!file.open(File::WriteOnly)) {
+        auto file = std::make_unique<File>(filePath);
+        if (!file->open(File::WriteOnly)) {
             return make_ret(Err::OutFileFailedOpen);
         }
 
-        INotationWriter::Options options = {
-            { INotationWriter::OptionKey::PAGE_NUMBER, Val(static_cast<int>(i)) },
-        };
+        file->setMeta("dir_path", out.toStdString());
+        file->setMeta("file_path", filePath.toStdString());
 
-        file.setMeta("dir_path", out.toStdString());
-        file.setMeta("file_path", filePath.toStdString());
+        devices.push_back(file.get());
+        files.push_back(std::move(file));
+    }
 
-        Ret ret = writer->write(notation, file, options);
-        if (!ret) {
-            LOGE() << "failed write, err: " << ret.toString() << ", path: " << out;
-            return make_ret(Err::OutFileFailedWrite);
-        }
+    //! NOTE The writer gets all pages at once, so it can overlap the work for several pages
+    Ret ret = writer->writePages(notation, devices);
+    if (!ret) {
+        LOGE() << "failed write, err: " << ret.toString() << ", path: " << out;
+        return make_ret(Err::OutFileFailedWrite);
+    }
 
-        file.close();
+    for (std::unique_ptr<File>& file : files) {
+        file->close();
     }
 
     return make_ret(Ret::Code::Ok);
@@ -23,6 +23,8 @@
 
 #include <list>
 
+#include <QJsonObject>
+
 #include "../iconvertercontroller.h"
 
 #include "modularity/ioc.h"
@@ -57,6 +59,10 @@ public:
                            const muse::String& soundProfile = muse::String(),
                            const muse::UriQuery& extensionUri = muse::UriQuery(), muse::ProgressPtr progress = nullptr) override;
 
+    muse::Ret streamConvert(const muse::io::path_t& stylePath = muse::io::path_t(), bool forceMode = false,
+                            const muse::String& soundProfile = muse::String(),
+                            const muse::UriQuery& extensionUri = muse::UriQuery()) override;
+
     muse::Ret convertScoreParts(const muse::io::path_t& in, const muse::io::path_t& out,
                                 const muse::io::path_t& stylePath = muse::io::path_t(), bool forceMode = false) override;
 
@@ -86,15 +92,32 @@ private:
 
     using BatchJob = std::list<Job>;
 
+    //! NOTE The score loaded by the previous job, reused by following jobs with the same input
+    struct LoadedProject {
+        project::INotationProjectPtr project;
+        muse::io::path_t path;
+    };
+
     muse::RetVal<BatchJob> parseBatchJob(const muse::io::path_t& batchJobFile) const;
+    muse::RetVal<Job> parseJob(const QJsonObject& obj) const;
+
+    muse::Ret convertJob(const Job& job, const muse::io::path_t& stylePath, bool forceMode, const muse::String& soundProfile,
+                         const muse::UriQuery& extensionUri, LoadedProject& loaded);
 
     muse::Ret fileConvert(const muse::io::path_t& in, const muse::io::path_t& out,
                           const muse::io::path_t& stylePath = muse::io::path_t(), bool forceMode = false,
                           const muse::String& soundProfile = muse::String(),
                           const muse::UriQuery& extensionUri = muse::UriQuery(), const std::optional<notation::TransposeOptions>& transposeOptions = std::nullopt);
 
+    muse::RetVal<project::INotationProjectPtr> loadProject(const muse::io::path_t& in, const muse::io::path_t& stylePath, bool forceMode,
+                                                           const muse::String& soundProfile);
+    muse::Ret convertProject(project::INotationProjectPtr notationProject, project::INotationWriterPtr writer,
+                             const muse::io::path_t& out, const muse::UriQuery& extensionUri,
+                             const std::optional<notation::TransposeOptions>& transposeOptions);
+
     muse::Ret convertByExtension(project::INotationWriterPtr writer, notation::INotationPtr notation, const muse::io::path_t& out,
                                  const muse::UriQuery& extensionUri);
+    bool isSaveSuffix(const std::string& suffix) const;
     bool isConvertPageByPage(const std::string& suffix) const;
     muse::Ret convertPageByPage(project::INotationWriterPtr writer, notation::INotationPtr notation, const muse::io::path_t& out) const;
     muse::Ret convertFullNotation(project::INotationWriterPtr writer, notation::INotationPtr notation, const muse::io::path_t& out) const;
@@ -24,6 +24,8 @@ set(API_V1_SRC
     ${CMAKE_CURRENT_LIST_DIR}/part.h
     ${CMAKE_CURRENT_LIST_DIR}/instrument.cpp
     ${CMAKE_CURRENT_LIST_DIR}/instrument.h
+    ${CMAKE_CURRENT_LIST_DIR}/notedata.cpp
+    ${CMAKE_CURRENT_LIST_DIR}/notedata.h
     ${CMAKE_CURRENT_LIST_DIR}/playevent.cpp
     ${CMAKE_CURRENT_LIST_DIR}/playevent.h
     ${CMAKE_CURRENT_LIST_DIR}/selection.cpp
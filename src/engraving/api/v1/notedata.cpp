@@ -0,0 +1,192 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-Studio-CLA-applies
+ *
+ * MuseScore Studio
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2025 MuseScore Limited
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "notedata.h"
+
+#include <cstring>
+
+#include "engraving/dom/chord.h"
+#include "engraving/dom/measure.h"
+#include "engraving/dom/note.h"
+#include "engraving/dom/score.h"
+#include "engraving/dom/segment.h"
+
+#include "log.h"
+
+using namespace mu::engraving;
+
+static QByteArray packInts(const std::vector<int32_t>& values)
+{
+    return QByteArray(reinterpret_cast<const char*>(values.data()), static_cast<qsizetype>(values.size() * sizeof(int32_t)));
+}
+
+static void appendChordNotes(Chord* chord, std::vector<Note*>& notes)
+{
+    notes.insert(notes.end(), chord->notes().begin(), chord->notes().end());
+
+    for (Chord* grace : chord->graceNotes()) {
+        notes.insert(notes.end(), grace->notes().begin(), grace->notes().end());
+    }
+}
+
+//---------------------------------------------------------
+//   notesInRange
+///   Notes of the chords starting within [startTick, endTick)
+///   on the staves [startStaff, endStaff), in time order.
+///   Negative end values stand for the end of the score.
+//---------------------------------------------------------
+
+std::vector<Note*> mu::engraving::apiv1::notesInRange(Score* score, int startTick, int endTick, int startStaff, int endStaff)
+{
+    std::vector<Note*> notes;
+
+    const staff_idx_t nstaves = score->nstaves();
+    const staff_idx_t firstStaff = static_cast<staff_idx_t>(std::max(startStaff, 0));
+    const staff_idx_t lastStaff = endStaff < 0 ? nstaves : std::min(static_cast<staff_idx_t>(endStaff), nstaves);
+
+    const Fraction start = Fraction::fromTicks(std::max(startTick, 0));
+    const Fraction end = endTick < 0 ? score->endTick() : Fraction::fromTicks(endTick);
+
+    Measure* measure = score->tick2measure(start);
+    if (!measure || firstStaff >= lastStaff) {
+        return notes;
+    }
+
+    const track_idx_t startTrack = firstStaff * VOICES;
+    const track_idx_t endTrack = lastStaff * VOICES;
+
+    for (Segment* s = measure->first(SegmentType::ChordRest); s && s->tick() < end; s = s->next1(SegmentType::ChordRest)) {
+        if (s->tick() < start) {
+            continue;
+        }
+
+        for (track_idx_t track = startTrack; track < endTrack; ++track) {
+            EngravingItem* e = s->element(track);
+            if (e && e->isChord()) {
+                appendChordNotes(toChord(e), notes);
+            }
+        }
+    }
+
+    return notes;
+}
+
+//---------------------------------------------------------
+//   packNoteData
+//---------------------------------------------------------
+
+QVariantMap mu::engraving::apiv1::packNoteData(const std::vector<Note*>& notes)
+{
+    const size_t count = notes.size();
+
+    std::vector<int32_t> pitches(count);
+    std::vector<int32_t> tpcs(count);
+    std::vector<int32_t> ticks(count);
+    std::vector<int32_t> durations(count);
+    std::vector<int32_t> tracks(count);
+    std::vector<int32_t> velocities(count);
+
+    for (size_t i = 0; i < count; ++i) {
+        const Note* note = notes[i];
+
+        pitches[i] = note->pitch();
+        tpcs[i] = note->tpc();
+        ticks[i] = note->tick().ticks();
+        durations[i] = note->chord()->actualTicks().ticks();
+        tracks[i] = static_cast<int32_t>(note->track());
+        velocities[i] = note->userVelocity();
+    }
+
+    return {
+        { "count", static_cast<int>(count) },
+        { "pitches", packInts(pitches) },
+        { "tpcs", packInts(tpcs) },
+        { "ticks", packInts(ticks) },
+        { "durations", packInts(durations) },
+        { "tracks", packInts(tracks) },
+        { "velocities", packInts(velocities) },
+    };
+}
+
+//---------------------------------------------------------
+//   setNotesProperty
+//---------------------------------------------------------
+
+bool mu::engraving::apiv1::setNotesProperty(const std::vector<Note*>& notes, const QString& propertyName, const QVariant& values)
+{
+    const std::string name = propertyName.toStdString();
+    const Pid pid = propertyId(name);
+    if (pid == Pid::END) {
+        LOGW() << "unknown property: " << propertyName;
+        return false;
+    }
+
+    //! NOTE These types need the spatium or a wrapper object to be converted, see ScoreElement::set
+    const P_TYPE type = propertyType(pid);
+    switch (type) {
+    case P_TYPE::FRACTION:
+    case P_TYPE::POINT:
+    case P_TYPE::MILLIMETRE:
+    case P_TYPE::SPATIUM:
+    case P_TYPE::ALIGN:
+        LOGW() << "property can't be set in bulk: " << propertyName;
+        return false;
+    default:
+        break;
+    }
+
+    const bool isList = values.typeId() == QMetaType::QVariantList;
+    const bool isPacked = values.typeId() == QMetaType::QByteArray;
+
+    const QVariantList list = isList ? values.toList() : QVariantList();
+    const QByteArray packed = isPacked ? values.toByteArray() : QByteArray();
+    const size_t count = isList ? list.size() : isPacked ? packed.size() / sizeof(int32_t) : notes.size();
+
+    if (count != notes.size()) {
+        LOGW() << "expected " << notes.size() << " values, got " << count;
+        return false;
+    }
+
+    const PropertyValue single = (isList || isPacked) ? PropertyValue() : PropertyValue::fromQVariant(values, type);
+
+    for (size_t i = 0; i < notes.size(); ++i) {
+        PropertyValue value = single;
+
+        if (isList) {
+            value = PropertyValue::fromQVariant(list.at(i), type);
+        } else if (isPacked) {
+            int32_t packedValue = 0;
+            std::memcpy(&packedValue, packed.constData() + i * sizeof(int32_t), sizeof(int32_t));
+            value = PropertyValue::fromQVariant(QVariant(packedValue), type);
+        }
+
+        Note* note = notes[i];
+        if (note->getProperty(pid) == value) {
+            continue;
+        }
+
+        const PropertyFlags flags = note->propertyFlags(pid);
+        note->undoChangeProperty(pid, value, flags == PropertyFlags::NOSTYLE ? flags : PropertyFlags::UNSTYLED);
+    }
+
+    return true;
+}
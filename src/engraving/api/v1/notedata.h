@@ -0,0 +1,51 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-Studio-CLA-applies
+ *
+ * MuseScore Studio
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2025 MuseScore Limited
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef MU_ENGRAVING_APIV1_NOTEDATA_H
+#define MU_ENGRAVING_APIV1_NOTEDATA_H
+
+#include <vector>
+
+#include <QString>
+#include <QVariant>
+
+namespace mu::engraving {
+class Note;
+class Score;
+}
+
+namespace mu::engraving::apiv1 {
+//! NOTE Bulk access to notes for plugins. Instead of one wrapper object
+//! per note, the notes are described by packed arrays of 32-bit integers
+//! (ArrayBuffers on the JavaScript side) with the keys "pitches", "tpcs",
+//! "ticks", "durations", "tracks" and "velocities", next to their "count"
+
+std::vector<mu::engraving::Note*> notesInRange(mu::engraving::Score* score, int startTick, int endTick, int startStaff, int endStaff);
+
+QVariantMap packNoteData(const std::vector<mu::engraving::Note*>& notes);
+
+//! NOTE values is either a single value applied to all the notes,
+//! or a list with one value per note, in the order of packNoteData
+bool setNotesProperty(const std::vector<mu::engraving::Note*>& notes, const QString& propertyName, const QVariant& values);
+}
+
+#endif // MU_ENGRAVING_APIV1_NOTEDATA_H
@@ -26,6 +26,7 @@
 
 #include "engraving/dom/factory.h"
 #include "engraving/dom/instrtemplate.h"
+#include "engraving/dom/masterscore.h"
 #include "engraving/dom/measure.h"
 #include "engraving/dom/score.h"
 #include "engraving/dom/segment.h"
@@ -34,6 +35,7 @@
 // api
 #include "cursor.h"
 #include "elements.h"
+#include "notedata.h"
 
 using namespace mu::engraving::apiv1;
 
@@ -262,5 +264,54 @@ void Score::endCmd(bool rollback)
         undoStack()->commitChanges();
     }
 
+    if (score()->masterScore()->isBulkEditActive()) {
+        return;
+    }
+
     notation()->notationChanged().notify();
 }
+
+//---------------------------------------------------------
+//   Score::noteData
+//---------------------------------------------------------
+
+QVariantMap Score::noteData(int startTick, int endTick, int startStaff, int endStaff)
+{
+    return packNoteData(notesInRange(score(), startTick, endTick, startStaff, endStaff));
+}
+
+//---------------------------------------------------------
+//   Score::setNoteProperty
+//---------------------------------------------------------
+
+bool Score::setNoteProperty(const QString& propertyName, const QVariant& values, int startTick, int endTick, int startStaff, int endStaff)
+{
+    return setNotesProperty(notesInRange(score(), startTick, endTick, startStaff, endStaff), propertyName, values);
+}
+
+//---------------------------------------------------------
+//   Score::startBulkEdit
+//---------------------------------------------------------
+
+void Score::startBulkEdit()
+{
+    score()->masterScore()->startBulkEdit();
+}
+
+//---------------------------------------------------------
+//   Score::endBulkEdit
+//---------------------------------------------------------
+
+void Score::endBulkEdit()
+{
+    mu::engraving::MasterScore* ms = score()->masterScore();
+    IF_ASSERT_FAILED(ms->isBulkEditActive()) {
+        return;
+    }
+
+    ms->endBulkEdit();
+
+    if (!ms->isBulkEditActive()) {
+        notation()->notationChanged().notify();
+    }
+}
@@ -240,6 +240,55 @@ public:
      */
     Q_INVOKABLE void endCmd(bool rollback = false);
 
+    /**
+     * Starts a bulk edit. Until the matching endBulkEdit()
+     * call, the commands ended by endCmd() don't lay out the
+     * score and don't update playback: the changes of all of
+     * them are handled at once by endBulkEdit(). Useful for
+     * plugins making many small modifications, like
+     * transposing or re-instrumenting a whole score.
+     * Element positions are not updated during a bulk edit.
+     * \since 4.5
+     */
+    Q_INVOKABLE void startBulkEdit();
+    /**
+     * Ends a bulk edit started by startBulkEdit(), lays out
+     * the changed part of the score and updates playback.
+     * \since 4.5
+     */
+    Q_INVOKABLE void endBulkEdit();
+
+    /**
+     * Returns the data of the notes of the chords starting within
+     * the given range, without creating an object per note.
+     * The result has a \p count of notes and the packed arrays
+     * \p pitches, \p tpcs, \p ticks, \p durations (in ticks),
+     * \p tracks and \p velocities, one 32-bit integer per note,
+     * to be read with an Int32Array:
+     * \code
+     * var data = curScore.noteData(0, -1)
+     * var pitches = new Int32Array(data.pitches)
+     * \endcode
+     * Notes are listed in time order, then by track.
+     * \param startTick - start tick of the range.
+     * \param endTick - end tick of the range (exclusive), -1 for the end of the score.
+     * \param startStaff - first staff of the range.
+     * \param endStaff - end staff of the range (exclusive), -1 for the last staff.
+     * \since 4.5
+     */
+    Q_INVOKABLE QVariantMap noteData(int startTick = 0, int endTick = -1, int startStaff = 0, int endStaff = -1);
+    /**
+     * Sets a property of all the notes of the given range at once.
+     * Must be used between startCmd() and endCmd() calls.
+     * \param propertyName - name of the property, as in the score file, e.g. "pitch", "tpc1", "velocity" or "visible".
+     * \param values - either a single value for all the notes, or one value per note
+     * in the order of noteData() for the same range: an array, or an ArrayBuffer of 32-bit integers.
+     * \returns \p true if the values were applied.
+     * \since 4.5
+     */
+    Q_INVOKABLE bool setNoteProperty(const QString& propertyName, const QVariant& values, int startTick = 0, int endTick = -1,
+                                     int startStaff = 0, int endStaff = -1);
+
     /**
      * Create PlayEvents for all notes based on ornamentation.
      * You need to call this if you are manipulating PlayEvent's
@@ -25,6 +25,7 @@
 #include "engraving/dom/undo.h"
 
 // api
+#include "notedata.h"
 #include "score.h"
 
 using namespace mu::engraving::apiv1;
@@ -186,3 +187,21 @@ bool Selection::clear()
     _select->deselectAll();
     return true;
 }
+
+//---------------------------------------------------------
+//   Selection::noteData
+//---------------------------------------------------------
+
+QVariantMap Selection::noteData() const
+{
+    return packNoteData(_select->noteList());
+}
+
+//---------------------------------------------------------
+//   Selection::setNoteProperty
+//---------------------------------------------------------
+
+bool Selection::setNoteProperty(const QString& propertyName, const QVariant& values)
+{
+    return setNotesProperty(_select->noteList(), propertyName, values);
+}
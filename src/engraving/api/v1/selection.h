@@ -102,6 +102,20 @@ public:
     Q_INVOKABLE bool selectRange(int startTick, int endTick, int startStaff, int endStaff);
     Q_INVOKABLE bool deselect(apiv1::EngravingItem* e);
     Q_INVOKABLE bool clear();
+
+    /**
+     * Returns the data of the selected notes as packed arrays,
+     * see \ref Score.noteData. A range selection is listed staff
+     * by staff, a list selection in the order it was made.
+     * \since 4.5
+     */
+    Q_INVOKABLE QVariantMap noteData() const;
+    /**
+     * Sets a property of all the selected notes at once,
+     * see \ref Score.setNoteProperty.
+     * \since 4.5
+     */
+    Q_INVOKABLE bool setNoteProperty(const QString& propertyName, const QVariant& values);
 };
 
 extern Selection* selectionWrap(mu::engraving::Selection* select);
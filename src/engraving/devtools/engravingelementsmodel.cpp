@@ -26,6 +26,8 @@
 #include "engraving/dom/engravingobject.h"
 #include "engraving/dom/score.h"
 #include "engraving/dom/masterscore.h"
+#include "engraving/dom/memoryusage.h"
+#include "engraving/types/typesconv.h"
 #include "dataformatter.h"
 
 #include "log.h"
@@ -343,8 +345,12 @@ void EngravingElementsModel::updateInfo()
 {
     const EngravingObjectSet& elements = elementsProvider()->elements();
     QHash<QString, int> els;
+    std::vector<MasterScore*> masterScores;
     for (const mu::engraving::EngravingObject* el : elements) {
         els[el->typeName()] += 1;
+        if (el->isScore() && toScore(el)->isMaster()) {
+            masterScores.push_back(el->masterScore());
+        }
     }
 
     {
@@ -353,6 +359,10 @@ void EngravingElementsModel::updateInfo()
         for (auto it = els.constBegin(); it != els.constEnd(); ++it) {
             stream << it.key() << ": " << it.value() << "\n";
         }
+
+        for (MasterScore* score : masterScores) {
+            writeMemoryUsage(stream, score);
+        }
     }
 
     {
@@ -365,6 +375,28 @@ void EngravingElementsModel::updateInfo()
     emit summaryChanged();
 }
 
+void EngravingElementsModel::writeMemoryUsage(QTextStream& stream, MasterScore* score) const
+{
+    auto writeScoreUsage = [&stream](const QString& title, const ScoreMemoryUsage& usage) {
+        stream << "\n" << title << ": objects: " << usage.objectCount << ", bytes: " << usage.totalBytes()
+               << ", layout data: " << usage.layoutDataCount << ", shape elements: " << usage.shapeElementCount << "\n";
+        for (const auto& p : usage.types) {
+            stream << "  " << TConv::toXml(p.first).ascii() << ": " << p.second.count << ", bytes: " << p.second.bytes << "\n";
+        }
+    };
+
+    MemoryUsage usage = MemoryUsage::collect(score);
+
+    stream << "\nMemory usage of " << score->name().toQString() << ", total bytes: " << usage.totalBytes() << "\n";
+    stream << "undo: commands: " << usage.undoCommandCount << ", bytes: " << usage.undoBytes << "\n";
+    stream << "images: " << usage.imageCount << ", bytes: " << usage.imageBytes << "\n";
+
+    writeScoreUsage("score", usage.masterScore);
+    for (const auto& excerpt : usage.excerpts) {
+        writeScoreUsage("excerpt " + excerpt.first.toQString(), excerpt.second);
+    }
+}
+
 QString EngravingElementsModel::info() const
 {
     return m_info;
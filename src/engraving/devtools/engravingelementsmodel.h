@@ -24,12 +24,14 @@
 
 #include <QAbstractItemModel>
 #include <QHash>
+#include <QTextStream>
 
 #include "modularity/ioc.h"
 #include "iengravingelementsprovider.h"
 #include "actions/iactionsdispatcher.h"
 
 namespace mu::engraving {
+class MasterScore;
 class EngravingElementsModel : public QAbstractItemModel, public muse::Injectable
 {
     Q_OBJECT
@@ -103,6 +105,7 @@ private:
     const Item* findItem(const mu::engraving::EngravingObject* el, const Item* root) const;
 
     void updateInfo();
+    void writeMemoryUsage(QTextStream& stream, MasterScore* score) const;
 
     Item* m_rootItem = nullptr;
     QHash<quintptr, Item*> m_allItems;
@@ -23,6 +23,9 @@
 #include <cmath>
 
 #include "bsp.h"
+
+#include "containers.h"
+
 #include "engravingitem.h"
 
 using namespace mu;
@@ -38,7 +41,7 @@ class InsertItemBspTreeVisitor : public BspTreeVisitor
 public:
     EngravingItem* item;
 
-    inline void visit(std::list<EngravingItem*>* items) { items->push_front(item); }
+    inline void visit(BspTree::Leaf* items) { items->push_back(item); }
 };
 
 //---------------------------------------------------------
@@ -51,7 +54,7 @@ class RemoveItemBspTreeVisitor : public BspTreeVisitor
 public:
     EngravingItem* item;
 
-    inline void visit(std::list<EngravingItem*>* items) { items->remove(item); }
+    inline void visit(BspTree::Leaf* items) { muse::remove(*items, item); }
 };
 
 //---------------------------------------------------------
@@ -62,15 +65,16 @@ class FindItemBspTreeVisitor : public BspTreeVisitor
 {
     OBJECT_ALLOCATOR(engraving, FindItemBspTreeVisitor)
 public:
-    std::list<EngravingItem*> foundItems;
+    //! NOTE In discovery order, the results are reported in reverse
+    std::vector<EngravingItem*> foundItems;
 
-    void visit(std::list<EngravingItem*>* items)
+    void visit(BspTree::Leaf* items)
     {
-        for (auto it = items->begin(); it != items->end(); ++it) {
+        for (auto it = items->rbegin(); it != items->rend(); ++it) {
             EngravingItem* item = *it;
             if (!item->itemDiscovered) {
                 item->itemDiscovered = true;
-                foundItems.push_front(item);
+                foundItems.push_back(item);
             }
         }
     }
@@ -107,7 +111,9 @@ void BspTree::initialize(const RectF& rec, int n)
 
     m_nodes.resize((1 << (m_depth + 1)) - 1);
     m_leaves.resize(1LL << m_depth);
-    std::fill(m_leaves.begin(), m_leaves.end(), std::list<EngravingItem*>());
+    for (Leaf& leaf : m_leaves) {
+        leaf.clear();
+    }
     initialize(rec, m_depth, 0);
 }
 
@@ -153,7 +159,8 @@ std::vector<EngravingItem*> BspTree::items(const RectF& rec)
     FindItemBspTreeVisitor findVisitor;
     climbTree(&findVisitor, rec);
     std::vector<EngravingItem*> l;
-    for (EngravingItem* e : findVisitor.foundItems) {
+    for (auto it = findVisitor.foundItems.rbegin(); it != findVisitor.foundItems.rend(); ++it) {
+        EngravingItem* e = *it;
         e->itemDiscovered = false;
         if (e->pageBoundingRect().intersects(rec)) {
             l.push_back(e);
@@ -172,7 +179,8 @@ std::vector<EngravingItem*> BspTree::items(const PointF& pos)
     climbTree(&findVisitor, pos);
 
     std::vector<EngravingItem*> l;
-    for (EngravingItem* e : findVisitor.foundItems) {
+    for (auto it = findVisitor.foundItems.rbegin(); it != findVisitor.foundItems.rend(); ++it) {
+        EngravingItem* e = *it;
         e->itemDiscovered = false;
         if (e->contains(pos)) {
             l.push_back(e);
@@ -181,6 +189,34 @@ std::vector<EngravingItem*> BspTree::items(const PointF& pos)
     return l;
 }
 
+//---------------------------------------------------------
+//   forEachItem helpers
+//---------------------------------------------------------
+
+bool BspTree::markDiscovered(EngravingItem* item)
+{
+    if (item->itemDiscovered) {
+        return false;
+    }
+    item->itemDiscovered = true;
+    return true;
+}
+
+void BspTree::unmarkDiscovered(EngravingItem* item)
+{
+    item->itemDiscovered = false;
+}
+
+bool BspTree::isHit(const EngravingItem* item, const RectF& rect)
+{
+    return item->pageBoundingRect().intersects(rect);
+}
+
+bool BspTree::isHit(const EngravingItem* item, const PointF& pos)
+{
+    return item->contains(pos);
+}
+
 //---------------------------------------------------------
 //   nearestNeighbor (public)
 //---------------------------------------------------------
@@ -207,7 +243,9 @@ void BspTree::nearestNeighbor(const PointF& pos, EngravingItem** bestItem, doubl
 
     // Base case: go through the items in the leaf node (if any), and update bestItem/bestDistance accordingly
     if (node->type == Node::Type::LEAF) {
-        for (auto item : m_leaves[node->leafIndex]) {
+        const Leaf& leaf = m_leaves[node->leafIndex];
+        for (auto it = leaf.rbegin(); it != leaf.rend(); ++it) {
+            EngravingItem* item = *it;
             PointF itemPos = item->pageBoundingRect().center();
             double currDistance = std::sqrt(std::pow(pos.x() - itemPos.x(), 2) + std::pow(pos.y() - itemPos.y(), 2));
             if (currDistance < bestDistance) {
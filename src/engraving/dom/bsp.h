@@ -23,7 +23,8 @@
 #ifndef MU_ENGRAVING_BSP_H
 #define MU_ENGRAVING_BSP_H
 
-#include <list>
+#include <limits>
+#include <vector>
 
 #include "global/allocator.h"
 #include "types/string.h"
@@ -55,22 +56,70 @@ public:
         };
         Type type;
     };
+
+    //! NOTE Items are stored in insertion order, queries walk them backwards
+    using Leaf = std::vector<EngravingItem*>;
+
 private:
 
     void initialize(const RectF& rect, int depth, int index);
     void climbTree(BspTreeVisitor* visitor, const PointF& pos, int index = 0);
     void climbTree(BspTreeVisitor* visitor, const RectF& rect, int index = 0);
 
-    void findItems(std::list<EngravingItem*>* foundItems, const RectF& rect, int index);
-    void findItems(std::list<EngravingItem*>* foundItems, const PointF& pos, int index);
-
     void nearestNeighbor(const PointF& pos, EngravingItem** bestItem, double& bestDistance, int nodeIndex = 0);
 
     RectF rectForIndex(int index) const;
 
+    template<typename Area, typename Func>
+    void climbLeaves(const Area& area, Func& func, int index = 0)
+    {
+        if (m_nodes.empty()) {
+            return;
+        }
+
+        const Node& node = m_nodes[index];
+        int childIndex = firstChildIndex(index);
+
+        switch (node.type) {
+        case Node::Type::LEAF:
+            func(m_leaves[node.leafIndex]);
+            break;
+        case Node::Type::VERTICAL:
+            if (areaBegin(area, false) < node.offset) {
+                climbLeaves(area, func, childIndex);
+                if (areaEnd(area, false) >= node.offset) {
+                    climbLeaves(area, func, childIndex + 1);
+                }
+            } else {
+                climbLeaves(area, func, childIndex + 1);
+            }
+            break;
+        case Node::Type::HORIZONTAL:
+            if (areaBegin(area, true) < node.offset) {
+                climbLeaves(area, func, childIndex);
+                if (areaEnd(area, true) >= node.offset) {
+                    climbLeaves(area, func, childIndex + 1);
+                }
+            } else {
+                climbLeaves(area, func, childIndex + 1);
+            }
+            break;
+        }
+    }
+
+    static double areaBegin(const RectF& r, bool vertical) { return vertical ? r.top() : r.left(); }
+    static double areaEnd(const RectF& r, bool vertical) { return vertical ? r.bottom() : r.right(); }
+    static double areaBegin(const PointF& p, bool vertical) { return vertical ? p.y() : p.x(); }
+    static double areaEnd(const PointF&, bool) { return -std::numeric_limits<double>::max(); }
+
+    static bool markDiscovered(EngravingItem* item);
+    static void unmarkDiscovered(EngravingItem* item);
+    static bool isHit(const EngravingItem* item, const RectF& rect);
+    static bool isHit(const EngravingItem* item, const PointF& pos);
+
     unsigned int m_depth = 0;
     std::vector<Node> m_nodes;
-    std::vector<std::list<EngravingItem*> > m_leaves;
+    std::vector<Leaf> m_leaves;
     int m_leafCnt = 0;
     RectF m_rect;
 
@@ -86,6 +135,28 @@ public:
     std::vector<EngravingItem*> items(const RectF& rect);
     std::vector<EngravingItem*> items(const PointF& pos);
 
+    //! NOTE Calls func once for every item hit by the rect (or pos) without allocating;
+    //! the order is unspecified and func must not modify the tree
+    template<typename Area, typename Func>
+    void forEachItem(const Area& area, Func func)
+    {
+        auto visit = [&area, &func](Leaf& leaf) {
+            for (auto it = leaf.rbegin(); it != leaf.rend(); ++it) {
+                if (markDiscovered(*it) && isHit(*it, area)) {
+                    func(*it);
+                }
+            }
+        };
+        climbLeaves(area, visit);
+
+        auto reset = [](Leaf& leaf) {
+            for (EngravingItem* item : leaf) {
+                unmarkDiscovered(item);
+            }
+        };
+        climbLeaves(area, reset);
+    }
+
     EngravingItem* nearestNeighbor(const PointF& pos);
 
     int leafCount() const { return m_leafCnt; }
@@ -110,7 +181,7 @@ class BspTreeVisitor
     OBJECT_ALLOCATOR(engraving, BspTreeVisitor)
 public:
     virtual ~BspTreeVisitor() {}
-    virtual void visit(std::list<EngravingItem*>* items) = 0;
+    virtual void visit(BspTree::Leaf* items) = 0;
 };
 } // namespace mu::engraving
 #endif
@@ -355,7 +355,6 @@ private:
     Stem* m_stem = nullptr;
     Hook* m_hook = nullptr;
     StemSlash* m_stemSlash = nullptr;     // for grace notes
-    bool m_showStemSlash = false;
 
     Arpeggio* m_arpeggio = nullptr;       // arpeggio which starts on the chord
     Arpeggio* m_spanArpeggio = nullptr;   // arpeggio which spans over this chord
@@ -369,11 +368,17 @@ private:
     mutable GraceNotesGroup m_graceNotesAfter = GraceNotesGroup(this); // will store after-chord grace notes
     size_t m_graceIndex = 0;             // if this is a grace note, index in parent list
 
-    bool m_isTrillCueNote = false;
-
     DirectionV m_stemDirection = DirectionV::AUTO;
     NoteType m_noteType = NoteType::NORMAL; // mark grace notes: acciaccatura and appoggiatura
+
+    // flags grouped to avoid padding
+    bool m_isTrillCueNote = false;
     bool m_noStem = false;
+    bool m_showStemSlash = false;
+    bool m_isUiItem = false;
+    bool m_allowKerningAbove = true;
+    bool m_allowKerningBelow = true;
+    AutoOnOff m_combineVoice = AutoOnOff::AUTO;
     PlayEventType m_playEventType = PlayEventType::Auto; // play events were modified by user
 
     double m_spaceLw = 0.0;
@@ -382,8 +387,6 @@ private:
     double m_defaultStemLength = 0.0;
     double m_minStemLength = 0.0;
 
-    bool m_isUiItem = false;
-
     double m_dotPosX = 0.0;
 
     StartEndSlurs m_startEndSlurs;
@@ -391,11 +394,6 @@ private:
     std::set<Spanner*> m_startingSpanners; // spanners starting on this item
     std::set<Spanner*> m_endingSpanners;   // spanners ending on this item
 
-    bool m_allowKerningAbove = true;
-    bool m_allowKerningBelow = true;
-
-    AutoOnOff m_combineVoice = AutoOnOff::AUTO;
-
     std::vector<Articulation*> m_articulations;
 };
 } // namespace mu::engraving
@@ -22,6 +22,9 @@
 
 #include "chordlist.h"
 
+#include <mutex>
+#include <tuple>
+
 #include "global/io/file.h"
 #include "global/io/fileinfo.h"
 
@@ -1664,6 +1667,7 @@ void ChordList::configureAutoAdjust(double emag, double eadjust, double mmag, do
 
 void ChordList::read(XmlReader& e, int mscVersion)
 {
+    m_parsedChords.clear();
     int fontIdx = static_cast<int>(fonts.size());
     m_autoAdjust = false;
     while (e.readNextStartElement()) {
@@ -1925,9 +1929,30 @@ void ChordList::unload()
     renderListRoot.clear();
     renderListBase.clear();
     chordTokenList.clear();
+    m_parsedChords.clear();
     m_autoAdjust = false;
 }
 
+//---------------------------------------------------------
+//   parsedChord
+//    lead sheets use the same few chords over and over,
+//    so each distinct text is only parsed once
+//---------------------------------------------------------
+
+const ParsedChord& ChordList::parsedChord(const String& s, bool syntaxOnly, bool preferMinor) const
+{
+    String key = String(syntaxOnly ? u"1" : u"0") + String(preferMinor ? u"1" : u"0") + s;
+
+    auto it = m_parsedChords.find(key);
+    if (it == m_parsedChords.end()) {
+        ParsedChord pc;
+        pc.parse(s, this, syntaxOnly, preferMinor);
+        it = m_parsedChords.emplace(std::move(key), std::move(pc)).first;
+    }
+
+    return it->second;
+}
+
 const ChordDescription* ChordList::description(int id) const
 {
     auto it = this->find(id);
@@ -1937,21 +1962,57 @@ const ChordDescription* ChordList::description(int id) const
     return &it->second;
 }
 
+//---------------------------------------------------------
+//   checkChordList
+//    chord lists from the app's styles folder are parsed
+//    once per process, further scores get a copy
+//---------------------------------------------------------
+
 void ChordList::checkChordList(const path_t& appDataPath, const MStyle& style)
 {
     // make sure we have a chordlist
-    if (!loaded()) {
-        double emag = style.value(Sid::chordExtensionMag).toReal();
-        double eadjust = style.value(Sid::chordExtensionAdjust).toReal();
-        double mmag = style.value(Sid::chordModifierMag).toReal();
-        double madjust = style.value(Sid::chordModifierAdjust).toReal();
-        configureAutoAdjust(emag, eadjust, mmag, madjust);
+    if (loaded()) {
+        return;
+    }
+
+    double emag = style.value(Sid::chordExtensionMag).toReal();
+    double eadjust = style.value(Sid::chordExtensionAdjust).toReal();
+    double mmag = style.value(Sid::chordModifierMag).toReal();
+    double madjust = style.value(Sid::chordModifierAdjust).toReal();
+    const bool readChordsXml = style.value(Sid::chordsXmlFile).toBool();
+    const String descriptionFile = style.value(Sid::chordDescriptionFile).value<String>();
+
+    // user files given by absolute path may change while running, don't cache them
+    const bool useCache = empty() && fonts.empty() && !FileInfo(descriptionFile).isAbsolute();
+
+    using CacheKey = std::tuple<std::string, String, bool, double, double, double, double>;
+    static std::map<CacheKey, ChordList> s_cache;
+    static std::mutex s_cacheMutex;
 
-        if (style.value(Sid::chordsXmlFile).toBool()) {
-            read(appDataPath, u"chords.xml");
+    const CacheKey key { appDataPath.toStdString(), descriptionFile, readChordsXml, emag, eadjust, mmag, madjust };
+
+    if (useCache) {
+        std::lock_guard<std::mutex> lock(s_cacheMutex);
+        auto it = s_cache.find(key);
+        if (it != s_cache.end()) {
+            const bool customChordList = m_customChordList;
+            *this = it->second;
+            m_customChordList = customChordList;
+            return;
         }
+    }
+
+    configureAutoAdjust(emag, eadjust, mmag, madjust);
+
+    if (readChordsXml) {
+        read(appDataPath, u"chords.xml");
+    }
+
+    read(appDataPath, descriptionFile);
 
-        read(appDataPath, style.value(Sid::chordDescriptionFile).value<String>());
+    if (useCache && loaded()) {
+        std::lock_guard<std::mutex> lock(s_cacheMutex);
+        s_cache.emplace(key, *this);
     }
 }
 
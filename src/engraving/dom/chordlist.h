@@ -24,6 +24,7 @@
 #define MU_ENGRAVING_CHORDLIST_H
 
 #include <map>
+#include <unordered_map>
 
 #include "global/allocator.h"
 #include "global/types/string.h"
@@ -298,6 +299,9 @@ public:
     const ChordDescription* description(int id) const;
     ChordSymbol symbol(const String& s) const { return muse::value(m_symbols, s); }
 
+    // parsed form of a chord symbol text, shared by all the harmonies that use it
+    const ParsedChord& parsedChord(const String& s, bool syntaxOnly = false, bool preferMinor = false) const;
+
     void setCustomChordList(bool t) { m_customChordList = t; }
     bool customChordList() const { return m_customChordList; }
 
@@ -309,6 +313,7 @@ private:
     void write(XmlWriter& xml) const;
 
     std::map<String, ChordSymbol> m_symbols;
+    mutable std::unordered_map<String, ParsedChord> m_parsedChords;
     bool m_autoAdjust = false;
     double m_nmag = 1.0, m_nadjust = 0.0;
     double m_emag = 1.0, m_eadjust = 0.0;
@@ -131,6 +131,18 @@ static std::pair<int, int> changedTicksRange(const CmdState& cmdState, const std
     return { startTick, endTick };
 }
 
+static ScoreChangesRange makeChangesRange(const CmdState& cmdState, UndoMacro::ChangesInfo&& changes)
+{
+    auto ticksRange = changedTicksRange(cmdState, changes.changedItems);
+
+    return { ticksRange.first, ticksRange.second,
+             cmdState.startStaff(), cmdState.endStaff(),
+             std::move(changes.changedItems),
+             std::move(changes.changedObjectTypes),
+             std::move(changes.changedPropertyIdSet),
+             std::move(changes.changedStyleIdSet) };
+}
+
 //---------------------------------------------------------
 //    For use with Score::scanElements.
 //    Reset positions and autoplacement for the given
@@ -283,6 +295,33 @@ void CmdState::unsetElement(const EngravingItem* e)
     }
 }
 
+//---------------------------------------------------------
+//   merge
+//    extends the state with the ranges and flags of other
+//---------------------------------------------------------
+
+void CmdState::merge(const CmdState& other)
+{
+    if (m_locked) {
+        return;
+    }
+
+    if (other.m_startTick != Fraction(-1, 1)) {
+        setTick(other.m_startTick);
+        setTick(other.m_endTick);
+    }
+    setStaff(other.m_startStaff);
+    setStaff(other.m_endStaff);
+    setUpdateMode(other.m_updateMode);
+    layoutFlags |= other.layoutFlags;
+
+    // the elements of the merged commands may be deleted by now
+    m_el = nullptr;
+    m_oneElement = false;
+    m_mb = nullptr;
+    m_oneMeasureBase = false;
+}
+
 //---------------------------------------------------------
 //   element
 //---------------------------------------------------------
@@ -332,6 +371,9 @@ void Score::startCmd(const TranslatableString& actionName)
 
     MScore::setError(MsError::MS_NO_ERROR);
 
+    // The excerpts read lazily must be read before anything changes in the master score
+    masterScore()->materializeExcerpts();
+
     cmdState().reset();
 
     // Start collecting low-level undo operations for a
@@ -356,35 +398,22 @@ void Score::undoRedo(bool undo, EditData* ed)
     //! NOTE: the order of operations is very important here
     //! 1. for the undo operation, the list of changed elements is available before undo()
     //! 2. for the redo operation, the list of changed elements will be available after redo()
-    UndoMacro::ChangesInfo changes = changesInfo(undoStack());
+    //! The changes are collected once, from the macro that is actually undone/redone
+    UndoMacro::ChangesInfo changes;
 
     cmdState().reset();
     if (undo) {
+        changes = changesInfo(undoStack());
         undoStack()->undo(ed);
     } else {
         undoStack()->redo(ed);
+        changes = changesInfo(undoStack());
     }
     update(false);
     masterScore()->setPlaylistDirty();    // TODO: flag all individual operations
     updateSelection();
 
-    ScoreChangesRange range = changesRange();
-
-    if (range.changedItems.empty()) {
-        range.changedItems = std::move(changes.changedItems);
-    }
-
-    if (range.changedTypes.empty()) {
-        range.changedTypes = std::move(changes.changedObjectTypes);
-    }
-
-    if (range.changedPropertyIdSet.empty()) {
-        range.changedPropertyIdSet = std::move(changes.changedPropertyIdSet);
-    }
-
-    if (range.changedStyleIdSet.empty()) {
-        range.changedStyleIdSet = std::move(changes.changedStyleIdSet);
-    }
+    ScoreChangesRange range = makeChangesRange(cmdState(), std::move(changes));
 
     changesChannel().send(range);
 }
@@ -415,7 +444,12 @@ void Score::endCmd(bool rollback, bool layoutAllParts)
         undoStack()->activeCommand()->unwind();
     }
 
-    update(false, layoutAllParts);
+    MasterScore* ms = masterScore();
+    const bool isBulkEdit = ms->isBulkEditActive();
+
+    if (!isBulkEdit) {
+        update(false, layoutAllParts);
+    }
 
     ScoreChangesRange range = changesRange();
 
@@ -425,7 +459,15 @@ void Score::endCmd(bool rollback, bool layoutAllParts)
     undoStack()->endMacro(isCurrentCommandEmpty);
 
     if (dirty()) {
-        masterScore()->setPlaylistDirty(); // TODO: flag individual operations
+        ms->setPlaylistDirty(); // TODO: flag individual operations
+    }
+
+    if (isBulkEdit) {
+        if (!isCurrentCommandEmpty && !rollback) {
+            ms->addBulkEditChanges(cmdState(), range);
+        }
+        cmdState().reset();
+        return;
     }
 
     cmdState().reset();
@@ -437,16 +479,7 @@ void Score::endCmd(bool rollback, bool layoutAllParts)
 
 ScoreChangesRange Score::changesRange() const
 {
-    const CmdState& cmdState = score()->cmdState();
-    UndoMacro::ChangesInfo changes = changesInfo(undoStack());
-    auto ticksRange = changedTicksRange(cmdState, changes.changedItems);
-
-    return { ticksRange.first, ticksRange.second,
-             cmdState.startStaff(), cmdState.endStaff(),
-             std::move(changes.changedItems),
-             std::move(changes.changedObjectTypes),
-             std::move(changes.changedPropertyIdSet),
-             std::move(changes.changedStyleIdSet) };
+    return makeChangesRange(score()->cmdState(), changesInfo(undoStack()));
 }
 
 #ifndef NDEBUG
@@ -487,6 +520,10 @@ void Score::update(bool resetCmdState, bool layoutAllParts)
                 if (s != this && !s->isOpen() && ms->scoreList().size() > 1 && !layoutAllParts) {
                     continue;
                 }
+                if (s != this && s->isLayoutDeferred() && !layoutAllParts) {
+                    s->addPendingLayoutRange(cs.startTick(), cs.endTick());
+                    continue;
+                }
                 s->doLayoutRange(cs.startTick(), cs.endTick());
             }
             updateAll = true;
@@ -2806,14 +2843,6 @@ void Score::cmdResetNoteAndRestGroupings()
     }
 }
 
-static void resetBeamOffSet(void*, EngravingItem* e)
-{
-    // Reset completely cross staff beams from MU1&2
-    if (e->isBeam() && toBeam(e)->fullCross()) {
-        e->reset();
-    }
-}
-
 //---------------------------------------------------------
 //   cmdResetAllPositions
 //---------------------------------------------------------
@@ -2841,7 +2870,16 @@ void Score::resetCrossBeams()
 {
     TRACEFUNC;
 
-    scanElements(nullptr, resetBeamOffSet);
+    ElementTypeMask types;
+    types.set(static_cast<size_t>(ElementType::BEAM));
+
+    // Reset completely cross staff beams from MU1&2
+    visitItems(types, [](EngravingItem* e) {
+        if (toBeam(e)->fullCross()) {
+            e->reset();
+        }
+        return true;
+    });
 }
 
 //---------------------------------------------------------
@@ -74,6 +74,8 @@ public:
     staff_idx_t endStaff() const { return m_endStaff; }
     const EngravingItem* element() const;
 
+    void merge(const CmdState& other);
+
     void lock() { m_locked = true; }
     void unlock() { m_locked = false; }
 #ifndef NDEBUG
@@ -196,6 +196,8 @@ set(DOM_SRC
     ${CMAKE_CURRENT_LIST_DIR}/measurenumberbase.h
     ${CMAKE_CURRENT_LIST_DIR}/measurerepeat.cpp
     ${CMAKE_CURRENT_LIST_DIR}/measurerepeat.h
+    ${CMAKE_CURRENT_LIST_DIR}/memoryusage.cpp
+    ${CMAKE_CURRENT_LIST_DIR}/memoryusage.h
     ${CMAKE_CURRENT_LIST_DIR}/midimapping.cpp
     ${CMAKE_CURRENT_LIST_DIR}/mmrest.cpp
     ${CMAKE_CURRENT_LIST_DIR}/mmrest.h
@@ -278,6 +280,8 @@ set(DOM_SRC
     ${CMAKE_CURRENT_LIST_DIR}/spacer.h
     ${CMAKE_CURRENT_LIST_DIR}/spanner.cpp
     ${CMAKE_CURRENT_LIST_DIR}/spanner.h
+    ${CMAKE_CURRENT_LIST_DIR}/spannerintervaltree.cpp
+    ${CMAKE_CURRENT_LIST_DIR}/spannerintervaltree.h
     ${CMAKE_CURRENT_LIST_DIR}/spannermap.cpp
     ${CMAKE_CURRENT_LIST_DIR}/spannermap.h
     ${CMAKE_CURRENT_LIST_DIR}/splitMeasure.cpp
@@ -3564,7 +3564,7 @@ void Score::cmdDeleteSelection()
             // these are the linked elements we are about to delete
             std::list<EngravingObject*> links;
             if (e->links()) {
-                links = *e->links();
+                links.assign(e->links()->begin(), e->links()->end());
             }
 
             // find location of element to select after deleting notes
@@ -3634,7 +3634,7 @@ void Score::cmdDeleteSelection()
                     } else {
                         std::list<EngravingObject*> linkedSpanners;
                         if (spanner->links()) {
-                            linkedSpanners = *spanner->links();
+                            linkedSpanners.assign(spanner->links()->begin(), spanner->links()->end());
                         } else {
                             linkedSpanners.push_back(spanner);
                         }
@@ -4942,24 +4942,26 @@ void Score::cloneVoice(track_idx_t strack, track_idx_t dtrack, Segment* sf, cons
                 ns->setStartElement(0);
                 ns->setEndElement(0);
                 if (cr1 && cr1->links()) {
-                    for (EngravingObject* e : *cr1->links()) {
-                        ChordRest* cr = toChordRest(e);
+                    auto linkedInScore = cr1->links()->objectsInScore(this);
+                    for (auto it = linkedInScore.first; it != linkedInScore.second; ++it) {
+                        ChordRest* cr = toChordRest(*it);
                         if (cr == cr1) {
                             continue;
                         }
-                        if ((cr->score() == this) && (cr->tick() == ns->tick()) && cr->track() == dtrack) {
+                        if ((cr->tick() == ns->tick()) && cr->track() == dtrack) {
                             ns->setStartElement(cr);
                             break;
                         }
                     }
                 }
                 if (cr2 && cr2->links()) {
-                    for (EngravingObject* e : *cr2->links()) {
-                        ChordRest* cr = toChordRest(e);
+                    auto linkedInScore = cr2->links()->objectsInScore(this);
+                    for (auto it = linkedInScore.first; it != linkedInScore.second; ++it) {
+                        ChordRest* cr = toChordRest(*it);
                         if (cr == cr2) {
                             continue;
                         }
-                        if ((cr->score() == this) && (cr->tick() == ns->tick2()) && cr->track() == dtrack) {
+                        if ((cr->tick() == ns->tick2()) && cr->track() == dtrack) {
                             ns->setEndElement(cr);
                             break;
                         }
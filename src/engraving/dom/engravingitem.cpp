@@ -2457,9 +2457,10 @@ EngravingItem* EngravingItem::findLinkedInScore(const Score* score) const
 
     // If this is a system element it may not be on the same stave, so just check if linked elements are in the score
     if (systemFlag() && track() == 0) {
-        for (EngravingObject* linked : *links()) {
-            if (linked != this && linked->score() == score) {
-                return toEngravingItem(linked);
+        auto linkedInScore = links()->objectsInScore(score);
+        for (auto it = linkedInScore.first; it != linkedInScore.second; ++it) {
+            if (*it != this) {
+                return toEngravingItem(*it);
             }
         }
         return nullptr;
@@ -2476,13 +2477,14 @@ EngravingItem* EngravingItem::findLinkedInScore(const Score* score) const
 
 EngravingItem* EngravingItem::findLinkedInStaff(const Staff* staff) const
 {
-    if (!links() || links()->empty()) {
+    if (!staff || !links() || links()->empty()) {
         return nullptr;
     }
 
-    for (EngravingObject* linked : *links()) {
-        if (toEngravingItem(linked)->staff() == staff) {
-            return toEngravingItem(linked);
+    auto linkedInScore = links()->objectsInScore(staff->score());
+    for (auto it = linkedInScore.first; it != linkedInScore.second; ++it) {
+        if (toEngravingItem(*it)->staff() == staff) {
+            return toEngravingItem(*it);
         }
     }
     return nullptr;
@@ -2641,6 +2643,14 @@ void EngravingItem::LayoutData::setBbox(const RectF& r)
     DO_ASSERT(!std::isnan(r.height()) && !std::isinf(r.height()));
 
     //DO_ASSERT(!isShapeComposite());
+
+    //! NOTE Reuse the storage of the previous fixed shape, if any,
+    //! instead of allocating a new one on every layout
+    if (m_shape.has_value() && !m_shape.value().isComposite() && m_shape.value().size() == 1) {
+        m_shape.mut_value().setBBox(r, m_item);
+        return;
+    }
+
     m_shape.set_value(Shape(r, m_item, Shape::Type::Fixed));
 }
 
@@ -547,9 +547,11 @@ public:
 
         bool isSetShape() const { return m_shape.has_value(); }
         void clearShape() { m_shape.reset(); }
+        size_t shapeElementCount() const { return m_shape.has_value() ? m_shape.value(LD_ACCESS::MAYBE_NOTINITED).size() : 0; }
         Shape shape(LD_ACCESS mode = LD_ACCESS::CHECK) const;
 
         void setShape(const Shape& sh) { m_shape.set_value(sh); }
+        void setShape(Shape&& sh) { m_shape.set_value(std::move(sh)); }
 
         void setBbox(const RectF& r);
 
@@ -642,6 +644,7 @@ public:
 
     const LayoutData* ldata() const;
     LayoutData* mutldata();
+    bool hasLayoutData() const { return m_layoutData != nullptr; }
 
     virtual double mag() const;
     Shape shape(LD_ACCESS mode = LD_ACCESS::CHECK) const { return ldata()->shape(mode); }
@@ -720,16 +723,17 @@ private:
     AccessibleItemPtr m_accessible;
 #endif
 
-    bool m_accessibleEnabled = false;
-
     PointF m_offset;                    // offset from reference position, set by autoplace or user
 
     Spatium m_minDistance;              // autoplace min distance
+
+    mutable LayoutData* m_layoutData = nullptr;
+
+    //! NOTE The small fields are kept together, so that there is no padding between them
     mutable ElementFlags m_flags;
 
+    bool m_accessibleEnabled = false;
     bool m_colorsInversionEnabled = true;
-
-    mutable LayoutData* m_layoutData = nullptr;
 };
 
 using ElementPtr = std::shared_ptr<EngravingItem>;
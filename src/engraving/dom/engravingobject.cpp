@@ -25,6 +25,7 @@
 #include <iterator>
 #include <unordered_set>
 
+#include "infrastructure/eidregister.h"
 #include "style/textstyle.h"
 #include "types/translatablestring.h"
 #include "types/typesconv.h"
@@ -75,6 +76,7 @@ EngravingObject::EngravingObject(const ElementType& type, EngravingObject* paren
             MasterScore* ms = s->masterScore();
             if (ms) {
                 m_eid = ms->getEID()->newEID(m_type);
+                regEID();
             }
         }
     }
@@ -110,6 +112,7 @@ EngravingObject::EngravingObject(const EngravingObject& se)
             MasterScore* ms = s->masterScore();
             if (ms) {
                 m_eid = ms->getEID()->newEID(m_type);
+                regEID();
             }
         }
     }
@@ -157,6 +160,8 @@ EngravingObject::~EngravingObject()
         score()->elementsProvider()->unreg(this);
     }
 
+    unregEID();
+
     if (m_links) {
         m_links->remove(this);
         if (m_links->empty()) {
@@ -167,6 +172,27 @@ EngravingObject::~EngravingObject()
     delete[] m_propertyFlagsList;
 }
 
+void EngravingObject::setEID(EID id)
+{
+    unregEID();
+    m_eid = id;
+    regEID();
+}
+
+void EngravingObject::regEID()
+{
+    if (m_eid.isValid() && m_score && m_score->eidRegister()) {
+        m_score->eidRegister()->reg(this);
+    }
+}
+
+void EngravingObject::unregEID()
+{
+    if (m_eid.isValid() && m_score && m_score->eidRegister()) {
+        m_score->eidRegister()->unreg(this);
+    }
+}
+
 void EngravingObject::doSetParent(EngravingObject* p)
 {
     if (m_parent == p) {
@@ -194,7 +220,13 @@ void EngravingObject::doSetScore(Score* sc)
         return;
     }
 
+    unregEID();
     m_score = sc;
+    regEID();
+
+    if (m_links) {
+        m_links->invalidateScoreTable();
+    }
 
     for (EngravingObject* ch : m_children) {
         ch->doSetScore(sc);
@@ -633,7 +665,7 @@ std::list<EngravingObject*> EngravingObject::linkList() const
 {
     std::list<EngravingObject*> el;
     if (m_links) {
-        el = *m_links;
+        el.assign(m_links->begin(), m_links->end());
     } else {
         el.push_back(const_cast<EngravingObject*>(this));
     }
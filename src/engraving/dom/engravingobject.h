@@ -211,10 +211,13 @@ public:
     inline bool isType(ElementType t) const { return t == m_type; }
     const char* typeName() const;
     virtual TranslatableString typeUserName() const;
+
+    //! NOTE Shallow size of the object, overridden by DECLARE_CLASSOF; used for memory usage reports
+    virtual size_t objectSize() const { return sizeof(EngravingObject); }
     virtual String translatedTypeUserName() const;
 
     inline EID eid() const { return m_eid; }
-    inline void setEID(EID id) { m_eid = id; }
+    void setEID(EID id);
 
     EngravingObject* parent() const;
     void setParent(EngravingObject* p);
@@ -230,6 +233,27 @@ public:
     virtual EngravingObjectList scanChildren() const { return {}; }
     virtual void scanElements(void* data, void (* func)(void*, EngravingItem*), bool all=true);
 
+    //! NOTE Same traversal as scanElements, but takes any callable,
+    //! which is called directly instead of through a void* context
+    template<typename F>
+    void scanItems(F func, bool all = true)
+    {
+        scanElements(&func, [](void* data, EngravingItem* item) { (*static_cast<F*>(data))(item); }, all);
+    }
+
+    //! NOTE Visits the items of the given types until func returns false.
+    //! The scan itself goes on to the end, the rest of the items are just skipped
+    template<typename F>
+    void visitItems(const ElementTypeMask& types, F func, bool all = true)
+    {
+        bool stopped = false;
+        scanItems([&](auto* item) {
+            if (!stopped && types.test(static_cast<size_t>(item->type()))) {
+                stopped = !func(item);
+            }
+        }, all);
+    }
+
     // context
     virtual void setScore(Score* s);
     Score* score() const;
@@ -297,6 +321,9 @@ private:
     void doSetParent(EngravingObject* p);
     void doSetScore(Score* sc);
 
+    void regEID();
+    void unregEID();
+
     ElementType m_type = ElementType::INVALID;
     mutable EID m_eid;
     EngravingObject* m_parent = nullptr;
@@ -507,12 +507,8 @@ void MasterScore::deleteExcerpt(Excerpt* excerpt)
     for (Staff* st : partScore->staves()) {
         bool hasLinksInMaster = false;
         if (st->links()) {
-            for (auto le : *st->links()) {
-                if (le->score() == this) {
-                    hasLinksInMaster = true;
-                    break;
-                }
-            }
+            auto linksInMaster = st->links()->objectsInScore(this);
+            hasLinksInMaster = linksInMaster.first != linksInMaster.second;
         }
         if (hasLinksInMaster) {
             staff_idx_t staffIdx = st->idx();
@@ -632,12 +628,23 @@ void MasterScore::initEmptyExcerpt(Excerpt* excerpt)
 
 static bool scoreContainsSpanner(const Score* score, Spanner* spanner)
 {
-    const std::multimap<int, Spanner*>& spanners = score->spanner();
+    if (!spanner->links()) {
+        return false;
+    }
 
-    for (auto it = spanners.cbegin(); it != spanners.cend(); ++it) {
-        const Spanner* curSpanner = it->second;
-        if (curSpanner->links() && curSpanner->links()->contains(spanner)) {
-            return true;
+    // a spanner of the score linked to this one shares its links
+    const std::multimap<int, Spanner*>& spanners = score->spanner();
+    auto linkedInScore = spanner->links()->objectsInScore(score);
+    for (auto it = linkedInScore.first; it != linkedInScore.second; ++it) {
+        const EngravingObject* linked = *it;
+        if (!linked->isSpanner()) {
+            continue;
+        }
+        auto range = spanners.equal_range(toSpanner(linked)->tick().ticks());
+        for (auto sit = range.first; sit != range.second; ++sit) {
+            if (sit->second == linked) {
+                return true;
+            }
         }
     }
 
@@ -665,24 +672,26 @@ void Excerpt::cloneSpanner(Spanner* s, Score* score, track_idx_t dstTrack, track
         ns->setStartElement(0);
         ns->setEndElement(0);
         if (cr1 && cr1->links()) {
-            for (EngravingObject* e : *cr1->links()) {
-                ChordRest* cr = toChordRest(e);
+            auto linkedInScore = cr1->links()->objectsInScore(score);
+            for (auto it = linkedInScore.first; it != linkedInScore.second; ++it) {
+                ChordRest* cr = toChordRest(*it);
                 if (cr == cr1) {
                     continue;
                 }
-                if ((cr->score() == score) && (cr->tick() == ns->tick()) && cr->track() == dstTrack) {
+                if ((cr->tick() == ns->tick()) && cr->track() == dstTrack) {
                     ns->setStartElement(cr);
                     break;
                 }
             }
         }
         if (cr2 && cr2->links()) {
-            for (EngravingObject* e : *cr2->links()) {
-                ChordRest* cr = toChordRest(e);
+            auto linkedInScore = cr2->links()->objectsInScore(score);
+            for (auto it = linkedInScore.first; it != linkedInScore.second; ++it) {
+                ChordRest* cr = toChordRest(*it);
                 if (cr == cr2) {
                     continue;
                 }
-                if ((cr->score() == score) && (cr->tick() == ns->tick2()) && cr->track() == dstTrack2) {
+                if ((cr->tick() == ns->tick2()) && cr->track() == dstTrack2) {
                     ns->setEndElement(cr);
                     break;
                 }
@@ -879,6 +888,15 @@ static MeasureBase* cloneMeasure(MeasureBase* mb, Score* score, const Score* osc
 
             track_idx_t strack = muse::value(trackList, srcTrack, muse::nidx);
 
+            //! NOTE Unmapped tracks contribute nothing but system annotations on track 0,
+            //! so skip them instead of walking the segments once for every track of the score
+            if (strack == muse::nidx && srcTrack != 0) {
+                continue;
+            }
+
+            //There are probably more destination tracks for the same source
+            const std::vector<track_idx_t> dstTracks = muse::values(trackList, srcTrack);
+
             TremoloTwoChord* prevTremolo = nullptr;
             for (Segment* oseg = m->first(); oseg; oseg = oseg->next()) {
                 Segment* ns = nullptr;           //create segment later, on demand
@@ -910,14 +928,11 @@ static MeasureBase* cloneMeasure(MeasureBase* mb, Score* score, const Score* osc
                 }
 
                 //If track is not mapped skip the following
-                if (muse::value(trackList, srcTrack, muse::nidx) == muse::nidx) {
+                if (strack == muse::nidx) {
                     continue;
                 }
 
-                //There are probably more destination tracks for the same source
-                std::vector<track_idx_t> t = muse::values(trackList, srcTrack);
-
-                for (track_idx_t track : t) {
+                for (track_idx_t track : dstTracks) {
                     //Clone KeySig TimeSig and Clefs if voice 1 of source staff is not mapped to a track
                     EngravingItem* oef = oseg->element(trackZeroVoice(srcTrack));
                     if (oef && !oef->generated() && (oef->isTimeSig() || oef->isKeySig())
@@ -637,8 +637,7 @@ const ChordDescription* Harmony::parseHarmony(const String& ss, int* root, int*
     if (useLiteral) {
         cd = descr(s);
     } else {
-        m_parsedForm = new ParsedChord();
-        m_parsedForm->parse(s, cl, syntaxOnly, preferMinor);
+        m_parsedForm = new ParsedChord(cl->parsedChord(s, syntaxOnly, preferMinor));
         // parser prepends "=" to name of implied minor chords
         // use this here as well
         if (preferMinor) {
@@ -1697,8 +1696,7 @@ const ParsedChord* Harmony::parsedForm() const
 {
     if (!m_parsedForm) {
         ChordList* cl = score()->chordList();
-        m_parsedForm = new ParsedChord();
-        m_parsedForm->parse(m_textName, cl, false);
+        m_parsedForm = new ParsedChord(cl->parsedChord(m_textName));
     }
     return m_parsedForm;
 }
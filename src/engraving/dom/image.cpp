@@ -71,6 +71,9 @@ Image::Image(const Image& img)
 {
     m_imageType        = img.m_imageType;
     m_buffer           = img.m_buffer;
+    m_level            = img.m_level;
+    m_levelFactor      = img.m_levelFactor;
+    m_rasterSize       = img.m_rasterSize;
     m_size            = img.m_size;
     m_lockAspectRatio = img.m_lockAspectRatio;
     m_autoScale       = img.m_autoScale;
@@ -115,6 +118,10 @@ void Image::setImageType(ImageType t)
         m_svgDoc = 0;
     } else if (m_imageType == ImageType::RASTER) {
         m_rasterDoc.reset();
+        m_rasterSize = muse::Size();
+        m_level = Pixmap();
+        m_levelFactor = 1;
+        m_dirty = true;
     } else {
         LOGD("illegal image type");
     }
@@ -131,13 +138,93 @@ muse::SizeF Image::imageSize() const
     }
 
     if (m_imageType == ImageType::RASTER) {
-        muse::Size rasterSize = m_rasterDoc->size();
-        return muse::SizeF(rasterSize.width(), rasterSize.height());
+        return muse::SizeF(m_rasterSize.width(), m_rasterSize.height());
     }
 
     return m_svgDoc->defaultSize();
 }
 
+//---------------------------------------------------------
+//   isValid
+//---------------------------------------------------------
+
+bool Image::isValid() const
+{
+    if (m_imageType == ImageType::RASTER) {
+        return !m_rasterSize.isNull() || rasterImage();
+    }
+
+    return m_svgDoc != nullptr;
+}
+
+//---------------------------------------------------------
+//   rasterImage
+//    the raster image is decoded on first use, and released
+//    again by scaledBuffer once a reduced level is cached
+//---------------------------------------------------------
+
+const std::shared_ptr<Pixmap>& Image::rasterImage() const
+{
+    if (!m_rasterDoc && m_imageType == ImageType::RASTER && m_storeItem) {
+        m_rasterDoc = imageProvider()->createPixmap(m_storeItem->buffer());
+        m_rasterSize = m_rasterDoc ? m_rasterDoc->size() : muse::Size();
+    }
+
+    return m_rasterDoc;
+}
+
+//---------------------------------------------------------
+//   scaledBuffer
+//    returns the raster image scaled to the given device size.
+//    It is scaled from a cached level: the image reduced by
+//    the biggest power of two that keeps it at least as large,
+//    so a zoom change doesn't go back to the full image
+//---------------------------------------------------------
+
+const Pixmap& Image::scaledBuffer(const muse::Size& size) const
+{
+    if (m_buffer.size() == size && !m_dirty) {
+        return m_buffer;
+    }
+
+    if (!isValid() || m_rasterSize.isEmpty()) {
+        m_buffer = Pixmap();
+        return m_buffer;
+    }
+
+    int factor = 1;
+    while (m_rasterSize.width() / (factor * 2) >= size.width() && m_rasterSize.height() / (factor * 2) >= size.height()) {
+        factor *= 2;
+    }
+
+    if (factor != m_levelFactor || m_dirty || (factor > 1 && m_level.isNull())) {
+        const muse::Size levelSize(m_rasterSize.width() / factor, m_rasterSize.height() / factor);
+        if (factor == 1) {
+            m_level = Pixmap();
+        } else if (!m_dirty && factor > m_levelFactor && !m_level.isNull()) {
+            // zoomed out, the current level is a smaller source than the full image
+            m_level = imageProvider()->scaled(m_level, levelSize);
+        } else if (rasterImage() && !m_rasterDoc->isNull()) {
+            m_level = imageProvider()->scaled(*m_rasterDoc, levelSize);
+        }
+        m_levelFactor = factor;
+    }
+
+    if (factor > 1 && !m_level.isNull()) {
+        m_buffer = imageProvider()->scaled(m_level, size);
+        //! NOTE The full image isn't needed as long as the view is not zoomed in past the level
+        m_rasterDoc.reset();
+    } else if (rasterImage() && !m_rasterDoc->isNull()) {
+        m_buffer = imageProvider()->scaled(*m_rasterDoc, size);
+    } else {
+        m_buffer = Pixmap();
+    }
+
+    m_dirty = false;
+
+    return m_buffer;
+}
+
 //---------------------------------------------------------
 //   isImageFramed
 //---------------------------------------------------------
@@ -393,14 +480,9 @@ void Image::init()
         if (m_storeItem) {
             m_svgDoc = new SvgRenderer(m_storeItem->buffer());
         }
-    } else if (m_imageType == ImageType::RASTER && !m_rasterDoc) {
-        if (m_storeItem) {
-            m_rasterDoc = imageProvider()->createPixmap(m_storeItem->buffer());
-            if (!m_rasterDoc->isNull()) {
-                m_dirty = true;
-            }
-        }
     }
+
+    //! NOTE Raster images are decoded on first use, here only if their size is needed
     if (m_size.isNull()) {
         m_size = pixel2size(imageSize());
     }
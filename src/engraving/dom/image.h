@@ -94,10 +94,11 @@ public:
 
     void setImageType(ImageType);
     ImageType imageType() const { return m_imageType; }
-    bool isValid() const { return m_rasterDoc || m_svgDoc; }
+    bool isValid() const;
 
     muse::draw::SvgRenderer* svgRenderer() const { return m_svgDoc; }
-    const std::shared_ptr<muse::draw::Pixmap>& rasterImage() const { return m_rasterDoc; }
+    const std::shared_ptr<muse::draw::Pixmap>& rasterImage() const;
+    const muse::draw::Pixmap& scaledBuffer(const muse::Size& size) const;
 
     bool needStartEditingAfterSelecting() const override { return true; }
     int gripsCount() const override { return 2; }
@@ -108,11 +109,6 @@ public:
     SizeF pixel2size(const SizeF& s) const;
     SizeF size2pixel(const SizeF& s) const;
 
-    const muse::draw::Pixmap& buffer() const { return m_buffer; }
-    void setBuffer(const muse::draw::Pixmap& p) const { m_buffer = p; }
-    bool dirty() const { return m_dirty; }
-    void setDirty(bool val) const { m_dirty = val; }
-
 private:
 
     bool isEditable() const override { return true; }
@@ -125,13 +121,16 @@ private:
     String m_linkPath;                  // the path of an external linked img
     bool m_linkIsValid = false;         // whether _linkPath file exists or not
     mutable muse::draw::Pixmap m_buffer;  // cached rendering
+    mutable muse::draw::Pixmap m_level;   // the raster image reduced by m_levelFactor, the source of m_buffer
+    mutable int m_levelFactor = 1;
     SizeF m_size;                   // in mm or spatium units
     bool m_lockAspectRatio = false;
     bool m_autoScale = false;           // fill parent frame
     bool m_sizeIsSpatium = false;
     mutable bool m_dirty = false;
 
-    std::shared_ptr<muse::draw::Pixmap> m_rasterDoc;
+    mutable std::shared_ptr<muse::draw::Pixmap> m_rasterDoc;
+    mutable muse::Size m_rasterSize;
     muse::draw::SvgRenderer* m_svgDoc = nullptr;
 
     ImageType m_imageType = ImageType::NONE;
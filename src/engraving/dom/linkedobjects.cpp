@@ -21,6 +21,8 @@
  */
 #include "linkedobjects.h"
 
+#include <algorithm>
+
 #include "masterscore.h"
 #include "measure.h"
 #include "score.h"
@@ -53,9 +55,57 @@ void LinkedObjects::setLid(Score* score, int id)
     score->linkId(id);
 }
 
+//---------------------------------------------------------
+//   push_back
+//---------------------------------------------------------
+
+void LinkedObjects::push_back(EngravingObject* o)
+{
+    m_objects.push_back(o);
+    m_scoreTableValid = false;
+}
+
+//---------------------------------------------------------
+//   remove
+//---------------------------------------------------------
+
+void LinkedObjects::remove(EngravingObject* o)
+{
+    m_objects.erase(std::remove(m_objects.begin(), m_objects.end(), o), m_objects.end());
+    m_scoreTableValid = false;
+}
+
 bool LinkedObjects::contains(const EngravingObject* o) const
 {
-    return std::find(this->begin(), this->end(), o) != this->end();
+    return std::find(m_objects.cbegin(), m_objects.cend(), o) != m_objects.cend();
+}
+
+//---------------------------------------------------------
+//   objectsInScore
+//---------------------------------------------------------
+
+std::pair<LinkedObjects::const_iterator, LinkedObjects::const_iterator> LinkedObjects::objectsInScore(const Score* score) const
+{
+    if (!m_scoreTableValid) {
+        updateScoreTable();
+    }
+
+    auto first = std::lower_bound(m_objectsByScore.cbegin(), m_objectsByScore.cend(), score,
+                                  [](const EngravingObject* o, const Score* s) { return std::less<const Score*>()(o->score(), s); });
+    auto last = std::upper_bound(first, m_objectsByScore.cend(), score,
+                                 [](const Score* s, const EngravingObject* o) { return std::less<const Score*>()(s, o->score()); });
+
+    return { first, last };
+}
+
+void LinkedObjects::updateScoreTable() const
+{
+    m_objectsByScore = m_objects;
+    // keeps the link order within a score, as when scanning the whole list
+    std::stable_sort(m_objectsByScore.begin(), m_objectsByScore.end(), [](const EngravingObject* o1, const EngravingObject* o2) {
+        return std::less<const Score*>()(o1->score(), o2->score());
+    });
+    m_scoreTableValid = true;
 }
 
 //---------------------------------------------------------
@@ -72,7 +122,7 @@ EngravingObject* LinkedObjects::mainElement()
     MasterScore* ms = front()->score()->masterScore();
     const bool elements = front()->isEngravingItem();
     const bool staves = front()->isStaff();
-    return *std::min_element(begin(), end(), [ms, elements, staves](EngravingObject* s1, EngravingObject* s2) {
+    return *std::min_element(m_objects.begin(), m_objects.end(), [ms, elements, staves](EngravingObject* s1, EngravingObject* s2) {
         if (s1->score() == ms && s2->score() != ms) {
             return true;
         }
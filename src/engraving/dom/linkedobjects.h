@@ -22,29 +22,49 @@
 #ifndef MU_ENGRAVING_LINKEDOBJECTS_H
 #define MU_ENGRAVING_LINKEDOBJECTS_H
 
-#include <list>
+#include <vector>
 
 #include "engravingobject.h"
 
 namespace mu::engraving {
-class LinkedObjects : public std::list<EngravingObject*>
+class LinkedObjects
 {
     OBJECT_ALLOCATOR(engraving, LinkedObjects)
 
 public:
+    using const_iterator = std::vector<EngravingObject*>::const_iterator;
+
     LinkedObjects(Score*);
     LinkedObjects(Score*, int id);
 
     void setLid(Score*, int val);
     int lid() const { return m_lid; }
 
+    const_iterator begin() const { return m_objects.cbegin(); }
+    const_iterator end() const { return m_objects.cend(); }
+    size_t size() const { return m_objects.size(); }
+    bool empty() const { return m_objects.empty(); }
+    EngravingObject* front() const { return m_objects.front(); }
+
+    void push_back(EngravingObject* o);
+    void remove(EngravingObject* o);
     bool contains(const EngravingObject* o) const;
 
+    //! NOTE The linked objects belonging to the given score, looked up in a table sorted by score
+    std::pair<const_iterator, const_iterator> objectsInScore(const Score* score) const;
+    //! NOTE Must be called when the score of a linked object changes
+    void invalidateScoreTable() { m_scoreTableValid = false; }
+
     EngravingObject* mainElement();
 
 private:
+    void updateScoreTable() const;
 
     int m_lid = 0;               // unique id for every linked list
+    std::vector<EngravingObject*> m_objects;
+
+    mutable std::vector<EngravingObject*> m_objectsByScore;
+    mutable bool m_scoreTableValid = false;
 };
 }
 
@@ -25,6 +25,7 @@
 
 #include "compat/writescorehook.h"
 
+#include "rw/deferredexcerpts.h"
 #include "rw/mscloader.h"
 #include "rw/xmlreader.h"
 #include "rw/rwregister.h"
@@ -37,6 +38,7 @@
 #include "excerpt.h"
 #include "factory.h"
 #include "linkedobjects.h"
+#include "realizedharmony.h"
 #include "repeatlist.h"
 #include "rest.h"
 #include "sig.h"
@@ -59,10 +61,14 @@ MasterScore::MasterScore(const muse::modularity::ContextPtr& iocCtx, std::weak_p
 {
     m_project = project;
     m_undoStack   = new UndoStack();
+    if (configuration()) {
+        m_undoStack->setMemoryBudget(configuration()->undoMemoryBudget());
+    }
     m_tempomap    = new TempoMap;
     m_sigmap      = new TimeSigMap();
     m_expandedRepeatList  = new RepeatList(this);
     m_nonExpandedRepeatList = new RepeatList(this);
+    m_realizedHarmonyCache = new RealizedHarmonyCache();
     setMasterScore(this);
 
 #if defined(Q_OS_WIN)
@@ -101,10 +107,12 @@ MasterScore::~MasterScore()
 
     delete m_expandedRepeatList;
     delete m_nonExpandedRepeatList;
+    delete m_realizedHarmonyCache;
     delete m_sigmap;
     delete m_tempomap;
     delete m_undoStack;
     muse::DeleteAll(m_excerpts);
+    m_deferredExcerpts.reset();
 }
 
 //---------------------------------------------------------
@@ -227,6 +235,66 @@ void MasterScore::addExcerpt(Excerpt* ex, size_t index)
     setExcerptsChanged(true);
 }
 
+//---------------------------------------------------------
+//   setDeferredExcerpts
+//---------------------------------------------------------
+
+void MasterScore::setDeferredExcerpts(std::unique_ptr<rw::DeferredExcerpts> excerpts)
+{
+    m_deferredExcerpts = std::move(excerpts);
+}
+
+std::vector<Excerpt*> MasterScore::deferredExcerpts() const
+{
+    return m_deferredExcerpts ? m_deferredExcerpts->excerpts() : std::vector<Excerpt*>();
+}
+
+bool MasterScore::isExcerptDeferred(const Excerpt* ex) const
+{
+    return m_deferredExcerpts && m_deferredExcerpts->contains(ex);
+}
+
+//---------------------------------------------------------
+//   materializeExcerpt
+//    read a deferred excerpt, it is not a change of the excerpts list
+//---------------------------------------------------------
+
+bool MasterScore::materializeExcerpt(Excerpt* ex)
+{
+    if (!isExcerptDeferred(ex)) {
+        return true;
+    }
+
+    const bool excerptsWereChanged = excerptsChanged();
+    const bool ok = m_deferredExcerpts->read(ex);
+    setExcerptsChanged(excerptsWereChanged);
+
+    if (m_deferredExcerpts->empty()) {
+        m_deferredExcerpts.reset();
+    }
+
+    return ok;
+}
+
+//---------------------------------------------------------
+//   materializeExcerpts
+//    the links of the deferred excerpts point to the master score as it was read,
+//    so they must be read before the master score is changed
+//---------------------------------------------------------
+
+void MasterScore::materializeExcerpts()
+{
+    if (!m_deferredExcerpts) {
+        return;
+    }
+
+    TRACEFUNC;
+
+    for (Excerpt* ex : m_deferredExcerpts->excerpts()) {
+        materializeExcerpt(ex);
+    }
+}
+
 //---------------------------------------------------------
 //   removeExcerpt
 //---------------------------------------------------------
@@ -372,6 +440,93 @@ void MasterScore::setLayout(const Fraction& tick1, const Fraction& tick2, staff_
     }
 }
 
+//---------------------------------------------------------
+//   startBulkEdit
+//---------------------------------------------------------
+
+void MasterScore::startBulkEdit()
+{
+    if (m_bulkEditDepth++ > 0) {
+        return;
+    }
+
+    m_bulkEditCmdState.reset();
+    m_bulkEditChanges = ScoreChangesRange();
+    m_bulkEditHasChanges = false;
+    m_bulkEditHasFullRange = false;
+}
+
+//---------------------------------------------------------
+//   endBulkEdit
+//    lays out the range changed by all the commands of the
+//    bulk edit and sends the merged changes
+//---------------------------------------------------------
+
+void MasterScore::endBulkEdit()
+{
+    IF_ASSERT_FAILED(m_bulkEditDepth > 0) {
+        return;
+    }
+
+    if (--m_bulkEditDepth > 0) {
+        return;
+    }
+
+    IF_ASSERT_FAILED(!undoStack()->hasActiveCommand()) {
+        endCmd();
+    }
+
+    if (!m_bulkEditHasChanges) {
+        return;
+    }
+
+    m_cmdState = m_bulkEditCmdState;
+    m_bulkEditCmdState.reset();
+    update();
+
+    ScoreChangesRange range = std::move(m_bulkEditChanges);
+    m_bulkEditChanges = ScoreChangesRange();
+    m_bulkEditHasChanges = false;
+
+    if (m_bulkEditHasFullRange) {
+        range.tickFrom = range.tickTo = -1;
+        range.staffIdxFrom = range.staffIdxTo = muse::nidx;
+    }
+
+    m_changesRangeChannel.send(range);
+}
+
+//---------------------------------------------------------
+//   addBulkEditChanges
+//---------------------------------------------------------
+
+void MasterScore::addBulkEditChanges(const CmdState& cmdState, const ScoreChangesRange& range)
+{
+    m_bulkEditCmdState.merge(cmdState);
+
+    // a command without boundaries makes the listeners update everything
+    if (!range.isValidBoundary()) {
+        m_bulkEditHasFullRange = true;
+    } else if (!m_bulkEditHasChanges || !m_bulkEditChanges.isValidBoundary()) {
+        m_bulkEditChanges.tickFrom = range.tickFrom;
+        m_bulkEditChanges.tickTo = range.tickTo;
+        m_bulkEditChanges.staffIdxFrom = range.staffIdxFrom;
+        m_bulkEditChanges.staffIdxTo = range.staffIdxTo;
+    } else {
+        m_bulkEditChanges.tickFrom = std::min(m_bulkEditChanges.tickFrom, range.tickFrom);
+        m_bulkEditChanges.tickTo = std::max(m_bulkEditChanges.tickTo, range.tickTo);
+        m_bulkEditChanges.staffIdxFrom = std::min(m_bulkEditChanges.staffIdxFrom, range.staffIdxFrom);
+        m_bulkEditChanges.staffIdxTo = std::max(m_bulkEditChanges.staffIdxTo, range.staffIdxTo);
+    }
+
+    // changedItems isn't merged: the items changed by a command may be deleted by a later one
+    m_bulkEditChanges.changedTypes.insert(range.changedTypes.cbegin(), range.changedTypes.cend());
+    m_bulkEditChanges.changedPropertyIdSet.insert(range.changedPropertyIdSet.cbegin(), range.changedPropertyIdSet.cend());
+    m_bulkEditChanges.changedStyleIdSet.insert(range.changedStyleIdSet.cbegin(), range.changedStyleIdSet.cend());
+
+    m_bulkEditHasChanges = true;
+}
+
 //---------------------------------------------------------
 //   setPlaybackScore
 //---------------------------------------------------------
@@ -37,6 +37,10 @@ class MscWriter;
 class MscLoader;
 }
 
+namespace mu::engraving::rw {
+class DeferredExcerpts;
+}
+
 namespace mu::engraving::compat {
 class ScoreAccess;
 class ReadStyleHook;
@@ -46,6 +50,7 @@ namespace mu::engraving {
 class Excerpt;
 class MasterScore;
 class Part;
+class RealizedHarmonyCache;
 class RepeatList;
 class Revisions;
 class TempoMap;
@@ -115,6 +120,8 @@ public:
     const RepeatList& repeatList() const override;
     const RepeatList& repeatList(bool expandRepeats) const override;
 
+    RealizedHarmonyCache* realizedHarmonyCache() const { return m_realizedHarmonyCache; }
+
     std::vector<Excerpt*>& excerpts() { return m_excerpts; }
     const std::vector<Excerpt*>& excerpts() const { return m_excerpts; }
     //   QQueue<MidiInputEvent>* midiInputQueue() override { return &_midiInputQueue; }
@@ -135,6 +142,13 @@ public:
     bool excerptsChanged() const { return m_cmdState.excerptsChanged; }
     bool instrumentsChanged() const { return m_cmdState.instrumentsChanged; }
 
+    //! NOTE While a bulk edit is active, endCmd() neither lays out the score nor sends the changes,
+    //! the changes of all the commands are merged and handled once by the outermost endBulkEdit()
+    void startBulkEdit();
+    void endBulkEdit();
+    bool isBulkEditActive() const { return m_bulkEditDepth > 0; }
+    void addBulkEditChanges(const CmdState& cmdState, const ScoreChangesRange& range);
+
     void setTempomap(TempoMap* tm);
 
     int midiPortCount() const { return m_midiPortCount; }
@@ -167,6 +181,15 @@ public:
     void initExcerpt(Excerpt*);
     void initEmptyExcerpt(Excerpt*);
 
+    // Excerpts whose reading was deferred at load (see MscLoader::setLazyExcerpts).
+    // They are not in excerpts() until materialized; all of them are materialized
+    // before the first command and before saving
+    void setDeferredExcerpts(std::unique_ptr<rw::DeferredExcerpts> excerpts);
+    std::vector<Excerpt*> deferredExcerpts() const;
+    bool isExcerptDeferred(const Excerpt*) const;
+    bool materializeExcerpt(Excerpt*);
+    void materializeExcerpts();
+
     void setPlaybackScore(Score*);
     Score* playbackScore() { return m_playbackScore; }
     const Score* playbackScore() const { return m_playbackScore; }
@@ -217,9 +240,11 @@ private:
     TempoMap* m_tempomap = nullptr;
     RepeatList* m_expandedRepeatList = nullptr;
     RepeatList* m_nonExpandedRepeatList = nullptr;
+    RealizedHarmonyCache* m_realizedHarmonyCache = nullptr;
     bool m_expandRepeats = true;
     bool m_playlistDirty = true;
     std::vector<Excerpt*> m_excerpts;
+    std::unique_ptr<rw::DeferredExcerpts> m_deferredExcerpts;
     std::vector<PartChannelSettingsLink> m_playbackSettingsLinks;
     Score* m_playbackScore = nullptr;
     muse::async::Channel<ScoreChangesRange> m_changesRangeChannel;
@@ -228,6 +253,12 @@ private:
 
     CmdState m_cmdState;       // modified during cmd processing
 
+    int m_bulkEditDepth = 0;
+    CmdState m_bulkEditCmdState;
+    ScoreChangesRange m_bulkEditChanges;
+    bool m_bulkEditHasChanges = false;
+    bool m_bulkEditHasFullRange = false;
+
     std::array<Fraction, 2> m_loopBoundaries; ///< 0 - LoopIn, 1 - LoopOut
 
     int m_midiPortCount = 0;                           // A count of ALSA midi out ports
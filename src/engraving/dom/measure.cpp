@@ -652,6 +652,10 @@ Segment* Measure::tick2segment(const Fraction& _t, SegmentType st)
 
 Segment* Measure::findSegmentR(SegmentType st, const Fraction& t) const
 {
+    if (m_segments.indexed()) {
+        return m_segments.findR(st, t);
+    }
+
     Segment* s;
     if (t > (ticks() * Fraction(1, 2))) {
         // search backwards
@@ -695,6 +699,10 @@ Segment* Measure::undoGetSegmentR(SegmentType type, const Fraction& t)
 
 Segment* Measure::findFirstR(SegmentType st, const Fraction& t) const
 {
+    if (m_segments.indexed()) {
+        return m_segments.findFirstR(st, t);
+    }
+
     Segment* s;
     // search forwards
     for (s = first(); s && s->rtick() <= t; s = s->next()) {
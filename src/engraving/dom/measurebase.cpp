@@ -688,6 +688,7 @@ MeasureBaseList::MeasureBaseList()
 
 void MeasureBaseList::push_back(MeasureBase* e)
 {
+    ++m_version;
     ++m_size;
     if (m_last) {
         m_last->setNext(e);
@@ -707,6 +708,7 @@ void MeasureBaseList::push_back(MeasureBase* e)
 
 void MeasureBaseList::push_front(MeasureBase* e)
 {
+    ++m_version;
     ++m_size;
     if (m_first) {
         m_first->setPrev(e);
@@ -727,6 +729,7 @@ void MeasureBaseList::push_front(MeasureBase* e)
 
 void MeasureBaseList::add(MeasureBase* e)
 {
+    ++m_version;
     MeasureBase* el = e->next();
     if (el == 0) {
         push_back(e);
@@ -748,6 +751,7 @@ void MeasureBaseList::add(MeasureBase* e)
 
 void MeasureBaseList::remove(MeasureBase* el)
 {
+    ++m_version;
     --m_size;
     if (el->prev()) {
         el->prev()->setNext(el->next());
@@ -767,6 +771,7 @@ void MeasureBaseList::remove(MeasureBase* el)
 
 void MeasureBaseList::insert(MeasureBase* fm, MeasureBase* lm)
 {
+    ++m_version;
     ++m_size;
     for (MeasureBase* m = fm; m != lm; m = m->next()) {
         ++m_size;
@@ -791,6 +796,7 @@ void MeasureBaseList::insert(MeasureBase* fm, MeasureBase* lm)
 
 void MeasureBaseList::remove(MeasureBase* fm, MeasureBase* lm)
 {
+    ++m_version;
     --m_size;
     for (MeasureBase* m = fm; m != lm; m = m->next()) {
         --m_size;
@@ -815,6 +821,7 @@ void MeasureBaseList::remove(MeasureBase* fm, MeasureBase* lm)
 
 void MeasureBaseList::change(MeasureBase* ob, MeasureBase* nb)
 {
+    ++m_version;
     nb->setPrev(ob->prev());
     nb->setNext(ob->next());
     if (ob->prev()) {
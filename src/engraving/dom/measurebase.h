@@ -210,7 +210,7 @@ public:
     MeasureBaseList();
     MeasureBase* first() const { return m_first; }
     MeasureBase* last()  const { return m_last; }
-    void clear() { m_first = m_last = 0; m_size = 0; }
+    void clear() { m_first = m_last = 0; m_size = 0; ++m_version; }
     void add(MeasureBase*);
     void remove(MeasureBase*);
     void insert(MeasureBase*, MeasureBase*);
@@ -219,11 +219,15 @@ public:
     int size() const { return m_size; }
     bool empty() const { return m_size == 0; }
 
+    //! NOTE Changed each time a measure is added or removed, so that what is cached about the list can be checked
+    size_t version() const { return m_version; }
+
 private:
     void push_back(MeasureBase* e);
     void push_front(MeasureBase* e);
 
     int m_size = 0;
+    size_t m_version = 0;
     MeasureBase* m_first = nullptr;
     MeasureBase* m_last = nullptr;
 };
@@ -0,0 +1,129 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-Studio-CLA-applies
+ *
+ * MuseScore Studio
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2025 MuseScore Limited
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "memoryusage.h"
+
+#include "../infrastructure/shape.h"
+
+#include "engravingitem.h"
+#include "excerpt.h"
+#include "imageStore.h"
+#include "masterscore.h"
+#include "undo.h"
+
+#include "log.h"
+
+using namespace mu::engraving;
+
+static void collectObjectUsage(const EngravingObject* obj, ScoreMemoryUsage& usage)
+{
+    const size_t bytes = obj->objectSize();
+
+    ScoreMemoryUsage::TypeUsage& typeUsage = usage.types[obj->type()];
+    typeUsage.count++;
+    typeUsage.bytes += bytes;
+
+    usage.objectCount++;
+    usage.objectBytes += bytes;
+
+    if (obj->isEngravingItem()) {
+        const EngravingItem* item = toEngravingItem(obj);
+        //! NOTE ldata() would create the layout data, only look at what is already there
+        if (item->hasLayoutData()) {
+            usage.layoutDataCount++;
+
+            //! NOTE shape() may fill the shape of some items, so read the stored one
+            const EngravingItem::LayoutData* ldata = item->ldata();
+            if (ldata->isSetShape()) {
+                size_t elements = ldata->shapeElementCount();
+                usage.shapeElementCount += elements;
+                usage.shapeBytes += sizeof(Shape) + elements * sizeof(ShapeElement);
+            }
+        }
+    }
+
+    for (const EngravingObject* child : obj->children()) {
+        // excerpts are counted separately
+        if (child->isScore()) {
+            continue;
+        }
+        collectObjectUsage(child, usage);
+    }
+}
+
+ScoreMemoryUsage MemoryUsage::scoreUsage(const Score* score)
+{
+    ScoreMemoryUsage usage;
+    IF_ASSERT_FAILED(score) {
+        return usage;
+    }
+
+    collectObjectUsage(score, usage);
+
+    return usage;
+}
+
+MemoryUsage MemoryUsage::collect(MasterScore* score)
+{
+    MemoryUsage usage;
+    IF_ASSERT_FAILED(score) {
+        return usage;
+    }
+
+    usage.masterScore = scoreUsage(score);
+
+    std::vector<Score*> scores { score };
+    for (const Excerpt* excerpt : score->excerpts()) {
+        Score* excerptScore = excerpt->excerptScore();
+        if (!excerptScore) {
+            continue;
+        }
+
+        usage.excerpts.emplace_back(excerpt->name(), scoreUsage(excerptScore));
+        scores.push_back(excerptScore);
+    }
+
+    if (const UndoStack* undoStack = score->undoStack()) {
+        usage.undoCommandCount = undoStack->size();
+        usage.undoBytes = undoStack->memoryUsage();
+    }
+
+    for (const ImageStoreItem* item : imageStore) {
+        for (Score* s : scores) {
+            if (item->isUsed(s)) {
+                usage.imageCount++;
+                usage.imageBytes += item->buffer().size();
+                break;
+            }
+        }
+    }
+
+    return usage;
+}
+
+size_t MemoryUsage::totalBytes() const
+{
+    size_t total = masterScore.totalBytes() + undoBytes + imageBytes;
+    for (const auto& excerpt : excerpts) {
+        total += excerpt.second.totalBytes();
+    }
+    return total;
+}
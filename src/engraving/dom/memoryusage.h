@@ -0,0 +1,76 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-Studio-CLA-applies
+ *
+ * MuseScore Studio
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2025 MuseScore Limited
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef MU_ENGRAVING_MEMORYUSAGE_H
+#define MU_ENGRAVING_MEMORYUSAGE_H
+
+#include <map>
+#include <vector>
+
+#include "types/string.h"
+
+#include "../types/types.h"
+
+namespace mu::engraving {
+class Score;
+class MasterScore;
+
+//! NOTE Estimated memory used by the objects of a score.
+//! Bytes are the shallow sizes of the objects plus their shapes,
+//! memory owned through pointers and containers of the objects isn't counted
+struct ScoreMemoryUsage
+{
+    struct TypeUsage {
+        size_t count = 0;
+        size_t bytes = 0;
+    };
+
+    std::map<ElementType, TypeUsage> types;
+
+    size_t objectCount = 0;
+    size_t objectBytes = 0;
+    size_t layoutDataCount = 0;
+    size_t shapeElementCount = 0;
+    size_t shapeBytes = 0;
+
+    size_t totalBytes() const { return objectBytes + shapeBytes; }
+};
+
+struct MemoryUsage
+{
+    ScoreMemoryUsage masterScore;
+    std::vector<std::pair<muse::String, ScoreMemoryUsage> > excerpts;
+
+    size_t undoCommandCount = 0;
+    size_t undoBytes = 0;
+
+    size_t imageCount = 0;
+    size_t imageBytes = 0;
+
+    size_t totalBytes() const;
+
+    //! NOTE Walks the object tree, so it's meant for diagnostics, not for hot paths
+    static ScoreMemoryUsage scoreUsage(const Score* score);
+    static MemoryUsage collect(MasterScore* score);
+};
+}
+
+#endif // MU_ENGRAVING_MEMORYUSAGE_H
@@ -509,6 +509,9 @@ private:
     bool m_play = true;           // note is not played if false
     mutable bool m_mark = false;  // for use in sequencer
     bool m_fixed = false;         // for slash notation
+    bool m_hasHeadParentheses = false;
+    bool m_isHammerOn = false;
+    bool m_harmonic = false;
     StretchedBend* m_stretchedBend = nullptr;
     SlideType m_slideToType = SlideType::Undefined;
     SlideType m_slideFromType = SlideType::Undefined;
@@ -546,10 +549,6 @@ private:
 
     Symbol* m_leftParenthesis = nullptr;
     Symbol* m_rightParenthesis = nullptr;
-    bool m_hasHeadParentheses = false;
-
-    bool m_isHammerOn = false;
-    bool m_harmonic = false;
 
     ElementList m_el;          // fingering, other text, symbols or images
     std::vector<NoteDot*> m_dots;
@@ -301,20 +301,6 @@ void Page::scanElements(void* data, void (* func)(void*, EngravingItem*), bool a
     func(data, this);
 }
 
-//---------------------------------------------------------
-//   bspInsert
-//---------------------------------------------------------
-
-static void bspInsert(void* bspTree, EngravingItem* e)
-{
-    ((BspTree*)bspTree)->insert(e);
-}
-
-static void countElements(void* data, EngravingItem* /*e*/)
-{
-    ++(*(int*)data);
-}
-
 //---------------------------------------------------------
 //   doRebuildBspTree
 //---------------------------------------------------------
@@ -322,7 +308,7 @@ static void countElements(void* data, EngravingItem* /*e*/)
 void Page::doRebuildBspTree()
 {
     int n = 0;
-    scanElements(&n, countElements, false);
+    scanItems([&n](EngravingItem*) { ++n; }, false);
 
     RectF r;
     if (score()->linearMode()) {
@@ -341,7 +327,7 @@ void Page::doRebuildBspTree()
     }
 
     bspTree.initialize(r, n);
-    scanElements(&bspTree, &bspInsert, false);
+    scanItems([this](EngravingItem* e) { bspTree.insert(e); }, false);
     m_bspTreeValid = true;
 }
 
@@ -76,6 +76,17 @@ public:
 
     std::vector<EngravingItem*> items(const RectF& r);
     std::vector<EngravingItem*> items(const PointF& p);
+
+    //! NOTE See BspTree::forEachItem
+    template<typename Area, typename Func>
+    void forEachItem(const Area& area, Func func)
+    {
+        if (!m_bspTreeValid) {
+            doRebuildBspTree();
+        }
+        bspTree.forEachItem(area, func);
+    }
+
     void invalidateBspTree() { m_bspTreeValid = false; }
     PointF pagePos() const override { return PointF(); }       ///< position in page coordinates
     std::vector<EngravingItem*> elements() const;              ///< list of visible elements
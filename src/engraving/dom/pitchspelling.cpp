@@ -26,6 +26,8 @@
 
 #include "pitchspelling.h"
 
+#include <algorithm>
+
 #include "translation.h"
 #include "types/typesconv.h"
 
@@ -608,31 +610,64 @@ int tpc(int idx, int pitch, int opt)
     return tab[i];
 }
 
+//---------------------------------------------------------
+//   bestSpelling
+//    lowest penalty spelling of a padded window for one of
+//    the two spelling tables. Among equal penalties the
+//    numerically smallest option is returned, which is the
+//    one an exhaustive search over all options would find
+//    first. The last position is never varied.
+//---------------------------------------------------------
+
+static int bestSpelling(const int pitch[10], const int key[10], const int* tab, int& cost)
+{
+    // best[k][b]: lowest penalty of positions 0..k with position k spelled by bit b
+    int best[10][2];
+    best[0][0] = 0;
+    best[0][1] = 0;
+    for (int k = 1; k < 10; ++k) {
+        for (int b = 0; b < 2; ++b) {
+            int lof2 = tab[pitch[k] * 2 + b];
+            best[k][b] = std::min(best[k - 1][0] + penalty(tab[pitch[k - 1] * 2], lof2, key[k]),
+                                  best[k - 1][1] + penalty(tab[pitch[k - 1] * 2 + 1], lof2, key[k]));
+        }
+    }
+
+    cost = best[9][0];
+
+    // walk back from the highest bit, preferring 0 wherever it still reaches the optimum
+    int opt = 0;
+    int b = 0;
+    for (int k = 9; k > 0; --k) {
+        int lof2 = tab[pitch[k] * 2 + b];
+        int a = (best[k - 1][0] + penalty(tab[pitch[k - 1] * 2], lof2, key[k]) == best[k][b]) ? 0 : 1;
+        opt |= a << (k - 1);
+        b = a;
+    }
+    return opt;
+}
+
 //---------------------------------------------------------
 //   computeWindow
+//    pitch classes and keys (offset by 7) of all notes,
+//    the window is padded with its last note
 //---------------------------------------------------------
 
-int computeWindow(const std::vector<Note*>& notes, int start, int end)
+static int computeWindow(const std::vector<int>& pitches, const std::vector<int>& keys, const std::vector<Note*>& notes, int start,
+                         int end)
 {
-    int p   = 10000;
-    int idx = -1;
     int pitch[10];
     int key[10];
 
-    int i = start;
     int k = 0;
-    while (i < end) {
-        pitch[k] = notes[i]->pitch() % 12;
-        Fraction tick = notes[i]->chord()->tick();
-        key[k]   = int(notes[i]->staff()->key(tick)) + 7;
+    for (int i = start; i < end; ++i, ++k) {
+        pitch[k] = pitches[i];
+        key[k]   = keys[i];
         if (key[k] < 0 || key[k] > 14) {
             LOGD("illegal key at tick %d: %d, window %d-%d",
-                 tick.ticks(), key[k] - 7, start, end);
+                 notes[i]->chord()->tick().ticks(), key[k] - 7, start, end);
             return 0;
-            // abort();
         }
-        ++k;
-        ++i;
     }
 
     for (; k < 10; ++k) {
@@ -640,47 +675,55 @@ int computeWindow(const std::vector<Note*>& notes, int start, int end)
         key[k]   = key[k - 1];
     }
 
-    for (i = 0; i < 512; ++i) {
-        int pa    = 0;
-        int pb    = 0;
-        int l     = pitch[0] * 2 + (i & 1);
-        assert(l >= 0 && l <= static_cast<int>(sizeof(tab1) / sizeof(*tab1)));
-        int lof1a = tab1[l];
-        int lof1b = tab2[l];
-
-        for (k = 1; k < 10; ++k) {
-            int l1 = pitch[k] * 2 + ((i & (1 << k)) >> k);
-            assert(l1 >= 0 && l1 <= static_cast<int>(sizeof(tab1) / sizeof(*tab1)));
-            int lof2a = tab1[l1];
-            int lof2b = tab2[l1];
-            pa += penalty(lof1a, lof2a, key[k]);
-            pb += penalty(lof1b, lof2b, key[k]);
-            lof1a = lof2a;
-            lof1b = lof2b;
-        }
-        if (pa < pb) {
-            if (pa < p) {
-                p   = pa;
-                idx = i;
-            }
-        } else {
-            if (pb < p) {
-                p   = pb;
-                idx = i * -1;
-            }
+    int pa = 0;
+    int pb = 0;
+    int ia = bestSpelling(pitch, key, tab1, pa);
+    int ib = bestSpelling(pitch, key, tab2, pb);
+
+    // same choice as scanning all options in order and keeping the
+    // first strict improvement, with ties between the tables going to tab2
+    if (pa < pb) {
+        return ia;
+    }
+    if (pb < pa) {
+        return -ib;
+    }
+    return ia < ib ? ia : -ib;
+}
+
+//---------------------------------------------------------
+//   collectWindowContext
+//    looks up the key of each note once, consecutive notes
+//    usually share a chord and therefore a tick
+//---------------------------------------------------------
+
+static void collectWindowContext(const std::vector<Note*>& notes, int start, int end, std::vector<int>& pitches, std::vector<int>& keys)
+{
+    pitches.assign(notes.size(), 0);
+    keys.assign(notes.size(), 0);
+
+    const Staff* lastStaff = nullptr;
+    Fraction lastTick(-1, 1);
+    int lastKey = 0;
+    for (int i = start; i < end; ++i) {
+        const Note* note = notes[i];
+        Fraction tick = note->chord()->tick();
+        if (note->staff() != lastStaff || tick != lastTick) {
+            lastStaff = note->staff();
+            lastTick = tick;
+            lastKey = int(lastStaff->key(tick)) + 7;
         }
+        pitches[i] = note->pitch() % 12;
+        keys[i] = lastKey;
     }
-/*      LOGD("compute window\n   ");
-      for (int i = 0; i < 10; ++i)
-            LOGD("%2d ", pitch[i]);
-      LOGD("\n   ");
-      for (int i = 0; i < 10; ++i)
-            LOGD("%2d ", key[i]);
-      LOGD("\n   ");
-      for (int i = 0; i < 10; ++i)
-            LOGD("%2d ", tpc(i, pitch[i], idx));
-*/
-    return idx;
+}
+
+int computeWindow(const std::vector<Note*>& notes, int start, int end)
+{
+    std::vector<int> pitches;
+    std::vector<int> keys;
+    collectWindowContext(notes, start, end, pitches, keys);
+    return computeWindow(pitches, keys, notes, start, end);
 }
 
 //---------------------------------------------------------
@@ -711,13 +754,18 @@ void Score::spellNotelist(std::vector<Note*>& notes)
 {
     int n = int(notes.size());
 
+    // windows overlap, so look up pitch classes and keys only once
+    std::vector<int> pitches;
+    std::vector<int> keys;
+    collectWindowContext(notes, 0, n, pitches, keys);
+
     int start = 0;
     while (start < n) {
         int end = start + WINDOW;
         if (end > n) {
             end = n;
         }
-        int opt = computeWindow(notes, start, end);
+        int opt = computeWindow(pitches, keys, notes, start, end);
         const int* tab;
         if (opt < 0) {
             tab = tab2;
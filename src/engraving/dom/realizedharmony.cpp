@@ -22,8 +22,11 @@
 
 #include "realizedharmony.h"
 
+#include <tuple>
+
 #include "chordlist.h"
 #include "harmony.h"
+#include "masterscore.h"
 #include "pitchspelling.h"
 #include "segment.h"
 
@@ -192,6 +195,37 @@ const RealizedHarmony::PitchMap RealizedHarmony::generateNotes(int rootTpc, int
     return notes;
 }
 
+//---------------------------------------------------
+//   cacheKey
+///   collects everything generateNotes reads from the
+///   harmony, so that equal keys realize to equal notes
+//---------------------------------------------------
+static RealizedHarmonyCache::Key cacheKey(const Harmony* harmony, int rootTpc, int bassTpc, int transposeOffset, Voicing voicing,
+                                          bool literal)
+{
+    RealizedHarmonyCache::Key key;
+    key.rootTpc = rootTpc;
+    key.bassTpc = bassTpc;
+    key.transposeOffset = transposeOffset;
+    key.voicing = voicing;
+    key.literal = literal;
+
+    const ParsedChord* p = harmony->parsedForm();
+    key.chord = p->quality() + u'|' + p->extension() + u'|' + p->modifierList().join(u",")
+                + (p->understandable() ? u"|1" : u"|0");
+
+    //the jazz interpretation looks ahead at the next chord symbol
+    if (!literal) {
+        const Harmony* next = harmony->findNext();
+        if (next && next->parsedForm() && tpcIsValid(next->rootTpc())) {
+            key.context = String::number(tpc2pitch(next->rootTpc())) + u'|' + next->parsedForm()->quality()
+                          + u'|' + next->parsedForm()->extension();
+        }
+    }
+
+    return key;
+}
+
 //---------------------------------------------------
 //   update
 ///   updates the current note map, this is where all
@@ -219,7 +253,18 @@ void RealizedHarmony::update(int rootTpc, int bassTpc, int transposeOffset /*= 0
     }
 
     if (tpcIsValid(rootTpc)) {
-        m_notes = generateNotes(rootTpc, bassTpc, m_literal, m_voicing, transposeOffset);
+        RealizedHarmonyCache* cache = m_harmony->masterScore() ? m_harmony->masterScore()->realizedHarmonyCache() : nullptr;
+        if (cache && m_harmony->parsedForm()) {
+            const RealizedHarmonyCache::Key key = cacheKey(m_harmony, rootTpc, bassTpc, transposeOffset, m_voicing, m_literal);
+            if (const PitchMap* cached = cache->find(key)) {
+                m_notes = *cached;
+            } else {
+                m_notes = generateNotes(rootTpc, bassTpc, m_literal, m_voicing, transposeOffset);
+                cache->insert(key, m_notes);
+            }
+        } else {
+            m_notes = generateNotes(rootTpc, bassTpc, m_literal, m_voicing, transposeOffset);
+        }
     }
     m_dirty = false;
 }
@@ -590,4 +635,24 @@ void RealizedHarmony::cascadeDirty(bool dirty)
     }
     m_dirty = dirty;
 }
+
+//---------------------------------------------------
+//   RealizedHarmonyCache
+//---------------------------------------------------
+bool RealizedHarmonyCache::Key::operator<(const Key& other) const
+{
+    return std::tie(chord, context, rootTpc, bassTpc, transposeOffset, voicing, literal)
+           < std::tie(other.chord, other.context, other.rootTpc, other.bassTpc, other.transposeOffset, other.voicing, other.literal);
+}
+
+const RealizedHarmonyCache::PitchMap* RealizedHarmonyCache::find(const Key& key) const
+{
+    auto it = m_notes.find(key);
+    return it != m_notes.end() ? &it->second : nullptr;
+}
+
+void RealizedHarmonyCache::insert(const Key& key, const PitchMap& notes)
+{
+    m_notes.insert_or_assign(key, notes);
+}
 }
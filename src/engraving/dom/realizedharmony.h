@@ -26,6 +26,7 @@
 #include <map>
 
 #include "containers.h"
+#include "types/string.h"
 #include "../types/fraction.h"
 
 namespace mu::engraving {
@@ -107,6 +108,41 @@ private:
     bool m_dirty = false;
     bool m_literal = false;   //use all notes when possible and do not add any notes
 };
+
+//-----------------------------------------
+//    Realized Harmony Cache
+///     shares generated note maps between
+///     chord symbols that realize to the
+///     same notes. The key holds every input
+///     of RealizedHarmony::generateNotes, so
+///     entries never need to be invalidated.
+//-----------------------------------------
+class RealizedHarmonyCache
+{
+public:
+    using PitchMap = RealizedHarmony::PitchMap;
+
+    struct Key {
+        muse::String chord;       // quality, extension, modifiers and understandability
+        muse::String context;     // next chord symbol, only used when not literal
+        int rootTpc = 0;
+        int bassTpc = 0;
+        int transposeOffset = 0;
+        Voicing voicing = Voicing::INVALID;
+        bool literal = false;
+
+        bool operator<(const Key& other) const;
+    };
+
+    const PitchMap* find(const Key& key) const;
+    void insert(const Key& key, const PitchMap& notes);
+
+    size_t size() const { return m_notes.size(); }
+    void clear() { m_notes.clear(); }
+
+private:
+    std::map<Key, PitchMap> m_notes;
+};
 }
 
 #endif // __REALIZEDHARMONY_H__
@@ -23,6 +23,7 @@
 #include "repeatlist.h"
 
 #include <algorithm>
+#include <cstring>
 #include <list>
 #include <utility> // std::pair
 
@@ -119,8 +120,6 @@ const std::vector<const Measure*>& RepeatSegment::measureList() const
 RepeatList::RepeatList(Score* s)
 {
     m_score = s;
-    m_idx1  = 0;
-    m_idx2  = 0;
 }
 
 //---------------------------------------------------------
@@ -155,15 +154,117 @@ void RepeatList::update(bool expand)
         return;
     }
 
-    if (expand) {
+    //! NOTE Most edits (notes, dynamics, ...) don't affect the playback order,
+    //! in that case the segments are kept and only their ticks are refreshed
+    Structure structure = collectStructure();
+
+    if (expand == m_expanded && !empty() && structure == m_structure) {
+        updateTicks();
+    } else if (expand) {
         unwind();
     } else {
         flatten();
     }
 
+    m_structure = std::move(structure);
     m_scoreChanged = false;
 }
 
+//---------------------------------------------------------
+//   collectStructure
+///   Lists the measures and all the properties of the repeat
+///   related elements that unwind() and flatten() depend on
+//---------------------------------------------------------
+
+RepeatList::Structure RepeatList::collectStructure() const
+{
+    Structure structure;
+    std::vector<uint64_t>& values = structure.values;
+
+    auto addValue = [&values](auto v) {
+        values.push_back(static_cast<uint64_t>(v));
+    };
+
+    auto addPointer = [&values](const void* p) {
+        values.push_back(static_cast<uint64_t>(reinterpret_cast<uintptr_t>(p)));
+    };
+
+    for (const MeasureBase* mb = m_score->first(); mb; mb = mb->next()) {
+        addPointer(mb);
+
+        if (mb->isMeasure()) {
+            addValue(mb->repeatStart());
+            addValue(mb->repeatEnd());
+            addValue(toMeasure(mb)->repeatCount());
+
+            for (const EngravingItem* e : mb->el()) {
+                if (e->isJump()) {
+                    const Jump* jump = toJump(e);
+                    addPointer(jump);
+                    addValue(jump->playRepeats());
+                    structure.labels.push_back(jump->jumpTo());
+                    structure.labels.push_back(jump->playUntil());
+                    structure.labels.push_back(jump->continueAt());
+                } else if (e->isMarker()) {
+                    const Marker* marker = toMarker(e);
+                    addPointer(marker);
+                    addValue(marker->align().horizontal);
+                    structure.labels.push_back(marker->label());
+                }
+            }
+        }
+
+        addValue(mb->sectionBreak());
+        if (const LayoutBreak* lb = mb->sectionBreakElement()) {
+            double pause = lb->pause();
+            uint64_t bits = 0;
+            static_assert(sizeof(pause) == sizeof(bits));
+            std::memcpy(&bits, &pause, sizeof(bits));
+            values.push_back(bits);
+        }
+    }
+
+    for (const auto& spannerEntry : m_score->spanner()) {
+        const Spanner* spanner = spannerEntry.second;
+        if (!spanner->isVolta()) {
+            continue;
+        }
+
+        addPointer(spanner);
+        addValue(spanner->playSpanner());
+        addPointer(spanner->startMeasure());
+        addPointer(spanner->endMeasure());
+        addValue(spanner->getProperty(Pid::END_HOOK_TYPE).value<HookType>());
+        for (int ending : toVolta(spanner)->endings()) {
+            addValue(ending);
+        }
+        addValue(-1);
+    }
+
+    return structure;
+}
+
+//---------------------------------------------------------
+//   updateTicks
+///   The segments still reference the right measures,
+///   but the measures themselves may have moved
+//---------------------------------------------------------
+
+void RepeatList::updateTicks()
+{
+    int utick = 0;
+
+    for (RepeatSegment* s : *this) {
+        if (const Measure* m = s->firstMeasure()) {
+            s->tick = m->tick().ticks();
+        }
+        s->utick = utick;
+        utick   += s->len();
+    }
+
+    updateTempo();
+}
+
 //---------------------------------------------------------
 //   updateTempo
 //---------------------------------------------------------
@@ -201,12 +302,9 @@ int RepeatList::utick2tick(int tick) const
     if (tick < 0) {
         return 0;
     }
-    unsigned ii = (m_idx1 < n) && (tick >= at(m_idx1)->utick) ? m_idx1 : 0;
-    for (unsigned i = ii; i < n; ++i) {
-        if ((tick >= at(i)->utick) && ((i + 1 == n) || (tick < at(i + 1)->utick))) {
-            m_idx1 = i;
-            return tick - (at(i)->utick - at(i)->tick);
-        }
+    size_t i = segmentIdxByUTick(tick);
+    if (i < n) {
+        return tick - (at(i)->utick - at(i)->tick);
     }
 
     ASSERT_X(String(u"tick %1 not found in RepeatList").arg(tick));
@@ -236,14 +334,11 @@ int RepeatList::tick2utick(int tick) const
 
 double RepeatList::utick2utime(int tick) const
 {
-    size_t n = size();
-    unsigned ii = (m_idx1 < n) && (tick >= at(m_idx1)->utick) ? m_idx1 : 0;
-    for (unsigned i = ii; i < n; ++i) {
-        if ((tick >= at(i)->utick) && ((i + 1 == n) || (tick < at(i + 1)->utick))) {
-            int t     = tick - (at(i)->utick - at(i)->tick);
-            double tt = m_score->tempomap()->tick2time(t) + at(i)->timeOffset;
-            return tt;
-        }
+    size_t i = segmentIdxByUTick(tick);
+    if (i < size()) {
+        int t     = tick - (at(i)->utick - at(i)->tick);
+        double tt = m_score->tempomap()->tick2time(t) + at(i)->timeOffset;
+        return tt;
     }
     return 0.0;
 }
@@ -254,13 +349,9 @@ double RepeatList::utick2utime(int tick) const
 
 int RepeatList::utime2utick(double secs) const
 {
-    size_t repeatSegmentsCount = size();
-    unsigned ii = (m_idx2 < repeatSegmentsCount) && (secs >= at(m_idx2)->utime) ? m_idx2 : 0;
-    for (unsigned i = ii; i < repeatSegmentsCount; ++i) {
-        if ((secs >= at(i)->utime) && ((i + 1 == repeatSegmentsCount) || (secs < at(i + 1)->utime))) {
-            m_idx2 = i;
-            return m_score->tempomap()->time2tick(secs - at(i)->timeOffset) + (at(i)->utick - at(i)->tick);
-        }
+    size_t i = segmentIdxByUTime(secs);
+    if (i < size()) {
+        return m_score->tempomap()->time2tick(secs - at(i)->timeOffset) + (at(i)->utick - at(i)->tick);
     }
 
     if (!empty()) {
@@ -271,6 +362,63 @@ int RepeatList::utime2utick(double secs) const
     return 0;
 }
 
+//---------------------------------------------------------
+//   segmentIdxByUTick
+///   The index of the last segment starting at or before utick,
+///   or size() if there is no such segment
+//---------------------------------------------------------
+
+size_t RepeatList::segmentIdxByUTick(int utick) const
+{
+    size_t n = size();
+
+    // the lookups during playback are mostly sequential, so check the cached segment first
+    unsigned idx = m_idx1.load(std::memory_order_relaxed);
+    if (idx < n && utick >= at(idx)->utick && (idx + 1 == n || utick < at(idx + 1)->utick)) {
+        return idx;
+    }
+
+    // the segments are sorted by utick
+    auto it = std::upper_bound(cbegin(), cend(), utick, [](int t, const RepeatSegment* rs) {
+        return t < rs->utick;
+    });
+    if (it == cbegin()) {
+        return n;
+    }
+
+    size_t i = std::distance(cbegin(), it) - 1;
+    m_idx1.store(static_cast<unsigned>(i), std::memory_order_relaxed);
+    return i;
+}
+
+//---------------------------------------------------------
+//   segmentIdxByUTime
+///   The index of the last segment starting at or before secs,
+///   or size() if there is no such segment
+//---------------------------------------------------------
+
+size_t RepeatList::segmentIdxByUTime(double secs) const
+{
+    size_t n = size();
+
+    unsigned idx = m_idx2.load(std::memory_order_relaxed);
+    if (idx < n && secs >= at(idx)->utime && (idx + 1 == n || secs < at(idx + 1)->utime)) {
+        return idx;
+    }
+
+    // the segments are sorted by utime
+    auto it = std::upper_bound(cbegin(), cend(), secs, [](double t, const RepeatSegment* rs) {
+        return t < rs->utime;
+    });
+    if (it == cbegin()) {
+        return n;
+    }
+
+    size_t i = std::distance(cbegin(), it) - 1;
+    m_idx2.store(static_cast<unsigned>(i), std::memory_order_relaxed);
+    return i;
+}
+
 ///
 /// \brief Lookup the RepeatSegment containing the given utick
 ///
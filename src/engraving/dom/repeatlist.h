@@ -23,6 +23,7 @@
 #ifndef MU_ENGRAVING_REPEATLIST_H
 #define MU_ENGRAVING_REPEATLIST_H
 
+#include <atomic>
 #include <set>
 #include <vector>
 
@@ -99,6 +100,17 @@ public:
     std::vector<RepeatSegment*>::const_iterator findRepeatSegmentFromUTick(int utick) const;
 
 private:
+    //! NOTE Everything in the score that the playback order depends on
+    struct Structure {
+        std::vector<uint64_t> values;
+        std::vector<muse::String> labels;
+
+        bool operator==(const Structure& other) const { return values == other.values && labels == other.labels; }
+    };
+
+    Structure collectStructure() const;
+    void updateTicks();
+
     void collectRepeatListElements();
     std::pair<std::vector<RepeatListElementList>::const_iterator, RepeatListElementList::const_iterator> findMarker(
         muse::String label, std::vector<RepeatListElementList>::const_iterator referenceSectionIt,
@@ -110,11 +122,17 @@ private:
     void unwind();
     void flatten();
 
+    size_t segmentIdxByUTick(int utick) const;
+    size_t segmentIdxByUTime(double secs) const;
+
     Score* m_score = nullptr;
-    mutable unsigned m_idx1, m_idx2 = 0;     // cached values
+    // cached values, may be updated by concurrent readers (e.g. playback rendering)
+    mutable std::atomic<unsigned> m_idx1 = 0;
+    mutable std::atomic<unsigned> m_idx2 = 0;
 
     bool m_expanded = false;
     bool m_scoreChanged = true;
+    Structure m_structure;
 
     std::set<std::pair<Jump const* const, int> > m_jumpsTaken;     // take the jumps only once, so track them during unwind
     std::vector<RepeatListElementList> m_rlElements;               // all elements of the score that influence the RepeatList
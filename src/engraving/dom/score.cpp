@@ -27,8 +27,10 @@
 
 #include "score.h"
 
+#include <algorithm>
 #include <cmath>
 #include <map>
+#include <unordered_set>
 
 #include "containers.h"
 
@@ -37,6 +39,7 @@
 #include "compat/dummyelement.h"
 
 #include "iengravingfont.h"
+#include "infrastructure/eidregister.h"
 #include "types/translatablestring.h"
 #include "types/typesconv.h"
 
@@ -157,6 +160,7 @@ Score::Score(const modularity::ContextPtr& iocCtx)
 
     Score::validScores.insert(this);
     m_masterScore = nullptr;
+    m_eidRegister = new EIDRegister();
 
     m_engravingFont = engravingFonts()->fontByName("Leland");
 
@@ -240,6 +244,10 @@ Score::~Score()
 {
     Score::validScores.erase(this);
 
+    //! NOTE Deleted first, so the elements deleted below don't unregister one by one
+    delete m_eidRegister;
+    m_eidRegister = nullptr;
+
     for (MuseScoreView* v : m_viewer) {
         v->removeScore();
     }
@@ -277,6 +285,20 @@ Score::~Score()
     m_rootItem = nullptr;
 }
 
+//---------------------------------------------------------
+//   objectByEID
+//---------------------------------------------------------
+
+EngravingObject* Score::objectByEID(const EID& eid) const
+{
+    return m_eidRegister ? m_eidRegister->object(eid) : nullptr;
+}
+
+std::vector<EngravingObject*> Score::objectsByEIDs(const std::vector<EID>& eids) const
+{
+    return m_eidRegister ? m_eidRegister->objects(eids) : std::vector<EngravingObject*>(eids.size(), nullptr);
+}
+
 muse::async::Channel<LoopBoundaryType, unsigned> Score::loopBoundaryTickChanged() const
 {
     return m_loopBoundaryTickChanged;
@@ -862,6 +884,68 @@ void Score::setIsOpen(bool open)
     m_isOpen = open;
 }
 
+bool Score::isLayoutDeferred() const
+{
+    return m_layoutDeferred;
+}
+
+void Score::setLayoutDeferred(bool deferred)
+{
+    m_layoutDeferred = deferred;
+}
+
+bool Score::isLayoutPending() const
+{
+    return m_pendingLayoutStart != Fraction(-1, 1);
+}
+
+void Score::addPendingLayoutRange(const Fraction& st, const Fraction& et)
+{
+    //! NOTE An end tick of -1 means "up to the end of the score", see doLayout()
+    static const Fraction TO_END = Fraction(-1, 1);
+
+    if (!isLayoutPending()) {
+        m_pendingLayoutStart = st;
+        m_pendingLayoutEnd = et;
+        return;
+    }
+
+    m_pendingLayoutStart = std::min(m_pendingLayoutStart, st);
+
+    if (m_pendingLayoutEnd != TO_END) {
+        m_pendingLayoutEnd = (et == TO_END) ? TO_END : std::max(m_pendingLayoutEnd, et);
+    }
+}
+
+void Score::doPendingLayout()
+{
+    if (!isLayoutPending()) {
+        return;
+    }
+
+    //! NOTE Laying out in the middle of a command would see half-applied edits
+    if (undoStack()->hasActiveCommand()) {
+        return;
+    }
+
+    const Fraction start = m_pendingLayoutStart;
+    const Fraction end = m_pendingLayoutEnd;
+    m_pendingLayoutStart = Fraction(-1, 1);
+    m_pendingLayoutEnd = Fraction(-1, 1);
+
+    doLayoutRange(start, end);
+}
+
+void Score::doLayoutOrPostpone()
+{
+    if (m_layoutDeferred) {
+        addPendingLayoutRange(Fraction(0, 1), Fraction(-1, 1));
+        return;
+    }
+
+    doLayout();
+}
+
 //---------------------------------------------------------
 //   spell
 //---------------------------------------------------------
@@ -1822,10 +1906,16 @@ bool Score::containsElement(const EngravingItem* element) const
         return false;
     }
 
-    std::vector<EngravingItem*> elements;
-    parent->scanElements(&elements, collectElements, false /*all*/);
+    ElementTypeMask types;
+    types.set(static_cast<size_t>(element->type()));
 
-    return std::find(elements.cbegin(), elements.cend(), element) != elements.cend();
+    bool found = false;
+    parent->visitItems(types, [element, &found](EngravingItem* item) {
+        found = item == element;
+        return !found;
+    }, false /*all*/);
+
+    return found;
 }
 
 //---------------------------------------------------------
@@ -1895,16 +1985,26 @@ MeasureBase* Score::measure(int idx) const
 
 Measure* Score::crMeasure(int idx) const
 {
-    int i = -1;
-    for (MeasureBase* mb = m_measures.first(); mb; mb = mb->next()) {
-        if (mb->isMeasure()) {
-            ++i;
-        }
-        if (i == idx) {
-            return toMeasure(mb);
+    if (idx < 0) {
+        return nullptr;
+    }
+
+    //! NOTE The tick index holds the measures in list order, which is all we need here,
+    //! so it only has to be rebuilt when measures were added or removed
+    {
+        std::shared_lock lock(m_measureTickIndexMutex);
+        if (m_measureTickIndex.version == m_measures.version()) {
+            const auto& measures = m_measureTickIndex.measures;
+            return size_t(idx) < measures.size() ? measures.at(idx).second : nullptr;
         }
     }
-    return nullptr;
+
+    std::unique_lock lock(m_measureTickIndexMutex);
+    if (m_measureTickIndex.version != m_measures.version()) {
+        updateMeasureTickIndex();
+    }
+    const auto& measures = m_measureTickIndex.measures;
+    return size_t(idx) < measures.size() ? measures.at(idx).second : nullptr;
 }
 
 //---------------------------------------------------------
@@ -3050,6 +3150,9 @@ void Score::cmdConcertPitchChanged(bool flag)
 
     undoChangeStyleVal(Sid::concertPitch, flag);         // change style flag
 
+    std::vector<bool> transposedStaves(m_staves.size(), false);
+    bool hasTransposedStaves = false;
+
     for (Staff* staff : m_staves) {
         if (staff->staffType(Fraction(0, 1))->group() == StaffGroup::PERCUSSION) {         // TODO
             continue;
@@ -3059,39 +3162,42 @@ void Score::cmdConcertPitchChanged(bool flag)
         if (interval.isZero() && staff->part()->instruments().size() == 1) {
             continue;
         }
-        if (!flag) {
-            interval.flip();
-        }
-
-        staff_idx_t staffIdx   = staff->idx();
-        track_idx_t startTrack = staffIdx * VOICES;
-        track_idx_t endTrack   = startTrack + VOICES;
 
+        staff_idx_t staffIdx = staff->idx();
         transposeKeys(staffIdx, staffIdx + 1, Fraction(0, 1), lastSegment()->tick(), !flag);
 
-        for (Segment* segment = firstSegment(SegmentType::ChordRest); segment; segment = segment->next1(SegmentType::ChordRest)) {
-            interval = staff->transpose(segment->tick());
+        transposedStaves[staffIdx] = true;
+        hasTransposedStaves = true;
+    }
+
+    if (!hasTransposedStaves) {
+        return;
+    }
+
+    //! NOTE One pass over the segments for the chord symbols of all staves,
+    //! the interval is only looked up where there is something to transpose
+    for (Segment* segment = firstSegment(SegmentType::ChordRest); segment; segment = segment->next1(SegmentType::ChordRest)) {
+        for (EngravingItem* e : segment->annotations()) {
+            if (!e->isHarmony() || !transposedStaves[e->staffIdx()]) {
+                continue;
+            }
+            Interval interval = e->staff()->transpose(segment->tick());
             if (!flag) {
                 interval.flip();
             }
-            for (EngravingItem* e : segment->annotations()) {
-                if (!e->isHarmony() || (e->track() < startTrack) || (e->track() >= endTrack)) {
-                    continue;
+            Harmony* h  = toHarmony(e);
+            int rootTpc = transposeTpc(h->rootTpc(), interval, true);
+            int baseTpc = transposeTpc(h->baseTpc(), interval, true);
+            for (EngravingObject* se : h->linkList()) {
+                // don't transpose all links
+                // just ones resulting from mmrests
+                Harmony* he = toHarmony(se);              // toHarmony() does not work as e is an ScoreElement
+                if (he->staff() == h->staff()) {
+                    undoTransposeHarmony(he, rootTpc, baseTpc);
                 }
-                Harmony* h  = toHarmony(e);
-                int rootTpc = transposeTpc(h->rootTpc(), interval, true);
-                int baseTpc = transposeTpc(h->baseTpc(), interval, true);
-                for (EngravingObject* se : h->linkList()) {
-                    // don't transpose all links
-                    // just ones resulting from mmrests
-                    Harmony* he = toHarmony(se);              // toHarmony() does not work as e is an ScoreElement
-                    if (he->staff() == h->staff()) {
-                        undoTransposeHarmony(he, rootTpc, baseTpc);
-                    }
-                }
-                //realized harmony should be invalid after a transpose command
-                assert(!h->realizedHarmony().valid());
             }
+            //realized harmony should be invalid after a transpose command
+            assert(!h->realizedHarmony().valid());
         }
     }
 }
@@ -3452,8 +3558,14 @@ void Score::select(EngravingItem* item, SelectType type, staff_idx_t staffIdx)
 
 void Score::select(const std::vector<EngravingItem*>& items, SelectType type, staff_idx_t staffIdx)
 {
-    for (EngravingItem* item : items) {
-        doSelect(item, type, staffIdx);
+    //! NOTE Adding many items one by one is quadratic (see selectAdd), so list additions are done at once
+    if (type == SelectType::ADD && items.size() > 1 && !m_selection.isRange()
+        && std::none_of(items.cbegin(), items.cend(), [](const EngravingItem* item) { return item->isMeasure(); })) {
+        selectAdd(items);
+    } else {
+        for (EngravingItem* item : items) {
+            doSelect(item, type, staffIdx);
+        }
     }
 
     if (!m_selection.elements().empty()) {
@@ -3565,6 +3677,27 @@ void Score::selectAdd(EngravingItem* e)
     m_selection.setState(selState);
 }
 
+void Score::selectAdd(const std::vector<EngravingItem*>& items)
+{
+    std::unordered_set<const EngravingItem*> selected(m_selection.elements().cbegin(), m_selection.elements().cend());
+
+    std::vector<EngravingItem*> added;
+    added.reserve(items.size());
+    for (EngravingItem* e : items) {
+        if (!selected.insert(e).second) {
+            continue;
+        }
+        addRefresh(e->pageBoundingRect());
+        added.push_back(e);
+    }
+
+    if (!added.empty()) {
+        m_selection.add(added);
+        m_selection.setState(SelState::LIST);
+    }
+    setSelectionChanged(true);
+}
+
 //---------------------------------------------------------
 //   selectRange
 //    staffIdx is valid, if element is of type MEASURE
@@ -4093,16 +4226,15 @@ void Score::lassoSelect(const RectF& bbox)
             break;
         }
 
-        std::vector<EngravingItem*> items = page->items(frr);
         std::vector<EngravingItem*> itemsToSelect;
 
-        for (EngravingItem* item : items) {
+        page->forEachItem(frr, [&frr, &itemsToSelect](EngravingItem* item) {
             if (frr.contains(item->pageBoundingRect())) {
                 if (item->type() != ElementType::MEASURE && item->selectable()) {
                     itemsToSelect.push_back(item);
                 }
             }
-        }
+        });
 
         select(itemsToSelect, SelectType::ADD, 0);
     }
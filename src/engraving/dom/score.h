@@ -31,6 +31,8 @@
 #include <set>
 #include <memory>
 #include <optional>
+#include <shared_mutex>
+#include <utility>
 
 #include "global/async/channel.h"
 #include "global/types/ret.h"
@@ -98,6 +100,7 @@ class Bracket;
 class Chord;
 class ChordRest;
 class Clef;
+class EIDRegister;
 class Element;
 class EventsHolder;
 class Excerpt;
@@ -301,6 +304,11 @@ public:
     RootItem* rootItem() const { return m_rootItem; }
     compat::DummyElement* dummy() const { return m_rootItem->dummy(); }
 
+    EIDRegister* eidRegister() const { return m_eidRegister; }
+    EngravingObject* objectByEID(const EID& eid) const;
+    //! NOTE Resolves the EIDs in one call, nullptr for the ones not found
+    std::vector<EngravingObject*> objectsByEIDs(const std::vector<EID>& eids) const;
+
     ShadowNote* shadowNote() const;
 
     muse::async::Channel<LoopBoundaryType, unsigned> loopBoundaryTickChanged() const;
@@ -651,6 +659,15 @@ public:
     bool isOpen() const;
     void setIsOpen(bool open);
 
+    //! NOTE The layout of an open part that is not being viewed can be deferred:
+    //! the ranges edited meanwhile are accumulated and laid out by doPendingLayout()
+    bool isLayoutDeferred() const;
+    void setLayoutDeferred(bool deferred);
+    bool isLayoutPending() const;
+    void addPendingLayoutRange(const Fraction& st, const Fraction& et);
+    void doPendingLayout();
+    void doLayoutOrPostpone();
+
     void spell();
     void spell(staff_idx_t startStaff, staff_idx_t endStaff, Segment* startSegment, Segment* endSegment);
     void spell(Note*);
@@ -856,6 +873,7 @@ public:
     void setShowVBox(bool v) { m_layoutOptions.isShowVBox = v; }
     double noteHeadWidth() const { return m_layoutOptions.noteHeadWidth; }
     void setNoteHeadWidth(double n) { m_layoutOptions.noteHeadWidth = n; }
+    void setParallelChordLayout(bool v) { m_layoutOptions.isParallelChordLayout = v; }
 
     // temporary methods
     bool isLayoutMode(LayoutMode lm) const { return m_layoutOptions.isMode(lm); }
@@ -963,7 +981,14 @@ public:
     Measure* firstTrailingMeasure(ChordRest** cr = nullptr);
     ChordRest* cmdTopStaff(ChordRest* cr = nullptr);
 
-    std::shared_ptr<muse::draw::Pixmap> createThumbnail();
+    //! NOTE The first page in page view mode, recorded at the thumbnail size,
+    //! so it can be rasterized later (and on another thread)
+    struct Thumbnail {
+        muse::draw::DrawDataPtr data;
+        muse::Size size;
+        Color background;
+    };
+    Thumbnail createThumbnail();
     String createRehearsalMarkText(RehearsalMark* current) const;
     String nextRehearsalMarkText(RehearsalMark* previous, RehearsalMark* current) const;
 
@@ -1030,6 +1055,10 @@ private:
 
     static std::set<Score*> validScores;
 
+    bool findMeasureInTickIndex(const Fraction& tick, Measure*& measure) const;
+    bool lookupMeasureTickIndex(const Fraction& tick, Measure*& measure) const;
+    void updateMeasureTickIndex() const;
+
     ScoreChangesRange changesRange() const;
 
     Note* getSelectedNote();
@@ -1050,6 +1079,7 @@ private:
     void doSelect(EngravingItem* e, SelectType type, staff_idx_t staffIdx);
     void selectSingle(EngravingItem* e, staff_idx_t staffIdx);
     void selectAdd(EngravingItem* e);
+    void selectAdd(const std::vector<EngravingItem*>& items);
     void selectRange(EngravingItem* e, staff_idx_t staffIdx);
 
     muse::Ret putNote(const Position&, bool replace);
@@ -1131,6 +1161,9 @@ private:
     int m_mscVersion = Constants::MSC_VERSION;     // version of current loading *.msc file
 
     bool m_isOpen = false;
+    bool m_layoutDeferred = false;
+    Fraction m_pendingLayoutStart = Fraction(-1, 1);
+    Fraction m_pendingLayoutEnd = Fraction(-1, 1);
     bool m_needSetUpTempoMap = true;
 
     std::map<String, String> m_metaTags;
@@ -1143,6 +1176,8 @@ private:
     RootItem* m_rootItem = nullptr;
     LayoutOptions m_layoutOptions;
 
+    EIDRegister* m_eidRegister = nullptr;
+
     muse::async::Channel<EngravingItem*> m_elementDestroyed;
 
     ShadowNote* m_shadowNote = nullptr;
@@ -1155,6 +1190,17 @@ private:
     double m_minimumPaddingUnit = 0.0;
 
     bool m_updatesLocked = false;
+
+    //! NOTE The measures sorted by tick, so that tick2measure is a binary search.
+    //! It is updated when the measures list has changed or the measures ticks are not the same anymore
+    struct MeasureTickIndex {
+        std::vector<std::pair<Fraction, Measure*> > measures;
+        size_t version = muse::nidx;
+        bool isSorted = true;
+    };
+
+    mutable MeasureTickIndex m_measureTickIndex;
+    mutable std::shared_mutex m_measureTickIndexMutex;
 };
 
 static inline Score* toScore(EngravingObject* e)
@@ -25,6 +25,8 @@
 #include "io/file.h"
 #include "io/fileinfo.h"
 
+#include "draw/bufferedpaintprovider.h"
+
 #include "style/style.h"
 
 #include "engravingitem.h"
@@ -69,7 +71,7 @@ void Score::linkMeasures(Score* score)
 //   createThumbnail
 //---------------------------------------------------------
 
-std::shared_ptr<Pixmap> Score::createThumbnail()
+Score::Thumbnail Score::createThumbnail()
 {
     TRACEFUNC;
 
@@ -79,23 +81,24 @@ std::shared_ptr<Pixmap> Score::createThumbnail()
     Page* page = pages().at(0);
     RectF fr = page->pageBoundingRect();
     double mag = 256.0 / std::max(fr.width(), fr.height());
-    int w = int(fr.width() * mag);
-    int h = int(fr.height() * mag);
-
-    int dpm = lrint(DPMM * 1000.0);
 
-    auto pixmap = imageProvider()->createPixmap(w, h, dpm, configuration()->thumbnailBackgroundColor());
+    Thumbnail thumbnail;
+    thumbnail.size = muse::Size(int(fr.width() * mag), int(fr.height() * mag));
+    thumbnail.background = configuration()->thumbnailBackgroundColor();
 
     double pr = MScore::pixelRatio;
     MScore::pixelRatio = 1.0;
 
-    auto painterProvider = imageProvider()->painterForImage(pixmap);
-    Painter p(painterProvider, "thumbnail");
+    auto painterProvider = std::make_shared<BufferedPaintProvider>();
+    {
+        Painter p(painterProvider, "thumbnail");
 
-    p.setAntialiasing(true);
-    p.scale(mag, mag);
-    print(&p, 0);
-    p.endDraw();
+        p.setAntialiasing(true);
+        p.scale(mag, mag);
+        print(&p, 0);
+        p.endDraw();
+    }
+    thumbnail.data = painterProvider->drawData();
 
     MScore::pixelRatio = pr;
 
@@ -103,7 +106,7 @@ std::shared_ptr<Pixmap> Score::createThumbnail()
         setLayoutMode(mode);
         doLayout();
     }
-    return pixmap;
+    return thumbnail;
 }
 
 //---------------------------------------------------------
@@ -21,6 +21,11 @@
  */
 
 #include "segmentlist.h"
+
+#include <algorithm>
+
+#include "containers.h"
+
 #include "segment.h"
 #include "score.h"
 
@@ -29,6 +34,39 @@
 using namespace mu;
 
 namespace mu::engraving {
+//---------------------------------------------------------
+//   segmentTypeIndex
+///   the position of the bit of a single segment type
+//---------------------------------------------------------
+
+static size_t segmentTypeIndex(SegmentType type)
+{
+    const int bits = static_cast<int>(type);
+    if (bits <= 0 || (bits & (bits - 1))) {
+        return muse::nidx;
+    }
+
+    size_t idx = 0;
+    while (!(bits & (1 << idx))) {
+        ++idx;
+    }
+    return idx;
+}
+
+//---------------------------------------------------------
+//   operator=
+///   only the links are copied, the index is built again when needed
+//---------------------------------------------------------
+
+SegmentList& SegmentList::operator=(const SegmentList& l)
+{
+    m_first = l.m_first;
+    m_last = l.m_last;
+    m_size = l.m_size;
+    invalidateIndex();
+    return *this;
+}
+
 //---------------------------------------------------------
 //   clone
 //---------------------------------------------------------
@@ -128,6 +166,7 @@ void SegmentList::check()
 
 void SegmentList::insert(Segment* e, Segment* el)
 {
+    invalidateIndex();
     if (el == 0) {
         push_back(e);
     } else if (el == first()) {
@@ -161,6 +200,7 @@ void SegmentList::remove(Segment* e)
         ASSERT_X(String(u"segment %1 not in list").arg(String::fromAscii(e->subTypeName())));
     }
 #endif
+    invalidateIndex();
     --m_size;
     if (e == m_first) {
         m_first = m_first->next();
@@ -187,6 +227,7 @@ void SegmentList::remove(Segment* e)
 
 void SegmentList::push_back(Segment* e)
 {
+    invalidateIndex();
     ++m_size;
     e->setNext(0);
     if (m_last) {
@@ -205,6 +246,7 @@ void SegmentList::push_back(Segment* e)
 
 void SegmentList::push_front(Segment* e)
 {
+    invalidateIndex();
     ++m_size;
     e->setPrev(0);
     if (m_first) {
@@ -267,4 +309,128 @@ Segment* SegmentList::last(ElementFlag flags) const
     }
     return nullptr;
 }
+
+//---------------------------------------------------------
+//   ensureIndex
+//---------------------------------------------------------
+
+void SegmentList::ensureIndex() const
+{
+    if (m_indexState.load(std::memory_order_acquire) == IndexState::Valid) {
+        return;
+    }
+
+    std::lock_guard lock(m_indexMutex);
+    if (m_indexState.load(std::memory_order_acquire) == IndexState::Valid) {
+        return;
+    }
+
+    m_typeOffsets.fill(0);
+    for (const Segment* s = m_first; s; s = s->next()) {
+        size_t idx = segmentTypeIndex(s->segmentType());
+        if (idx < SEGMENT_TYPES_COUNT) {
+            ++m_typeOffsets[idx + 1];
+        }
+    }
+    for (size_t i = 1; i < m_typeOffsets.size(); ++i) {
+        m_typeOffsets[i] += m_typeOffsets[i - 1];
+    }
+
+    m_index.resize(m_typeOffsets.back());
+    std::array<size_t, SEGMENT_TYPES_COUNT> next;
+    std::copy_n(m_typeOffsets.cbegin(), SEGMENT_TYPES_COUNT, next.begin());
+
+    int pos = 0;
+    for (Segment* s = m_first; s; s = s->next(), ++pos) {
+        size_t idx = segmentTypeIndex(s->segmentType());
+        if (idx < SEGMENT_TYPES_COUNT) {
+            m_index[next[idx]++] = { s, pos };
+        }
+    }
+
+    m_indexState.store(IndexState::Valid, std::memory_order_release);
+}
+
+//---------------------------------------------------------
+//   indexed
+///   return true if the typed lookups should go through the index.
+///   The first lookup after a change of the list returns false
+//---------------------------------------------------------
+
+bool SegmentList::indexed() const
+{
+    IndexState state = m_indexState.load(std::memory_order_acquire);
+    if (state == IndexState::Valid) {
+        return true;
+    }
+
+    if (state == IndexState::Dirty) {
+        m_indexState.compare_exchange_strong(state, IndexState::Requested, std::memory_order_relaxed);
+        return false;
+    }
+
+    ensureIndex();
+    return true;
+}
+
+//---------------------------------------------------------
+//   findR
+///   the first segment of one of the types at rtick
+//---------------------------------------------------------
+
+Segment* SegmentList::findR(SegmentType types, const Fraction& rtick) const
+{
+    ensureIndex();
+
+    const IndexEntry* found = nullptr;
+    for (size_t i = 0; i < SEGMENT_TYPES_COUNT; ++i) {
+        if (!(static_cast<int>(types) & (1 << i))) {
+            continue;
+        }
+        const IndexEntry* it = std::lower_bound(typeBegin(i), typeEnd(i), rtick, [](const IndexEntry& e, const Fraction& t) {
+            return e.segment->rtick() < t;
+        });
+        if (it != typeEnd(i) && it->segment->rtick() == rtick && (!found || it->pos < found->pos)) {
+            found = it;
+        }
+    }
+    return found ? found->segment : nullptr;
+}
+
+//---------------------------------------------------------
+//   findFirstR
+///   the first segment of one of the types, if it is not after rtick
+//---------------------------------------------------------
+
+Segment* SegmentList::findFirstR(SegmentType types, const Fraction& rtick) const
+{
+    ensureIndex();
+
+    const IndexEntry* found = nullptr;
+    for (size_t i = 0; i < SEGMENT_TYPES_COUNT; ++i) {
+        if (!(static_cast<int>(types) & (1 << i)) || typeBegin(i) == typeEnd(i)) {
+            continue;
+        }
+        if (!found || typeBegin(i)->pos < found->pos) {
+            found = typeBegin(i);
+        }
+    }
+    return found && found->segment->rtick() <= rtick ? found->segment : nullptr;
+}
+
+//---------------------------------------------------------
+//   segments
+///   the segments of a single type, in list order
+//---------------------------------------------------------
+
+SegmentList::typed_range SegmentList::segments(SegmentType type) const
+{
+    size_t idx = segmentTypeIndex(type);
+    IF_ASSERT_FAILED(idx < SEGMENT_TYPES_COUNT) {
+        return typed_range(nullptr, nullptr);
+    }
+
+    ensureIndex();
+    return typed_range(typeBegin(idx), typeEnd(idx));
+}
 }
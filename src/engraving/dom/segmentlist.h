@@ -23,6 +23,11 @@
 #ifndef MU_ENGRAVING_SEGMENTLIST_H
 #define MU_ENGRAVING_SEGMENTLIST_H
 
+#include <array>
+#include <atomic>
+#include <mutex>
+#include <vector>
+
 #include "segment.h"
 
 namespace mu::engraving {
@@ -36,7 +41,9 @@ class SegmentList
 {
 public:
     SegmentList() { clear(); }
-    void clear() { m_first = m_last = 0; m_size = 0; }
+    SegmentList(const SegmentList& l) { *this = l; }
+    SegmentList& operator=(const SegmentList& l);
+    void clear() { m_first = m_last = 0; m_size = 0; invalidateIndex(); }
 #ifndef NDEBUG
     void check();
 #else
@@ -58,6 +65,14 @@ public:
     void push_front(Segment*);
     void insert(Segment* e, Segment* el);    // insert e before el
 
+    class typed_range;
+
+    // typed lookups through the index, the segments are assumed to be sorted by rtick
+    bool indexed() const;
+    Segment* findR(SegmentType types, const Fraction& rtick) const;
+    Segment* findFirstR(SegmentType types, const Fraction& rtick) const;
+    typed_range segments(SegmentType type) const;
+
     class iterator
     {
         Segment* p;
@@ -82,7 +97,54 @@ public:
     const_iterator begin() const { return m_first; }
     const_iterator end() const { return 0; }
 
+    struct IndexEntry {
+        Segment* segment = nullptr;
+        int pos = 0;                       // position in the list
+    };
+
+    class typed_range
+    {
+        const IndexEntry* b;
+        const IndexEntry* e;
+    public:
+        class iterator
+        {
+            const IndexEntry* p;
+        public:
+            iterator(const IndexEntry* e) { p = e; }
+            iterator& operator++() { ++p; return *this; }
+            bool operator !=(const iterator& i) const { return p != i.p; }
+            Segment* operator*() const { return p->segment; }
+        };
+
+        typed_range(const IndexEntry* begin, const IndexEntry* end) { b = begin; e = end; }
+        iterator begin() const { return b; }
+        iterator end() const { return e; }
+        bool empty() const { return b == e; }
+        size_t size() const { return e - b; }
+    };
+
 private:
+    //! NOTE The segments grouped by type, in list order inside each group.
+    //! It is dropped whenever the list changes and built again on the second typed lookup
+    //! after the change, so that lookups done while the list is being filled keep scanning the list
+    enum class IndexState : unsigned char {
+        Dirty,
+        Requested,
+        Valid
+    };
+
+    static constexpr size_t SEGMENT_TYPES_COUNT = 14;
+
+    void invalidateIndex() { m_indexState.store(IndexState::Dirty, std::memory_order_relaxed); }
+    void ensureIndex() const;
+    const IndexEntry* typeBegin(size_t typeIdx) const { return m_index.data() + m_typeOffsets[typeIdx]; }
+    const IndexEntry* typeEnd(size_t typeIdx) const { return m_index.data() + m_typeOffsets[typeIdx + 1]; }
+
+    mutable std::vector<IndexEntry> m_index;
+    mutable std::array<size_t, SEGMENT_TYPES_COUNT + 1> m_typeOffsets = {};
+    mutable std::atomic<IndexState> m_indexState = IndexState::Dirty;
+    mutable std::mutex m_indexMutex;
 
     Segment* m_first = nullptr;          // First item of segment list
     Segment* m_last = nullptr;           // Last item of segment list
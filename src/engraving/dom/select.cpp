@@ -469,6 +469,22 @@ void Selection::add(EngravingItem* el)
     update();
 }
 
+void Selection::add(const std::vector<EngravingItem*>& items)
+{
+    IF_ASSERT_FAILED(!isLocked()) {
+        LOGE() << "selection locked, reason: " << lockReason();
+        return;
+    }
+    for (EngravingItem* el : items) {
+        m_el.push_back(el);
+        // the current tick and track follow the first element, as when adding one by one
+        if (m_el.size() == 1) {
+            update();
+        }
+    }
+    update();
+}
+
 void Selection::appendFiltered(EngravingItem* e)
 {
     IF_ASSERT_FAILED(!isLocked()) {
@@ -486,7 +502,7 @@ void Selection::appendChord(Chord* chord)
         LOGE() << "selection locked, reason: " << lockReason();
         return;
     }
-    if (chord->beam() && !muse::contains(m_el, static_cast<EngravingItem*>(chord->beam()))) {
+    if (chord->beam() && m_appendedSharedItems.insert(chord->beam()).second) {
         m_el.push_back(chord->beam());
     }
     if (chord->stem()) {
@@ -551,7 +567,7 @@ void Selection::appendChord(Chord* chord)
 
 void Selection::appendTupletHierarchy(Tuplet* innermostTuplet)
 {
-    if (muse::contains(m_el, static_cast<EngravingItem*>(innermostTuplet))) {
+    if (!m_appendedSharedItems.insert(innermostTuplet).second) {
         return;
     }
 
@@ -646,18 +662,48 @@ void Selection::updateSelectedElements()
     track_idx_t startTrack = m_staffStart * VOICES;
     track_idx_t endTrack   = m_staffEnd * VOICES;
 
+    m_appendedSharedItems.clear();
+
+    // Walk the range once and index its items per track, in segment order:
+    // they are appended track by track, but each segment is visited only once
+    struct RangeItem {
+        EngravingItem* item = nullptr;
+        bool annotation = false;
+    };
+
+    std::vector<std::vector<RangeItem> > trackItems(endTrack - startTrack);
+    std::vector<bool> selectableTracks(endTrack - startTrack);
     for (track_idx_t st = startTrack; st < endTrack; ++st) {
-        if (!canSelectVoice(st)) {
+        selectableTracks[st - startTrack] = canSelectVoice(st);
+    }
+
+    for (Segment* s = m_startSegment; s && (s != m_endSegment); s = s->next1MM()) {
+        if (!s->enabled() || s->isEndBarLineType()) {      // do not select end bar line
             continue;
         }
-        for (Segment* s = m_startSegment; s && (s != m_endSegment); s = s->next1MM()) {
-            if (!s->enabled() || s->isEndBarLineType()) {      // do not select end bar line
+        for (EngravingItem* e : s->annotations()) {
+            const track_idx_t st = e->track();
+            if (st < startTrack || st >= endTrack || !selectableTracks[st - startTrack]) {
                 continue;
             }
-            for (EngravingItem* e : s->annotations()) {
-                if (e->track() != st) {
-                    continue;
-                }
+            trackItems[st - startTrack].push_back({ e, true });
+        }
+        for (track_idx_t st = startTrack; st < endTrack; ++st) {
+            if (!selectableTracks[st - startTrack]) {
+                continue;
+            }
+            EngravingItem* e = s->element(st);
+            if (!e || e->generated() || e->isTimeSig() || e->isKeySig()) {
+                continue;
+            }
+            trackItems[st - startTrack].push_back({ e, false });
+        }
+    }
+
+    for (const std::vector<RangeItem>& items : trackItems) {
+        for (const RangeItem& rangeItem : items) {
+            EngravingItem* e = rangeItem.item;
+            if (rangeItem.annotation) {
                 if (e->isFretDiagram()) {
                     FretDiagram* fd = toFretDiagram(e);
                     if (Harmony* harm = fd->harmony()) {
@@ -665,9 +711,6 @@ void Selection::updateSelectedElements()
                     }
                 }
                 appendFiltered(e);
-            }
-            EngravingItem* e = s->element(st);
-            if (!e || e->generated() || e->isTimeSig() || e->isKeySig()) {
                 continue;
             }
             if (e->isChordRest()) {
@@ -707,8 +750,12 @@ void Selection::updateSelectedElements()
     Fraction stick = tickStart();
     Fraction etick = tickEnd();
 
-    for (auto i = m_score->spanner().begin(); i != m_score->spanner().end(); ++i) {
-        Spanner* sp = (*i).second;
+    // all the spanners with the start or the end in the range overlap it
+    SpannerMap::IntervalList spanners;
+    m_score->spannerMap().findOverlapping(stick.ticks(), etick.ticks() - 1, spanners);
+
+    for (const auto& interval : spanners) {
+        Spanner* sp = interval.value;
         // ignore spanners belonging to other tracks
         if (sp->track() < startTrack || sp->track() >= endTrack) {
             continue;
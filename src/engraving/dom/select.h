@@ -23,6 +23,8 @@
 #ifndef MU_ENGRAVING_SELECT_H
 #define MU_ENGRAVING_SELECT_H
 
+#include <unordered_set>
+
 #include "durationtype.h"
 #include "mscore.h"
 #include "pitchspelling.h"
@@ -176,6 +178,7 @@ public:
     bool isSingle() const { return (m_state == SelState::LIST) && (m_el.size() == 1); }
 
     void add(EngravingItem*);
+    void add(const std::vector<EngravingItem*>& items);
     void deselectAll();
     void remove(EngravingItem*);
     void clear();
@@ -232,6 +235,7 @@ private:
     Score* m_score = nullptr;
     SelState m_state = SelState::NONE;
     std::vector<EngravingItem*> m_el;            // valid in mode SelState::LIST
+    std::unordered_set<const EngravingItem*> m_appendedSharedItems; // beams and tuplets already appended by updateSelectedElements()
 
     staff_idx_t m_staffStart = 0;            // valid if selState is SelState::RANGE
     staff_idx_t m_staffEnd = 0;
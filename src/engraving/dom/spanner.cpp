@@ -1364,7 +1364,7 @@ void Spanner::setTick(const Fraction& v)
     Score* score = this->score();
 
     if (score) {
-        score->spannerMap().setDirty();
+        score->spannerMap().updateSpanner(this);
     }
 }
 
@@ -1392,7 +1392,7 @@ void Spanner::setTicks(const Fraction& f)
     Score* score = this->score();
 
     if (score) {
-        score->spannerMap().setDirty();
+        score->spannerMap().updateSpanner(this);
     }
 }
 
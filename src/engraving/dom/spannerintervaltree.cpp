@@ -0,0 +1,326 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-Studio-CLA-applies
+ *
+ * MuseScore Studio
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2024 MuseScore Limited
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "spannerintervaltree.h"
+
+#include <algorithm>
+
+using namespace mu;
+using namespace mu::engraving;
+
+//---------------------------------------------------------
+//   clear
+//---------------------------------------------------------
+
+void SpannerIntervalTree::clear()
+{
+    m_nodes.clear();
+    m_freeNodes.clear();
+    m_root = -1;
+    m_nodeOf.clear();
+}
+
+//---------------------------------------------------------
+//   insert
+//---------------------------------------------------------
+
+void SpannerIntervalTree::insert(const Interval& interval, size_t order)
+{
+    const int idx = allocNode();
+
+    Node& node = m_nodes[idx];
+    node.start = interval.start;
+    node.stop = interval.stop;
+    node.maxStop = interval.stop;
+    node.order = order;
+    node.value = interval.value;
+
+    m_nodeOf[interval.value] = idx;
+    m_root = insertNode(m_root, idx);
+}
+
+//---------------------------------------------------------
+//   remove
+//---------------------------------------------------------
+
+bool SpannerIntervalTree::remove(const Spanner* s)
+{
+    auto it = m_nodeOf.find(s);
+    if (it == m_nodeOf.end()) {
+        return false;
+    }
+
+    const Node& node = m_nodes[it->second];
+    const int start = node.start;
+    const size_t order = node.order;
+
+    m_nodeOf.erase(it);
+    m_root = removeNode(m_root, start, order);
+    return true;
+}
+
+//---------------------------------------------------------
+//   update
+//---------------------------------------------------------
+
+bool SpannerIntervalTree::update(const Spanner* s, int start, int stop)
+{
+    auto it = m_nodeOf.find(s);
+    if (it == m_nodeOf.end()) {
+        return false;
+    }
+
+    Node& node = m_nodes[it->second];
+    const Interval interval(start, stop, node.value);
+    if (node.start == interval.start && node.stop == interval.stop) {
+        return true;
+    }
+
+    const size_t order = node.order;
+    remove(s);
+    insert(interval, order);
+    return true;
+}
+
+//---------------------------------------------------------
+//   findOverlapping
+//---------------------------------------------------------
+
+void SpannerIntervalTree::findOverlapping(int start, int stop, IntervalList& result) const
+{
+    findOverlapping(m_root, start, stop, result);
+}
+
+void SpannerIntervalTree::findOverlapping(int n, int start, int stop, IntervalList& result) const
+{
+    if (n < 0) {
+        return;
+    }
+
+    const Node& node = m_nodes[n];
+    if (node.maxStop < start) {
+        return;
+    }
+
+    findOverlapping(node.left, start, stop, result);
+
+    // the right subtree starts after this node
+    if (node.start > stop) {
+        return;
+    }
+
+    if (node.stop >= start) {
+        result.emplace_back(node.start, node.stop, node.value);
+    }
+
+    findOverlapping(node.right, start, stop, result);
+}
+
+//---------------------------------------------------------
+//   findContained
+//---------------------------------------------------------
+
+void SpannerIntervalTree::findContained(int start, int stop, IntervalList& result) const
+{
+    findContained(m_root, start, stop, result);
+}
+
+void SpannerIntervalTree::findContained(int n, int start, int stop, IntervalList& result) const
+{
+    if (n < 0) {
+        return;
+    }
+
+    const Node& node = m_nodes[n];
+    if (node.maxStop < start) {
+        return;
+    }
+
+    // the left subtree starts before this node
+    if (node.start >= start) {
+        findContained(node.left, start, stop, result);
+    }
+
+    if (node.start > stop) {
+        return;
+    }
+
+    if (node.start >= start && node.stop <= stop) {
+        result.emplace_back(node.start, node.stop, node.value);
+    }
+
+    findContained(node.right, start, stop, result);
+}
+
+//---------------------------------------------------------
+//   allocNode
+//---------------------------------------------------------
+
+int SpannerIntervalTree::allocNode()
+{
+    if (!m_freeNodes.empty()) {
+        int idx = m_freeNodes.back();
+        m_freeNodes.pop_back();
+        m_nodes[idx] = Node();
+        return idx;
+    }
+
+    m_nodes.emplace_back();
+    return static_cast<int>(m_nodes.size()) - 1;
+}
+
+void SpannerIntervalTree::freeNode(int n)
+{
+    m_nodes[n].value = nullptr;
+    m_freeNodes.push_back(n);
+}
+
+//---------------------------------------------------------
+//   balancing
+//---------------------------------------------------------
+
+void SpannerIntervalTree::updateNode(int n)
+{
+    Node& node = m_nodes[n];
+    node.height = 1 + std::max(height(node.left), height(node.right));
+    node.maxStop = node.stop;
+    if (node.left >= 0) {
+        node.maxStop = std::max(node.maxStop, m_nodes[node.left].maxStop);
+    }
+    if (node.right >= 0) {
+        node.maxStop = std::max(node.maxStop, m_nodes[node.right].maxStop);
+    }
+}
+
+int SpannerIntervalTree::rotateLeft(int n)
+{
+    const int r = m_nodes[n].right;
+    m_nodes[n].right = m_nodes[r].left;
+    m_nodes[r].left = n;
+    updateNode(n);
+    updateNode(r);
+    return r;
+}
+
+int SpannerIntervalTree::rotateRight(int n)
+{
+    const int l = m_nodes[n].left;
+    m_nodes[n].left = m_nodes[l].right;
+    m_nodes[l].right = n;
+    updateNode(n);
+    updateNode(l);
+    return l;
+}
+
+int SpannerIntervalTree::rebalance(int n)
+{
+    updateNode(n);
+
+    const Node& node = m_nodes[n];
+    const int balance = height(node.left) - height(node.right);
+    if (balance > 1) {
+        const Node& left = m_nodes[node.left];
+        if (height(left.left) < height(left.right)) {
+            m_nodes[n].left = rotateLeft(node.left);
+        }
+        return rotateRight(n);
+    }
+    if (balance < -1) {
+        const Node& right = m_nodes[node.right];
+        if (height(right.right) < height(right.left)) {
+            m_nodes[n].right = rotateRight(node.right);
+        }
+        return rotateLeft(n);
+    }
+    return n;
+}
+
+//---------------------------------------------------------
+//   insertNode
+//    returns the new root of the subtree
+//---------------------------------------------------------
+
+int SpannerIntervalTree::insertNode(int n, int idx)
+{
+    if (n < 0) {
+        return idx;
+    }
+
+    const Node& node = m_nodes[idx];
+    if (less(node.start, node.order, m_nodes[n])) {
+        const int left = insertNode(m_nodes[n].left, idx);
+        m_nodes[n].left = left;
+    } else {
+        const int right = insertNode(m_nodes[n].right, idx);
+        m_nodes[n].right = right;
+    }
+    return rebalance(n);
+}
+
+//---------------------------------------------------------
+//   removeNode
+//    returns the new root of the subtree
+//---------------------------------------------------------
+
+int SpannerIntervalTree::removeNode(int n, int start, size_t order)
+{
+    if (n < 0) {
+        return -1;
+    }
+
+    Node& node = m_nodes[n];
+    if (less(start, order, node)) {
+        const int left = removeNode(node.left, start, order);
+        m_nodes[n].left = left;
+    } else if (start != node.start || order != node.order) {
+        const int right = removeNode(node.right, start, order);
+        m_nodes[n].right = right;
+    } else {
+        const int left = node.left;
+        const int right = node.right;
+        freeNode(n);
+        if (right < 0) {
+            return left;
+        }
+
+        // the smallest node of the right subtree takes the place of the removed one
+        int min = -1;
+        const int newRight = removeMin(right, min);
+        m_nodes[min].left = left;
+        m_nodes[min].right = newRight;
+        return rebalance(min);
+    }
+
+    return rebalance(n);
+}
+
+int SpannerIntervalTree::removeMin(int n, int& min)
+{
+    if (m_nodes[n].left < 0) {
+        min = n;
+        return m_nodes[n].right;
+    }
+
+    const int left = removeMin(m_nodes[n].left, min);
+    m_nodes[n].left = left;
+    return rebalance(n);
+}
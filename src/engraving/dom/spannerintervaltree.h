@@ -0,0 +1,101 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-Studio-CLA-applies
+ *
+ * MuseScore Studio
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2024 MuseScore Limited
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef MU_ENGRAVING_SPANNERINTERVALTREE_H
+#define MU_ENGRAVING_SPANNERINTERVALTREE_H
+
+#include <unordered_map>
+#include <vector>
+
+#include "thirdparty/intervaltree/IntervalTree.h"
+
+namespace mu::engraving {
+class Spanner;
+
+//---------------------------------------------------------
+//   SpannerIntervalTree
+//    balanced (AVL) interval tree of spanners, which can be
+//    changed without being built again.
+//    Intervals are ordered by start, then by the order given
+//    on insert, and the queries return them in that order
+//---------------------------------------------------------
+
+class SpannerIntervalTree
+{
+public:
+    using Interval = interval_tree::Interval<Spanner*>;
+    using IntervalList = std::vector<Interval>;
+
+    void clear();
+    size_t size() const { return m_nodeOf.size(); }
+    bool empty() const { return m_nodeOf.empty(); }
+    bool contains(const Spanner* s) const { return m_nodeOf.find(s) != m_nodeOf.end(); }
+
+    void insert(const Interval& interval, size_t order);
+    bool remove(const Spanner* s);
+    bool update(const Spanner* s, int start, int stop);     // change the endpoints, keeping the order
+
+    // the results are appended to the list
+    void findOverlapping(int start, int stop, IntervalList& result) const;
+    void findContained(int start, int stop, IntervalList& result) const;
+
+private:
+    struct Node {
+        int start = 0;
+        int stop = 0;
+        int maxStop = 0;                // max stop of the subtree
+        size_t order = 0;
+        Spanner* value = nullptr;
+        int left = -1;
+        int right = -1;
+        int height = 1;
+    };
+
+    int allocNode();
+    void freeNode(int n);
+
+    bool less(int start, size_t order, const Node& node) const
+    {
+        return start < node.start || (start == node.start && order < node.order);
+    }
+
+    int height(int n) const { return n < 0 ? 0 : m_nodes[n].height; }
+    void updateNode(int n);
+    int rotateLeft(int n);
+    int rotateRight(int n);
+    int rebalance(int n);
+
+    int insertNode(int n, int idx);
+    int removeNode(int n, int start, size_t order);
+    int removeMin(int n, int& min);
+
+    void findOverlapping(int n, int start, int stop, IntervalList& result) const;
+    void findContained(int n, int start, int stop, IntervalList& result) const;
+
+    std::vector<Node> m_nodes;
+    std::vector<int> m_freeNodes;
+    int m_root = -1;
+    std::unordered_map<const Spanner*, int> m_nodeOf;
+};
+} // namespace mu::engraving
+
+#endif
@@ -41,19 +41,62 @@ SpannerMap::SpannerMap()
 
 //---------------------------------------------------------
 //   update
-//   updates the internal lookup tree, not the map itself
+//   updates the internal lookup trees, not the map itself
 //---------------------------------------------------------
 
 void SpannerMap::update() const
 {
+    updateTree();
+    updateCollisionFreeTree();
+}
+
+void SpannerMap::updateTree() const
+{
+    if (!m_dirty) {
+        return;
+    }
+
+    m_tree.clear();
+    m_nextOrder = 0;
+    for (const auto& pair : *this) {
+        Spanner* spanner = pair.second;
+        m_tree.insert(Interval(spanner->tick().ticks(), spanner->tick2().ticks(), spanner), m_nextOrder++);
+    }
+
+    m_dirty = false;
+    m_collisionFreeDirty = true;
+}
+
+void SpannerMap::updateCollisionFreeTree() const
+{
+    updateTree();
+
+    if (!m_collisionFreeDirty) {
+        return;
+    }
+
     IntervalList regularIntervals;
     IntervalList collisionFreeIntervals;
 
     collectIntervals(regularIntervals, collisionFreeIntervals);
 
-    m_tree = interval_tree::IntervalTree<Spanner*>(std::move(regularIntervals));
-    m_collisionFreeTree = interval_tree::IntervalTree<Spanner*>(std::move(collisionFreeIntervals));
-    m_dirty = false;
+    m_collisionFreeTree.clear();
+    for (size_t i = 0; i < collisionFreeIntervals.size(); ++i) {
+        m_collisionFreeTree.insert(collisionFreeIntervals[i], i);
+    }
+
+    m_collisionFreeDirty = false;
+}
+
+const SpannerIntervalTree& SpannerMap::tree(bool excludeCollisions) const
+{
+    if (excludeCollisions) {
+        updateCollisionFreeTree();
+        return m_collisionFreeTree;
+    }
+
+    updateTree();
+    return m_tree;
 }
 
 //---------------------------------------------------------
@@ -62,18 +105,8 @@ void SpannerMap::update() const
 
 const SpannerMap::IntervalList& SpannerMap::findContained(int start, int stop, bool excludeCollisions) const
 {
-    if (m_dirty) {
-        update();
-    }
-
     m_results.clear();
-
-    if (excludeCollisions) {
-        m_results = m_collisionFreeTree.findContained(start, stop);
-    } else {
-        m_results = m_tree.findContained(start, stop);
-    }
-
+    tree(excludeCollisions).findContained(start, stop, m_results);
     return m_results;
 }
 
@@ -83,19 +116,26 @@ const SpannerMap::IntervalList& SpannerMap::findContained(int start, int stop, b
 
 const SpannerMap::IntervalList& SpannerMap::findOverlapping(int start, int stop, bool excludeCollisions) const
 {
-    if (m_dirty) {
-        update();
-    }
-
     m_results.clear();
+    tree(excludeCollisions).findOverlapping(start, stop, m_results);
+    return m_results;
+}
 
-    if (excludeCollisions) {
-        m_results = m_collisionFreeTree.findOverlapping(start, stop);
-    } else {
-        m_results = m_tree.findOverlapping(start, stop);
-    }
+void SpannerMap::findOverlapping(int start, int stop, IntervalList& result, bool excludeCollisions) const
+{
+    result.clear();
+    tree(excludeCollisions).findOverlapping(start, stop, result);
+}
 
-    return m_results;
+void SpannerMap::findOverlapping(const std::vector<Range>& ranges, std::vector<IntervalList>& results, bool excludeCollisions) const
+{
+    const SpannerIntervalTree& t = tree(excludeCollisions);
+
+    results.resize(ranges.size());
+    for (size_t i = 0; i < ranges.size(); ++i) {
+        results[i].clear();
+        t.findOverlapping(ranges[i].first, ranges[i].second, results[i]);
+    }
 }
 
 void SpannerMap::collectIntervals(IntervalList& regularIntervals, IntervalList& collisionFreeIntervals) const
@@ -153,7 +193,10 @@ void SpannerMap::collectIntervals(IntervalList& regularIntervals, IntervalList&
 void SpannerMap::addSpanner(Spanner* s)
 {
     insert(std::pair<int, Spanner*>(s->tick().ticks(), s));
-    m_dirty = true;
+    if (!m_dirty) {
+        m_tree.insert(Interval(s->tick().ticks(), s->tick2().ticks(), s), m_nextOrder++);
+    }
+    m_collisionFreeDirty = true;
 }
 
 //---------------------------------------------------------
@@ -165,7 +208,10 @@ bool SpannerMap::removeSpanner(Spanner* s)
     for (auto i = begin(); i != end(); ++i) {
         if (i->second == s) {
             erase(i);
-            m_dirty = true;
+            if (!m_dirty) {
+                m_tree.remove(s);
+            }
+            m_collisionFreeDirty = true;
             return true;
         }
     }
@@ -173,6 +219,21 @@ bool SpannerMap::removeSpanner(Spanner* s)
     return false;
 }
 
+//---------------------------------------------------------
+//   updateSpanner
+//---------------------------------------------------------
+
+void SpannerMap::updateSpanner(const Spanner* s)
+{
+    if (m_dirty) {
+        return;
+    }
+
+    if (m_tree.update(s, s->tick().ticks(), s->tick2().ticks())) {
+        m_collisionFreeDirty = true;
+    }
+}
+
 #ifndef NDEBUG
 //---------------------------------------------------------
 //   dump
@@ -25,7 +25,7 @@
 
 #include <map>
 
-#include "thirdparty/intervaltree/IntervalTree.h"
+#include "spannerintervaltree.h"
 
 namespace mu::engraving {
 class Spanner;
@@ -40,12 +40,20 @@ public:
     typedef typename std::multimap<int, Spanner*>::const_reverse_iterator const_reverse_it;
     typedef typename std::multimap<int, Spanner*>::const_iterator const_it;
 
-    using IntervalList = std::vector<interval_tree::Interval<Spanner*> >;
+    using Interval = SpannerIntervalTree::Interval;
+    using IntervalList = SpannerIntervalTree::IntervalList;
+    using Range = std::pair<int, int>;
 
     SpannerMap();
 
     const IntervalList& findContained(int start, int stop, bool excludeCollisions = false) const;
     const IntervalList& findOverlapping(int start, int stop, bool excludeCollisions = false) const;
+    //! NOTE Doesn't use the shared results list, so can be called from several threads
+    //! at once as long as the map is up to date (see update())
+    void findOverlapping(int start, int stop, IntervalList& result, bool excludeCollisions = false) const;
+    //! NOTE Looks up several ranges at once, results[i] gets the spanners overlapping ranges[i].
+    //! The lists are reused, so their memory is kept between calls
+    void findOverlapping(const std::vector<Range>& ranges, std::vector<IntervalList>& results, bool excludeCollisions = false) const;
     const std::multimap<int, Spanner*>& map() const { return *this; }
 
     void collectIntervals(IntervalList& regularIntervals, IntervalList& collisionFreeIntervals) const;
@@ -56,20 +64,29 @@ public:
     const_it cend() const { return std::multimap<int, Spanner*>::cend(); }
     void addSpanner(Spanner* s);
     bool removeSpanner(Spanner* s);
-    void clear() { std::multimap<int, Spanner*>::clear(); m_dirty = true; }
+    void clear() { std::multimap<int, Spanner*>::clear(); m_tree.clear(); m_dirty = true; }
     bool empty() const { return std::multimap<int, Spanner*>::empty(); }
     void update() const;
-    void setDirty() const { m_dirty = true; }     // must be called if a spanner changes start/length
+    void setDirty() const { m_dirty = true; }     // must be called if spanners change start/length
+    void updateSpanner(const Spanner* s);         // called when a spanner changes start/length
 #ifndef NDEBUG
     void dump() const;
 #endif
 
 private:
 
+    void updateTree() const;
+    void updateCollisionFreeTree() const;
+    const SpannerIntervalTree& tree(bool excludeCollisions) const;
+
+    //! NOTE The regular tree is kept up to date as spanners are added, removed and changed.
+    //! The collision free tree depends on the neighbours of each spanner, so it is built again when needed
     mutable bool m_dirty = false;
-    mutable interval_tree::IntervalTree<Spanner*> m_tree;
-    mutable interval_tree::IntervalTree<Spanner*> m_collisionFreeTree;
-    mutable std::vector<interval_tree::Interval<Spanner*> > m_results;
+    mutable bool m_collisionFreeDirty = true;
+    mutable size_t m_nextOrder = 0;
+    mutable SpannerIntervalTree m_tree;
+    mutable SpannerIntervalTree m_collisionFreeTree;
+    mutable IntervalList m_results;
 };
 } // namespace mu::engraving
 
@@ -28,8 +28,14 @@
  Definition of classes SysStaff and System
 */
 
+#include <memory>
+
 #include "engravingitem.h"
 
+namespace muse::draw {
+struct DrawData;
+}
+
 namespace mu::engraving {
 class Box;
 class Bracket;
@@ -202,6 +208,33 @@ public:
 
     void resetShortestLongestChordRest();
 
+    //! NOTE Recorded drawing of the system items (display list), so it can be repainted without walking the items.
+    //! Dropped when the system is laid out, rebuilt by the renderer on the next paint
+    struct DisplayList {
+        std::shared_ptr<muse::draw::DrawData> data;
+        std::vector<RectF> itemRects;                   // page coordinates, one per top level object of data
+        RectF bounds;                                   // page coordinates, united rects of all items
+        std::vector<std::vector<size_t> > bands;        // indices of items by vertical strips of bounds, see Paint
+        std::vector<const EngravingItem*> selection;    // sorted, selected items are drawn in another color
+        int generation = 0;
+        int deviceDpi = 0;
+        int viewFlags = 0;
+        bool isPrinting = false;
+    };
+
+    struct LayoutData : public EngravingItem::LayoutData {
+        DisplayList displayList;
+
+        void reset() override
+        {
+            EngravingItem::LayoutData::reset();
+            invalidateDisplayList();
+        }
+
+        void invalidateDisplayList() { displayList = DisplayList(); }
+    };
+    DECLARE_LAYOUTDATA_METHODS(System)
+
 private:
     friend class Factory;
 
@@ -22,6 +22,8 @@
 
 #include "tempo.h"
 
+#include <algorithm>
+
 #include "types/constants.h"
 
 #include "global/containers.h"
@@ -135,9 +137,40 @@ void TempoMap::normalize()
         tick  = e->first;
         tempo = e->second.tempo.val;
     }
+    updateBreakpoints();
     ++m_tempoSN;
 }
 
+//---------------------------------------------------------
+//   updateBreakpoints
+//    must be called whenever the events change
+//---------------------------------------------------------
+
+void TempoMap::updateBreakpoints()
+{
+    m_breakpoints.clear();
+    m_breakpoints.reserve(size());
+    for (const auto& e : *this) {
+        m_breakpoints.push_back({ e.first, e.second.time, e.second.pause, e.second.tempo.val });
+    }
+}
+
+//---------------------------------------------------------
+//   breakpointAtTick
+//    the last breakpoint at or before tick
+//---------------------------------------------------------
+
+const TempoMap::Breakpoint* TempoMap::breakpointAtTick(int tick) const
+{
+    auto it = std::upper_bound(m_breakpoints.cbegin(), m_breakpoints.cend(), tick, [](int t, const Breakpoint& b) {
+        return t < b.tick;
+    });
+    if (it == m_breakpoints.cbegin()) {
+        return nullptr;
+    }
+    return &*std::prev(it);
+}
+
 //---------------------------------------------------------
 //   TempoMap::dump
 //---------------------------------------------------------
@@ -159,6 +192,7 @@ void TempoMap::clear()
 {
     std::map<int, TEvent>::clear();
     m_pauses.clear();
+    m_breakpoints.clear();
     ++m_tempoSN;
 }
 
@@ -183,6 +217,7 @@ void TempoMap::clearRange(int tick1, int tick2)
     }
 
     erase(first, last);
+    updateBreakpoints();
     ++m_tempoSN;
 }
 
@@ -193,26 +228,8 @@ void TempoMap::clearRange(int tick1, int tick2)
 BeatsPerSecond TempoMap::tempo(int tick) const
 {
     auto findTempo = [this](int tick) -> BeatsPerSecond {
-        if (empty()) {
-            return 2.0;
-        }
-
-        auto i = lower_bound(tick);
-        if (i == end()) {
-            --i;
-            return i->second.tempo;
-        }
-
-        if (i->first == tick) {
-            return i->second.tempo;
-        }
-
-        if (i == begin()) {
-            return 2.0;
-        }
-
-        --i;
-        return i->second.tempo;
+        const Breakpoint* b = breakpointAtTick(tick);
+        return b ? BeatsPerSecond(b->tempo) : BeatsPerSecond(2.0);
     };
 
     return findTempo(tick) * m_tempoMultiplier;
@@ -302,27 +319,14 @@ double TempoMap::tick2time(int tick, int* sn) const
 {
     double time  = 0.0;
     double delta = double(tick);
-    BeatsPerSecond tempo = 2.0;
-
-    if (!empty()) {
-        int ptick  = 0;
-        auto e = lower_bound(tick);
-        if (e == end()) {
-            auto pe = e;
-            --pe;
-            ptick = pe->first;
-            tempo = pe->second.tempo;
-            time  = pe->second.time;
-        } else if (e->first == tick) {
-            ptick = tick;
-            tempo = e->second.tempo;
-            time  = e->second.time;
-        } else if (e != begin()) {
-            auto pe = e;
-            --pe;
-            ptick = pe->first;
-            tempo = pe->second.tempo;
-            time  = pe->second.time;
+    double tempo = 2.0;
+
+    if (!m_breakpoints.empty()) {
+        int ptick = 0;
+        if (const Breakpoint* b = breakpointAtTick(tick)) {
+            ptick = b->tick;
+            tempo = b->tempo;
+            time  = b->time;
         }
         delta = double(tick - ptick);
     } else {
@@ -331,7 +335,7 @@ double TempoMap::tick2time(int tick, int* sn) const
     if (sn) {
         *sn = m_tempoSN;
     }
-    time += delta / (Constants::DIVISION * tempo.val * m_tempoMultiplier.val);
+    time += delta / (Constants::DIVISION * tempo * m_tempoMultiplier.val);
     return time;
 }
 
@@ -342,26 +346,26 @@ double TempoMap::tick2time(int tick, int* sn) const
 int TempoMap::time2tick(double time, int* sn) const
 {
     int tick     = 0;
-    double delta = time;
-    BeatsPerSecond tempo = m_tempo;
-
-    delta = 0.0;
-    tempo = 2.0;
-    for (auto e = begin(); e != end(); ++e) {
-        // if in a pause period, wait on previous tick
-        if ((time <= e->second.time) && (time > e->second.time - e->second.pause)) {
-            delta = (time - (e->second.time - e->second.pause) + delta);
-            break;
-        }
-        if (e->second.time >= time) {
-            break;
-        }
-        delta = e->second.time;
-        tick  = e->first;
-        tempo = e->second.tempo;
+    double delta = 0.0;
+    double tempo = 2.0;
+
+    // the first breakpoint at or after time, the times are increasing
+    auto it = std::lower_bound(m_breakpoints.cbegin(), m_breakpoints.cend(), time, [](const Breakpoint& b, double t) {
+        return b.time < t;
+    });
+    if (it != m_breakpoints.cbegin()) {
+        const Breakpoint& prev = *std::prev(it);
+        delta = prev.time;
+        tick  = prev.tick;
+        tempo = prev.tempo;
     }
+    // if in a pause period, wait on previous tick
+    if (it != m_breakpoints.cend() && time > it->time - it->pause) {
+        delta = (time - (it->time - it->pause) + delta);
+    }
+
     delta = time - delta;
-    tick += lrint(delta * m_tempoMultiplier.val * Constants::DIVISION * tempo.val);
+    tick += lrint(delta * m_tempoMultiplier.val * Constants::DIVISION * tempo);
     if (sn) {
         *sn = m_tempoSN;
     }
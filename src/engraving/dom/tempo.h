@@ -25,6 +25,7 @@
 
 #include <map>
 #include <unordered_map>
+#include <vector>
 
 #include "global/allocator.h"
 #include "types/bps.h"
@@ -95,7 +96,19 @@ public:
 
 private:
 
+    //! NOTE A flat copy of the events sorted by tick (and so by time), so that tick2time, time2tick
+    //! and tempo are binary searches over an array. Gradual tempo changes are stored as steps,
+    //! so the tempo is constant between two breakpoints
+    struct Breakpoint {
+        int tick = 0;
+        double time = 0.0;       // time at tick, the pause included
+        double pause = 0.0;
+        double tempo = 0.0;      // beats per second, without the multiplier
+    };
+
     void normalize();
+    void updateBreakpoints();
+    const Breakpoint* breakpointAtTick(int tick) const;
     void del(int tick);
 
     int m_tempoSN = 0; // serial no to track tempo changes
@@ -103,6 +116,7 @@ private:
     BeatsPerSecond m_tempoMultiplier;
 
     std::unordered_map<int, double> m_pauses;
+    std::vector<Breakpoint> m_breakpoints;
 };
 } // namespace mu::engraving
 #endif
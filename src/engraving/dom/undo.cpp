@@ -182,6 +182,19 @@ void UndoCommand::cleanup(bool undo)
     }
 }
 
+//---------------------------------------------------------
+//   memoryUsage
+//---------------------------------------------------------
+
+size_t UndoCommand::memoryUsage() const
+{
+    size_t usage = sizeof(UndoCommand);
+    for (const UndoCommand* c : childList) {
+        usage += c->memoryUsage();
+    }
+    return usage;
+}
+
 //---------------------------------------------------------
 //   undo
 //---------------------------------------------------------
@@ -364,10 +377,48 @@ void UndoStack::pushAndPerform(UndoCommand* cmd, EditData* ed)
         LOG_UNDO() << cmd->name();
     }
 #endif
+    if (coalescePropertyChange(cmd)) {
+        // the value to restore on undo is already recorded
+        cmd->redo(ed);
+        delete cmd;
+        return;
+    }
+
     m_activeCommand->appendChild(cmd);
+    m_changedPropertiesChildCount = m_activeCommand->childCount();
     cmd->redo(ed);
 }
 
+//---------------------------------------------------------
+//   coalescePropertyChange
+//    returns true if cmd changes a property which was already
+//    changed in the trailing run of property changes of the
+//    active macro
+//---------------------------------------------------------
+
+bool UndoStack::coalescePropertyChange(const UndoCommand* cmd)
+{
+    if (m_changedPropertiesMacro != m_activeCommand || m_changedPropertiesChildCount != m_activeCommand->childCount()) {
+        resetPropertyChanges();
+    }
+
+    // subclasses of ChangeProperty do more than setting the property
+    if (strcmp(cmd->name(), "ChangeProperty") != 0) {
+        resetPropertyChanges();
+        return false;
+    }
+
+    const ChangeProperty* cp = static_cast<const ChangeProperty*>(cmd);
+    return !m_changedProperties.insert({ cp->getElement(), cp->getId() }).second;
+}
+
+void UndoStack::resetPropertyChanges()
+{
+    m_changedProperties.clear();
+    m_changedPropertiesMacro = m_activeCommand;
+    m_changedPropertiesChildCount = m_activeCommand ? m_activeCommand->childCount() : 0;
+}
+
 //---------------------------------------------------------
 //   push1
 //---------------------------------------------------------
@@ -380,6 +431,7 @@ void UndoStack::pushWithoutPerforming(UndoCommand* cmd)
         }
         return;
     }
+    resetPropertyChanges();
     m_activeCommand->appendChild(cmd);
 }
 
@@ -426,6 +478,64 @@ void UndoStack::mergeCommands(size_t startIdx)
         startMacro->append(std::move(*m_macroList[idx]));
     }
     remove(startIdx + 1);   // TODO: remove from startIdx to curIdx only
+    startMacro->updateMemoryUsage();
+}
+
+//---------------------------------------------------------
+//   setMemoryBudget
+//---------------------------------------------------------
+
+void UndoStack::setMemoryBudget(size_t bytes)
+{
+    m_memoryBudget = bytes;
+    applyMemoryBudget();
+}
+
+//---------------------------------------------------------
+//   memoryUsage
+//    estimated memory of the commands on the stack
+//---------------------------------------------------------
+
+size_t UndoStack::memoryUsage() const
+{
+    size_t usage = 0;
+    for (const UndoMacro* macro : m_macroList) {
+        usage += macro->cachedMemoryUsage();
+    }
+    return usage;
+}
+
+//---------------------------------------------------------
+//   applyMemoryBudget
+//    drops the oldest commands until the stack fits in the
+//    memory budget, the last command can always be undone
+//---------------------------------------------------------
+
+void UndoStack::applyMemoryBudget()
+{
+    if (m_memoryBudget == 0 || m_activeCommand) {
+        return;
+    }
+
+    size_t usage = memoryUsage();
+    size_t count = 0;
+    while (usage > m_memoryBudget && count + 1 < m_currentIndex) {
+        UndoMacro* macro = m_macroList[count];
+        usage -= macro->cachedMemoryUsage();
+        macro->cleanup(true);
+        delete macro;
+        ++count;
+    }
+
+    if (count == 0) {
+        return;
+    }
+
+    LOGD() << "dropped " << count << " undo commands, memory usage: " << usage;
+
+    m_macroList.erase(m_macroList.begin(), m_macroList.begin() + count);
+    m_stateList.erase(m_stateList.begin(), m_stateList.begin() + count);
+    m_currentIndex -= count;
 }
 
 //---------------------------------------------------------
@@ -468,11 +578,17 @@ void UndoStack::endMacro(bool rollback)
             cmd->cleanup(false);        // delete elements for which UndoCommand() holds ownership
             delete cmd;
         }
+        m_activeCommand->updateMemoryUsage();
         m_macroList.push_back(m_activeCommand);
         m_stateList.push_back(m_nextState++);
         ++m_currentIndex;
     }
     m_activeCommand = nullptr;
+    resetPropertyChanges();
+
+    if (!rollback) {
+        applyMemoryBudget();
+    }
 }
 
 //---------------------------------------------------------
@@ -617,6 +733,12 @@ bool UndoMacro::empty() const
     return childCount() == 0;
 }
 
+size_t UndoMacro::memoryUsage() const
+{
+    return UndoCommand::memoryUsage() + sizeof(UndoMacro) - sizeof(UndoCommand)
+           + (m_undoSelectionInfo.elements.size() + m_redoSelectionInfo.elements.size()) * sizeof(EngravingItem*);
+}
+
 void UndoMacro::append(UndoMacro&& other)
 {
     appendChildren(&other);
@@ -29,6 +29,7 @@
 */
 
 #include <map>
+#include <unordered_set>
 
 #include "modularity/ioc.h"
 #include "../iengravingfontsprovider.h"
@@ -132,6 +133,8 @@ public:
     const std::list<UndoCommand*>& commands() const { return childList; }
     virtual std::vector<const EngravingObject*> objectItems() const { return {}; }
     virtual void cleanup(bool undo);
+    //! NOTE An estimate of the memory held by the command and its children, see UndoStack::setMemoryBudget()
+    virtual size_t memoryUsage() const;
 // #ifndef QT_NO_DEBUG
     virtual const char* name() const { return "UndoCommand"; }
 // #endif
@@ -184,6 +187,10 @@ public:
     ChangesInfo changesInfo() const;
     const TranslatableString& actionName() const;
 
+    size_t memoryUsage() const override;
+    size_t cachedMemoryUsage() const { return m_memoryUsage; }
+    void updateMemoryUsage() { m_memoryUsage = memoryUsage(); }
+
     static bool canRecordSelectedElement(const EngravingItem* e);
 
     UNDO_NAME("UndoMacro")
@@ -196,6 +203,7 @@ private:
     TranslatableString m_actionName;
 
     Score* m_score = nullptr;
+    size_t m_memoryUsage = 0;
 
     static void fillSelectionInfo(SelectionInfo&, const Selection&);
     static void applySelectionInfo(const SelectionInfo&, Selection&);
@@ -247,8 +255,31 @@ public:
     void mergeCommands(size_t startIdx);
     void cleanRedoStack() { remove(m_currentIndex); }
 
+    //! NOTE The oldest commands are dropped when the estimated memory of the stack goes over the budget.
+    //! 0 means no limit
+    size_t memoryBudget() const { return m_memoryBudget; }
+    void setMemoryBudget(size_t bytes);
+    size_t memoryUsage() const;
+
 private:
+    struct PropertyChangeKey {
+        const EngravingObject* object = nullptr;
+        Pid pid = Pid::END;
+
+        bool operator==(const PropertyChangeKey& k) const { return object == k.object && pid == k.pid; }
+    };
+
+    struct PropertyChangeKeyHash {
+        size_t operator()(const PropertyChangeKey& k) const
+        {
+            return std::hash<const void*>()(k.object) ^ (static_cast<size_t>(k.pid) << 1);
+        }
+    };
+
     void remove(size_t idx);
+    bool coalescePropertyChange(const UndoCommand* cmd);
+    void resetPropertyChanges();
+    void applyMemoryBudget();
 
     UndoMacro* m_activeCommand = nullptr;
     std::vector<UndoMacro*> m_macroList;
@@ -257,6 +288,13 @@ private:
     int m_cleanState = 0;
     size_t m_currentIndex = 0;
     bool m_isLocked = false;
+    size_t m_memoryBudget = 0;
+
+    //! NOTE The properties changed by the trailing run of ChangeProperty commands of the active macro.
+    //! A property changed again in the same run doesn't need a new command: the first one already restores its value
+    std::unordered_set<PropertyChangeKey, PropertyChangeKeyHash> m_changedProperties;
+    const UndoMacro* m_changedPropertiesMacro = nullptr;
+    size_t m_changedPropertiesChildCount = 0;
 };
 
 class InsertPart : public UndoCommand
@@ -1153,6 +1191,7 @@ public:
     UNDO_NAME("ChangeProperty")
 
     std::vector<const EngravingObject*> objectItems() const override;
+    size_t memoryUsage() const override { return sizeof(ChangeProperty); }
 
     bool isFiltered(UndoCommand::Filter f, const EngravingItem* target) const override
     {
@@ -22,6 +22,7 @@
 
 #include "utils.h"
 
+#include <algorithm>
 #include <cmath>
 #include <map>
 
@@ -71,6 +72,15 @@ Measure* Score::tick2measure(const Fraction& tick) const
         return firstMeasure();
     }
 
+    Measure* measure = nullptr;
+    if (findMeasureInTickIndex(tick, measure)) {
+        if (!measure) {
+            LOGD("tick2measure %d (max %d) not found", tick.ticks(), lastMeasure() ? lastMeasure()->tick().ticks() : -1);
+        }
+        return measure;
+    }
+
+    // the measures are not sorted by tick at the moment (e.g. while they are being changed)
     Measure* lm = 0;
     for (Measure* m = firstMeasure(); m; m = m->nextMeasure()) {
         if (tick < m->tick()) {
@@ -101,6 +111,22 @@ Measure* Score::tick2measureMM(const Fraction& t) const
         tick = Fraction(0, 1);
     }
 
+    // the measure of the tick or the multimeasure rest which replaces it
+    Measure* measure = nullptr;
+    if (findMeasureInTickIndex(tick, measure)) {
+        if (!measure) {
+            LOGD("tick2measureMM %d (max %d) not found", tick.ticks(), lastMeasureMM() ? lastMeasureMM()->tick().ticks() : -1);
+            return nullptr;
+        }
+        if (!style().styleB(Sid::createMultiMeasureRests)) {
+            return measure;
+        }
+        const Measure* mm = measure->coveringMMRestOrThis();
+        if (mm && mm->tick() <= tick && tick <= mm->endTick()) {
+            return const_cast<Measure*>(mm);
+        }
+    }
+
     Measure* lm = 0;
 
     for (Measure* m = firstMeasureMM(); m; m = m->nextMeasureMM()) {
@@ -118,6 +144,73 @@ Measure* Score::tick2measureMM(const Fraction& t) const
     return 0;
 }
 
+//---------------------------------------------------------
+//   findMeasureInTickIndex
+///   return false if the measure can't be found by the index,
+///   the measure is null if the tick is after the end of the score
+//---------------------------------------------------------
+
+bool Score::findMeasureInTickIndex(const Fraction& tick, Measure*& measure) const
+{
+    {
+        std::shared_lock lock(m_measureTickIndexMutex);
+        if (m_measureTickIndex.version == m_measures.version() && lookupMeasureTickIndex(tick, measure)) {
+            return true;
+        }
+    }
+
+    std::unique_lock lock(m_measureTickIndexMutex);
+    updateMeasureTickIndex();
+    return lookupMeasureTickIndex(tick, measure);
+}
+
+bool Score::lookupMeasureTickIndex(const Fraction& tick, Measure*& measure) const
+{
+    const std::vector<std::pair<Fraction, Measure*> >& measures = m_measureTickIndex.measures;
+    if (!m_measureTickIndex.isSorted || measures.empty()) {
+        return false;
+    }
+
+    auto it = std::upper_bound(measures.cbegin(), measures.cend(), tick, [](const Fraction& t, const std::pair<Fraction, Measure*>& m) {
+        return t < m.first;
+    });
+    if (it == measures.cbegin()) {
+        return false;
+    }
+
+    // the measures ticks may have changed since the index was updated
+    Measure* m = std::prev(it)->second;
+    if (tick < m->tick()) {
+        return false;
+    }
+
+    if (const Measure* next = m->nextMeasure()) {
+        if (tick >= next->tick()) {
+            return false;
+        }
+        measure = m;
+        return true;
+    }
+
+    measure = tick <= m->endTick() ? m : nullptr;
+    return true;
+}
+
+void Score::updateMeasureTickIndex() const
+{
+    m_measureTickIndex.measures.clear();
+    m_measureTickIndex.isSorted = true;
+
+    for (Measure* m = firstMeasure(); m; m = m->nextMeasure()) {
+        if (!m_measureTickIndex.measures.empty() && m->tick() < m_measureTickIndex.measures.back().first) {
+            m_measureTickIndex.isSorted = false;
+        }
+        m_measureTickIndex.measures.emplace_back(m->tick(), m);
+    }
+
+    m_measureTickIndex.version = m_measures.version();
+}
+
 //---------------------------------------------------------
 //   tick2measureBase
 //---------------------------------------------------------
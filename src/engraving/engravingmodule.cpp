@@ -239,9 +239,10 @@ void EngravingModule::onInit(const IApplication::RunMode& mode)
 
         //! NOTE It may be necessary to draw something with these fonts without requesting the fonts themselves
         //! (for example, simply specifying the family name for painter).
-        //! But if they are not loaded, then they are not added to the font database and,
-        //! accordingly, they are drawn incorrectly
-        m_engravingfonts->loadAllFonts();
+        //! But if they are not registered, then they are not added to the font database and,
+        //! accordingly, they are drawn incorrectly.
+        //! The metrics and metadata of each font are loaded on first use (see fontByName)
+        m_engravingfonts->registerAllFonts();
     }
 
     m_configuration->init();
@@ -56,7 +56,7 @@ std::shared_ptr<EngravingProject> EngravingProject::create(const MStyle& style,
 }
 
 EngravingProject::EngravingProject(const modularity::ContextPtr& iocCtx)
-    : muse::Injectable(iocCtx)
+    : muse::Injectable(iocCtx), m_arena(std::make_unique<muse::ObjectArena>())
 {
     muse::ObjectAllocator::used();
 }
@@ -67,6 +67,9 @@ EngravingProject::~EngravingProject()
 
     muse::ObjectAllocator::unused();
 
+    // the arena memory can be released only after all score objects are destroyed
+    m_arena.reset();
+
     // muse::AllocatorsRegister::instance()->printStatistic("=== Destroy engraving project ===");
     //! NOTE At the moment, the allocator is working as leak detector. No need to do cleanup, at the moment it can lead to crashes
     // AllocatorsRegister::instance()->cleanupAll("engraving");
@@ -74,6 +77,7 @@ EngravingProject::~EngravingProject()
 
 void EngravingProject::init(const MStyle& style)
 {
+    muse::ObjectArena::Scope arenaScope(m_arena.get());
     m_masterScore = new MasterScore(iocContext(), style, weak_from_this());
 }
 
@@ -139,12 +143,16 @@ MasterScore* EngravingProject::masterScore() const
     return m_masterScore;
 }
 
-Ret EngravingProject::loadMscz(const MscReader& msc, SettingsCompat& settingsCompat, bool ignoreVersionError)
+Ret EngravingProject::loadMscz(const MscReader& msc, SettingsCompat& settingsCompat, bool ignoreVersionError, bool lazyExcerpts,
+                               const muse::io::path_t& snapshotCachePath)
 {
     TRACEFUNC;
 
     MScore::setError(MsError::MS_NO_ERROR);
+    muse::ObjectArena::Scope arenaScope(m_arena.get());
     MscLoader loader;
+    loader.setLazyExcerpts(lazyExcerpts);
+    loader.setSnapshotCachePath(snapshotCachePath);
     return loader.loadMscz(m_masterScore, msc, settingsCompat, ignoreVersionError);
 }
 
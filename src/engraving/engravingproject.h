@@ -25,6 +25,7 @@
 #include <memory>
 
 #include "global/types/ret.h"
+#include "global/allocator.h"
 #include "infrastructure/mscreader.h"
 #include "infrastructure/mscwriter.h"
 #include "infrastructure/ifileinfoprovider.h"
@@ -69,7 +70,8 @@ public:
     MasterScore* masterScore() const;
     muse::Ret setupMasterScore(bool forceMode);
 
-    muse::Ret loadMscz(const MscReader& msc, SettingsCompat& settingsCompat, bool ignoreVersionError);
+    muse::Ret loadMscz(const MscReader& msc, SettingsCompat& settingsCompat, bool ignoreVersionError, bool lazyExcerpts = false,
+                       const muse::io::path_t& snapshotCachePath = muse::io::path_t());
     bool writeMscz(MscWriter& writer, bool onlySelection, bool createThumbnail);
 
     bool isCorruptedUponLoading() const;
@@ -86,6 +88,10 @@ private:
 
     MasterScore* m_masterScore = nullptr;
 
+    //! NOTE Objects of the master score (with OBJECT_ALLOCATOR) created during init and loading
+    //! are allocated from here (if the custom allocator is enabled), and released all at once with the project
+    std::unique_ptr<muse::ObjectArena> m_arena;
+
     bool m_isCorruptedUponLoading = false;
 };
 
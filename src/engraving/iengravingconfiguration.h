@@ -78,6 +78,9 @@ public:
     virtual bool dynamicsApplyToAllVoices() const = 0;
     virtual void setDynamicsApplyToAllVoices(bool v) = 0;
 
+    //! NOTE In bytes, 0 means no limit
+    virtual size_t undoMemoryBudget() const = 0;
+
     virtual Color formattingColor() const = 0;
     virtual muse::async::Channel<Color> formattingColorChanged() const = 0;
 
@@ -24,7 +24,7 @@ public:
     virtual IEngravingFontPtr fallbackFont() const = 0;
     virtual bool isFallbackFont(const IEngravingFont* f) const = 0;
 
-    virtual void loadAllFonts() = 0;
+    virtual void registerAllFonts() = 0;
 };
 }
 
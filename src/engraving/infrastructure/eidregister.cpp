@@ -0,0 +1,59 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-Studio-CLA-applies
+ *
+ * MuseScore Studio
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2025 MuseScore Limited
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "eidregister.h"
+
+#include "../dom/engravingobject.h"
+
+using namespace mu::engraving;
+
+void EIDRegister::reg(EngravingObject* obj)
+{
+    m_objects[obj->eid().toUint64()] = obj;
+}
+
+void EIDRegister::unreg(EngravingObject* obj)
+{
+    auto it = m_objects.find(obj->eid().toUint64());
+
+    //! NOTE A copied EID may have been taken over by another object
+    if (it != m_objects.end() && it->second == obj) {
+        m_objects.erase(it);
+    }
+}
+
+EngravingObject* EIDRegister::object(const EID& eid) const
+{
+    auto it = m_objects.find(eid.toUint64());
+    return it != m_objects.end() ? it->second : nullptr;
+}
+
+std::vector<EngravingObject*> EIDRegister::objects(const std::vector<EID>& eids) const
+{
+    std::vector<EngravingObject*> result;
+    result.reserve(eids.size());
+
+    for (const EID& eid : eids) {
+        result.push_back(object(eid));
+    }
+
+    return result;
+}
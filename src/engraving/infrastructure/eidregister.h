@@ -0,0 +1,59 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-Studio-CLA-applies
+ *
+ * MuseScore Studio
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2025 MuseScore Limited
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef MU_ENGRAVING_EIDREGISTER_H
+#define MU_ENGRAVING_EIDREGISTER_H
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include "eid.h"
+
+namespace mu::engraving {
+class EngravingObject;
+
+//! NOTE Index of the objects of a score by their EID. Objects register
+//! themselves when they get an EID or move to the score and unregister
+//! when they leave it or are deleted, so a lookup never scans the DOM.
+//! Objects removed by a command stay registered while the undo stack
+//! holds them, as undoing the command brings them back with the same EID
+class EIDRegister
+{
+public:
+    EIDRegister() = default;
+
+    void reg(EngravingObject* obj);
+    void unreg(EngravingObject* obj);
+
+    EngravingObject* object(const EID& eid) const;
+    std::vector<EngravingObject*> objects(const std::vector<EID>& eids) const;
+
+    size_t size() const { return m_objects.size(); }
+
+private:
+    EIDRegister(const EIDRegister&) = delete;
+
+    std::unordered_map<uint64_t, EngravingObject*> m_objects;
+};
+}
+
+#endif // MU_ENGRAVING_EIDREGISTER_H
@@ -23,6 +23,7 @@
 #define MU_ENGRAVING_LD_ACCESS_DEV_H
 
 #include <optional>
+#include <utility>
 
 #include "log.h"
 
@@ -99,6 +100,11 @@ public:
         m_val = std::make_optional<T>(v);
     }
 
+    inline void set_value(T&& v)
+    {
+        m_val = std::make_optional<T>(std::move(v));
+    }
+
     ld_field_debug& operator=(const T& v) { m_val = v; return *this; }
 
 private:
@@ -143,6 +149,11 @@ public:
         m_val = v;
     }
 
+    inline void set_value(T&& v)
+    {
+        m_val = std::move(v);
+    }
+
     ld_field_prod& operator=(const T& v) { m_val = v; return *this; }
 
 private:
@@ -23,6 +23,7 @@
 
 #include "io/file.h"
 #include "io/fileinfo.h"
+#include "io/mappedfile.h"
 #include "io/dir.h"
 #include "serialization/zipreader.h"
 #include "serialization/xmlstreamreader.h"
@@ -164,6 +165,11 @@ ByteArray MscReader::readScoreFile() const
     return fileData(mscxFileName);
 }
 
+bool MscReader::scoreFileCrc(uint32_t& crc, uint64_t& size) const
+{
+    return reader()->fileCrc(mainFileName(), crc, size);
+}
+
 std::vector<String> MscReader::excerptFileNames() const
 {
     if (!reader()->isContainer()) {
@@ -264,7 +270,8 @@ Ret MscReader::ZipFileReader::open(IODevice* device, const path_t& filePath)
             return make_ret(Err::FileNotFound, filePath);
         }
 
-        m_device = new File(filePath);
+        //! NOTE Only the entries that are read are loaded from the disk
+        m_device = new MappedFile(filePath);
         m_selfDeviceOwner = true;
     }
 
@@ -345,6 +352,24 @@ ByteArray MscReader::ZipFileReader::fileData(const String& fileName) const
     return data;
 }
 
+bool MscReader::ZipFileReader::fileCrc(const String& fileName, uint32_t& crc, uint64_t& size) const
+{
+    IF_ASSERT_FAILED(m_zip) {
+        return false;
+    }
+
+    const path_t filePath = fileName;
+    for (const ZipReader::FileInfo& fi : m_zip->fileInfoList()) {
+        if (fi.isFile && fi.filePath == filePath) {
+            crc = fi.crc;
+            size = fi.size;
+            return true;
+        }
+    }
+
+    return false;
+}
+
 Ret MscReader::DirReader::open(IODevice* device, const path_t& filePath)
 {
     if (device) {
@@ -414,6 +439,11 @@ ByteArray MscReader::DirReader::fileData(const String& fileName) const
     return file.readAll();
 }
 
+bool MscReader::DirReader::fileCrc(const String&, uint32_t&, uint64_t&) const
+{
+    return false;
+}
+
 Ret MscReader::XmlFileReader::open(IODevice* device, const path_t& filePath)
 {
     m_device = device;
@@ -520,6 +550,8 @@ ByteArray MscReader::XmlFileReader::fileData(const String& fileName) const
         return ByteArray();
     }
 
+    const std::lock_guard lock(m_deviceMutex);
+
     m_device->seek(0);
     XmlStreamReader xml(m_device);
     while (xml.readNextStartElement()) {
@@ -548,3 +580,8 @@ ByteArray MscReader::XmlFileReader::fileData(const String& fileName) const
 
     return ByteArray();
 }
+
+bool MscReader::XmlFileReader::fileCrc(const String&, uint32_t&, uint64_t&) const
+{
+    return false;
+}
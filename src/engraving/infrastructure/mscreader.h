@@ -22,6 +22,8 @@
 #ifndef MU_ENGRAVING_MSCREADER_H
 #define MU_ENGRAVING_MSCREADER_H
 
+#include <mutex>
+
 #include "types/ret.h"
 #include "types/string.h"
 #include "io/path.h"
@@ -56,9 +58,14 @@ public:
     void close();
     bool isOpened() const;
 
+    //! NOTE Once the reader is opened, files may be read from several threads at once
     muse::ByteArray readStyleFile() const;
     muse::ByteArray readScoreFile() const;
 
+    //! NOTE The CRC-32 and the size of the score file, which the container records,
+    //! so they are known without reading the file. Only ZIP containers record them
+    bool scoreFileCrc(uint32_t& crc, uint64_t& size) const;
+
     std::vector<muse::String> excerptFileNames() const;
     muse::ByteArray readExcerptStyleFile(const muse::String& excerptFileName) const;
     muse::ByteArray readExcerptFile(const muse::String& excerptFileName) const;
@@ -88,6 +95,7 @@ private:
         virtual muse::StringList fileList() const = 0;
         virtual bool fileExists(const muse::String& fileName) const = 0;
         virtual muse::ByteArray fileData(const muse::String& fileName) const = 0;
+        virtual bool fileCrc(const muse::String& fileName, uint32_t& crc, uint64_t& size) const = 0;
     };
 
     struct ZipFileReader : public IReader
@@ -100,6 +108,7 @@ private:
         muse::StringList fileList() const override;
         bool fileExists(const muse::String& fileName) const override;
         muse::ByteArray fileData(const muse::String& fileName) const override;
+        bool fileCrc(const muse::String& fileName, uint32_t& crc, uint64_t& size) const override;
     private:
         muse::io::IODevice* m_device = nullptr;
         bool m_selfDeviceOwner = false;
@@ -115,6 +124,7 @@ private:
         muse::StringList fileList() const override;
         bool fileExists(const muse::String& fileName) const override;
         muse::ByteArray fileData(const muse::String& fileName) const override;
+        bool fileCrc(const muse::String& fileName, uint32_t& crc, uint64_t& size) const override;
     private:
         muse::io::path_t m_rootPath;
     };
@@ -128,9 +138,11 @@ private:
         muse::StringList fileList() const override;
         bool fileExists(const muse::String& fileName) const override;
         muse::ByteArray fileData(const muse::String& fileName) const override;
+        bool fileCrc(const muse::String& fileName, uint32_t& crc, uint64_t& size) const override;
     private:
         muse::io::IODevice* m_device = nullptr;
         bool m_selfDeviceOwner = false;
+        mutable std::mutex m_deviceMutex;
     };
 
     IReader* reader() const;
@@ -71,11 +71,21 @@ const MscWriter::Params& MscWriter::params() const
 
 Ret MscWriter::open()
 {
+    if (m_params.deferred) {
+        m_isDeferredOpened = true;
+        return true;
+    }
+
     return writer()->open(m_params.device, m_params.filePath);
 }
 
 void MscWriter::close()
 {
+    if (m_params.deferred) {
+        m_isDeferredOpened = false;
+        return;
+    }
+
     if (m_writer) {
         if (m_writer->isOpened()) {
             writeMeta();
@@ -90,6 +100,10 @@ void MscWriter::close()
 
 bool MscWriter::isOpened() const
 {
+    if (m_params.deferred) {
+        return m_isDeferredOpened;
+    }
+
     return m_writer ? m_writer->isOpened() : false;
 }
 
@@ -98,12 +112,46 @@ bool MscWriter::hasError() const
     return m_writer ? m_writer->hasError() : m_hadError;
 }
 
+Ret MscWriter::flush(IODevice* device)
+{
+    TRACEFUNC;
+
+    IF_ASSERT_FAILED(m_params.deferred) {
+        return make_ret(Ret::Code::InternalError);
+    }
+
+    std::vector<std::pair<String, ByteArray> > files = std::move(m_deferredFiles);
+    m_deferredFiles.clear();
+    m_isDeferredOpened = false;
+
+    m_params.deferred = false;
+    m_params.device = device;
+
+    Ret ret = open();
+    if (!ret) {
+        return ret;
+    }
+
+    //! NOTE All the files are passed at once, so that the zip writer compresses them in parallel
+    if (writer()->addFilesData(files)) {
+        for (const auto& file : files) {
+            m_meta.addFile(file.first);
+        }
+    } else {
+        LOGE() << "failed write files";
+    }
+
+    close();
+
+    return hasError() ? make_ret(Ret::Code::UnknownError) : make_ok();
+}
+
 MscWriter::IWriter* MscWriter::writer() const
 {
     if (!m_writer) {
         switch (m_params.mode) {
         case MscIoMode::Zip:
-            m_writer = new ZipFileWriter();
+            m_writer = new ZipFileWriter(m_params.zipCompressionCache, m_params.zipCompressionEnabled);
             break;
         case MscIoMode::Dir:
             m_writer = new DirWriter();
@@ -122,6 +170,14 @@ MscWriter::IWriter* MscWriter::writer() const
 
 bool MscWriter::addFileData(const String& fileName, const ByteArray& data)
 {
+    if (m_params.deferred) {
+        //! NOTE The data may not own its memory (see ByteArray::fromRawData),
+        //! so it is copied to outlive the caller's buffer
+        m_deferredFiles.emplace_back(fileName, ByteArray(data.constData(), data.size()));
+        m_meta.addFile(fileName);
+        return true;
+    }
+
     if (!writer()->addFileData(fileName, data)) {
         LOGE() << "failed write file: " << fileName;
         return false;
@@ -254,6 +310,22 @@ void MscWriter::Meta::addFile(const String& file)
 // Writers
 // =======================================================================
 
+bool MscWriter::IWriter::addFilesData(const std::vector<std::pair<String, ByteArray> >& files)
+{
+    for (const auto& file : files) {
+        if (!addFileData(file.first, file.second)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+MscWriter::ZipFileWriter::ZipFileWriter(std::shared_ptr<ZipCompressionCache> compressionCache, bool compressionEnabled)
+    : m_compressionCache(compressionCache), m_compressionEnabled(compressionEnabled)
+{
+}
+
 MscWriter::ZipFileWriter::~ZipFileWriter()
 {
     delete m_zip;
@@ -278,6 +350,10 @@ Ret MscWriter::ZipFileWriter::open(io::IODevice* device, const path_t& filePath)
     }
 
     m_zip = new ZipWriter(m_device);
+    m_zip->setCompressionEnabled(m_compressionEnabled);
+    if (m_compressionCache) {
+        m_zip->setCompressionCache(m_compressionCache);
+    }
 
     return true;
 }
@@ -318,6 +394,27 @@ bool MscWriter::ZipFileWriter::addFileData(const String& fileName, const ByteArr
     return true;
 }
 
+bool MscWriter::ZipFileWriter::addFilesData(const std::vector<std::pair<String, ByteArray> >& files)
+{
+    IF_ASSERT_FAILED(m_zip) {
+        return false;
+    }
+
+    std::vector<std::pair<std::string, ByteArray> > zipFiles;
+    zipFiles.reserve(files.size());
+    for (const auto& file : files) {
+        zipFiles.emplace_back(file.first.toStdString(), file.second);
+    }
+
+    m_zip->addFiles(zipFiles);
+    if (m_zip->hasError()) {
+        LOGE() << "failed write files to zip";
+        return false;
+    }
+
+    return true;
+}
+
 Ret MscWriter::DirWriter::open(io::IODevice* device, const muse::io::path_t& filePath)
 {
     if (device) {
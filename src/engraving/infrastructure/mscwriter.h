@@ -22,6 +22,11 @@
 #ifndef MU_ENGRAVING_MSCWRITER_H
 #define MU_ENGRAVING_MSCWRITER_H
 
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "types/bytearray.h"
 #include "types/string.h"
 #include "types/ret.h"
 #include "io/path.h"
@@ -30,6 +35,7 @@
 
 namespace muse {
 class ZipWriter;
+struct ZipCompressionCache;
 class TextStream;
 }
 
@@ -44,6 +50,16 @@ public:
         muse::io::path_t filePath;
         muse::String mainFileName;
         MscIoMode mode = MscIoMode::Zip;
+
+        //! NOTE If set, the files are kept in memory until `flush` is called,
+        //! so that compressing and writing them can be done on another thread
+        bool deferred = false;
+
+        //! NOTE Only for the zip mode, see ZipWriter::setCompressionCache
+        std::shared_ptr<muse::ZipCompressionCache> zipCompressionCache;
+
+        //! NOTE Only for the zip mode, the files are stored without compression if not set
+        bool zipCompressionEnabled = true;
     };
 
     MscWriter() = default;
@@ -58,6 +74,9 @@ public:
     bool isOpened() const;
     bool hasError() const;
 
+    //! NOTE Writes the files kept in the deferred mode to `device` or to the file path
+    muse::Ret flush(muse::io::IODevice* device = nullptr);
+
     void writeStyleFile(const muse::ByteArray& data);
     void writeScoreFile(const muse::ByteArray& data);
     void addExcerptStyleFile(const muse::String& excerptFileName, const muse::ByteArray& data);
@@ -79,21 +98,26 @@ private:
         virtual bool isOpened() const = 0;
         virtual bool hasError() const = 0;
         virtual bool addFileData(const muse::String& fileName, const muse::ByteArray& data) = 0;
+        virtual bool addFilesData(const std::vector<std::pair<muse::String, muse::ByteArray> >& files);
     };
 
     struct ZipFileWriter : public IWriter
     {
+        ZipFileWriter(std::shared_ptr<muse::ZipCompressionCache> compressionCache, bool compressionEnabled);
         ~ZipFileWriter() override;
         muse::Ret open(muse::io::IODevice* device, const muse::io::path_t& filePath) override;
         void close() override;
         bool isOpened() const override;
         bool hasError() const override;
         bool addFileData(const muse::String& fileName, const muse::ByteArray& data) override;
+        bool addFilesData(const std::vector<std::pair<muse::String, muse::ByteArray> >& files) override;
 
     private:
         muse::io::IODevice* m_device = nullptr;
         bool m_selfDeviceOwner = false;
         muse::ZipWriter* m_zip = nullptr;
+        std::shared_ptr<muse::ZipCompressionCache> m_compressionCache;
+        bool m_compressionEnabled = true;
     };
 
     struct DirWriter : public IWriter
@@ -143,6 +167,9 @@ private:
     mutable IWriter* m_writer = nullptr;
     Meta m_meta;
     bool m_hadError = false;
+
+    bool m_isDeferredOpened = false;
+    std::vector<std::pair<muse::String, muse::ByteArray> > m_deferredFiles;
 };
 }
 
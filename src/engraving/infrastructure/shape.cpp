@@ -20,6 +20,7 @@
  * along with this program.  If not, see <https://www.gnu.org/licenses/>.
  */
 #include <cfloat>
+#include <numeric>
 
 #include "shape.h"
 
@@ -70,7 +71,7 @@ Shape& Shape::translate(const PointF& pt)
     for (RectF& r : m_elements) {
         r.translate(pt);
     }
-    invalidateBBox();
+    invalidateCache();
     return *this;
 }
 
@@ -80,7 +81,7 @@ void Shape::translateX(double xo)
         r.setLeft(r.left() + xo);
         r.setRight(r.right() + xo);
     }
-    invalidateBBox();
+    invalidateCache();
 }
 
 void Shape::translateY(double yo)
@@ -89,7 +90,7 @@ void Shape::translateY(double yo)
         r.setTop(r.top() + yo);
         r.setBottom(r.bottom() + yo);
     }
-    invalidateBBox();
+    invalidateCache();
 }
 
 //---------------------------------------------------------
@@ -111,7 +112,7 @@ Shape& Shape::scale(const SizeF& mag)
     for (RectF& r : m_elements) {
         r.scale(mag);
     }
-    invalidateBBox();
+    invalidateCache();
     return *this;
 }
 
@@ -130,6 +131,7 @@ Shape& Shape::adjust(double xp1, double yp1, double xp2, double yp2)
     for (ShapeElement& element : m_elements) {
         element.adjust(xp1, yp1, xp2, yp2);
     }
+    invalidateCache();
     return *this;
 }
 
@@ -144,9 +146,10 @@ Shape Shape::adjusted(double xp1, double yp1, double xp2, double yp2) const
     return s;
 }
 
-void Shape::invalidateBBox()
+void Shape::invalidateCache()
 {
     m_bbox = RectF();
+    m_verticalIndex.reset();
 }
 
 const RectF& Shape::bbox() const
@@ -432,6 +435,7 @@ void Shape::setBBox(const RectF& r, const EngravingItem* p)
     } else {
         m_elements[0] = ShapeElement(r, p);
     }
+    invalidateCache();
 }
 
 void Shape::addBBox(const RectF& r)
@@ -445,6 +449,7 @@ void Shape::addBBox(const RectF& r)
     }
 
     m_elements[0].unite(r);
+    invalidateCache();
 }
 
 //---------------------------------------------------------
@@ -455,14 +460,14 @@ void Shape::add(const Shape& s)
 {
     m_type = Type::Composite;
     m_elements.insert(m_elements.end(), s.m_elements.begin(), s.m_elements.end());
-    invalidateBBox();
+    invalidateCache();
 }
 
 void Shape::add(const ShapeElement& shapeEl)
 {
     m_type = Type::Composite;
     m_elements.push_back(shapeEl);
-    invalidateBBox();
+    invalidateCache();
 }
 
 //---------------------------------------------------------
@@ -474,13 +479,14 @@ void Shape::remove(const RectF& r)
     for (auto i = m_elements.begin(); i != m_elements.end(); ++i) {
         if (*i == r) {
             m_elements.erase(i);
+            invalidateCache();
             return;
         }
     }
 
     ASSERT_X("Shape::remove: RectF not found in Shape");
 
-    invalidateBBox();
+    invalidateCache();
 }
 
 void Shape::remove(const Shape& s)
@@ -489,7 +495,7 @@ void Shape::remove(const Shape& s)
         remove(r);
     }
 
-    invalidateBBox();
+    invalidateCache();
 }
 
 void Shape::removeInvisibles()
@@ -497,7 +503,7 @@ void Shape::removeInvisibles()
     muse::remove_if(m_elements, [](ShapeElement& shapeElement) {
         return !shapeElement.item() || !shapeElement.item()->visible();
     });
-    invalidateBBox();
+    invalidateCache();
 }
 
 void Shape::removeTypes(const std::set<ElementType>& types)
@@ -505,7 +511,7 @@ void Shape::removeTypes(const std::set<ElementType>& types)
     muse::remove_if(m_elements, [&types](ShapeElement& shapeElement) {
         return shapeElement.item() && muse::contains(types, shapeElement.item()->type());
     });
-    invalidateBBox();
+    invalidateCache();
 }
 
 //---------------------------------------------------------
@@ -550,6 +556,68 @@ bool Shape::intersects(const Shape& other) const
     return false;
 }
 
+//---------------------------------------------------------
+//   verticalIndex
+//---------------------------------------------------------
+
+const Shape::VerticalIndex& Shape::verticalIndex() const
+{
+    if (m_verticalIndex) {
+        return *m_verticalIndex;
+    }
+
+    auto index = std::make_shared<VerticalIndex>();
+    const size_t count = m_elements.size();
+
+    index->order.resize(count);
+    std::iota(index->order.begin(), index->order.end(), 0);
+    std::sort(index->order.begin(), index->order.end(), [this](size_t a, size_t b) {
+        return m_elements[a].top() < m_elements[b].top();
+    });
+
+    index->tops.reserve(count);
+    index->maxBottoms.reserve(count);
+    double maxBottom = -DBL_MAX;
+    for (size_t i : index->order) {
+        const ShapeElement& el = m_elements[i];
+        maxBottom = std::max(maxBottom, el.bottom());
+        index->tops.push_back(el.top());
+        index->maxBottoms.push_back(maxBottom);
+    }
+
+    m_verticalIndex = index;
+    return *m_verticalIndex;
+}
+
+//---------------------------------------------------------
+//   forEachInVerticalBand
+//    Elements before the first one whose running max bottom
+//    exceeds y1 end above the band, elements from the first
+//    one whose top reaches y2 start below it.
+//---------------------------------------------------------
+
+void Shape::forEachInVerticalBand(double y1, double y2, const std::function<void(size_t)>& func) const
+{
+    if (m_elements.empty()) {
+        return;
+    }
+
+    const VerticalIndex& index = verticalIndex();
+
+    auto begin = std::upper_bound(index.maxBottoms.begin(), index.maxBottoms.end(), y1);
+    auto end = std::lower_bound(index.tops.begin(), index.tops.end(), y2);
+
+    size_t first = std::distance(index.maxBottoms.begin(), begin);
+    size_t last = std::distance(index.tops.begin(), end);
+
+    for (size_t i = first; i < last; ++i) {
+        size_t elementIdx = index.order[i];
+        if (m_elements[elementIdx].bottom() > y1) {
+            func(elementIdx);
+        }
+    }
+}
+
 void Shape::paint(Painter& painter) const
 {
     for (const RectF& r : m_elements) {
@@ -24,6 +24,7 @@
 #define MU_ENGRAVING_SHAPE_H
 
 #include <functional>
+#include <memory>
 #include <optional>
 
 #include "draw/types/geometry.h"
@@ -86,7 +87,7 @@ public:
 
     size_t size() const { return m_elements.size(); }
     bool empty() const { return m_elements.empty(); }
-    void clear() { m_elements.clear(); }
+    void clear() { m_elements.clear(); invalidateCache(); }
 
     bool equal(const Shape& sh) const
     {
@@ -120,14 +121,14 @@ public:
     {
         size_t origSize = m_elements.size();
         m_elements.erase(std::remove_if(m_elements.begin(), m_elements.end(), p), m_elements.end());
-        invalidateBBox();
+        invalidateCache();
         return origSize != m_elements.size();
     }
 
     // ---
 
     const std::vector<ShapeElement>& elements() const { return m_elements; }
-    std::vector<ShapeElement>& elements() { return m_elements; }
+    std::vector<ShapeElement>& elements() { invalidateCache(); return m_elements; }
 
     std::optional<ShapeElement> find_if(const std::function<bool(const ShapeElement&)>& func) const;
     std::optional<ShapeElement> find_first(ElementType type) const;
@@ -165,15 +166,27 @@ public:
     bool intersects(const Shape& other) const;
     bool clearsVertically(const Shape& a) const;
 
+    // Calls func with the index of every element whose vertical extent overlaps (y1, y2).
+    // Uses an index sorted by element top, built on first use and dropped when the shape changes.
+    void forEachInVerticalBand(double y1, double y2, const std::function<void(size_t)>& func) const;
+
     void paint(muse::draw::Painter& painter) const;
 
 private:
 
-    void invalidateBBox();
+    struct VerticalIndex {
+        std::vector<size_t> order;      // element indices sorted by top
+        std::vector<double> tops;       // tops in that order
+        std::vector<double> maxBottoms; // running max of bottoms in that order
+    };
+
+    void invalidateCache();
+    const VerticalIndex& verticalIndex() const;
 
     Type m_type = Type::Fixed;
     std::vector<ShapeElement> m_elements;
     mutable RectF m_bbox;   // cache
+    mutable std::shared_ptr<const VerticalIndex> m_verticalIndex;   // cache, shared between copies
 };
 
 void dump(const ShapeElement& sh, std::stringstream& ss);
@@ -22,6 +22,8 @@
 
 #include "skyline.h"
 
+#include <algorithm>
+
 #include "realfn.h"
 #include "draw/painter.h"
 
@@ -202,6 +204,13 @@ double Skyline::minDistance(const Skyline& s, double minHorizontalClearance) con
 
 double SkylineLine::minDistance(const SkylineLine& sl, double minHorizontalClearance) const
 {
+    // The pairwise scan is quadratic, for long lines (e.g. whole systems)
+    // building the envelopes and merging them is much cheaper
+    static constexpr size_t ENVELOPE_THRESHOLD = 64 * 64;
+    if (m_shape.size() * sl.m_shape.size() > ENVELOPE_THRESHOLD) {
+        return SkylineEnvelope(*this).minDistance(SkylineEnvelope(sl), minHorizontalClearance);
+    }
+
     return m_shape.minVerticalDistance(sl.m_shape, minHorizontalClearance);
 }
 
@@ -215,6 +224,69 @@ double SkylineLine::minDistanceToShapeBelow(const Shape& shapeBelow, double minH
     return m_shape.minVerticalDistance(shapeBelow, minHorizontalClearance);
 }
 
+double SkylineLine::minDistanceToShapeAbove(const Shape& shapeAbove, double minHorizontalClearance,
+                                            const std::function<bool(const ShapeElement&)>& filterOut) const
+{
+    return minDistanceToShape(shapeAbove, minHorizontalClearance, true, filterOut);
+}
+
+double SkylineLine::minDistanceToShapeBelow(const Shape& shapeBelow, double minHorizontalClearance,
+                                            const std::function<bool(const ShapeElement&)>& filterOut) const
+{
+    return minDistanceToShape(shapeBelow, minHorizontalClearance, false, filterOut);
+}
+
+double SkylineLine::minDistanceToShape(const Shape& shape, double minHorizontalClearance, bool shapeIsAbove,
+                                       const std::function<bool(const ShapeElement&)>& filterOut) const
+{
+    if (shape.empty()) {
+        return 0.0;
+    }
+
+    const RectF bbox = shape.bbox();
+    const double left = bbox.left() - minHorizontalClearance;
+    const double right = bbox.right() + minHorizontalClearance;
+
+    double dist = -DBL_MAX;
+    bool hasUnfilteredElements = false;
+    bool hasDistantElements = false;
+
+    for (const ShapeElement& skylineEl : m_shape.elements()) {
+        // cannot intersect any element of the shape, see Shape::minVerticalDistance()
+        if (skylineEl.right() <= left || skylineEl.left() >= right) {
+            hasDistantElements = true;
+            continue;
+        }
+        if (filterOut(skylineEl)) {
+            continue;
+        }
+        hasUnfilteredElements = true;
+
+        if (skylineEl.height() <= 0.0) {
+            continue;
+        }
+
+        for (const ShapeElement& shapeEl : shape.elements()) {
+            if (shapeEl.height() <= 0.0) {
+                continue;
+            }
+            if (!intersects(skylineEl.left(), skylineEl.right(), shapeEl.left(), shapeEl.right(), minHorizontalClearance)) {
+                continue;
+            }
+            dist = std::max(dist, shapeIsAbove ? shapeEl.bottom() - skylineEl.top() : skylineEl.bottom() - shapeEl.top());
+        }
+    }
+
+    // like Shape::minVerticalDistance(), an empty (filtered) skyline gives 0.0 rather than -DBL_MAX
+    if (!hasUnfilteredElements && hasDistantElements) {
+        hasUnfilteredElements = std::any_of(m_shape.elements().begin(), m_shape.elements().end(), [&](const ShapeElement& skylineEl) {
+            return !filterOut(skylineEl);
+        });
+    }
+
+    return hasUnfilteredElements ? dist : 0.0;
+}
+
 double SkylineLine::verticalClearanceAbove(const Shape& shapeAbove) const
 {
     return shapeAbove.verticalClearance(m_shape);
@@ -307,6 +379,133 @@ double SkylineLine::max() const
 {
     return m_isNorth ? m_shape.top() : m_shape.bottom();
 }
+
+//---------------------------------------------------------
+//   SkylineEnvelope
+//---------------------------------------------------------
+
+SkylineEnvelope::SkylineEnvelope(const SkylineLine& line)
+{
+    build(line.elements(), line.isNorth());
+}
+
+SkylineEnvelope::SkylineEnvelope(const Shape& shape, bool isNorth)
+{
+    build(shape.elements(), isNorth);
+}
+
+void SkylineEnvelope::build(const std::vector<ShapeElement>& elements, bool isNorth)
+{
+    struct Interval {
+        double left = 0.0;
+        double right = 0.0;
+        double edge = 0.0;
+    };
+
+    // Elements without height or width never take part in distance queries (see Shape::minVerticalDistance).
+    // The edge is stored negated for north lines, so that the sweep below always looks for the maximum.
+    std::vector<Interval> intervals;
+    intervals.reserve(elements.size());
+    for (const ShapeElement& el : elements) {
+        if (el.height() <= 0.0 || el.left() == el.right()) {
+            continue;
+        }
+        intervals.push_back({ el.left(), el.right(), isNorth ? -el.top() : el.bottom() });
+    }
+
+    m_left.clear();
+    m_right.clear();
+    m_edge.clear();
+
+    if (intervals.empty()) {
+        return;
+    }
+
+    std::sort(intervals.begin(), intervals.end(), [](const Interval& a, const Interval& b) {
+        return a.left < b.left;
+    });
+
+    std::vector<double> breaks;
+    breaks.reserve(intervals.size() * 2);
+    for (const Interval& i : intervals) {
+        breaks.push_back(i.left);
+        breaks.push_back(i.right);
+    }
+    std::sort(breaks.begin(), breaks.end());
+    breaks.erase(std::unique(breaks.begin(), breaks.end()), breaks.end());
+
+    // Sweep over the elementary intervals between break points, keeping the
+    // active intervals in a heap ordered by edge. Intervals which already ended
+    // are only dropped once they reach the top of the heap.
+    auto lessEdge = [](const Interval* a, const Interval* b) { return a->edge < b->edge; };
+    std::vector<const Interval*> active;
+    active.reserve(intervals.size());
+
+    m_left.reserve(breaks.size());
+    m_right.reserve(breaks.size());
+    m_edge.reserve(breaks.size());
+
+    size_t next = 0;
+    for (size_t b = 0; b + 1 < breaks.size(); ++b) {
+        const double x1 = breaks[b];
+        const double x2 = breaks[b + 1];
+
+        while (next < intervals.size() && intervals[next].left <= x1) {
+            active.push_back(&intervals[next++]);
+            std::push_heap(active.begin(), active.end(), lessEdge);
+        }
+        while (!active.empty() && active.front()->right <= x1) {
+            std::pop_heap(active.begin(), active.end(), lessEdge);
+            active.pop_back();
+        }
+        if (active.empty()) {
+            continue;
+        }
+
+        const double edge = isNorth ? -active.front()->edge : active.front()->edge;
+        if (!m_left.empty() && m_right.back() == x1 && m_edge.back() == edge) {
+            m_right.back() = x2;
+        } else {
+            m_left.push_back(x1);
+            m_right.push_back(x2);
+            m_edge.push_back(edge);
+        }
+    }
+}
+
+//-------------------------------------------------------------------
+//   minDistance
+//    belowEnvelope is located below this envelope.
+//    Returns -DBL_MAX when no intervals overlap horizontally.
+//    The intervals of both envelopes are sorted and disjoint, so all the
+//    intervals of this envelope overlapping a given interval below form
+//    a contiguous window which only moves to the right.
+//-------------------------------------------------------------------
+
+double SkylineEnvelope::minDistance(const SkylineEnvelope& belowEnvelope, double minHorizontalClearance) const
+{
+    const size_t n = m_left.size();
+    const size_t m = belowEnvelope.m_left.size();
+    const double* aLeft = m_left.data();
+    const double* aRight = m_right.data();
+    const double* aEdge = m_edge.data();
+    const double* bLeft = belowEnvelope.m_left.data();
+    const double* bRight = belowEnvelope.m_right.data();
+    const double* bEdge = belowEnvelope.m_edge.data();
+
+    double dist = -DBL_MAX;
+    size_t first = 0;
+    for (size_t j = 0; j < m; ++j) {
+        while (first < n && aRight[first] + minHorizontalClearance <= bLeft[j]) {
+            ++first;
+        }
+        for (size_t i = first; i < n && aLeft[i] < bRight[j] + minHorizontalClearance; ++i) {
+            dist = std::max(dist, aEdge[i] - bEdge[j]);
+        }
+    }
+
+    return dist;
+}
 } // namespace mu::engraving
 
 std::string mu::engraving::dump(const Skyline& skyline)
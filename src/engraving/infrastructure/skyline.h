@@ -61,6 +61,12 @@ public:
     double minDistance(const SkylineLine&, double minHorizontalClearance = 0.0) const;
     double minDistanceToShapeAbove(const Shape&, double minHorizontalClearance = 0.0) const;
     double minDistanceToShapeBelow(const Shape&, double minHorizontalClearance = 0.0) const;
+    // same as getFilteredCopy(filterOut).minDistanceToShapeAbove/Below(...) without copying the line:
+    // only the elements horizontally close to the shape are filtered and measured
+    double minDistanceToShapeAbove(const Shape&, double minHorizontalClearance,
+                                   const std::function<bool(const ShapeElement&)>& filterOut) const;
+    double minDistanceToShapeBelow(const Shape&, double minHorizontalClearance,
+                                   const std::function<bool(const ShapeElement&)>& filterOut) const;
     double verticalClearanceAbove(const Shape& shapeAbove) const;
     double verticalClaranceBelow(const Shape& shapeBelow) const;
     double max() const;
@@ -77,6 +83,8 @@ public:
     std::vector<ShapeElement>& elements() { return m_shape.elements(); }
 
 private:
+    double minDistanceToShape(const Shape& shape, double minHorizontalClearance, bool shapeIsAbove,
+                              const std::function<bool(const ShapeElement&)>& filterOut) const;
     double staffLinesTopAtX(double x) const;
     double staffLinesBottomAtX(double x) const;
 
@@ -95,6 +103,42 @@ private:
     bool hasValidStaffLineEdges() const { return !m_staffLineEdges.empty(); }
 };
 
+//---------------------------------------------------------
+//   SkylineEnvelope
+//    Flat form of a SkylineLine for distance queries.
+//    Stores sorted, non-overlapping x intervals together with
+//    the outermost edge of the line over each interval
+//    (lowest top for north lines, highest bottom for south lines)
+//    in separate arrays, so that comparing two envelopes is a
+//    single linear merge instead of a pairwise scan.
+//---------------------------------------------------------
+
+class SkylineEnvelope
+{
+public:
+    SkylineEnvelope() = default;
+    SkylineEnvelope(const SkylineLine& line);
+    SkylineEnvelope(const Shape& shape, bool isNorth);
+
+    bool empty() const { return m_left.empty(); }
+    size_t size() const { return m_left.size(); }
+
+    const std::vector<double>& left() const { return m_left; }
+    const std::vector<double>& right() const { return m_right; }
+    const std::vector<double>& edge() const { return m_edge; }
+
+    // same result as Shape::minVerticalDistance of the non-empty source shapes,
+    // belowEnvelope is located below this (south) envelope
+    double minDistance(const SkylineEnvelope& belowEnvelope, double minHorizontalClearance = 0.0) const;
+
+private:
+    void build(const std::vector<ShapeElement>& elements, bool isNorth);
+
+    std::vector<double> m_left;
+    std::vector<double> m_right;
+    std::vector<double> m_edge;
+};
+
 //---------------------------------------------------------
 //   Skyline
 //---------------------------------------------------------
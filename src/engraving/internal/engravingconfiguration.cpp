@@ -50,6 +50,7 @@ static const Settings::Key FORMATTING_COLOR("engraving", "engraving/colors/forma
 static const Settings::Key UNLINKED_COLOR("engraving", "engraving/colors/unlinkedColor");
 
 static const Settings::Key DYNAMICS_APPLY_TO_ALL_VOICES("engraving", "score/dynamicsApplyToAllVoices");
+static const Settings::Key UNDO_MEMORY_BUDGET_MB("engraving", "score/undoMemoryBudgetMB");
 
 struct VoiceColor {
     Settings::Key key;
@@ -104,6 +105,7 @@ void EngravingConfiguration::init()
     VOICE_COLORS[ALL_VOICES_IDX] = VoiceColor { std::move(ALL_VOICES_COLOR), currentColor };
 
     settings()->setDefaultValue(DYNAMICS_APPLY_TO_ALL_VOICES, Val(true));
+    settings()->setDefaultValue(UNDO_MEMORY_BUDGET_MB, Val(0));
 
     settings()->setDefaultValue(FORMATTING_COLOR, Val(Color("#A0A0A4").toQColor()));
     settings()->setDescription(FORMATTING_COLOR, muse::trc("engraving", "Formatting color"));
@@ -304,6 +306,12 @@ void EngravingConfiguration::setDynamicsApplyToAllVoices(bool v)
     settings()->setSharedValue(DYNAMICS_APPLY_TO_ALL_VOICES, Val(v));
 }
 
+size_t EngravingConfiguration::undoMemoryBudget() const
+{
+    int megabytes = settings()->value(UNDO_MEMORY_BUDGET_MB).toInt();
+    return megabytes > 0 ? static_cast<size_t>(megabytes) * 1024 * 1024 : 0;
+}
+
 muse::async::Notification EngravingConfiguration::scoreInversionChanged() const
 {
     return m_scoreInversionChanged;
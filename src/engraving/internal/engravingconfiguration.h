@@ -85,6 +85,8 @@ public:
     bool dynamicsApplyToAllVoices() const override;
     void setDynamicsApplyToAllVoices(bool v) override;
 
+    size_t undoMemoryBudget() const override;
+
     muse::async::Notification scoreInversionChanged() const override;
 
     Color formattingColor() const override;
@@ -90,9 +90,9 @@ double EngravingFont::textEnclosureThickness()
 // Load
 // =============================================
 
-void EngravingFont::ensureLoad()
+void EngravingFont::ensureRegistered()
 {
-    if (m_loaded) {
+    if (m_registered) {
         return;
     }
 
@@ -107,6 +107,20 @@ void EngravingFont::ensureLoad()
     m_font.setNoFontMerging(true);
     m_font.setHinting(Font::Hinting::PreferVerticalHinting);
 
+    m_registered = true;
+}
+
+void EngravingFont::ensureLoad()
+{
+    if (m_loaded) {
+        return;
+    }
+
+    ensureRegistered();
+    if (!m_registered) {
+        return;
+    }
+
     for (size_t id = 0; id < m_symbols.size(); ++id) {
         Smufl::Code code = Smufl::code(static_cast<SymId>(id));
         if (!code.isValid()) {
@@ -93,6 +93,7 @@ public:
     void draw(const SymIdList& ids, muse::draw::Painter* p, double mag, const PointF& pos, const double angle = 0) const override;
     void draw(const SymIdList& ids, muse::draw::Painter* p, const SizeF& mag, const PointF& pos, const double angle = 0) const override;
 
+    void ensureRegistered();
     void ensureLoad();
 
 private:
@@ -132,6 +133,7 @@ private:
 
     bool useFallbackFont(SymId id) const;
 
+    bool m_registered = false;
     bool m_loaded = false;
     std::vector<Sym> m_symbols;
     mutable muse::draw::Font m_font;
@@ -102,9 +102,9 @@ bool EngravingFontsProvider::isFallbackFont(const IEngravingFont* f) const
     return doFallbackFont().get() == f;
 }
 
-void EngravingFontsProvider::loadAllFonts()
+void EngravingFontsProvider::registerAllFonts()
 {
     for (std::shared_ptr<EngravingFont>& f : m_symbolFonts) {
-        f->ensureLoad();
+        f->ensureRegistered();
     }
 }
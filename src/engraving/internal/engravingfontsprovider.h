@@ -46,7 +46,7 @@ public:
     IEngravingFontPtr fallbackFont() const override;
     bool isFallbackFont(const IEngravingFont* f) const override;
 
-    void loadAllFonts() override;
+    void registerAllFonts() override;
 
 private:
 
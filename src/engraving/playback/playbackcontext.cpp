@@ -54,6 +54,12 @@ static bool soundFlagPlayable(const SoundFlag* flag)
     return false;
 }
 
+static const Segment* firstSegmentOfMeasureAt(const Score* score, const int tick)
+{
+    const Measure* measure = score->tick2measure(Fraction::fromTicks(tick));
+    return measure ? measure->first() : nullptr;
+}
+
 static mu::engraving::DynamicType findNominalStartDynamicType(const Hairpin* hairpin)
 {
     return hairpin->dynamicTypeFrom();
@@ -248,25 +254,92 @@ void PlaybackContext::update(const ID partId, const Score* score, bool expandRep
         handleSpanners(partId, score, repeatSegment->tick,
                        repeatSegment->tick + repeatSegment->len(), tickPositionOffset);
 
+        m_hasMeasureRepeats = m_hasMeasureRepeats || !measureRepeats.empty();
         handleMeasureRepeats(measureRepeats, tickPositionOffset);
     }
 
-    for (track_idx_t trackIdx = m_partStartTrack; trackIdx < m_partEndTrack; ++trackIdx) {
-        DynamicMap& dynamics = m_dynamicsByTrack[trackIdx];
-        if (!muse::contains(dynamics, 0)) {
-            dynamics.emplace(0, DynamicInfo { dynamicLevelFromType(mpe::DynamicType::Natural), 0 });
+    addNaturalDynamicsAtStart();
+
+    const Measure* lastMeasure = score->lastMeasure();
+    m_builtScoreEndTick = lastMeasure ? lastMeasure->endTick().ticks() : 0;
+    m_builtWithExpandedRepeats = expandRepeats;
+    m_isBuilt = true;
+}
+
+void PlaybackContext::update(const ID partId, const Score* score, bool expandRepeats, const int tickFrom, const int tickTo)
+{
+    const Part* part = score->partById(partId);
+    IF_ASSERT_FAILED(part) {
+        return;
+    }
+
+    if (!canUpdateRange(part, score, expandRepeats)) {
+        clear();
+        update(partId, score, expandRepeats);
+        return;
+    }
+
+    const RepeatSegment* repeatSegment = score->repeatList(expandRepeats).front();
+    const int tickPositionOffset = repeatSegment->utick - repeatSegment->tick;
+    const int scoreStartTick = repeatSegment->tick;
+    const int scoreEndTick = repeatSegment->tick + repeatSegment->len();
+
+    int from = std::max(tickFrom, scoreStartTick);
+    int to = std::min(tickTo, scoreEndTick);
+
+    if (from <= scoreStartTick && to >= scoreEndTick) {
+        clear();
+        update(partId, score, expandRepeats);
+        return;
+    }
+
+    expandAffectedRange(partId, score, tickPositionOffset, scoreEndTick, from, to);
+    eraseRange(from + tickPositionOffset, to + tickPositionOffset);
+
+    std::vector<const MeasureRepeat*> measureRepeats;
+
+    for (const Measure* measure = score->tick2measure(Fraction::fromTicks(from)); measure; measure = measure->nextMeasure()) {
+        if (measure->tick().ticks() > to) {
+            break;
         }
+
+        for (const Segment* segment = measure->first(); segment; segment = segment->next()) {
+            const int segmentTick = segment->tick().ticks();
+            if (segmentTick < from || segmentTick > to) {
+                continue;
+            }
+
+            handleSegmentElements(segment, segmentTick + tickPositionOffset, measureRepeats);
+            handleSegmentAnnotations(partId, segment, segmentTick + tickPositionOffset);
+        }
+    }
+
+    if (!measureRepeats.empty()) {
+        // The repeated measures may be anywhere in the score, so the whole context has to be rebuilt
+        clear();
+        update(partId, score, expandRepeats);
+        return;
     }
+
+    // Renders only the hairpins overlapping [from, to], all of them lie within the range after its expansion
+    handleSpanners(partId, score, std::max(from - 1, scoreStartTick), std::min(to + 1, scoreEndTick), tickPositionOffset);
+
+    addNaturalDynamicsAtStart();
 }
 
 void PlaybackContext::clear()
 {
     m_partStartTrack = 0;
     m_partEndTrack = 0;
+    m_isBuilt = false;
+    m_builtWithExpandedRepeats = true;
+    m_hasMeasureRepeats = false;
+    m_builtScoreEndTick = 0;
     m_dynamicsByTrack.clear();
     m_playTechniquesMap.clear();
     m_soundFlagParamsByTrack.clear();
     m_textParamsByTrack.clear();
+    m_dynamicSpans.clear();
 }
 
 bool PlaybackContext::hasSoundFlags() const
@@ -274,6 +347,195 @@ bool PlaybackContext::hasSoundFlags() const
     return !m_soundFlagParamsByTrack.empty();
 }
 
+bool PlaybackContext::canUpdateRange(const Part* part, const Score* score, bool expandRepeats) const
+{
+    if (!m_isBuilt || m_hasMeasureRepeats || m_builtWithExpandedRepeats != expandRepeats) {
+        return false;
+    }
+
+    if (m_partStartTrack != part->startTrack() || m_partEndTrack != part->endTrack()) {
+        return false;
+    }
+
+    const Measure* lastMeasure = score->lastMeasure();
+    if (!lastMeasure || lastMeasure->endTick().ticks() != m_builtScoreEndTick) {
+        return false;
+    }
+
+    //! NOTE: With repeats, the same measure is rendered several times and the data of each pass
+    //! depends on the previous ones, so only linear scores can be updated partially
+    return score->repeatList(expandRepeats).size() == 1;
+}
+
+void PlaybackContext::expandAffectedRange(const ID partId, const Score* score, const int tickPositionOffset, const int scoreEndTick,
+                                          int& tickFrom, int& tickTo) const
+{
+    const SpannerMap& spannerMap = score->spannerMap();
+
+    bool expanded = true;
+
+    auto expand = [&tickFrom, &tickTo, &expanded](int spanFrom, int spanTo) {
+        if (spanFrom < tickFrom) {
+            tickFrom = spanFrom;
+            expanded = true;
+        }
+
+        if (spanTo > tickTo) {
+            tickTo = spanTo;
+            expanded = true;
+        }
+    };
+
+    while (expanded) {
+        expanded = false;
+
+        // The dynamic changes rendered previously, e.g. by the removed or moved hairpins
+        for (const auto& pair : m_dynamicSpans) {
+            const int spanFrom = pair.first - tickPositionOffset;
+            if (spanFrom > tickTo) {
+                break;
+            }
+
+            const int spanTo = pair.second - tickPositionOffset;
+            if (spanTo >= tickFrom) {
+                expand(spanFrom, spanTo);
+            }
+        }
+
+        // The hairpins of the current score
+        if (!spannerMap.empty()) {
+            for (const auto& interval : spannerMap.findOverlapping(tickFrom, tickTo)) {
+                const Spanner* spanner = interval.value;
+                if (isPlayableHairpinOfPart(spanner, partId)) {
+                    expand(spanner->tick().ticks(), spanner->tick2().ticks());
+                }
+            }
+        }
+
+        // The dynamics whose changes spread beyond their segment
+        for (const Segment* segment = firstSegmentOfMeasureAt(score, tickFrom); segment; segment = segment->next1()) {
+            const int segmentTick = segment->tick().ticks();
+            if (segmentTick > tickTo) {
+                break;
+            }
+
+            if (segmentTick < tickFrom) {
+                continue;
+            }
+
+            for (const EngravingItem* annotation : segment->annotations()) {
+                if (!annotation || !annotation->isDynamic() || !annotation->part() || annotation->part()->id() != partId.toUint64()) {
+                    continue;
+                }
+
+                const Dynamic* dynamic = toDynamic(annotation);
+                if (!dynamic->playDynamic()) {
+                    continue;
+                }
+
+                const DynamicType type = dynamic->dynamicType();
+
+                if (isSingleNoteDynamicType(type) && segment->next()) {
+                    expand(segmentTick, segment->next()->tick().ticks());
+                } else if (isCompoundDynamicType(type)) {
+                    expand(segmentTick, segmentTick + dynamic->velocityChangeLength().ticks());
+                }
+            }
+        }
+
+        if (expanded) {
+            continue;
+        }
+
+        // The levels after the range may depend on the ones inside it (e.g. hairpins without a start dynamic),
+        // so the range should last until the next dynamic which defines the level on its own
+        expand(tickFrom, findNextIndependentDynamicTick(partId, score, tickTo, scoreEndTick));
+    }
+}
+
+int PlaybackContext::findNextIndependentDynamicTick(const ID partId, const Score* score, const int tickFrom, const int scoreEndTick) const
+{
+    for (const Segment* segment = firstSegmentOfMeasureAt(score, tickFrom); segment; segment = segment->next1()) {
+        const int segmentTick = segment->tick().ticks();
+        if (segmentTick < tickFrom) {
+            continue;
+        }
+
+        for (const EngravingItem* annotation : segment->annotations()) {
+            if (!annotation || !annotation->isDynamic() || !annotation->part() || annotation->part()->id() != partId.toUint64()) {
+                continue;
+            }
+
+            const Dynamic* dynamic = toDynamic(annotation);
+            if (!dynamic->playDynamic()) {
+                continue;
+            }
+
+            const DynamicType type = dynamic->dynamicType();
+            if (!isOrdinaryDynamicType(type) && !isCompoundDynamicType(type)) {
+                continue;
+            }
+
+            const VoiceAssignment voiceAssignment = dynamic->getProperty(Pid::VOICE_ASSIGNMENT).value<VoiceAssignment>();
+            if (voiceAssignment == VoiceAssignment::ALL_VOICE_IN_INSTRUMENT) {
+                return segmentTick;
+            }
+        }
+    }
+
+    return scoreEndTick;
+}
+
+void PlaybackContext::eraseRange(const int positionTickFrom, const int positionTickTo)
+{
+    auto eraseFromMap = [positionTickFrom, positionTickTo](auto& map) {
+        map.erase(map.lower_bound(positionTickFrom), map.upper_bound(positionTickTo));
+    };
+
+    for (auto& pair : m_dynamicsByTrack) {
+        eraseFromMap(pair.second);
+    }
+
+    auto eraseParams = [&eraseFromMap](ParamsByTrack& paramsByTrack) {
+        for (auto it = paramsByTrack.begin(); it != paramsByTrack.end();) {
+            eraseFromMap(it->second);
+
+            if (it->second.empty()) {
+                it = paramsByTrack.erase(it);
+            } else {
+                ++it;
+            }
+        }
+    };
+
+    eraseParams(m_soundFlagParamsByTrack);
+    eraseParams(m_textParamsByTrack);
+
+    eraseFromMap(m_playTechniquesMap);
+    m_dynamicSpans.erase(m_dynamicSpans.lower_bound(positionTickFrom), m_dynamicSpans.upper_bound(positionTickTo));
+}
+
+void PlaybackContext::addNaturalDynamicsAtStart()
+{
+    for (track_idx_t trackIdx = m_partStartTrack; trackIdx < m_partEndTrack; ++trackIdx) {
+        DynamicMap& dynamics = m_dynamicsByTrack[trackIdx];
+        if (!muse::contains(dynamics, 0)) {
+            dynamics.emplace(0, DynamicInfo { dynamicLevelFromType(mpe::DynamicType::Natural), 0 });
+        }
+    }
+}
+
+bool PlaybackContext::hasSoundFlagParamsBefore(const int positionTick) const
+{
+    for (const auto& pair : m_soundFlagParamsByTrack) {
+        if (!pair.second.empty() && pair.second.begin()->first < positionTick) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
 dynamic_level_t PlaybackContext::nominalDynamicLevel(const track_idx_t trackIdx, const int positionTick) const
 {
     auto dynamicsIt = m_dynamicsByTrack.find(trackIdx);
@@ -311,6 +573,7 @@ void PlaybackContext::updateDynamicMap(const Dynamic* dynamic, const Segment* se
             int tickPositionOffset = segmentPositionTick - segment->tick().ticks();
             int nextSegmentPositionTick = segment->next()->tick().ticks() + tickPositionOffset;
             applyDynamic(dynamic, prevDynamicLevel, nextSegmentPositionTick);
+            m_dynamicSpans.emplace(segmentPositionTick, nextSegmentPositionTick);
         }
 
         return;
@@ -333,6 +596,8 @@ void PlaybackContext::updateDynamicMap(const Dynamic* dynamic, const Segment* se
         for (const auto& pair : dynamicsCurve) {
             applyDynamic(dynamic, levelFrom + pair.second, segmentPositionTick + pair.first);
         }
+
+        m_dynamicSpans.emplace(segmentPositionTick, segmentPositionTick + transitionDuration);
     }
 }
 
@@ -348,7 +613,7 @@ void PlaybackContext::updatePlayTechMap(const PlayTechAnnotation* annotation, co
 
     bool cancelPlayTechniques = type == PlayingTechniqueType::Natural || type == PlayingTechniqueType::Open;
 
-    if (cancelPlayTechniques && !m_soundFlagParamsByTrack.empty()) {
+    if (cancelPlayTechniques && hasSoundFlagParamsBefore(segmentPositionTick)) {
         PlaybackParam ordTechnique(PlaybackParam::PlayingTechnique, mpe::ORDINARY_PLAYING_TECHNIQUE_CODE);
 
         for (track_idx_t idx = m_partStartTrack; idx < m_partEndTrack; ++idx) {
@@ -428,21 +693,28 @@ void PlaybackContext::handleSpanners(const ID partId, const Score* score, const
     for (const auto& interval : intervals) {
         const Spanner* spanner = interval.value;
 
-        if (!spanner->isHairpin() || !spanner->playSpanner() || spanner->segmentsEmpty()) {
-            continue;
+        if (isPlayableHairpinOfPart(spanner, partId)) {
+            handleHairpin(toHairpin(spanner), tickPositionOffset);
         }
+    }
+}
 
-        if (spanner->part()->id() != partId.toUint64()) {
-            continue;
-        }
+bool PlaybackContext::isPlayableHairpinOfPart(const Spanner* spanner, const ID partId)
+{
+    if (!spanner->isHairpin() || !spanner->playSpanner() || spanner->segmentsEmpty()) {
+        return false;
+    }
 
-        const Staff* staff = spanner->staff();
-        if (staff && !staff->isPrimaryStaff()) {
-            continue; // ignore linked staves
-        }
+    if (spanner->part()->id() != partId.toUint64()) {
+        return false;
+    }
 
-        handleHairpin(toHairpin(spanner), tickPositionOffset);
+    const Staff* staff = spanner->staff();
+    if (staff && !staff->isPrimaryStaff()) {
+        return false; // ignore linked staves
     }
+
+    return true;
 }
 
 void PlaybackContext::handleHairpin(const Hairpin* hairpin, const int tickPositionOffset)
@@ -517,6 +789,8 @@ void PlaybackContext::handleHairpin(const Hairpin* hairpin, const int tickPositi
         applyDynamic(hairpin, levelFrom + pair.second, spannerFrom + pair.first + tickPositionOffset);
     }
 
+    m_dynamicSpans.emplace(spannerFrom + tickPositionOffset, spannerTo + tickPositionOffset);
+
     if (hasNominalLevelTo && !useNominalLevelTo && !hasDynamicAtEndTick) {
         // If there is a dynamic at the end of the hairpin that we couldn't use because it didn't match the direction of the hairpin,
         // insert that dynamic directly after the hairpin
@@ -36,6 +36,8 @@ class Hairpin;
 class PlayTechAnnotation;
 class SoundFlag;
 class Score;
+class Part;
+class Spanner;
 class MeasureRepeat;
 class TextBase;
 
@@ -51,6 +53,10 @@ public:
     muse::mpe::DynamicLevelLayers dynamicLevelLayers(const Score* score) const;
 
     void update(const ID partId, const Score* score, bool expandRepeats = true);
+
+    //! NOTE: Re-renders only the data which may be affected by the changes in the given tick range.
+    //! Falls back to the full update if the context hasn't been built yet or the score structure has changed
+    void update(const ID partId, const Score* score, bool expandRepeats, const int tickFrom, const int tickTo);
     void clear();
 
     bool hasSoundFlags() const;
@@ -70,6 +76,18 @@ private:
 
     using PlayTechniquesMap = std::map<int /*nominalPositionTick*/, muse::mpe::ArticulationType>;
 
+    //! NOTE: Ranges of the dynamic changes which spread beyond the tick of their source (hairpins, transitions, etc.)
+    using DynamicSpans = std::multimap<int /*nominalStartTick*/, int /*nominalEndTick*/>;
+
+    bool canUpdateRange(const Part* part, const Score* score, bool expandRepeats) const;
+    void expandAffectedRange(const ID partId, const Score* score, const int tickPositionOffset, const int scoreEndTick,
+                             int& tickFrom, int& tickTo) const;
+    int findNextIndependentDynamicTick(const ID partId, const Score* score, const int tickFrom, const int scoreEndTick) const;
+    void eraseRange(const int positionTickFrom, const int positionTickTo);
+    void addNaturalDynamicsAtStart();
+
+    bool hasSoundFlagParamsBefore(const int positionTick) const;
+
     muse::mpe::dynamic_level_t nominalDynamicLevel(const track_idx_t trackIdx, const int positionTick) const;
 
     void updateDynamicMap(const Dynamic* dynamic, const Segment* segment, const int segmentPositionTick);
@@ -79,6 +97,7 @@ private:
 
     void handleSpanners(const ID partId, const Score* score, const int segmentStartTick, const int segmentEndTick,
                         const int tickPositionOffset);
+    static bool isPlayableHairpinOfPart(const Spanner* spanner, const ID partId);
     void handleHairpin(const Hairpin* hairpin, const int tickPositionOffset);
     void handleSegmentAnnotations(const ID partId, const Segment* segment, const int segmentPositionTick);
     void handleSegmentElements(const Segment* segment, const int segmentPositionTick,
@@ -100,10 +119,16 @@ private:
     track_idx_t m_partStartTrack = 0;
     track_idx_t m_partEndTrack = 0;
 
+    bool m_isBuilt = false;
+    bool m_builtWithExpandedRepeats = true;
+    bool m_hasMeasureRepeats = false;
+    int m_builtScoreEndTick = 0;
+
     DynamicsByTrack m_dynamicsByTrack;
     ParamsByTrack m_soundFlagParamsByTrack;
     ParamsByTrack m_textParamsByTrack;
     PlayTechniquesMap m_playTechniquesMap;
+    DynamicSpans m_dynamicSpans;
 };
 
 using PlaybackContextPtr = std::shared_ptr<PlaybackContext>;
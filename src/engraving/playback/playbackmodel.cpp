@@ -35,6 +35,9 @@
 #include "dom/tie.h"
 #include "dom/tremolotwochord.h"
 
+#include "async/async.h"
+#include "concurrency/taskscheduler.h"
+
 #include "log.h"
 
 #include <limits>
@@ -44,6 +47,8 @@ using namespace mu::engraving;
 using namespace muse::mpe;
 using namespace muse::async;
 
+static constexpr double LOADING_WINDOW_DURATION_SECS = 30.0;
+
 static const String METRONOME_INSTRUMENT_ID(u"metronome");
 static const String CHORD_SYMBOLS_INSTRUMENT_ID(u"chord_symbols");
 
@@ -81,8 +86,13 @@ void PlaybackModel::load(Score* score)
         TickBoundaries tickRange = tickBoundaries(range);
         TrackBoundaries trackRange = trackBoundaries(range);
 
+        // The contexts aren't cleared here: they re-render only the data affected by the changed range
         clearExpiredTracks();
-        clearExpiredContexts(trackRange.trackFrom, trackRange.trackTo);
+
+        // Most edits re-render exactly the same events for most of the affected tracks,
+        // so keep the previous state to notify only about the tracks that really changed
+        TrackDataSnapshots snapshots = takeSnapshots(trackRange.trackFrom, trackRange.trackTo);
+
         clearExpiredEvents(tickRange.tickFrom, tickRange.tickTo, trackRange.trackFrom, trackRange.trackTo);
 
         InstrumentTrackIdSet oldTracks = existingTrackIdSet();
@@ -90,16 +100,28 @@ void PlaybackModel::load(Score* score)
         ChangedTrackIdSet trackChanges;
         update(tickRange.tickFrom, tickRange.tickTo, trackRange.trackFrom, trackRange.trackTo, &trackChanges);
 
-        notifyAboutChanges(oldTracks, trackChanges);
+        notifyAboutChanges(oldTracks, actuallyChangedTracks(snapshots, trackChanges));
     });
 
-    update(0, m_score->lastMeasure()->endTick().ticks(), 0, m_score->ntracks());
+    const int scoreEndTick = m_score->lastMeasure()->endTick().ticks();
+    const int tickTo = m_windowedLoadingEnabled ? loadingWindowEndTick(0) : scoreEndTick;
+
+    update(0, tickTo, 0, m_score->ntracks());
 
     for (const auto& pair : m_playbackDataMap) {
         m_trackAdded.send(pair.first);
     }
 
     m_dataChanged.notify();
+
+    m_nextLoadingWindowTick = -1;
+
+    if (tickTo < scoreEndTick) {
+        m_nextLoadingWindowTick = tickTo;
+        muse::async::Async::call(this, [this]() {
+            loadNextWindow();
+        });
+    }
 }
 
 void PlaybackModel::reload()
@@ -117,6 +139,9 @@ void PlaybackModel::reload()
     clearExpiredTracks();
     clearExpiredContexts(trackFrom, trackTo);
 
+    // The whole score gets rendered below, no need to render the rest of the windows
+    m_nextLoadingWindowTick = -1;
+
     for (auto& pair : m_playbackDataMap) {
         pair.second.originEvents.clear();
     }
@@ -155,6 +180,16 @@ void PlaybackModel::setPlayChordSymbols(const bool isEnabled)
     m_playChordSymbols = isEnabled;
 }
 
+bool PlaybackModel::isWindowedLoadingEnabled() const
+{
+    return m_windowedLoadingEnabled;
+}
+
+void PlaybackModel::setWindowedLoadingEnabled(const bool isEnabled)
+{
+    m_windowedLoadingEnabled = isEnabled;
+}
+
 const InstrumentTrackId& PlaybackModel::metronomeTrackId() const
 {
     return METRONOME_TRACK_ID;
@@ -298,7 +333,7 @@ void PlaybackModel::update(const int tickFrom, const int tickTo, const track_idx
                            ChangedTrackIdSet* trackChanges)
 {
     updateSetupData();
-    updateContext(trackFrom, trackTo);
+    updateContext(tickFrom, tickTo, trackFrom, trackTo);
     updateEvents(tickFrom, tickTo, trackFrom, trackTo, trackChanges);
 }
 
@@ -324,7 +359,7 @@ void PlaybackModel::updateSetupData()
     m_setupResolver.resolveMetronomeSetupData(m_playbackDataMap[METRONOME_TRACK_ID].setupData);
 }
 
-void PlaybackModel::updateContext(const track_idx_t trackFrom, const track_idx_t trackTo)
+void PlaybackModel::updateContext(const int tickFrom, const int tickTo, const track_idx_t trackFrom, const track_idx_t trackTo)
 {
     for (const Part* part : m_score->parts()) {
         if (trackTo < part->startTrack() || trackFrom >= part->endTrack()) {
@@ -332,19 +367,19 @@ void PlaybackModel::updateContext(const track_idx_t trackFrom, const track_idx_t
         }
 
         for (const InstrumentTrackId& trackId : part->instrumentTrackIdSet()) {
-            updateContext(trackId);
+            updateContext(trackId, tickFrom, tickTo);
         }
 
         if (part->hasChordSymbol()) {
-            updateContext(chordSymbolsTrackId(part->id()));
+            updateContext(chordSymbolsTrackId(part->id()), tickFrom, tickTo);
         }
     }
 }
 
-void PlaybackModel::updateContext(const InstrumentTrackId& trackId)
+void PlaybackModel::updateContext(const InstrumentTrackId& trackId, const int tickFrom, const int tickTo)
 {
     PlaybackContextPtr ctx = playbackCtx(trackId);
-    ctx->update(trackId.partId, m_score, m_expandRepeats);
+    ctx->update(trackId.partId, m_score, m_expandRepeats, tickFrom, tickTo);
 
     PlaybackData& trackData = m_playbackDataMap[trackId];
     trackData.dynamics = ctx->dynamicLevelLayers(m_score);
@@ -352,7 +387,7 @@ void PlaybackModel::updateContext(const InstrumentTrackId& trackId)
 }
 
 void PlaybackModel::processSegment(const int tickPositionOffset, const Segment* segment, const std::set<staff_idx_t>& staffIdxSet,
-                                   bool isFirstSegmentOfMeasure, ChangedTrackIdSet* trackChanges)
+                                   bool isFirstSegmentOfMeasure, ChangedTrackIdSet* trackChanges, TrackEventsMap* renderTarget)
 {
     for (const EngravingItem* item : segment->annotations()) {
         if (!item || !item->part()) {
@@ -378,8 +413,7 @@ void PlaybackModel::processSegment(const int tickPositionOffset, const Segment*
         }
 
         if (chordSymbol->play()) {
-            m_renderer.renderChordSymbol(chordSymbol, tickPositionOffset, profile,
-                                         m_playbackDataMap[trackId].originEvents);
+            m_renderer.renderChordSymbol(chordSymbol, tickPositionOffset, profile, trackEvents(trackId, renderTarget));
         }
 
         collectChangesTracks(trackId, trackChanges);
@@ -406,7 +440,7 @@ void PlaybackModel::processSegment(const int tickPositionOffset, const Segment*
                 const MeasureRepeat* measureRepeat = toMeasureRepeat(item);
                 const Measure* currentMeasure = measureRepeat->measure();
 
-                processMeasureRepeat(tickPositionOffset, measureRepeat, currentMeasure, staffIdx, trackChanges);
+                processMeasureRepeat(tickPositionOffset, measureRepeat, currentMeasure, staffIdx, trackChanges, renderTarget);
 
                 continue;
             } else if (item->voice() == 0) {
@@ -415,7 +449,7 @@ void PlaybackModel::processSegment(const int tickPositionOffset, const Segment*
                 if (currentMeasure->measureRepeatCount(staffIdx) > 0) {
                     const MeasureRepeat* measureRepeat = currentMeasure->measureRepeatElement(staffIdx);
 
-                    processMeasureRepeat(tickPositionOffset, measureRepeat, currentMeasure, staffIdx, trackChanges);
+                    processMeasureRepeat(tickPositionOffset, measureRepeat, currentMeasure, staffIdx, trackChanges, renderTarget);
                     continue;
                 }
             }
@@ -428,14 +462,14 @@ void PlaybackModel::processSegment(const int tickPositionOffset, const Segment*
         }
 
         const PlaybackContextPtr ctx = playbackCtx(trackId);
-        m_renderer.render(item, tickPositionOffset, std::move(profile), ctx, m_playbackDataMap[trackId].originEvents);
+        m_renderer.render(item, tickPositionOffset, std::move(profile), ctx, trackEvents(trackId, renderTarget));
 
         collectChangesTracks(trackId, trackChanges);
     }
 }
 
 void PlaybackModel::processMeasureRepeat(const int tickPositionOffset, const MeasureRepeat* measureRepeat, const Measure* currentMeasure,
-                                         const staff_idx_t staffIdx, ChangedTrackIdSet* trackChanges)
+                                         const staff_idx_t staffIdx, ChangedTrackIdSet* trackChanges, TrackEventsMap* renderTarget)
 {
     if (!measureRepeat || !currentMeasure) {
         return;
@@ -461,7 +495,8 @@ void PlaybackModel::processMeasureRepeat(const int tickPositionOffset, const Mea
             continue;
         }
 
-        processSegment(tickPositionOffset + repeatPositionTickOffset, seg, { staffIdx }, isFirstSegmentOfRepeatedMeasure, trackChanges);
+        processSegment(tickPositionOffset + repeatPositionTickOffset, seg, { staffIdx }, isFirstSegmentOfRepeatedMeasure, trackChanges,
+                       renderTarget);
         isFirstSegmentOfRepeatedMeasure = false;
     }
 }
@@ -475,7 +510,99 @@ void PlaybackModel::updateEvents(const int tickFrom, const int tickTo, const tra
         return staff.isPrimaryStaff(); // skip linked staves
     });
 
-    const ArticulationsProfilePtr metronomeProfile = defaultActiculationProfile(METRONOME_TRACK_ID);
+    const bool isWholeScore = tickFrom == 0 && tickTo >= m_score->lastMeasure()->endTick().ticks();
+
+    if (isWholeScore && m_score->parts().size() > 1) {
+        updatePartEventsInParallel(tickFrom, tickTo, staffToProcessIdxSet, trackChanges);
+        renderEvents(tickFrom, tickTo, {}, true /*renderMetronome*/, trackChanges);
+        return;
+    }
+
+    renderEvents(tickFrom, tickTo, staffToProcessIdxSet, true /*renderMetronome*/, trackChanges);
+}
+
+void PlaybackModel::updatePartEventsInParallel(const int tickFrom, const int tickTo, const std::set<staff_idx_t>& staffIdxSet,
+                                               ChangedTrackIdSet* trackChanges)
+{
+    TRACEFUNC;
+
+    static muse::TaskScheduler scheduler;
+
+    struct PartEvents
+    {
+        TrackEventsMap events;
+        ChangedTrackIdSet changedTracks;
+    };
+
+    const std::vector<Part*>& parts = m_score->parts();
+    std::vector<PartEvents> partEvents(parts.size());
+    std::vector<std::future<void> > futures;
+    futures.reserve(parts.size());
+
+    // Everything below lazily fills caches on first access,
+    // so warm them up before the parts are rendered concurrently
+    repeatList();
+    defaultActiculationProfile(METRONOME_TRACK_ID);
+
+    for (const Part* part : parts) {
+        for (const InstrumentTrackId& trackId : part->instrumentTrackIdSet()) {
+            defaultActiculationProfile(trackId);
+            playbackCtx(trackId);
+        }
+
+        if (part->hasChordSymbol()) {
+            InstrumentTrackId trackId = chordSymbolsTrackId(part->id());
+            defaultActiculationProfile(trackId);
+            playbackCtx(trackId);
+        }
+    }
+
+    for (size_t i = 0; i < parts.size(); ++i) {
+        const Part* part = parts.at(i);
+
+        std::set<staff_idx_t> partStaffIdxSet;
+        for (staff_idx_t staffIdx : staffIdxSet) {
+            if (staffIdx * VOICES >= part->startTrack() && staffIdx * VOICES < part->endTrack()) {
+                partStaffIdxSet.insert(staffIdx);
+            }
+        }
+
+        if (partStaffIdxSet.empty()) {
+            continue;
+        }
+
+        PartEvents& result = partEvents.at(i);
+
+        futures.push_back(scheduler.submit([this, tickFrom, tickTo, partStaffIdxSet, &result]() {
+            renderEvents(tickFrom, tickTo, partStaffIdxSet, false /*renderMetronome*/, &result.changedTracks, &result.events);
+        }));
+    }
+
+    for (std::future<void>& future : futures) {
+        future.get();
+    }
+
+    for (PartEvents& result : partEvents) {
+        for (auto& pair : result.events) {
+            PlaybackEventsMap& originEvents = m_playbackDataMap[pair.first].originEvents;
+
+            for (auto& eventsPair : pair.second) {
+                PlaybackEventList& events = originEvents[eventsPair.first];
+                events.insert(events.end(), std::make_move_iterator(eventsPair.second.begin()),
+                              std::make_move_iterator(eventsPair.second.end()));
+            }
+        }
+
+        for (const InstrumentTrackId& trackId : result.changedTracks) {
+            collectChangesTracks(trackId, trackChanges);
+        }
+    }
+}
+
+void PlaybackModel::renderEvents(const int tickFrom, const int tickTo, const std::set<staff_idx_t>& staffIdxSet, bool renderMetronome,
+                                 ChangedTrackIdSet* trackChanges, TrackEventsMap* renderTarget)
+{
+    const ArticulationsProfilePtr metronomeProfile = renderMetronome ? defaultActiculationProfile(METRONOME_TRACK_ID) : nullptr;
 
     for (const RepeatSegment* repeatSegment : repeatList()) {
         int tickPositionOffset = repeatSegment->utick - repeatSegment->tick;
@@ -496,7 +623,7 @@ void PlaybackModel::updateEvents(const int tickFrom, const int tickTo, const tra
 
             bool isFirstSegmentOfMeasure = true;
 
-            for (Segment* segment = measure->first(); segment; segment = segment->next()) {
+            for (Segment* segment = measure->first(); segment && !staffIdxSet.empty(); segment = segment->next()) {
                 if (!segment->isChordRestType()) {
                     continue;
                 }
@@ -508,12 +635,16 @@ void PlaybackModel::updateEvents(const int tickFrom, const int tickTo, const tra
                     continue;
                 }
 
-                processSegment(tickPositionOffset, segment, staffToProcessIdxSet, isFirstSegmentOfMeasure, trackChanges);
+                processSegment(tickPositionOffset, segment, staffIdxSet, isFirstSegmentOfMeasure, trackChanges, renderTarget);
                 isFirstSegmentOfMeasure = false;
             }
 
+            if (!renderMetronome) {
+                continue;
+            }
+
             m_renderer.renderMetronome(m_score, measureStartTick, measureEndTick, tickPositionOffset,
-                                       metronomeProfile, m_playbackDataMap[METRONOME_TRACK_ID].originEvents);
+                                       metronomeProfile, trackEvents(METRONOME_TRACK_ID, renderTarget));
             collectChangesTracks(METRONOME_TRACK_ID, trackChanges);
         }
     }
@@ -729,6 +860,67 @@ void PlaybackModel::collectChangesTracks(const InstrumentTrackId& trackId, Chang
     result->insert(trackId);
 }
 
+PlaybackModel::TrackDataSnapshots PlaybackModel::takeSnapshots(const track_idx_t trackFrom, const track_idx_t trackTo) const
+{
+    TrackDataSnapshots result;
+
+    auto takeSnapshot = [this, &result](const InstrumentTrackId& trackId) {
+        auto search = m_playbackDataMap.find(trackId);
+        if (search == m_playbackDataMap.cend()) {
+            return;
+        }
+
+        const PlaybackData& data = search->second;
+        result.emplace(trackId, TrackDataSnapshot { data.originEvents, data.dynamics, data.params });
+    };
+
+    for (const Part* part : m_score->parts()) {
+        if (part->startTrack() > trackTo || part->endTrack() <= trackFrom) {
+            continue;
+        }
+
+        for (const InstrumentTrackId& trackId : part->instrumentTrackIdSet()) {
+            takeSnapshot(trackId);
+        }
+
+        takeSnapshot(chordSymbolsTrackId(part->id()));
+    }
+
+    takeSnapshot(METRONOME_TRACK_ID);
+
+    return result;
+}
+
+PlaybackModel::ChangedTrackIdSet PlaybackModel::actuallyChangedTracks(const TrackDataSnapshots& snapshots,
+                                                                      const ChangedTrackIdSet& renderedTracks) const
+{
+    ChangedTrackIdSet result;
+
+    for (const auto& pair : snapshots) {
+        auto search = m_playbackDataMap.find(pair.first);
+        if (search == m_playbackDataMap.cend()) {
+            continue;
+        }
+
+        const PlaybackData& data = search->second;
+        const TrackDataSnapshot& snapshot = pair.second;
+
+        if (data.originEvents != snapshot.originEvents
+            || data.dynamics != snapshot.dynamics
+            || data.params != snapshot.params) {
+            result.insert(pair.first);
+        }
+    }
+
+    for (const InstrumentTrackId& trackId : renderedTracks) {
+        if (!muse::contains(snapshots, trackId)) {
+            result.insert(trackId);
+        }
+    }
+
+    return result;
+}
+
 void PlaybackModel::notifyAboutChanges(const InstrumentTrackIdSet& oldTracks, const InstrumentTrackIdSet& changedTracks)
 {
     for (const InstrumentTrackId& trackId : changedTracks) {
@@ -869,6 +1061,57 @@ PlaybackModel::TickBoundaries PlaybackModel::tickBoundaries(const ScoreChangesRa
     return result;
 }
 
+int PlaybackModel::loadingWindowEndTick(const int tickFrom) const
+{
+    const TempoMap* tempoMap = m_score->tempomap();
+    const int scoreEndTick = m_score->lastMeasure()->endTick().ticks();
+
+    double windowEndTime = tempoMap->tick2time(tickFrom) + LOADING_WINDOW_DURATION_SECS;
+    int windowEndTick = std::max(tempoMap->time2tick(windowEndTime), tickFrom + 1);
+
+    // Windows always end on a measure boundary, the events are rendered measure by measure anyway
+    const Measure* measure = m_score->tick2measure(Fraction::fromTicks(windowEndTick));
+    if (!measure || measure->endTick().ticks() >= scoreEndTick) {
+        return scoreEndTick;
+    }
+
+    return measure->endTick().ticks();
+}
+
+void PlaybackModel::loadNextWindow()
+{
+    TRACEFUNC;
+
+    if (!m_score || !m_score->lastMeasure() || m_nextLoadingWindowTick < 0) {
+        return;
+    }
+
+    const int tickFrom = m_nextLoadingWindowTick;
+    const int tickTo = loadingWindowEndTick(tickFrom);
+    const track_idx_t trackTo = m_score->ntracks();
+
+    // The beginning of the window may already contain the events rendered with the previous window,
+    // or by an edit of the score made in the meantime
+    clearExpiredEvents(tickFrom, tickTo, 0, trackTo);
+
+    InstrumentTrackIdSet oldTracks = existingTrackIdSet();
+
+    ChangedTrackIdSet trackChanges;
+    updateEvents(tickFrom, tickTo, 0, trackTo, &trackChanges);
+
+    notifyAboutChanges(oldTracks, trackChanges);
+
+    if (tickTo >= m_score->lastMeasure()->endTick().ticks()) {
+        m_nextLoadingWindowTick = -1;
+        return;
+    }
+
+    m_nextLoadingWindowTick = tickTo;
+    muse::async::Async::call(this, [this]() {
+        loadNextWindow();
+    });
+}
+
 const RepeatList& PlaybackModel::repeatList() const
 {
     m_score->masterScore()->setExpandRepeats(m_expandRepeats);
@@ -936,6 +1179,15 @@ muse::mpe::ArticulationsProfilePtr PlaybackModel::defaultActiculationProfile(con
     return profilesRepository()->defaultProfile(it->second.setupData.category);
 }
 
+PlaybackEventsMap& PlaybackModel::trackEvents(const InstrumentTrackId& trackId, TrackEventsMap* renderTarget)
+{
+    if (renderTarget) {
+        return (*renderTarget)[trackId];
+    }
+
+    return m_playbackDataMap[trackId].originEvents;
+}
+
 PlaybackContextPtr PlaybackModel::playbackCtx(const InstrumentTrackId& trackId)
 {
     auto it = m_playbackCtxMap.find(trackId);
@@ -68,6 +68,11 @@ public:
     bool isPlayChordSymbolsEnabled() const;
     void setPlayChordSymbols(const bool isEnabled);
 
+    //! NOTE: When enabled, load() renders only the beginning of the score
+    //! and the rest of it is rendered window by window afterwards, so that the playback can start earlier on huge scores
+    bool isWindowedLoadingEnabled() const;
+    void setWindowedLoadingEnabled(const bool isEnabled);
+
     const InstrumentTrackId& metronomeTrackId() const;
     InstrumentTrackId chordSymbolsTrackId(const ID& partId) const;
     bool isChordSymbolsTrack(const InstrumentTrackId& trackId) const;
@@ -89,6 +94,16 @@ private:
     static const InstrumentTrackId CHORD_SYMBOLS_TRACK_ID;
 
     using ChangedTrackIdSet = InstrumentTrackIdSet;
+    using TrackEventsMap = std::unordered_map<InstrumentTrackId, muse::mpe::PlaybackEventsMap>;
+
+    struct TrackDataSnapshot
+    {
+        muse::mpe::PlaybackEventsMap originEvents;
+        muse::mpe::DynamicLevelLayers dynamics;
+        muse::mpe::PlaybackParamLayers params;
+    };
+
+    using TrackDataSnapshots = std::unordered_map<InstrumentTrackId, TrackDataSnapshot>;
 
     struct TickBoundaries
     {
@@ -109,15 +124,21 @@ private:
     void update(const int tickFrom, const int tickTo, const track_idx_t trackFrom, const track_idx_t trackTo,
                 ChangedTrackIdSet* trackChanges = nullptr);
     void updateSetupData();
-    void updateContext(const track_idx_t trackFrom, const track_idx_t trackTo);
-    void updateContext(const InstrumentTrackId& trackId);
+    void updateContext(const int tickFrom, const int tickTo, const track_idx_t trackFrom, const track_idx_t trackTo);
+    void updateContext(const InstrumentTrackId& trackId, const int tickFrom, const int tickTo);
     void updateEvents(const int tickFrom, const int tickTo, const track_idx_t trackFrom, const track_idx_t trackTo,
                       ChangedTrackIdSet* trackChanges = nullptr);
+    void updatePartEventsInParallel(const int tickFrom, const int tickTo, const std::set<staff_idx_t>& staffIdxSet,
+                                    ChangedTrackIdSet* trackChanges);
+    void renderEvents(const int tickFrom, const int tickTo, const std::set<staff_idx_t>& staffIdxSet, bool renderMetronome,
+                      ChangedTrackIdSet* trackChanges, TrackEventsMap* renderTarget = nullptr);
 
     void processSegment(const int tickPositionOffset, const Segment* segment, const std::set<staff_idx_t>& staffIdxSet,
-                        bool isFirstSegmentOfMeasure, ChangedTrackIdSet* trackChanges);
+                        bool isFirstSegmentOfMeasure, ChangedTrackIdSet* trackChanges, TrackEventsMap* renderTarget);
     void processMeasureRepeat(const int tickPositionOffset, const MeasureRepeat* measureRepeat, const Measure* currentMeasure,
-                              const staff_idx_t staffIdx, ChangedTrackIdSet* trackChanges);
+                              const staff_idx_t staffIdx, ChangedTrackIdSet* trackChanges, TrackEventsMap* renderTarget);
+
+    muse::mpe::PlaybackEventsMap& trackEvents(const InstrumentTrackId& trackId, TrackEventsMap* renderTarget);
 
     bool hasToReloadTracks(const ScoreChangesRange& changesRange) const;
     bool hasToReloadScore(const ScoreChangesRange& changesRange) const;
@@ -127,6 +148,8 @@ private:
     void clearExpiredContexts(const track_idx_t trackFrom, const track_idx_t trackTo);
     void clearExpiredEvents(const int tickFrom, const int tickTo, const track_idx_t trackFrom, const track_idx_t trackTo);
     void collectChangesTracks(const InstrumentTrackId& trackId, ChangedTrackIdSet* result);
+    TrackDataSnapshots takeSnapshots(const track_idx_t trackFrom, const track_idx_t trackTo) const;
+    ChangedTrackIdSet actuallyChangedTracks(const TrackDataSnapshots& snapshots, const ChangedTrackIdSet& renderedTracks) const;
     void notifyAboutChanges(const InstrumentTrackIdSet& oldTracks, const InstrumentTrackIdSet& changedTracks);
 
     void removeEventsFromRange(const track_idx_t trackFrom, const track_idx_t trackTo, const muse::mpe::timestamp_t timestampFrom = -1,
@@ -137,6 +160,9 @@ private:
     TrackBoundaries trackBoundaries(const ScoreChangesRange& changesRange) const;
     TickBoundaries tickBoundaries(const ScoreChangesRange& changesRange) const;
 
+    int loadingWindowEndTick(const int tickFrom) const;
+    void loadNextWindow();
+
     const RepeatList& repeatList() const;
 
     std::vector<const EngravingItem*> filterPlayableItems(const std::vector<const EngravingItem*>& items) const;
@@ -148,6 +174,8 @@ private:
     Score* m_score = nullptr;
     bool m_expandRepeats = true;
     bool m_playChordSymbols = true;
+    bool m_windowedLoadingEnabled = false;
+    int m_nextLoadingWindowTick = -1;
 
     PlaybackEventsRenderer m_renderer;
     PlaybackSetupDataResolver m_setupResolver;
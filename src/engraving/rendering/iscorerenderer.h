@@ -112,6 +112,12 @@ public:
         int trimMarginPixelSize = -1;
         int deviceDpi = -1;
 
+        //! NOTE Repaint systems from their recorded display lists instead of drawing the items,
+        //! the lists are rebuilt for the systems changed by layout.
+        //! Changes that don't go through layout (colors, drop target...) must bump the generation
+        bool useDisplayList = false;
+        int displayListGeneration = 0;
+
         std::function<void(muse::draw::Painter* painter, const Page* page, const RectF& pageRect)> onPaintPageSheet;
         std::function<void()> onNewPage;
     };
@@ -76,16 +76,16 @@ void Autoplace::autoplaceSegmentElement(const EngravingItem* item, EngravingItem
 
         SkylineLine& staffSkyline = above ? ss->skyline().north() : ss->skyline().south();
 
-        SkylineLine filteredSkyline = staffSkyline.getFilteredCopy([item](const ShapeElement& shapeEl) {
+        auto filterOut = [item](const ShapeElement& shapeEl) {
             const EngravingItem* skylineItem = shapeEl.item();
             if (!skylineItem) {
                 return false;
             }
             return itemsShouldIgnoreEachOther(item, skylineItem);
-        });
+        };
 
-        double d = above ? filteredSkyline.minDistanceToShapeAbove(shape, minSkylineHorizontalClearance)
-                   : filteredSkyline.minDistanceToShapeBelow(shape, minSkylineHorizontalClearance);
+        double d = above ? staffSkyline.minDistanceToShapeAbove(shape, minSkylineHorizontalClearance, filterOut)
+                   : staffSkyline.minDistanceToShapeBelow(shape, minSkylineHorizontalClearance, filterOut);
 
         if (d > -minDistance) {
             double yd = d + minDistance;
@@ -125,6 +125,8 @@ void BeamTremoloLayout::offsetBeamToRemoveCollisions(const BeamBase* item, const
     const ChordRest* firstChordRest = chordRests.front();
     const ChordRest* lastChordRest = chordRests.back();
 
+    const PointF itemPagePos = item->pagePos();
+
     size_t curChordRest = 0;
     for (ChordRest* chordRest : chordRests) {
         if (!chordRest->isChord() || chordRest == ldata->elements.back() || chordRest == ldata->elements.front()) {
@@ -157,9 +159,16 @@ void BeamTremoloLayout::offsetBeamToRemoveCollisions(const BeamBase* item, const
             }
         }
 
-        PointF anchor = chordBeamAnchor(ldata, chordRest, ChordBeamAnchorType::Middle) - item->pagePos();
+        PointF anchor = chordBeamAnchor(ldata, chordRest, ChordBeamAnchorType::Middle) - itemPagePos;
 
         const int minLen = minStemLength(chordRest, ldata) - sameLineException;
+        const double minLenMag = round(minLen * chordRest->mag());
+
+        // the note end of the stem doesn't depend on the beam position, so it is not recomputed
+        // for every candidate position below (pagePos() walks up the whole parent chain)
+        const Note* note = ldata->up ? toChord(chordRest)->downNote() : toChord(chordRest)->upNote();
+        const double noteAnchor = (ldata->up ? note->stemUpSE().y() : note->stemDownNW().y()) + note->pagePos().y()
+                                  - itemPagePos.y();
 
         // avoid division by zero for zero-length beams (can exist as a pre-layout state used
         // for horizontal spacing computations)
@@ -182,13 +191,10 @@ void BeamTremoloLayout::offsetBeamToRemoveCollisions(const BeamBase* item, const
                 const bool beamClearsAnchor = (ldata->up && muse::RealIsEqualOrLess(desiredY, anchor.y() + reduction))
                                               || (!ldata->up && muse::RealIsEqualOrMore(desiredY, anchor.y() - reduction));
 
-                const Note* note = ldata->up ? toChord(chordRest)->downNote() : toChord(chordRest)->upNote();
-                const double noteAnchor = (ldata->up ? note->stemUpSE().y() : note->stemDownNW().y()) + note->pagePos().y()
-                                          - item->pagePos().y();
                 // Resultant length in quarter spaces
                 const int desiredLen = std::abs(round((desiredY - noteAnchor) / ldata->spatium * 4)) + 1;
 
-                if (beamClearsAnchor && desiredLen >= round(minLen * chordRest->mag())) {
+                if (beamClearsAnchor && desiredLen >= minLenMag) {
                     break;
                 }
 
@@ -3472,7 +3472,7 @@ void ChordLayout::fillShape(const Chord* item, ChordRest::LayoutData* ldata)
         }
     }
 
-    ldata->setShape(shape);
+    ldata->setShape(std::move(shape));
 }
 
 void ChordLayout::fillShape(const Rest* item, Rest::LayoutData* ldata)
@@ -3495,7 +3495,7 @@ void ChordLayout::fillShape(const Rest* item, Rest::LayoutData* ldata)
         }
     }
 
-    ldata->setShape(shape);
+    ldata->setShape(std::move(shape));
 }
 
 void ChordLayout::fillShape(const MeasureRepeat* item, MeasureRepeat::LayoutData* ldata, const LayoutConfiguration&)
@@ -3505,7 +3505,7 @@ void ChordLayout::fillShape(const MeasureRepeat* item, MeasureRepeat::LayoutData
     shape.add(item->numberRect(), item);
     shape.add(item->symBbox(ldata->symId), item);
 
-    ldata->setShape(shape);
+    ldata->setShape(std::move(shape));
 }
 
 void ChordLayout::fillShape(const MMRest* item, MMRest::LayoutData* ldata, const LayoutConfiguration& conf)
@@ -3518,7 +3518,7 @@ void ChordLayout::fillShape(const MMRest* item, MMRest::LayoutData* ldata, const
         shape.add(item->numberRect().translated(item->numberPos()), item);
     }
 
-    ldata->setShape(shape);
+    ldata->setShape(std::move(shape));
 }
 
 void ChordLayout::addLineAttachPoints(Spanner* spanner)
@@ -25,6 +25,8 @@
 
 #include "dom/score.h"
 
+#include "layoutstatistics.h"
+
 using namespace mu::engraving;
 using namespace mu::engraving::rendering::score;
 
@@ -43,3 +45,8 @@ std::string DumpLayoutData::dump(const Score* s)
     dumpLayoutData(s->rootItem(), ss);
     return ss.str();
 }
+
+std::string DumpLayoutData::dumpStatistics()
+{
+    return LayoutStatistics::instance()->toJson();
+}
@@ -35,6 +35,9 @@ public:
     DumpLayoutData();
 
     static std::string dump(const Score* s);
+
+    //! NOTE Collected layout statistics as JSON, see LayoutStatistics
+    static std::string dumpStatistics();
 };
 }
 
@@ -890,6 +890,12 @@ double HorizontalSpacing::minHorizontalDistance(const Shape& f, const Shape& s,
 {
     double dist = -DBL_MAX;        // min real
     double absoluteMinPadding = 0.1 * spatium * squeezeFactor;
+
+    // For big shapes, only the elements of f in the vertical band of r2 can intersect it
+    static constexpr size_t INDEX_MIN_SIZE = 16;
+    const bool useIndex = f.size() >= INDEX_MIN_SIZE;
+    std::vector<bool> inBand;
+
     for (const ShapeElement& r2 : s.elements()) {
         if (r2.isNull()) {
             continue;
@@ -897,7 +903,17 @@ double HorizontalSpacing::minHorizontalDistance(const Shape& f, const Shape& s,
         const EngravingItem* item2 = r2.item();
         double by1 = r2.top();
         double by2 = r2.bottom();
-        for (const ShapeElement& r1 : f.elements()) {
+
+        if (useIndex) {
+            // NOTE: the vertical clearance currently only depends on item2,
+            // widen the band slightly anyway, the exact test is done below
+            const double margin = computeVerticalClearance(nullptr, item2, spatium) * squeezeFactor + 0.01 * spatium;
+            inBand.assign(f.size(), false);
+            f.forEachInVerticalBand(by1 - margin, by2 + margin, [&inBand](size_t idx) { inBand[idx] = true; });
+        }
+
+        for (size_t i = 0; i < f.elements().size(); ++i) {
+            const ShapeElement& r1 = f.elements()[i];
             if (r1.isNull()) {
                 continue;
             }
@@ -905,19 +921,21 @@ double HorizontalSpacing::minHorizontalDistance(const Shape& f, const Shape& s,
             double ay1 = r1.top();
             double ay2 = r1.bottom();
             double verticalClearance = computeVerticalClearance(item1, item2, spatium) * squeezeFactor;
-            bool intersection = mu::engraving::intersects(ay1, ay2, by1, by2, verticalClearance);
-            double padding = 0;
+            bool intersection = (!useIndex || inBand[i]) && mu::engraving::intersects(ay1, ay2, by1, by2, verticalClearance);
             KerningType kerningType = KerningType::NON_KERNING;
             if (item1 && item2) {
-                padding = computePadding(item1, item2);
-                padding *= squeezeFactor;
-                padding = std::max(padding, absoluteMinPadding);
                 kerningType = computeKerning(item1, item2);
             }
             if ((intersection && kerningType != KerningType::ALLOW_COLLISION)
                 || (r1.width() == 0 || r2.width() == 0)  // Temporary hack: shapes of zero-width are assumed to collide with everyghin
                 || (!item1 && item2 && item2->isLyrics())  // Temporary hack: avoids collision with melisma line
                 || kerningType == KerningType::NON_KERNING) {
+                double padding = 0;
+                if (item1 && item2) {
+                    padding = computePadding(item1, item2);
+                    padding *= squeezeFactor;
+                    padding = std::max(padding, absoluteMinPadding);
+                }
                 dist = std::max(dist, r1.right() - r2.left() + padding);
             }
         }
@@ -34,6 +34,8 @@
 
 #include "../layoutoptions.h"
 
+#include "layoutmemo.h"
+
 #ifdef MUE_ENABLE_ENGRAVING_RENDER_DEBUG
 #include "log.h"
 #include "logstream.h"
@@ -103,6 +105,7 @@ public:
 
     bool isShowVBox() const { return options().isShowVBox; }
     double noteHeadWidth() const { return options().noteHeadWidth; }
+    bool isParallelChordLayout() const { return options().isParallelChordLayout; }
     bool isShowInvisible() const;
     int pageNumberOffset() const;
     bool isVerticalSpreadEnabled() const;
@@ -218,6 +221,7 @@ public:
     const Fraction& tick() const { return m_tick; }
     const Fraction& startTick() const { return m_startTick; }
     const Fraction& endTick() const { return m_endTick; }
+    const Fraction& editStartTick() const { return m_editStartTick; }
     bool isLayoutAll() const { return m_isLayoutAll; }
 
     const Page* page() const { return m_page; }
@@ -232,6 +236,7 @@ public:
     const MeasureBase* nextMeasure() const { return m_nextMeasure; }
     const MeasureBase* systemOldMeasure() const { return m_systemOldMeasure; }
     const MeasureBase* pageOldMeasure() const { return m_pageOldMeasure; }
+    double systemOldHeight() const { return m_systemOldHeight; }
     int measureNo() const { return m_measureNo; }
 
     bool rangeDone() const { return m_rangeDone; }
@@ -246,6 +251,7 @@ public:
     void setTick(const Fraction& t) { m_tick = t; }
     void setStartTick(const Fraction& t) { m_startTick = t; }
     void setEndTick(const Fraction& t) { m_endTick = t; }
+    void setEditStartTick(const Fraction& t) { m_editStartTick = t; }
     void setIsLayoutAll(bool v) { m_isLayoutAll = v; }
 
     Page* page() { return m_page; }
@@ -267,6 +273,7 @@ public:
     void setNextMeasure(MeasureBase* m) { m_nextMeasure = m; }
     void setSystemOldMeasure(MeasureBase* m) { m_systemOldMeasure = m; }
     void setPageOldMeasure(MeasureBase* m) { m_pageOldMeasure = m; }
+    void setSystemOldHeight(double h) { m_systemOldHeight = h; }
     void setMeasureNo(int no) { m_measureNo = no; }
 
     std::set<Spanner*>& processedSpanners() { return m_processedSpanners; }
@@ -284,6 +291,7 @@ private:
     Fraction m_tick{ 0, 1 };
     Fraction m_startTick;
     Fraction m_endTick;
+    Fraction m_editStartTick;               // start of the edited range, startTick is moved back to the start of its system
     bool m_isLayoutAll = false;
 
     Page* m_page = nullptr;
@@ -298,6 +306,7 @@ private:
     MeasureBase* m_nextMeasure = nullptr;
     MeasureBase* m_systemOldMeasure = nullptr;
     MeasureBase* m_pageOldMeasure = nullptr;
+    double m_systemOldHeight = -1.0;        // height of the reused system in the previous layout, -1 if new
     int m_measureNo = 0;
 
     std::set<Spanner*> m_processedSpanners;
@@ -389,6 +398,9 @@ public:
     const LayoutState& state() const;
     LayoutState& mutState();
 
+    // Cache of layout results, valid for this layout run
+    LayoutMemo& memo() const { return m_memo; }
+
     // Mark
     void setLayout(const Fraction& tick1, const Fraction& tick2, staff_idx_t staff1, staff_idx_t staff2, const EngravingItem* e);
     void addRefresh(const RectF& r);
@@ -407,6 +419,7 @@ private:
     LayoutConfiguration m_configuration;
     DomAccessor m_dom;
     LayoutState m_state;
+    mutable LayoutMemo m_memo;
 };
 }
 
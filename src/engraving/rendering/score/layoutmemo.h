@@ -0,0 +1,106 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-Studio-CLA-applies
+ *
+ * MuseScore Studio
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2024 MuseScore Limited
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef MU_ENGRAVING_LAYOUTMEMO_DEV_H
+#define MU_ENGRAVING_LAYOUTMEMO_DEV_H
+
+#include <unordered_map>
+#include <vector>
+
+#include "../../dom/key.h"
+#include "../../infrastructure/shape.h"
+#include "../../types/types.h"
+
+namespace mu::engraving::rendering::score {
+//---------------------------------------------------------
+//   LayoutMemo
+//    Results of item layouts that only depend on a few
+//    resolved inputs, reused for identical items during
+//    one layout run. Style and font can't change during a
+//    run, so they are not part of the keys.
+//---------------------------------------------------------
+
+class LayoutMemo
+{
+public:
+
+    struct KeySigKey {
+        ClefType clef = ClefType::G;
+        int key = 0;
+        int naturals = 0;
+        int naturalsOffset = 0;
+        bool prefixNaturals = false;
+        double magS = 0.0;
+        double step = 0.0;
+
+        bool operator==(const KeySigKey& k) const
+        {
+            return clef == k.clef && key == k.key && naturals == k.naturals && naturalsOffset == k.naturalsOffset
+                   && prefixNaturals == k.prefixNaturals && magS == k.magS && step == k.step;
+        }
+    };
+
+    struct KeySigEntry {
+        std::vector<KeySym> keySymbols;
+        Shape shape; // relative to the key signature position
+    };
+
+    const KeySigEntry* findKeySig(const KeySigKey& key) const
+    {
+        auto it = m_keySigs.find(key);
+        if (it == m_keySigs.end()) {
+            ++m_misses;
+            return nullptr;
+        }
+        ++m_hits;
+        return &it->second;
+    }
+
+    void storeKeySig(const KeySigKey& key, const KeySigEntry& entry) { m_keySigs[key] = entry; }
+
+    size_t hits() const { return m_hits; }
+    size_t misses() const { return m_misses; }
+
+private:
+
+    struct KeySigKeyHash {
+        size_t operator()(const KeySigKey& k) const
+        {
+            size_t h = std::hash<int>()(static_cast<int>(k.clef));
+            auto combine = [&h](size_t v) { h ^= v + 0x9e3779b9 + (h << 6) + (h >> 2); };
+            combine(std::hash<int>()(k.key));
+            combine(std::hash<int>()(k.naturals));
+            combine(std::hash<int>()(k.naturalsOffset));
+            combine(std::hash<bool>()(k.prefixNaturals));
+            combine(std::hash<double>()(k.magS));
+            combine(std::hash<double>()(k.step));
+            return h;
+        }
+    };
+
+    std::unordered_map<KeySigKey, KeySigEntry, KeySigKeyHash> m_keySigs;
+
+    mutable size_t m_hits = 0;
+    mutable size_t m_misses = 0;
+};
+}
+
+#endif // MU_ENGRAVING_LAYOUTMEMO_DEV_H
@@ -0,0 +1,134 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-Studio-CLA-applies
+ *
+ * MuseScore Studio
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2024 MuseScore Limited
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "layoutstatistics.h"
+
+#include "serialization/json.h"
+
+#include "../../types/typesconv.h"
+
+using namespace muse;
+using namespace mu::engraving;
+using namespace mu::engraving::rendering::score;
+
+LayoutStatistics* LayoutStatistics::instance()
+{
+    static LayoutStatistics s;
+    return &s;
+}
+
+void LayoutStatistics::setEnabled(bool arg)
+{
+    m_enabled.store(arg, std::memory_order_relaxed);
+}
+
+void LayoutStatistics::clear()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_passes.clear();
+    m_items.clear();
+}
+
+void LayoutStatistics::addPass(const char* name, int64_t nanoseconds)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    Counter& c = m_passes[name];
+    ++c.calls;
+    c.nanoseconds += nanoseconds;
+}
+
+void LayoutStatistics::addItem(ElementType type, int64_t nanoseconds)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    Counter& c = m_items[type];
+    ++c.calls;
+    c.nanoseconds += nanoseconds;
+}
+
+std::map<std::string, LayoutStatistics::Counter> LayoutStatistics::passes() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_passes;
+}
+
+std::map<ElementType, LayoutStatistics::Counter> LayoutStatistics::items() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_items;
+}
+
+static JsonObject counterToJson(const LayoutStatistics::Counter& c)
+{
+    JsonObject obj;
+    obj.set("calls", static_cast<double>(c.calls));
+    obj.set("ms", static_cast<double>(c.nanoseconds) / 1000000.0);
+    return obj;
+}
+
+std::string LayoutStatistics::toJson() const
+{
+    JsonObject passesObj;
+    for (const auto& p : passes()) {
+        passesObj.set(p.first, counterToJson(p.second));
+    }
+
+    JsonObject itemsObj;
+    for (const auto& p : items()) {
+        itemsObj.set(TConv::toXml(p.first).ascii(), counterToJson(p.second));
+    }
+
+    JsonObject root;
+    root.set("passes", passesObj);
+    root.set("items", itemsObj);
+
+    ByteArray json = JsonDocument(root).toJson();
+    return std::string(json.constChar(), json.size());
+}
+
+LayoutStatistics::Scope::Scope(const char* pass)
+    : m_pass(pass), m_active(LayoutStatistics::instance()->isEnabled())
+{
+    if (m_active) {
+        m_start = clock::now();
+    }
+}
+
+LayoutStatistics::Scope::Scope(ElementType item)
+    : m_item(item), m_active(LayoutStatistics::instance()->isEnabled())
+{
+    if (m_active) {
+        m_start = clock::now();
+    }
+}
+
+LayoutStatistics::Scope::~Scope()
+{
+    if (!m_active) {
+        return;
+    }
+
+    int64_t ns = std::chrono::duration_cast<std::chrono::nanoseconds>(clock::now() - m_start).count();
+    if (m_pass) {
+        LayoutStatistics::instance()->addPass(m_pass, ns);
+    } else {
+        LayoutStatistics::instance()->addItem(m_item, ns);
+    }
+}
@@ -0,0 +1,92 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-Studio-CLA-applies
+ *
+ * MuseScore Studio
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2024 MuseScore Limited
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef MU_ENGRAVING_LAYOUTSTATISTICS_DEV_H
+#define MU_ENGRAVING_LAYOUTSTATISTICS_DEV_H
+
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <string>
+
+#include "../../types/types.h"
+
+namespace mu::engraving::rendering::score {
+//! NOTE Collects call counts and cumulative time of the layout passes
+//! and of TLayout::layoutItem per element type.
+//! Disabled by default; when disabled the cost is a single atomic load per scope.
+class LayoutStatistics
+{
+public:
+    struct Counter {
+        size_t calls = 0;
+        int64_t nanoseconds = 0;
+    };
+
+    static LayoutStatistics* instance();
+
+    bool isEnabled() const { return m_enabled.load(std::memory_order_relaxed); }
+    void setEnabled(bool arg);
+
+    void clear();
+
+    void addPass(const char* name, int64_t nanoseconds);
+    void addItem(ElementType type, int64_t nanoseconds);
+
+    std::map<std::string, Counter> passes() const;
+    std::map<ElementType, Counter> items() const;
+
+    std::string toJson() const;
+
+    class Scope
+    {
+    public:
+        Scope(const char* pass);
+        Scope(ElementType item);
+        ~Scope();
+
+    private:
+        using clock = std::chrono::steady_clock;
+
+        const char* m_pass = nullptr;
+        ElementType m_item = ElementType::INVALID;
+        bool m_active = false;
+        clock::time_point m_start;
+    };
+
+private:
+    LayoutStatistics() = default;
+
+    std::atomic<bool> m_enabled = false;
+
+    mutable std::mutex m_mutex;
+    std::map<std::string, Counter> m_passes;
+    std::map<ElementType, Counter> m_items;
+};
+}
+
+#define LAYOUT_STATISTICS_SCOPE_CAT_(a, b) a##b
+#define LAYOUT_STATISTICS_SCOPE_CAT(a, b) LAYOUT_STATISTICS_SCOPE_CAT_(a, b)
+#define LAYOUT_STATISTICS_SCOPE(what) \
+    mu::engraving::rendering::score::LayoutStatistics::Scope LAYOUT_STATISTICS_SCOPE_CAT(_lstat, __LINE__)(what)
+
+#endif // MU_ENGRAVING_LAYOUTSTATISTICS_DEV_H
@@ -578,6 +578,8 @@ void LyricsLayout::collectLyricsVerses(staff_idx_t staffIdx, System* system, Lyr
     track_idx_t startTrack = staffIdx * VOICES;
     track_idx_t endTrack = startTrack + VOICES;
 
+    const double systemX = system->pageX();
+
     for (MeasureBase* mb : system->measures()) {
         if (!mb->isMeasure()) {
             continue;
@@ -593,10 +595,13 @@ void LyricsLayout::collectLyricsVerses(staff_idx_t staffIdx, System* system, Lyr
                 }
                 for (Lyrics* lyrics : toChordRest(element)->lyrics()) {
                     int verse = lyrics->no();
+                    // computed once here rather than for each skyline the lyrics are added to
+                    Shape shape = lyrics->addToSkyline() ? lyrics->highResShape().translated(PointF(lyrics->pageX() - systemX, 0.0))
+                                  : Shape();
                     if (lyrics->placeAbove()) {
-                        lyricsVersesAbove[verse].addLyrics(lyrics);
+                        lyricsVersesAbove[verse].addLyrics(lyrics, std::move(shape));
                     } else {
-                        lyricsVersesBelow[verse].addLyrics(lyrics);
+                        lyricsVersesBelow[verse].addLyrics(lyrics, std::move(shape));
                     }
                 }
             }
@@ -675,7 +680,7 @@ void LyricsLayout::checkCollisionsWithStaffElements(System* system, staff_idx_t
         if (lyricsVersesAbove.count(verse) == 0) {
             continue;
         }
-        SkylineLine verseSkyline = createSkylineForVerse(verse, false, lyricsVersesAbove, system);
+        SkylineLine verseSkyline = createSkylineForVerse(verse, false, lyricsVersesAbove);
         double minDistance = -verseSkyline.minDistance(staffSkylineNorth);
         if (minDistance < lyricsMinDist) {
             double diff = lyricsMinDist - minDistance;
@@ -687,7 +692,7 @@ void LyricsLayout::checkCollisionsWithStaffElements(System* system, staff_idx_t
         if (lyricsVersesBelow.count(verse) == 0) {
             continue;
         }
-        SkylineLine verseSkyline = createSkylineForVerse(verse, true, lyricsVersesBelow, system);
+        SkylineLine verseSkyline = createSkylineForVerse(verse, true, lyricsVersesBelow);
         double minDistance = -staffSkylineSouth.minDistance(verseSkyline);
         if (minDistance < lyricsMinDist) {
             double diff = lyricsMinDist - minDistance;
@@ -696,18 +701,16 @@ void LyricsLayout::checkCollisionsWithStaffElements(System* system, staff_idx_t
     }
 }
 
-SkylineLine LyricsLayout::createSkylineForVerse(int verse, bool north, const LyricsVersesMap& lyricsVerses, System* system)
+SkylineLine LyricsLayout::createSkylineForVerse(int verse, bool north, const LyricsVersesMap& lyricsVerses)
 {
-    double systemX = system->pageX();
-
     SkylineLine lyricsSkyline(north);
 
     if (lyricsVerses.count(verse) > 0) {
         const LyricsVerse& lyricsVerse = lyricsVerses.at(verse);
-        for (Lyrics* lyrics : lyricsVerse.lyrics()) {
+        for (size_t i = 0; i < lyricsVerse.lyrics().size(); ++i) {
+            const Lyrics* lyrics = lyricsVerse.lyrics()[i];
             if (lyrics->addToSkyline()) {
-                Shape lyricsShape = lyrics->highResShape().translated(PointF(lyrics->pageX() - systemX, lyrics->yRelativeToStaff()));
-                lyricsSkyline.add(lyricsShape);
+                lyricsSkyline.add(lyricsVerse.lyricsShapes()[i].translated(PointF(0.0, lyrics->yRelativeToStaff())));
             }
         }
         for (LyricsLineSegment* lyricsLineSeg : lyricsVerse.lines()) {
@@ -748,16 +751,15 @@ void LyricsLayout::moveThisVerseAndOuterOnes(int verse, int lastVerse, bool abov
 void LyricsLayout::addToSkyline(System* system, staff_idx_t staffIdx, LayoutContext& ctx, const LyricsVersesMap& lyricsVersesAbove,
                                 const LyricsVersesMap& lyricsVersesBelow)
 {
-    double systemX = system->pageX();
     // HACK: subtract minVerticalDistance here because it's added later during staff distance calculations. Needs a better solution.
     double lyricsVerticalPadding = ctx.conf().styleMM(Sid::lyricsMinBottomDistance) - ctx.conf().styleMM(Sid::minVerticalDistance);
     Skyline& skyline = system->staff(staffIdx)->skyline();
     for (auto& pair : lyricsVersesAbove) {
         const LyricsVerse& lyricsVerse = pair.second;
-        for (Lyrics* lyrics : lyricsVerse.lyrics()) {
+        for (size_t i = 0; i < lyricsVerse.lyrics().size(); ++i) {
+            const Lyrics* lyrics = lyricsVerse.lyrics()[i];
             if (lyrics->addToSkyline()) {
-                Shape lyricsShape
-                    = lyrics->highResShape().translated(PointF(lyrics->pageX() - systemX, lyrics->yRelativeToStaff()));
+                Shape lyricsShape = lyricsVerse.lyricsShapes()[i].translated(PointF(0.0, lyrics->yRelativeToStaff()));
                 skyline.north().add(lyricsShape.adjust(0.0, -lyricsVerticalPadding, 0.0, 0.0));
             }
         }
@@ -770,10 +772,10 @@ void LyricsLayout::addToSkyline(System* system, staff_idx_t staffIdx, LayoutCont
     }
     for (auto& pair : lyricsVersesBelow) {
         const LyricsVerse& lyricsVerse = pair.second;
-        for (Lyrics* lyrics : lyricsVerse.lyrics()) {
+        for (size_t i = 0; i < lyricsVerse.lyrics().size(); ++i) {
+            const Lyrics* lyrics = lyricsVerse.lyrics()[i];
             if (lyrics->addToSkyline()) {
-                Shape lyricsShape
-                    = lyrics->highResShape().translated(PointF(lyrics->pageX() - systemX, lyrics->yRelativeToStaff()));
+                Shape lyricsShape = lyricsVerse.lyricsShapes()[i].translated(PointF(0.0, lyrics->yRelativeToStaff()));
                 skyline.south().add(lyricsShape.adjust(0.0, 0.0, 0.0, lyricsVerticalPadding));
             }
         }
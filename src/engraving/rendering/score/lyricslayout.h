@@ -24,6 +24,8 @@
 
 #include "layoutcontext.h"
 
+#include "infrastructure/shape.h"
+
 namespace mu::engraving {
 class Score;
 class System;
@@ -39,12 +41,16 @@ class LyricsLayout
     struct LyricsVerse {
     private:
         std::vector<Lyrics*> m_lyrics;
+        std::vector<Shape> m_lyricsShapes;
         std::vector<LyricsLineSegment*> m_lines;
     public:
-        void addLyrics(Lyrics* l) { m_lyrics.push_back(l); }
+        // shapeInSystem: the lyrics' high-res shape placed horizontally in the system, but not vertically
+        // (the vertical position is only settled while checking collisions), empty if not added to skyline
+        void addLyrics(Lyrics* l, Shape shapeInSystem) { m_lyrics.push_back(l); m_lyricsShapes.push_back(std::move(shapeInSystem)); }
         void addLine(LyricsLineSegment* lls) { m_lines.push_back(lls); }
 
         const std::vector<Lyrics*>& lyrics() const { return m_lyrics; }
+        const std::vector<Shape>& lyricsShapes() const { return m_lyricsShapes; }
         const std::vector<LyricsLineSegment*>& lines() const { return m_lines; }
     };
 
@@ -76,7 +82,7 @@ private:
 
     static void checkCollisionsWithStaffElements(System* system, staff_idx_t staffIdx,  LayoutContext& ctx,
                                                  const LyricsVersesMap& lyricsVersesAbove, const LyricsVersesMap& lyricsVersesBelow);
-    static SkylineLine createSkylineForVerse(int verse, bool north, const LyricsVersesMap& lyricsVerses, System* system);
+    static SkylineLine createSkylineForVerse(int verse, bool north, const LyricsVersesMap& lyricsVerses);
     static void moveThisVerseAndOuterOnes(int verse, int lastVerse, bool above, double diff, const LyricsVersesMap& lyricsVerses);
 
     static void addToSkyline(System* system, staff_idx_t staffIdx, LayoutContext& ctx, const LyricsVersesMap& lyricsVersesAbove,
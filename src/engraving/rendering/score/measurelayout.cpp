@@ -52,6 +52,8 @@
 #include "dom/undo.h"
 #include "dom/utils.h"
 
+#include "concurrency/taskscheduler.h"
+
 #include "tlayout.h"
 #include "layoutcontext.h"
 #include "arpeggiolayout.h"
@@ -516,6 +518,57 @@ void MeasureLayout::createMMRest(LayoutContext& ctx, Measure* firstMeasure, Meas
     mmrMeasure->setPrev(firstMeasure->prev());
 }
 
+//---------------------------------------------------------
+//   refreshMMRest
+//    the existing mmrest of firstMeasure still covers
+//    firstMeasure to lastMeasure and none of them was edited,
+//    only restore what the previous system layout changed
+//---------------------------------------------------------
+
+void MeasureLayout::refreshMMRest(LayoutContext& ctx, Measure* firstMeasure, Measure* lastMeasure)
+{
+    Measure* mmrMeasure = firstMeasure->mmRest();
+    MeasureLayout::removeSystemTrailer(mmrMeasure);
+
+    Segment* underlyingSeg = lastMeasure->findSegmentR(SegmentType::Clef, lastMeasure->ticks());
+    Segment* mmrSeg = mmrMeasure->findSegment(SegmentType::Clef, lastMeasure->endTick());
+    if (underlyingSeg && mmrSeg) {
+        mmrSeg->setEnabled(underlyingSeg->enabled());
+        mmrSeg->setTrailer(underlyingSeg->trailer());
+    }
+
+    mmrMeasure->setPageBreak(lastMeasure->pageBreak());
+    mmrMeasure->setLineBreak(lastMeasure->lineBreak());
+    mmrMeasure->setNo(firstMeasure->no());
+    mmrMeasure->checkTrailer();
+
+    MeasureBase* nm = ctx.conf().isShowVBox() ? lastMeasure->next() : lastMeasure->nextMeasure();
+    mmrMeasure->setNext(nm);
+    mmrMeasure->setPrev(firstMeasure->prev());
+}
+
+//---------------------------------------------------------
+//   mmRestUpToDate
+//    return true if the existing mmrest of firstMeasure
+//    can be reused without being rebuilt
+//---------------------------------------------------------
+
+static bool mmRestUpToDate(const LayoutContext& ctx, const Measure* firstMeasure, const Measure* lastMeasure, int count,
+                           const Fraction& len)
+{
+    const Measure* mmrMeasure = firstMeasure->mmRest();
+    if (!mmrMeasure || ctx.state().isLayoutAll()) {
+        return false;
+    }
+
+    if (mmrMeasure->mmRestCount() != count || mmrMeasure->ticks() != len) {
+        return false;
+    }
+
+    // a measure ending at the edit start may have got a new clef or barline at its end
+    return lastMeasure->endTick() < ctx.state().editStartTick() || firstMeasure->tick() > ctx.state().endTick();
+}
+
 //---------------------------------------------------------
 // validMMRestMeasure
 //    return true if this might be a measure in a
@@ -798,7 +851,11 @@ void MeasureLayout::createMultiMeasureRestsIfNeed(MeasureBase* currentMB, Layout
         }
 
         if (n >= ctx.conf().styleI(Sid::minEmptyMeasures)) {
-            createMMRest(ctx, firstMeasure, lastMeasure, len);
+            if (mmRestUpToDate(ctx, firstMeasure, lastMeasure, n, len)) {
+                refreshMMRest(ctx, firstMeasure, lastMeasure);
+            } else {
+                createMMRest(ctx, firstMeasure, lastMeasure, len);
+            }
             ctx.mutState().setCurMeasure(firstMeasure->mmRest());
             ctx.mutState().setNextMeasure(ctx.conf().isShowVBox() ? lastMeasure->next() : lastMeasure->nextMeasure());
         } else {
@@ -935,25 +992,20 @@ void MeasureLayout::layoutMeasure(MeasureBase* currentMB, LayoutContext& ctx)
         BeamLayout::layoutNonCrossBeams(&s, ctx);
     }
 
-    for (staff_idx_t staffIdx = 0; staffIdx < ctx.dom().nstaves(); ++staffIdx) {
-        const Staff* staff = ctx.dom().staff(staffIdx);
-        if (!staff->show()) {
-            continue;
-        }
+    if (ctx.conf().isParallelChordLayout() && canLayoutPartsInParallel(measure)) {
+        layoutChordsInParallel(measure, ctx);
+    } else {
+        for (staff_idx_t staffIdx = 0; staffIdx < ctx.dom().nstaves(); ++staffIdx) {
+            const Staff* staff = ctx.dom().staff(staffIdx);
+            if (!staff->show()) {
+                continue;
+            }
 
-        for (Segment& segment : measure->segments()) {
-            if (segment.isChordRestType()) {
-                ChordLayout::layoutChords1(ctx, &segment, staffIdx);
-                ChordLayout::resolveVerticalRestConflicts(ctx, &segment, staffIdx);
-                for (voice_idx_t voice = 0; voice < VOICES; ++voice) {
-                    ChordRest* cr = segment.cr(staffIdx * VOICES + voice);
-                    if (cr) {
-                        for (Lyrics* l : cr->lyrics()) {
-                            if (l) {
-                                TLayout::layoutLyrics(l, ctx);
-                            }
-                        }
-                    }
+            for (Segment& segment : measure->segments()) {
+                if (segment.isChordRestType()) {
+                    ChordLayout::layoutChords1(ctx, &segment, staffIdx);
+                    ChordLayout::resolveVerticalRestConflicts(ctx, &segment, staffIdx);
+                    layoutLyrics(&segment, staffIdx, ctx);
                 }
             }
         }
@@ -1005,6 +1057,102 @@ void MeasureLayout::layoutMeasure(MeasureBase* currentMB, LayoutContext& ctx)
     ctx.mutState().setTick(ctx.state().tick() + measure->ticks());
 }
 
+void MeasureLayout::layoutLyrics(Segment* segment, staff_idx_t staffIdx, LayoutContext& ctx)
+{
+    for (voice_idx_t voice = 0; voice < VOICES; ++voice) {
+        ChordRest* cr = segment->cr(staffIdx * VOICES + voice);
+        if (cr) {
+            for (Lyrics* l : cr->lyrics()) {
+                if (l) {
+                    TLayout::layoutLyrics(l, ctx);
+                }
+            }
+        }
+    }
+}
+
+//---------------------------------------------------------
+//   canLayoutPartsInParallel
+//    Chords of different parts are independent from each other
+//    as long as nothing is moved or beamed across staves,
+//    since layoutChords1 looks at all staves of a part.
+//---------------------------------------------------------
+
+bool MeasureLayout::canLayoutPartsInParallel(const Measure* measure)
+{
+    for (const Segment& segment : measure->segments()) {
+        if (!segment.isChordRestType()) {
+            continue;
+        }
+        for (const EngravingItem* e : segment.elist()) {
+            if (!e || !e->isChordRest()) {
+                continue;
+            }
+            const ChordRest* cr = toChordRest(e);
+            if (cr->staffMove() != 0) {
+                return false;
+            }
+            if (cr->beam() && cr->beam()->cross()) {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+//---------------------------------------------------------
+//   layoutChordsInParallel
+//    Fan out layoutChords1 and rest conflict resolution per part,
+//    then lay out lyrics on the calling thread once all parts are done.
+//---------------------------------------------------------
+
+void MeasureLayout::layoutChordsInParallel(Measure* measure, LayoutContext& ctx)
+{
+    TRACEFUNC;
+
+    static muse::TaskScheduler scheduler;
+
+    std::vector<std::future<void> > futures;
+    futures.reserve(ctx.dom().parts().size());
+
+    for (const Part* part : ctx.dom().parts()) {
+        const staff_idx_t startStaff = part->startTrack() / VOICES;
+        const staff_idx_t endStaff = part->endTrack() / VOICES;
+
+        futures.push_back(scheduler.submit([measure, startStaff, endStaff, &ctx]() {
+            for (staff_idx_t staffIdx = startStaff; staffIdx < endStaff; ++staffIdx) {
+                if (!ctx.dom().staff(staffIdx)->show()) {
+                    continue;
+                }
+
+                for (Segment& segment : measure->segments()) {
+                    if (segment.isChordRestType()) {
+                        ChordLayout::layoutChords1(ctx, &segment, staffIdx);
+                        ChordLayout::resolveVerticalRestConflicts(ctx, &segment, staffIdx);
+                    }
+                }
+            }
+        }));
+    }
+
+    for (std::future<void>& f : futures) {
+        f.get();
+    }
+
+    for (staff_idx_t staffIdx = 0; staffIdx < ctx.dom().nstaves(); ++staffIdx) {
+        if (!ctx.dom().staff(staffIdx)->show()) {
+            continue;
+        }
+
+        for (Segment& segment : measure->segments()) {
+            if (segment.isChordRestType()) {
+                layoutLyrics(&segment, staffIdx, ctx);
+            }
+        }
+    }
+}
+
 void MeasureLayout::updateGraceNotes(Measure* measure, LayoutContext& ctx)
 {
     // Clean everything
@@ -1740,7 +1888,7 @@ Segment* MeasureLayout::addHeaderKeySig(Measure* m, bool isFirstKeysig, const St
         }
         keysig->setKeySigEvent(keyIdx);
         keysig->mutldata()->reset();
-        TLayout::layoutKeySig(keysig, keysig->mutldata(), ctx.conf());
+        TLayout::layoutKeySig(keysig, keysig->mutldata(), ctx);
         kSegment->setEnabled(true);
     } else if (keysig && isPitchedStaff) {
         // do not remove user modified keysigs
@@ -1950,7 +2098,7 @@ void MeasureLayout::addSystemTrailer(Measure* m, Measure* nm, LayoutContext& ctx
                     s->setTrailer(true);
                 }
                 keySig->setKeySigEvent(key2);
-                TLayout::layoutKeySig(keySig, keySig->mutldata(), ctx.conf());
+                TLayout::layoutKeySig(keySig, keySig->mutldata(), ctx);
                 //s->createShape(track / VOICES);
                 s->setEnabled(true);
             } else { /// !staffIsPitchedAtNextMeas || !needsCourtesy
@@ -78,6 +78,7 @@ public:
 private:
 
     static void createMMRest(LayoutContext& ctx, Measure* firstMeasure, Measure* lastMeasure, const Fraction& len);
+    static void refreshMMRest(LayoutContext& ctx, Measure* firstMeasure, Measure* lastMeasure);
 
     static int adjustMeasureNo(MeasureBase* m, int measureNo);
 
@@ -90,6 +91,10 @@ private:
     static void layoutMeasure(MeasureBase* currentMB, LayoutContext& ctx);
     static void checkStaffMoveValidity(Measure* measure, const LayoutContext& ctx);
 
+    static void layoutLyrics(Segment* segment, staff_idx_t staffIdx, LayoutContext& ctx);
+    static bool canLayoutPartsInParallel(const Measure* measure);
+    static void layoutChordsInParallel(Measure* measure, LayoutContext& ctx);
+
     static void createMultiMeasureRestsIfNeed(MeasureBase* currentMB, LayoutContext& ctx);
 };
 }
@@ -77,6 +77,10 @@ void ModifyDom::connectTremolo(Measure* m)
 
 void ModifyDom::cmdUpdateNotes(const Measure* measure, const DomAccessor& dom)
 {
+    // Trills may carry an accidental into this measure that requires a force-restate
+    const int ticks = measure->tick().ticks();
+    const SpannerMap::IntervalList spanners = dom.spannerMap().findOverlapping(ticks, ticks, true);
+
     for (staff_idx_t staffIdx = 0; staffIdx < dom.nstaves(); ++staffIdx) {
         const Staff* staff = dom.staff(staffIdx);
         if (!staff->show()) {
@@ -88,10 +92,7 @@ void ModifyDom::cmdUpdateNotes(const Measure* measure, const DomAccessor& dom)
         {
             as.init(staff->keySigEvent(measure->tick()));
 
-            // Trills may carry an accidental into this measure that requires a force-restate
-            int ticks = measure->tick().ticks();
-            auto spanners = dom.spannerMap().findOverlapping(ticks, ticks, true);
-            for (auto iter : spanners) {
+            for (const auto& iter : spanners) {
                 Spanner* spanner = iter.value;
                 if (spanner->staffIdx() != staffIdx || !spanner->isTrill()
                     || spanner->tick() == measure->tick() || spanner->tick2() == measure->tick()) {
@@ -58,6 +58,7 @@
 #include "tlayout.h"
 #include "tupletlayout.h"
 #include "verticalgapdata.h"
+#include "layoutstatistics.h"
 
 #include "log.h"
 
@@ -118,6 +119,7 @@ void PageLayout::getNextPage(LayoutContext& ctx)
 void PageLayout::collectPage(LayoutContext& ctx)
 {
     TRACEFUNC;
+    LAYOUT_STATISTICS_SCOPE("PageLayout::collectPage");
 
     Page* page = ctx.mutState().page();
     const LayoutConfiguration& conf = ctx.conf();
@@ -284,6 +286,9 @@ void PageLayout::collectPage(LayoutContext& ctx)
 
     Fraction stick2 = Fraction(-1, 1);
     for (System* s : page->systems()) {
+        // The staves may have been moved by the vertical justification
+        s->mutldata()->invalidateDisplayList();
+
         for (MeasureBase* mb : s->measures()) {
             if (!mb->isMeasure()) {
                 continue;
@@ -293,8 +298,11 @@ void PageLayout::collectPage(LayoutContext& ctx)
                 stick2 = m->tick();
             }
 
+            // only chord rests and bar lines are laid out again here, so other segments
+            // (clefs, key and time signatures, breaths...) are not visited for every track
+            static constexpr SegmentType relayoutSegmentTypes = SegmentType::ChordRest | SegmentType::BarLineType;
             for (size_t track = 0; track < ctx.dom().ntracks(); ++track) {
-                for (Segment* segment = m->first(); segment; segment = segment->next()) {
+                for (Segment* segment = m->first(relayoutSegmentTypes); segment; segment = segment->next(relayoutSegmentTypes)) {
                     EngravingItem* e2 = segment->element(track);
                     if (!e2) {
                         continue;
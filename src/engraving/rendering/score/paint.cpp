@@ -21,9 +21,16 @@
  */
 #include "paint.h"
 
+#include <algorithm>
+
 #include "draw/painter.h"
+#include "draw/bufferedpaintprovider.h"
+#include "draw/utils/drawdatapaint.h"
+#include "dom/measurebase.h"
+#include "dom/mscore.h"
 #include "dom/score.h"
 #include "dom/page.h"
+#include "dom/system.h"
 #include "dom/engravingitem.h"
 
 #include "tdraw.h"
@@ -75,6 +82,11 @@ void Paint::paintScore(Painter* painter, Score* score, const IScoreRenderer::Pai
     int fromPage = opt.fromPage >= 0 ? opt.fromPage : 0;
     int toPage = (opt.toPage >= 0 && opt.toPage < int(pages.size())) ? opt.toPage : (int(pages.size()) - 1);
 
+    SystemSelection selection;
+    if (opt.useDisplayList) {
+        selection = systemSelection(score);
+    }
+
     for (int copy = 0; copy < opt.copyCount; ++copy) {
         bool firstPage = true;
         for (int pi = fromPage; pi <= toPage; ++pi) {
@@ -144,8 +156,18 @@ void Paint::paintScore(Painter* painter, Score* score, const IScoreRenderer::Pai
                 disableClipping = true;
             }
 
-            std::vector<EngravingItem*> elements = page->items(drawRect.translated(-pagePos));
-            paintItems(*painter, elements);
+            //! NOTE With display lists, whole systems outside of the draw rect are skipped
+            //! without querying the page items, they are only needed for debug painting
+            std::vector<EngravingItem*> elements;
+            if (opt.useDisplayList) {
+                paintPageWithDisplayLists(*painter, score, page, drawRect.translated(-pagePos), selection, opt);
+                if (!opt.isPrinting && page->configuration()->debuggingOptions().anyEnabled()) {
+                    elements = page->items(drawRect.translated(-pagePos));
+                }
+            } else {
+                elements = page->items(drawRect.translated(-pagePos));
+                paintItems(*painter, elements);
+            }
             //DebugPaint::paintPageTree(*painter, page);
 
             if (disableClipping) {
@@ -229,6 +251,186 @@ void Paint::paintItem(Painter& painter, const EngravingItem* item)
     painter.translate(-itemPosition);
 }
 
+static System* systemOf(EngravingItem* item)
+{
+    EngravingItem* system = item->findAncestor(ElementType::SYSTEM);
+    return system ? toSystem(system) : nullptr;
+}
+
+static int viewFlags(const Score* score)
+{
+    return (score->isShowInvisible() ? 1 : 0)
+           | (score->showUnprintable() ? 2 : 0)
+           | (score->showFrames() ? 4 : 0)
+           | (score->showPageborders() ? 8 : 0)
+           | (score->showSoundFlags() ? 16 : 0)
+           | (score->markIrregularMeasures() ? 32 : 0);
+}
+
+Paint::SystemSelection Paint::systemSelection(const Score* score)
+{
+    SystemSelection result;
+    for (EngravingItem* item : score->selection().elements()) {
+        if (System* system = systemOf(item)) {
+            result[system].push_back(item);
+        }
+    }
+
+    for (auto& p : result) {
+        std::sort(p.second.begin(), p.second.end());
+    }
+
+    return result;
+}
+
+//! NOTE Width of the vertical strips, by which the items of a display list are indexed.
+//! In continuous view a system is the whole score, so only the strips under the frame are looked at
+static constexpr double DISPLAY_LIST_BAND_WIDTH = 4.0 * mu::engraving::DPI;
+
+static std::pair<size_t, size_t> bandRange(const System::DisplayList& list, const RectF& rect)
+{
+    const double left = std::max(rect.left() - list.bounds.left(), 0.0);
+    const double right = std::max(rect.right() - list.bounds.left(), 0.0);
+    const size_t last = list.bands.size() - 1;
+
+    return { std::min(static_cast<size_t>(left / DISPLAY_LIST_BAND_WIDTH), last),
+             std::min(static_cast<size_t>(right / DISPLAY_LIST_BAND_WIDTH), last) };
+}
+
+static void buildBands(System::DisplayList& list)
+{
+    list.bands.clear();
+    if (list.itemRects.empty()) {
+        return;
+    }
+
+    list.bands.resize(static_cast<size_t>(list.bounds.width() / DISPLAY_LIST_BAND_WIDTH) + 1);
+    for (size_t idx = 0; idx < list.itemRects.size(); ++idx) {
+        auto [first, last] = bandRange(list, list.itemRects.at(idx));
+        for (size_t band = first; band <= last; ++band) {
+            list.bands[band].push_back(idx);
+        }
+    }
+}
+
+static std::vector<size_t> visibleItems(const System::DisplayList& list, const RectF& drawRect)
+{
+    std::vector<size_t> result;
+    if (list.bands.empty()) {
+        return result;
+    }
+
+    auto [first, last] = bandRange(list, drawRect);
+    for (size_t band = first; band <= last; ++band) {
+        for (size_t idx : list.bands.at(band)) {
+            if (list.itemRects.at(idx).intersects(drawRect)) {
+                result.push_back(idx);
+            }
+        }
+    }
+
+    // Items spanning several strips are found more than once, and must be painted in the recorded order
+    if (first != last) {
+        std::sort(result.begin(), result.end());
+        result.erase(std::unique(result.begin(), result.end()), result.end());
+    }
+
+    return result;
+}
+
+void Paint::paintPageWithDisplayLists(Painter& painter, const Score* score, Page* page, const RectF& drawRect,
+                                      const SystemSelection& selection, const IScoreRenderer::PaintOptions& opt)
+{
+    TRACEFUNC;
+
+    static const std::vector<const EngravingItem*> EMPTY_SELECTION;
+
+    for (System* system : page->systems()) {
+        auto it = selection.find(system);
+        updateDisplayList(system, score, it != selection.end() ? it->second : EMPTY_SELECTION, opt);
+
+        const System::DisplayList& list = system->ldata()->displayList;
+        if (!list.bounds.intersects(drawRect)) {
+            continue;
+        }
+
+        std::vector<size_t> indices = visibleItems(list, drawRect);
+        if (!indices.empty()) {
+            DrawDataPaint::paint(&painter, list.data, indices);
+        }
+    }
+
+    // The page itself (header, footer) is not part of any system
+    if (!page->ldata()->isSkipDraw() && page->isInteractionAvailable()) {
+        paintItem(painter, page);
+    }
+}
+
+void Paint::updateDisplayList(System* system, const Score* score, const std::vector<const EngravingItem*>& selection,
+                              const IScoreRenderer::PaintOptions& opt)
+{
+    System::DisplayList& list = system->mutldata()->displayList;
+
+    const int deviceDpi = opt.deviceDpi > 0 ? opt.deviceDpi : mu::engraving::DPI;
+    const int flags = viewFlags(score);
+
+    if (list.data
+        && list.generation == opt.displayListGeneration
+        && list.deviceDpi == deviceDpi
+        && list.viewFlags == flags
+        && list.isPrinting == opt.isPrinting
+        && list.selection == selection) {
+        return;
+    }
+
+    TRACEFUNC;
+
+    //! NOTE Like Page::scanElements, the measures are not scanned by the system itself
+    //! NOTE The previous list has about the same size, reserve it so the vector is not regrown
+    std::vector<EngravingItem*> items;
+    items.reserve(list.itemRects.size());
+    auto collectItem = [&items](EngravingItem* item) { items.push_back(item); };
+    for (MeasureBase* mb : system->measures()) {
+        mb->scanItems(collectItem, false);
+    }
+    system->scanItems(collectItem, false);
+
+    std::sort(items.begin(), items.end(), mu::engraving::elementLessThan);
+
+    std::shared_ptr<BufferedPaintProvider> provider = std::make_shared<BufferedPaintProvider>();
+
+    list.itemRects.clear();
+    list.itemRects.reserve(items.size());
+    list.bounds = RectF();
+    {
+        Painter painter(provider, "system");
+        painter.setAntialiasing(true);
+
+        //! NOTE Every item is a top level object of the list, so on replay only the visible ones are painted
+        for (const EngravingItem* item : items) {
+            if (!item->isInteractionAvailable()) {
+                continue;
+            }
+
+            painter.beginObject(item->typeName());
+            paintItem(painter, item);
+            painter.endObject();
+
+            list.itemRects.push_back(item->pageBoundingRect(LD_ACCESS::MAYBE_NOTINITED));
+            list.bounds.unite(list.itemRects.back());
+        }
+    }
+
+    buildBands(list);
+
+    list.data = provider->drawData();
+    list.selection = selection;
+    list.generation = opt.displayListGeneration;
+    list.deviceDpi = deviceDpi;
+    list.viewFlags = flags;
+    list.isPrinting = opt.isPrinting;
+}
+
 void Paint::paintItems(Painter& painter, const std::vector<EngravingItem*>& items)
 {
     TRACEFUNC;
@@ -22,6 +22,7 @@
 #ifndef MU_ENGRAVING_PAINT_DEV_H
 #define MU_ENGRAVING_PAINT_DEV_H
 
+#include <map>
 #include <vector>
 
 #include "draw/painter.h"
@@ -31,6 +32,7 @@ namespace mu::engraving {
 class EngravingItem;
 class Page;
 class Score;
+class System;
 }
 
 namespace mu::engraving::rendering::score {
@@ -46,6 +48,13 @@ public:
     static SizeF pageSizeInch(const Score* score, const IScoreRenderer::PaintOptions& opt);
 
 private:
+    using SystemSelection = std::map<const System*, std::vector<const EngravingItem*> >;
+
+    static SystemSelection systemSelection(const Score* score);
+    static void paintPageWithDisplayLists(muse::draw::Painter& painter, const Score* score, Page* page, const RectF& drawRect,
+                                          const SystemSelection& selection, const IScoreRenderer::PaintOptions& opt);
+    static void updateDisplayList(System* system, const Score* score, const std::vector<const EngravingItem*>& selection,
+                                  const IScoreRenderer::PaintOptions& opt);
 };
 }
 
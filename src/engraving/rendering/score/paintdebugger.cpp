@@ -176,6 +176,11 @@ void PaintDebugger::drawPolygon(const PointF* points, size_t pointCount, Polygon
     m_real->drawPolygon(points, pointCount, mode);
 }
 
+void PaintDebugger::drawLines(const LineF* lines, size_t lineCount)
+{
+    m_real->drawLines(lines, lineCount);
+}
+
 void PaintDebugger::drawText(const PointF& point, const String& text)
 {
     m_real->drawText(point, text);
@@ -65,6 +65,7 @@ public:
 
     void drawPath(const muse::draw::PainterPath& path) override;
     void drawPolygon(const muse::PointF* points, size_t pointCount, muse::draw::PolygonMode mode) override;
+    void drawLines(const muse::LineF* lines, size_t lineCount) override;
 
     void drawText(const muse::PointF& point, const muse::String& text) override;
     void drawText(const muse::RectF& rect, int flags, const muse::String& text) override;
@@ -21,9 +21,12 @@
  */
 #include "passbase.h"
 
+#include "layoutstatistics.h"
+
 using namespace mu::engraving::rendering::score;
 
 void PassBase::run(Score* score, LayoutContext& ctx)
 {
+    LAYOUT_STATISTICS_SCOPE(name());
     doRun(score, ctx);
 }
@@ -35,6 +35,8 @@ public:
 
     void run(Score* score, LayoutContext& ctx);
 
+    virtual const char* name() const = 0;
+
 private:
 
     virtual void doRun(Score* score, LayoutContext& ctx) = 0;
@@ -33,6 +33,8 @@ class PassLayoutIndependentItems : public PassBase
 {
 public:
 
+    const char* name() const override { return "PassLayoutIndependentItems"; }
+
 private:
 
     void doRun(Score* score, LayoutContext& ctx) override;
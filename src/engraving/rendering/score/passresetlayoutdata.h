@@ -30,6 +30,8 @@ class PassResetLayoutData : public PassBase
 public:
     PassResetLayoutData() = default;
 
+    const char* name() const override { return "PassResetLayoutData"; }
+
 private:
     void doRun(Score* score, LayoutContext& ctx) override;
 };
@@ -15,6 +15,7 @@ set(RENDERING_SCORE_SRC
     ${CMAKE_CURRENT_LIST_DIR}/tlayout.h
     ${CMAKE_CURRENT_LIST_DIR}/layoutcontext.cpp
     ${CMAKE_CURRENT_LIST_DIR}/layoutcontext.h
+    ${CMAKE_CURRENT_LIST_DIR}/layoutmemo.h
     ${CMAKE_CURRENT_LIST_DIR}/scorelayout.cpp
     ${CMAKE_CURRENT_LIST_DIR}/scorelayout.h
     ${CMAKE_CURRENT_LIST_DIR}/scorepageviewlayout.cpp
@@ -73,4 +74,6 @@ set(RENDERING_SCORE_SRC
 
     ${CMAKE_CURRENT_LIST_DIR}/dumplayoutdata.cpp
     ${CMAKE_CURRENT_LIST_DIR}/dumplayoutdata.h
+    ${CMAKE_CURRENT_LIST_DIR}/layoutstatistics.cpp
+    ${CMAKE_CURRENT_LIST_DIR}/layoutstatistics.h
 )
@@ -169,6 +169,21 @@ void ScoreHorizontalViewLayout::layoutLinear(LayoutContext& ctx)
         }
         Measure* m = toMeasure(mb);
 
+        if (m->tick() < ctx.state().startTick() || m->tick() > ctx.state().endTick()) {
+            // outside of the edited range only the bar lines depend on the new staff distances,
+            // so there is no need to visit every segment of every track
+            for (Segment* segment = m->first(SegmentType::BarLineType); segment; segment = segment->next(SegmentType::BarLineType)) {
+                for (size_t track = 0; track < ctx.dom().ntracks(); ++track) {
+                    EngravingItem* e = segment->element(track);
+                    if (e && e->isBarLine()) {
+                        TLayout::layoutBarLine2(toBarLine(e), ctx);
+                    }
+                }
+            }
+            MeasureLayout::layout2(m, ctx);
+            continue;
+        }
+
         for (size_t track = 0; track < ctx.dom().ntracks(); ++track) {
             for (Segment* segment = m->first(); segment; segment = segment->next()) {
                 EngravingItem* e = segment->element(track);
@@ -176,9 +191,6 @@ void ScoreHorizontalViewLayout::layoutLinear(LayoutContext& ctx)
                     continue;
                 }
                 if (e->isChordRest()) {
-                    if (m->tick() < ctx.state().startTick() || m->tick() > ctx.state().endTick()) {
-                        continue;
-                    }
                     if (!ctx.dom().staff(track2staff(track))->show()) {
                         continue;
                     }
@@ -79,6 +79,7 @@ void ScoreLayout::layoutRange(Score* score, const Fraction& st, const Fraction&
     }
 
     ctx.mutState().setIsLayoutAll(isLayoutAll);
+    ctx.mutState().setEditStartTick(stick);
 
     // Init context and layout
     switch (ctx.conf().viewMode()) {
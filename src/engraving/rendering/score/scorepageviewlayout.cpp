@@ -35,6 +35,7 @@
 #include "measurelayout.h"
 #include "systemlayout.h"
 #include "pagelayout.h"
+#include "layoutstatistics.h"
 
 #include "log.h"
 
@@ -198,6 +199,7 @@ void ScorePageViewLayout::layoutPageView(Score* score, LayoutContext& ctx, const
 void ScorePageViewLayout::doLayout(LayoutContext& ctx)
 {
     LAYOUT_CALL();
+    LAYOUT_STATISTICS_SCOPE("ScorePageViewLayout::doLayout");
 
     LayoutState& state = ctx.mutState();
     MeasureLayout::getNextMeasure(ctx);
@@ -35,6 +35,7 @@
 #include "arpeggiolayout.h"
 #include "horizontalspacing.h"
 #include "slurtielayout.h"
+#include "layoutstatistics.h"
 
 #include "paint.h"
 
@@ -46,6 +47,7 @@ using namespace mu::engraving::rendering::score;
 
 void ScoreRenderer::layoutScore(Score* score, const Fraction& st, const Fraction& et) const
 {
+    LAYOUT_STATISTICS_SCOPE("ScoreRenderer::layoutScore");
     ScoreLayout::layoutRange(score, st, et);
 }
 
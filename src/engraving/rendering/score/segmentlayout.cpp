@@ -36,7 +36,7 @@ void SegmentLayout::layoutMeasureIndependentElements(const Segment& segment, tra
     if (segment.isJustType(SegmentType::KeySig)) {
         KeySig* ks = toKeySig(segment.element(track));
         if (ks) {
-            TLayout::layoutKeySig(ks, ks->mutldata(), ctx.conf());         // LD_INDEPENDENT
+            TLayout::layoutKeySig(ks, ks->mutldata(), ctx);         // LD_INDEPENDENT
         }
     } else if (segment.isJustType(SegmentType::Clef)) {
         Clef* cl = item_cast<Clef*>(segment.element(track));
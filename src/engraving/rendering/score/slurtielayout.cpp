@@ -46,6 +46,7 @@
 #include "tlayout.h"
 #include "chordlayout.h"
 #include "tremololayout.h"
+#include "layoutstatistics.h"
 #include "../engraving/types/symnames.h"
 
 #include "draw/types/transform.h"
@@ -56,6 +57,8 @@ using namespace mu::engraving::rendering::score;
 
 SpannerSegment* SlurTieLayout::layoutSystem(Slur* item, System* system, LayoutContext& ctx)
 {
+    LAYOUT_STATISTICS_SCOPE("SlurTieLayout::layoutSystem");
+
     const double horizontalTieClearance = 0.35 * item->spatium();
     const double tieClearance = 0.65 * item->spatium();
     const double continuedSlurOffsetY = item->spatium() * .4;
@@ -895,6 +898,40 @@ void SlurTieLayout::avoidCollisions(SlurSegment* slurSeg, PointF& pp1, PointF& p
 
     const double arcClearance = -upSign* computeArcClearance(spatium, slurLength, slurAngle);  // Collision clearance at the center of the slur
 
+    // The music under the slur doesn't change while the slur is adjusted, so sort it once by left edge.
+    // Each slur rectangle is then only tested against the elements that can overlap it horizontally,
+    // which gives the same result as testing the whole shape.
+    std::vector<RectF> sortedSegShapes;
+    sortedSegShapes.reserve(segShapes.elements().size());
+    double maxSegShapeExtent = 0.0;
+    for (const ShapeElement& el : segShapes.elements()) {
+        sortedSegShapes.push_back(el);
+        maxSegShapeExtent = std::max(maxSegShapeExtent, std::max(el.left(), el.right()) - el.left());
+    }
+    std::sort(sortedSegShapes.begin(), sortedSegShapes.end(), [](const RectF& a, const RectF& b) {
+        return a.left() < b.left();
+    });
+
+    auto collidesWithSegShapes = [&sortedSegShapes, maxSegShapeExtent, slurUp](const RectF& slurRect) {
+        const double rectLeft = slurRect.left();
+        const double rectRight = slurRect.right();
+        auto it = std::upper_bound(sortedSegShapes.begin(), sortedSegShapes.end(), rectLeft - maxSegShapeExtent,
+                                   [](double x, const RectF& r) { return x < r.left(); });
+        for (; it != sortedSegShapes.end() && it->left() < rectRight; ++it) {
+            const RectF& r = *it;
+            if (!mu::engraving::intersects(r.left(), r.right(), rectLeft, rectRight)) {
+                continue;
+            }
+            // Same as !Shape(slurRect).clearsVertically(segShapes) for up slurs
+            // and !segShapes.clearsVertically(slurRect) for down slurs
+            if (slurUp ? std::min(r.top(), r.bottom()) <= std::max(slurRect.top(), slurRect.bottom())
+                : std::min(slurRect.top(), slurRect.bottom()) <= std::max(r.top(), r.bottom())) {
+                return true;
+            }
+        }
+        return false;
+    };
+
     // balance: determines how much endpoint adjustment VS shape adjustment we will do.
     // 0 = end point is fixed, only the shape can be adjusted,
     // 1 = shape is fixed, only end the point can be adjusted.
@@ -955,9 +992,7 @@ void SlurTieLayout::avoidCollisions(SlurSegment* slurSeg, PointF& pp1, PointF& p
                 || (rightSection && collision.right)) {         // If a collision is already found in this section, no need to check again
                 continue;
             }
-            bool intersection = slur->up() ? !Shape(slurRects[i]).clearsVertically(segShapes)
-                                : !segShapes.clearsVertically(slurRects[i]);
-            if (intersection) {
+            if (collidesWithSegShapes(slurRects[i])) {
                 if (leftSection) {
                     collision.left = true;
                 }
@@ -1370,6 +1405,8 @@ static bool tieSegmentShouldBeSkipped(Tie* item)
 
 TieSegment* SlurTieLayout::tieLayoutFor(Tie* item, System* system)
 {
+    LAYOUT_STATISTICS_SCOPE("SlurTieLayout::tieLayoutFor");
+
     item->setPos(0, 0);
 
     if (!item->startNote()) {
@@ -1438,6 +1475,8 @@ TieSegment* SlurTieLayout::tieLayoutFor(Tie* item, System* system)
 
 TieSegment* SlurTieLayout::tieLayoutBack(Tie* item, System* system, LayoutContext& ctx)
 {
+    LAYOUT_STATISTICS_SCOPE("SlurTieLayout::tieLayoutBack");
+
     Chord* chord = item->endNote() ? item->endNote()->chord() : nullptr;
 
     if (item->staffType() && item->staffType()->isTabStaff()) {
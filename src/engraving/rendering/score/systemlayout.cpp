@@ -73,6 +73,7 @@
 #include "tupletlayout.h"
 #include "slurtielayout.h"
 #include "horizontalspacing.h"
+#include "layoutstatistics.h"
 
 #include "log.h"
 
@@ -86,6 +87,7 @@ using namespace mu::engraving::rendering::score;
 System* SystemLayout::collectSystem(LayoutContext& ctx)
 {
     TRACEFUNC;
+    LAYOUT_STATISTICS_SCOPE("SystemLayout::collectSystem");
 
     if (!ctx.state().curMeasure()) {
         return nullptr;
@@ -112,6 +114,7 @@ System* SystemLayout::collectSystem(LayoutContext& ctx)
     }
 
     System* system = getNextSystem(ctx);
+    system->mutldata()->invalidateDisplayList();
 
     LAYOUT_CALL() << LAYOUT_ITEM_INFO(system);
 
@@ -273,6 +276,7 @@ System* SystemLayout::collectSystem(LayoutContext& ctx)
 
     assert(ctx.state().prevMeasure());
 
+    bool convergedAtThisSystem = false;
     if (ctx.state().endTick() < ctx.state().prevMeasure()->tick()) {
         // we've processed the entire range
         // but we need to continue layout until we reach a system whose last measure is the same as previous layout
@@ -317,6 +321,7 @@ System* SystemLayout::collectSystem(LayoutContext& ctx)
                 }
             }
             ctx.mutState().setRangeDone(true);
+            convergedAtThisSystem = true;
         }
     }
 
@@ -383,6 +388,13 @@ System* SystemLayout::collectSystem(LayoutContext& ctx)
     layoutSystemElements(system, ctx);
     SystemLayout::layout2(system, ctx);     // compute staff distances
 
+    if (convergedAtThisSystem && !muse::RealIsEqual(system->height(), ctx.state().systemOldHeight())) {
+        // The line breaks match the previous layout, but the system height doesn't,
+        // so the following systems may land on different pages. Keep laying out
+        // until both the breaks and the height are stable again.
+        ctx.mutState().setRangeDone(false);
+    }
+
     if (oldSystem && !oldSystem->measures().empty() && oldSystem->measures().front()->tick() >= system->endTick()
         && !(oldSystem->page() && oldSystem->page() != ctx.state().page())) {
         // We may have previously processed the ties of the next system (in LayoutChords::updateLineAttachPoints()).
@@ -436,9 +448,11 @@ System* SystemLayout::getNextSystem(LayoutContext& ctx)
     if (ctx.state().systemList().empty()) {
         system = Factory::createSystem(ctx.mutDom().dummyParent()->page());
         ctx.mutState().setSystemOldMeasure(nullptr);
+        ctx.mutState().setSystemOldHeight(-1.0);
     } else {
         system = muse::takeFirst(ctx.mutState().systemList());
         ctx.mutState().setSystemOldMeasure(system->measures().empty() ? 0 : system->measures().back());
+        ctx.mutState().setSystemOldHeight(system->measures().empty() ? -1.0 : system->height());
         system->clear();       // remove measures from system
     }
     ctx.mutDom().systems().push_back(system);
@@ -1928,7 +1928,7 @@ void TDraw::draw(const Image* item, Painter* painter)
             item->svgRenderer()->render(painter, ldata->bbox());
         }
     } else if (item->imageType() == ImageType::RASTER) {
-        if (item->rasterImage() == nullptr) {
+        if (!item->isValid()) {
             emptyImage = true;
         } else {
             painter->save();
@@ -1940,21 +1940,23 @@ void TDraw::draw(const Image* item, Painter* painter)
             }
             if (item->score() && item->score()->printing() && !MScore::svgPrinting) {
                 // use original image size for printing, but not for svg for reasonable file size.
-                painter->scale(s.width() / item->rasterImage()->width(), s.height() / item->rasterImage()->height());
-                painter->drawPixmap(PointF(0, 0), *item->rasterImage());
+                const std::shared_ptr<Pixmap>& rasterImage = item->rasterImage();
+                if (rasterImage && !rasterImage->isNull()) {
+                    painter->scale(s.width() / rasterImage->width(), s.height() / rasterImage->height());
+                    painter->drawPixmap(PointF(0, 0), *rasterImage);
+                } else {
+                    emptyImage = true;
+                }
             } else {
                 Transform t = painter->worldTransform();
                 muse::Size ss = muse::Size(s.width() * t.m11(), s.height() * t.m22());
                 t.setMatrix(1.0, t.m12(), t.m13(), t.m21(), 1.0, t.m23(), t.m31(), t.m32(), t.m33());
                 painter->setWorldTransform(t);
-                if ((item->buffer().size() != ss || item->dirty()) && item->rasterImage() && !item->rasterImage()->isNull()) {
-                    item->setBuffer(item->imageProvider()->scaled(*item->rasterImage(), ss));
-                    item->setDirty(false);
-                }
-                if (item->buffer().isNull()) {
+                const Pixmap& buffer = item->scaledBuffer(ss);
+                if (buffer.isNull()) {
                     emptyImage = true;
                 } else {
-                    painter->drawPixmap(PointF(0.0, 0.0), item->buffer());
+                    painter->drawPixmap(PointF(0.0, 0.0), buffer);
                 }
             }
             painter->restore();
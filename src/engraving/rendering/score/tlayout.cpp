@@ -164,6 +164,7 @@
 #include "tupletlayout.h"
 #include "horizontalspacing.h"
 #include "measurelayout.h"
+#include "layoutstatistics.h"
 
 using namespace muse;
 using namespace muse::draw;
@@ -177,6 +178,13 @@ void TLayout::layoutItem(EngravingItem* item, LayoutContext& ctx)
 {
     //DO_ASSERT(!ctx.conf().isPaletteMode());
 
+    LAYOUT_STATISTICS_SCOPE(item->type());
+
+    // The recorded drawing of the system is out of date after the item was laid out
+    if (EngravingItem* system = item->findAncestor(ElementType::SYSTEM)) {
+        toSystem(system)->mutldata()->invalidateDisplayList();
+    }
+
     EngravingItem::LayoutData* ldata = item->mutldata();
 
     switch (item->type()) {
@@ -297,7 +305,7 @@ void TLayout::layoutItem(EngravingItem* item, LayoutContext& ctx)
         layoutJump(item_cast<const Jump*>(item), static_cast<Jump::LayoutData*>(ldata));
         break;
     case ElementType::KEYSIG:
-        layoutKeySig(item_cast<const KeySig*>(item), static_cast<KeySig::LayoutData*>(ldata), ctx.conf());
+        layoutKeySig(item_cast<const KeySig*>(item), static_cast<KeySig::LayoutData*>(ldata), ctx);
         break;
     case ElementType::LAISSEZ_VIB:
         layoutLaissezVib(item_cast<LaissezVib*>(item));
@@ -568,7 +576,7 @@ void TLayout::layoutAccidental(const Accidental* item, Accidental::LayoutData* l
         }
     }
 
-    ldata->setShape(shape);
+    ldata->setShape(std::move(shape));
 }
 
 void TLayout::layoutActionIcon(const ActionIcon* item, ActionIcon::LayoutData* ldata)
@@ -2872,7 +2880,7 @@ void TLayout::layoutGraceNotesGroup2(const GraceNotesGroup* item, GraceNotesGrou
 
         shape.add(grace->shape(LD_ACCESS::PASS).translate(grace->pos() - item->pos()));
     }
-    ldata->setShape(shape);
+    ldata->setShape(std::move(shape));
 }
 
 void TLayout::layoutGradualTempoChangeSegment(GradualTempoChangeSegment* item, LayoutContext& ctx)
@@ -2953,7 +2961,7 @@ void TLayout::fillGuitarBendSegmentShape(const GuitarBendSegment* item, GuitarBe
     if (!item->bendText()->empty()) {
         shape.add(item->bendText()->shape().translate(item->bendText()->pos()));
     }
-    ldata->setShape(shape);
+    ldata->setShape(std::move(shape));
 }
 
 void TLayout::layoutHairpinSegment(HairpinSegment* item, LayoutContext& ctx)
@@ -3201,7 +3209,7 @@ void TLayout::fillHairpinSegmentShape(const HairpinSegment* item, HairpinSegment
         sh = textLineBaseSegmentShape(item);
     }
 
-    ldata->setShape(sh);
+    ldata->setShape(std::move(sh));
 }
 
 void TLayout::layoutHarpPedalDiagram(const HarpPedalDiagram* item, HarpPedalDiagram::LayoutData* ldata)
@@ -3498,11 +3506,15 @@ static void keySigAddLayout(const KeySig* item, const LayoutConfiguration& conf,
     ldata->keySymbols.push_back(ks);
 }
 
-void TLayout::layoutKeySig(const KeySig* item, KeySig::LayoutData* ldata, const LayoutConfiguration& conf)
+void TLayout::layoutKeySig(const KeySig* item, KeySig::LayoutData* ldata, const LayoutContext& ctx)
 {
     LAYOUT_CALL_ITEM(item);
     LD_INDEPENDENT;
 
+    const LayoutConfiguration& conf = ctx.conf();
+    const LayoutMemo::KeySigEntry* memoEntry = nullptr;
+    LayoutMemo::KeySigKey memoKey;
+
     //! NOTE There are problems, an investigation is required
 //    if (ldata->isValid()) {
 //        return;
@@ -3707,30 +3719,44 @@ void TLayout::layoutKeySig(const KeySig* item, KeySig::LayoutData* ldata, const
         // naturals should go AFTER accidentals if they should not go before!
         bool suffixNaturals = naturalsOn && !prefixNaturals;
 
-        const signed char* lines = ClefInfo::lines(clef);
+        // the symbols only depend on these, so identical key signatures (e.g. in system headers) are reused
+        memoKey.clef = clef;
+        memoKey.key = t1;
+        memoKey.naturals = naturalsOn ? naturals : 0;
+        memoKey.naturalsOffset = coffset;
+        memoKey.prefixNaturals = prefixNaturals;
+        memoKey.magS = item->magS();
+        memoKey.step = step;
+        memoEntry = ctx.memo().findKeySig(memoKey);
+
+        if (memoEntry) {
+            ldata->keySymbols = memoEntry->keySymbols;
+        } else {
+            const signed char* lines = ClefInfo::lines(clef);
 
-        if (prefixNaturals) {
-            for (int i = 0; i < 7; ++i) {
-                if (naturals & (1 << i)) {
-                    keySigAddLayout(item, conf, SymId::accidentalNatural, lines[i + coffset], ldata);
+            if (prefixNaturals) {
+                for (int i = 0; i < 7; ++i) {
+                    if (naturals & (1 << i)) {
+                        keySigAddLayout(item, conf, SymId::accidentalNatural, lines[i + coffset], ldata);
+                    }
                 }
             }
-        }
-        if (std::abs(t1) <= 7) {
-            SymId symbol = t1 > 0 ? SymId::accidentalSharp : SymId::accidentalFlat;
-            int lineIndexOffset = t1 > 0 ? 0 : 7;
-            for (int i = 0; i < std::abs(t1); ++i) {
-                keySigAddLayout(item, conf, symbol, lines[lineIndexOffset + i], ldata);
+            if (std::abs(t1) <= 7) {
+                SymId symbol = t1 > 0 ? SymId::accidentalSharp : SymId::accidentalFlat;
+                int lineIndexOffset = t1 > 0 ? 0 : 7;
+                for (int i = 0; i < std::abs(t1); ++i) {
+                    keySigAddLayout(item, conf, symbol, lines[lineIndexOffset + i], ldata);
+                }
+            } else {
+                LOGD("illegal t1 key %d", t1);
             }
-        } else {
-            LOGD("illegal t1 key %d", t1);
-        }
 
-        // add suffixed naturals, if any
-        if (suffixNaturals) {
-            for (int i = 0; i < 7; ++i) {
-                if (naturals & (1 << i)) {
-                    keySigAddLayout(item, conf, SymId::accidentalNatural, lines[i + coffset], ldata);
+            // add suffixed naturals, if any
+            if (suffixNaturals) {
+                for (int i = 0; i < 7; ++i) {
+                    if (naturals & (1 << i)) {
+                        keySigAddLayout(item, conf, SymId::accidentalNatural, lines[i + coffset], ldata);
+                    }
                 }
             }
         }
@@ -3743,6 +3769,15 @@ void TLayout::layoutKeySig(const KeySig* item, KeySig::LayoutData* ldata, const
 
     ldata->moveY(item->staffOffsetY());
 
+    if (memoEntry) {
+        Shape keySigShape = memoEntry->shape;
+        for (ShapeElement& el : keySigShape.elements()) {
+            el.setItem(item);
+        }
+        ldata->setShape(keySigShape);
+        return;
+    }
+
     Shape keySigShape;
     for (const KeySym& ks : ldata->keySymbols) {
         double x = ks.xPos * spatium;
@@ -3750,6 +3785,10 @@ void TLayout::layoutKeySig(const KeySig* item, KeySig::LayoutData* ldata, const
         keySigShape.add(item->symBbox(ks.sym).translated(x, y), item);
     }
     ldata->setShape(keySigShape);
+
+    if (!item->isCustom() || item->isAtonal()) {
+        ctx.memo().storeKeySig(memoKey, { ldata->keySymbols, keySigShape });
+    }
 }
 
 void TLayout::layoutLaissezVib(LaissezVib* item)
@@ -4285,7 +4324,7 @@ void TLayout::fillNoteShape(const Note* item, Note::LayoutData* ldata)
         }
     }
 
-    ldata->setShape(shape);
+    ldata->setShape(std::move(shape));
 }
 
 void TLayout::layoutNoteDot(const NoteDot* item, NoteDot::LayoutData* ldata)
@@ -4346,7 +4385,7 @@ void TLayout::layoutOrnament(const Ornament* item, Ornament::LayoutData* ldata,
         }
     }
 
-    ldata->setShape(sh);
+    ldata->setShape(std::move(sh));
 }
 
 void TLayout::layoutOrnamentCueNote(Ornament* item, LayoutContext& ctx)
@@ -5081,7 +5120,7 @@ void TLayout::layoutNoteLineSegment(NoteLineSegment* item, LayoutContext& ctx)
         ldata->setMag(item->staff()->staffMag(item->tick()));
     }
     Shape sh = textLineBaseSegmentShape(item);
-    ldata->setShape(sh);
+    ldata->setShape(std::move(sh));
 }
 
 void TLayout::layoutSlur(Slur* item, LayoutContext& ctx)
@@ -6479,7 +6518,7 @@ void TLayout::fillTrillSegmentShape(const TrillSegment* item, TrillSegment::Layo
         s.add(accidental->shape().translate(accidental->pos()));
     }
 
-    ldata->setShape(s);
+    ldata->setShape(std::move(s));
 }
 
 void TLayout::layoutTripletFeel(const TripletFeel* item, TripletFeel::LayoutData* ldata)
@@ -6536,7 +6575,7 @@ void TLayout::fillTupletShape(const Tuplet* item, Tuplet::LayoutData* ldata)
         s.add(item->number()->ldata()->bbox().translated(item->number()->pos()));
     }
 
-    ldata->setShape(s);
+    ldata->setShape(std::move(s));
 }
 
 void TLayout::layoutVibratoSegment(VibratoSegment* item, LayoutContext& ctx)
@@ -258,7 +258,7 @@ public:
 
     static void layoutJump(const Jump* item, Jump::LayoutData* ldata);
 
-    static void layoutKeySig(const KeySig* item, KeySig::LayoutData* ldata, const LayoutConfiguration& conf);
+    static void layoutKeySig(const KeySig* item, KeySig::LayoutData* ldata, const LayoutContext& ctx);
 
     static void layoutLaissezVib(LaissezVib* item);
     static void layoutLayoutBreak(const LayoutBreak* item, LayoutBreak::LayoutData* ldata);
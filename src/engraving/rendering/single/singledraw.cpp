@@ -1838,7 +1838,7 @@ void SingleDraw::draw(const Image* item, Painter* painter)
             item->svgRenderer()->render(painter, ldata->bbox());
         }
     } else if (item->imageType() == ImageType::RASTER) {
-        if (item->rasterImage() == nullptr) {
+        if (!item->isValid()) {
             emptyImage = true;
         } else {
             painter->save();
@@ -1853,14 +1853,11 @@ void SingleDraw::draw(const Image* item, Painter* painter)
             muse::Size ss = muse::Size(s.width() * t.m11(), s.height() * t.m22());
             t.setMatrix(1.0, t.m12(), t.m13(), t.m21(), 1.0, t.m23(), t.m31(), t.m32(), t.m33());
             painter->setWorldTransform(t);
-            if ((item->buffer().size() != ss || item->dirty()) && item->rasterImage() && !item->rasterImage()->isNull()) {
-                item->setBuffer(item->imageProvider()->scaled(*item->rasterImage(), ss));
-                item->setDirty(false);
-            }
-            if (item->buffer().isNull()) {
+            const Pixmap& buffer = item->scaledBuffer(ss);
+            if (buffer.isNull()) {
                 emptyImage = true;
             } else {
-                painter->drawPixmap(PointF(0.0, 0.0), item->buffer());
+                painter->drawPixmap(PointF(0.0, 0.0), buffer);
             }
 
             painter->restore();
@@ -0,0 +1,137 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-Studio-CLA-applies
+ *
+ * MuseScore Studio
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2024 MuseScore Limited
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "deferredexcerpts.h"
+
+#include "containers.h"
+
+#include "../dom/excerpt.h"
+#include "../dom/masterscore.h"
+
+#include "mscloader.h"
+
+#include "log.h"
+
+using namespace muse;
+using namespace mu::engraving;
+using namespace mu::engraving::rw;
+
+DeferredExcerpts::DeferredExcerpts(MasterScore* masterScore, const ReadLinks& links, bool ignoreVersionError)
+    : m_masterScore(masterScore), m_links(links), m_ignoreVersionError(ignoreVersionError)
+{
+}
+
+DeferredExcerpts::~DeferredExcerpts()
+{
+    for (Entry& entry : m_entries) {
+        if (!entry.isRead) {
+            delete entry.excerpt;
+        }
+    }
+}
+
+void DeferredExcerpts::addRead(Excerpt* excerpt)
+{
+    Entry entry;
+    entry.excerpt = excerpt;
+    entry.isRead = true;
+
+    m_entries.push_back(std::move(entry));
+}
+
+void DeferredExcerpts::addDeferred(Excerpt* excerpt, ByteArray&& data)
+{
+    Entry entry;
+    entry.excerpt = excerpt;
+    entry.data = std::move(data);
+
+    m_entries.push_back(std::move(entry));
+}
+
+bool DeferredExcerpts::empty() const
+{
+    for (const Entry& entry : m_entries) {
+        if (!entry.isRead) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool DeferredExcerpts::contains(const Excerpt* excerpt) const
+{
+    for (const Entry& entry : m_entries) {
+        if (entry.excerpt == excerpt) {
+            return !entry.isRead;
+        }
+    }
+
+    return false;
+}
+
+std::vector<Excerpt*> DeferredExcerpts::excerpts() const
+{
+    std::vector<Excerpt*> result;
+    for (const Entry& entry : m_entries) {
+        if (!entry.isRead) {
+            result.push_back(entry.excerpt);
+        }
+    }
+
+    return result;
+}
+
+bool DeferredExcerpts::read(Excerpt* excerpt)
+{
+    TRACEFUNC;
+
+    //! NOTE Until all the excerpts are read, the master score excerpts are the read ones in the file order
+    size_t index = 0;
+    for (Entry& entry : m_entries) {
+        if (entry.excerpt != excerpt) {
+            if (entry.isRead && muse::contains(m_masterScore->excerpts(), entry.excerpt)) {
+                ++index;
+            }
+            continue;
+        }
+
+        if (entry.isRead) {
+            return true;
+        }
+
+        // Considered read even if it fails, the partly read score is not read again
+        entry.isRead = true;
+        ByteArray data = std::move(entry.data);
+
+        Ret ret = MscLoader::readExcerpt(m_masterScore, excerpt, data, m_links, m_ignoreVersionError);
+        if (!ret) {
+            LOGE() << "failed read excerpt: " << excerpt->fileName() << ", err: " << ret.toString();
+            return false;
+        }
+
+        m_masterScore->addExcerpt(excerpt, index);
+
+        return true;
+    }
+
+    return false;
+}
@@ -0,0 +1,71 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-Studio-CLA-applies
+ *
+ * MuseScore Studio
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2024 MuseScore Limited
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef MU_ENGRAVING_DEFERREDEXCERPTS_H
+#define MU_ENGRAVING_DEFERREDEXCERPTS_H
+
+#include <vector>
+
+#include "global/types/bytearray.h"
+
+#include "inoutdata.h"
+
+namespace mu::engraving {
+class Excerpt;
+class MasterScore;
+}
+
+namespace mu::engraving::rw {
+//! NOTE Keeps the excerpts whose reading was deferred at load (see MscLoader::setLazyExcerpts),
+//! together with their file data and the links of the master score they are read against.
+//! The master score must not be changed until all of them are read (see MasterScore::materializeExcerpts)
+class DeferredExcerpts
+{
+public:
+    DeferredExcerpts(MasterScore* masterScore, const ReadLinks& links, bool ignoreVersionError);
+    ~DeferredExcerpts();
+
+    void addRead(Excerpt* excerpt);
+    void addDeferred(Excerpt* excerpt, muse::ByteArray&& data);
+
+    bool empty() const;
+    bool contains(const Excerpt* excerpt) const;
+    std::vector<Excerpt*> excerpts() const;
+
+    //! NOTE Reads the excerpt and adds it to the master score at its place in the file order
+    bool read(Excerpt* excerpt);
+
+private:
+    struct Entry {
+        Excerpt* excerpt = nullptr;
+        muse::ByteArray data;
+        bool isRead = false;
+    };
+
+    MasterScore* m_masterScore = nullptr;
+    ReadLinks m_links;
+    bool m_ignoreVersionError = false;
+
+    std::vector<Entry> m_entries;
+};
+}
+
+#endif // MU_ENGRAVING_DEFERREDEXCERPTS_H
@@ -24,6 +24,7 @@
 #include <memory>
 
 #include "global/io/buffer.h"
+#include "global/concurrency/taskscheduler.h"
 #include "global/types/retval.h"
 
 #include "../types/types.h"
@@ -36,6 +37,8 @@
 #include "compat/compatutils.h"
 #include "compat/readstyle.h"
 
+#include "deferredexcerpts.h"
+#include "scoresnapshotcache.h"
 #include "rwregister.h"
 #include "xmlreader.h"
 #include "inoutdata.h"
@@ -71,6 +74,88 @@ static RetVal<IReaderPtr> makeReader(int version, bool ignoreVersionError)
     return RetVal<IReaderPtr>::make_ok(RWRegister::reader(version));
 }
 
+static std::vector<ByteArray> readExcerptsData(const MscReader& mscReader, const std::vector<Excerpt*>& excerpts)
+{
+    TRACEFUNC;
+
+    static muse::TaskScheduler scheduler;
+
+    std::vector<ByteArray> excerptsData(excerpts.size());
+    std::vector<std::future<void> > futures;
+    futures.reserve(excerpts.size());
+
+    for (size_t i = 0; i < excerpts.size(); ++i) {
+        futures.push_back(scheduler.submit([&mscReader, &excerptsData, ex = excerpts.at(i), i]() {
+            ByteArray excerptStyleData = mscReader.readExcerptStyleFile(ex->fileName());
+            Buffer excerptStyleBuf(&excerptStyleData);
+            excerptStyleBuf.open(IODevice::ReadOnly);
+            ex->excerptScore()->style().read(&excerptStyleBuf);
+
+            excerptsData[i] = mscReader.readExcerptFile(ex->fileName());
+        }));
+    }
+
+    for (std::future<void>& f : futures) {
+        f.get();
+    }
+
+    return excerptsData;
+}
+
+//! NOTE Reads what is shown about an excerpt before its score is read: the name and the initial part.
+//! Returns whether the excerpt was open when the score was saved
+static bool readExcerptHeader(Excerpt* ex, const ByteArray& data)
+{
+    XmlReader e(data);
+    while (e.readNextStartElement()) {
+        const AsciiStringView tag(e.name());
+        if (tag == "museScore") {
+            // pass
+        } else if (tag == "Score") {
+            bool isOpen = false;
+            String nameFromMeta;
+
+            while (e.readNextStartElement()) {
+                const AsciiStringView scoreTag(e.name());
+                if (scoreTag == "name") {
+                    ex->setName(e.readText(), /*saveAndNotify=*/ false);
+                } else if (scoreTag == "initialPartId") {
+                    ex->setInitialPartId(ID(e.readInt()));
+                } else if (scoreTag == "open") {
+                    isOpen = e.readBool();
+                } else if (scoreTag == "metaTag" && e.attribute("name") == u"partName") {
+                    nameFromMeta = e.readText();
+                } else if (scoreTag == "Part" || scoreTag == "Staff") {
+                    break;
+                } else {
+                    e.skipCurrentElement();
+                }
+            }
+
+            if (ex->name().empty()) {
+                ex->setName(nameFromMeta.empty() ? ex->fileName() : nameFromMeta, /*saveAndNotify=*/ false);
+            }
+
+            return isOpen;
+        } else {
+            e.skipCurrentElement();
+        }
+    }
+
+    // Not an excerpt score, let the reader report it
+    return true;
+}
+
+void MscLoader::setLazyExcerpts(bool lazy)
+{
+    m_lazyExcerpts = lazy;
+}
+
+void MscLoader::setSnapshotCachePath(const muse::io::path_t& path)
+{
+    m_snapshotCachePath = path;
+}
+
 Ret MscLoader::loadMscz(MasterScore* masterScore, const MscReader& mscReader, SettingsCompat& settingsCompat,
                         bool ignoreVersionError, rw::ReadInOutData* inOut)
 {
@@ -142,20 +227,50 @@ Ret MscLoader::loadMscz(MasterScore* masterScore, const MscReader& mscReader, Se
 
     // Read score
     {
-        ByteArray scoreData = mscReader.readScoreFile();
-        String docName = masterScore->fileInfo()->fileName().toString();
+        const path_t& filePath = mscReader.params().filePath;
+        uint32_t scoreCrc = 0;
+        uint64_t scoreSize = 0;
+        const bool useSnapshot = !m_snapshotCachePath.empty() && !filePath.empty() && !MScore::testMode
+                                 && mscReader.scoreFileCrc(scoreCrc, scoreSize);
 
-        compat::ReadStyleHook styleHook(masterScore, scoreData, docName);
+        ScoreSnapshotCache snapshotCache(m_snapshotCachePath);
+        ByteArray snapshot = useSnapshot ? snapshotCache.load(filePath, scoreCrc, scoreSize) : ByteArray();
 
-        XmlReader xml(scoreData);
+        ByteArray scoreData;
+        String docName = masterScore->fileInfo()->fileName().toString();
+
+        XmlReader xml;
+        const bool isSnapshotRead = !snapshot.empty() && xml.setSnapshot(snapshot);
+        if (!isSnapshotRead) {
+            scoreData = mscReader.readScoreFile();
+            xml.setData(scoreData);
+        }
         xml.setDocName(docName);
 
+        //! NOTE The hook reads the score data only for the scores of older versions, which have no snapshots
+        compat::ReadStyleHook styleHook(masterScore, scoreData, docName);
+
         ret = readMasterScore(masterScore, xml, ignoreVersionError, inOut, &styleHook);
+
+        if (isSnapshotRead) {
+            if (!ret) {
+                LOGW() << "failed read score snapshot, it is removed: " << filePath;
+                snapshotCache.remove(filePath);
+            }
+        } else if (ret && useSnapshot && masterScore->mscVersion() == Constants::MSC_VERSION) {
+            snapshotCache.storeAsync(filePath, scoreCrc, scoreSize, scoreData);
+        }
     }
 
     // Read excerpts
+    //! NOTE Extracting the excerpt files and reading their styles does not touch the master score,
+    //! so it is done for all excerpts in parallel. Reading an excerpt score links its elements
+    //! to the master score (and to the previous excerpts), so it is done serially, in the file order
     if (ret && masterScore->mscVersion() >= 400) {
         std::vector<String> excerptFileNames = mscReader.excerptFileNames();
+
+        std::vector<Excerpt*> excerpts;
+        excerpts.reserve(excerptFileNames.size());
         for (const String& excerptFileName : excerptFileNames) {
             Score* partScore = masterScore->createScore();
 
@@ -164,47 +279,44 @@ Ret MscLoader::loadMscz(MasterScore* masterScore, const MscReader& mscReader, Se
             Excerpt* ex = new Excerpt(masterScore);
             ex->setExcerptScore(partScore);
             ex->setFileName(excerptFileName);
+            excerpts.push_back(ex);
+        }
 
-            ByteArray excerptStyleData = mscReader.readExcerptStyleFile(excerptFileName);
-            Buffer excerptStyleBuf(&excerptStyleData);
-            excerptStyleBuf.open(IODevice::ReadOnly);
-            partScore->style().read(&excerptStyleBuf);
-
-            ByteArray excerptData = mscReader.readExcerptFile(excerptFileName);
+        std::vector<ByteArray> excerptsData = readExcerptsData(mscReader, excerpts);
 
-            XmlReader xml(excerptData);
-            xml.setDocName(excerptFileName);
+        std::unique_ptr<DeferredExcerpts> deferredExcerpts;
+        if (m_lazyExcerpts && masterScore->mscVersion() >= Constants::MSC_VERSION) {
+            deferredExcerpts = std::make_unique<DeferredExcerpts>(masterScore, inOut->links, ignoreVersionError);
+        }
 
-            ReadInOutData partReadInData;
-            partReadInData.links = inOut->links;
+        size_t excerptIdx = 0;
+        for (; excerptIdx < excerpts.size(); ++excerptIdx) {
+            Excerpt* ex = excerpts.at(excerptIdx);
 
-            RetVal<IReaderPtr> reader = makeReader(masterScore->mscVersion(), ignoreVersionError);
-            if (!reader.ret) {
-                ret = reader.ret;
-                break;
+            if (deferredExcerpts && !readExcerptHeader(ex, excerptsData.at(excerptIdx))) {
+                deferredExcerpts->addDeferred(ex, std::move(excerptsData[excerptIdx]));
+                continue;
             }
 
-            Err err = reader.val->readScore(partScore, xml, &partReadInData);
-            ret =  make_ret(err);
+            ret = readExcerpt(masterScore, ex, excerptsData.at(excerptIdx), inOut->links, ignoreVersionError);
             if (!ret) {
                 break;
             }
 
-            partScore->linkMeasures(masterScore);
-
-            if (ex->name().empty()) {
-                // If no excerpt name tag was found while reading, try the "partName" meta tag
-                const String nameFromMeta = partScore->metaTag(u"partName");
+            masterScore->addExcerpt(ex);
 
-                if (nameFromMeta.empty()) {
-                    // If that's also empty, fall back to the filename
-                    ex->setName(excerptFileName, /*saveAndNotify=*/ false);
-                } else {
-                    ex->setName(nameFromMeta, /*saveAndNotify=*/ false);
-                }
+            if (deferredExcerpts) {
+                deferredExcerpts->addRead(ex);
             }
+        }
 
-            masterScore->addExcerpt(ex);
+        // The excerpts after a failed one are not read
+        for (size_t i = excerptIdx + 1; i < excerpts.size(); ++i) {
+            delete excerpts.at(i);
+        }
+
+        if (ret && deferredExcerpts && !deferredExcerpts->empty()) {
+            masterScore->setDeferredExcerpts(std::move(deferredExcerpts));
         }
     }
 
@@ -225,6 +337,45 @@ Ret MscLoader::loadMscz(MasterScore* masterScore, const MscReader& mscReader, Se
     return ret;
 }
 
+Ret MscLoader::readExcerpt(MasterScore* masterScore, Excerpt* ex, const ByteArray& data, const ReadLinks& links,
+                           bool ignoreVersionError)
+{
+    Score* partScore = ex->excerptScore();
+    const String& excerptFileName = ex->fileName();
+
+    XmlReader xml(data);
+    xml.setDocName(excerptFileName);
+
+    ReadInOutData partReadInData;
+    partReadInData.links = links;
+
+    RetVal<IReaderPtr> reader = makeReader(masterScore->mscVersion(), ignoreVersionError);
+    if (!reader.ret) {
+        return reader.ret;
+    }
+
+    Err err = reader.val->readScore(partScore, xml, &partReadInData);
+    if (err != Err::NoError) {
+        return make_ret(err);
+    }
+
+    partScore->linkMeasures(masterScore);
+
+    if (ex->name().empty()) {
+        // If no excerpt name tag was found while reading, try the "partName" meta tag
+        const String nameFromMeta = partScore->metaTag(u"partName");
+
+        if (nameFromMeta.empty()) {
+            // If that's also empty, fall back to the filename
+            ex->setName(excerptFileName, /*saveAndNotify=*/ false);
+        } else {
+            ex->setName(nameFromMeta, /*saveAndNotify=*/ false);
+        }
+    }
+
+    return muse::make_ok();
+}
+
 Ret MscLoader::readMasterScore(MasterScore* score, XmlReader& e, bool ignoreVersionError, ReadInOutData* out,
                                compat::ReadStyleHook* styleHook)
 {
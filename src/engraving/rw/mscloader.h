@@ -33,9 +33,11 @@ class ReadStyleHook;
 
 namespace mu::engraving::rw {
 struct ReadInOutData;
+struct ReadLinks;
 }
 
 namespace mu::engraving {
+class Excerpt;
 class MasterScore;
 class XmlReader;
 class MscLoader
@@ -43,13 +45,29 @@ class MscLoader
 public:
     MscLoader() = default;
 
+    //! NOTE If set, the excerpts that were not open when the score was saved are not read at load;
+    //! each of them is read the first time it is used (see MasterScore::materializeExcerpt).
+    //! Only applies to scores of the current version, that need no compatibility conversions
+    void setLazyExcerpts(bool lazy);
+
+    //! NOTE If set, the master score is read from its snapshot in this cache, when there is one
+    //! for the score file as it is (see ScoreSnapshotCache); otherwise the snapshot is made after reading.
+    //! Only applies to ZIP containers of the current version
+    void setSnapshotCachePath(const muse::io::path_t& path);
+
     muse::Ret loadMscz(MasterScore* score, const MscReader& mscReader, SettingsCompat& settingsCompat, bool ignoreVersionError,
                        rw::ReadInOutData* out = nullptr);
 
+    static muse::Ret readExcerpt(MasterScore* masterScore, Excerpt* ex, const muse::ByteArray& data, const rw::ReadLinks& links,
+                                 bool ignoreVersionError);
+
 private:
     friend class MasterScore;
     muse::Ret readMasterScore(MasterScore* score, XmlReader&, bool ignoreVersionError, rw::ReadInOutData* out = nullptr,
                               compat::ReadStyleHook* styleHook = nullptr);
+
+    bool m_lazyExcerpts = false;
+    muse::io::path_t m_snapshotCachePath;
 };
 }
 
@@ -21,12 +21,15 @@
  */
 #include "mscsaver.h"
 
+#include <cmath>
+
 #include "global/io/buffer.h"
 
 #include "dom/masterscore.h"
 #include "dom/excerpt.h"
 #include "dom/imageStore.h"
 #include "dom/audio.h"
+#include "dom/mscore.h"
 
 #include "rwregister.h"
 #include "inoutdata.h"
@@ -47,6 +50,15 @@ bool MscSaver::writeMscz(MasterScore* score, MscWriter& mscWriter, bool onlySele
         return false;
     }
 
+    //! NOTE The excerpts read lazily are written from their scores like the others
+    score->materializeExcerpts();
+
+    //! NOTE The thumbnail is rasterized while the score is written
+    std::future<ByteArray> thumbnail;
+    if (doCreateThumbnail && !score->pages().empty()) {
+        thumbnail = startThumbnail(score);
+    }
+
     // Write style of MasterScore
     {
         //! NOTE The style is writing to a separate file only for the master score.
@@ -136,14 +148,8 @@ bool MscSaver::writeMscz(MasterScore* score, MscWriter& mscWriter, bool onlySele
 
     // Write thumbnail
     {
-        if (doCreateThumbnail && !score->pages().empty()) {
-            auto pixmap = score->createThumbnail();
-
-            ByteArray ba;
-            Buffer b(&ba);
-            b.open(IODevice::WriteOnly);
-            imageProvider()->saveAsPng(pixmap, &b);
-            mscWriter.writeThumbnailFile(ba);
+        if (thumbnail.valid()) {
+            mscWriter.writeThumbnailFile(thumbnail.get());
         }
     }
 
@@ -159,6 +165,11 @@ bool MscSaver::writeMscz(MasterScore* score, MscWriter& mscWriter, bool onlySele
 
 bool MscSaver::exportPart(Score* partScore, MscWriter& mscWriter)
 {
+    std::future<ByteArray> thumbnail;
+    if (!partScore->pages().empty()) {
+        thumbnail = startThumbnail(partScore);
+    }
+
     // Write excerpt style as main
     {
         ByteArray excerptStyleData;
@@ -182,16 +193,45 @@ bool MscSaver::exportPart(Score* partScore, MscWriter& mscWriter)
 
     // Write thumbnail
     {
-        if (!partScore->pages().empty()) {
-            auto pixmap = partScore->createThumbnail();
-
-            ByteArray ba;
-            Buffer b(&ba);
-            b.open(IODevice::WriteOnly);
-            imageProvider()->saveAsPng(pixmap, &b);
-            mscWriter.writeThumbnailFile(ba);
+        if (thumbnail.valid()) {
+            mscWriter.writeThumbnailFile(thumbnail.get());
         }
     }
 
     return true;
 }
+
+static bool hasPixmaps(const muse::draw::DrawData::Item& item)
+{
+    for (const muse::draw::DrawData::Data& data : item.datas) {
+        if (!data.pixmaps.empty()) {
+            return true;
+        }
+    }
+
+    for (const muse::draw::DrawData::Item& child : item.chilren) {
+        if (hasPixmaps(child)) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+std::future<ByteArray> MscSaver::startThumbnail(Score* score)
+{
+    TRACEFUNC;
+
+    //! NOTE The page is recorded here, because the layout must not be touched from another thread,
+    //! the recorded data is then rasterized and encoded on a worker thread.
+    //! Pixmaps can only be painted in the main thread, so then everything is done on get()
+    Score::Thumbnail thumbnail = score->createThumbnail();
+    std::shared_ptr<muse::draw::IImageProvider> provider = imageProvider();
+
+    const std::launch policy = hasPixmaps(thumbnail.data->item) ? std::launch::deferred : std::launch::async;
+
+    return std::async(policy, [provider, thumbnail]() {
+        int dpm = std::lrint(DPMM * 1000.0);
+        return provider->drawDataToPng(thumbnail.data, thumbnail.size, dpm, thumbnail.background);
+    });
+}
@@ -22,6 +22,8 @@
 #ifndef MU_ENGRAVING_MSCSAVER_H
 #define MU_ENGRAVING_MSCSAVER_H
 
+#include <future>
+
 #include "global/modularity/ioc.h"
 #include "draw/iimageprovider.h"
 
@@ -40,6 +42,9 @@ public:
     bool writeMscz(MasterScore* score, MscWriter& mscWriter, bool onlySelection, bool doCreateThumbnail);
 
     bool exportPart(Score* partScore, MscWriter& mscWriter);
+
+private:
+    std::future<muse::ByteArray> startThumbnail(Score* score);
 };
 }
 
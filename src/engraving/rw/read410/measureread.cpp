@@ -86,11 +86,14 @@ void MeasureRead::readMeasure(Measure* measure, XmlReader& e, ReadContext& ctx,
 
     bool irregular;
     if (e.hasAttribute("len")) {
-        StringList sl = e.attribute("len").split(u'/');
-        if (sl.size() == 2) {
-            measure->m_len = Fraction(sl.at(0).toInt(), sl.at(1).toInt());
+        const AsciiStringView len = e.asciiAttribute("len");
+        const size_t slash = len.indexOf('/');
+        const AsciiStringView denominator = slash != muse::nidx ? AsciiStringView(len.ascii() + slash + 1, len.size() - slash - 1)
+                                            : AsciiStringView();
+        if (slash != muse::nidx && !denominator.contains('/')) {
+            measure->m_len = Fraction(AsciiStringView(std::string(len.ascii(), slash)).toInt(), denominator.toInt());
         } else {
-            LOGD("illegal measure size <%s>", muPrintable(e.attribute("len")));
+            LOGD("illegal measure size <%s>", len.ascii());
         }
         irregular = true;
         if (measure->m_len.numerator() <= 0 || measure->m_len.denominator() <= 0 || measure->m_len.denominator() > 128) {
@@ -0,0 +1,133 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-Studio-CLA-applies
+ *
+ * MuseScore Studio
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2024 MuseScore Limited
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "scoresnapshotcache.h"
+
+#include <cstdio>
+#include <cstring>
+#include <mutex>
+
+#include "global/concurrency/taskscheduler.h"
+#include "global/io/dir.h"
+#include "global/io/file.h"
+#include "global/serialization/xmlstreamreader.h"
+
+#include "log.h"
+
+using namespace muse;
+using namespace muse::io;
+using namespace mu::engraving::rw;
+
+namespace {
+//! NOTE Follows the snapshot in the cache file, so the snapshot is read without a copy
+struct CacheKey {
+    char magic[4] = { 'M', 'S', 'S', 'C' };
+    uint32_t crc = 0;
+    uint64_t size = 0;
+};
+}
+
+static uint64_t pathHash(const std::string& path)
+{
+    // FNV-1a, the names of the cache files must not change between runs
+    uint64_t hash = 14695981039346656037ULL;
+    for (const char c : path) {
+        hash ^= static_cast<uint8_t>(c);
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+ScoreSnapshotCache::ScoreSnapshotCache(const path_t& cachePath)
+    : m_cachePath(cachePath)
+{
+}
+
+path_t ScoreSnapshotCache::snapshotPath(const path_t& scorePath) const
+{
+    char name[17];
+    std::snprintf(name, sizeof(name), "%016llx", static_cast<unsigned long long>(pathHash(scorePath.toStdString())));
+    return m_cachePath + "/" + name + ".snapshot";
+}
+
+ByteArray ScoreSnapshotCache::load(const path_t& scorePath, uint32_t crc, uint64_t size) const
+{
+    TRACEFUNC;
+
+    const path_t path = snapshotPath(scorePath);
+    if (!File::exists(path)) {
+        return ByteArray();
+    }
+
+    ByteArray data;
+    if (!File::readFile(path, data) || data.size() < sizeof(CacheKey)) {
+        return ByteArray();
+    }
+
+    CacheKey key;
+    CacheKey fileKey;
+    std::memcpy(&fileKey, data.constData() + data.size() - sizeof(CacheKey), sizeof(CacheKey));
+    if (std::memcmp(fileKey.magic, key.magic, sizeof(key.magic)) != 0 || fileKey.crc != crc || fileKey.size != size) {
+        return ByteArray();
+    }
+
+    data.truncate(data.size() - sizeof(CacheKey));
+    return data;
+}
+
+void ScoreSnapshotCache::storeAsync(const path_t& scorePath, uint32_t crc, uint64_t size, const ByteArray& scoreData) const
+{
+    static muse::TaskScheduler scheduler(1);
+    static std::mutex mutex;
+
+    const path_t cachePath = m_cachePath;
+    const path_t path = snapshotPath(scorePath);
+
+    scheduler.push([cachePath, path, crc, size, scoreData]() {
+        TRACEFUNC;
+
+        ByteArray snapshot = XmlStreamReader::makeSnapshot(scoreData);
+        if (snapshot.empty()) {
+            return;
+        }
+
+        CacheKey key;
+        key.crc = crc;
+        key.size = size;
+        snapshot.push_back(reinterpret_cast<const uint8_t*>(&key), sizeof(key));
+
+        const std::lock_guard lock(mutex);
+
+        Ret ret = Dir::mkpath(cachePath);
+        if (ret) {
+            ret = File::writeFile(path, snapshot);
+        }
+
+        if (!ret) {
+            LOGW() << "failed write score snapshot: " << path << ", err: " << ret.toString();
+        }
+    });
+}
+
+void ScoreSnapshotCache::remove(const path_t& scorePath) const
+{
+    File::remove(snapshotPath(scorePath));
+}
@@ -0,0 +1,49 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-Studio-CLA-applies
+ *
+ * MuseScore Studio
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2024 MuseScore Limited
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef MU_ENGRAVING_SCORESNAPSHOTCACHE_H
+#define MU_ENGRAVING_SCORESNAPSHOTCACHE_H
+
+#include "global/io/path.h"
+#include "global/types/bytearray.h"
+
+namespace mu::engraving::rw {
+//! NOTE A local cache of the snapshots of the score files (see XmlStreamReader::makeSnapshot), one per score path.
+//! A snapshot is used while the CRC-32 and the size of the score file are the ones it was made for
+class ScoreSnapshotCache
+{
+public:
+    explicit ScoreSnapshotCache(const muse::io::path_t& cachePath);
+
+    muse::ByteArray load(const muse::io::path_t& scorePath, uint32_t crc, uint64_t size) const;
+
+    //! NOTE Makes the snapshot and writes it on a worker thread
+    void storeAsync(const muse::io::path_t& scorePath, uint32_t crc, uint64_t size, const muse::ByteArray& scoreData) const;
+    void remove(const muse::io::path_t& scorePath) const;
+
+private:
+    muse::io::path_t snapshotPath(const muse::io::path_t& scorePath) const;
+
+    muse::io::path_t m_cachePath;
+};
+}
+
+#endif // MU_ENGRAVING_SCORESNAPSHOTCACHE_H
@@ -968,7 +968,9 @@ void TWrite::writeProperties(const ChordRest* item, XmlWriter& xml, WriteContext
         ctx.incCurTick(t);
     }
 
-    for (auto i : item->score()->spannerMap().findOverlapping(curTick - 1, curTick + 1)) {
+    SpannerMap::IntervalList overlapping;
+    item->score()->spannerMap().findOverlapping(curTick - 1, curTick + 1, overlapping);
+    for (auto i : overlapping) {
         Spanner* s = i.value;
         if (s->generated() || !s->isSlur() || toSlur(s)->broken() || !ctx.canWrite(s)) {
             continue;
@@ -2477,13 +2479,13 @@ void TWrite::write(const Rest* item, XmlWriter& xml, WriteContext& ctx)
 
 void TWrite::write(const Segment* item, XmlWriter& xml, WriteContext&)
 {
-    if (item->written()) {
+    if (item->extraLeadingSpace().isZero()) {
         return;
     }
-    item->setWritten(true);
-    if (item->extraLeadingSpace().isZero()) {
+    if (item->written()) {
         return;
     }
+    item->setWritten(true);
     xml.startElement(item);
     xml.tag("leadingSpace", item->extraLeadingSpace().val());
     xml.endElement();
@@ -3231,7 +3233,8 @@ void TWrite::writeSegments(XmlWriter& xml, WriteContext& ctx, track_idx_t strack
     }
 
     std::list<Spanner*> spanners;
-    auto sl = score->spannerMap().findOverlapping(sseg->tick().ticks(), endTick.ticks());
+    SpannerMap::IntervalList sl;
+    score->spannerMap().findOverlapping(sseg->tick().ticks(), endTick.ticks(), sl);
     for (auto i : sl) {
         Spanner* s = i.value;
         if (s->generated() || !ctx.canWrite(s)) {
@@ -3260,7 +3263,7 @@ void TWrite::writeSegments(XmlWriter& xml, WriteContext& ctx, track_idx_t strack
             if (!segment->enabled()) {
                 continue;
             }
-            if (track == 0) {
+            if (track == 0 && segment->written()) {
                 segment->setWritten(false);
             }
             EngravingItem* e = segment->element(track);
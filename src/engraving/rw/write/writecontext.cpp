@@ -41,6 +41,15 @@ int WriteContext::lidLocalIndex(int lid) const
     return muse::value(m_lidLocalIndices, lid, 0);
 }
 
+void WriteContext::mergeLinks(const WriteContext& part, const WriteContext& origin)
+{
+    if (part.m_linksIndexer != origin.m_linksIndexer) {
+        m_linksIndexer = part.m_linksIndexer;
+    }
+
+    m_lidLocalIndices.insert(part.m_lidLocalIndices.cbegin(), part.m_lidLocalIndices.cend());
+}
+
 bool WriteContext::canWrite(const EngravingItem* e) const
 {
     if (!_clipboardmode) {
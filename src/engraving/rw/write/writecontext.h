@@ -47,6 +47,11 @@ public:
     void setLidLocalIndex(int lid, int localIndex);
     int lidLocalIndex(int lid) const;
 
+    //! NOTE For the parts of a document written separately (e.g. staves on other threads):
+    //! `part` is a copy of `origin` used to write the next part, this takes its links state,
+    //! as if that part was written with this context
+    void mergeLinks(const WriteContext& part, const WriteContext& origin);
+
     Fraction curTick() const { return _curTick; }
     void setCurTick(const Fraction& v) { _curTick   = v; }
     void incCurTick(const Fraction& v) { _curTick += v; }
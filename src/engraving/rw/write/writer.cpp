@@ -21,12 +21,20 @@
  */
 #include "writer.h"
 
+#include <future>
+
+#include "concurrency/taskscheduler.h"
+#include "io/buffer.h"
+
 #include "../types/types.h"
 
 #include "dom/score.h"
 #include "dom/masterscore.h"
 #include "dom/part.h"
 #include "dom/excerpt.h"
+#include "dom/linkedobjects.h"
+#include "dom/measure.h"
+#include "dom/segment.h"
 #include "dom/staff.h"
 
 #include "../xmlwriter.h"
@@ -39,6 +47,92 @@ using namespace muse;
 using namespace mu::engraving;
 using namespace mu::engraving::write;
 
+//! NOTE Staves are independent blocks of the document, so they can be written on other threads
+//! as long as nothing is shared between them, which is not the case for:
+//! - linked staves in the same score (the copies refer to the local indices of the main elements)
+//! - segments leading space (written once, by the first staff that reaches the segment,
+//!   which is tracked with a flag of the segment)
+//! - disabled autoplace (the style is changed for a moment to write the item autoplace property)
+static bool canWriteStavesInParallel(const Score* score, const WriteContext& ctx, bool selectionOnly)
+{
+    if (selectionOnly || ctx.clipboardmode() || score->nstaves() < 2) {
+        return false;
+    }
+
+    if (!score->style().styleB(Sid::autoplaceEnabled)) {
+        return false;
+    }
+
+    for (const Staff* staff : score->staves()) {
+        if (!staff->links()) {
+            continue;
+        }
+        for (const EngravingObject* linked : *staff->links()) {
+            if (linked != staff && linked->score() == score) {
+                return false;
+            }
+        }
+    }
+
+    for (const Measure* m = score->firstMeasure(); m; m = m->nextMeasure()) {
+        const Measure* mmRest = m->mmRest();
+        for (const Measure* measure : { m, mmRest }) {
+            if (!measure) {
+                continue;
+            }
+            for (const Segment* s = measure->first(); s; s = s->next()) {
+                if (!s->extraLeadingSpace().isZero() || s->written()) {
+                    return false;
+                }
+            }
+        }
+    }
+
+    return true;
+}
+
+static void writeStavesInParallel(Score* score, XmlWriter& xml, WriteContext& ctx, MeasureBase* measureStart, MeasureBase* measureEnd,
+                                  staff_idx_t staffStart, staff_idx_t staffEnd)
+{
+    TRACEFUNC;
+
+    static muse::TaskScheduler scheduler;
+
+    // the spanners are looked up from all the staves
+    score->spannerMap().update();
+
+    const WriteContext origin = ctx;
+    const size_t depth = xml.depth();
+
+    std::vector<WriteContext> staffContexts(staffEnd - staffStart, origin);
+    std::vector<ByteArray> staffData(staffEnd - staffStart);
+    std::vector<std::future<void> > futures;
+    futures.reserve(staffData.size());
+
+    for (staff_idx_t staffIdx = staffStart; staffIdx < staffEnd; ++staffIdx) {
+        const size_t i = staffIdx - staffStart;
+        futures.push_back(scheduler.submit([score, measureStart, measureEnd, staffStart, staffIdx, depth,
+                                            staffCtx = &staffContexts[i], data = &staffData[i]]() {
+            io::Buffer buf(data);
+            buf.open(io::IODevice::WriteOnly);
+
+            XmlWriter staffXml(&buf);
+            staffXml.startFragment(depth);
+            StaffWrite::writeStaff(score->staff(staffIdx), staffXml, *staffCtx, measureStart, measureEnd, staffStart, staffIdx, false);
+            staffXml.flush();
+        }));
+    }
+
+    for (size_t i = 0; i < futures.size(); ++i) {
+        futures[i].get();
+        xml.writeFragment(staffData[i]);
+        ctx.mergeLinks(staffContexts[i], origin);
+    }
+
+    ctx.setCurTick(staffContexts.back().curTick());
+    ctx.setTickDiff(staffContexts.back().tickDiff());
+}
+
 Writer::Writer(const muse::modularity::ContextPtr& iocCtx)
     : muse::Injectable(iocCtx)
 {
@@ -254,7 +348,9 @@ void Writer::write(Score* score, XmlWriter& xml, WriteContext& ctx, bool selecti
 
     ctx.setCurTrack(0);
     ctx.setTrackDiff(-static_cast<int>(staffStart * VOICES));
-    if (measureStart) {
+    if (measureStart && canWriteStavesInParallel(score, ctx, selectionOnly)) {
+        writeStavesInParallel(score, xml, ctx, measureStart, measureEnd, staffStart, staffEnd);
+    } else if (measureStart) {
         for (staff_idx_t staffIdx = staffStart; staffIdx < staffEnd; ++staffIdx) {
             const Staff* st = score->staff(staffIdx);
             StaffWrite::writeStaff(st, xml, ctx, measureStart, measureEnd, staffStart, staffIdx, selectionOnly);
@@ -125,9 +125,10 @@ Fraction XmlReader::readFraction()
         if (i == muse::nidx) {
             return Fraction::fromTicks(s.toInt());
         } else {
-            String str = String::fromAscii(s.ascii());
-            z = str.left(i).toInt();
-            n = str.mid(i + 1).toInt();
+            //! NOTE Parse both halves straight from the UTF-8 text,
+            //! without transcoding to String; the numerator is short enough for SSO
+            z = AsciiStringView(std::string(s.ascii(), i)).toInt();
+            n = AsciiStringView(s.ascii() + i + 1, s.size() - i - 1).toInt();
         }
     }
     return Fraction(z, n);
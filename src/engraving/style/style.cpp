@@ -56,30 +56,18 @@ const PropertyValue& MStyle::value(Sid idx) const
     return StyleDef::styleValues[size_t(idx)].defaultValue();
 }
 
-Millimetre MStyle::valueMM(Sid idx) const
-{
-    if (idx == Sid::NOSTYLE) {
-        return Millimetre();
-    }
-
-    return m_precomputedValues[size_t(idx)];
-}
-
 void MStyle::set(const Sid t, const PropertyValue& val)
 {
     if (t == Sid::NOSTYLE) {
         return;
     }
 
-    const size_t idx = size_t(t);
-    m_values[idx] = val;
+    m_values[size_t(t)] = val;
     if (t == Sid::spatium) {
         precomputeValues();
     } else {
-        if (StyleDef::styleValues[idx].valueType() == P_TYPE::SPATIUM) {
-            double _spatium = value(Sid::spatium).toReal();
-            m_precomputedValues[idx] = m_values[idx].value<Spatium>().val() * _spatium;
-        }
+        precomputeValue(t, spatium());
+        ++m_generation;
     }
 }
 
@@ -92,9 +80,43 @@ void MStyle::precomputeValues()
 {
     double _spatium = value(Sid::spatium).toReal();
     for (const StyleDef::StyleValue& t : StyleDef::styleValues) {
-        if (t.valueType() == P_TYPE::SPATIUM) {
-            m_precomputedValues[t.idx()] = value(t.styleIdx()).value<Spatium>().val() * _spatium;
+        precomputeValue(t.styleIdx(), _spatium);
+    }
+    ++m_generation;
+}
+
+void MStyle::precomputeValue(Sid idx, double spatium)
+{
+    const size_t i = size_t(idx);
+    const PropertyValue& val = value(idx);
+
+    m_precomputedValues.mm[i] = Millimetre();
+    m_precomputedValues.reals[i] = 0.0;
+    m_precomputedValues.ints[i] = 0;
+    m_precomputedValues.bools[i] = false;
+
+    switch (val.type()) {
+    case P_TYPE::BOOL:
+    case P_TYPE::INT:
+        m_precomputedValues.ints[i] = val.toInt();
+        m_precomputedValues.bools[i] = val.toBool();
+        break;
+    case P_TYPE::SIZE_T:
+        m_precomputedValues.ints[i] = val.toInt();
+        break;
+    case P_TYPE::REAL:
+        m_precomputedValues.reals[i] = val.toReal();
+        break;
+    case P_TYPE::SPATIUM: {
+        const double sp = val.value<Spatium>().val();
+        m_precomputedValues.reals[i] = sp;
+        m_precomputedValues.mm[i] = sp * spatium;
+    } break;
+    default:
+        if (val.isEnum()) {
+            m_precomputedValues.ints[i] = val.toInt();
         }
+        break;
     }
 }
 
@@ -46,23 +46,26 @@ class XmlWriter;
 class MStyle
 {
 public:
-    MStyle() = default;
+    MStyle() { precomputeValues(); }
 
     const PropertyValue& styleV(Sid idx) const { return value(idx); }
     Spatium styleS(Sid idx) const
     {
         assert(MStyle::valueType(idx) == P_TYPE::SPATIUM);
-        return value(idx).value<Spatium>();
+        return Spatium(precomputed(m_precomputedValues.reals, idx));
     }
 
     Millimetre styleMM(Sid idx) const { assert(MStyle::valueType(idx) == P_TYPE::SPATIUM); return valueMM(idx); }
     String  styleSt(Sid idx) const { assert(MStyle::valueType(idx) == P_TYPE::STRING); return value(idx).value<String>(); }
-    bool     styleB(Sid idx) const { assert(MStyle::valueType(idx) == P_TYPE::BOOL); return value(idx).toBool(); }
-    double   styleD(Sid idx) const { assert(MStyle::valueType(idx) == P_TYPE::REAL); return value(idx).toReal(); }
-    int      styleI(Sid idx) const { /* can be int or enum, so no assert */ return value(idx).toInt(); }
+    bool     styleB(Sid idx) const { assert(MStyle::valueType(idx) == P_TYPE::BOOL); return precomputed(m_precomputedValues.bools, idx); }
+    double   styleD(Sid idx) const { assert(MStyle::valueType(idx) == P_TYPE::REAL); return precomputed(m_precomputedValues.reals, idx); }
+    int      styleI(Sid idx) const { /* can be int or enum, so no assert */ return precomputed(m_precomputedValues.ints, idx); }
+
+    //! NOTE Changed each time a value is set, so that values computed from the style can be checked
+    size_t generation() const { return m_generation; }
 
     const PropertyValue& value(Sid idx) const;
-    Millimetre valueMM(Sid idx) const;
+    Millimetre valueMM(Sid idx) const { return precomputed(m_precomputedValues.mm, idx); }
 
     void set(Sid idx, const PropertyValue& v);
 
@@ -95,8 +98,26 @@ private:
     bool readStyleValCompat(XmlReader&);
     bool readTextStyleValCompat(XmlReader&);
 
+    //! NOTE The values converted to the types they are read as, so that styleB/styleI/styleD/styleS/styleMM
+    //! are array loads instead of PropertyValue conversions
+    struct PrecomputedValues {
+        std::array<Millimetre, size_t(Sid::STYLES)> mm = {};      // SPATIUM values in mm
+        std::array<double, size_t(Sid::STYLES)> reals = {};       // REAL and SPATIUM values
+        std::array<int, size_t(Sid::STYLES)> ints = {};           // INT, BOOL, SIZE_T and enum values
+        std::array<bool, size_t(Sid::STYLES)> bools = {};         // BOOL and INT values
+    };
+
+    template<typename T>
+    static T precomputed(const std::array<T, size_t(Sid::STYLES)>& values, Sid idx)
+    {
+        return idx == Sid::NOSTYLE ? T() : values[size_t(idx)];
+    }
+
+    void precomputeValue(Sid idx, double spatium);
+
     std::array<PropertyValue, size_t(Sid::STYLES)> m_values;
-    std::array<Millimetre, size_t(Sid::STYLES)> m_precomputedValues;
+    PrecomputedValues m_precomputedValues;
+    size_t m_generation = 0;
 
     void readVersion(String versionTag);
     int m_version = 0;
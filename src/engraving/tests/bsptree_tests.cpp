@@ -22,6 +22,8 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+
 #include "dom/bsp.h"
 #include "dom/page.h"
 
@@ -86,3 +88,43 @@ TEST_F(Engraving_BspTreeTests, NearestNeighbor)
         EXPECT_EQ(nn, singleNote);
     }
 }
+
+/**
+ * @brief BspTreeTests_ForEachItem
+ * @details Check that BspTree::forEachItem visits the same items as BspTree::items, each of them once
+ */
+TEST_F(Engraving_BspTreeTests, ForEachItem)
+{
+    Score* score = ScoreRW::readScore(BSPTREE_DATA_DIR + u"nearest_neighbor.mscx");
+    EXPECT_TRUE(score);
+
+    Page* page = score->pages().at(0);
+    EXPECT_TRUE(page);
+
+    // [GIVEN] A BspTree containing all the elements of the page
+    BspTree bsp;
+    const RectF pageRect = page->pageBoundingRect();
+    bsp.initialize(pageRect, static_cast<int>(page->elements().size()));
+    for (EngravingItem* elem : page->elements()) {
+        bsp.insert(elem);
+    }
+
+    // [WHEN] Querying the whole page and a part of it
+    for (const RectF& rect : { pageRect, pageRect.adjusted(0.0, 0.0, -pageRect.width() * 0.5, -pageRect.height() * 0.5) }) {
+        std::vector<EngravingItem*> expected = bsp.items(rect);
+
+        std::vector<EngravingItem*> visited;
+        bsp.forEachItem(rect, [&visited](EngravingItem* item) {
+            visited.push_back(item);
+        });
+
+        // [THEN] Both queries return the same items, and no item is left marked as discovered
+        std::sort(expected.begin(), expected.end());
+        std::sort(visited.begin(), visited.end());
+        EXPECT_EQ(visited, expected);
+
+        for (const EngravingItem* item : visited) {
+            EXPECT_FALSE(item->itemDiscovered);
+        }
+    }
+}
@@ -28,6 +28,7 @@
 #include "draw/bufferedpaintprovider.h"
 #include "draw/utils/drawdatarw.h"
 #include "draw/utils/drawdatacomp.h"
+#include "draw/utils/drawdatapaint.h"
 
 #include "global/io/file.h"
 
@@ -307,3 +308,138 @@ TEST_F(Engraving_DrawDataTests, ScoreDrawDiff)
 
     saveDiff("4_diff.png", data1, diff.dataAdded);
 }
+
+TEST_F(Engraving_DrawDataTests, ReplayTranslatedFiltered)
+{
+    // record two objects
+    DrawDataPtr recorded;
+    {
+        std::shared_ptr<BufferedPaintProvider> prv = std::make_shared<BufferedPaintProvider>();
+        Painter p(prv, "record");
+
+        p.setPen(Color::GREEN);
+
+        p.beginObject("line_1");
+        p.translate(10, 0);
+        p.drawLine(0, 0, 120, 0);
+        p.translate(-10, 0);
+        p.endObject();
+
+        p.beginObject("line_2");
+        p.drawLine(0, 20, 120, 20);
+        p.endObject();
+
+        p.endDraw();
+
+        recorded = prv->drawData();
+    }
+
+    ASSERT_EQ(recorded->item.chilren.size(), 2);
+
+    // replay only the first object into a translated painter
+    DrawDataPtr replayed;
+    {
+        std::shared_ptr<BufferedPaintProvider> prv = std::make_shared<BufferedPaintProvider>();
+        Painter p(prv, "replay");
+
+        p.translate(100, 50);
+        DrawDataPaint::paint(&p, recorded, [](size_t idx) { return idx == 0; });
+
+        // the painter state is not changed by the replay
+        EXPECT_EQ(prv->transform(), p.worldTransform());
+
+        p.endDraw();
+
+        replayed = prv->drawData();
+    }
+
+    std::vector<Transform> transforms;
+    for (const DrawData::Data& d : replayed->item.datas) {
+        for (size_t i = 0; i < d.polygons.size(); ++i) {
+            transforms.push_back(replayed->states.at(d.state).transform);
+        }
+    }
+
+    ASSERT_EQ(transforms.size(), 1);
+    EXPECT_EQ(transforms.front(), Transform().translate(110, 50));
+}
+
+TEST_F(Engraving_DrawDataTests, ReplayChildIndices)
+{
+    // record three objects
+    DrawDataPtr recorded;
+    {
+        std::shared_ptr<BufferedPaintProvider> prv = std::make_shared<BufferedPaintProvider>();
+        Painter p(prv, "record");
+
+        p.setPen(Color::GREEN);
+
+        for (int i = 0; i < 3; ++i) {
+            p.beginObject("line_" + std::to_string(i));
+            p.drawLine(0, i * 10, 120, i * 10);
+            p.endObject();
+        }
+
+        p.endDraw();
+
+        recorded = prv->drawData();
+    }
+
+    ASSERT_EQ(recorded->item.chilren.size(), 3);
+
+    // replay only the first and the last object
+    DrawDataPtr replayed;
+    {
+        std::shared_ptr<BufferedPaintProvider> prv = std::make_shared<BufferedPaintProvider>();
+        Painter p(prv, "replay");
+
+        DrawDataPaint::paint(&p, recorded, std::vector<size_t> { 0, 2 });
+
+        p.endDraw();
+
+        replayed = prv->drawData();
+    }
+
+    std::vector<double> lines;
+    for (const DrawData::Data& d : replayed->item.datas) {
+        for (const DrawPolygon& polygon : d.polygons) {
+            lines.push_back(polygon.polygon.at(0).y());
+        }
+    }
+
+    ASSERT_EQ(lines.size(), 2);
+    EXPECT_EQ(lines.at(0), 0.0);
+    EXPECT_EQ(lines.at(1), 20.0);
+}
+
+TEST_F(Engraving_DrawDataTests, RecordLines)
+{
+    // lines passed at once are recorded like single lines
+    DrawDataPtr recorded;
+    {
+        std::shared_ptr<BufferedPaintProvider> prv = std::make_shared<BufferedPaintProvider>();
+        Painter p(prv, "record");
+
+        std::vector<LineF> lines;
+        for (int i = 0; i < 5; ++i) {
+            lines.push_back(LineF(0, i * 10, 120, i * 10));
+        }
+        p.drawLines(lines.data(), lines.size());
+
+        p.endDraw();
+
+        recorded = prv->drawData();
+    }
+
+    std::vector<DrawPolygon> polygons;
+    for (const DrawData::Data& d : recorded->item.datas) {
+        polygons.insert(polygons.end(), d.polygons.begin(), d.polygons.end());
+    }
+
+    ASSERT_EQ(polygons.size(), 5);
+    for (size_t i = 0; i < polygons.size(); ++i) {
+        EXPECT_EQ(polygons.at(i).mode, PolygonMode::Polyline);
+        EXPECT_EQ(polygons.at(i).polygon.size(), 2);
+        EXPECT_EQ(polygons.at(i).polygon.at(1), PointF(120, i * 10));
+    }
+}
@@ -25,12 +25,17 @@
 #include "dom/engravingitem.h"
 #include "dom/factory.h"
 #include "dom/masterscore.h"
+#include "dom/measure.h"
+#include "dom/segment.h"
+#include "dom/text.h"
 
 #include "utils/scorerw.h"
 #include "engraving/compat/scoreaccess.h"
 
 using namespace mu::engraving;
 
+static const String MEASURE_DATA_DIR("measure_data/");
+
 class Engraving_ElementTests : public ::testing::Test
 {
 };
@@ -103,3 +108,50 @@ TEST_F(Engraving_ElementTests, DISABLED_testIds)
         delete ee;
     }
 }
+
+//---------------------------------------------------------
+//   eidLookup
+///   elements are found by their EID without scanning the score,
+///   also after their EID changes, and no longer once deleted
+//---------------------------------------------------------
+TEST_F(Engraving_ElementTests, eidLookup)
+{
+    MasterScore* score = ScoreRW::readScore(MEASURE_DATA_DIR + u"measure-1.mscx");
+    ASSERT_TRUE(score);
+
+    Measure* m = score->firstMeasure();
+    ASSERT_TRUE(m);
+    Segment* s = m->first();
+    ASSERT_TRUE(s);
+
+    //! CHECK elements read from the file are found
+    EXPECT_EQ(score->objectByEID(m->eid()), m);
+    EXPECT_EQ(score->objectByEID(s->eid()), s);
+
+    //! CHECK batch lookup keeps the order and reports unknown EIDs
+    const std::vector<EngravingObject*> found = score->objectsByEIDs({ s->eid(), EID(), m->eid() });
+    ASSERT_EQ(found.size(), 3u);
+    EXPECT_EQ(found[0], s);
+    EXPECT_EQ(found[1], nullptr);
+    EXPECT_EQ(found[2], m);
+
+    //! DO change the EID of the measure
+    const EID oldEid = m->eid();
+    const EID newEid = score->getEID()->newEID(ElementType::MEASURE);
+    m->setEID(newEid);
+
+    //! CHECK only the new EID is found
+    EXPECT_EQ(score->objectByEID(oldEid), nullptr);
+    EXPECT_EQ(score->objectByEID(newEid), m);
+
+    //! DO create and delete an element
+    Text* text = Factory::createText(score->dummy(), TextStyleType::DEFAULT);
+    const EID textEid = text->eid();
+    EXPECT_EQ(score->objectByEID(textEid), text);
+    delete text;
+
+    //! CHECK the deleted element is not found
+    EXPECT_EQ(score->objectByEID(textEid), nullptr);
+
+    delete score;
+}
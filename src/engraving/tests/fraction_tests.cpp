@@ -0,0 +1,78 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-Studio-CLA-applies
+ *
+ * MuseScore Studio
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2025 MuseScore Limited
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include "types/fraction.h"
+
+using namespace mu::engraving;
+
+class Engraving_FractionTests : public ::testing::Test
+{
+};
+
+//! NOTE The addition as it is done without the shortcuts for common denominators
+static Fraction referenceAdd(const Fraction& a, const Fraction& b)
+{
+    const int64_t g = std::gcd(int64_t(a.denominator()), int64_t(b.denominator()));
+    const int64_t m1 = b.denominator() / g;
+    return Fraction(static_cast<int>(a.numerator() * m1 + b.numerator() * (a.denominator() / g)),
+                    static_cast<int>(m1 * a.denominator()));
+}
+
+TEST_F(Engraving_FractionTests, addSubtract)
+{
+    const int denominators[] = { 1, 2, 3, 4, 5, 6, 8, 12, 16, 24, 32, 48, 64, 96, 128, Constants::DIVISION * 4 };
+    const int numerators[] = { -7, -1, 0, 1, 3, 5, 11 };
+
+    for (int d1 : denominators) {
+        for (int d2 : denominators) {
+            for (int n1 : numerators) {
+                for (int n2 : numerators) {
+                    const Fraction a(n1, d1);
+                    const Fraction b(n2, d2);
+
+                    //! CHECK The result is identical, not only equal, to the general case
+                    EXPECT_TRUE((a + b).identical(referenceAdd(a, b))) << n1 << "/" << d1 << " + " << n2 << "/" << d2;
+                    EXPECT_TRUE((a - b).identical(referenceAdd(a, -b))) << n1 << "/" << d1 << " - " << n2 << "/" << d2;
+                }
+            }
+        }
+    }
+}
+
+TEST_F(Engraving_FractionTests, ticks)
+{
+    Fraction tick(0, 1);
+    int ticks = 0;
+    const Fraction durations[] = { Fraction(1, 4), Fraction(1, 8), Fraction(1, 16), Fraction(3, 8), Fraction(1, 32), Fraction(1, 2) };
+
+    for (int i = 0; i < 1000; ++i) {
+        const Fraction& d = durations[i % std::size(durations)];
+        tick += d;
+        ticks += d.ticks();
+        ASSERT_EQ(tick.ticks(), ticks);
+    }
+
+    tick -= Fraction::fromTicks(ticks);
+    EXPECT_TRUE(tick.isZero());
+}
@@ -0,0 +1,190 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-Studio-CLA-applies
+ *
+ * MuseScore Studio
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2024 MuseScore Limited
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <functional>
+
+#include "global/io/buffer.h"
+#include "global/io/dir.h"
+#include "global/io/file.h"
+#include "global/serialization/json.h"
+
+#include "dom/chord.h"
+#include "dom/masterscore.h"
+#include "dom/measure.h"
+#include "dom/note.h"
+#include "dom/segment.h"
+#include "dom/undo.h"
+
+#include "rendering/score/layoutstatistics.h"
+#include "rw/rwregister.h"
+
+#include "utils/scorerw.h"
+
+#include "log.h"
+
+using namespace mu;
+using namespace muse;
+using namespace mu::engraving;
+
+//! NOTE The benchmarks are disabled by default, run them with
+//! `engraving_tests --gtest_also_run_disabled_tests --gtest_filter=*LayoutBenchmark*`
+//! MU_ENGRAVING_BENCHMARK_SCORES overrides the scores directory (vtest/scores by default),
+//! MU_ENGRAVING_BENCHMARK_OUTPUT overrides the results file (layout_benchmark.json by default).
+
+static const muse::io::path_t DATA_ROOT(engraving_tests_DATA_ROOT);
+static const muse::io::path_t VTEST_SCORES = DATA_ROOT + "/../../../vtest/scores";
+
+static constexpr int ITERATIONS = 3;
+
+class Engraving_LayoutBenchmark : public ::testing::Test
+{
+public:
+    static muse::io::path_t scoresDir()
+    {
+        const char* dir = std::getenv("MU_ENGRAVING_BENCHMARK_SCORES");
+        return dir ? muse::io::path_t(dir) : VTEST_SCORES;
+    }
+
+    static muse::io::path_t outputFile()
+    {
+        const char* file = std::getenv("MU_ENGRAVING_BENCHMARK_OUTPUT");
+        return file ? muse::io::path_t(file) : muse::io::path_t("layout_benchmark.json");
+    }
+
+    //! NOTE Returns min and mean time in milliseconds
+    static JsonObject measure(const std::function<void()>& func)
+    {
+        double min = 0.0;
+        double total = 0.0;
+        for (int i = 0; i < ITERATIONS; ++i) {
+            auto start = std::chrono::steady_clock::now();
+            func();
+            double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+            min = (i == 0) ? ms : std::min(min, ms);
+            total += ms;
+        }
+
+        JsonObject obj;
+        obj.set("min_ms", min);
+        obj.set("mean_ms", total / ITERATIONS);
+        return obj;
+    }
+
+    static Measure* middleMeasure(MasterScore* score)
+    {
+        Measure* m = score->firstMeasure();
+        for (size_t i = 0; m && i < score->nmeasures() / 2; ++i) {
+            m = m->nextMeasure();
+        }
+        return m;
+    }
+
+    static Note* firstNote(Measure* m)
+    {
+        for (Segment* s = m ? m->first(SegmentType::ChordRest) : nullptr; s; s = s->next(SegmentType::ChordRest)) {
+            EngravingItem* e = s->element(0);
+            if (e && e->isChord()) {
+                return toChord(e)->upNote();
+            }
+        }
+        return nullptr;
+    }
+};
+
+/**
+ * @brief LayoutBenchmark_Corpus
+ * @details For every score of the corpus measures full layout, incremental relayout after
+ * scripted edits (and their undo) and saving, and writes the results as JSON
+ */
+TEST_F(Engraving_LayoutBenchmark, DISABLED_Corpus)
+{
+    RetVal<io::paths_t> files = io::Dir::scanFiles(scoresDir(), { "*.mscx", "*.mscz" }, io::ScanMode::FilesInCurrentDir);
+    ASSERT_TRUE(files.ret);
+
+    rendering::score::LayoutStatistics* stats = rendering::score::LayoutStatistics::instance();
+
+    JsonArray results;
+    for (const io::path_t& path : files.val) {
+        MasterScore* score = ScoreRW::readScore(path.toString(), true);
+        if (!score) {
+            LOGW() << "skip, failed read: " << path;
+            continue;
+        }
+
+        JsonObject result;
+        result.set("score", io::filename(path).toStdString());
+        result.set("measures", static_cast<int>(score->nmeasures()));
+
+        stats->clear();
+        stats->setEnabled(true);
+        result.set("full_layout", measure([score]() {
+            score->doLayout();
+        }));
+        stats->setEnabled(false);
+
+        std::string statsJson = stats->toJson();
+        result.set("full_layout_statistics", JsonDocument::fromJson(ByteArray(statsJson.c_str(), statsJson.size())).rootObject());
+
+        Note* note = firstNote(middleMeasure(score));
+        if (note) {
+            result.set("relayout_pitch", measure([score, note]() {
+                score->startCmd(TranslatableString::untranslatable("Layout benchmark"));
+                score->select(note);
+                score->upDown(true, UpDownMode::CHROMATIC);
+                score->endCmd();
+                score->undoRedo(true, nullptr);
+            }));
+        }
+
+        Measure* m = middleMeasure(score);
+        if (m) {
+            result.set("relayout_line_break", measure([score, m]() {
+                score->startCmd(TranslatableString::untranslatable("Layout benchmark"));
+                score->select(m, SelectType::SINGLE, 0);
+                score->cmdToggleLayoutBreak(LayoutBreakType::LINE);
+                score->endCmd();
+                score->undoRedo(true, nullptr);
+            }));
+        }
+
+        result.set("save", measure([score]() {
+            io::Buffer buf;
+            buf.open(io::IODevice::WriteOnly);
+            rw::RWRegister::writer(score->iocContext())->writeScore(score, &buf, false);
+        }));
+
+        results.append(result);
+        delete score;
+    }
+
+    JsonObject root;
+    root.set("iterations", ITERATIONS);
+    root.set("scores", results);
+
+    Ret ret = io::File::writeFile(outputFile(), JsonDocument(root).toJson());
+    EXPECT_TRUE(ret);
+}
@@ -248,6 +248,68 @@ TEST_F(Engraving_LinksTests, test3LinkedParts_99796)
     EXPECT_TRUE(e->links()->size() == 2);
 }
 
+//---------------------------------------------------------
+//   findLinkedInScore
+///  Create an empty 1 staff score with a part and a linked staff
+///  Look up the linked rests by score and by staff
+//---------------------------------------------------------
+
+TEST_F(Engraving_LinksTests, findLinkedInScore)
+{
+    MCursor c;
+    c.setTimeSig(Fraction(4, 4));
+    c.createScore(nullptr, u"test");
+    c.addPart(u"voice");
+    c.move(0, Fraction(0, 1));       // move to track 0 tick 0
+
+    c.addKeySig(Key(1));
+    c.addTimeSig(Fraction(4, 4));
+    c.addChord(60, TDuration(DurationType::V_WHOLE));
+
+    MasterScore* score = c.score();
+    score->doLayout();
+    Segment* s = score->firstMeasure()->first(SegmentType::ChordRest);
+    score->select(s->element(0));
+    score->cmdDeleteSelection();
+
+    // create parts
+    score->startCmd(TranslatableString::untranslatable("Engraving links tests"));
+    std::vector<Part*> parts;
+    parts.push_back(score->parts().at(0));
+    Score* nscore = score->createScore();
+    Excerpt ex(score);
+    ex.setExcerptScore(nscore);
+    ex.setName(u"voice");
+    ex.setParts(parts);
+    Excerpt::createExcerpt(&ex);
+    score->undo(new AddExcerpt(&ex));
+    score->endCmd();
+
+    // add a linked staff
+    score->startCmd(TranslatableString::untranslatable("Engraving links tests"));
+    Staff* oStaff = score->staff(0);
+    Staff* staff  = Factory::createStaff(oStaff->part());
+    staff->setPart(oStaff->part());
+    score->undoInsertStaff(staff, 1, false);
+    Excerpt::cloneStaff(oStaff, staff);
+    score->endCmd();
+
+    EngravingItem* rest = s->element(0);
+    EngravingItem* linkedRest = s->element(4);
+    ASSERT_TRUE(rest && rest->links());
+    EXPECT_EQ(rest->links()->size(), 3u);
+
+    auto inMaster = rest->links()->objectsInScore(score);
+    EXPECT_EQ(std::distance(inMaster.first, inMaster.second), 2);
+
+    auto inPart = rest->links()->objectsInScore(nscore);
+    ASSERT_EQ(std::distance(inPart.first, inPart.second), 1);
+    EXPECT_EQ((*inPart.first)->score(), nscore);
+
+    EXPECT_EQ(rest->findLinkedInStaff(score->staff(1)), linkedRest);
+    EXPECT_EQ(rest->findLinkedInScore(nscore), *inPart.first);
+}
+
 //---------------------------------------------------------
 //   test4LinkedParts_94911
 ///  Create an empty 1 staff score
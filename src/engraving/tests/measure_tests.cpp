@@ -606,3 +606,87 @@ TEST_F(Engraving_MeasureTests, measureSplit) {
 
     EXPECT_TRUE(ScoreComp::saveCompareScore(score, u"measureSplit.mscx", MEASURE_DATA_DIR + u"measureSplit-ref.mscx"));
 }
+
+TEST_F(Engraving_MeasureTests, tick2measureAfterInsert)
+{
+    MasterScore* score = ScoreRW::readScore(MEASURE_DATA_DIR + u"measure-insert_beginning.mscx");
+    EXPECT_TRUE(score);
+
+    for (Measure* m = score->firstMeasure(); m; m = m->nextMeasure()) {
+        EXPECT_EQ(score->tick2measure(m->tick()), m);
+    }
+
+    score->startCmd(TranslatableString::untranslatable("Engraving measure tests"));
+    score->insertMeasure(score->firstMeasure());
+    score->endCmd();
+
+    for (Measure* m = score->firstMeasure(); m; m = m->nextMeasure()) {
+        EXPECT_EQ(score->tick2measure(m->tick()), m);
+        EXPECT_EQ(score->tick2measure(m->tick() + m->ticks() - Fraction(1, 1920)), m);
+    }
+
+    EXPECT_EQ(score->tick2measure(score->lastMeasure()->endTick() + Fraction(1, 4)), nullptr);
+
+    delete score;
+}
+
+TEST_F(Engraving_MeasureTests, findSegmentThroughIndex)
+{
+    MasterScore* score = ScoreRW::readScore(MEASURE_DATA_DIR + u"measure-insert_beginning.mscx");
+    EXPECT_TRUE(score);
+
+    for (Measure* m = score->firstMeasure(); m; m = m->nextMeasure()) {
+        // the second typed lookup after a change builds the index
+        m->findSegmentR(SegmentType::ChordRest, Fraction(0, 1));
+        EXPECT_TRUE(m->segments().indexed());
+
+        std::vector<Segment*> chordRests;
+        for (Segment* s = m->first(SegmentType::ChordRest); s; s = s->next(SegmentType::ChordRest)) {
+            chordRests.push_back(s);
+        }
+
+        std::vector<Segment*> indexed;
+        for (Segment* s : m->segments().segments(SegmentType::ChordRest)) {
+            indexed.push_back(s);
+        }
+        EXPECT_EQ(indexed, chordRests);
+
+        for (Segment* s = m->first(); s; s = s->next()) {
+            Segment* expected = s;
+            while (expected->prev() && expected->prev()->rtick() == s->rtick()) {
+                expected = expected->prev();
+            }
+            while (!(expected->segmentType() & s->segmentType())) {
+                expected = expected->next();
+            }
+            EXPECT_EQ(m->findSegmentR(s->segmentType(), s->rtick()), expected);
+        }
+    }
+
+    delete score;
+}
+
+TEST_F(Engraving_MeasureTests, crMeasureAfterInsert)
+{
+    MasterScore* score = ScoreRW::readScore(MEASURE_DATA_DIR + u"measure-insert_beginning.mscx");
+    EXPECT_TRUE(score);
+
+    //! DO insert a measure at the beginning, so that all indexes shift
+    Measure* oldFirst = score->firstMeasure();
+    EXPECT_EQ(score->crMeasure(0), oldFirst);
+
+    score->startCmd(TranslatableString::untranslatable("Engraving measure tests"));
+    score->insertMeasure(oldFirst);
+    score->endCmd();
+
+    //! CHECK measures are found by their index in the new list
+    int idx = 0;
+    for (Measure* m = score->firstMeasure(); m; m = m->nextMeasure(), ++idx) {
+        EXPECT_EQ(score->crMeasure(idx), m);
+    }
+    EXPECT_EQ(score->crMeasure(1), oldFirst);
+    EXPECT_EQ(score->crMeasure(idx), nullptr);
+    EXPECT_EQ(score->crMeasure(-1), nullptr);
+
+    delete score;
+}
@@ -64,6 +64,8 @@ public:
     MOCK_METHOD(bool, dynamicsApplyToAllVoices, (), (const, override));
     MOCK_METHOD(void, setDynamicsApplyToAllVoices, (bool), (override));
 
+    MOCK_METHOD(size_t, undoMemoryBudget, (), (const, override));
+
     MOCK_METHOD(bool, scoreInversionEnabled, (), (const, override));
     MOCK_METHOD(void, setScoreInversionEnabled, (bool), (override));
     MOCK_METHOD(muse::async::Notification, scoreInversionChanged, (), (const, override));
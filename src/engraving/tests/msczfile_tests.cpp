@@ -21,9 +21,12 @@
  */
 #include <gtest/gtest.h>
 
+#include <string>
+
 #include <QByteArray>
 
 #include "io/buffer.h"
+#include "serialization/zipwriter.h"
 #include "infrastructure/mscwriter.h"
 #include "infrastructure/mscreader.h"
 
@@ -88,3 +91,182 @@ TEST_F(Engraving_MsczFileTests, MsczFile_WriteRead)
         EXPECT_EQ(imageData, originImageData);
     }
 }
+
+TEST_F(Engraving_MsczFileTests, MsczFile_DeferredWrite)
+{
+    //! CASE Writing is deferred until the writer is flushed
+
+    //! GIVEN Some datas, one of them not owning its memory
+    const ByteArray originScoreData("score");
+    const ByteArray originStyleData("style");
+
+    MscWriter::Params params;
+    params.filePath = "simple1.mscz";
+    params.mode = MscIoMode::Zip;
+    params.deferred = true;
+
+    MscWriter writer(params);
+    writer.open();
+
+    {
+        std::string audioSettings = "audio settings";
+        writer.writeScoreFile(originScoreData);
+        writer.writeStyleFile(originStyleData);
+        writer.writeAudioSettingsJsonFile(ByteArray::fromRawData(audioSettings.data(), audioSettings.size()));
+        audioSettings.assign(audioSettings.size(), 'x');
+    }
+
+    writer.close();
+
+    //! DO Flush the writer
+    ByteArray msczData;
+    Buffer writeBuf(&msczData);
+    Ret ret = writer.flush(&writeBuf);
+
+    //! CHECK Read and compare with origin
+    EXPECT_TRUE(ret);
+    EXPECT_FALSE(msczData.empty());
+
+    Buffer readBuf(&msczData);
+    MscReader::Params readParams;
+    readParams.device = &readBuf;
+    readParams.filePath = "simple1.mscz";
+    readParams.mode = MscIoMode::Zip;
+
+    MscReader reader(readParams);
+    reader.open();
+
+    EXPECT_EQ(reader.readScoreFile(), originScoreData);
+    EXPECT_EQ(reader.readStyleFile(), originStyleData);
+    EXPECT_EQ(reader.readAudioSettingsJsonFile(), ByteArray("audio settings"));
+}
+
+TEST_F(Engraving_MsczFileTests, MsczFile_CompressionCache)
+{
+    //! CASE Writing a few times with the same compression cache
+
+    //! GIVEN A compression cache, filled by the first write
+    const ByteArray originImageData("image");
+    std::shared_ptr<ZipCompressionCache> cache = ZipWriter::makeCompressionCache();
+
+    auto write = [&cache, &originImageData](const ByteArray& scoreData) {
+        ByteArray msczData;
+        Buffer buf(&msczData);
+        MscWriter::Params params;
+        params.device = &buf;
+        params.filePath = "simple1.mscz";
+        params.mode = MscIoMode::Zip;
+        params.zipCompressionCache = cache;
+
+        MscWriter writer(params);
+        writer.open();
+        writer.writeScoreFile(scoreData);
+        writer.addImageFile(u"image1.png", originImageData);
+        writer.close();
+
+        return msczData;
+    };
+
+    write(ByteArray("score"));
+
+    //! DO Write the changed score again
+    const ByteArray changedScoreData("changed score");
+    ByteArray msczData = write(changedScoreData);
+
+    //! CHECK Both the changed and the unchanged files are read correctly
+    Buffer buf(&msczData);
+    MscReader::Params params;
+    params.device = &buf;
+    params.filePath = "simple1.mscz";
+    params.mode = MscIoMode::Zip;
+
+    MscReader reader(params);
+    reader.open();
+
+    EXPECT_EQ(reader.readScoreFile(), changedScoreData);
+    EXPECT_EQ(reader.readImageFile(u"image1.png"), originImageData);
+}
+
+TEST_F(Engraving_MsczFileTests, MsczFile_ParallelCompression)
+{
+    //! CASE The files are compressed in parallel, a big one in chunks
+
+    //! GIVEN A big score and some excerpts
+    std::string score;
+    for (int i = 0; score.size() < 1024 * 1024; ++i) {
+        score += "<Note><pitch>" + std::to_string(i % 97) + "</pitch></Note>\n";
+    }
+    const ByteArray originScoreData(score.c_str(), score.size());
+    const ByteArray originExcerptData1("excerpt 1");
+    const ByteArray originExcerptData2("excerpt 2");
+
+    MscWriter::Params params;
+    params.filePath = "simple1.mscz";
+    params.mode = MscIoMode::Zip;
+    params.deferred = true;
+
+    MscWriter writer(params);
+    writer.open();
+    writer.writeScoreFile(originScoreData);
+    writer.addExcerptFile(u"excerpt1", originExcerptData1);
+    writer.addExcerptFile(u"excerpt2", originExcerptData2);
+    writer.close();
+
+    //! DO Flush the writer
+    ByteArray msczData;
+    Buffer writeBuf(&msczData);
+    Ret ret = writer.flush(&writeBuf);
+
+    //! CHECK The score is compressed, read and compare with origin
+    EXPECT_TRUE(ret);
+    EXPECT_LT(msczData.size(), originScoreData.size() / 4);
+
+    Buffer readBuf(&msczData);
+    MscReader::Params readParams;
+    readParams.device = &readBuf;
+    readParams.filePath = "simple1.mscz";
+    readParams.mode = MscIoMode::Zip;
+
+    MscReader reader(readParams);
+    reader.open();
+
+    EXPECT_EQ(reader.readScoreFile(), originScoreData);
+    EXPECT_EQ(reader.readExcerptFile(u"excerpt1"), originExcerptData1);
+    EXPECT_EQ(reader.readExcerptFile(u"excerpt2"), originExcerptData2);
+}
+
+TEST_F(Engraving_MsczFileTests, MsczFile_CompressionDisabled)
+{
+    //! CASE Writing without compression (e.g. autosave)
+
+    //! GIVEN A score which compresses well
+    const ByteArray originScoreData(std::string(100000, 'a').c_str(), 100000);
+
+    ByteArray msczData;
+    Buffer buf(&msczData);
+    MscWriter::Params params;
+    params.device = &buf;
+    params.filePath = "simple1.mscz";
+    params.mode = MscIoMode::Zip;
+    params.zipCompressionEnabled = false;
+
+    //! DO Write it
+    MscWriter writer(params);
+    writer.open();
+    writer.writeScoreFile(originScoreData);
+    writer.close();
+
+    //! CHECK It is stored as is, read and compare with origin
+    EXPECT_GT(msczData.size(), originScoreData.size());
+
+    Buffer readBuf(&msczData);
+    MscReader::Params readParams;
+    readParams.device = &readBuf;
+    readParams.filePath = "simple1.mscz";
+    readParams.mode = MscIoMode::Zip;
+
+    MscReader reader(readParams);
+    reader.open();
+
+    EXPECT_EQ(reader.readScoreFile(), originScoreData);
+}
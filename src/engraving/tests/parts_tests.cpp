@@ -22,6 +22,8 @@
 
 #include <gtest/gtest.h>
 
+#include "io/buffer.h"
+
 #include "dom/breath.h"
 #include "dom/chord.h"
 #include "dom/chordline.h"
@@ -34,17 +36,26 @@
 #include "dom/masterscore.h"
 #include "dom/measure.h"
 #include "dom/measurerepeat.h"
+#include "dom/memoryusage.h"
 #include "dom/note.h"
 #include "dom/part.h"
 #include "dom/segment.h"
 #include "dom/spanner.h"
 #include "dom/staff.h"
 
+#include "compat/scoreaccess.h"
+#include "infrastructure/localfileinfoprovider.h"
+#include "infrastructure/mscreader.h"
+#include "infrastructure/mscwriter.h"
+#include "rw/mscloader.h"
+#include "rw/mscsaver.h"
+
 #include "utils/scorerw.h"
 #include "utils/scorecomp.h"
 #include "utils/testutils.h"
 
 using namespace mu;
+using namespace muse::io;
 using namespace mu::engraving;
 
 static const String PARTS_DATA_DIR("parts_data/");
@@ -225,6 +236,130 @@ TEST_F(Engraving_PartsTests, insertMeasure)
     delete score;
 }
 
+//---------------------------------------------------------
+//   lazyExcerpts
+//    the parts that were closed when saved are read on first use
+//---------------------------------------------------------
+
+TEST_F(Engraving_PartsTests, lazyExcerpts)
+{
+    //! GIVEN A score with two parts, saved as mscz
+    MasterScore* score = ScoreRW::readScore(PARTS_DATA_DIR + u"part-all.mscx");
+    ASSERT_TRUE(score);
+
+    TestUtils::createParts(score, 2);
+    ASSERT_EQ(score->excerpts().size(), 2);
+
+    muse::ByteArray msczData;
+    {
+        Buffer buf(&msczData);
+        MscWriter::Params params;
+        params.device = &buf;
+        params.filePath = "part-all-lazy.mscz";
+        params.mode = MscIoMode::Zip;
+
+        MscWriter writer(params);
+        writer.open();
+
+        EXPECT_TRUE(MscSaver(score->iocContext()).writeMscz(score, writer, false, false));
+    }
+
+    //! DO Read it with lazy excerpts
+    MasterScore* lazyScore = compat::ScoreAccess::createMasterScoreWithBaseStyle(nullptr);
+    lazyScore->setFileInfoProvider(std::make_shared<LocalFileInfoProvider>("part-all-lazy.mscz"));
+    {
+        Buffer buf(&msczData);
+        MscReader::Params params;
+        params.device = &buf;
+        params.filePath = "part-all-lazy.mscz";
+        params.mode = MscIoMode::Zip;
+
+        MscReader reader(params);
+        reader.open();
+
+        ScoreLoad sl;
+        SettingsCompat settingsCompat;
+        MscLoader loader;
+        loader.setLazyExcerpts(true);
+        EXPECT_TRUE(loader.loadMscz(lazyScore, reader, settingsCompat, false));
+    }
+
+    //! CHECK The parts are known but not read
+    EXPECT_TRUE(lazyScore->excerpts().empty());
+    std::vector<Excerpt*> deferred = lazyScore->deferredExcerpts();
+    ASSERT_EQ(deferred.size(), 2);
+    for (size_t i = 0; i < deferred.size(); ++i) {
+        EXPECT_EQ(deferred.at(i)->name(), score->excerpts().at(i)->name());
+        EXPECT_EQ(deferred.at(i)->initialPartId(), score->excerpts().at(i)->initialPartId());
+        EXPECT_TRUE(deferred.at(i)->excerptScore()->staves().empty());
+    }
+
+    //! DO Use the second part
+    EXPECT_TRUE(lazyScore->materializeExcerpt(deferred.at(1)));
+
+    //! CHECK It is read and linked to the master score
+    ASSERT_EQ(lazyScore->excerpts().size(), 1);
+    EXPECT_EQ(lazyScore->excerpts().front(), deferred.at(1));
+    EXPECT_FALSE(lazyScore->isExcerptDeferred(deferred.at(1)));
+    ASSERT_FALSE(deferred.at(1)->excerptScore()->staves().empty());
+    EXPECT_TRUE(deferred.at(1)->excerptScore()->staff(0)->links());
+
+    //! DO Start editing the master score
+    lazyScore->startCmd(TranslatableString::untranslatable("Engraving parts tests"));
+    lazyScore->endCmd();
+
+    //! CHECK All parts are read, in the file order
+    EXPECT_TRUE(lazyScore->deferredExcerpts().empty());
+    ASSERT_EQ(lazyScore->excerpts().size(), 2);
+    EXPECT_EQ(lazyScore->excerpts().at(0), deferred.at(0));
+    EXPECT_EQ(lazyScore->excerpts().at(1), deferred.at(1));
+
+    delete lazyScore;
+    delete score;
+}
+
+//---------------------------------------------------------
+//   memoryUsage
+//---------------------------------------------------------
+
+TEST_F(Engraving_PartsTests, memoryUsage)
+{
+    MasterScore* score = ScoreRW::readScore(PARTS_DATA_DIR + u"part-all.mscx");
+    ASSERT_TRUE(score);
+
+    TestUtils::createParts(score, 2);
+
+    MemoryUsage usage = MemoryUsage::collect(score);
+
+    //! CHECK The notes of the score are counted
+    size_t notes = 0;
+    for (Segment* s = score->firstSegment(SegmentType::ChordRest); s; s = s->next1(SegmentType::ChordRest)) {
+        for (EngravingItem* e : s->elist()) {
+            if (e && e->isChord()) {
+                notes += toChord(e)->notes().size();
+            }
+        }
+    }
+    ASSERT_GT(notes, size_t(0));
+    const ScoreMemoryUsage::TypeUsage& noteUsage = usage.masterScore.types[ElementType::NOTE];
+    EXPECT_GE(noteUsage.count, notes);
+    EXPECT_EQ(noteUsage.bytes, noteUsage.count * sizeof(Note));
+    EXPECT_EQ(usage.masterScore.types[ElementType::SCORE].count, 1);
+
+    //! CHECK The parts are reported separately
+    ASSERT_EQ(usage.excerpts.size(), 2);
+    for (size_t i = 0; i < usage.excerpts.size(); ++i) {
+        EXPECT_EQ(usage.excerpts.at(i).first, score->excerpts().at(i)->name());
+        EXPECT_GT(usage.excerpts.at(i).second.types[ElementType::NOTE].count, 0);
+    }
+
+    EXPECT_GT(usage.masterScore.layoutDataCount, 0);
+    EXPECT_GT(usage.masterScore.shapeElementCount, 0);
+    EXPECT_GE(usage.totalBytes(), usage.masterScore.totalBytes());
+
+    delete score;
+}
+
 //---------------------------------------------------------
 //   styleScore
 //---------------------------------------------------------
@@ -25,6 +25,7 @@
 
 #include "utils/scorerw.h"
 
+#include "engraving/dom/measure.h"
 #include "engraving/dom/part.h"
 #include "engraving/dom/staff.h"
 #include "engraving/dom/repeatlist.h"
@@ -496,6 +497,37 @@ TEST_F(Engraving_PlaybackContextTests, Dynamics_HairpinWithCompound)
     }
 }
 
+//! Checks that updating the context for a tick range gives the same result as the full update
+TEST_F(Engraving_PlaybackContextTests, Dynamics_RangeUpdate)
+{
+    // [GIVEN] Score with hairpins and compound dynamics
+    Score* score = ScoreRW::readScore(PLAYBACK_CONTEXT_TEST_FILES_DIR + "dynamics/dynamics_compound.mscx");
+
+    const std::vector<Part*>& parts = score->parts();
+    ASSERT_FALSE(parts.empty());
+
+    const Part* part = parts.front();
+
+    // [GIVEN] Dynamics parsed for the whole score
+    PlaybackContext fullCtx;
+    fullCtx.update(part->id(), score);
+
+    const DynamicLevelLayers expectedLayers = fullCtx.dynamicLevelLayers(score);
+    EXPECT_FALSE(expectedLayers.empty());
+
+    // [GIVEN] Context to be updated partially
+    PlaybackContext ctx;
+    ctx.update(part->id(), score);
+
+    for (const Measure* measure = score->firstMeasure(); measure; measure = measure->nextMeasure()) {
+        // [WHEN] Update the dynamics of the measure only
+        ctx.update(part->id(), score, true /*expandRepeats*/, measure->tick().ticks(), measure->endTick().ticks());
+
+        // [THEN] The dynamics are the same as before
+        EXPECT_EQ(ctx.dynamicLevelLayers(score), expectedLayers);
+    }
+}
+
 TEST_F(Engraving_PlaybackContextTests, PlayTechniques)
 {
     // [GIVEN] Score with playing technique annotations
@@ -0,0 +1,81 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-Studio-CLA-applies
+ *
+ * MuseScore Studio
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2026 MuseScore Limited
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include "types/propertyvalue.h"
+
+using namespace mu;
+using namespace mu::engraving;
+
+class Engraving_PropertyValueTests : public ::testing::Test
+{
+};
+
+TEST_F(Engraving_PropertyValueTests, copyAndMoveInlineValues)
+{
+    PropertyValue point(PointF(1.5, -2.0));
+    PropertyValue copy = point;
+    EXPECT_EQ(copy.type(), P_TYPE::POINT);
+    EXPECT_EQ(copy.value<PointF>(), PointF(1.5, -2.0));
+    EXPECT_EQ(copy, point);
+
+    PropertyValue moved = std::move(copy);
+    EXPECT_EQ(moved.value<PointF>(), PointF(1.5, -2.0));
+
+    PropertyValue assigned(Fraction(3, 8));
+    assigned = moved;
+    EXPECT_EQ(assigned.type(), P_TYPE::POINT);
+    EXPECT_EQ(assigned.value<PointF>(), PointF(1.5, -2.0));
+
+    assigned = PropertyValue(Spatium(0.5));
+    EXPECT_EQ(assigned.type(), P_TYPE::SPATIUM);
+    EXPECT_DOUBLE_EQ(assigned.value<double>(), 0.5);
+
+    PropertyValue align(Align(AlignH::HCENTER, AlignV::BASELINE));
+    EXPECT_FALSE(align.isEnum());
+    EXPECT_EQ(PropertyValue(align).value<Align>(), Align(AlignH::HCENTER, AlignV::BASELINE));
+
+    PropertyValue dir(DirectionV::UP);
+    EXPECT_TRUE(dir.isEnum());
+    EXPECT_EQ(PropertyValue(dir).value<int>(), static_cast<int>(DirectionV::UP));
+}
+
+TEST_F(Engraving_PropertyValueTests, copyAndMoveSharedValues)
+{
+    PropertyValue str(String(u"some text that doesn't fit inline"));
+    PropertyValue copy = str;
+    EXPECT_EQ(copy.value<String>(), String(u"some text that doesn't fit inline"));
+
+    PropertyValue moved = std::move(str);
+    EXPECT_EQ(moved.value<String>(), String(u"some text that doesn't fit inline"));
+
+    moved = PropertyValue(true);
+    EXPECT_TRUE(moved.toBool());
+    EXPECT_EQ(copy.value<String>(), String(u"some text that doesn't fit inline"));
+
+    PropertyValue vec(std::vector<int> { 1, 2, 3 });
+    PropertyValue vecCopy;
+    vecCopy = vec;
+    EXPECT_EQ(vecCopy.value<std::vector<int> >(), std::vector<int>({ 1, 2, 3 }));
+    EXPECT_EQ(vecCopy, vec);
+}
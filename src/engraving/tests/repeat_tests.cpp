@@ -415,3 +415,62 @@ TEST_F(Engraving_RepeatTests, repeat68) {
     // Entire score skipped by volta: gh#14685
     repeat("repeat68.mscx", u"");
 }
+
+TEST_F(Engraving_RepeatTests, unrolledTimeLookups) {
+    // repeat barline ||: | x2 :|| :||
+    MasterScore* score = ScoreRW::readScore(REPEAT_DATA_DIR + u"repeat05.mscx");
+    ASSERT_TRUE(score);
+
+    score->setExpandRepeats(true);
+
+    const RepeatList& repeatList = score->repeatList();
+    ASSERT_GT(repeatList.size(), size_t(1));
+
+    // lookups out of order, as for seeking
+    for (auto it = repeatList.crbegin(); it != repeatList.crend(); ++it) {
+        const RepeatSegment* rs = *it;
+        const int lastUtick = rs->utick + rs->len() - 1;
+
+        EXPECT_EQ(repeatList.utick2tick(rs->utick), rs->tick);
+        EXPECT_EQ(repeatList.utick2tick(lastUtick), rs->tick + rs->len() - 1);
+
+        EXPECT_DOUBLE_EQ(repeatList.utick2utime(rs->utick), rs->utime);
+        EXPECT_EQ(repeatList.utime2utick(rs->utime), rs->utick);
+        EXPECT_EQ(repeatList.utime2utick(repeatList.utick2utime(lastUtick)), lastUtick);
+    }
+
+    delete score;
+}
+
+TEST_F(Engraving_RepeatTests, cachedUnwinding) {
+    // repeat barline 2 measures ||: | :||
+    MasterScore* score = ScoreRW::readScore(REPEAT_DATA_DIR + u"repeat01.mscx");
+    ASSERT_TRUE(score);
+
+    score->setExpandRepeats(true);
+
+    const RepeatList& repeatList = score->repeatList();
+    ASSERT_EQ(repeatList.size(), size_t(2));
+    const RepeatSegment* firstSegment = repeatList.front();
+    const int ticks = repeatList.ticks();
+
+    //! DO mark the score as changed without touching the repeats
+    score->setPlaylistDirty();
+
+    //! CHECK the unwound segments are kept
+    ASSERT_EQ(score->repeatList().size(), size_t(2));
+    EXPECT_EQ(score->repeatList().front(), firstSegment);
+    EXPECT_EQ(score->repeatList().ticks(), ticks);
+
+    //! DO remove the end repeat
+    Measure* m = score->firstMeasure()->nextMeasure()->nextMeasure();
+    ASSERT_TRUE(m->repeatEnd());
+    m->setRepeatEnd(false);
+    score->setPlaylistDirty();
+
+    //! CHECK the playback order is unwound again
+    EXPECT_EQ(score->repeatList().size(), size_t(1));
+    EXPECT_LT(score->repeatList().ticks(), ticks);
+
+    delete score;
+}
@@ -22,6 +22,7 @@
 
 #include <gtest/gtest.h>
 
+#include "dom/engravingitem.h"
 #include "dom/masterscore.h"
 
 #include "utils/scorerw.h"
@@ -118,3 +119,41 @@ TEST_F(Engraving_ScanTreeTests, DISABLED_tstTreeGoldberg) // too long
 {
     tstTree(u"goldberg.mscx");
 }
+
+//---------------------------------------------------------
+//   visitItems
+///   The visitor gets the same items as scanElements,
+///   filtered by type, and stops when asked to
+//---------------------------------------------------------
+
+TEST_F(Engraving_ScanTreeTests, visitItems)
+{
+    MasterScore* score = ScoreRW::readScore(ALL_ELEMENTS_DATA_DIR + u"moonlight.mscx");
+    ASSERT_TRUE(score);
+
+    std::vector<EngravingItem*> all;
+    score->scanElements(&all, collectElements);
+
+    size_t notes = std::count_if(all.begin(), all.end(), [](const EngravingItem* item) { return item->isNote(); });
+    ASSERT_GT(notes, size_t(1));
+
+    ElementTypeMask types;
+    types.set(static_cast<size_t>(ElementType::NOTE));
+
+    size_t visited = 0;
+    score->visitItems(types, [&visited](EngravingItem* item) {
+        EXPECT_TRUE(item->isNote());
+        ++visited;
+        return true;
+    });
+    EXPECT_EQ(visited, notes);
+
+    visited = 0;
+    score->visitItems(types, [&visited](EngravingItem*) {
+        ++visited;
+        return false;
+    });
+    EXPECT_EQ(visited, size_t(1));
+
+    delete score;
+}
@@ -0,0 +1,82 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-Studio-CLA-applies
+ *
+ * MuseScore Studio
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2024 MuseScore Limited
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <random>
+
+#include "infrastructure/shape.h"
+
+using namespace mu;
+using namespace mu::engraving;
+
+class Engraving_ShapeTests : public ::testing::Test
+{
+};
+
+/**
+ * @brief Engraving_ShapeTests_VerticalBand
+ * @details Check that the vertical index finds exactly the elements overlapping a band,
+ *          and that it follows the shape when it's moved
+ */
+TEST_F(Engraving_ShapeTests, VerticalBand)
+{
+    std::mt19937 gen(7);
+    std::uniform_real_distribution<double> pos(-50.0, 50.0);
+    std::uniform_real_distribution<double> size(0.0, 10.0);
+
+    // [GIVEN] A shape with random elements
+    Shape shape(Shape::Type::Composite);
+    for (int i = 0; i < 200; ++i) {
+        shape.add(RectF(pos(gen), pos(gen), size(gen), size(gen)));
+    }
+
+    auto check = [&shape](double y1, double y2) {
+        std::vector<size_t> found;
+        shape.forEachInVerticalBand(y1, y2, [&found](size_t idx) { found.push_back(idx); });
+        std::sort(found.begin(), found.end());
+
+        std::vector<size_t> expected;
+        for (size_t i = 0; i < shape.elements().size(); ++i) {
+            const ShapeElement& el = shape.elements()[i];
+            if (el.top() < y2 && el.bottom() > y1) {
+                expected.push_back(i);
+            }
+        }
+
+        EXPECT_EQ(found, expected);
+    };
+
+    // [WHEN] Querying bands [THEN] The index matches a full scan
+    for (int i = 0; i < 50; ++i) {
+        double y = pos(gen);
+        check(y, y + size(gen));
+    }
+
+    // [WHEN] The shape is moved [THEN] The index is rebuilt
+    shape.translateY(25.0);
+    for (int i = 0; i < 50; ++i) {
+        double y = pos(gen);
+        check(y, y + size(gen));
+    }
+}
@@ -0,0 +1,103 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-Studio-CLA-applies
+ *
+ * MuseScore Studio
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2024 MuseScore Limited
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include <random>
+
+#include "infrastructure/shape.h"
+#include "infrastructure/skyline.h"
+
+using namespace mu;
+using namespace mu::engraving;
+
+class Engraving_SkylineTests : public ::testing::Test
+{
+};
+
+static Shape randomShape(std::mt19937& gen, size_t count, double yOffset)
+{
+    std::uniform_real_distribution<double> xDist(0.0, 500.0);
+    std::uniform_real_distribution<double> wDist(0.0, 20.0);
+    std::uniform_real_distribution<double> yDist(-30.0, 30.0);
+    std::uniform_real_distribution<double> hDist(0.0, 15.0);
+
+    Shape shape(Shape::Type::Composite);
+    for (size_t i = 0; i < count; ++i) {
+        shape.add(RectF(xDist(gen), yOffset + yDist(gen), wDist(gen), hDist(gen)));
+    }
+
+    return shape;
+}
+
+/**
+ * @brief Engraving_SkylineTests_EnvelopeMinDistance
+ * @details Check that the flat envelope gives the same distances as the pairwise shape scan
+ */
+TEST_F(Engraving_SkylineTests, EnvelopeMinDistance)
+{
+    std::mt19937 gen(42);
+
+    for (double clearance : { 0.0, 0.5, 3.0 }) {
+        for (size_t count : { 1, 5, 50, 400 }) {
+            // [GIVEN] Two random shapes, one above the other
+            Shape above = randomShape(gen, count, 0.0);
+            Shape below = randomShape(gen, count, 40.0);
+
+            // [WHEN] Comparing the distance computed from the envelopes with the pairwise one
+            SkylineEnvelope aboveEnvelope(above, false);
+            SkylineEnvelope belowEnvelope(below, true);
+
+            // [THEN] The results are the same
+            EXPECT_DOUBLE_EQ(aboveEnvelope.minDistance(belowEnvelope, clearance), above.minVerticalDistance(below, clearance));
+        }
+    }
+}
+
+/**
+ * @brief Engraving_SkylineTests_EnvelopeMerge
+ * @details Check that overlapping elements are merged into disjoint intervals
+ */
+TEST_F(Engraving_SkylineTests, EnvelopeMerge)
+{
+    // [GIVEN] A south line made of overlapping rects
+    Shape shape(Shape::Type::Composite);
+    shape.add(RectF(0.0, 0.0, 10.0, 5.0));
+    shape.add(RectF(5.0, 0.0, 10.0, 8.0));
+    shape.add(RectF(20.0, 0.0, 5.0, 2.0));
+    shape.add(RectF(30.0, 0.0, 0.0, 9.0)); // no width, ignored
+
+    // [WHEN] Building the envelope
+    SkylineEnvelope envelope(shape, false);
+
+    // [THEN] The intervals are disjoint and keep the lowest bottom
+    ASSERT_EQ(envelope.size(), 3u);
+    EXPECT_DOUBLE_EQ(envelope.left()[0], 0.0);
+    EXPECT_DOUBLE_EQ(envelope.right()[0], 5.0);
+    EXPECT_DOUBLE_EQ(envelope.edge()[0], 5.0);
+    EXPECT_DOUBLE_EQ(envelope.left()[1], 5.0);
+    EXPECT_DOUBLE_EQ(envelope.right()[1], 15.0);
+    EXPECT_DOUBLE_EQ(envelope.edge()[1], 8.0);
+    EXPECT_DOUBLE_EQ(envelope.left()[2], 20.0);
+    EXPECT_DOUBLE_EQ(envelope.right()[2], 25.0);
+    EXPECT_DOUBLE_EQ(envelope.edge()[2], 2.0);
+}
@@ -0,0 +1,128 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-Studio-CLA-applies
+ *
+ * MuseScore Studio
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2024 MuseScore Limited
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <map>
+#include <random>
+#include <tuple>
+
+#include "dom/spannerintervaltree.h"
+
+using namespace mu;
+using namespace mu::engraving;
+
+class Engraving_SpannerIntervalTreeTests : public ::testing::Test
+{
+public:
+    // the tree only stores the pointers
+    static Spanner* fakeSpanner(size_t i) { return reinterpret_cast<Spanner*>((i + 1) * sizeof(void*)); }
+};
+
+TEST_F(Engraving_SpannerIntervalTreeTests, findOverlappingOrderedByStart)
+{
+    SpannerIntervalTree tree;
+    tree.insert(SpannerIntervalTree::Interval(480, 960, fakeSpanner(0)), 0);
+    tree.insert(SpannerIntervalTree::Interval(0, 1920, fakeSpanner(1)), 1);
+    tree.insert(SpannerIntervalTree::Interval(480, 480, fakeSpanner(2)), 2);
+    tree.insert(SpannerIntervalTree::Interval(1000, 2000, fakeSpanner(3)), 3);
+
+    SpannerIntervalTree::IntervalList result;
+    tree.findOverlapping(480, 600, result);
+    ASSERT_EQ(result.size(), 3);
+    EXPECT_EQ(result[0].value, fakeSpanner(1));
+    EXPECT_EQ(result[1].value, fakeSpanner(0));
+    EXPECT_EQ(result[2].value, fakeSpanner(2));
+
+    result.clear();
+    tree.findContained(400, 1000, result);
+    ASSERT_EQ(result.size(), 2);
+    EXPECT_EQ(result[0].value, fakeSpanner(0));
+    EXPECT_EQ(result[1].value, fakeSpanner(2));
+
+    // moving a spanner keeps it in the tree under the new endpoints
+    EXPECT_TRUE(tree.update(fakeSpanner(3), 0, 100));
+    result.clear();
+    tree.findOverlapping(50, 50, result);
+    ASSERT_EQ(result.size(), 2);
+    EXPECT_EQ(result[0].value, fakeSpanner(1));
+    EXPECT_EQ(result[1].value, fakeSpanner(3));
+
+    EXPECT_TRUE(tree.remove(fakeSpanner(1)));
+    EXPECT_FALSE(tree.remove(fakeSpanner(1)));
+    EXPECT_EQ(tree.size(), 3);
+}
+
+TEST_F(Engraving_SpannerIntervalTreeTests, matchesLinearSearch)
+{
+    std::mt19937 rng(42);
+    SpannerIntervalTree tree;
+    std::map<Spanner*, std::tuple<int, int, size_t> > intervals;
+    size_t order = 0;
+
+    for (int i = 0; i < 20000; ++i) {
+        Spanner* spanner = fakeSpanner(rng() % 300);
+        const int a = rng() % 5000;
+        const int b = rng() % 5000;
+
+        switch (rng() % 4) {
+        case 0:
+            if (!intervals.count(spanner)) {
+                tree.insert(SpannerIntervalTree::Interval(a, b, spanner), order);
+                intervals[spanner] = { std::min(a, b), std::max(a, b), order++ };
+            }
+            break;
+        case 1:
+            EXPECT_EQ(tree.remove(spanner), intervals.erase(spanner) > 0);
+            break;
+        case 2:
+            EXPECT_EQ(tree.update(spanner, a, b), intervals.count(spanner) > 0);
+            if (intervals.count(spanner)) {
+                std::get<0>(intervals[spanner]) = std::min(a, b);
+                std::get<1>(intervals[spanner]) = std::max(a, b);
+            }
+            break;
+        default: {
+            const int start = std::min(a, b);
+            const int stop = std::max(a, b);
+
+            std::vector<std::tuple<int, size_t, Spanner*> > expected;
+            for (const auto& [s, interval] : intervals) {
+                if (std::get<1>(interval) >= start && std::get<0>(interval) <= stop) {
+                    expected.emplace_back(std::get<0>(interval), std::get<2>(interval), s);
+                }
+            }
+            std::sort(expected.begin(), expected.end());
+
+            SpannerIntervalTree::IntervalList result;
+            tree.findOverlapping(start, stop, result);
+            ASSERT_EQ(result.size(), expected.size());
+            for (size_t j = 0; j < result.size(); ++j) {
+                EXPECT_EQ(result[j].value, std::get<2>(expected[j]));
+            }
+        } break;
+        }
+
+        ASSERT_EQ(tree.size(), intervals.size());
+    }
+}
@@ -256,3 +256,42 @@ TEST_F(Engraving_TempoMapTests, GRADUAL_TEMPO_CHANGE_DOESNT_OVERWRITE_OTHER_TEMP
         EXPECT_TRUE(muse::RealIsEqual(muse::RealRound(tempoMap->at(pair.first).tempo.val, 2), muse::RealRound(pair.second.val, 2)));
     }
 }
+
+/**
+ * @brief TempoMapTests_TICK_TO_TIME_WITH_PAUSE
+ * @details Converts ticks to time and back across tempo changes and a pause
+ */
+TEST_F(Engraving_TempoMapTests, TICK_TO_TIME_WITH_PAUSE)
+{
+    // [GIVEN] 120 BPM, 60 BPM from the 2nd measure, and a pause of 1s at the 3rd measure
+    TempoMap tempoMap;
+    const int measureTicks = 4 * Constants::DIVISION;
+    tempoMap.setTempo(0, BeatsPerSecond(2.0));
+    tempoMap.setTempo(measureTicks, BeatsPerSecond(1.0));
+    tempoMap.setPause(2 * measureTicks, 1.0);
+
+    // [THEN] The times match the tempo changes and the pause
+    EXPECT_DOUBLE_EQ(tempoMap.tick2time(0), 0.0);
+    EXPECT_DOUBLE_EQ(tempoMap.tick2time(measureTicks / 2), 1.0);
+    EXPECT_DOUBLE_EQ(tempoMap.tick2time(measureTicks), 2.0);
+    EXPECT_DOUBLE_EQ(tempoMap.tick2time(measureTicks + Constants::DIVISION), 3.0);
+    EXPECT_DOUBLE_EQ(tempoMap.tick2time(2 * measureTicks), 7.0);
+    EXPECT_DOUBLE_EQ(tempoMap.tick2time(2 * measureTicks + Constants::DIVISION), 8.0);
+
+    EXPECT_EQ(tempoMap.tempo(measureTicks - 1), BeatsPerSecond(2.0));
+    EXPECT_EQ(tempoMap.tempo(measureTicks), BeatsPerSecond(1.0));
+
+    // [THEN] The ticks match the times, the pause waits on its tick
+    EXPECT_EQ(tempoMap.time2tick(1.0), measureTicks / 2);
+    EXPECT_EQ(tempoMap.time2tick(3.0), measureTicks + Constants::DIVISION);
+    EXPECT_EQ(tempoMap.time2tick(6.5), 2 * measureTicks);
+    EXPECT_EQ(tempoMap.time2tick(8.0), 2 * measureTicks + Constants::DIVISION);
+
+    // [WHEN] The tempo change is removed
+    tempoMap.delTempo(measureTicks);
+
+    // [THEN] The times follow the remaining tempo
+    EXPECT_DOUBLE_EQ(tempoMap.tick2time(measureTicks), 2.0);
+    EXPECT_DOUBLE_EQ(tempoMap.tick2time(2 * measureTicks), 5.0);
+    EXPECT_EQ(tempoMap.time2tick(5.0), 2 * measureTicks);
+}
@@ -0,0 +1,97 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-Studio-CLA-applies
+ *
+ * MuseScore Studio
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2024 MuseScore Limited
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include "dom/masterscore.h"
+#include "dom/measure.h"
+#include "dom/undo.h"
+
+#include "utils/scorerw.h"
+
+using namespace mu;
+using namespace mu::engraving;
+
+static const String MEASURE_DATA_DIR(u"measure_data/");
+
+class Engraving_UndoStackTests : public ::testing::Test
+{
+};
+
+//---------------------------------------------------------
+//   coalescePropertyChanges
+///   change the same property several times in one command,
+///   only the first change is recorded and undo restores the original value
+//---------------------------------------------------------
+TEST_F(Engraving_UndoStackTests, coalescePropertyChanges)
+{
+    MasterScore* score = ScoreRW::readScore(MEASURE_DATA_DIR + u"measure-insert_beginning.mscx");
+    EXPECT_TRUE(score);
+
+    Measure* m = score->firstMeasure();
+    const PropertyValue original = m->getProperty(Pid::USER_STRETCH);
+
+    score->startCmd(TranslatableString::untranslatable("Engraving undo stack tests"));
+    score->undo(new ChangeProperty(m, Pid::USER_STRETCH, 1.5));
+    score->undo(new ChangeProperty(m, Pid::USER_STRETCH, 2.0));
+    score->undo(new ChangeProperty(m, Pid::USER_STRETCH, 2.5));
+    score->endCmd();
+
+    EXPECT_EQ(score->undoStack()->last()->childCount(), 1u);
+    EXPECT_DOUBLE_EQ(m->getProperty(Pid::USER_STRETCH).toDouble(), 2.5);
+
+    score->undoStack()->undo(nullptr);
+    EXPECT_EQ(m->getProperty(Pid::USER_STRETCH), original);
+
+    score->undoStack()->redo(nullptr);
+    EXPECT_DOUBLE_EQ(m->getProperty(Pid::USER_STRETCH).toDouble(), 2.5);
+
+    delete score;
+}
+
+//---------------------------------------------------------
+//   memoryBudget
+///   with a tiny budget only the last command is kept
+//---------------------------------------------------------
+TEST_F(Engraving_UndoStackTests, memoryBudget)
+{
+    MasterScore* score = ScoreRW::readScore(MEASURE_DATA_DIR + u"measure-insert_beginning.mscx");
+    EXPECT_TRUE(score);
+
+    score->undoStack()->setMemoryBudget(1);
+
+    Measure* m = score->firstMeasure();
+    for (double stretch : { 1.5, 2.0, 2.5 }) {
+        score->startCmd(TranslatableString::untranslatable("Engraving undo stack tests"));
+        score->undo(new ChangeProperty(m, Pid::USER_STRETCH, stretch));
+        score->endCmd();
+    }
+
+    EXPECT_EQ(score->undoStack()->size(), 1u);
+    EXPECT_TRUE(score->undoStack()->canUndo());
+
+    score->undoStack()->undo(nullptr);
+    EXPECT_DOUBLE_EQ(m->getProperty(Pid::USER_STRETCH).toDouble(), 2.0);
+    EXPECT_FALSE(score->undoStack()->canUndo());
+
+    delete score;
+}
@@ -157,6 +157,11 @@ public:
         if (m_denominator == val.m_denominator) {
             // Common enough use case to be handled separately for efficiency
             m_numerator += val.m_numerator;
+        } else if (hasMultipleDenominatorOf(val)) {
+            m_numerator += val.m_numerator * (m_denominator / val.m_denominator);
+        } else if (val.hasMultipleDenominatorOf(*this)) {
+            m_numerator = m_numerator * (val.m_denominator / m_denominator) + val.m_numerator;
+            m_denominator = val.m_denominator;
         } else {
             const int64_t g = std::gcd(m_denominator, val.m_denominator);
             if (g) {
@@ -173,6 +178,11 @@ public:
         if (m_denominator == val.m_denominator) {
             // Common enough use case to be handled separately for efficiency
             m_numerator -= val.m_numerator;
+        } else if (hasMultipleDenominatorOf(val)) {
+            m_numerator -= val.m_numerator * (m_denominator / val.m_denominator);
+        } else if (val.hasMultipleDenominatorOf(*this)) {
+            m_numerator = m_numerator * (val.m_denominator / m_denominator) - val.m_numerator;
+            m_denominator = val.m_denominator;
         } else {
             const int64_t g = std::gcd(m_denominator, val.m_denominator);
             if (g) {
@@ -265,6 +275,14 @@ public:
     }
 
     constexpr double toDouble() const { return static_cast<double>(m_numerator) / static_cast<double>(m_denominator); }
+
+private:
+    // Note values on the tick grid mostly have power of two denominators that divide each other,
+    // then the bigger denominator is the common one and no gcd is needed
+    constexpr bool hasMultipleDenominatorOf(const Fraction& val) const
+    {
+        return val.m_denominator > 0 && m_denominator > val.m_denominator && m_denominator % val.m_denominator == 0;
+    }
 };
 
 constexpr Fraction operator*(const Fraction& f, int v) { return Fraction(f) *= v; }
@@ -27,6 +27,73 @@
 
 using namespace mu::engraving;
 
+PropertyValue::PropertyValue(const PropertyValue& v)
+    : m_type(v.m_type)
+{
+    copy_data(v);
+}
+
+PropertyValue::PropertyValue(PropertyValue&& v) noexcept
+    : m_type(v.m_type)
+{
+    if (v.m_shared) {
+        m_shared = std::move(v.m_shared);
+        m_data = m_shared.get();
+        v.m_data = nullptr;
+        v.m_type = P_TYPE::UNDEFINED;
+    } else {
+        copy_data(v);
+    }
+}
+
+PropertyValue& PropertyValue::operator=(const PropertyValue& v)
+{
+    if (this != &v) {
+        destroy_data();
+        m_type = v.m_type;
+        copy_data(v);
+    }
+    return *this;
+}
+
+PropertyValue& PropertyValue::operator=(PropertyValue&& v) noexcept
+{
+    if (this != &v) {
+        destroy_data();
+        m_type = v.m_type;
+        if (v.m_shared) {
+            m_shared = std::move(v.m_shared);
+            m_data = m_shared.get();
+            v.m_data = nullptr;
+            v.m_type = P_TYPE::UNDEFINED;
+        } else {
+            copy_data(v);
+        }
+    }
+    return *this;
+}
+
+void PropertyValue::copy_data(const PropertyValue& v)
+{
+    if (!v.m_data) {
+        m_data = nullptr;
+    } else if (v.m_shared) {
+        m_shared = v.m_shared;
+        m_data = m_shared.get();
+    } else {
+        m_data = v.m_data->copyInto(m_inline);
+    }
+}
+
+void PropertyValue::destroy_data()
+{
+    if (m_data && !m_shared) {
+        m_data->~IArg();
+    }
+    m_shared.reset();
+    m_data = nullptr;
+}
+
 bool PropertyValue::isValid() const
 {
     return m_type != P_TYPE::UNDEFINED;
@@ -79,7 +146,7 @@ bool PropertyValue::operator ==(const PropertyValue& v) const
         return false;
     }
 
-    return v.m_type == m_type && v.m_data->equal(m_data.get());
+    return v.m_type == m_type && v.m_data->equal(m_data);
 }
 
 #ifndef NO_QT_SUPPORT
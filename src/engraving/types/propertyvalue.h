@@ -23,7 +23,9 @@
 #define MU_ENGRAVING_PROPERTYVALUE_H
 
 #include <memory>
+#include <new>
 #include <cassert>
+#include <type_traits>
 
 #ifndef NO_QT_SUPPORT
 #include <QVariant>
@@ -117,179 +119,185 @@ class PropertyValue
 {
 public:
     PropertyValue() = default;
+    PropertyValue(const PropertyValue& v);
+    PropertyValue(PropertyValue&& v) noexcept;
+    ~PropertyValue() { destroy_data(); }
+
+    PropertyValue& operator=(const PropertyValue& v);
+    PropertyValue& operator=(PropertyValue&& v) noexcept;
 
     // Base
     PropertyValue(bool v)
-        : m_type(P_TYPE::BOOL), m_data(make_data<bool>(v)) {}
+        : m_type(P_TYPE::BOOL) { make_data<bool>(v); }
 
     PropertyValue(int v)
-        : m_type(P_TYPE::INT), m_data(make_data<int>(v)) {}
+        : m_type(P_TYPE::INT) { make_data<int>(v); }
 
     PropertyValue(const std::vector<int>& v)
-        : m_type(P_TYPE::INT_VEC), m_data(make_data<std::vector<int> >(v)) {}
+        : m_type(P_TYPE::INT_VEC) { make_data<std::vector<int> >(v); }
 
     PropertyValue(size_t v)
-        : m_type(P_TYPE::SIZE_T), m_data(make_data<size_t>(v)) {}
+        : m_type(P_TYPE::SIZE_T) { make_data<size_t>(v); }
 
     PropertyValue(double v)
-        : m_type(P_TYPE::REAL), m_data(make_data<double>(v)) {}
+        : m_type(P_TYPE::REAL) { make_data<double>(v); }
 
     PropertyValue(const char* v)
-        : m_type(P_TYPE::STRING), m_data(make_data<String>(String::fromUtf8(v))) {}
+        : m_type(P_TYPE::STRING) { make_data<String>(String::fromUtf8(v)); }
 
     PropertyValue(const String& v)
-        : m_type(P_TYPE::STRING), m_data(make_data<String>(v)) {}
+        : m_type(P_TYPE::STRING) { make_data<String>(v); }
 
 #ifndef NO_QT_SUPPORT
     PropertyValue(const QString& v)
-        : m_type(P_TYPE::STRING), m_data(make_data<String>(String::fromQString(v))) {}
+        : m_type(P_TYPE::STRING) { make_data<String>(String::fromQString(v)); }
 #endif
 
     // Geometry
     PropertyValue(const PointF& v)
-        : m_type(P_TYPE::POINT), m_data(make_data<PointF>(v)) {}
+        : m_type(P_TYPE::POINT) { make_data<PointF>(v); }
 
     PropertyValue(const PairF& v)
-        : m_type(P_TYPE::PAIR_REAL), m_data(make_data<PairF>(v)) {}
+        : m_type(P_TYPE::PAIR_REAL) { make_data<PairF>(v); }
 
     PropertyValue(const SizeF& v)
-        : m_type(P_TYPE::SIZE), m_data(make_data<SizeF>(v)) {}
+        : m_type(P_TYPE::SIZE) { make_data<SizeF>(v); }
 
     PropertyValue(const PainterPath& v)
-        : m_type(P_TYPE::DRAW_PATH), m_data(make_data<PainterPath>(v)) {}
+        : m_type(P_TYPE::DRAW_PATH) { make_data<PainterPath>(v); }
 
     PropertyValue(const ScaleF& v)
-        : m_type(P_TYPE::SCALE), m_data(make_data<ScaleF>(v)) {}
+        : m_type(P_TYPE::SCALE) { make_data<ScaleF>(v); }
 
     PropertyValue(const Spatium& v)
-        : m_type(P_TYPE::SPATIUM), m_data(make_data<Spatium>(v)) {}
+        : m_type(P_TYPE::SPATIUM) { make_data<Spatium>(v); }
 
     PropertyValue(const Millimetre& v)
-        : m_type(P_TYPE::MILLIMETRE), m_data(make_data<Millimetre>(v)) {}
+        : m_type(P_TYPE::MILLIMETRE) { make_data<Millimetre>(v); }
 
     // Draw
     PropertyValue(SymId v)
-        : m_type(P_TYPE::SYMID), m_data(make_data<SymId>(v)) {}
+        : m_type(P_TYPE::SYMID) { make_data<SymId>(v); }
 
     PropertyValue(const Color& v)
-        : m_type(P_TYPE::COLOR), m_data(make_data<Color>(v)) {}
+        : m_type(P_TYPE::COLOR) { make_data<Color>(v); }
 
     PropertyValue(OrnamentStyle v)
-        : m_type(P_TYPE::ORNAMENT_STYLE), m_data(make_data<OrnamentStyle>(v)) {}
+        : m_type(P_TYPE::ORNAMENT_STYLE) { make_data<OrnamentStyle>(v); }
 
     PropertyValue(GlissandoStyle v)
-        : m_type(P_TYPE::GLISS_STYLE), m_data(make_data<GlissandoStyle>(v)) {}
+        : m_type(P_TYPE::GLISS_STYLE) { make_data<GlissandoStyle>(v); }
 
     // Layout
     PropertyValue(Align v)
-        : m_type(P_TYPE::ALIGN), m_data(make_data<Align>(v)) {}
+        : m_type(P_TYPE::ALIGN) { make_data<Align>(v); }
 
     PropertyValue(PlacementV v)
-        : m_type(P_TYPE::PLACEMENT_V), m_data(make_data<PlacementV>(v)) {}
+        : m_type(P_TYPE::PLACEMENT_V) { make_data<PlacementV>(v); }
     PropertyValue(PlacementH v)
-        : m_type(P_TYPE::PLACEMENT_H), m_data(make_data<PlacementH>(v)) {}
+        : m_type(P_TYPE::PLACEMENT_H) { make_data<PlacementH>(v); }
 
     PropertyValue(TextPlace v)
-        : m_type(P_TYPE::TEXT_PLACE), m_data(make_data<TextPlace>(v)) {}
+        : m_type(P_TYPE::TEXT_PLACE) { make_data<TextPlace>(v); }
 
     PropertyValue(DirectionV v)
-        : m_type(P_TYPE::DIRECTION_V), m_data(make_data<DirectionV>(v)) {}
+        : m_type(P_TYPE::DIRECTION_V) { make_data<DirectionV>(v); }
     PropertyValue(DirectionH v)
-        : m_type(P_TYPE::DIRECTION_H), m_data(make_data<DirectionH>(v)) {}
+        : m_type(P_TYPE::DIRECTION_H) { make_data<DirectionH>(v); }
 
     PropertyValue(Orientation v)
-        : m_type(P_TYPE::ORIENTATION), m_data(make_data<Orientation>(v)) {}
+        : m_type(P_TYPE::ORIENTATION) { make_data<Orientation>(v); }
 
     PropertyValue(BeamMode v)
-        : m_type(P_TYPE::BEAM_MODE), m_data(make_data<BeamMode>(v)) {}
+        : m_type(P_TYPE::BEAM_MODE) { make_data<BeamMode>(v); }
 
     PropertyValue(const AccidentalRole& v)
-        : m_type(P_TYPE::ACCIDENTAL_ROLE), m_data(make_data<AccidentalRole>(v)) {}
+        : m_type(P_TYPE::ACCIDENTAL_ROLE) { make_data<AccidentalRole>(v); }
 
     PropertyValue(TiePlacement v)
-        : m_type(P_TYPE::TIE_PLACEMENT), m_data(make_data<TiePlacement>(v)) {}
+        : m_type(P_TYPE::TIE_PLACEMENT) { make_data<TiePlacement>(v); }
 
     // Sound
     PropertyValue(const Fraction& v)
-        : m_type(P_TYPE::FRACTION), m_data(make_data<Fraction>(v)) {}
+        : m_type(P_TYPE::FRACTION) { make_data<Fraction>(v); }
     PropertyValue(const DurationTypeWithDots& v)
-        : m_type(P_TYPE::DURATION_TYPE_WITH_DOTS), m_data(make_data<DurationTypeWithDots>(v)) {}
+        : m_type(P_TYPE::DURATION_TYPE_WITH_DOTS) { make_data<DurationTypeWithDots>(v); }
     PropertyValue(ChangeMethod v)
-        : m_type(P_TYPE::CHANGE_METHOD), m_data(make_data<ChangeMethod>(v)) {}
+        : m_type(P_TYPE::CHANGE_METHOD) { make_data<ChangeMethod>(v); }
     PropertyValue(const PitchValues& v)
-        : m_type(P_TYPE::PITCH_VALUES), m_data(make_data<PitchValues>(v)) {}
+        : m_type(P_TYPE::PITCH_VALUES) { make_data<PitchValues>(v); }
     PropertyValue(const BeatsPerSecond& v)
-        : m_type(P_TYPE::TEMPO), m_data(make_data<BeatsPerSecond>(v)) {}
+        : m_type(P_TYPE::TEMPO) { make_data<BeatsPerSecond>(v); }
 
     // Types
     PropertyValue(LayoutBreakType v)
-        : m_type(P_TYPE::LAYOUTBREAK_TYPE), m_data(make_data<LayoutBreakType>(v)) {}
+        : m_type(P_TYPE::LAYOUTBREAK_TYPE) { make_data<LayoutBreakType>(v); }
 
     PropertyValue(VeloType v)
-        : m_type(P_TYPE::VELO_TYPE), m_data(make_data<VeloType>(v)) {}
+        : m_type(P_TYPE::VELO_TYPE) { make_data<VeloType>(v); }
 
     PropertyValue(BarLineType v)
-        : m_type(P_TYPE::BARLINE_TYPE), m_data(make_data<BarLineType>(v)) {}
+        : m_type(P_TYPE::BARLINE_TYPE) { make_data<BarLineType>(v); }
 
     PropertyValue(NoteHeadType v)
-        : m_type(P_TYPE::NOTEHEAD_TYPE), m_data(make_data<NoteHeadType>(v)) {}
+        : m_type(P_TYPE::NOTEHEAD_TYPE) { make_data<NoteHeadType>(v); }
     PropertyValue(NoteHeadScheme v)
-        : m_type(P_TYPE::NOTEHEAD_SCHEME), m_data(make_data<NoteHeadScheme>(v)) {}
+        : m_type(P_TYPE::NOTEHEAD_SCHEME) { make_data<NoteHeadScheme>(v); }
     PropertyValue(NoteHeadGroup v)
-        : m_type(P_TYPE::NOTEHEAD_GROUP), m_data(make_data<NoteHeadGroup>(v)) {}
+        : m_type(P_TYPE::NOTEHEAD_GROUP) { make_data<NoteHeadGroup>(v); }
 
     PropertyValue(ClefType v)
-        : m_type(P_TYPE::CLEF_TYPE), m_data(make_data<ClefType>(v)) {}
+        : m_type(P_TYPE::CLEF_TYPE) { make_data<ClefType>(v); }
 
     PropertyValue(ClefToBarlinePosition v)
-        : m_type(P_TYPE::CLEF_TO_BARLINE_POS), m_data(make_data<ClefToBarlinePosition>(v)) {}
+        : m_type(P_TYPE::CLEF_TO_BARLINE_POS) { make_data<ClefToBarlinePosition>(v); }
 
     PropertyValue(DynamicType v)
-        : m_type(P_TYPE::DYNAMIC_TYPE), m_data(make_data<DynamicType>(v)) {}
+        : m_type(P_TYPE::DYNAMIC_TYPE) { make_data<DynamicType>(v); }
     PropertyValue(DynamicSpeed v)
-        : m_type(P_TYPE::DYNAMIC_SPEED), m_data(make_data<DynamicSpeed>(v)) {}
+        : m_type(P_TYPE::DYNAMIC_SPEED) { make_data<DynamicSpeed>(v); }
 
     PropertyValue(LineType v)
-        : m_type(P_TYPE::LINE_TYPE), m_data(make_data<LineType>(v)) {}
+        : m_type(P_TYPE::LINE_TYPE) { make_data<LineType>(v); }
     PropertyValue(HookType v)
-        : m_type(P_TYPE::HOOK_TYPE), m_data(make_data<HookType>(v)) {}
+        : m_type(P_TYPE::HOOK_TYPE) { make_data<HookType>(v); }
 
     PropertyValue(KeyMode v)
-        : m_type(P_TYPE::KEY_MODE), m_data(make_data<KeyMode>(v)) {}
+        : m_type(P_TYPE::KEY_MODE) { make_data<KeyMode>(v); }
 
     PropertyValue(TextStyleType v)
-        : m_type(P_TYPE::TEXT_STYLE), m_data(make_data<TextStyleType>(v)) {}
+        : m_type(P_TYPE::TEXT_STYLE) { make_data<TextStyleType>(v); }
 
     PropertyValue(PlayingTechniqueType v)
-        : m_type(P_TYPE::PLAYTECH_TYPE), m_data(make_data<PlayingTechniqueType>(v)) {}
+        : m_type(P_TYPE::PLAYTECH_TYPE) { make_data<PlayingTechniqueType>(v); }
 
     PropertyValue(GradualTempoChangeType v)
-        : m_type(P_TYPE::TEMPOCHANGE_TYPE), m_data(make_data<GradualTempoChangeType>(v)) {}
+        : m_type(P_TYPE::TEMPOCHANGE_TYPE) { make_data<GradualTempoChangeType>(v); }
 
     PropertyValue(SlurStyleType v)
-        : m_type(P_TYPE::SLUR_STYLE_TYPE), m_data(make_data<SlurStyleType>(v)) {}
+        : m_type(P_TYPE::SLUR_STYLE_TYPE) { make_data<SlurStyleType>(v); }
 
     PropertyValue(const NoteLineEndPlacement& v)
-        : m_type(P_TYPE::NOTELINE_PLACEMENT_TYPE), m_data(make_data<NoteLineEndPlacement>(v)) {}
+        : m_type(P_TYPE::NOTELINE_PLACEMENT_TYPE) { make_data<NoteLineEndPlacement>(v); }
 
     // Other
     PropertyValue(const GroupNodes& v)
-        : m_type(P_TYPE::GROUPS), m_data(make_data<GroupNodes>(v)) {}
+        : m_type(P_TYPE::GROUPS) { make_data<GroupNodes>(v); }
 
     PropertyValue(const OrnamentInterval& v)
-        : m_type(P_TYPE::ORNAMENT_INTERVAL), m_data(make_data<OrnamentInterval>(v)) {}
+        : m_type(P_TYPE::ORNAMENT_INTERVAL) { make_data<OrnamentInterval>(v); }
 
     PropertyValue(const OrnamentShowAccidental& v)
-        : m_type(P_TYPE::ORNAMENT_SHOW_ACCIDENTAL), m_data(make_data<OrnamentShowAccidental>(v)) {}
+        : m_type(P_TYPE::ORNAMENT_SHOW_ACCIDENTAL) { make_data<OrnamentShowAccidental>(v); }
 
     PropertyValue(const LyricsDashSystemStart& v)
-        : m_type(P_TYPE::LYRICS_DASH_SYSTEM_START_TYPE), m_data(make_data<LyricsDashSystemStart>(v)) {}
+        : m_type(P_TYPE::LYRICS_DASH_SYSTEM_START_TYPE) { make_data<LyricsDashSystemStart>(v); }
 
     PropertyValue(const VoiceAssignment& v)
-        : m_type(P_TYPE::VOICE_ASSIGNMENT), m_data(make_data<VoiceAssignment>(v)) {}
+        : m_type(P_TYPE::VOICE_ASSIGNMENT) { make_data<VoiceAssignment>(v); }
 
     PropertyValue(const AutoOnOff& v)
-        : m_type(P_TYPE::AUTO_ON_OFF), m_data(make_data<AutoOnOff>(v)) {}
+        : m_type(P_TYPE::AUTO_ON_OFF) { make_data<AutoOnOff>(v); }
 
     bool isValid() const;
 
@@ -429,6 +437,8 @@ private:
 
         virtual bool isEnum() const = 0;
         virtual int enumToInt() const = 0;
+
+        virtual IArg* copyInto(void* buf) const = 0;
     };
 
     template<typename T>
@@ -459,22 +469,46 @@ private:
                 return -1;
             }
         }
+
+        IArg* copyInto(void* buf) const override
+        {
+            return new (buf) Arg<T>(v);
+        }
     };
 
+    //! NOTE Small values (scalars, enums, Spatium, Fraction, PointF, Color...) are stored inline,
+    //! so that making and copying them doesn't allocate. The others are shared on the heap
+    static constexpr size_t INLINE_SIZE = 4 * sizeof(void*);
+
+    template<typename T>
+    static constexpr bool is_inline = sizeof(Arg<T>) <= INLINE_SIZE
+                                      && alignof(Arg<T>) <= alignof(void*)
+                                      && std::is_nothrow_copy_constructible<T>::value;
+
     template<typename T>
-    inline std::shared_ptr<IArg> make_data(const T& v) const
+    inline void make_data(const T& v)
     {
-        return std::shared_ptr<IArg>(new Arg<T>(v));
+        if constexpr (is_inline<T>) {
+            m_data = new (m_inline) Arg<T>(v);
+        } else {
+            m_shared = std::make_shared<Arg<T> >(v);
+            m_data = m_shared.get();
+        }
     }
 
+    void copy_data(const PropertyValue& v);
+    void destroy_data();
+
     template<typename T>
     inline Arg<T>* get() const
     {
-        return dynamic_cast<Arg<T>*>(m_data.get());
+        return dynamic_cast<Arg<T>*>(m_data);
     }
 
     P_TYPE m_type = P_TYPE::UNDEFINED;
-    std::shared_ptr<IArg> m_data = nullptr;
+    IArg* m_data = nullptr;                 // points to m_inline or to the m_shared value
+    std::shared_ptr<IArg> m_shared;
+    alignas(void*) unsigned char m_inline[INLINE_SIZE];
 };
 }
 
@@ -23,6 +23,7 @@
 #ifndef MU_ENGRAVING_TYPES_H
 #define MU_ENGRAVING_TYPES_H
 
+#include <bitset>
 #include <functional>
 #include <map>
 #include <unordered_set>
@@ -219,6 +220,7 @@ enum class ElementType {
 constexpr size_t TOT_ELEMENT_TYPES = static_cast<size_t>(ElementType::MAXTYPE);
 
 using ElementTypeSet = std::unordered_set<ElementType>;
+using ElementTypeMask = std::bitset<TOT_ELEMENT_TYPES>;
 
 // ========================================
 // PropertyValue
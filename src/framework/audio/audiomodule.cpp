@@ -21,6 +21,8 @@
  */
 #include "audiomodule.h"
 
+#include <QQmlEngine>
+
 #include "ui/iuiengine.h"
 #include "global/modularity/ioc.h"
 
@@ -28,6 +30,7 @@
 #include "internal/audiosanitizer.h"
 #include "internal/audiothread.h"
 #include "internal/audiobuffer.h"
+#include "internal/audioprofiler.h"
 #include "internal/audiothreadsecurer.h"
 #include "internal/audiooutputdevicecontroller.h"
 
@@ -45,6 +48,7 @@
 
 #include "diagnostics/idiagnosticspathsregister.h"
 #include "devtools/inputlag.h"
+#include "devtools/audioprofilerdevmodel.h"
 
 #include "log.h"
 
@@ -112,6 +116,7 @@ void AudioModule::registerExports()
     m_audioEngine = std::make_shared<AudioEngine>(iocContext());
     m_audioWorker = std::make_shared<AudioThread>();
     m_audioBuffer = std::make_shared<AudioBuffer>();
+    m_audioProfiler = std::make_shared<AudioProfiler>();
     m_audioOutputController = std::make_shared<AudioOutputDeviceController>(iocContext());
     m_fxResolver = std::make_shared<FxResolver>();
     m_synthResolver = std::make_shared<SynthResolver>();
@@ -145,6 +150,7 @@ void AudioModule::registerExports()
     ioc()->registerExport<IAudioConfiguration>(moduleName(), m_configuration);
     ioc()->registerExport<IAudioEngine>(moduleName(), m_audioEngine);
     ioc()->registerExport<IAudioThreadSecurer>(moduleName(), std::make_shared<AudioThreadSecurer>());
+    ioc()->registerExport<IAudioProfiler>(moduleName(), m_audioProfiler);
     ioc()->registerExport<IAudioDriver>(moduleName(), m_audioDriver);
     ioc()->registerExport<IPlayback>(moduleName(), m_playbackFacade);
 
@@ -161,6 +167,8 @@ void AudioModule::registerResources()
 
 void AudioModule::registerUiTypes()
 {
+    qmlRegisterType<AudioProfilerDevModel>("Muse.Audio", 1, 0, "AudioProfilerDevModel");
+
     ioc()->resolve<ui::IUiEngine>(moduleName())->addSourceImportPath(muse_audio_QML_IMPORT);
 }
 
@@ -212,6 +220,13 @@ void AudioModule::onInit(const IApplication::RunMode& mode)
 
     m_audioBuffer->init(m_configuration->audioChannelsCount());
 
+    m_audioProfiler->setEnabled(m_configuration->shouldProfileAudioWorker());
+    m_audioBuffer->setProfiler(m_audioProfiler.get());
+    m_audioWorker->setProfiler(m_audioProfiler.get());
+    m_audioBuffer->setOnReserveRunningLow([this]() {
+        m_audioWorker->wakeUp();
+    });
+
     m_audioOutputController->init();
 
     // Setup audio driver
@@ -229,6 +244,10 @@ void AudioModule::onInit(const IApplication::RunMode& mode)
 
 void AudioModule::onDeinit()
 {
+    if (m_audioProfiler->isEnabled()) {
+        LOGI() << "Audio worker profile:\n" << m_audioProfiler->dump();
+    }
+
     if (m_audioDriver->isOpened()) {
         m_audioDriver->close();
     }
@@ -289,6 +308,7 @@ void AudioModule::setupAudioWorker(const IAudioDriver::Spec& activeSpec)
     AudioEngine::RenderConstraints consts;
     consts.minSamplesToReserveWhenIdle = m_configuration->minSamplesToReserve(RenderMode::IdleMode);
     consts.minSamplesToReserveInRealtime = m_configuration->minSamplesToReserve(RenderMode::RealTimeMode);
+    consts.samplesToRenderAheadInRealtime = m_configuration->samplesToRenderAhead(RenderMode::RealTimeMode);
 
     auto workerSetup = [this, activeSpec, consts]() {
         AudioSanitizer::setupWorkerThread();
@@ -296,6 +316,7 @@ void AudioModule::setupAudioWorker(const IAudioDriver::Spec& activeSpec)
 
         // Setup audio engine
         m_audioEngine->init(m_audioBuffer, consts);
+        m_audioEngine->setProfiler(m_audioProfiler.get());
         m_audioEngine->setAudioChannelsCount(m_configuration->audioChannelsCount());
         m_audioEngine->setSampleRate(activeSpec.sampleRate);
         m_audioEngine->setReadBufferSize(activeSpec.samples);
@@ -315,6 +336,7 @@ void AudioModule::setupAudioWorker(const IAudioDriver::Spec& activeSpec)
 
     auto workerLoopBody = [this]() {
         ONLY_AUDIO_WORKER_THREAD;
+        m_playbackFacade->processCommands();
         m_audioBuffer->forward();
     };
 
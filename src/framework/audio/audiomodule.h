@@ -42,6 +42,7 @@ class AudioConfiguration;
 class AudioEngine;
 class AudioThread;
 class AudioBuffer;
+class AudioProfiler;
 class AudioOutputDeviceController;
 class Playback;
 class SoundFontRepository;
@@ -70,6 +71,7 @@ private:
     std::shared_ptr<AudioEngine> m_audioEngine;
     std::shared_ptr<AudioThread> m_audioWorker;
     std::shared_ptr<AudioBuffer> m_audioBuffer;
+    std::shared_ptr<AudioProfiler> m_audioProfiler;
     std::shared_ptr<AudioOutputDeviceController> m_audioOutputController;
 
     std::shared_ptr<fx::FxResolver> m_fxResolver;
@@ -23,6 +23,7 @@
 #ifndef MUSE_AUDIO_AUDIOTYPES_H
 #define MUSE_AUDIO_AUDIOTYPES_H
 
+#include <optional>
 #include <variant>
 #include <set>
 #include <string>
@@ -34,6 +35,7 @@
 #include "global/realfn.h"
 #include "global/async/channel.h"
 #include "global/io/iodevice.h"
+#include "global/io/path.h"
 
 #include "mpe/events.h"
 
@@ -92,13 +94,17 @@ struct SoundTrackFormat {
     audioch_t audioChannelsNumber = 0;
     int bitRate = 0;
 
+    //! NOTE Integrated loudness (LUFS) the rendered track is normalized to while it is written
+    std::optional<float> targetLoudness;
+
     bool operator==(const SoundTrackFormat& other) const
     {
         return type == other.type
                && sampleRate == other.sampleRate
                && audioChannelsNumber == other.audioChannelsNumber
                && samplesPerChannel == other.samplesPerChannel
-               && bitRate == other.bitRate;
+               && bitRate == other.bitRate
+               && targetLoudness == other.targetLoudness;
     }
 
     bool isValid() const
@@ -110,6 +116,15 @@ struct SoundTrackFormat {
     }
 };
 
+struct SoundTrackDestination {
+    io::path_t path;
+    SoundTrackFormat format;
+};
+
+//! NOTE The sound tracks of one list are rendered once, so their formats
+//! must share the sample rate, the channels number, the samples per channel and the target loudness
+using SoundTrackDestinationList = std::vector<SoundTrackDestination>;
+
 using AudioSourceName = std::string;
 using AudioResourceId = std::string;
 using AudioResourceIdList = std::vector<AudioResourceId>;
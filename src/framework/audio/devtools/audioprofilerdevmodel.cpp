@@ -0,0 +1,178 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2024 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "audioprofilerdevmodel.h"
+
+#include <algorithm>
+
+#include <QDateTime>
+
+#include "log.h"
+
+using namespace muse::audio;
+
+static constexpr int UPDATE_INTERVAL = 500; // ms
+static constexpr int MAX_XRUN_HISTORY = 100;
+
+AudioProfilerDevModel::AudioProfilerDevModel(QObject* parent)
+    : QObject(parent), Injectable(muse::iocCtxForQmlObject(this))
+{
+    m_updateTimer.setInterval(UPDATE_INTERVAL);
+    QObject::connect(&m_updateTimer, &QTimer::timeout, [this]() { update(); });
+}
+
+void AudioProfilerDevModel::init()
+{
+    update();
+    m_updateTimer.start();
+}
+
+void AudioProfilerDevModel::reset()
+{
+    audioProfiler()->reset();
+    m_xrunHistory.clear();
+
+    update();
+}
+
+QString AudioProfilerDevModel::dump() const
+{
+    std::string str = audioProfiler()->dump();
+    LOGI() << "Audio worker profile:\n" << str;
+
+    return QString::fromStdString(str);
+}
+
+bool AudioProfilerDevModel::enabled() const
+{
+    return audioProfiler()->isEnabled();
+}
+
+void AudioProfilerDevModel::setEnabled(bool enabled)
+{
+    if (this->enabled() == enabled) {
+        return;
+    }
+
+    audioProfiler()->setEnabled(enabled);
+    emit enabledChanged();
+}
+
+void AudioProfilerDevModel::update()
+{
+    const uint64_t prevXrunCount = m_counters.xrunCount;
+
+    m_counters = audioProfiler()->counters();
+    m_blocks = audioProfiler()->recentBlocks();
+    m_tracks = audioProfiler()->trackProfiles();
+
+    //! NOTE The profiler keeps only the xrun count, so the history is collected here, by the update interval
+    if (m_counters.xrunCount > prevXrunCount) {
+        QVariantMap item;
+        item["time"] = QDateTime::currentDateTime().toString("hh:mm:ss.zzz");
+        item["count"] = QVariant::fromValue(m_counters.xrunCount - prevXrunCount);
+
+        m_xrunHistory.prepend(item);
+        while (m_xrunHistory.size() > MAX_XRUN_HISTORY) {
+            m_xrunHistory.removeLast();
+        }
+    }
+
+    emit dataChanged();
+}
+
+QVariantMap AudioProfilerDevModel::counters() const
+{
+    QVariantMap map;
+    map["blockCount"] = QVariant::fromValue(m_counters.blockCount);
+    map["missedDeadlineCount"] = QVariant::fromValue(m_counters.missedDeadlineCount);
+    map["xrunCount"] = QVariant::fromValue(m_counters.xrunCount);
+    map["workerLoopOverrunCount"] = QVariant::fromValue(m_counters.workerLoopOverrunCount);
+    map["allocationCount"] = QVariant::fromValue(m_counters.allocationCount);
+    map["droppedBlockCount"] = QVariant::fromValue(m_counters.droppedBlockCount);
+    map["bufferReservedSamples"] = QVariant::fromValue(m_counters.bufferReservedSamples);
+    map["bufferMinReservedSamples"] = QVariant::fromValue(m_counters.bufferMinReservedSamples);
+    map["bufferTargetSamples"] = QVariant::fromValue(m_counters.bufferTargetSamples);
+
+    return map;
+}
+
+QVariantMap AudioProfilerDevModel::load() const
+{
+    double avgLoad = 0.0;
+    double maxLoad = 0.0;
+
+    for (const AudioBlockProfile& block : m_blocks) {
+        if (block.deadlineMs <= 0.0) {
+            continue;
+        }
+
+        const double load = block.processingTimeMs / block.deadlineMs;
+        avgLoad += load;
+        maxLoad = std::max(maxLoad, load);
+    }
+
+    if (!m_blocks.empty()) {
+        avgLoad /= m_blocks.size();
+    }
+
+    //! NOTE Rough estimate of the time between a triggered event and its sound:
+    //! the audio already buffered for the driver plus the driver buffer itself
+    const double sampleRate = audioConfiguration()->sampleRate();
+    const audioch_t channels = std::max<audioch_t>(audioConfiguration()->audioChannelsCount(), 1);
+    const double bufferedFrames = static_cast<double>(m_counters.bufferReservedSamples) / channels;
+    const double outputLatencyMs = sampleRate > 0
+                                   ? (bufferedFrames + audioConfiguration()->driverBufferSize()) * 1000.0 / sampleRate
+                                   : 0.0;
+
+    QVariantMap map;
+    map["avgDspLoadPercent"] = avgLoad * 100.0;
+    map["maxDspLoadPercent"] = maxLoad * 100.0;
+    map["bufferFillPercent"] = m_counters.bufferTargetSamples > 0
+                               ? 100.0 * m_counters.bufferReservedSamples / m_counters.bufferTargetSamples
+                               : 0.0;
+    map["outputLatencyMs"] = outputLatencyMs;
+
+    return map;
+}
+
+QVariantList AudioProfilerDevModel::tracks() const
+{
+    const double deadlineMs = m_blocks.empty() ? 0.0 : m_blocks.back().deadlineMs;
+
+    QVariantList list;
+    for (const AudioTrackProfile& track : m_tracks) {
+        QVariantMap item;
+        item["trackId"] = static_cast<int>(track.trackId);
+        item["lastRenderTimeMs"] = track.lastRenderTimeMs;
+        item["avgRenderTimeMs"] = track.avgRenderTimeMs;
+        item["maxRenderTimeMs"] = track.maxRenderTimeMs;
+        item["dspLoadPercent"] = deadlineMs > 0.0 ? 100.0 * track.avgRenderTimeMs / deadlineMs : 0.0;
+        list << item;
+    }
+
+    return list;
+}
+
+QVariantList AudioProfilerDevModel::xrunHistory() const
+{
+    return m_xrunHistory;
+}
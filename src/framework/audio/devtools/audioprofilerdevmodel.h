@@ -0,0 +1,79 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2024 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef MUSE_AUDIO_AUDIOPROFILERDEVMODEL_H
+#define MUSE_AUDIO_AUDIOPROFILERDEVMODEL_H
+
+#include <QObject>
+#include <QTimer>
+#include <QVariantList>
+#include <QVariantMap>
+
+#include "modularity/ioc.h"
+#include "audio/iaudioprofiler.h"
+#include "audio/iaudioconfiguration.h"
+
+namespace muse::audio {
+class AudioProfilerDevModel : public QObject, public Injectable
+{
+    Q_OBJECT
+
+    Q_PROPERTY(bool enabled READ enabled WRITE setEnabled NOTIFY enabledChanged)
+    Q_PROPERTY(QVariantMap counters READ counters NOTIFY dataChanged)
+    Q_PROPERTY(QVariantMap load READ load NOTIFY dataChanged)
+    Q_PROPERTY(QVariantList tracks READ tracks NOTIFY dataChanged)
+    Q_PROPERTY(QVariantList xrunHistory READ xrunHistory NOTIFY dataChanged)
+
+    Inject<IAudioProfiler> audioProfiler = { this };
+    Inject<IAudioConfiguration> audioConfiguration = { this };
+
+public:
+    explicit AudioProfilerDevModel(QObject* parent = nullptr);
+
+    Q_INVOKABLE void init();
+    Q_INVOKABLE void reset();
+    Q_INVOKABLE QString dump() const;
+
+    bool enabled() const;
+    void setEnabled(bool enabled);
+
+    QVariantMap counters() const;
+    QVariantMap load() const;
+    QVariantList tracks() const;
+    QVariantList xrunHistory() const;
+
+signals:
+    void enabledChanged();
+    void dataChanged();
+
+private:
+    void update();
+
+    QTimer m_updateTimer;
+
+    AudioProfileCounters m_counters;
+    std::vector<AudioBlockProfile> m_blocks;
+    std::vector<AudioTrackProfile> m_tracks;
+    QVariantList m_xrunHistory;
+};
+}
+
+#endif // MUSE_AUDIO_AUDIOPROFILERDEVMODEL_H
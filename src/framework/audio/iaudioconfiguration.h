@@ -54,6 +54,7 @@ public:
 
     virtual msecs_t audioWorkerInterval(const samples_t bufferSize, const samples_t sampleRate) const = 0;
     virtual samples_t minSamplesToReserve(RenderMode mode) const = 0;
+    virtual samples_t samplesToRenderAhead(RenderMode mode) const = 0;
 
     virtual samples_t samplesToPreallocate() const = 0;
     virtual async::Channel<samples_t> samplesToPreallocateChanged() const = 0;
@@ -74,6 +75,7 @@ public:
     virtual async::Channel<io::paths_t> soundFontDirectoriesChanged() const = 0;
 
     virtual bool shouldMeasureInputLag() const = 0;
+    virtual bool shouldProfileAudioWorker() const = 0;
 };
 }
 
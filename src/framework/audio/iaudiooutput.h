@@ -53,6 +53,7 @@ public:
 
     virtual async::Promise<bool> saveSoundTrack(const TrackSequenceId sequenceId, const io::path_t& destination,
                                                 const SoundTrackFormat& format) = 0;
+    virtual async::Promise<bool> saveSoundTracks(const TrackSequenceId sequenceId, const SoundTrackDestinationList& destinations) = 0;
     virtual void abortSavingAllSoundTracks() = 0;
 
     virtual Progress saveSoundTrackProgress(const TrackSequenceId sequenceId) = 0;
@@ -0,0 +1,89 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2024 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef MUSE_AUDIO_IAUDIOPROFILER_H
+#define MUSE_AUDIO_IAUDIOPROFILER_H
+
+#include <string>
+#include <vector>
+
+#include "global/modularity/ioc.h"
+
+#include "audiotypes.h"
+
+namespace muse::audio {
+struct AudioBlockProfile {
+    uint64_t index = 0;
+    samples_t samplesPerChannel = 0;
+    double processingTimeMs = 0.0;
+    double deadlineMs = 0.0;
+    uint64_t allocationCount = 0;
+    TrackId slowestTrackId = INVALID_TRACK_ID;
+    double slowestTrackTimeMs = 0.0;
+
+    bool missedDeadline() const { return deadlineMs > 0.0 && processingTimeMs > deadlineMs; }
+};
+
+struct AudioTrackProfile {
+    TrackId trackId = INVALID_TRACK_ID;
+    double lastRenderTimeMs = 0.0;
+    double maxRenderTimeMs = 0.0;
+    double avgRenderTimeMs = 0.0;
+};
+
+struct AudioProfileCounters {
+    uint64_t blockCount = 0;
+    uint64_t missedDeadlineCount = 0;
+    uint64_t xrunCount = 0;
+    uint64_t workerLoopOverrunCount = 0;
+    uint64_t allocationCount = 0;
+    uint64_t droppedBlockCount = 0;
+
+    //! NOTE The fill level of the buffer between the worker and the driver, in samples
+    size_t bufferReservedSamples = 0;
+    size_t bufferMinReservedSamples = 0;
+    size_t bufferTargetSamples = 0;
+};
+
+//! NOTE Collects the timings of the audio worker, so that the buffer sizes
+//! and the number of the audio threads can be tuned with real data
+class IAudioProfiler : MODULE_EXPORT_INTERFACE
+{
+    INTERFACE_ID(IAudioProfiler)
+public:
+    virtual ~IAudioProfiler() = default;
+
+    virtual bool isEnabled() const = 0;
+    virtual void setEnabled(bool enabled) = 0;
+
+    //! NOTE The latest processed blocks, the oldest first
+    virtual std::vector<AudioBlockProfile> recentBlocks() const = 0;
+    virtual std::vector<AudioTrackProfile> trackProfiles() const = 0;
+    virtual AudioProfileCounters counters() const = 0;
+
+    virtual void reset() = 0;
+
+    //! NOTE Human-readable summary, for the diagnostics and the log
+    virtual std::string dump() const = 0;
+};
+}
+
+#endif // MUSE_AUDIO_IAUDIOPROFILER_H
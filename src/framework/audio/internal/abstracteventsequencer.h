@@ -23,8 +23,10 @@
 #ifndef MUSE_AUDIO_ABSTRACTEVENTSEQUENCER_H
 #define MUSE_AUDIO_ABSTRACTEVENTSEQUENCER_H
 
+#include <algorithm>
 #include <map>
 #include <set>
+#include <vector>
 
 #include "global/async/asyncable.h"
 #include "mpe/events.h"
@@ -44,6 +46,15 @@ public:
     typedef typename EventSequenceMap::const_iterator SequenceIterator;
     typedef typename EventSequence::const_iterator EventIterator;
 
+    //! NOTE The main stream and the dynamics are played from flat, sorted timelines:
+    //! every block scans forward from a cursor, and a seek is a binary search
+    struct TimedEvent {
+        msecs_t timestamp = 0;
+        EventType event;
+    };
+
+    using EventTimeline = std::vector<TimedEvent>;
+
     virtual ~AbstractEventSequencer()
     {
         m_playbackData.mainStream.resetOnReceive(this);
@@ -74,6 +85,7 @@ public:
         });
 
         updateMainStreamEvents(data.originEvents, data.dynamics, data.params);
+        commitMainStreamEvents();
     }
 
     const mpe::PlaybackData& playbackData() const
@@ -85,6 +97,7 @@ public:
     {
         if (m_shouldUpdateMainStreamEvents) {
             updateMainStreamEvents(m_playbackData.originEvents, m_playbackData.dynamics, m_playbackData.params);
+            commitMainStreamEvents();
             m_shouldUpdateMainStreamEvents = false;
         }
     }
@@ -166,7 +179,7 @@ public:
         // Empty sequence means to continue the previous sequence
         result.emplace(m_playbackPosition, EventSequence());
 
-        if (m_currentMainSequenceIt == m_mainStreamEvents.cend()) {
+        if (m_mainStreamCursor >= m_mainStreamTimeline.size()) {
             return result;
         }
 
@@ -192,7 +205,7 @@ protected:
 
     void updateMainSequenceIterator()
     {
-        m_currentMainSequenceIt = m_mainStreamEvents.lower_bound(m_playbackPosition);
+        m_mainStreamCursor = lowerBound(m_mainStreamTimeline, m_playbackPosition);
     }
 
     void updateOffSequenceIterator()
@@ -202,7 +215,7 @@ protected:
 
     void updateDynamicChangesIterator()
     {
-        m_currentDynamicsIt = m_dynamicEvents.lower_bound(m_playbackPosition);
+        m_dynamicsCursor = lowerBound(m_dynamicsTimeline, m_playbackPosition);
     }
 
     void handleOffStream(EventSequenceMap& result, const msecs_t nextMsecs)
@@ -227,36 +240,20 @@ protected:
 
     void handleMainStream(EventSequenceMap& result)
     {
-        while (m_currentMainSequenceIt != m_mainStreamEvents.end()
-               && m_currentMainSequenceIt->first <= m_playbackPosition) {
-            EventSequence& sequence = result[m_currentMainSequenceIt->first];
-            sequence.insert(m_currentMainSequenceIt->second.cbegin(),
-                            m_currentMainSequenceIt->second.cend());
-            m_currentMainSequenceIt = std::next(m_currentMainSequenceIt);
-        }
+        takeTimelineEvents(m_mainStreamTimeline, m_mainStreamCursor, result);
     }
 
     void handleDynamicChanges(EventSequenceMap& result)
     {
-        if (m_dynamicEvents.empty()) {
-            return;
-        }
-
-        while (m_currentDynamicsIt != m_dynamicEvents.end()
-               && m_currentDynamicsIt->first <= m_playbackPosition) {
-            EventSequence& sequence = result[m_currentDynamicsIt->first];
-            sequence.insert(m_currentDynamicsIt->second.cbegin(),
-                            m_currentDynamicsIt->second.cend());
-            m_currentDynamicsIt = std::next(m_currentDynamicsIt);
-        }
+        takeTimelineEvents(m_dynamicsTimeline, m_dynamicsCursor, result);
     }
 
     mutable msecs_t m_playbackPosition = 0;
 
-    SequenceIterator m_currentMainSequenceIt;
     SequenceIterator m_currentOffSequenceIt;
-    SequenceIterator m_currentDynamicsIt;
 
+    //! NOTE updateMainStreamEvents() fills m_mainStreamEvents and m_dynamicEvents,
+    //! then they are moved into the timelines
     EventSequenceMap m_mainStreamEvents;
     EventSequenceMap m_offStreamEvents;
     EventSequenceMap m_dynamicEvents;
@@ -269,6 +266,66 @@ protected:
     OnFlushedCallback m_onMainStreamFlushed;
 
 private:
+    void commitMainStreamEvents()
+    {
+        m_mainStreamTimeline = toTimeline(m_mainStreamEvents);
+        m_dynamicsTimeline = toTimeline(m_dynamicEvents);
+
+        updateMainSequenceIterator();
+        updateDynamicChangesIterator();
+    }
+
+    static EventTimeline toTimeline(EventSequenceMap& sequences)
+    {
+        size_t eventCount = 0;
+        for (const auto& pair : sequences) {
+            eventCount += pair.second.size();
+        }
+
+        EventTimeline timeline;
+        timeline.reserve(eventCount);
+
+        for (const auto& pair : sequences) {
+            for (const EventType& event : pair.second) {
+                timeline.push_back({ pair.first, event });
+            }
+        }
+
+        sequences.clear();
+
+        return timeline;
+    }
+
+    static size_t lowerBound(const EventTimeline& timeline, const msecs_t position)
+    {
+        auto it = std::lower_bound(timeline.cbegin(), timeline.cend(), position, [](const TimedEvent& event, const msecs_t pos) {
+            return event.timestamp < pos;
+        });
+
+        return static_cast<size_t>(std::distance(timeline.cbegin(), it));
+    }
+
+    void takeTimelineEvents(const EventTimeline& timeline, size_t& cursor, EventSequenceMap& result) const
+    {
+        auto sequenceIt = result.end();
+
+        while (cursor < timeline.size() && timeline[cursor].timestamp <= m_playbackPosition) {
+            const TimedEvent& timedEvent = timeline[cursor];
+
+            if (sequenceIt == result.end() || sequenceIt->first != timedEvent.timestamp) {
+                sequenceIt = result.try_emplace(timedEvent.timestamp).first;
+            }
+
+            sequenceIt->second.insert(timedEvent.event);
+            ++cursor;
+        }
+    }
+
+    EventTimeline m_mainStreamTimeline;
+    EventTimeline m_dynamicsTimeline;
+    size_t m_mainStreamCursor = 0;
+    size_t m_dynamicsCursor = 0;
+
     bool m_shouldUpdateMainStreamEvents = false;
 };
 }
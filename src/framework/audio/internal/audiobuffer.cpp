@@ -23,6 +23,8 @@
 
 #include <iostream>
 
+#include "audioprofiler.h"
+
 #include "log.h"
 
 using namespace muse::audio;
@@ -161,6 +163,16 @@ void AudioBuffer::setRenderStep(const samples_t renderStep)
     m_renderStep = renderStep;
 }
 
+void AudioBuffer::setProfiler(AudioProfiler* profiler)
+{
+    m_profiler = profiler;
+}
+
+void AudioBuffer::setOnReserveRunningLow(std::function<void()> f)
+{
+    m_onReserveRunningLow = std::move(f);
+}
+
 void AudioBuffer::forward()
 {
     if (!m_source) {
@@ -200,9 +212,23 @@ void AudioBuffer::pop(float* dest, size_t sampleCount)
     const auto currentWriteIdx = m_writeIndex.load(std::memory_order_acquire);
     if (currentReadIdx == currentWriteIdx) { // empty queue
         std::memcpy(dest, SILENT_FRAMES.data(), sampleCount * sizeof(float) * m_audioChannelsCount);
+
+        if (m_profiler && m_profiler->isEnabled()) {
+            m_profiler->addXrun();
+        }
+
+        if (m_source && m_onReserveRunningLow) {
+            m_onReserveRunningLow();
+        }
+
         return;
     }
 
+    if (m_profiler && m_profiler->isEnabled()
+        && reservedFrames(currentWriteIdx, currentReadIdx) < (sampleCount * m_audioChannelsCount)) {
+        m_profiler->addXrun();
+    }
+
 #ifdef DEBUG_AUDIO
     if (reservedFrames(currentWriteIdx, currentReadIdx) < (sampleCount * m_audioChannelsCount)) {
         static size_t missingFramesTotal = 0;
@@ -237,6 +263,17 @@ void AudioBuffer::pop(float* dest, size_t sampleCount)
     }
 
     m_readIndex.store(newReadIdx, std::memory_order_release);
+
+    const size_t reserved = reservedFrames(currentWriteIdx, newReadIdx);
+    const samples_t minSamplesToReserve = m_minSamplesToReserve.load(std::memory_order_relaxed);
+
+    if (m_profiler && m_profiler->isEnabled()) {
+        m_profiler->addBufferFill(reserved, minSamplesToReserve);
+    }
+
+    if (m_onReserveRunningLow && reserved < minSamplesToReserve) {
+        m_onReserveRunningLow();
+    }
 }
 
 void AudioBuffer::reset()
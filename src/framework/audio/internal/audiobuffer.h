@@ -25,6 +25,7 @@
 #include <vector>
 #include <memory>
 #include <atomic>
+#include <functional>
 
 #include "iaudiosource.h"
 #include "audiotypes.h"
@@ -43,6 +44,7 @@ constexpr size_t cache_line_size = 64;
 #endif
 
 namespace muse::audio {
+class AudioProfiler;
 class AudioBuffer
 {
 public:
@@ -53,6 +55,11 @@ public:
     void setSource(IAudioSourcePtr source);
     void setMinSamplesPerChannelToReserve(const samples_t samplesPerChannel);
     void setRenderStep(const samples_t renderStep);
+    void setProfiler(AudioProfiler* profiler);
+
+    //! NOTE Called from pop() (i.e. from the driver callback) when the reserve
+    //! drops below the minimum, so the worker can render without waiting for its next cycle
+    void setOnReserveRunningLow(std::function<void()> f);
 
     void forward();
     void pop(float* dest, size_t sampleCount);
@@ -68,10 +75,12 @@ private:
 
     samples_t m_samplesPerChannel = 0;
     audioch_t m_audioChannelsCount = 0;
-    samples_t m_minSamplesToReserve = 0;
+    std::atomic<samples_t> m_minSamplesToReserve = 0;
     samples_t m_renderStep = 0;
 
     IAudioSourcePtr m_source = nullptr;
+    AudioProfiler* m_profiler = nullptr;
+    std::function<void()> m_onReserveRunningLow;
 };
 
 using AudioBufferPtr = std::shared_ptr<AudioBuffer>;
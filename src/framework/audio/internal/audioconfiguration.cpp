@@ -42,7 +42,9 @@ static const Settings::Key AUDIO_OUTPUT_DEVICE_ID_KEY("audio", "io/outputDevice"
 static const Settings::Key AUDIO_BUFFER_SIZE_KEY("audio", "io/bufferSize");
 static const Settings::Key AUDIO_SAMPLE_RATE_KEY("audio", "io/sampleRate");
 static const Settings::Key AUDIO_MEASURE_INPUT_LAG("audio", "io/measureInputLag");
+static const Settings::Key AUDIO_PROFILE_WORKER("audio", "io/profileAudioWorker");
 static const Settings::Key AUDIO_DESIRED_THREAD_NUMBER_KEY("audio", "io/audioThreads");
+static const Settings::Key AUDIO_ANTICIPATIVE_PROCESSING_KEY("audio", "io/anticipativeProcessing");
 
 static const Settings::Key USER_SOUNDFONTS_PATHS("midi", "application/paths/mySoundfonts");
 
@@ -90,8 +92,10 @@ void AudioConfiguration::init()
     }
 
     settings()->setDefaultValue(AUDIO_MEASURE_INPUT_LAG, Val(false));
+    settings()->setDefaultValue(AUDIO_PROFILE_WORKER, Val(false));
 
     settings()->setDefaultValue(AUDIO_DESIRED_THREAD_NUMBER_KEY, Val(0));
+    settings()->setDefaultValue(AUDIO_ANTICIPATIVE_PROCESSING_KEY, Val(false));
 
     updateSamplesToPreallocate();
 }
@@ -175,6 +179,20 @@ samples_t AudioConfiguration::minSamplesToReserve(RenderMode mode) const
     return 1024;
 }
 
+samples_t AudioConfiguration::samplesToRenderAhead(RenderMode mode) const
+{
+    const samples_t minToReserve = minSamplesToReserve(mode);
+
+    // Anticipative processing: during the playback keep several blocks rendered ahead,
+    // so that a heavy block (e.g. a VST instrument spike) is absorbed instead of causing a dropout.
+    // Notes played live are delayed by that amount, so it is opt-in and never used when idle
+    if (mode != RenderMode::RealTimeMode || !settings()->value(AUDIO_ANTICIPATIVE_PROCESSING_KEY).toBool()) {
+        return minToReserve;
+    }
+
+    return minToReserve * 4;
+}
+
 samples_t AudioConfiguration::samplesToPreallocate() const
 {
     return m_samplesToPreallocate;
@@ -248,6 +266,11 @@ bool AudioConfiguration::shouldMeasureInputLag() const
     return settings()->value(AUDIO_MEASURE_INPUT_LAG).toBool();
 }
 
+bool AudioConfiguration::shouldProfileAudioWorker() const
+{
+    return settings()->value(AUDIO_PROFILE_WORKER).toBool();
+}
+
 void AudioConfiguration::updateSamplesToPreallocate()
 {
     samples_t minToReserve = minSamplesToReserve(RenderMode::RealTimeMode);
@@ -57,6 +57,7 @@ public:
 
     msecs_t audioWorkerInterval(const samples_t samples, const sample_rate_t sampleRate) const override;
     samples_t minSamplesToReserve(RenderMode mode) const override;
+    samples_t samplesToRenderAhead(RenderMode mode) const override;
 
     samples_t samplesToPreallocate() const override;
     async::Channel<samples_t> samplesToPreallocateChanged() const override;
@@ -77,6 +78,7 @@ public:
     async::Channel<io::paths_t> soundFontDirectoriesChanged() const override;
 
     bool shouldMeasureInputLag() const override;
+    bool shouldProfileAudioWorker() const override;
 
 private:
     void updateSamplesToPreallocate();
@@ -0,0 +1,329 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2024 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "audioprofiler.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <new>
+#include <sstream>
+
+using namespace muse::audio;
+
+static constexpr size_t BLOCK_HISTORY_SIZE = 1024;
+static constexpr size_t MAX_PROFILED_TRACKS = 256;
+static constexpr size_t TRACKS_TO_DUMP = 10;
+
+//! NOTE Replaces the global operator new to count the allocations made by the audio threads
+//#define MUSE_AUDIO_PROFILE_ALLOCATIONS
+
+static thread_local bool s_trackAllocations = false;
+static thread_local uint64_t s_allocationCount = 0;
+
+#ifdef MUSE_AUDIO_PROFILE_ALLOCATIONS
+void* operator new(std::size_t size)
+{
+    if (s_trackAllocations) {
+        ++s_allocationCount;
+    }
+
+    if (void* ptr = std::malloc(size == 0 ? 1 : size)) {
+        return ptr;
+    }
+
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size)
+{
+    return ::operator new(size);
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+#endif
+
+AudioProfiler::AudioProfiler()
+{
+    m_blocks.resize(BLOCK_HISTORY_SIZE);
+    m_tracks.resize(MAX_PROFILED_TRACKS);
+}
+
+bool AudioProfiler::isEnabled() const
+{
+    return m_enabled.load(std::memory_order_relaxed);
+}
+
+void AudioProfiler::setEnabled(bool enabled)
+{
+    m_enabled.store(enabled, std::memory_order_relaxed);
+}
+
+std::vector<AudioBlockProfile> AudioProfiler::recentBlocks() const
+{
+    std::lock_guard lock(m_mutex);
+
+    const size_t count = static_cast<size_t>(std::min<uint64_t>(m_blockCount, BLOCK_HISTORY_SIZE));
+
+    std::vector<AudioBlockProfile> result;
+    result.reserve(count);
+
+    for (uint64_t idx = m_blockCount - count; idx < m_blockCount; ++idx) {
+        result.push_back(m_blocks[idx % BLOCK_HISTORY_SIZE]);
+    }
+
+    return result;
+}
+
+std::vector<AudioTrackProfile> AudioProfiler::trackProfiles() const
+{
+    std::lock_guard lock(m_mutex);
+
+    std::vector<AudioTrackProfile> result;
+    result.reserve(m_trackCount);
+
+    for (size_t i = 0; i < m_trackCount; ++i) {
+        const TrackStats& stats = m_tracks[i];
+
+        AudioTrackProfile profile;
+        profile.trackId = stats.trackId;
+        profile.lastRenderTimeMs = stats.lastRenderTimeMs;
+        profile.maxRenderTimeMs = stats.maxRenderTimeMs;
+        profile.avgRenderTimeMs = stats.renderCount > 0 ? stats.renderTimeSumMs / stats.renderCount : 0.0;
+
+        result.push_back(profile);
+    }
+
+    return result;
+}
+
+AudioProfileCounters AudioProfiler::counters() const
+{
+    AudioProfileCounters result;
+
+    {
+        std::lock_guard lock(m_mutex);
+        result.blockCount = m_blockCount;
+        result.missedDeadlineCount = m_missedDeadlineCount;
+        result.allocationCount = m_allocationCount;
+    }
+
+    result.xrunCount = m_xrunCount.load(std::memory_order_relaxed);
+    result.workerLoopOverrunCount = m_workerLoopOverrunCount.load(std::memory_order_relaxed);
+    result.droppedBlockCount = m_droppedBlockCount.load(std::memory_order_relaxed);
+
+    const size_t minReserved = m_bufferMinReservedSamples.load(std::memory_order_relaxed);
+    result.bufferReservedSamples = m_bufferReservedSamples.load(std::memory_order_relaxed);
+    result.bufferMinReservedSamples = minReserved == SIZE_MAX ? 0 : minReserved;
+    result.bufferTargetSamples = m_bufferTargetSamples.load(std::memory_order_relaxed);
+
+    return result;
+}
+
+void AudioProfiler::reset()
+{
+    {
+        std::lock_guard lock(m_mutex);
+        m_trackCount = 0;
+        m_blockCount = 0;
+        m_missedDeadlineCount = 0;
+        m_allocationCount = 0;
+    }
+
+    m_xrunCount.store(0, std::memory_order_relaxed);
+    m_workerLoopOverrunCount.store(0, std::memory_order_relaxed);
+    m_droppedBlockCount.store(0, std::memory_order_relaxed);
+    m_bufferMinReservedSamples.store(SIZE_MAX, std::memory_order_relaxed);
+}
+
+std::string AudioProfiler::dump() const
+{
+    const AudioProfileCounters counts = counters();
+    const std::vector<AudioBlockProfile> blocks = recentBlocks();
+    std::vector<AudioTrackProfile> tracks = trackProfiles();
+
+    std::stringstream stream;
+    stream << "blocks: " << counts.blockCount
+           << ", missed deadlines: " << counts.missedDeadlineCount
+           << ", xruns: " << counts.xrunCount
+           << ", worker loop overruns: " << counts.workerLoopOverrunCount
+           << ", not recorded: " << counts.droppedBlockCount << "\n";
+
+    stream << "buffer, samples: reserved " << counts.bufferReservedSamples
+           << ", min " << counts.bufferMinReservedSamples
+           << ", target " << counts.bufferTargetSamples << "\n";
+
+    if (isAllocationTrackingAvailable()) {
+        stream << "allocations on the worker thread: " << counts.allocationCount << "\n";
+    } else {
+        stream << "allocations on the worker thread: not tracked (see MUSE_AUDIO_PROFILE_ALLOCATIONS)\n";
+    }
+
+    if (!blocks.empty()) {
+        double sumMs = 0.0;
+        double maxMs = 0.0;
+        size_t missed = 0;
+
+        for (const AudioBlockProfile& block : blocks) {
+            sumMs += block.processingTimeMs;
+            maxMs = std::max(maxMs, block.processingTimeMs);
+            missed += block.missedDeadline() ? 1 : 0;
+        }
+
+        stream << "last " << blocks.size() << " blocks, ms: avg " << sumMs / blocks.size()
+               << ", max " << maxMs
+               << ", deadline " << blocks.back().deadlineMs
+               << ", missed " << missed << "\n";
+    }
+
+    std::sort(tracks.begin(), tracks.end(), [](const AudioTrackProfile& t1, const AudioTrackProfile& t2) {
+        return t1.maxRenderTimeMs > t2.maxRenderTimeMs;
+    });
+
+    const size_t trackCount = std::min(tracks.size(), TRACKS_TO_DUMP);
+    for (size_t i = 0; i < trackCount; ++i) {
+        const AudioTrackProfile& track = tracks.at(i);
+        stream << "track " << track.trackId << ", ms: last " << track.lastRenderTimeMs
+               << ", avg " << track.avgRenderTimeMs
+               << ", max " << track.maxRenderTimeMs << "\n";
+    }
+
+    return stream.str();
+}
+
+void AudioProfiler::addBlock(const AudioBlockProfile& block, const TrackId* trackIds, const double* trackRenderTimesMs,
+                             size_t trackCount)
+{
+    // Never wait for the readers: the block is just not recorded
+    std::unique_lock lock(m_mutex, std::try_to_lock);
+    if (!lock.owns_lock()) {
+        m_droppedBlockCount.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    AudioBlockProfile& slot = m_blocks[m_blockCount % BLOCK_HISTORY_SIZE];
+    slot = block;
+    slot.index = m_blockCount;
+
+    for (size_t i = 0; i < trackCount; ++i) {
+        const double timeMs = trackRenderTimesMs[i];
+
+        if (timeMs > slot.slowestTrackTimeMs) {
+            slot.slowestTrackId = trackIds[i];
+            slot.slowestTrackTimeMs = timeMs;
+        }
+
+        TrackStats* stats = findTrackStats(trackIds[i]);
+        if (!stats) {
+            continue;
+        }
+
+        stats->lastRenderTimeMs = timeMs;
+        stats->maxRenderTimeMs = std::max(stats->maxRenderTimeMs, timeMs);
+        stats->renderTimeSumMs += timeMs;
+        stats->renderCount++;
+    }
+
+    m_blockCount++;
+    m_allocationCount += block.allocationCount;
+
+    if (block.missedDeadline()) {
+        m_missedDeadlineCount++;
+    }
+}
+
+void AudioProfiler::addWorkerLoop(double elapsedMs, msecs_t intervalMs)
+{
+    if (elapsedMs > static_cast<double>(intervalMs)) {
+        m_workerLoopOverrunCount.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+void AudioProfiler::addXrun()
+{
+    m_xrunCount.fetch_add(1, std::memory_order_relaxed);
+}
+
+void AudioProfiler::addBufferFill(size_t reservedSamples, size_t targetSamples)
+{
+    m_bufferReservedSamples.store(reservedSamples, std::memory_order_relaxed);
+    m_bufferTargetSamples.store(targetSamples, std::memory_order_relaxed);
+
+    // Only the driver thread writes it, so no CAS loop is needed
+    if (reservedSamples < m_bufferMinReservedSamples.load(std::memory_order_relaxed)) {
+        m_bufferMinReservedSamples.store(reservedSamples, std::memory_order_relaxed);
+    }
+}
+
+bool AudioProfiler::isAllocationTrackingAvailable()
+{
+#ifdef MUSE_AUDIO_PROFILE_ALLOCATIONS
+    return true;
+#else
+    return false;
+#endif
+}
+
+void AudioProfiler::trackAllocationsOnCurrentThread()
+{
+    s_trackAllocations = true;
+}
+
+uint64_t AudioProfiler::currentThreadAllocationCount()
+{
+    return s_allocationCount;
+}
+
+AudioProfiler::TrackStats* AudioProfiler::findTrackStats(TrackId trackId)
+{
+    for (size_t i = 0; i < m_trackCount; ++i) {
+        if (m_tracks[i].trackId == trackId) {
+            return &m_tracks[i];
+        }
+    }
+
+    if (m_trackCount == m_tracks.size()) {
+        return nullptr;
+    }
+
+    TrackStats& stats = m_tracks[m_trackCount++];
+    stats = TrackStats();
+    stats.trackId = trackId;
+
+    return &stats;
+}
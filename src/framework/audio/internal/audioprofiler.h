@@ -0,0 +1,95 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2024 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef MUSE_AUDIO_AUDIOPROFILER_H
+#define MUSE_AUDIO_AUDIOPROFILER_H
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "../iaudioprofiler.h"
+
+namespace muse::audio {
+class AudioProfiler : public IAudioProfiler
+{
+public:
+    AudioProfiler();
+
+    bool isEnabled() const override;
+    void setEnabled(bool enabled) override;
+
+    std::vector<AudioBlockProfile> recentBlocks() const override;
+    std::vector<AudioTrackProfile> trackProfiles() const override;
+    AudioProfileCounters counters() const override;
+
+    void reset() override;
+
+    std::string dump() const override;
+
+    //! NOTE The methods below are called on the audio threads: they never allocate and never wait for the readers
+    void addBlock(const AudioBlockProfile& block, const TrackId* trackIds, const double* trackRenderTimesMs, size_t trackCount);
+    void addWorkerLoop(double elapsedMs, msecs_t intervalMs);
+    void addXrun();
+    void addBufferFill(size_t reservedSamples, size_t targetSamples);
+
+    //! NOTE Counts the heap allocations made by the current thread,
+    //! works only if MUSE_AUDIO_PROFILE_ALLOCATIONS is defined in audioprofiler.cpp
+    static bool isAllocationTrackingAvailable();
+    static void trackAllocationsOnCurrentThread();
+    static uint64_t currentThreadAllocationCount();
+
+private:
+    struct TrackStats {
+        TrackId trackId = INVALID_TRACK_ID;
+        double lastRenderTimeMs = 0.0;
+        double maxRenderTimeMs = 0.0;
+        double renderTimeSumMs = 0.0;
+        uint64_t renderCount = 0;
+    };
+
+    TrackStats* findTrackStats(TrackId trackId);
+
+    std::atomic<bool> m_enabled = false;
+
+    mutable std::mutex m_mutex;
+    std::vector<AudioBlockProfile> m_blocks;
+    std::vector<TrackStats> m_tracks;
+    size_t m_trackCount = 0;
+    uint64_t m_blockCount = 0;
+    uint64_t m_missedDeadlineCount = 0;
+    uint64_t m_allocationCount = 0;
+
+    std::atomic<uint64_t> m_xrunCount = 0;
+    std::atomic<uint64_t> m_workerLoopOverrunCount = 0;
+    std::atomic<uint64_t> m_droppedBlockCount = 0;
+
+    std::atomic<size_t> m_bufferReservedSamples = 0;
+    std::atomic<size_t> m_bufferMinReservedSamples = SIZE_MAX;
+    std::atomic<size_t> m_bufferTargetSamples = 0;
+};
+
+using AudioProfilerPtr = std::shared_ptr<AudioProfiler>;
+}
+
+#endif // MUSE_AUDIO_AUDIOPROFILER_H
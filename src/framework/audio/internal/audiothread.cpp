@@ -21,11 +21,14 @@
  */
 #include "audiothread.h"
 
+#include <chrono>
+
 #include "global/runtime.h"
 #include "global/threadutils.h"
 #include "global/async/processevents.h"
 
 #include "internal/audiosanitizer.h"
+#include "internal/audioprofiler.h"
 
 #ifdef Q_OS_WASM
 #include <emscripten/html5.h>
@@ -89,6 +92,7 @@ void AudioThread::stop(const Runnable& onFinished)
 {
     m_onFinished = onFinished;
     m_running = false;
+    m_wakeUpCv.notify_one();
     if (m_thread) {
         m_thread->join();
     }
@@ -99,12 +103,34 @@ bool AudioThread::isRunning() const
     return m_running;
 }
 
+void AudioThread::wakeUp()
+{
+    if (!m_wakeUpRequested.exchange(true, std::memory_order_acq_rel)) {
+        m_wakeUpCv.notify_one();
+    }
+}
+
+void AudioThread::waitForWakeUp()
+{
+    std::unique_lock<std::mutex> lock(m_wakeUpMutex);
+    m_wakeUpCv.wait_for(lock, std::chrono::milliseconds(m_intervalMsecs), [this]() {
+        return m_wakeUpRequested.load(std::memory_order_acquire) || !m_running;
+    });
+}
+
+void AudioThread::setProfiler(AudioProfiler* profiler)
+{
+    m_profiler = profiler;
+}
+
 void AudioThread::main()
 {
     runtime::setThreadName("audio_worker");
 
     AudioThread::ID = std::this_thread::get_id();
 
+    AudioProfiler::trackAllocationsOnCurrentThread();
+
     if (m_onStart) {
         m_onStart();
     }
@@ -118,18 +144,33 @@ void AudioThread::main()
 #endif
 
     while (m_running) {
+        m_wakeUpRequested.store(false, std::memory_order_release);
+
+        const bool profile = m_profiler && m_profiler->isEnabled();
+        const auto loopStart = profile ? std::chrono::steady_clock::now() : std::chrono::steady_clock::time_point();
+
         async::processEvents();
 
         if (m_mainLoopBody) {
             m_mainLoopBody();
         }
 
+        if (profile) {
+            const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - loopStart;
+            m_profiler->addWorkerLoop(elapsed.count(), m_intervalMsecs);
+        }
+
+        //! NOTE The driver has run low on data while we were busy, so don't sleep
+        if (m_wakeUpRequested.load(std::memory_order_acquire)) {
+            continue;
+        }
+
 #ifdef Q_OS_WIN
         if (!timerValid || !timer.setAndWait(m_intervalInWinTime)) {
-            std::this_thread::sleep_for(std::chrono::milliseconds(m_intervalMsecs));
+            waitForWakeUp();
         }
 #else
-        std::this_thread::sleep_for(std::chrono::milliseconds(m_intervalMsecs));
+        waitForWakeUp();
 #endif
     }
 
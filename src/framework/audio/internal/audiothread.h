@@ -27,10 +27,13 @@
 #include <thread>
 #include <atomic>
 #include <functional>
+#include <mutex>
+#include <condition_variable>
 
 #include "audiotypes.h"
 
 namespace muse::audio {
+class AudioProfiler;
 class AudioThread
 {
 public:
@@ -44,10 +47,17 @@ public:
     void run(const Runnable& onStart, const Runnable& loopBody, const msecs_t interval = 1);
     void setInterval(const msecs_t interval);
     void stop(const Runnable& onFinished = nullptr);
+
+    //! NOTE Requests the next loop cycle right away instead of after the interval,
+    //! can be called from the driver callback
+    void wakeUp();
     bool isRunning() const;
 
+    void setProfiler(AudioProfiler* profiler);
+
 private:
     void main();
+    void waitForWakeUp();
 
     Runnable m_onStart = nullptr;
     Runnable m_mainLoopBody = nullptr;
@@ -57,6 +67,12 @@ private:
 
     std::unique_ptr<std::thread> m_thread = nullptr;
     std::atomic<bool> m_running = false;
+
+    std::atomic<bool> m_wakeUpRequested = false;
+    std::mutex m_wakeUpMutex;
+    std::condition_variable m_wakeUpCv;
+
+    AudioProfiler* m_profiler = nullptr;
 };
 using AudioThreadPtr = std::shared_ptr<AudioThread>;
 }
@@ -49,17 +49,6 @@ inline float sampleReleaseTimeCoefficient(const unsigned int sampleRate, const f
     return std::exp(-std::log(9) / (sampleRate * releaseTimeInSecs));
 }
 
-inline void multiplySamples(float* buffer, const audioch_t& audioChannelsCount,
-                            const audioch_t& audioChannelNumber, const samples_t& samplesPerChannel,
-                            const float& multiplier)
-{
-    for (samples_t i = 0; i < samplesPerChannel; ++i) {
-        int idx = i * audioChannelsCount + audioChannelNumber;
-
-        buffer[idx] *= multiplier;
-    }
-}
-
 template<typename T>
 constexpr T convertFloatSamples(float value)
 {
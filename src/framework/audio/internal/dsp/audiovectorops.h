@@ -0,0 +1,187 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2024 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef MUSE_AUDIO_AUDIOVECTOROPS_H
+#define MUSE_AUDIO_AUDIOVECTOROPS_H
+
+#include <algorithm>
+#include <cmath>
+
+#include "../../audiotypes.h"
+#include "../fx/reverb/simdtypes.h"
+
+//
+// Vectorised loops over interleaved sample buffers, built on the simd types of the reverb.
+// Each function processes four samples at a time and finishes the tail with scalar code.
+//
+
+namespace muse::audio::dsp {
+inline float peakOf(const fx::simd::float_x4& value)
+{
+    return std::max(std::max(value[0], value[1]), std::max(value[2], value[3]));
+}
+
+//! Returns the peak of the samples
+inline float peakSample(const float* buffer, size_t samplesCount)
+{
+    namespace simd = fx::simd;
+
+    simd::float_x4 peak4 = 0.f;
+    size_t i = 0;
+
+    for (; i + 4 <= samplesCount; i += 4) {
+        peak4 = simd::max(peak4, simd::abs(simd::load_unaligned(buffer + i)));
+    }
+
+    float peak = peakOf(peak4);
+
+    for (; i < samplesCount; ++i) {
+        peak = std::max(peak, std::fabs(buffer[i]));
+    }
+
+    return peak;
+}
+
+//! Adds the source to the destination, returns the peak of the source
+inline float mixSamples(float* dst, const float* src, size_t samplesCount)
+{
+    namespace simd = fx::simd;
+
+    simd::float_x4 peak4 = 0.f;
+    size_t i = 0;
+
+    for (; i + 4 <= samplesCount; i += 4) {
+        simd::float_x4 s = simd::load_unaligned(src + i);
+        simd::store_unaligned(dst + i, simd::load_unaligned(dst + i) + s);
+        peak4 = simd::max(peak4, simd::abs(s));
+    }
+
+    float peak = peakOf(peak4);
+
+    for (; i < samplesCount; ++i) {
+        dst[i] += src[i];
+        peak = std::max(peak, std::fabs(src[i]));
+    }
+
+    return peak;
+}
+
+//! Adds the source multiplied by the gain to the destination
+inline void mixSamplesWithGain(float* dst, const float* src, float gain, size_t samplesCount)
+{
+    namespace simd = fx::simd;
+
+    const simd::float_x4 gain4 = gain;
+    size_t i = 0;
+
+    for (; i + 4 <= samplesCount; i += 4) {
+        simd::store_unaligned(dst + i, simd::load_unaligned(dst + i) + simd::load_unaligned(src + i) * gain4);
+    }
+
+    for (; i < samplesCount; ++i) {
+        dst[i] += src[i] * gain;
+    }
+}
+
+//! Multiplies all the samples by the same gain
+inline void applyGain(float* buffer, float gain, size_t samplesCount)
+{
+    namespace simd = fx::simd;
+
+    const simd::float_x4 gain4 = gain;
+    size_t i = 0;
+
+    for (; i + 4 <= samplesCount; i += 4) {
+        simd::store_unaligned(buffer + i, simd::load_unaligned(buffer + i) * gain4);
+    }
+
+    for (; i < samplesCount; ++i) {
+        buffer[i] *= gain;
+    }
+}
+
+//! Returns the sum of the products of the samples of both buffers
+inline float dotProduct(const float* a, const float* b, size_t samplesCount)
+{
+    namespace simd = fx::simd;
+
+    simd::float_x4 sum4 = 0.f;
+    size_t i = 0;
+
+    for (; i + 4 <= samplesCount; i += 4) {
+        sum4 = sum4 + simd::load_unaligned(a + i) * simd::load_unaligned(b + i);
+    }
+
+    float sum = (sum4[0] + sum4[1]) + (sum4[2] + sum4[3]);
+
+    for (; i < samplesCount; ++i) {
+        sum += a[i] * b[i];
+    }
+
+    return sum;
+}
+
+//! Multiplies every channel of the interleaved buffer by its own gain and adds
+//! the squared result samples of each channel to squaredSums, returns the peak of the result
+inline float applyChannelGains(float* buffer, audioch_t audioChannelsCount, samples_t samplesPerChannel,
+                               const float* gains, float* squaredSums)
+{
+    namespace simd = fx::simd;
+
+    const size_t samplesCount = samplesPerChannel * audioChannelsCount;
+    size_t i = 0;
+    float peak = 0.f;
+
+    //! NOTE Four samples hold whole frames only for 1, 2 or 4 channels
+    if (audioChannelsCount != 0 && 4 % audioChannelsCount == 0) {
+        const simd::float_x4 gain4 = { gains[0 % audioChannelsCount], gains[1 % audioChannelsCount],
+                                       gains[2 % audioChannelsCount], gains[3 % audioChannelsCount] };
+        simd::float_x4 squaredSum4 = 0.f;
+        simd::float_x4 peak4 = 0.f;
+
+        for (; i + 4 <= samplesCount; i += 4) {
+            simd::float_x4 s = simd::load_unaligned(buffer + i) * gain4;
+            simd::store_unaligned(buffer + i, s);
+            squaredSum4 = squaredSum4 + s * s;
+            peak4 = simd::max(peak4, simd::abs(s));
+        }
+
+        for (int lane = 0; lane < 4; ++lane) {
+            squaredSums[lane % audioChannelsCount] += squaredSum4[lane];
+        }
+
+        peak = peakOf(peak4);
+    }
+
+    for (; i < samplesCount; ++i) {
+        const audioch_t audioChNum = i % audioChannelsCount;
+        float s = buffer[i] * gains[audioChNum];
+        buffer[i] = s;
+        squaredSums[audioChNum] += s * s;
+        peak = std::max(peak, std::fabs(s));
+    }
+
+    return peak;
+}
+}
+
+#endif // MUSE_AUDIO_AUDIOVECTOROPS_H
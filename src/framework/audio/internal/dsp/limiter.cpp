@@ -22,6 +22,7 @@
 #include "limiter.h"
 
 #include "audiomathutils.h"
+#include "audiovectorops.h"
 
 using namespace muse::audio;
 using namespace muse::audio::dsp;
@@ -94,7 +95,97 @@ void Limiter::process(const float& linearRms, float* buffer, const audioch_t& au
     float totalLinearGain = muse::db_to_linear(makeUpGain);
 
     // apply linear gain
-    for (audioch_t audioChNum = 0; audioChNum < audioChannelsCount; ++audioChNum) {
-        multiplySamples(buffer, audioChannelsCount, audioChNum, samplesPerChannel, totalLinearGain);
+    applyGain(buffer, totalLinearGain, samplesPerChannel * audioChannelsCount);
+}
+
+LookaheadLimiter::LookaheadLimiter(const unsigned int sampleRate, const audioch_t audioChannelsCount, const volume_dbfs_t ceiling,
+                                   const float lookaheadTime, const float releaseTime)
+    : m_audioChannelsCount(audioChannelsCount)
+{
+    m_lookahead = std::max<samples_t>(static_cast<samples_t>(sampleRate * lookaheadTime), 1);
+    m_ceiling = muse::db_to_linear(ceiling);
+    m_releaseCoefficient = sampleReleaseTimeCoefficient(sampleRate, releaseTime);
+
+    m_frames.resize(m_lookahead * audioChannelsCount, 0.f);
+    m_silence.resize(audioChannelsCount, 0.f);
+
+    m_smoothedReductions.resize(m_lookahead, 1.f);
+    m_smoothedReductionsSum = static_cast<double>(m_lookahead);
+}
+
+samples_t LookaheadLimiter::latency() const
+{
+    return m_lookahead - 1;
+}
+
+bool LookaheadLimiter::process(const float* frame, float* output)
+{
+    ++m_inputFrames;
+    return pushFrame(frame, output);
+}
+
+bool LookaheadLimiter::flush(float* output)
+{
+    while (m_outputFrames < m_inputFrames) {
+        if (pushFrame(m_silence.data(), output)) {
+            return true;
+        }
     }
+
+    return false;
+}
+
+bool LookaheadLimiter::pushFrame(const float* frame, float* output)
+{
+    const uint64_t index = m_pushedFrames++;
+
+    float peak = 0.f;
+    float* slot = m_frames.data() + (index % m_lookahead) * m_audioChannelsCount;
+
+    for (audioch_t ch = 0; ch < m_audioChannelsCount; ++ch) {
+        slot[ch] = frame[ch];
+        peak = std::max(peak, std::fabs(frame[ch]));
+    }
+
+    const float reduction = peak > m_ceiling ? m_ceiling / peak : 1.f;
+
+    while (!m_windowReductions.empty() && m_windowReductions.back().second >= reduction) {
+        m_windowReductions.pop_back();
+    }
+
+    m_windowReductions.emplace_back(index, reduction);
+
+    while (m_windowReductions.front().first + m_lookahead <= index) {
+        m_windowReductions.pop_front();
+    }
+
+    if (index + 1 < m_lookahead) {
+        return false;
+    }
+
+    //! NOTE The minimum covers the frame leaving the delay and all the frames after it,
+    //! the release only slows the gain down on its way back up
+    const uint64_t outputIndex = index + 1 - m_lookahead;
+    const float windowReduction = m_windowReductions.front().second;
+
+    if (windowReduction < m_smoothedReduction) {
+        m_smoothedReduction = windowReduction;
+    } else {
+        m_smoothedReduction = m_releaseCoefficient * m_smoothedReduction + (1.f - m_releaseCoefficient) * windowReduction;
+    }
+
+    float& oldest = m_smoothedReductions[outputIndex % m_lookahead];
+    m_smoothedReductionsSum += m_smoothedReduction - oldest;
+    oldest = m_smoothedReduction;
+
+    const float gain = std::min(static_cast<float>(m_smoothedReductionsSum / m_lookahead), m_smoothedReduction);
+    const float* delayed = m_frames.data() + (outputIndex % m_lookahead) * m_audioChannelsCount;
+
+    for (audioch_t ch = 0; ch < m_audioChannelsCount; ++ch) {
+        output[ch] = delayed[ch] * gain;
+    }
+
+    ++m_outputFrames;
+
+    return m_outputFrames <= m_inputFrames;
 }
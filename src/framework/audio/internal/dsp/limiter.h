@@ -23,7 +23,9 @@
 #ifndef MUSE_AUDIO_LIMITER_H
 #define MUSE_AUDIO_LIMITER_H
 
+#include <deque>
 #include <memory>
+#include <vector>
 
 #include "envelopefilterconfig.h"
 
@@ -50,6 +52,48 @@ private:
 };
 
 using LimiterPtr = std::unique_ptr<Limiter>;
+
+//! NOTE A sample peak limiter for offline rendering. The frames are delayed by the lookahead,
+//! so the gain is already reduced when a peak arrives and no sample exceeds the ceiling.
+//! The gain is the moving average of the windowed minimum of the required reductions,
+//! which keeps it smooth without ever letting it rise above any of them
+class LookaheadLimiter
+{
+public:
+    LookaheadLimiter(const unsigned int sampleRate, const audioch_t audioChannelsCount, const volume_dbfs_t ceiling,
+                     const float lookaheadTime = DEFAULT_LOOKAHEAD_TIME, const float releaseTime = DEFAULT_RELEASE_TIME);
+
+    static constexpr float DEFAULT_LOOKAHEAD_TIME = 0.005f;
+    static constexpr float DEFAULT_RELEASE_TIME = 0.05f;
+
+    samples_t latency() const;
+
+    //! Pushes one interleaved frame, returns true when a delayed frame was written to the output
+    bool process(const float* frame, float* output);
+
+    //! Pushes silence to drain the delayed frames, returns false once all of them are written
+    bool flush(float* output);
+
+private:
+    bool pushFrame(const float* frame, float* output);
+
+    audioch_t m_audioChannelsCount = 0;
+    samples_t m_lookahead = 0;
+    float m_ceiling = 1.f;
+    float m_releaseCoefficient = 0.f;
+
+    std::vector<float> m_frames;
+    std::vector<float> m_silence;
+    std::deque<std::pair<uint64_t, float> > m_windowReductions;
+
+    std::vector<float> m_smoothedReductions;
+    double m_smoothedReductionsSum = 0.0;
+    float m_smoothedReduction = 1.f;
+
+    uint64_t m_pushedFrames = 0;
+    uint64_t m_inputFrames = 0;
+    uint64_t m_outputFrames = 0;
+};
 }
 
 #endif // MUSE_AUDIO_LIMITER_H
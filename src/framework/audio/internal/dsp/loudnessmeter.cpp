@@ -0,0 +1,171 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2026 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "loudnessmeter.h"
+
+#include <algorithm>
+#include <cmath>
+
+using namespace muse::audio;
+using namespace muse::audio::dsp;
+
+static constexpr double LOUDNESS_OFFSET = -0.691;
+static constexpr double HISTOGRAM_STEP_LU = 0.1;
+
+static double loudnessOf(double meanSquare)
+{
+    return LOUDNESS_OFFSET + 10.0 * std::log10(meanSquare);
+}
+
+LoudnessMeter::LoudnessMeter(const unsigned int sampleRate, const audioch_t audioChannelsCount)
+    : m_channels(audioChannelsCount), m_audioChannelsCount(audioChannelsCount),
+    m_histogramEnergy(HISTOGRAM_SIZE, 0.0), m_histogramCount(HISTOGRAM_SIZE, 0)
+{
+    //! NOTE The pre-filter (a high shelf) and the RLB high pass of BS.1770,
+    //! derived for the given sample rate instead of the tabulated 48 kHz coefficients
+    const double fs = static_cast<double>(sampleRate);
+
+    {
+        const double f0 = 1681.974450955533;
+        const double gainDb = 3.999843853973347;
+        const double q = 0.7071752369554196;
+
+        const double k = std::tan(M_PI * f0 / fs);
+        const double vh = std::pow(10.0, gainDb / 20.0);
+        const double vb = std::pow(vh, 0.4996667741545416);
+        const double a0 = 1.0 + k / q + k * k;
+
+        m_shelf.b0 = (vh + vb * k / q + k * k) / a0;
+        m_shelf.b1 = 2.0 * (k * k - vh) / a0;
+        m_shelf.b2 = (vh - vb * k / q + k * k) / a0;
+        m_shelf.a1 = 2.0 * (k * k - 1.0) / a0;
+        m_shelf.a2 = (1.0 - k / q + k * k) / a0;
+    }
+
+    {
+        const double f0 = 38.13547087602444;
+        const double q = 0.5003270373238773;
+
+        const double k = std::tan(M_PI * f0 / fs);
+        const double a0 = 1.0 + k / q + k * k;
+
+        m_highPass.b0 = 1.0;
+        m_highPass.b1 = -2.0;
+        m_highPass.b2 = 1.0;
+        m_highPass.a1 = 2.0 * (k * k - 1.0) / a0;
+        m_highPass.a2 = (1.0 - k / q + k * k) / a0;
+    }
+
+    m_stepSize = std::max<samples_t>(sampleRate / 10, 1);
+}
+
+double LoudnessMeter::kWeighted(ChannelState& state, double sample) const
+{
+    const double shelved = m_shelf.b0 * sample + state.shelf[0];
+    state.shelf[0] = m_shelf.b1 * sample - m_shelf.a1 * shelved + state.shelf[1];
+    state.shelf[1] = m_shelf.b2 * sample - m_shelf.a2 * shelved;
+
+    const double filtered = m_highPass.b0 * shelved + state.highPass[0];
+    state.highPass[0] = m_highPass.b1 * shelved - m_highPass.a1 * filtered + state.highPass[1];
+    state.highPass[1] = m_highPass.b2 * shelved - m_highPass.a2 * filtered;
+
+    return filtered;
+}
+
+void LoudnessMeter::process(const float* buffer, const samples_t samplesPerChannel)
+{
+    for (samples_t s = 0; s < samplesPerChannel; ++s) {
+        const float* frame = buffer + s * m_audioChannelsCount;
+
+        for (audioch_t ch = 0; ch < m_audioChannelsCount; ++ch) {
+            const double filtered = kWeighted(m_channels[ch], frame[ch]);
+            m_stepSum += filtered * filtered;
+        }
+
+        if (++m_stepPosition < m_stepSize) {
+            continue;
+        }
+
+        m_stepSums[m_stepsCount % BLOCK_STEPS] = m_stepSum;
+        ++m_stepsCount;
+        m_stepSum = 0.0;
+        m_stepPosition = 0;
+
+        if (m_stepsCount >= BLOCK_STEPS) {
+            double blockSum = 0.0;
+            for (double stepSum : m_stepSums) {
+                blockSum += stepSum;
+            }
+
+            addBlock(blockSum / static_cast<double>(BLOCK_STEPS * m_stepSize));
+        }
+    }
+}
+
+void LoudnessMeter::addBlock(double meanSquare)
+{
+    if (meanSquare <= 0.0) {
+        return;
+    }
+
+    const double loudness = loudnessOf(meanSquare);
+    if (loudness <= ABSOLUTE_GATE_LUFS) {
+        return;
+    }
+
+    const size_t bin = std::min(static_cast<size_t>((loudness - ABSOLUTE_GATE_LUFS) / HISTOGRAM_STEP_LU), HISTOGRAM_SIZE - 1);
+
+    m_histogramEnergy[bin] += meanSquare;
+    m_histogramCount[bin] += 1;
+
+    m_gatedEnergy += meanSquare;
+    m_gatedCount += 1;
+}
+
+bool LoudnessMeter::hasLoudness() const
+{
+    return m_gatedCount > 0;
+}
+
+float LoudnessMeter::integratedLoudness() const
+{
+    if (m_gatedCount == 0) {
+        return ABSOLUTE_GATE_LUFS;
+    }
+
+    const double relativeGate = loudnessOf(m_gatedEnergy / m_gatedCount) + RELATIVE_GATE_LU;
+    const double firstBin = std::ceil((relativeGate - ABSOLUTE_GATE_LUFS) / HISTOGRAM_STEP_LU);
+
+    double energy = 0.0;
+    size_t count = 0;
+
+    for (size_t bin = static_cast<size_t>(std::max(firstBin, 0.0)); bin < HISTOGRAM_SIZE; ++bin) {
+        energy += m_histogramEnergy[bin];
+        count += m_histogramCount[bin];
+    }
+
+    if (count == 0) {
+        return static_cast<float>(loudnessOf(m_gatedEnergy / m_gatedCount));
+    }
+
+    return static_cast<float>(loudnessOf(energy / count));
+}
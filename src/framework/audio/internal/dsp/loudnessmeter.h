@@ -0,0 +1,90 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2026 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef MUSE_AUDIO_LOUDNESSMETER_H
+#define MUSE_AUDIO_LOUDNESSMETER_H
+
+#include <array>
+#include <vector>
+
+#include "../../audiotypes.h"
+
+namespace muse::audio::dsp {
+//! NOTE Integrated loudness according to ITU-R BS.1770 / EBU R128:
+//! the K-weighted signal is measured in 400 ms blocks overlapping by 75%,
+//! blocks below -70 LUFS and then those 10 LU below the mean are gated out.
+//! The gated blocks are kept in a histogram with a resolution of 0.1 LU,
+//! so the loudness can be asked for at any moment of a long render
+class LoudnessMeter
+{
+public:
+    LoudnessMeter(const unsigned int sampleRate, const audioch_t audioChannelsCount);
+
+    static constexpr float ABSOLUTE_GATE_LUFS = -70.f;
+    static constexpr float RELATIVE_GATE_LU = -10.f;
+
+    void process(const float* buffer, const samples_t samplesPerChannel);
+
+    //! NOTE Returns false as long as there is no block above the absolute gate
+    bool hasLoudness() const;
+    float integratedLoudness() const;
+
+private:
+    struct Biquad {
+        double b0 = 0.0;
+        double b1 = 0.0;
+        double b2 = 0.0;
+        double a1 = 0.0;
+        double a2 = 0.0;
+    };
+
+    struct ChannelState {
+        std::array<double, 2> shelf = {};
+        std::array<double, 2> highPass = {};
+    };
+
+    static constexpr size_t BLOCK_STEPS = 4;
+    static constexpr size_t HISTOGRAM_SIZE = 1000;
+
+    double kWeighted(ChannelState& state, double sample) const;
+    void addBlock(double meanSquare);
+
+    Biquad m_shelf;
+    Biquad m_highPass;
+    std::vector<ChannelState> m_channels;
+    audioch_t m_audioChannelsCount = 0;
+
+    samples_t m_stepSize = 0;
+    samples_t m_stepPosition = 0;
+    double m_stepSum = 0.0;
+
+    std::array<double, BLOCK_STEPS> m_stepSums = {};
+    size_t m_stepsCount = 0;
+
+    std::vector<double> m_histogramEnergy;
+    std::vector<size_t> m_histogramCount;
+    double m_gatedEnergy = 0.0;
+    size_t m_gatedCount = 0;
+};
+}
+
+#endif // MUSE_AUDIO_LOUDNESSMETER_H
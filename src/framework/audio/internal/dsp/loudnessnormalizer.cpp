@@ -0,0 +1,116 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2026 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "loudnessnormalizer.h"
+
+#include <algorithm>
+
+using namespace muse::audio;
+using namespace muse::audio::dsp;
+
+LoudnessNormalizer::LoudnessNormalizer(const unsigned int sampleRate, const audioch_t audioChannelsCount, const float targetLoudness)
+    : m_meter(sampleRate, audioChannelsCount), m_limiter(sampleRate, audioChannelsCount, PEAK_CEILING),
+    m_audioChannelsCount(audioChannelsCount), m_targetLoudness(targetLoudness)
+{
+    m_delayCapacity = std::max<samples_t>(static_cast<samples_t>(sampleRate * ANALYSIS_LOOKAHEAD_TIME), 1);
+    m_delay.resize(m_delayCapacity * audioChannelsCount, 0.f);
+    m_frame.resize(audioChannelsCount, 0.f);
+
+    m_maxGainStepDb = MAX_GAIN_CHANGE_PER_SEC / static_cast<float>(sampleRate);
+}
+
+void LoudnessNormalizer::updateTargetGain()
+{
+    if (!m_meter.hasLoudness()) {
+        return;
+    }
+
+    m_targetGainDb = std::clamp(m_targetLoudness - m_meter.integratedLoudness(), -MAX_GAIN.raw(), MAX_GAIN.raw());
+
+    //! NOTE Nothing has left the delay yet, so the first measurement can be applied at once
+    if (!m_gainInitialized) {
+        m_gainDb = m_targetGainDb;
+        m_gain = muse::db_to_linear(m_gainDb);
+        m_gainInitialized = true;
+    }
+}
+
+bool LoudnessNormalizer::popFrame(float* output)
+{
+    if (m_gainDb != m_targetGainDb) {
+        m_gainDb += std::clamp(m_targetGainDb - m_gainDb, -m_maxGainStepDb, m_maxGainStepDb);
+        m_gain = muse::db_to_linear(m_gainDb);
+    }
+
+    const float* delayed = m_delay.data() + m_delayStart * m_audioChannelsCount;
+    for (audioch_t ch = 0; ch < m_audioChannelsCount; ++ch) {
+        m_frame[ch] = delayed[ch] * m_gain;
+    }
+
+    m_delayStart = (m_delayStart + 1) % m_delayCapacity;
+    --m_delaySize;
+
+    return m_limiter.process(m_frame.data(), output);
+}
+
+samples_t LoudnessNormalizer::process(const float* input, float* output, const samples_t samplesPerChannel)
+{
+    m_meter.process(input, samplesPerChannel);
+    updateTargetGain();
+
+    samples_t written = 0;
+
+    for (samples_t s = 0; s < samplesPerChannel; ++s) {
+        if (m_delaySize == m_delayCapacity) {
+            if (popFrame(output + written * m_audioChannelsCount)) {
+                ++written;
+            }
+        }
+
+        const samples_t end = (m_delayStart + m_delaySize) % m_delayCapacity;
+        std::copy_n(input + s * m_audioChannelsCount, m_audioChannelsCount, m_delay.data() + end * m_audioChannelsCount);
+        ++m_delaySize;
+    }
+
+    return written;
+}
+
+samples_t LoudnessNormalizer::flush(float* output, const samples_t maxSamplesPerChannel)
+{
+    samples_t written = 0;
+
+    while (written < maxSamplesPerChannel) {
+        float* frame = output + written * m_audioChannelsCount;
+
+        if (m_delaySize > 0) {
+            if (popFrame(frame)) {
+                ++written;
+            }
+        } else if (m_limiter.flush(frame)) {
+            ++written;
+        } else {
+            break;
+        }
+    }
+
+    return written;
+}
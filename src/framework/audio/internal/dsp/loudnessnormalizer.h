@@ -0,0 +1,82 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2026 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef MUSE_AUDIO_LOUDNESSNORMALIZER_H
+#define MUSE_AUDIO_LOUDNESSNORMALIZER_H
+
+#include <memory>
+#include <vector>
+
+#include "loudnessmeter.h"
+#include "limiter.h"
+
+namespace muse::audio::dsp {
+//! NOTE Normalizes a rendered stream to the target integrated loudness in a single pass.
+//! The frames wait in a delay buffer of a few seconds, so the gain applied to a frame
+//! is based on the loudness measured up to the end of the buffer. The gain follows
+//! the measurement slowly and the peaks it creates are caught by a lookahead limiter.
+//! Since the whole stream is not known in advance, the result approaches the target
+//! as the measurement settles rather than matching it exactly
+class LoudnessNormalizer
+{
+public:
+    LoudnessNormalizer(const unsigned int sampleRate, const audioch_t audioChannelsCount, const float targetLoudness);
+
+    static constexpr float ANALYSIS_LOOKAHEAD_TIME = 5.f; // secs
+    static constexpr volume_db_t MAX_GAIN = volume_db_t::make(24.f);
+    static constexpr volume_db_t MAX_GAIN_CHANGE_PER_SEC = volume_db_t::make(1.f);
+    static constexpr volume_dbfs_t PEAK_CEILING = volume_dbfs_t::make(-1.f);
+
+    //! Writes the frames leaving the delay to the output, returns their number (at most samplesPerChannel)
+    samples_t process(const float* input, float* output, const samples_t samplesPerChannel);
+
+    //! Writes the frames still delayed to the output, returns their number (at most maxSamplesPerChannel)
+    samples_t flush(float* output, const samples_t maxSamplesPerChannel);
+
+private:
+    void updateTargetGain();
+    bool popFrame(float* output);
+
+    LoudnessMeter m_meter;
+    LookaheadLimiter m_limiter;
+
+    audioch_t m_audioChannelsCount = 0;
+    float m_targetLoudness = 0.f;
+
+    std::vector<float> m_delay;
+    samples_t m_delayCapacity = 0;
+    samples_t m_delayStart = 0;
+    samples_t m_delaySize = 0;
+
+    std::vector<float> m_frame;
+
+    float m_targetGainDb = 0.f;
+    float m_gainDb = 0.f;
+    float m_gain = 1.f;
+    float m_maxGainStepDb = 0.f;
+    bool m_gainInitialized = false;
+};
+
+using LoudnessNormalizerPtr = std::unique_ptr<LoudnessNormalizer>;
+}
+
+#endif // MUSE_AUDIO_LOUDNESSNORMALIZER_H
@@ -67,6 +67,8 @@ public:
         return m_format;
     }
 
+    //! NOTE Can be called repeatedly with consecutive blocks of interleaved samples,
+    //! flush() completes the stream
     virtual size_t encode(samples_t samplesPerChannel, const float* input) = 0;
     virtual size_t flush() = 0;
 
@@ -71,7 +71,7 @@ bool FlacEncoder::init(const io::path_t& path, const SoundTrackFormat& format, c
         || !m_flac->set_channels(m_format.audioChannelsNumber)
         || !m_flac->set_sample_rate(m_format.sampleRate)
         || !m_flac->set_bits_per_sample(16)
-        || !m_flac->set_total_samples_estimate(totalSamplesNumber)) {
+        || !m_flac->set_total_samples_estimate(totalSamplesNumber / m_format.audioChannelsNumber)) {
         return false;
     }
 
@@ -102,30 +102,23 @@ size_t FlacEncoder::encode(samples_t samplesPerChannel, const float* input)
         return 0;
     }
 
-    size_t result = 0;
     size_t totalSamplesNumber = samplesPerChannel * m_format.audioChannelsNumber;
-    uint32_t frameSize = 1024;
-    size_t stepSize = frameSize * m_format.audioChannelsNumber;
 
-    std::vector<FLAC__int32> buff(samplesPerChannel * sizeof(float));
-
-    for (size_t i = 0; i < buff.size(); ++i) {
-        buff[i] = static_cast<FLAC__int32>(dsp::convertFloatSamples<FLAC__int16>(input[i]));
+    //! NOTE The buffer only grows, so nothing is allocated per block
+    if (m_convertedBuffer.size() < totalSamplesNumber) {
+        m_convertedBuffer.resize(totalSamplesNumber);
     }
 
-    std::vector<FLAC__int32> intermBuff(stepSize);
-
-    for (size_t i = 0; i < totalSamplesNumber; i += stepSize) {
-        std::copy(buff.data() + i, buff.data() + i + stepSize, intermBuff.data());
+    for (size_t i = 0; i < totalSamplesNumber; ++i) {
+        m_convertedBuffer[i] = static_cast<FLAC__int32>(dsp::convertFloatSamples<FLAC__int16>(input[i]));
+    }
 
-        if (m_flac->process_interleaved(intermBuff.data(), frameSize)) {
-            result += stepSize;
-        } else {
-            break;
-        }
+    //! NOTE libFLAC splits the input into frames itself and keeps the remainder for the next call
+    if (!m_flac->process_interleaved(m_convertedBuffer.data(), static_cast<uint32_t>(samplesPerChannel))) {
+        return 0;
     }
 
-    return result;
+    return totalSamplesNumber;
 }
 
 size_t FlacEncoder::flush()
@@ -23,6 +23,9 @@
 #ifndef MUSE_AUDIO_FLACENCODER_H
 #define MUSE_AUDIO_FLACENCODER_H
 
+#include <cstdint>
+#include <vector>
+
 #include "abstractaudioencoder.h"
 
 struct FlacHandler;
@@ -43,6 +46,7 @@ protected:
 
 private:
     FlacHandler* m_flac = nullptr;
+    std::vector<int32_t> m_convertedBuffer;
 };
 }
 
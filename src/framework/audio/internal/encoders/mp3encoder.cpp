@@ -83,8 +83,9 @@ bool Mp3Encoder::init(const io::path_t& path, const SoundTrackFormat& format, co
 size_t Mp3Encoder::requiredOutputBufferSize(samples_t totalSamplesNumber) const
 {
     //!Note See thirdparty/lame/API
+    //!     The worst case for a single encode() call, which never gets more than the total number of samples
 
-    return totalSamplesNumber;
+    return totalSamplesNumber * 5 / 4 + 7200;
 }
 
 size_t Mp3Encoder::encode(samples_t samplesPerChannel, const float* input)
@@ -95,6 +96,11 @@ size_t Mp3Encoder::encode(samples_t samplesPerChannel, const float* input)
                                                                  m_outputBuffer.data(),
                                                                  static_cast<int>(m_outputBuffer.size()));
 
+    if (encodedBytes < 0) {
+        LOGE() << "Unable to encode mp3, error: " << encodedBytes;
+        return 0;
+    }
+
     m_progress.progressChanged.send(50, 100, "");
     size_t result = std::fwrite(m_outputBuffer.data(), sizeof(unsigned char), encodedBytes, m_fileStream);
     m_progress.progressChanged.send(100, 100, "");
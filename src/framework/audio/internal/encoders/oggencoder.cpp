@@ -36,7 +36,7 @@ using namespace muse::audio::encode;
 size_t OggEncoder::encode(samples_t samplesPerChannel, const float* input)
 {
     m_progress.progressChanged.send(0, 100, "");
-    int code = ope_encoder_write_float(m_opusEncoder, input, samplesPerChannel + m_format.sampleRate * 2);
+    int code = ope_encoder_write_float(m_opusEncoder, input, samplesPerChannel);
     m_progress.progressChanged.send(100, 100, "");
 
     return code == OPE_OK ? samplesPerChannel : 0;
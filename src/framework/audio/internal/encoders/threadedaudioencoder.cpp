@@ -0,0 +1,153 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2024 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "threadedaudioencoder.h"
+
+#include <algorithm>
+
+#include "log.h"
+
+using namespace muse::audio;
+using namespace muse::audio::encode;
+
+ThreadedAudioEncoder::ThreadedAudioEncoder(AbstractAudioEncoderPtr encoder, size_t queueCapacity)
+    : m_encoder(std::move(encoder))
+{
+    IF_ASSERT_FAILED(m_encoder && queueCapacity > 0) {
+        return;
+    }
+
+    const SoundTrackFormat& format = m_encoder->format();
+
+    m_blocks.resize(queueCapacity);
+    for (Block& block : m_blocks) {
+        block.samples.resize(format.samplesPerChannel * format.audioChannelsNumber);
+    }
+}
+
+ThreadedAudioEncoder::~ThreadedAudioEncoder()
+{
+    if (m_thread.joinable()) {
+        abort();
+        finish();
+    }
+}
+
+AbstractAudioEncoder* ThreadedAudioEncoder::encoder() const
+{
+    return m_encoder.get();
+}
+
+void ThreadedAudioEncoder::start()
+{
+    IF_ASSERT_FAILED(!m_thread.joinable() && !m_blocks.empty()) {
+        return;
+    }
+
+    m_readIndex = 0;
+    m_writeIndex = 0;
+    m_queuedCount = 0;
+    m_isFinishing = false;
+    m_isEncodingBlock = false;
+    m_encodedBytes = 0;
+
+    m_thread = std::thread(&ThreadedAudioEncoder::th_encodeLoop, this);
+}
+
+void ThreadedAudioEncoder::push(samples_t samplesPerChannel, const float* input)
+{
+    std::unique_lock lock(m_mutex);
+    m_blockReleased.wait(lock, [this] { return m_queuedCount < m_blocks.size(); });
+
+    Block& block = m_blocks[m_writeIndex];
+
+    //! NOTE The blocks are preallocated for the render step of the format
+    const size_t samplesCount = std::min(static_cast<size_t>(samplesPerChannel * m_encoder->format().audioChannelsNumber),
+                                         block.samples.size());
+    std::copy_n(input, samplesCount, block.samples.data());
+    block.samplesPerChannel = static_cast<samples_t>(samplesCount / m_encoder->format().audioChannelsNumber);
+
+    m_writeIndex = (m_writeIndex + 1) % m_blocks.size();
+    ++m_queuedCount;
+
+    lock.unlock();
+    m_blockQueued.notify_one();
+}
+
+void ThreadedAudioEncoder::abort()
+{
+    {
+        std::lock_guard lock(m_mutex);
+
+        //! NOTE The block which is being encoded can't be dropped
+        m_queuedCount = m_isEncodingBlock ? 1 : 0;
+        m_writeIndex = (m_readIndex + m_queuedCount) % m_blocks.size();
+    }
+
+    m_blockReleased.notify_all();
+}
+
+size_t ThreadedAudioEncoder::finish()
+{
+    if (!m_thread.joinable()) {
+        return 0;
+    }
+
+    {
+        std::lock_guard lock(m_mutex);
+        m_isFinishing = true;
+    }
+
+    m_blockQueued.notify_one();
+    m_thread.join();
+
+    m_encodedBytes += m_encoder->flush();
+
+    return m_encodedBytes;
+}
+
+void ThreadedAudioEncoder::th_encodeLoop()
+{
+    while (true) {
+        std::unique_lock lock(m_mutex);
+        m_blockQueued.wait(lock, [this] { return m_queuedCount > 0 || m_isFinishing; });
+
+        if (m_queuedCount == 0) {
+            return;
+        }
+
+        //! NOTE The block stays queued while it is encoded, so the render thread doesn't overwrite it
+        size_t index = m_readIndex;
+        m_isEncodingBlock = true;
+        lock.unlock();
+
+        const Block& block = m_blocks[index];
+        m_encodedBytes += m_encoder->encode(block.samplesPerChannel, block.samples.data());
+
+        lock.lock();
+        m_readIndex = (index + 1) % m_blocks.size();
+        --m_queuedCount;
+        m_isEncodingBlock = false;
+        lock.unlock();
+
+        m_blockReleased.notify_one();
+    }
+}
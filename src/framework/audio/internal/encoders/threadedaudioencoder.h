@@ -0,0 +1,82 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2024 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef MUSE_AUDIO_THREADEDAUDIOENCODER_H
+#define MUSE_AUDIO_THREADEDAUDIOENCODER_H
+
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "abstractaudioencoder.h"
+
+namespace muse::audio::encode {
+//! Runs an encoder on its own thread. Rendered blocks are copied into a bounded queue
+//! of preallocated blocks, so several encoders can consume the output of a single render
+class ThreadedAudioEncoder
+{
+public:
+    ThreadedAudioEncoder(AbstractAudioEncoderPtr encoder, size_t queueCapacity);
+    ~ThreadedAudioEncoder();
+
+    AbstractAudioEncoder* encoder() const;
+
+    void start();
+
+    //! NOTE Waits while the queue is full
+    void push(samples_t samplesPerChannel, const float* input);
+
+    //! Drops the blocks which are not encoded yet
+    void abort();
+
+    //! Waits until the queued blocks are encoded, flushes the encoder and returns the encoded bytes count
+    size_t finish();
+
+private:
+    struct Block {
+        std::vector<float> samples;
+        samples_t samplesPerChannel = 0;
+    };
+
+    void th_encodeLoop();
+
+    AbstractAudioEncoderPtr m_encoder = nullptr;
+
+    std::vector<Block> m_blocks;
+    size_t m_readIndex = 0;
+    size_t m_writeIndex = 0;
+    size_t m_queuedCount = 0;
+    bool m_isFinishing = false;
+    bool m_isEncodingBlock = false;
+
+    std::mutex m_mutex;
+    std::condition_variable m_blockQueued;
+    std::condition_variable m_blockReleased;
+
+    std::thread m_thread;
+    size_t m_encodedBytes = 0;
+};
+
+using ThreadedAudioEncoderPtr = std::unique_ptr<ThreadedAudioEncoder>;
+}
+
+#endif // MUSE_AUDIO_THREADEDAUDIOENCODER_H
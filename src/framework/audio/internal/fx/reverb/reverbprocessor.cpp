@@ -22,6 +22,7 @@
 
 #include "reverbprocessor.h"
 
+#include <algorithm>
 #include <cassert>
 #include <cmath>
 #include <complex>
@@ -42,6 +43,18 @@ float fromDecibel(float dB)
     return std::pow(10.f, dB / 20.f);
 }
 
+// -120 dB
+static constexpr float SILENCE_THRESHOLD = 1e-6f;
+
+static float peakLevel(const float* buffer, size_t count)
+{
+    float peak = 0.f;
+    for (size_t i = 0; i < count; ++i) {
+        peak = std::max(peak, std::abs(buffer[i]));
+    }
+    return peak;
+}
+
 class SamplesFloat
 {
 public:
@@ -54,6 +67,10 @@ public:
 
     void setSize(int32_t numChannels, int32_t samples)
     {
+        if (numChannels == num_channels && samples == num_samples) {
+            return;
+        }
+
         for (int ch = 0; ch < num_channels; ch++) {
             dealloc(ch);
         }
@@ -336,6 +353,23 @@ void ReverbProcessor::process(float* buffer, unsigned int sampleCount)
         setFormat(m_processor._audioChannelsCount, m_processor._sampleRate, sampleCount);
     }
 
+    const size_t bufferSize = static_cast<size_t>(sampleCount) * m_processor._audioChannelsCount;
+
+    //! NOTE The feedback network keeps running on a silent track. Once the input has been silent
+    //! for longer than the pre-delay, and the output has stayed below -120 dB for a second,
+    //! the tail is over and the (silent) block is left as it is
+    if (peakLevel(buffer, bufferSize) < SILENCE_THRESHOLD) {
+        m_silentInputSamples += sampleCount;
+    } else {
+        m_silentInputSamples = 0;
+    }
+
+    const int64_t tailMargin = static_cast<int64_t>(m_processor._sampleRate);
+    const int64_t preDelay = static_cast<int64_t>(getParameter(PreDelayMs) * 0.001 * m_processor._sampleRate);
+    if (m_silentInputSamples > preDelay + tailMargin && m_quietOutputSamples >= tailMargin) {
+        return;
+    }
+
     for (samples_t sampleIndex = 0; sampleIndex < sampleCount; ++sampleIndex) {
         size_t offset = sampleIndex * m_processor._audioChannelsCount;
 
@@ -362,6 +396,12 @@ void ReverbProcessor::process(float* buffer, unsigned int sampleCount)
             buffer[offset + audioChannelIndex] = m_signalBuffers[audioChannelIndex][sampleIndex];
         }
     }
+
+    if (peakLevel(buffer, bufferSize) < SILENCE_THRESHOLD) {
+        m_quietOutputSamples += sampleCount;
+    } else {
+        m_quietOutputSamples = 0;
+    }
 }
 
 void ReverbProcessor::getParameterInfo(int32_t index, ParameterInfo& info)
@@ -144,6 +144,9 @@ private:
     async::Channel<audio::AudioFxParams> m_paramsChanged;
 
     float** m_signalBuffers = nullptr;
+
+    int64_t m_silentInputSamples = 0;
+    int64_t m_quietOutputSamples = 0;
 };
 }
 
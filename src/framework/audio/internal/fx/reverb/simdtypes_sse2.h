@@ -134,6 +134,26 @@ __finl float_x4 __vecc operator*(float_x4 a, float_x4 b)
 {
     return _mm_mul_ps(a.s, b.s);
 }
+
+__finl float_x4 __vecc abs(float_x4 a)
+{
+    return _mm_andnot_ps(_mm_set1_ps(-0.f), a.s);
+}
+
+__finl float_x4 __vecc max(float_x4 a, float_x4 b)
+{
+    return _mm_max_ps(a.s, b.s);
+}
+
+__finl float_x4 load_unaligned(const float* src)
+{
+    return _mm_loadu_ps(src);
+}
+
+__finl void __vecc store_unaligned(float* dst, float_x4 a)
+{
+    _mm_storeu_ps(dst, a.s);
+}
 } // namespace muse::audio::fx
 
 #endif // MUSE_AUDIO_SIMDTYPES_SSE2_H
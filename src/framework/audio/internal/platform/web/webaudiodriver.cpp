@@ -35,6 +35,7 @@ using let = emscripten::val;
 static val context = val::global();
 static IAudioDriver::Spec* format = nullptr;
 static std::vector<float> buffer;
+static std::vector<float> channelBuffer;
 
 void audioCallback(emscripten::val event)
 {
@@ -52,11 +53,19 @@ void audioCallback(emscripten::val event)
     }
     format->callback(nullptr, reinterpret_cast<uint8_t*>(buffer.data()), bytes);
 
+    if (channelBuffer.size() != length) {
+        channelBuffer.resize(length);
+    }
+
+    //! NOTE Every access to a JS object is a call across the WASM boundary,
+    //! so each channel is deinterleaved here and copied to its JS array at once
     for (int j = 0; j < channels; ++j) {
-        let channelData = sampleBuffer.call<val>("getChannelData", j);
         for (int i = 0; i < length; ++i) {
-            channelData.set(i, buffer[i * channels + j]);
+            channelBuffer[i] = buffer[i * channels + j];
         }
+
+        let channelData = sampleBuffer.call<val>("getChannelData", j);
+        channelData.call<void>("set", val(typed_memory_view(channelBuffer.size(), channelBuffer.data())));
     }
 }
 
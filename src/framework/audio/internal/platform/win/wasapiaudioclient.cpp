@@ -22,6 +22,8 @@
 
 #include "wasapiaudioclient.h"
 
+#include <algorithm>
+
 #include "log.h"
 
 using namespace winrt;
@@ -173,7 +175,7 @@ HRESULT WasapiAudioClient::ActivateCompleted(IActivateAudioInterfaceAsyncOperati
                                                     nullptr));
         } else {
             check_hresult(m_audioClient->InitializeSharedAudioStream(AUDCLNT_STREAMFLAGS_EVENTCALLBACK,
-                                                                     m_minPeriodInFrames,
+                                                                     lowLatencyPeriodInFrames(),
                                                                      m_mixFormat.get(),
                                                                      nullptr));
         }
@@ -186,6 +188,9 @@ HRESULT WasapiAudioClient::ActivateCompleted(IActivateAudioInterfaceAsyncOperati
         LOGI() << "Fundamental period in frames: " << m_fundamentalPeriodInFrames;
         LOGI() << "Max period in frames: " << m_maxPeriodInFrames;
         LOGI() << "Min period in frames: " << m_minPeriodInFrames;
+        if (m_isLowLatency) {
+            LOGI() << "Low latency period in frames: " << lowLatencyPeriodInFrames();
+        }
 
         // Get the maximum size of the AudioClient Buffer
         check_hresult(m_audioClient->GetBufferSize(&m_bufferFrames));
@@ -235,7 +240,7 @@ UINT32 WasapiAudioClient::getBufferFramesPerPeriod() noexcept
     }
 
     if (m_isLowLatency) {
-        return m_minPeriodInFrames;
+        return lowLatencyPeriodInFrames();
     }
 
     // Get the audio device period
@@ -337,6 +342,24 @@ HRESULT WasapiAudioClient::configureDeviceInternal() noexcept
     }
 }
 
+//
+//  LowLatencyPeriodInFrames()
+//
+//  The engine period closest to the requested buffer duration, that the device supports
+//  (a multiple of the fundamental period, within the min/max period)
+//
+uint32_t WasapiAudioClient::lowLatencyPeriodInFrames() const
+{
+    if (!m_mixFormat.get() || m_fundamentalPeriodInFrames == 0 || m_hnsBufferDuration <= 0) {
+        return m_minPeriodInFrames;
+    }
+
+    const double requestedFrames = m_hnsBufferDuration / (10000.0 * 1000.0) * m_mixFormat->nSamplesPerSec;
+    uint32_t period = static_cast<uint32_t>(requestedFrames / m_fundamentalPeriodInFrames + 0.5) * m_fundamentalPeriodInFrames;
+
+    return std::clamp(period, m_minPeriodInFrames, std::max(m_minPeriodInFrames, m_maxPeriodInFrames));
+}
+
 //
 //  ValidateBufferValue()
 //
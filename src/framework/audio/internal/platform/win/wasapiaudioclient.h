@@ -64,6 +64,7 @@ private:
 
     HRESULT configureDeviceInternal() noexcept;
     void validateBufferValue();
+    uint32_t lowLatencyPeriodInFrames() const;
     void onAudioSampleRequested(bool IsSilence = false);
     UINT32 getBufferFramesPerPeriod() noexcept;
 
@@ -84,10 +85,10 @@ private:
     mutable slim_mutex m_lock;
 
     mutable unique_cotaskmem_ptr<WAVEFORMATEX> m_mixFormat;
-    uint32_t m_defaultPeriodInFrames;
-    uint32_t m_fundamentalPeriodInFrames;
-    uint32_t m_maxPeriodInFrames;
-    uint32_t m_minPeriodInFrames;
+    uint32_t m_defaultPeriodInFrames = 0;
+    uint32_t m_fundamentalPeriodInFrames = 0;
+    uint32_t m_maxPeriodInFrames = 0;
+    uint32_t m_minPeriodInFrames = 0;
 
     com_ptr<IAudioClient3> m_audioClient;
     com_ptr<IAudioRenderClient> m_audioRenderClient;
@@ -21,6 +21,9 @@
  */
 #include "soundfontrepository.h"
 
+#include <future>
+
+#include "global/containers.h"
 #include "global/translation.h"
 
 #include "synthesizers/fluidsynth/fluidsoundfontparser.h"
@@ -52,6 +55,7 @@ void SoundFontRepository::loadSoundFonts()
     static const std::vector<std::string> filters = { "*.sf2",  "*.sf3" };
     io::paths_t dirs = configuration()->soundFontDirectories();
 
+    SoundFontPaths paths;
     for (const io::path_t& dir : dirs) {
         RetVal<io::paths_t> soundFonts = fileSystem()->scanFiles(dir, filters);
         if (!soundFonts.ret) {
@@ -59,24 +63,41 @@ void SoundFontRepository::loadSoundFonts()
             continue;
         }
 
-        for (const SoundFontPath& soundFont : soundFonts.val) {
-            loadSoundFont(soundFont, oldSoundFonts);
+        paths.insert(paths.end(), soundFonts.val.begin(), soundFonts.val.end());
+    }
+
+    //! NOTE Parsing reads the presets of each file from disk, and the files are independent,
+    //! so the new ones are parsed concurrently. The results are added in the scan order
+    std::vector<std::future<RetVal<SoundFontMeta> > > parsed(paths.size());
+    for (size_t i = 0; i < paths.size(); ++i) {
+        if (!muse::contains(oldSoundFonts, paths.at(i))) {
+            parsed[i] = std::async(std::launch::async, [path = paths.at(i)]() {
+                return FluidSoundFontParser::parseSoundFont(path);
+            });
         }
     }
-}
 
-void SoundFontRepository::loadSoundFont(const SoundFontPath& path, const SoundFontsMap& oldSoundFonts)
-{
-    m_soundFontPaths.push_back(path);
+    for (size_t i = 0; i < paths.size(); ++i) {
+        const SoundFontPath& path = paths.at(i);
+        m_soundFontPaths.push_back(path);
 
-    auto it = oldSoundFonts.find(path);
-    if (it != oldSoundFonts.cend()) {
-        m_soundFonts.insert(*it);
-        return;
+        if (!parsed[i].valid()) {
+            m_soundFonts.insert(*oldSoundFonts.find(path));
+            continue;
+        }
+
+        addSoundFontMeta(path, parsed[i].get());
     }
+}
 
-    RetVal<SoundFontMeta> meta = FluidSoundFontParser::parseSoundFont(path);
+void SoundFontRepository::loadSoundFont(const SoundFontPath& path)
+{
+    m_soundFontPaths.push_back(path);
+    addSoundFontMeta(path, FluidSoundFontParser::parseSoundFont(path));
+}
 
+void SoundFontRepository::addSoundFontMeta(const SoundFontPath& path, RetVal<SoundFontMeta> meta)
+{
     if (!meta.ret) {
         LOGE() << "Failed parse SoundFont presets for " << path << ": " << meta.ret.toString();
         return;
@@ -51,7 +51,8 @@ public:
 
 private:
     void loadSoundFonts();
-    void loadSoundFont(const synth::SoundFontPath& path, const synth::SoundFontsMap& oldSoundFonts = {});
+    void loadSoundFont(const synth::SoundFontPath& path);
+    void addSoundFontMeta(const synth::SoundFontPath& path, RetVal<synth::SoundFontMeta> meta);
 
     RetVal<synth::SoundFontPath> resolveInstallationPath(const synth::SoundFontPath& path) const;
 
@@ -38,8 +38,8 @@ using namespace muse;
 using namespace muse::audio;
 using namespace muse::audio::soundtrack;
 
-static constexpr int PREPARE_STEP = 0;
-static constexpr int ENCODE_STEP = 1;
+//! NOTE Enough blocks to let the slowest encoder lag behind the render for a while
+static constexpr size_t ENCODER_QUEUE_CAPACITY = 16;
 
 static encode::AbstractAudioEncoderPtr createEncoder(const SoundTrackType type)
 {
@@ -55,30 +55,63 @@ static encode::AbstractAudioEncoderPtr createEncoder(const SoundTrackType type)
     return nullptr;
 }
 
-SoundTrackWriter::SoundTrackWriter(const io::path_t& destination, const SoundTrackFormat& format,
+static bool canShareRender(const SoundTrackFormat& format, const SoundTrackFormat& renderFormat)
+{
+    return format.sampleRate == renderFormat.sampleRate
+           && format.audioChannelsNumber == renderFormat.audioChannelsNumber
+           && format.samplesPerChannel == renderFormat.samplesPerChannel
+           && format.targetLoudness == renderFormat.targetLoudness;
+}
+
+SoundTrackWriter::SoundTrackWriter(const SoundTrackDestinationList& destinations,
                                    const msecs_t totalDuration, IAudioSourcePtr source,
                                    const modularity::ContextPtr& iocCtx)
     : muse::Injectable(iocCtx), m_source(std::move(source))
 {
-    if (!m_source) {
+    if (!m_source || destinations.empty()) {
         return;
     }
 
-    samples_t totalSamplesNumber = (totalDuration / 1000000.f) * sizeof(float) * format.sampleRate;
-    m_inputBuffer.resize(totalSamplesNumber);
-    m_intermBuffer.resize(format.samplesPerChannel * format.audioChannelsNumber);
-    m_renderStep = format.samplesPerChannel;
+    m_renderFormat = destinations.front().format;
+
+    for (const SoundTrackDestination& destination : destinations) {
+        IF_ASSERT_FAILED(canShareRender(destination.format, m_renderFormat)) {
+            LOGE() << "Unable to render " << destination.path << " together with the other sound tracks";
+            return;
+        }
+    }
+
+    m_samplesPerChannelToRender = (totalDuration / 1000000.f) * m_renderFormat.sampleRate;
+    m_renderBuffer.resize(m_renderFormat.samplesPerChannel * m_renderFormat.audioChannelsNumber);
+    m_renderStep = m_renderFormat.samplesPerChannel;
+
+    if (m_renderFormat.targetLoudness.has_value()) {
+        m_loudnessNormalizer = std::make_unique<dsp::LoudnessNormalizer>(m_renderFormat.sampleRate, m_renderFormat.audioChannelsNumber,
+                                                                         m_renderFormat.targetLoudness.value());
+        m_normalizedBuffer.resize(m_renderBuffer.size());
+    }
+
+    const samples_t totalSamplesNumber = m_samplesPerChannelToRender * m_renderFormat.audioChannelsNumber;
+
+    if (destinations.size() == 1) {
+        m_encoderPtr = createEncoder(m_renderFormat.type);
 
-    m_encoderPtr = createEncoder(format.type);
+        if (m_encoderPtr) {
+            m_encoderPtr->init(destinations.front().path, m_renderFormat, totalSamplesNumber);
+        }
 
-    if (!m_encoderPtr) {
         return;
     }
 
-    m_encoderPtr->init(destination, format, totalSamplesNumber);
-    m_encoderPtr->progress().progressChanged.onReceive(this, [this](int64_t current, int64_t total, std::string) {
-        sendStepProgress(ENCODE_STEP, current, total);
-    });
+    for (const SoundTrackDestination& destination : destinations) {
+        encode::AbstractAudioEncoderPtr encoder = createEncoder(destination.format.type);
+        if (!encoder) {
+            continue;
+        }
+
+        encoder->init(destination.path, destination.format, totalSamplesNumber);
+        m_threadedEncoders.push_back(std::make_unique<encode::ThreadedAudioEncoder>(std::move(encoder), ENCODER_QUEUE_CAPACITY));
+    }
 }
 
 SoundTrackWriter::~SoundTrackWriter()
@@ -86,24 +119,31 @@ SoundTrackWriter::~SoundTrackWriter()
     if (m_encoderPtr) {
         m_encoderPtr->deinit();
     }
+
+    for (const encode::ThreadedAudioEncoderPtr& encoder : m_threadedEncoders) {
+        encoder->finish();
+        encoder->encoder()->deinit();
+    }
 }
 
 Ret SoundTrackWriter::write()
 {
     TRACEFUNC;
 
-    if (!m_source || !m_encoderPtr) {
+    if (!m_source || (!m_encoderPtr && m_threadedEncoders.empty())) {
         return false;
     }
 
     audioEngine()->setMode(RenderMode::OfflineMode);
 
-    m_source->setSampleRate(m_encoderPtr->format().sampleRate);
+    m_source->setSampleRate(m_renderFormat.sampleRate);
     m_source->setIsActive(true);
 
-    DEFER {
-        m_encoderPtr->flush();
+    for (const encode::ThreadedAudioEncoderPtr& encoder : m_threadedEncoders) {
+        encoder->start();
+    }
 
+    DEFER {
         audioEngine()->setMode(RenderMode::IdleMode);
 
         m_source->setSampleRate(audioEngine()->sampleRate());
@@ -112,22 +152,16 @@ Ret SoundTrackWriter::write()
         m_isAborted = false;
     };
 
-    Ret ret = generateAudioData();
-    if (!ret) {
-        return ret;
-    }
-
-    size_t bytes = m_encoderPtr->encode(m_inputBuffer.size() / sizeof(float), m_inputBuffer.data());
+    size_t encodedBytes = 0;
+    Ret ret = renderAndEncode(encodedBytes);
 
-    if (m_isAborted) {
-        return make_ret(Ret::Code::Cancel);
-    }
+    Ret finishRet = finishEncoding(encodedBytes);
 
-    if (bytes == 0) {
-        return make_ret(Err::ErrorEncode);
+    if (!ret) {
+        return ret;
     }
 
-    return muse::make_ok();
+    return finishRet;
 }
 
 void SoundTrackWriter::abort()
@@ -140,44 +174,102 @@ Progress SoundTrackWriter::progress()
     return m_progress;
 }
 
-Ret SoundTrackWriter::generateAudioData()
+Ret SoundTrackWriter::renderAndEncode(size_t& encodedBytes)
 {
     TRACEFUNC;
 
-    const size_t inputBufferMaxOffset = m_inputBuffer.size();
-    size_t inputBufferOffset = 0;
+    if (m_samplesPerChannelToRender == 0) {
+        LOGI() << "No audio to export";
+        return make_ret(Err::NoAudioToExport);
+    }
 
-    sendStepProgress(PREPARE_STEP, inputBufferOffset, inputBufferMaxOffset);
+    //! NOTE Every block is handed to the encoder as soon as it is rendered,
+    //! so memory use doesn't depend on the duration and encoding overlaps with rendering
+    samples_t renderedSamplesPerChannel = 0;
+    sendProgress(renderedSamplesPerChannel);
 
-    while (inputBufferOffset < inputBufferMaxOffset && !m_isAborted) {
-        m_source->process(m_intermBuffer.data(), m_renderStep);
+    while (renderedSamplesPerChannel < m_samplesPerChannelToRender && !m_isAborted) {
+        m_source->process(m_renderBuffer.data(), m_renderStep);
 
-        size_t samplesToCopy = std::min(m_intermBuffer.size(), inputBufferMaxOffset - inputBufferOffset);
+        samples_t samplesToEncode = std::min(m_renderStep, m_samplesPerChannelToRender - renderedSamplesPerChannel);
 
-        std::copy(m_intermBuffer.begin(),
-                  m_intermBuffer.begin() + samplesToCopy,
-                  m_inputBuffer.begin() + inputBufferOffset);
+        if (m_loudnessNormalizer) {
+            samples_t normalizedSamples = m_loudnessNormalizer->process(m_renderBuffer.data(), m_normalizedBuffer.data(),
+                                                                        samplesToEncode);
+            encodeSamples(normalizedSamples, m_normalizedBuffer.data(), encodedBytes);
+        } else {
+            encodeSamples(samplesToEncode, m_renderBuffer.data(), encodedBytes);
+        }
 
-        inputBufferOffset += samplesToCopy;
-        sendStepProgress(PREPARE_STEP, inputBufferOffset, inputBufferMaxOffset);
+        renderedSamplesPerChannel += samplesToEncode;
+        sendProgress(renderedSamplesPerChannel);
     }
 
     if (m_isAborted) {
         return make_ret(Ret::Code::Cancel);
     }
 
-    if (inputBufferOffset == 0) {
-        LOGI() << "No audio to export";
-        return make_ret(Err::NoAudioToExport);
-    }
+    encodeNormalizationTail(encodedBytes);
 
     return muse::make_ok();
 }
 
-void SoundTrackWriter::sendStepProgress(int step, int64_t current, int64_t total)
+void SoundTrackWriter::encodeSamples(samples_t samplesPerChannel, const float* buffer, size_t& encodedBytes)
+{
+    if (samplesPerChannel == 0) {
+        return;
+    }
+
+    if (m_encoderPtr) {
+        encodedBytes += m_encoderPtr->encode(samplesPerChannel, buffer);
+        return;
+    }
+
+    for (const encode::ThreadedAudioEncoderPtr& encoder : m_threadedEncoders) {
+        encoder->push(samplesPerChannel, buffer);
+    }
+}
+
+void SoundTrackWriter::encodeNormalizationTail(size_t& encodedBytes)
+{
+    if (!m_loudnessNormalizer) {
+        return;
+    }
+
+    //! NOTE The last seconds are still in the delay of the normalizer
+    samples_t normalizedSamples = 0;
+
+    do {
+        normalizedSamples = m_loudnessNormalizer->flush(m_normalizedBuffer.data(), m_renderStep);
+        encodeSamples(normalizedSamples, m_normalizedBuffer.data(), encodedBytes);
+    } while (normalizedSamples > 0);
+}
+
+Ret SoundTrackWriter::finishEncoding(size_t encodedBytes)
+{
+    if (m_encoderPtr) {
+        encodedBytes += m_encoderPtr->flush();
+
+        return encodedBytes == 0 ? make_ret(Err::ErrorEncode) : muse::make_ok();
+    }
+
+    Ret ret = muse::make_ok();
+
+    for (const encode::ThreadedAudioEncoderPtr& encoder : m_threadedEncoders) {
+        if (m_isAborted) {
+            encoder->abort();
+        }
+
+        if (encoder->finish() == 0) {
+            ret = make_ret(Err::ErrorEncode);
+        }
+    }
+
+    return ret;
+}
+
+void SoundTrackWriter::sendProgress(samples_t renderedSamplesPerChannel)
 {
-    int stepRange = step == PREPARE_STEP ? 80 : 20;
-    int stepProgressStart = step == PREPARE_STEP ? 0 : 80;
-    int stepCurrentProgress = stepProgressStart + ((current * 100 / total) * stepRange) / 100;
-    m_progress.progressChanged.send(stepCurrentProgress, 100, "");
+    int64_t current = static_cast<int64_t>(renderedSamplesPerChannel) * 100 / m_samplesPerChannelToRender;
+    m_progress.progressChanged.send(current, 100, "");
 }
@@ -32,6 +32,8 @@
 #include "iaudiosource.h"
 #include "../worker/iaudioengine.h"
 #include "../encoders/abstractaudioencoder.h"
+#include "../encoders/threadedaudioencoder.h"
+#include "../dsp/loudnessnormalizer.h"
 
 namespace muse::audio::soundtrack {
 class SoundTrackWriter : public muse::Injectable, public async::Asyncable
@@ -39,7 +41,7 @@ class SoundTrackWriter : public muse::Injectable, public async::Asyncable
     muse::Inject<IAudioEngine> audioEngine = { this };
 
 public:
-    SoundTrackWriter(const io::path_t& destination, const SoundTrackFormat& format, const msecs_t totalDuration, IAudioSourcePtr source,
+    SoundTrackWriter(const SoundTrackDestinationList& destinations, const msecs_t totalDuration, IAudioSourcePtr source,
                      const muse::modularity::ContextPtr& iocCtx);
     ~SoundTrackWriter() override;
 
@@ -49,17 +51,29 @@ public:
     Progress progress();
 
 private:
-    Ret generateAudioData();
+    Ret renderAndEncode(size_t& encodedBytes);
+    void encodeSamples(samples_t samplesPerChannel, const float* buffer, size_t& encodedBytes);
+    void encodeNormalizationTail(size_t& encodedBytes);
+    Ret finishEncoding(size_t encodedBytes);
 
-    void sendStepProgress(int step, int64_t current, int64_t total);
+    void sendProgress(samples_t renderedSamplesPerChannel);
 
     IAudioSourcePtr m_source = nullptr;
 
-    std::vector<float> m_inputBuffer;
-    std::vector<float> m_intermBuffer;
+    std::vector<float> m_renderBuffer;
     samples_t m_renderStep = 0;
+    samples_t m_samplesPerChannelToRender = 0;
 
+    SoundTrackFormat m_renderFormat;
+
+    //! NOTE Delays the rendered blocks by a few seconds, see LoudnessNormalizer
+    dsp::LoudnessNormalizerPtr m_loudnessNormalizer = nullptr;
+    std::vector<float> m_normalizedBuffer;
+
+    //! NOTE A single encoder runs inline, several ones run on their own threads
+    //! and share the rendered blocks, so the score is rendered only once
     encode::AbstractAudioEncoderPtr m_encoderPtr = nullptr;
+    std::vector<encode::ThreadedAudioEncoderPtr> m_threadedEncoders;
 
     Progress m_progress;
     std::atomic<bool> m_isAborted = false;
@@ -79,11 +79,9 @@ void FluidSequencer::updateMainStreamEvents(const mpe::PlaybackEventsMap& events
     }
 
     updatePlaybackEvents(m_mainStreamEvents, events);
-    updateMainSequenceIterator();
 
     if (m_useDynamicEvents) {
         updateDynamicEvents(m_dynamicEvents, dynamics);
-        updateDynamicChangesIterator();
     }
 }
 
@@ -28,6 +28,8 @@
 #include "audioerrors.h"
 #include "audiotypes.h"
 
+#include "concurrency/taskscheduler.h"
+
 #include "log.h"
 
 using namespace muse;
@@ -46,6 +48,13 @@ static constexpr msecs_t MIN_NOTE_LENGTH = 10;
 static constexpr unsigned int FLUID_AUDIO_CHANNELS_PAIR = 1;
 static constexpr unsigned int FLUID_AUDIO_CHANNELS_COUNT = FLUID_AUDIO_CHANNELS_PAIR * 2;
 
+//! NOTE Shared by all the Fluid instances, so the sound font reads don't compete for the disk
+static TaskScheduler& readAheadScheduler()
+{
+    static TaskScheduler s_scheduler(1);
+    return s_scheduler;
+}
+
 struct muse::audio::synth::Fluid {
     fluid_settings_t* settings = nullptr;
     fluid_synth_t* synth = nullptr;
@@ -167,6 +176,11 @@ bool FluidSynth::handleEvent(const midi::Event& event)
     int ret = FLUID_OK;
     switch (event.opcode()) {
     case Event::Opcode::NoteOn: {
+        if (m_pendingPrograms.find(event.channel()) != m_pendingPrograms.end()) {
+            //! NOTE The samples of this channel are still being read, skip the note rather than play it with the wrong preset
+            break;
+        }
+
         ret = fluid_synth_noteon(m_fluid->synth, event.channel(), event.note(), event.velocity());
         m_tuning.add(event.note(), event.pitchTuningCents());
     } break;
@@ -182,6 +196,7 @@ bool FluidSynth::handleEvent(const midi::Event& event)
         }
     } break;
     case Event::Opcode::ProgramChange: {
+        m_pendingPrograms.erase(event.channel());
         fluid_synth_program_change(m_fluid->synth, event.channel(), event.program());
     } break;
     case Event::Opcode::PitchBend: {
@@ -213,6 +228,8 @@ void FluidSynth::setSampleRate(unsigned int sampleRate)
         delete_fluid_synth(m_fluid->synth);
     }
 
+    m_pendingPrograms.clear();
+
     createFluidInstance();
     addSoundFonts(std::vector<io::path_t>(m_sfontPaths.cbegin(), m_sfontPaths.cend()));
 
@@ -268,8 +285,7 @@ void FluidSynth::setupSound(const PlaybackSetupData& setupData)
     auto setupChannel = [this](const midi::channel_t channelIdx, const midi::Program& program) {
         fluid_synth_set_interp_method(m_fluid->synth, channelIdx, FLUID_INTERP_DEFAULT);
         fluid_synth_pitch_wheel_sens(m_fluid->synth, channelIdx, 24);
-        fluid_synth_bank_select(m_fluid->synth, channelIdx, program.bank);
-        fluid_synth_program_change(m_fluid->synth, channelIdx, program.program);
+        selectProgram(channelIdx, program);
         fluid_synth_cc(m_fluid->synth, channelIdx, 7, DEFAULT_MIDI_VOLUME);
         fluid_synth_cc(m_fluid->synth, channelIdx, 74, 0);
         fluid_synth_set_portamento_mode(m_fluid->synth, channelIdx, FLUID_CHANNEL_PORTAMENTO_MODE_EACH_NOTE);
@@ -288,6 +304,52 @@ void FluidSynth::setupSound(const PlaybackSetupData& setupData)
     }
 }
 
+void FluidSynth::selectProgram(const midi::channel_t channelIdx, const midi::Program& program)
+{
+    m_pendingPrograms.erase(channelIdx);
+
+    //! NOTE Selecting a preset makes Fluid load its samples right away.
+    //!      While we are playing, read them from the disk on the read-ahead thread first
+    //!      and select the preset once they are resident, see applyPendingPrograms()
+    SoundFontSampleRanges ranges;
+    if (isActive()) {
+        ranges = unloadedPresetSampleRanges(m_fluid->synth, program.bank, program.program);
+    }
+
+    if (ranges.empty()) {
+        fluid_synth_bank_select(m_fluid->synth, channelIdx, program.bank);
+        fluid_synth_program_change(m_fluid->synth, channelIdx, program.program);
+        return;
+    }
+
+    std::future<void> readAhead = readAheadScheduler().submit([ranges = std::move(ranges)]() {
+        for (const SoundFontSampleRange& range : ranges) {
+            range.fileMapping->prefetch(range.offset, range.size);
+        }
+    });
+
+    m_pendingPrograms.emplace(channelIdx, PendingProgram { program, std::move(readAhead) });
+}
+
+void FluidSynth::applyPendingPrograms(bool waitForReadAhead)
+{
+    for (auto it = m_pendingPrograms.begin(); it != m_pendingPrograms.end();) {
+        PendingProgram& pending = it->second;
+
+        if (!waitForReadAhead && pending.readAhead.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+            ++it;
+            continue;
+        }
+
+        pending.readAhead.wait();
+
+        fluid_synth_bank_select(m_fluid->synth, it->first, pending.program.bank);
+        fluid_synth_program_change(m_fluid->synth, it->first, pending.program.program);
+
+        it = m_pendingPrograms.erase(it);
+    }
+}
+
 void FluidSynth::setupEvents(const mpe::PlaybackData& playbackData)
 {
     m_sequencer.load(playbackData);
@@ -322,6 +384,10 @@ bool FluidSynth::isActive() const
 
 void FluidSynth::setIsActive(const bool isActive)
 {
+    if (!isActive) {
+        applyPendingPrograms(true /*waitForReadAhead*/);
+    }
+
     m_sequencer.setActive(isActive);
     toggleExpressionController();
 }
@@ -356,6 +422,10 @@ samples_t FluidSynth::process(float* buffer, samples_t samplesPerChannel)
         m_allNotesOffRequested = false;
     }
 
+    if (!m_pendingPrograms.empty()) {
+        applyPendingPrograms(false /*waitForReadAhead*/);
+    }
+
     const msecs_t nextMsecs = samplesToMsecs(samplesPerChannel, m_sampleRate);
     const FluidSequencer::EventSequenceMap sequences = m_sequencer.movePlaybackForward(nextMsecs);
     samples_t sampleOffset = 0;
@@ -385,15 +455,16 @@ samples_t FluidSynth::process(float* buffer, samples_t samplesPerChannel)
 
 bool FluidSynth::processSequence(const FluidSequencer::EventSequence& sequence, const samples_t samples, float* buffer)
 {
+    //! NOTE The tuning only changes with new events, without them it's already applied to the sounding voices
     if (!sequence.empty()) {
         m_tuning.reset();
-    }
 
-    for (const FluidSequencer::EventType& event : sequence) {
-        handleEvent(std::get<midi::Event>(event));
-    }
+        for (const FluidSequencer::EventType& event : sequence) {
+            handleEvent(std::get<midi::Event>(event));
+        }
 
-    fluid_synth_tune_notes(m_fluid->synth, 0, 0, m_tuning.size(), m_tuning.keys.data(), m_tuning.pitches.data(), true);
+        fluid_synth_tune_notes(m_fluid->synth, 0, 0, m_tuning.size(), m_tuning.keys.data(), m_tuning.pitches.data(), true);
+    }
 
     int result = fluid_synth_write_float(m_fluid->synth, samples,
                                          buffer, 0, FLUID_AUDIO_CHANNELS_COUNT,
@@ -23,6 +23,8 @@
 #ifndef MUSE_AUDIO_FLUIDSYNTH_H
 #define MUSE_AUDIO_FLUIDSYNTH_H
 
+#include <future>
+#include <map>
 #include <memory>
 #include <optional>
 #include <vector>
@@ -102,6 +104,9 @@ private:
 
     void allNotesOff();
 
+    void selectProgram(const midi::channel_t channelIdx, const midi::Program& program);
+    void applyPendingPrograms(bool waitForReadAhead);
+
     bool processSequence(const FluidSequencer::EventSequence& sequence, const samples_t samples, float* buffer);
     bool handleEvent(const midi::Event& event);
 
@@ -121,6 +126,14 @@ private:
 
     KeyTuning m_tuning;
 
+    //! NOTE Programs waiting for their samples to be read ahead from the disk
+    struct PendingProgram {
+        midi::Program program;
+        std::future<void> readAhead;
+    };
+
+    std::map<midi::channel_t, PendingProgram> m_pendingPrograms;
+
     bool m_allNotesOffRequested = false;
 };
 
@@ -23,16 +23,31 @@
 #ifndef MUSE_AUDIO_SFCACHEDLOADER_H
 #define MUSE_AUDIO_SFCACHEDLOADER_H
 
-#include <cstdio>
+#include <cstring>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
 
 #include <sfloader/fluid_sfont.h>
 #include <sfloader/fluid_defsfont.h>
 
+#include "soundfontfilemapping.h"
+
 namespace muse::audio::synth {
 struct SoundFontData
 {
     fluid_sfont_t* soundFontPtr = nullptr;
-    std::FILE* fileStream = nullptr;
+    std::shared_ptr<SoundFontFileMapping> fileMapping;
+};
+
+//! NOTE Every open() by Fluid gets its own read position over the shared mapping,
+//!      so samples can be loaded by several synths at once
+struct SoundFontFileHandle
+{
+    std::shared_ptr<SoundFontFileMapping> fileMapping;
+    fluid_long_long_t position = 0;
 };
 
 struct SoundFontCache : public std::map<std::string, SoundFontData> {
@@ -42,11 +57,17 @@ struct SoundFontCache : public std::map<std::string, SoundFontData> {
         return &s;
     }
 
+    std::mutex mutex;
+
 private:
     SoundFontCache() = default;
     ~SoundFontCache()
     {
         for (const auto& pair : *this) {
+            if (!pair.second.soundFontPtr) {
+                continue;
+            }
+
             fluid_defsfont_t* defsFont = static_cast<fluid_defsfont_t*>(fluid_sfont_get_data(pair.second.soundFontPtr));
 
             if (delete_fluid_defsfont(defsFont) != FLUID_OK) {
@@ -54,55 +75,93 @@ private:
             }
 
             delete_fluid_sfont(pair.second.soundFontPtr);
-
-            if (pair.second.fileStream) {
-                std::fclose(pair.second.fileStream);
-            }
         }
     }
 };
 
 void* openSoundFont(const char* filename)
 {
-    auto search = SoundFontCache::instance()->find(filename);
+    std::shared_ptr<SoundFontFileMapping> fileMapping;
 
-    if (search != SoundFontCache::instance()->cend()
-        && search->second.fileStream) {
-        return search->second.fileStream;
-    }
+    {
+        SoundFontCache* cache = SoundFontCache::instance();
+        std::lock_guard lock(cache->mutex);
 
-    std::FILE* stream = std::fopen(filename, "r");
+        SoundFontData& sfData = cache->operator[](filename);
 
-    SoundFontData sfData;
-    sfData.fileStream = stream;
+        if (!sfData.fileMapping) {
+            auto newMapping = std::make_shared<SoundFontFileMapping>();
+            if (!newMapping->open(filename)) {
+                return nullptr;
+            }
 
-    SoundFontCache::instance()->emplace(filename, std::move(sfData));
+            sfData.fileMapping = newMapping;
+        }
 
-    return stream;
+        fileMapping = sfData.fileMapping;
+    }
+
+    SoundFontFileHandle* handle = new SoundFontFileHandle();
+    handle->fileMapping = std::move(fileMapping);
+
+    return handle;
 }
 
 int readSoundFont(void* buf, fluid_long_long_t count, void* handle)
 {
-    return static_cast<int>(std::fread(buf, count, 1, static_cast<std::FILE*>(handle)));
+    SoundFontFileHandle* fileHandle = static_cast<SoundFontFileHandle*>(handle);
+    const SoundFontFileMapping* fileMapping = fileHandle->fileMapping.get();
+
+    if (count < 0 || fileHandle->position + count > static_cast<fluid_long_long_t>(fileMapping->size())) {
+        return FLUID_FAILED;
+    }
+
+    std::memcpy(buf, fileMapping->data() + fileHandle->position, static_cast<size_t>(count));
+    fileHandle->position += count;
+
+    return FLUID_OK;
 }
 
 int seekSoundFont(void* handle, fluid_long_long_t offset, int origin)
 {
-    return std::fseek(static_cast<std::FILE*>(handle), offset, origin);
+    SoundFontFileHandle* fileHandle = static_cast<SoundFontFileHandle*>(handle);
+    const fluid_long_long_t size = static_cast<fluid_long_long_t>(fileHandle->fileMapping->size());
+
+    fluid_long_long_t newPosition = 0;
+
+    switch (origin) {
+    case SEEK_SET: newPosition = offset;
+        break;
+    case SEEK_CUR: newPosition = fileHandle->position + offset;
+        break;
+    case SEEK_END: newPosition = size + offset;
+        break;
+    default:
+        return FLUID_FAILED;
+    }
+
+    if (newPosition < 0 || newPosition > size) {
+        return FLUID_FAILED;
+    }
+
+    fileHandle->position = newPosition;
+
+    return FLUID_OK;
 }
 
-int closeSoundFont(void* /*handle*/)
+int closeSoundFont(void* handle)
 {
-    //!Note Prevent closing of sound-font files by Fluid instances,
-    //!     instead the actual closing of cached sound-font files will happen in SoundFontCache.
-    //!     However, we still need to provide "some" callback for Fluid's API
+    //!Note Only the read position is released here,
+    //!     the mapping itself stays alive in SoundFontCache for the other Fluid instances
+
+    delete static_cast<SoundFontFileHandle*>(handle);
 
     return FLUID_OK;
 }
 
 fluid_long_long_t tellSoundFont(void* handle)
 {
-    return std::ftell(static_cast<std::FILE*>(handle));
+    return static_cast<SoundFontFileHandle*>(handle)->position;
 }
 
 int deleteSoundFont(fluid_sfont_t* /*sfont*/)
@@ -124,9 +183,14 @@ static fluid_file_callbacks_t FILE_CALLBACKS {
 
 fluid_sfont_t* loadSoundFont(fluid_sfloader_t* loader, const char* filename)
 {
-    auto search = SoundFontCache::instance()->find(filename);
-    if (search != SoundFontCache::instance()->cend()) {
-        return search->second.soundFontPtr;
+    {
+        SoundFontCache* cache = SoundFontCache::instance();
+        std::lock_guard lock(cache->mutex);
+
+        auto search = cache->find(filename);
+        if (search != cache->cend() && search->second.soundFontPtr) {
+            return search->second.soundFontPtr;
+        }
     }
 
     fluid_defsfont_t* defsfont = nullptr;
@@ -157,11 +221,87 @@ fluid_sfont_t* loadSoundFont(fluid_sfloader_t* loader, const char* filename)
         return nullptr;
     }
 
-    SoundFontData& sfData = SoundFontCache::instance()->operator[](filename);
+    SoundFontCache* cache = SoundFontCache::instance();
+    std::lock_guard lock(cache->mutex);
+
+    SoundFontData& sfData = cache->operator[](filename);
     sfData.soundFontPtr = result;
 
     return result;
 }
+
+struct SoundFontSampleRange
+{
+    std::shared_ptr<SoundFontFileMapping> fileMapping;
+    size_t offset = 0;
+    size_t size = 0;
+};
+
+using SoundFontSampleRanges = std::vector<SoundFontSampleRange>;
+
+//! NOTE Returns the file ranges of the preset samples which Fluid has not loaded yet,
+//!      i.e. the data that selecting this preset would read from the disk
+SoundFontSampleRanges unloadedPresetSampleRanges(fluid_synth_t* synth, int bank, int program)
+{
+    SoundFontSampleRanges result;
+
+    fluid_preset_t* preset = nullptr;
+    fluid_sfont_t* sfont = nullptr;
+
+    for (int i = 0; i < fluid_synth_sfcount(synth) && !preset; ++i) {
+        sfont = fluid_synth_get_sfont(synth, i);
+        preset = sfont ? fluid_sfont_get_preset(sfont, bank, program) : nullptr;
+    }
+
+    if (!preset) {
+        return result;
+    }
+
+    const fluid_defsfont_t* defsfont = static_cast<const fluid_defsfont_t*>(fluid_sfont_get_data(sfont));
+    std::shared_ptr<SoundFontFileMapping> fileMapping;
+
+    {
+        SoundFontCache* cache = SoundFontCache::instance();
+        std::lock_guard lock(cache->mutex);
+
+        auto search = cache->find(defsfont->filename);
+        if (search == cache->cend() || search->second.soundFontPtr != sfont) {
+            return result;
+        }
+
+        fileMapping = search->second.fileMapping;
+    }
+
+    if (!fileMapping) {
+        return result;
+    }
+
+    const fluid_defpreset_t* defpreset = static_cast<const fluid_defpreset_t*>(fluid_preset_get_data(preset));
+
+    for (const fluid_preset_zone_t* presetZone = defpreset->zone; presetZone; presetZone = presetZone->next) {
+        if (!presetZone->inst) {
+            continue;
+        }
+
+        for (const fluid_inst_zone_t* instZone = presetZone->inst->zone; instZone; instZone = instZone->next) {
+            const fluid_sample_t* sample = instZone->sample;
+
+            if (!sample || sample->data || sample->start == sample->end) {
+                continue;
+            }
+
+            const size_t sampleCount = sample->source_end - sample->source_start + 1;
+
+            result.push_back({ fileMapping, defsfont->samplepos + sample->source_start * sizeof(short), sampleCount * sizeof(short) });
+
+            if (defsfont->sample24pos) {
+                result.push_back({ fileMapping, defsfont->sample24pos + sample->source_start, sampleCount });
+            }
+        }
+    }
+
+    return result;
+}
 }
 
 #endif // MUSE_AUDIO_SFCACHEDLOADER_H
@@ -0,0 +1,182 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2024 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "soundfontfilemapping.h"
+
+#include <algorithm>
+#include <filesystem>
+
+#ifdef Q_OS_WIN
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "log.h"
+
+using namespace muse::audio::synth;
+
+SoundFontFileMapping::~SoundFontFileMapping()
+{
+    close();
+}
+
+bool SoundFontFileMapping::open(const char* utf8Path)
+{
+    close();
+
+    const std::filesystem::path path = std::filesystem::u8path(utf8Path);
+
+#ifdef Q_OS_WIN
+    HANDLE file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        LOGE() << "Unable to open sound font: " << utf8Path;
+        return false;
+    }
+
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart == 0) {
+        CloseHandle(file);
+        return false;
+    }
+
+    HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (!mapping) {
+        LOGE() << "Unable to map sound font: " << utf8Path;
+        CloseHandle(file);
+        return false;
+    }
+
+    void* data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (!data) {
+        LOGE() << "Unable to map sound font: " << utf8Path;
+        CloseHandle(mapping);
+        CloseHandle(file);
+        return false;
+    }
+
+    m_file = file;
+    m_mapping = mapping;
+    m_data = static_cast<const uint8_t*>(data);
+    m_size = static_cast<size_t>(fileSize.QuadPart);
+#else
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        LOGE() << "Unable to open sound font: " << utf8Path;
+        return false;
+    }
+
+    struct stat fileStat;
+    if (fstat(fd, &fileStat) != 0 || fileStat.st_size <= 0) {
+        ::close(fd);
+        return false;
+    }
+
+    size_t size = static_cast<size_t>(fileStat.st_size);
+    void* data = mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+
+    //! NOTE The mapping stays valid after the descriptor is closed
+    ::close(fd);
+
+    if (data == MAP_FAILED) {
+        LOGE() << "Unable to map sound font: " << utf8Path;
+        return false;
+    }
+
+    m_data = static_cast<const uint8_t*>(data);
+    m_size = size;
+#endif
+
+    return true;
+}
+
+void SoundFontFileMapping::close()
+{
+    if (!m_data) {
+        return;
+    }
+
+#ifdef Q_OS_WIN
+    UnmapViewOfFile(m_data);
+    CloseHandle(static_cast<HANDLE>(m_mapping));
+    CloseHandle(static_cast<HANDLE>(m_file));
+    m_mapping = nullptr;
+    m_file = nullptr;
+#else
+    munmap(const_cast<uint8_t*>(m_data), m_size);
+#endif
+
+    m_data = nullptr;
+    m_size = 0;
+}
+
+bool SoundFontFileMapping::isOpen() const
+{
+    return m_data != nullptr;
+}
+
+const uint8_t* SoundFontFileMapping::data() const
+{
+    return m_data;
+}
+
+size_t SoundFontFileMapping::size() const
+{
+    return m_size;
+}
+
+void SoundFontFileMapping::prefetch(size_t offset, size_t length) const
+{
+    if (!m_data || offset >= m_size || length == 0) {
+        return;
+    }
+
+    length = std::min(length, m_size - offset);
+
+    static const size_t pageSize = [] {
+#ifdef Q_OS_WIN
+        SYSTEM_INFO info;
+        GetSystemInfo(&info);
+        return static_cast<size_t>(info.dwPageSize);
+#else
+        return static_cast<size_t>(sysconf(_SC_PAGESIZE));
+#endif
+    }();
+
+#ifndef Q_OS_WIN
+    const size_t alignedOffset = offset - offset % pageSize;
+    madvise(const_cast<uint8_t*>(m_data) + alignedOffset, length + offset - alignedOffset, MADV_WILLNEED);
+#endif
+
+    //! NOTE Touch every page, so that the data is really read from the disk here
+    const volatile uint8_t* begin = m_data + offset;
+    uint8_t sum = 0;
+
+    for (size_t i = 0; i < length; i += pageSize) {
+        sum += begin[i];
+    }
+
+    sum += begin[length - 1];
+    (void)sum;
+}
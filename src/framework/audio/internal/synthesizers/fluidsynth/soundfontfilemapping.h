@@ -0,0 +1,61 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2024 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef MUSE_AUDIO_SOUNDFONTFILEMAPPING_H
+#define MUSE_AUDIO_SOUNDFONTFILEMAPPING_H
+
+#include <cstddef>
+#include <cstdint>
+
+namespace muse::audio::synth {
+//! NOTE Read-only memory mapping of a sound font file.
+//! The pages are shared by every reader and are loaded by the OS on first access
+class SoundFontFileMapping
+{
+public:
+    SoundFontFileMapping() = default;
+    ~SoundFontFileMapping();
+
+    SoundFontFileMapping(const SoundFontFileMapping&) = delete;
+    SoundFontFileMapping& operator=(const SoundFontFileMapping&) = delete;
+
+    bool open(const char* utf8Path);
+    void close();
+
+    bool isOpen() const;
+    const uint8_t* data() const;
+    size_t size() const;
+
+    //! NOTE Blocks until the given range is resident, so it must not be called from the audio thread
+    void prefetch(size_t offset, size_t length) const;
+
+private:
+    const uint8_t* m_data = nullptr;
+    size_t m_size = 0;
+
+#ifdef Q_OS_WIN
+    void* m_file = nullptr;
+    void* m_mapping = nullptr;
+#endif
+};
+}
+
+#endif // MUSE_AUDIO_SOUNDFONTFILEMAPPING_H
@@ -81,6 +81,17 @@ void AudioEngine::setOnReadBufferChanged(const OnReadBufferChanged func)
     m_onReadBufferChanged = func;
 }
 
+void AudioEngine::setProfiler(AudioProfiler* profiler)
+{
+    ONLY_AUDIO_WORKER_THREAD;
+
+    IF_ASSERT_FAILED(m_mixer) {
+        return;
+    }
+
+    m_mixer->setProfiler(profiler);
+}
+
 sample_rate_t AudioEngine::sampleRate() const
 {
     ONLY_AUDIO_WORKER_THREAD;
@@ -204,14 +215,18 @@ void AudioEngine::updateBufferConstraints()
         return;
     }
 
+    samples_t renderStep = 0;
     samples_t minSamplesToReserve = 0;
 
     if (m_currentMode == RenderMode::IdleMode) {
-        minSamplesToReserve = std::max(m_readBufferSize, m_renderConsts.minSamplesToReserveWhenIdle);
+        renderStep = std::max(m_readBufferSize, m_renderConsts.minSamplesToReserveWhenIdle);
+        minSamplesToReserve = renderStep;
     } else {
-        minSamplesToReserve = std::max(m_readBufferSize, m_renderConsts.minSamplesToReserveInRealtime);
+        //! NOTE The sources keep processing blocks of the same size, only more of them are kept ahead of the driver
+        renderStep = std::max(m_readBufferSize, m_renderConsts.minSamplesToReserveInRealtime);
+        minSamplesToReserve = std::max(renderStep, m_renderConsts.samplesToRenderAheadInRealtime);
     }
 
     m_buffer->setMinSamplesPerChannelToReserve(minSamplesToReserve);
-    m_buffer->setRenderStep(minSamplesToReserve);
+    m_buffer->setRenderStep(renderStep);
 }
@@ -33,6 +33,7 @@
 
 namespace muse::audio {
 class AudioBuffer;
+class AudioProfiler;
 class AudioEngine : public IAudioEngine, public Injectable, public async::Asyncable
 {
 public:
@@ -43,6 +44,7 @@ public:
     struct RenderConstraints {
         samples_t minSamplesToReserveWhenIdle = 0;
         samples_t minSamplesToReserveInRealtime = 0;
+        samples_t samplesToRenderAheadInRealtime = 0;
     };
 
     Ret init(std::shared_ptr<AudioBuffer> bufferPtr, const RenderConstraints& consts);
@@ -51,6 +53,8 @@ public:
     using OnReadBufferChanged = std::function<void (const samples_t, const sample_rate_t)>;
     void setOnReadBufferChanged(const OnReadBufferChanged func);
 
+    void setProfiler(AudioProfiler* profiler);
+
     sample_rate_t sampleRate() const override;
 
     void setSampleRate(const sample_rate_t sampleRate) override;
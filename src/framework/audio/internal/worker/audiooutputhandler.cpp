@@ -76,19 +76,104 @@ Promise<AudioOutputParams> AudioOutputHandler::outputParams(const TrackSequenceI
     }, AudioThread::ID);
 }
 
+static void copyOutputLevels(const AudioOutputParams& from, AudioOutputParams& to)
+{
+    to.volume = from.volume;
+    to.balance = from.balance;
+    to.solo = from.solo;
+    to.muted = from.muted;
+    to.forceMute = from.forceMute;
+}
+
 void AudioOutputHandler::setOutputParams(const TrackSequenceId sequenceId, const TrackId trackId, const AudioOutputParams& params)
 {
-    Async::call(this, [this, sequenceId, trackId, params]() {
+    const OutputKey key = { sequenceId, trackId };
+    const uint64_t version = ++m_outputParamsVersion;
+
+    auto it = m_lastSentOutputParams.find(key);
+    const bool onlyLevelsChanged = it != m_lastSentOutputParams.end()
+                                   && it->second.fxChain == params.fxChain
+                                   && it->second.auxSends == params.auxSends;
+    m_lastSentOutputParams[key] = params;
+
+    if (onlyLevelsChanged) {
+        OutputLevelsCommand command;
+        command.sequenceId = sequenceId;
+        command.trackId = trackId;
+        command.version = version;
+        command.volume = params.volume;
+        command.balance = params.balance;
+        command.solo = params.solo;
+        command.muted = params.muted;
+        command.forceMute = params.forceMute;
+
+        if (m_outputLevelsCommands.tryPush(command)) {
+            return;
+        }
+    }
+
+    Async::call(this, [this, key, params, version]() {
         ONLY_AUDIO_WORKER_THREAD;
 
-        ITrackSequencePtr s = sequence(sequenceId);
+        ITrackSequencePtr s = sequence(key.first);
+        if (!s) {
+            return;
+        }
 
-        if (s) {
-            s->audioIO()->setOutputParams(trackId, params);
+        AudioOutputParams resultParams = params;
+
+        uint64_t& appliedVersion = m_appliedOutputVersions[key];
+        if (appliedVersion > version) {
+            // Newer levels have already come through the queue
+            RetVal<AudioOutputParams> current = s->audioIO()->outputParams(key.second);
+            if (current.ret) {
+                copyOutputLevels(current.val, resultParams);
+            }
+        } else {
+            appliedVersion = version;
         }
+
+        s->audioIO()->setOutputParams(key.second, resultParams);
     }, AudioThread::ID);
 }
 
+void AudioOutputHandler::processCommands()
+{
+    ONLY_AUDIO_WORKER_THREAD;
+
+    OutputLevelsCommand command;
+
+    while (m_outputLevelsCommands.tryPop(command)) {
+        const OutputKey key = { command.sequenceId, command.trackId };
+
+        uint64_t& appliedVersion = m_appliedOutputVersions[key];
+        if (appliedVersion > command.version) {
+            // Params sent later have already been applied
+            continue;
+        }
+
+        appliedVersion = command.version;
+
+        ITrackSequencePtr s = sequence(command.sequenceId);
+        if (!s) {
+            continue;
+        }
+
+        RetVal<AudioOutputParams> params = s->audioIO()->outputParams(command.trackId);
+        if (!params.ret) {
+            continue;
+        }
+
+        params.val.volume = command.volume;
+        params.val.balance = command.balance;
+        params.val.solo = command.solo;
+        params.val.muted = command.muted;
+        params.val.forceMute = command.forceMute;
+
+        s->audioIO()->setOutputParams(command.trackId, params.val);
+    }
+}
+
 Channel<TrackSequenceId, TrackId, AudioOutputParams> AudioOutputHandler::outputParamsChanged() const
 {
     ONLY_AUDIO_MAIN_OR_WORKER_THREAD;
@@ -186,7 +271,12 @@ Promise<AudioSignalChanges> AudioOutputHandler::masterSignalChanges() const
 Promise<bool> AudioOutputHandler::saveSoundTrack(const TrackSequenceId sequenceId, const io::path_t& destination,
                                                  const SoundTrackFormat& format)
 {
-    return Promise<bool>([this, sequenceId, destination, format](auto resolve, auto reject) {
+    return saveSoundTracks(sequenceId, { SoundTrackDestination { destination, format } });
+}
+
+Promise<bool> AudioOutputHandler::saveSoundTracks(const TrackSequenceId sequenceId, const SoundTrackDestinationList& destinations)
+{
+    return Promise<bool>([this, sequenceId, destinations](auto resolve, auto reject) {
         ONLY_AUDIO_WORKER_THREAD;
 
         IF_ASSERT_FAILED(mixer()) {
@@ -203,7 +293,7 @@ Promise<bool> AudioOutputHandler::saveSoundTrack(const TrackSequenceId sequenceI
         s->player()->seek(0);
         msecs_t totalDuration = s->player()->duration();
 
-        SoundTrackWriterPtr writer = std::make_shared<SoundTrackWriter>(destination, format, totalDuration, mixer(), iocContext());
+        SoundTrackWriterPtr writer = std::make_shared<SoundTrackWriter>(destinations, totalDuration, mixer(), iocContext());
         m_saveSoundTracksWritersMap[sequenceId] = writer;
 
         Progress progress = saveSoundTrackProgress(sequenceId);
@@ -23,8 +23,12 @@
 #ifndef MUSE_AUDIO_AUDIOIOHANDLER_H
 #define MUSE_AUDIO_AUDIOIOHANDLER_H
 
+#include <map>
+#include <unordered_map>
+
 #include "global/modularity/ioc.h"
 #include "global/async/asyncable.h"
+#include "global/concurrency/spscqueue.h"
 
 #include "ifxresolver.h"
 #include "iaudiooutput.h"
@@ -63,13 +67,32 @@ public:
 
     async::Promise<bool> saveSoundTrack(const TrackSequenceId sequenceId, const io::path_t& destination,
                                         const SoundTrackFormat& format) override;
+    async::Promise<bool> saveSoundTracks(const TrackSequenceId sequenceId, const SoundTrackDestinationList& destinations) override;
     void abortSavingAllSoundTracks() override;
 
     Progress saveSoundTrackProgress(const TrackSequenceId sequenceId) override;
 
     void clearAllFx() override;
 
+    //! NOTE Called by the worker loop before every block
+    void processCommands();
+
 private:
+    //! NOTE Volume, balance, solo and mute changes are the frequent ones (ex. fader moves),
+    //! they go through a lock-free queue instead of the async calls, which allocate and lock
+    struct OutputLevelsCommand {
+        TrackSequenceId sequenceId = -1;
+        TrackId trackId = -1;
+        uint64_t version = 0;
+        volume_db_t volume = 0.f;
+        balance_t balance = 0.f;
+        bool solo = false;
+        bool muted = false;
+        bool forceMute = false;
+    };
+
+    using OutputKey = std::pair<TrackSequenceId, TrackId>;
+
     std::shared_ptr<Mixer> mixer() const;
     ITrackSequencePtr sequence(const TrackSequenceId id) const;
     void ensureSeqSubscriptions(const ITrackSequencePtr s) const;
@@ -82,6 +105,16 @@ private:
 
     std::unordered_map<TrackSequenceId, Progress> m_saveSoundTracksProgressMap;
     std::unordered_map<TrackSequenceId, soundtrack::SoundTrackWriterPtr> m_saveSoundTracksWritersMap;
+
+    // Main thread
+    std::map<OutputKey, AudioOutputParams> m_lastSentOutputParams;
+    uint64_t m_outputParamsVersion = 0;
+
+    SpscQueue<OutputLevelsCommand, 256> m_outputLevelsCommands;
+
+    // Worker thread, the version of the latest applied params of every track;
+    // the queue can overtake the async calls, so the older ones must not override the newer
+    std::map<OutputKey, uint64_t> m_appliedOutputVersions;
 };
 }
 
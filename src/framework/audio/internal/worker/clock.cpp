@@ -44,7 +44,9 @@ void Clock::forward(const msecs_t nextMsecs)
 
     msecs_t newTime = m_currentTime + nextMsecs;
 
-    if (m_timeLoopStart < m_timeLoopEnd && newTime >= m_timeLoopEnd) {
+    //! NOTE The mixer splits the block at the end of the loop (see timeLeftInLoop),
+    //! so the block ending exactly at the loop end is still played, and the next one wraps
+    if (m_timeLoopStart < m_timeLoopEnd && (m_currentTime >= m_timeLoopEnd || newTime > m_timeLoopEnd)) {
         seek(m_timeLoopStart);
 
         //!Note No matter of the time loop boundaries, the current frame still should be handled
@@ -137,6 +139,15 @@ void Clock::resetTimeLoop()
     m_timeLoopEnd = 0;
 }
 
+msecs_t Clock::timeLeftInLoop() const
+{
+    if (!isRunning() || m_timeLoopStart >= m_timeLoopEnd || m_currentTime >= m_timeLoopEnd) {
+        return 0;
+    }
+
+    return m_timeLoopEnd - m_currentTime;
+}
+
 bool Clock::isRunning() const
 {
     return m_status.val == PlaybackStatus::Running;
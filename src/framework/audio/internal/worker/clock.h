@@ -51,6 +51,7 @@ public:
     void setTimeDuration(const msecs_t duration) override;
     Ret setTimeLoop(const msecs_t fromMsec, const msecs_t toMsec) override;
     void resetTimeLoop() override;
+    msecs_t timeLeftInLoop() const override;
 
     msecs_t currentTime() const override;
     async::Channel<secs_t> timeChanged() const override;
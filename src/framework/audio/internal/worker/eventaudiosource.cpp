@@ -31,6 +31,20 @@ using namespace muse::audio;
 using namespace muse::audio::synth;
 using namespace muse::mpe;
 
+static samples_t microsecsToFrames(const msecs_t pos, const samples_t sampleRate)
+{
+    if (pos <= 0) {
+        return 0;
+    }
+
+    return static_cast<samples_t>(pos) * sampleRate / 1000000;
+}
+
+static msecs_t framesToMicrosecs(const samples_t frames, const samples_t sampleRate)
+{
+    return static_cast<msecs_t>(frames * 1000000 / sampleRate);
+}
+
 EventAudioSource::EventAudioSource(const TrackId trackId,
                                    const mpe::PlaybackData& playbackData,
                                    OnOffStreamEventsReceived onOffStreamReceived,
@@ -39,14 +53,29 @@ EventAudioSource::EventAudioSource(const TrackId trackId,
 {
     ONLY_AUDIO_WORKER_THREAD;
 
-    m_playbackData.offStream.onReceive(this, [onOffStreamReceived, trackId](const PlaybackEventsMap&, const PlaybackParamList&) {
+    m_playbackData.offStream.onReceive(this, [this, onOffStreamReceived, trackId](const PlaybackEventsMap&, const PlaybackParamList&) {
+        // Notes played on the fly during playback would end up in the cache
+        if (isActive()) {
+            invalidateRenderCache();
+        }
+
         onOffStreamReceived(trackId);
     });
+
+    m_playbackData.mainStream.onReceive(this, [this](const PlaybackEventsMap&, const DynamicLevelLayers&, const PlaybackParamLayers&) {
+        invalidateRenderCache();
+    });
+
+    m_isRealTimeMode = audioEngine()->mode() == RenderMode::RealTimeMode;
+    audioEngine()->modeChanged().onNotify(this, [this]() {
+        m_isRealTimeMode = audioEngine()->mode() == RenderMode::RealTimeMode;
+    });
 }
 
 EventAudioSource::~EventAudioSource()
 {
     m_playbackData.offStream.resetOnReceive(this);
+    m_playbackData.mainStream.resetOnReceive(this);
 }
 
 bool EventAudioSource::isActive() const
@@ -68,14 +97,24 @@ void EventAudioSource::setIsActive(const bool active)
         return;
     }
 
+    catchUpSynth();
+
     m_synth->setIsActive(active);
     m_synth->flushSound();
+
+    if (active) {
+        m_renderPosition = microsecsToFrames(m_synth->playbackPosition(), m_sampleRate);
+    }
 }
 
 void EventAudioSource::setSampleRate(unsigned int sampleRate)
 {
     ONLY_AUDIO_WORKER_THREAD;
 
+    if (m_sampleRate != sampleRate) {
+        invalidateRenderCache();
+    }
+
     m_sampleRate = sampleRate;
 
     if (!m_synth) {
@@ -115,7 +154,28 @@ samples_t EventAudioSource::process(float* buffer, samples_t samplesPerChannel)
         return 0;
     }
 
-    return m_synth->process(buffer, samplesPerChannel);
+    if (!useRenderCache()) {
+        return m_synth->process(buffer, samplesPerChannel);
+    }
+
+    const audioch_t audioChannelsCount = static_cast<audioch_t>(m_synth->audioChannelsCount());
+
+    if (m_renderCache.read(m_renderPosition, samplesPerChannel, audioChannelsCount, buffer)) {
+        m_renderPosition += samplesPerChannel;
+        m_synthIsBehind = true;
+        return samplesPerChannel;
+    }
+
+    catchUpSynth();
+
+    samples_t processedSamples = m_synth->process(buffer, samplesPerChannel);
+    if (processedSamples == samplesPerChannel) {
+        m_renderCache.write(m_renderPosition, samplesPerChannel, audioChannelsCount, buffer);
+    }
+
+    m_renderPosition += samplesPerChannel;
+
+    return processedSamples;
 }
 
 void EventAudioSource::seek(const msecs_t newPositionMsecs)
@@ -126,6 +186,9 @@ void EventAudioSource::seek(const msecs_t newPositionMsecs)
         return;
     }
 
+    m_renderPosition = microsecsToFrames(newPositionMsecs, m_sampleRate);
+    m_synthIsBehind = false;
+
     if (m_synth->playbackPosition() == newPositionMsecs) {
         return;
     }
@@ -145,6 +208,9 @@ void EventAudioSource::applyInputParams(const AudioInputParams& requiredParams)
         return;
     }
 
+    catchUpSynth();
+    invalidateRenderCache();
+
     SynthCtx ctx = currentSynthCtx();
 
     if (m_synth) {
@@ -208,3 +274,31 @@ void EventAudioSource::setupSource()
     m_synth->setSampleRate(m_sampleRate);
     m_synth->setup(m_playbackData);
 }
+
+bool EventAudioSource::useRenderCache() const
+{
+    // Offline rendering may use a different quality, and FluidSynth is cheap enough to render again
+    if (!m_isRealTimeMode || m_sampleRate == 0 || m_synth->type() == AudioSourceType::Fluid) {
+        return false;
+    }
+
+    // Inactive synthesizers only play the notes auditioned on the fly
+    return m_synth->isActive();
+}
+
+void EventAudioSource::invalidateRenderCache()
+{
+    m_renderCache.clear();
+}
+
+void EventAudioSource::catchUpSynth()
+{
+    if (!m_synthIsBehind) {
+        return;
+    }
+
+    //! NOTE The synthesizer was skipped while the audio came from the cache
+    m_synth->setPlaybackPosition(framesToMicrosecs(m_renderPosition, m_sampleRate));
+    m_synth->revokePlayingNotes();
+    m_synthIsBehind = false;
+}
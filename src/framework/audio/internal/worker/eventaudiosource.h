@@ -29,12 +29,15 @@
 
 #include "audiotypes.h"
 #include "isynthresolver.h"
+#include "iaudioengine.h"
 #include "track.h"
+#include "trackrendercache.h"
 
 namespace muse::audio {
 class EventAudioSource : public ITrackAudioInput, public muse::Injectable, public async::Asyncable
 {
     Inject<synth::ISynthResolver> synthResolver = { this };
+    Inject<IAudioEngine> audioEngine = { this };
 
 public:
     using OnOffStreamEventsReceived = std::function<void (const TrackId)>;
@@ -74,6 +77,10 @@ private:
     SynthCtx currentSynthCtx() const;
     void restoreSynthCtx(const SynthCtx& ctx);
 
+    bool useRenderCache() const;
+    void invalidateRenderCache();
+    void catchUpSynth();
+
     TrackId m_trackId = -1;
     mpe::PlaybackData m_playbackData;
     synth::ISynthesizerPtr m_synth = nullptr;
@@ -81,6 +88,13 @@ private:
     async::Channel<AudioInputParams> m_paramsChanges;
 
     samples_t m_sampleRate = 0;
+
+    //! NOTE Rendered audio of the expensive synthesizers is kept, so that playing the same range again
+    //! doesn't render it once more, until the events, the sound or the sample rate change
+    TrackRenderCache m_renderCache;
+    bool m_isRealTimeMode = false;
+    samples_t m_renderPosition = 0;
+    bool m_synthIsBehind = false;
 };
 
 using EventAudioSourcePtr = std::shared_ptr<EventAudioSource>;
@@ -58,6 +58,9 @@ public:
     virtual Ret setTimeLoop(const msecs_t fromMsec, const msecs_t toMsec) = 0;
     virtual void resetTimeLoop() = 0;
 
+    //! NOTE The time left until the end of the loop, 0 if there is no loop ahead of the current time
+    virtual msecs_t timeLeftInLoop() const = 0;
+
     virtual async::Channel<secs_t> timeChanged() const = 0;
 };
 
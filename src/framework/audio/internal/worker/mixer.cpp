@@ -21,10 +21,14 @@
  */
 #include "mixer.h"
 
-#include "concurrency/taskscheduler.h"
+#include <chrono>
+
+#include "concurrency/jobpool.h"
 
 #include "internal/audiosanitizer.h"
+#include "internal/audioprofiler.h"
 #include "internal/dsp/audiomathutils.h"
+#include "internal/dsp/audiovectorops.h"
 #include "audioerrors.h"
 
 #include "log.h"
@@ -38,13 +42,13 @@ Mixer::Mixer(const modularity::ContextPtr& iocCtx)
 {
     ONLY_AUDIO_WORKER_THREAD;
 
-    m_taskScheduler = std::make_unique<TaskScheduler>(static_cast<thread_pool_size_t>(configuration()->desiredAudioThreadNumber()));
+    m_jobPool = std::make_unique<JobPool>(static_cast<thread_pool_size_t>(configuration()->desiredAudioThreadNumber()));
 
-    if (!m_taskScheduler->setThreadsPriority(ThreadPriority::High)) {
+    if (!m_jobPool->setThreadsPriority(ThreadPriority::High)) {
         LOGE() << "Unable to change audio threads priority";
     }
 
-    AudioSanitizer::setMixerThreads(m_taskScheduler->threadIdSet());
+    AudioSanitizer::setMixerThreads(m_jobPool->threadIdSet());
 
     m_minTrackCountForMultithreading = configuration()->minTrackCountForMultithreading();
 }
@@ -140,6 +144,7 @@ Ret Mixer::removeChannel(const TrackId trackId)
         }
 
         m_trackChannels.erase(trackId);
+        m_processedTrackChannels.clear();
         return make_ret(Ret::Code::Ok);
     }
 
@@ -185,10 +190,79 @@ unsigned int Mixer::audioChannelsCount() const
     return m_audioChannelsCount;
 }
 
+void Mixer::setProfiler(AudioProfiler* profiler)
+{
+    ONLY_AUDIO_WORKER_THREAD;
+
+    m_profiler = profiler;
+}
+
 samples_t Mixer::process(float* outBuffer, samples_t samplesPerChannel)
 {
     ONLY_AUDIO_WORKER_THREAD;
 
+    m_isProfiling = m_profiler && m_profiler->isEnabled();
+    m_profiledTrackCount = 0;
+
+    if (!m_isProfiling) {
+        return mixBlock(outBuffer, samplesPerChannel);
+    }
+
+    const uint64_t allocationCount = AudioProfiler::currentThreadAllocationCount();
+    const auto start = std::chrono::steady_clock::now();
+
+    samples_t result = mixBlock(outBuffer, samplesPerChannel);
+
+    const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+
+    AudioBlockProfile block;
+    block.samplesPerChannel = samplesPerChannel;
+    block.processingTimeMs = elapsed.count();
+    block.deadlineMs = m_sampleRate > 0 ? samplesPerChannel * 1000.0 / m_sampleRate : 0.0;
+    block.allocationCount = AudioProfiler::currentThreadAllocationCount() - allocationCount;
+
+    m_profiler->addBlock(block, m_processedTrackIds.data(), m_trackRenderTimesMs.data(), m_profiledTrackCount);
+
+    return result;
+}
+
+samples_t Mixer::mixBlock(float* outBuffer, samples_t samplesPerChannel)
+{
+    //! NOTE If a loop ends inside the block, the block is mixed in two parts,
+    //! so that the clock wraps exactly at the end of the loop, instead of skipping the rest of the loop
+    const samples_t loopEndFrame = framesToLoopEnd(samplesPerChannel);
+    if (loopEndFrame == 0) {
+        return mixFrames(outBuffer, samplesPerChannel);
+    }
+
+    const samples_t first = mixFrames(outBuffer, loopEndFrame);
+    const samples_t second = mixFrames(outBuffer + loopEndFrame * m_audioChannelsCount, samplesPerChannel - loopEndFrame);
+
+    return (first > 0 || second > 0) ? samplesPerChannel : 0;
+}
+
+samples_t Mixer::framesToLoopEnd(samples_t samplesPerChannel) const
+{
+    samples_t result = 0;
+
+    for (const IClockPtr& clock : m_clocks) {
+        const msecs_t timeLeft = clock->timeLeftInLoop();
+        if (timeLeft <= 0) {
+            continue;
+        }
+
+        // rounded down, so the first part never goes past the loop end
+        const samples_t frames = static_cast<samples_t>((timeLeft * m_sampleRate) / 1000000);
+        if (frames > 0 && frames < samplesPerChannel && (result == 0 || frames < result)) {
+            result = frames;
+        }
+    }
+
+    return result;
+}
+
+samples_t Mixer::mixFrames(float* outBuffer, samples_t samplesPerChannel)
+{
     for (IClockPtr clock : m_clocks) {
         clock->forward((samplesPerChannel * 1000000) / m_sampleRate);
     }
@@ -201,15 +275,14 @@ samples_t Mixer::process(float* outBuffer, samples_t samplesPerChannel)
         return 0;
     }
 
-    TracksData tracksData;
-    processTrackChannels(outBufferSize, samplesPerChannel, tracksData);
+    processTrackChannels(outBufferSize, samplesPerChannel);
 
     prepareAuxBuffers(outBufferSize);
 
     samples_t masterChannelSampleCount = 0;
 
-    for (auto& pair : tracksData) {
-        const std::vector<float>& trackBuffer = pair.second;
+    for (size_t i = 0; i < m_processedTrackChannels.size(); ++i) {
+        const std::vector<float>& trackBuffer = m_trackBuffers.at(i);
 
         bool outBufferIsSilent = false;
         mixOutputFromChannel(outBuffer, trackBuffer.data(), samplesPerChannel, outBufferIsSilent);
@@ -221,7 +294,7 @@ samples_t Mixer::process(float* outBuffer, samples_t samplesPerChannel)
             continue;
         }
 
-        const AuxSendsParams& auxSends = m_trackChannels.at(pair.first)->outputParams().auxSends;
+        const AuxSendsParams& auxSends = m_processedTrackChannels.at(i)->outputParams().auxSends;
         writeTrackToAuxBuffers(trackBuffer.data(), auxSends, samplesPerChannel);
     }
 
@@ -242,60 +315,69 @@ samples_t Mixer::process(float* outBuffer, samples_t samplesPerChannel)
     return masterChannelSampleCount;
 }
 
-void Mixer::processTrackChannels(size_t outBufferSize, size_t samplesPerChannel, TracksData& outTracksData)
+void Mixer::processTrackChannels(size_t outBufferSize, size_t samplesPerChannel)
 {
-    auto processChannel = [outBufferSize, samplesPerChannel](MixerChannelPtr channel) -> std::vector<float> {
-        thread_local std::vector<float> buffer(outBufferSize, 0.f);
-        thread_local std::vector<float> silent_buffer(outBufferSize, 0.f);
+    bool filterTracks = m_isIdle && !m_tracksToProcessWhenIdle.empty();
 
-        if (buffer.size() < outBufferSize) {
-            buffer.resize(outBufferSize, 0.f);
-            silent_buffer.resize(outBufferSize, 0.f);
+    m_processedTrackChannels.clear();
+    for (const auto& pair : m_trackChannels) {
+        if (filterTracks && !muse::contains(m_tracksToProcessWhenIdle, pair.second->trackId())) {
+            continue;
         }
 
-        buffer = silent_buffer;
-
-        if (channel) {
-            channel->process(buffer.data(), samplesPerChannel);
+        if (pair.second->muted()) {
+            pair.second->notifyNoAudioSignal();
+            continue;
         }
 
-        return buffer;
-    };
+        m_processedTrackChannels.push_back(pair.second.get());
+    }
 
-    bool filterTracks = m_isIdle && !m_tracksToProcessWhenIdle.empty();
+    //! NOTE The buffers only grow, so nothing is allocated per block
+    if (m_trackBuffers.size() < m_processedTrackChannels.size()) {
+        m_trackBuffers.resize(m_processedTrackChannels.size());
+    }
 
-    if (useMultithreading()) {
-        std::map<TrackId, std::future<std::vector<float> > > futures;
+    if (m_isProfiling) {
+        if (m_trackRenderTimesMs.size() < m_processedTrackChannels.size()) {
+            m_trackRenderTimesMs.resize(m_processedTrackChannels.size());
+            m_processedTrackIds.resize(m_processedTrackChannels.size());
+        }
 
-        for (const auto& pair : m_trackChannels) {
-            if (filterTracks && !muse::contains(m_tracksToProcessWhenIdle, pair.second->trackId())) {
-                continue;
-            }
+        for (size_t i = 0; i < m_processedTrackChannels.size(); ++i) {
+            m_processedTrackIds[i] = m_processedTrackChannels[i]->trackId();
+            m_trackRenderTimesMs[i] = 0.0;
+        }
 
-            if (pair.second->muted()) {
-                pair.second->notifyNoAudioSignal();
-                continue;
-            }
+        m_profiledTrackCount = m_processedTrackChannels.size();
+    }
 
-            std::future<std::vector<float> > future = m_taskScheduler->submit(processChannel, pair.second);
-            futures.emplace(pair.first, std::move(future));
+    auto processChannel = [this, outBufferSize, samplesPerChannel](size_t idx) {
+        std::vector<float>& buffer = m_trackBuffers[idx];
+        if (buffer.size() < outBufferSize) {
+            buffer.resize(outBufferSize, 0.f);
         }
 
-        for (auto& pair : futures) {
-            outTracksData.emplace(pair.first, pair.second.get());
+        std::fill(buffer.begin(), buffer.begin() + outBufferSize, 0.f);
+
+        if (!m_isProfiling) {
+            m_processedTrackChannels[idx]->process(buffer.data(), samplesPerChannel);
+            return;
         }
-    } else {
-        for (const auto& pair : m_trackChannels) {
-            if (filterTracks && !muse::contains(m_tracksToProcessWhenIdle, pair.second->trackId())) {
-                continue;
-            }
 
-            if (pair.second->muted()) {
-                pair.second->notifyNoAudioSignal();
-                continue;
-            }
+        const auto start = std::chrono::steady_clock::now();
+        m_processedTrackChannels[idx]->process(buffer.data(), samplesPerChannel);
+        const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+
+        // Each job writes only its own slot
+        m_trackRenderTimesMs[idx] = elapsed.count();
+    };
 
-            outTracksData.emplace(pair.first, processChannel(pair.second));
+    if (useMultithreading()) {
+        m_jobPool->run(m_processedTrackChannels.size(), processChannel);
+    } else {
+        for (size_t i = 0; i < m_processedTrackChannels.size(); ++i) {
+            processChannel(i);
         }
     }
 }
@@ -441,19 +523,8 @@ void Mixer::mixOutputFromChannel(float* outBuffer, const float* inBuffer, unsign
         return;
     }
 
-    for (samples_t s = 0; s < samplesCount; ++s) {
-        size_t samplePos = s * m_audioChannelsCount;
-
-        for (audioch_t audioChNum = 0; audioChNum < m_audioChannelsCount; ++audioChNum) {
-            size_t idx = samplePos + audioChNum;
-            float sample = inBuffer[idx];
-            outBuffer[idx] += sample;
-
-            if (outBufferIsSilent && !RealIsNull(sample)) {
-                outBufferIsSilent = false;
-            }
-        }
-    }
+    float peak = dsp::mixSamples(outBuffer, inBuffer, samplesCount * m_audioChannelsCount);
+    outBufferIsSilent = RealIsNull(peak);
 }
 
 void Mixer::prepareAuxBuffers(size_t outBufferSize)
@@ -490,17 +561,7 @@ void Mixer::writeTrackToAuxBuffers(const float* trackBuffer, const AuxSendsParam
             continue;
         }
 
-        float* auxBuffer = aux.buffer.data();
-        float signalAmount = auxSend.signalAmount;
-
-        for (samples_t s = 0; s < samplesPerChannel; ++s) {
-            size_t samplePos = s * m_audioChannelsCount;
-
-            for (audioch_t audioChNum = 0; audioChNum < m_audioChannelsCount; ++audioChNum) {
-                size_t idx = samplePos + audioChNum;
-                auxBuffer[idx] += trackBuffer[idx] * signalAmount;
-            }
-        }
+        dsp::mixSamplesWithGain(aux.buffer.data(), trackBuffer, auxSend.signalAmount, samplesPerChannel * m_audioChannelsCount);
 
         aux.receivedAudioSignal = true;
     }
@@ -527,32 +588,24 @@ void Mixer::completeOutput(float* buffer, samples_t samplesPerChannel)
         return;
     }
 
-    m_isSilence = true;
-
     float totalSquaredSum = 0.f;
     float volume = muse::db_to_linear(m_masterParams.volume);
 
-    for (audioch_t audioChNum = 0; audioChNum < m_audioChannelsCount; ++audioChNum) {
-        float singleChannelSquaredSum = 0.f;
-
-        gain_t totalGain = dsp::balanceGain(m_masterParams.balance, audioChNum) * volume;
-
-        for (samples_t s = 0; s < samplesPerChannel; ++s) {
-            int idx = s * m_audioChannelsCount + audioChNum;
+    m_channelGains.resize(m_audioChannelsCount);
+    m_channelSquaredSums.assign(m_audioChannelsCount, 0.f);
 
-            float resultSample = buffer[idx] * totalGain;
-            buffer[idx] = resultSample;
+    for (audioch_t audioChNum = 0; audioChNum < m_audioChannelsCount; ++audioChNum) {
+        m_channelGains[audioChNum] = dsp::balanceGain(m_masterParams.balance, audioChNum) * volume;
+    }
 
-            if (m_isSilence && !RealIsNull(resultSample)) {
-                m_isSilence = false;
-            }
+    float peak = dsp::applyChannelGains(buffer, m_audioChannelsCount, samplesPerChannel,
+                                        m_channelGains.data(), m_channelSquaredSums.data());
+    m_isSilence = RealIsNull(peak);
 
-            float squaredSample = resultSample * resultSample;
-            totalSquaredSum += squaredSample;
-            singleChannelSquaredSum += squaredSample;
-        }
+    for (audioch_t audioChNum = 0; audioChNum < m_audioChannelsCount; ++audioChNum) {
+        totalSquaredSum += m_channelSquaredSums[audioChNum];
 
-        float rms = dsp::samplesRootMeanSquare(singleChannelSquaredSum, samplesPerChannel);
+        float rms = dsp::samplesRootMeanSquare(m_channelSquaredSums[audioChNum], samplesPerChannel);
         m_audioSignalNotifier.updateSignalValues(audioChNum, rms);
     }
 
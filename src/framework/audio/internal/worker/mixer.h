@@ -24,6 +24,7 @@
 
 #include <memory>
 #include <map>
+#include <vector>
 
 #include "global/modularity/ioc.h"
 #include "global/async/asyncable.h"
@@ -38,10 +39,11 @@
 #include "iclock.h"
 
 namespace muse {
-class TaskScheduler;
+class JobPool;
 }
 
 namespace muse::audio {
+class AudioProfiler;
 class Mixer : public AbstractAudioSource, public Injectable, public async::Asyncable, public std::enable_shared_from_this<Mixer>
 {
     Inject<fx::IFxResolver> fxResolver = { this };
@@ -72,6 +74,8 @@ public:
     void setIsIdle(bool idle);
     void setTracksToProcessWhenIdle(std::unordered_set<TrackId>&& trackIds);
 
+    void setProfiler(AudioProfiler* profiler);
+
     // IAudioSource
     void setSampleRate(unsigned int sampleRate) override;
     unsigned int audioChannelsCount() const override;
@@ -79,9 +83,10 @@ public:
     void setIsActive(bool arg) override;
 
 private:
-    using TracksData = std::map<TrackId, std::vector<float> >;
-
-    void processTrackChannels(size_t outBufferSize, size_t samplesPerChannel, TracksData& outTracksData);
+    samples_t mixBlock(float* outBuffer, samples_t samplesPerChannel);
+    samples_t mixFrames(float* outBuffer, samples_t samplesPerChannel);
+    samples_t framesToLoopEnd(samples_t samplesPerChannel) const;
+    void processTrackChannels(size_t outBufferSize, size_t samplesPerChannel);
     void mixOutputFromChannel(float* outBuffer, const float* inBuffer, unsigned int samplesCount, bool& outBufferIsSilent);
     void prepareAuxBuffers(size_t outBufferSize);
     void writeTrackToAuxBuffers(const float* trackBuffer, const AuxSendsParams& auxSends, samples_t samplesPerChannel);
@@ -94,7 +99,19 @@ private:
 
     msecs_t currentTime() const;
 
-    std::unique_ptr<TaskScheduler> m_taskScheduler;
+    std::unique_ptr<JobPool> m_jobPool;
+
+    // Reused for every block, one buffer per processed track
+    std::vector<MixerChannel*> m_processedTrackChannels;
+    std::vector<std::vector<float> > m_trackBuffers;
+
+    AudioProfiler* m_profiler = nullptr;
+    bool m_isProfiling = false;
+    size_t m_profiledTrackCount = 0;
+
+    // Reused for every block while profiling, one value per processed track
+    std::vector<TrackId> m_processedTrackIds;
+    std::vector<double> m_trackRenderTimesMs;
 
     size_t m_minTrackCountForMultithreading = 0;
     size_t m_nonMutedTrackCount = 0;
@@ -121,6 +138,10 @@ private:
 
     mutable AudioSignalsNotifier m_audioSignalNotifier;
 
+    // Reused for every block, one value per audio channel
+    std::vector<float> m_channelGains;
+    std::vector<float> m_channelSquaredSums;
+
     bool m_isSilence = false;
     bool m_isIdle = false;
 };
@@ -24,6 +24,7 @@
 #include <algorithm>
 
 #include "internal/dsp/audiomathutils.h"
+#include "internal/dsp/audiovectorops.h"
 #include "internal/audiosanitizer.h"
 
 #include "log.h"
@@ -32,6 +33,9 @@ using namespace muse;
 using namespace muse::audio;
 using namespace muse::async;
 
+//! NOTE How long the effects keep processing after the source became silent, so that their tails (e.g. reverb) can decay
+static constexpr float FX_TAIL_SECS = 5.f;
+
 MixerChannel::MixerChannel(const TrackId trackId, IAudioSourcePtr source, const unsigned int sampleRate,
                            const modularity::ContextPtr& iocCtx)
     : Injectable(iocCtx), m_trackId(trackId),
@@ -86,8 +90,27 @@ void MixerChannel::applyOutputParams(const AudioOutputParams& requiredParams)
         return;
     }
 
+    AudioOutputParams resultParams = requiredParams;
+
+    //! NOTE Volume, balance and mute changes are frequent (ex. fader moves), keep the fx as they are
+    if (m_params.fxChain != requiredParams.fxChain) {
+        applyFxChain(resultParams);
+    }
+
+    bool mutedChanged = m_params.muted != resultParams.muted;
+
+    m_params = resultParams;
+    m_paramsChanges.send(std::move(resultParams));
+
+    if (mutedChanged) {
+        m_mutedChanged.notify();
+    }
+}
+
+void MixerChannel::applyFxChain(AudioOutputParams& resultParams)
+{
     m_fxProcessors.clear();
-    m_fxProcessors = fxResolver()->resolveFxList(m_trackId, requiredParams.fxChain);
+    m_fxProcessors = fxResolver()->resolveFxList(m_trackId, resultParams.fxChain);
 
     for (IFxProcessorPtr& fx : m_fxProcessors) {
         fx->setSampleRate(m_sampleRate);
@@ -98,8 +121,6 @@ void MixerChannel::applyOutputParams(const AudioOutputParams& requiredParams)
         });
     }
 
-    AudioOutputParams resultParams = requiredParams;
-
     auto findFxProcessor = [this](const std::pair<AudioFxChainOrder, AudioFxParams>& params) -> IFxProcessorPtr {
         for (IFxProcessorPtr& fx : m_fxProcessors) {
             if (fx->params().chainOrder != params.first) {
@@ -122,15 +143,6 @@ void MixerChannel::applyOutputParams(const AudioOutputParams& requiredParams)
             it = resultParams.fxChain.erase(it);
         }
     }
-
-    bool mutedChanged = m_params.muted != resultParams.muted;
-
-    m_params = resultParams;
-    m_paramsChanges.send(std::move(resultParams));
-
-    if (mutedChanged) {
-        m_mutedChanged.notify();
-    }
 }
 
 async::Channel<AudioOutputParams> MixerChannel::outputParamsChanged() const
@@ -163,6 +175,8 @@ void MixerChannel::setSampleRate(unsigned int sampleRate)
 {
     ONLY_AUDIO_WORKER_THREAD;
 
+    m_sampleRate = sampleRate;
+
     if (m_audioSource) {
         m_audioSource->setSampleRate(sampleRate);
     }
@@ -203,6 +217,22 @@ samples_t MixerChannel::process(float* buffer, samples_t samplesPerChannel)
         return processedSamplesCount;
     }
 
+    //! NOTE A tacet instrument: once its source has been silent for longer than the effects tail,
+    //! the effects and the output stage would only process zeros, so they are skipped
+    const size_t sampleCount = samplesPerChannel * audioChannelsCount();
+    if (RealIsNull(dsp::peakSample(buffer, sampleCount))) {
+        m_silentFrames += samplesPerChannel;
+    } else {
+        m_silentFrames = 0;
+    }
+
+    if (m_silentFrames > silenceTailFrames()) {
+        std::fill(buffer, buffer + sampleCount, 0.f);
+        notifyNoAudioSignal();
+
+        return 0;
+    }
+
     for (IFxProcessorPtr fx : m_fxProcessors) {
         if (!fx->active()) {
             continue;
@@ -215,29 +245,40 @@ samples_t MixerChannel::process(float* buffer, samples_t samplesPerChannel)
     return processedSamplesCount;
 }
 
+samples_t MixerChannel::silenceTailFrames() const
+{
+    bool hasActiveFx = m_compressor->isActive();
+
+    for (const IFxProcessorPtr& fx : m_fxProcessors) {
+        hasActiveFx |= fx->active();
+    }
+
+    if (!hasActiveFx) {
+        return 0;
+    }
+
+    return static_cast<samples_t>(FX_TAIL_SECS * m_sampleRate);
+}
+
 void MixerChannel::completeOutput(float* buffer, unsigned int samplesCount) const
 {
     unsigned int channelsCount = audioChannelsCount();
     float volume = muse::db_to_linear(m_params.volume);
     float totalSquaredSum = 0.f;
 
-    for (audioch_t audioChNum = 0; audioChNum < channelsCount; ++audioChNum) {
-        float singleChannelSquaredSum = 0.f;
-
-        gain_t totalGain = dsp::balanceGain(m_params.balance, audioChNum) * volume;
+    m_channelGains.resize(channelsCount);
+    m_channelSquaredSums.assign(channelsCount, 0.f);
 
-        for (unsigned int s = 0; s < samplesCount; ++s) {
-            int idx = s * channelsCount + audioChNum;
+    for (audioch_t audioChNum = 0; audioChNum < channelsCount; ++audioChNum) {
+        m_channelGains[audioChNum] = dsp::balanceGain(m_params.balance, audioChNum) * volume;
+    }
 
-            float resultSample = buffer[idx] * totalGain;
-            buffer[idx] = resultSample;
+    dsp::applyChannelGains(buffer, static_cast<audioch_t>(channelsCount), samplesCount, m_channelGains.data(), m_channelSquaredSums.data());
 
-            float squaredSample = resultSample * resultSample;
-            singleChannelSquaredSum += squaredSample;
-            totalSquaredSum += squaredSample;
-        }
+    for (audioch_t audioChNum = 0; audioChNum < channelsCount; ++audioChNum) {
+        totalSquaredSum += m_channelSquaredSums[audioChNum];
 
-        float rms = dsp::samplesRootMeanSquare(singleChannelSquaredSum, samplesCount);
+        float rms = dsp::samplesRootMeanSquare(m_channelSquaredSums[audioChNum], samplesCount);
         m_audioSignalNotifier.updateSignalValues(audioChNum, rms);
     }
 
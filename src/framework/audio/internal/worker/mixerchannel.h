@@ -65,7 +65,9 @@ public:
     samples_t process(float* buffer, samples_t samplesPerChannel) override;
 
 private:
+    void applyFxChain(AudioOutputParams& resultParams);
     void completeOutput(float* buffer, unsigned int samplesCount) const;
+    samples_t silenceTailFrames() const;
 
     TrackId m_trackId = -1;
 
@@ -78,9 +80,16 @@ private:
 
     dsp::CompressorPtr m_compressor = nullptr;
 
+    // How long the source has been silent
+    samples_t m_silentFrames = 0;
+
     async::Notification m_mutedChanged;
     mutable async::Channel<AudioOutputParams> m_paramsChanges;
     mutable AudioSignalsNotifier m_audioSignalNotifier;
+
+    // Reused for every block, one value per audio channel
+    mutable std::vector<float> m_channelGains;
+    mutable std::vector<float> m_channelSquaredSums;
 };
 
 using MixerChannelPtr = std::shared_ptr<MixerChannel>;
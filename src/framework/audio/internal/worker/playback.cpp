@@ -145,6 +145,15 @@ IAudioOutputPtr Playback::audioOutput() const
     return m_audioOutputPtr;
 }
 
+void Playback::processCommands()
+{
+    ONLY_AUDIO_WORKER_THREAD;
+
+    if (m_audioOutputPtr) {
+        m_audioOutputPtr->processCommands();
+    }
+}
+
 ITrackSequencePtr Playback::sequence(const TrackSequenceId id) const
 {
     ONLY_AUDIO_WORKER_THREAD;
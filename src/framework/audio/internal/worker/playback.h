@@ -34,6 +34,8 @@
 #include "iplayback.h"
 
 namespace muse::audio {
+class AudioOutputHandler;
+
 class Playback : public IPlayback, public IGetTrackSequence, public Injectable, public async::Asyncable
 {
 public:
@@ -56,13 +58,15 @@ public:
     ITracksPtr tracks() const override;
     IAudioOutputPtr audioOutput() const override;
 
+    void processCommands();
+
 protected:
     // IGetTrackSequence
     ITrackSequencePtr sequence(const TrackSequenceId id) const override;
 
 private:
     ITracksPtr m_trackHandlersPtr = nullptr;
-    IAudioOutputPtr m_audioOutputPtr = nullptr;
+    std::shared_ptr<AudioOutputHandler> m_audioOutputPtr = nullptr;
 
     std::map<TrackSequenceId, ITrackSequencePtr> m_sequences;
 
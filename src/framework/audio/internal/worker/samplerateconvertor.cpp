@@ -22,6 +22,9 @@
 #include "samplerateconvertor.h"
 
 #include <cmath>
+#include <numeric>
+
+#include "../dsp/audiovectorops.h"
 
 #include "log.h"
 
@@ -36,10 +39,15 @@ SampleRateConvertor::SampleRateConvertor(const std::vector<float>& data,
     m_fir.resize(FIR_LENGTH, 0);
     m_y.resize(FIR_LENGTH, 0);
     initWindow();
+    initFilterBank();
 }
 
 std::vector<float> SampleRateConvertor::convert()
 {
+    if (m_method == POLYPHASE) {
+        updateChannelData();
+    }
+
     std::vector<float> out;
     auto resultSamples = m_data.size() * m_sampleRateOut / (m_channelsCount * m_sampleRateIn);
 
@@ -58,6 +66,10 @@ unsigned int SampleRateConvertor::convert(float* buffer, unsigned int from, unsi
     unsigned int sample = from;
     unsigned int converted = 0;
 
+    if (m_method == POLYPHASE) {
+        updateChannelData();
+    }
+
     for (converted = 0; converted < count; ++converted, ++sample) {
         for (unsigned int channel = 0; channel < m_channelsCount; ++channel) {
             if (!availableSamples(sample)) {
@@ -76,6 +88,8 @@ float SampleRateConvertor::y(unsigned int sample, unsigned int channel) const
         return ySinc(sample, channel);
     case FIR:
         return yFIR(sample, channel);
+    case POLYPHASE:
+        return yPolyphase(sample, channel);
     }
     return 0.f;
 }
@@ -83,6 +97,9 @@ float SampleRateConvertor::y(unsigned int sample, unsigned int channel) const
 void SampleRateConvertor::setChannelCount(unsigned int count)
 {
     m_channelsCount = count;
+
+    //! NOTE the input data is usually reloaded together with the channel count
+    m_channelDataSource = nullptr;
 }
 
 void SampleRateConvertor::setSampleRateIn(unsigned int sampleRate)
@@ -90,6 +107,7 @@ void SampleRateConvertor::setSampleRateIn(unsigned int sampleRate)
     if (m_sampleRateIn != sampleRate) {
         m_sampleRateIn = sampleRate;
         initWindow();
+        initFilterBank();
     }
 }
 
@@ -98,6 +116,23 @@ void SampleRateConvertor::setSampleRateOut(unsigned int sampleRate)
     if (m_sampleRateOut != sampleRate) {
         m_sampleRateOut = sampleRate;
         initWindow();
+        initFilterBank();
+    }
+}
+
+void SampleRateConvertor::setMethod(Method method)
+{
+    m_method = method;
+}
+
+void SampleRateConvertor::setQuality(Quality quality)
+{
+    if (m_quality != quality) {
+        m_quality = quality;
+        initFilterBank();
+
+        //! the padding of the channel data depends on the filter length
+        m_channelDataSource = nullptr;
     }
 }
 
@@ -137,6 +172,40 @@ float SampleRateConvertor::yFIR(unsigned int sample, unsigned int channel) const
     return y;
 }
 
+float SampleRateConvertor::yPolyphase(unsigned int sample, unsigned int channel) const
+{
+    if (channel >= m_channelData.size() || m_taps == 0) {
+        return 0.f;
+    }
+
+    const std::vector<float>& x = m_channelData[channel];
+
+    uint64_t position = static_cast<uint64_t>(sample) * m_polyphaseM;
+    uint64_t inputSample = position / m_polyphaseL;
+    uint64_t phase = position % m_polyphaseL;
+
+    //! NOTE the channel data is padded with m_taps zeros on both sides
+    uint64_t first = inputSample + m_taps - (m_taps / 2 - 1);
+    if (first + m_taps > x.size()) {
+        return 0.f;
+    }
+
+    const float* input = x.data() + first;
+
+    if (!m_interpolatePhases) {
+        return dsp::dotProduct(input, m_filterBank.data() + phase * m_taps, m_taps);
+    }
+
+    double phasePosition = phase * m_phasesCount / static_cast<double>(m_polyphaseL);
+    size_t nearestPhase = static_cast<size_t>(phasePosition);
+    float fraction = static_cast<float>(phasePosition - nearestPhase);
+
+    float y0 = dsp::dotProduct(input, m_filterBank.data() + nearestPhase * m_taps, m_taps);
+    float y1 = dsp::dotProduct(input, m_filterBank.data() + (nearestPhase + 1) * m_taps, m_taps);
+
+    return y0 + (y1 - y0) * fraction;
+}
+
 bool SampleRateConvertor::availableSamples(unsigned int sample) const
 {
     float currentOutputSampleTime = sample / static_cast<float>(m_sampleRateOut);
@@ -165,6 +234,124 @@ inline double zeroBessel(double x)
     return s;
 }
 
+static double besselI0(double x)
+{
+    double sum = 1.0;
+    double term = 1.0;
+    double halfX = x / 2.0;
+
+    for (int k = 1; k < 50; ++k) {
+        term *= halfX / k;
+        double squaredTerm = term * term;
+        sum += squaredTerm;
+
+        if (squaredTerm < sum * 1e-12) {
+            break;
+        }
+    }
+
+    return sum;
+}
+
+void SampleRateConvertor::initFilterBank()
+{
+    m_filterBank.clear();
+
+    if (m_sampleRateIn == 0 || m_sampleRateOut == 0) {
+        m_taps = 0;
+        return;
+    }
+
+    double kaiserBeta = 0;
+    double rolloff = 0;
+
+    switch (m_quality) {
+    case Quality::Low:
+        m_taps = 16;
+        kaiserBeta = 5.0;      // ~ 50 dB
+        rolloff = 0.90;
+        break;
+    case Quality::Medium:
+        m_taps = 32;
+        kaiserBeta = 8.0;      // ~ 80 dB
+        rolloff = 0.94;
+        break;
+    case Quality::High:
+        m_taps = 64;
+        kaiserBeta = 10.0;     // ~ 100 dB
+        rolloff = 0.97;
+        break;
+    }
+
+    unsigned int divider = std::gcd(m_sampleRateIn, m_sampleRateOut);
+    m_polyphaseM = m_sampleRateIn / divider;
+    m_polyphaseL = m_sampleRateOut / divider;
+
+    m_interpolatePhases = m_polyphaseL > MAX_PHASES_COUNT;
+    m_phasesCount = m_interpolatePhases ? INTERPOLATED_PHASES_COUNT : static_cast<unsigned int>(m_polyphaseL);
+
+    //! cutoff relative to the input Nyquist frequency, lowered when downsampling
+    double cutoff = rolloff * std::min(1.0, m_sampleRateOut / static_cast<double>(m_sampleRateIn));
+    double halfLength = m_taps / 2.0;
+    double windowNorm = besselI0(kaiserBeta);
+
+    //! one extra phase equal to the first one shifted by a sample, used by the interpolation
+    m_filterBank.resize(static_cast<size_t>(m_phasesCount + 1) * m_taps);
+
+    for (unsigned int phase = 0; phase <= m_phasesCount; ++phase) {
+        float* coefficients = m_filterBank.data() + static_cast<size_t>(phase) * m_taps;
+        double fraction = phase / static_cast<double>(m_phasesCount);
+        double sum = 0;
+
+        for (unsigned int k = 0; k < m_taps; ++k) {
+            double distance = fraction + halfLength - 1 - k;
+            double relative = distance / halfLength;
+
+            double window = std::abs(relative) < 1.0 ? besselI0(kaiserBeta * std::sqrt(1.0 - relative * relative)) / windowNorm : 0.0;
+            double arg = M_PI * cutoff * distance;
+            double sinc = arg == 0 ? 1.0 : std::sin(arg) / arg;
+
+            double value = cutoff * sinc * window;
+            coefficients[k] = static_cast<float>(value);
+            sum += value;
+        }
+
+        //! NOTE keep the DC gain of every phase at unity to avoid a ripple at the output
+        if (sum != 0) {
+            for (unsigned int k = 0; k < m_taps; ++k) {
+                coefficients[k] = static_cast<float>(coefficients[k] / sum);
+            }
+        }
+    }
+}
+
+void SampleRateConvertor::updateChannelData()
+{
+    if (m_channelDataSource == m_data.data() && m_channelDataSourceSize == m_data.size()
+        && m_channelData.size() == m_channelsCount) {
+        return;
+    }
+
+    m_channelDataSource = m_data.data();
+    m_channelDataSourceSize = m_data.size();
+    m_channelData.resize(m_channelsCount);
+
+    if (m_channelsCount == 0) {
+        return;
+    }
+
+    size_t framesCount = m_data.size() / m_channelsCount;
+
+    for (unsigned int channel = 0; channel < m_channelsCount; ++channel) {
+        std::vector<float>& x = m_channelData[channel];
+        x.assign(framesCount + 2 * static_cast<size_t>(m_taps), 0.f);
+
+        for (size_t frame = 0; frame < framesCount; ++frame) {
+            x[m_taps + frame] = m_data[frame * m_channelsCount + channel];
+        }
+    }
+}
+
 void SampleRateConvertor::initWindow()
 {
     int max = std::max(m_sampleRateIn, m_sampleRateOut), min = std::min(m_sampleRateIn, m_sampleRateOut);
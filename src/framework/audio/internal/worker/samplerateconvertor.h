@@ -22,6 +22,8 @@
 #ifndef MUSE_AUDIO_SAMPLERATECONVERTOR_H
 #define MUSE_AUDIO_SAMPLERATECONVERTOR_H
 
+#include <cstddef>
+#include <cstdint>
 #include <vector>
 #include <deque>
 
@@ -30,8 +32,16 @@ class SampleRateConvertor
 {
 public:
     enum Method {
-        SINC, FIR
+        SINC, FIR, POLYPHASE
     };
+
+    //! defines the length of the polyphase filters and the attenuation of their stop band
+    enum class Quality {
+        Low,
+        Medium,
+        High
+    };
+
     explicit SampleRateConvertor(const std::vector<float>& data, unsigned int channelsCount, unsigned int sampleRateIn,
                                  unsigned int sampleRateOut);
 
@@ -45,6 +55,9 @@ public:
     void setSampleRateIn(unsigned int sampleRate);
     void setSampleRateOut(unsigned int sampleRate);
 
+    void setMethod(Method method);
+    void setQuality(Quality quality);
+
 private:
 
     //! return value of sinc function (LPF) with consideration of used sampleRates
@@ -54,6 +67,7 @@ private:
     float y(unsigned int sample, unsigned int channel) const;
     float ySinc(unsigned int sample, unsigned int channel) const;
     float yFIR(unsigned int sample, unsigned int channel) const;
+    float yPolyphase(unsigned int sample, unsigned int channel) const;
 
     //! return true if there are samples in input buffer for conversion
     bool availableSamples(unsigned int sample) const;
@@ -61,6 +75,12 @@ private:
     //! calculate window function values
     void initWindow();
 
+    //! precalculate the windowed sinc filter of every phase for the current sample rates and quality
+    void initFilterBank();
+
+    //! copy the interleaved input into the zero padded channel buffers used by the polyphase filters
+    void updateChannelData();
+
     const static unsigned int USE_SAMPLES = 16; //!< this value defines the quality and complexity of SRC.
     const std::vector<float>& m_data;
 
@@ -70,10 +90,24 @@ private:
     std::vector<float> m_fir;
     mutable std::deque<float> m_y;
 
+    //! the phases are exact while out / gcd(in, out) fits, otherwise the nearest two phases are interpolated
+    const static unsigned int MAX_PHASES_COUNT = 1024;
+    const static unsigned int INTERPOLATED_PHASES_COUNT = 256;
+    Quality m_quality = Quality::Medium;
+    unsigned int m_taps = 0;
+    unsigned int m_phasesCount = 0;
+    bool m_interpolatePhases = false;
+    uint64_t m_polyphaseM = 1, m_polyphaseL = 1;
+    std::vector<float> m_filterBank; //!< m_taps coefficients for each of m_phasesCount + 1 phases
+
+    std::vector<std::vector<float> > m_channelData;
+    const float* m_channelDataSource = nullptr;
+    size_t m_channelDataSourceSize = 0;
+
     unsigned int m_channelsCount;
     unsigned int m_sampleRateIn;
     unsigned int m_sampleRateOut;
-    Method m_method = FIR;
+    Method m_method = POLYPHASE;
 };
 }
 
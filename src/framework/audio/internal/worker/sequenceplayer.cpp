@@ -40,6 +40,17 @@ SequencePlayer::SequencePlayer(IGetTracks* getTracks, IClockPtr clock, const mod
     m_clock->statusChanged().onReceive(this, [this](const PlaybackStatus status) {
         setAllTracksActive(status == PlaybackStatus::Running);
     });
+
+    //! NOTE The playback may start while some tracks are still loading,
+    //! let them join it at the current position
+    m_getTracks->trackAboutToBeAdded().onReceive(this, [this](TrackPtr trackPtr) {
+        if (!trackPtr || !trackPtr->inputHandler || m_clock->status() != PlaybackStatus::Running) {
+            return;
+        }
+
+        trackPtr->inputHandler->seek(m_clock->currentTime());
+        trackPtr->inputHandler->setIsActive(true);
+    });
 }
 
 void SequencePlayer::play()
@@ -0,0 +1,155 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2024 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "trackrendercache.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+
+using namespace muse;
+using namespace muse::audio;
+
+static constexpr samples_t CHUNK_FRAMES = 8192;
+
+//! NOTE Shared by the caches of all tracks; when it is used up, the caches just stop growing
+static constexpr size_t MAX_CACHED_BYTES = 512 * 1024 * 1024;
+static std::atomic<size_t> s_cachedBytes = 0;
+
+TrackRenderCache::~TrackRenderCache()
+{
+    clear();
+}
+
+bool TrackRenderCache::read(samples_t frame, samples_t framesCount, audioch_t audioChannelsCount, float* buffer) const
+{
+    if (audioChannelsCount != m_audioChannelsCount || framesCount == 0) {
+        return false;
+    }
+
+    const samples_t endFrame = frame + framesCount;
+
+    for (samples_t f = frame; f < endFrame;) {
+        const size_t idx = f / CHUNK_FRAMES;
+        if (idx >= m_chunks.size() || !m_chunks[idx]) {
+            return false;
+        }
+
+        const samples_t chunkStart = idx * CHUNK_FRAMES;
+        const samples_t from = f - chunkStart;
+        const samples_t to = std::min(endFrame - chunkStart, CHUNK_FRAMES);
+
+        const Chunk* chunk = m_chunks[idx].get();
+        if (from < chunk->filledFrom || to > chunk->filledTo) {
+            return false;
+        }
+
+        f = chunkStart + to;
+    }
+
+    for (samples_t f = frame; f < endFrame;) {
+        const size_t idx = f / CHUNK_FRAMES;
+        const samples_t chunkStart = idx * CHUNK_FRAMES;
+        const samples_t from = f - chunkStart;
+        const samples_t to = std::min(endFrame - chunkStart, CHUNK_FRAMES);
+
+        std::memcpy(buffer + (f - frame) * audioChannelsCount,
+                    m_chunks[idx]->samples.data() + from * audioChannelsCount,
+                    (to - from) * audioChannelsCount * sizeof(float));
+
+        f = chunkStart + to;
+    }
+
+    return true;
+}
+
+void TrackRenderCache::write(samples_t frame, samples_t framesCount, audioch_t audioChannelsCount, const float* buffer)
+{
+    if (audioChannelsCount != m_audioChannelsCount) {
+        clear();
+        m_audioChannelsCount = audioChannelsCount;
+    }
+
+    const samples_t endFrame = frame + framesCount;
+
+    for (samples_t f = frame; f < endFrame;) {
+        const size_t idx = f / CHUNK_FRAMES;
+        const samples_t chunkStart = idx * CHUNK_FRAMES;
+        const samples_t from = f - chunkStart;
+        const samples_t to = std::min(endFrame - chunkStart, CHUNK_FRAMES);
+
+        Chunk* chunk = ensureChunk(idx);
+        if (!chunk) {
+            return;
+        }
+
+        std::memcpy(chunk->samples.data() + from * audioChannelsCount,
+                    buffer + (f - frame) * audioChannelsCount,
+                    (to - from) * audioChannelsCount * sizeof(float));
+
+        //! NOTE Only one contiguous range per chunk is tracked, a disjoint write replaces it
+        if (chunk->filledFrom == chunk->filledTo || from > chunk->filledTo || to < chunk->filledFrom) {
+            chunk->filledFrom = from;
+            chunk->filledTo = to;
+        } else {
+            chunk->filledFrom = std::min(chunk->filledFrom, from);
+            chunk->filledTo = std::max(chunk->filledTo, to);
+        }
+
+        f = chunkStart + to;
+    }
+}
+
+void TrackRenderCache::clear()
+{
+    for (const std::unique_ptr<Chunk>& chunk : m_chunks) {
+        if (chunk) {
+            s_cachedBytes -= chunk->samples.size() * sizeof(float);
+        }
+    }
+
+    m_chunks.clear();
+}
+
+TrackRenderCache::Chunk* TrackRenderCache::ensureChunk(size_t idx)
+{
+    if (idx < m_chunks.size() && m_chunks[idx]) {
+        return m_chunks[idx].get();
+    }
+
+    const size_t samplesCount = CHUNK_FRAMES * m_audioChannelsCount;
+    const size_t bytes = samplesCount * sizeof(float);
+
+    if (s_cachedBytes.fetch_add(bytes) + bytes > MAX_CACHED_BYTES) {
+        s_cachedBytes -= bytes;
+        return nullptr;
+    }
+
+    if (idx >= m_chunks.size()) {
+        m_chunks.resize(idx + 1);
+    }
+
+    m_chunks[idx] = std::make_unique<Chunk>();
+    m_chunks[idx]->samples.resize(samplesCount, 0.f);
+
+    return m_chunks[idx].get();
+}
@@ -0,0 +1,66 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2024 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef MUSE_AUDIO_TRACKRENDERCACHE_H
+#define MUSE_AUDIO_TRACKRENDERCACHE_H
+
+#include <memory>
+#include <vector>
+
+#include "../../audiotypes.h"
+
+namespace muse::audio {
+//! Keeps the audio a track has rendered during playback, indexed by frame,
+//! so that playing the same range again doesn't need the synthesizer.
+//! The owner clears it whenever anything that affects the rendering changes
+class TrackRenderCache
+{
+public:
+    TrackRenderCache() = default;
+    ~TrackRenderCache();
+
+    TrackRenderCache(const TrackRenderCache&) = delete;
+    TrackRenderCache& operator=(const TrackRenderCache&) = delete;
+
+    //! Copies the frames into the buffer only if all of them are cached
+    bool read(samples_t frame, samples_t framesCount, audioch_t audioChannelsCount, float* buffer) const;
+    void write(samples_t frame, samples_t framesCount, audioch_t audioChannelsCount, const float* buffer);
+
+    void clear();
+
+private:
+    struct Chunk {
+        std::vector<float> samples;
+
+        // Frames within the chunk that hold rendered audio
+        samples_t filledFrom = 0;
+        samples_t filledTo = 0;
+    };
+
+    Chunk* ensureChunk(size_t idx);
+
+    std::vector<std::unique_ptr<Chunk> > m_chunks;
+    audioch_t m_audioChannelsCount = 0;
+};
+}
+
+#endif // MUSE_AUDIO_TRACKRENDERCACHE_H
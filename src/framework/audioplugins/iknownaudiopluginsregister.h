@@ -46,6 +46,9 @@ public:
     virtual bool exists(const io::path_t& pluginPath) const = 0;
     virtual bool exists(const audio::AudioResourceId& resourceId) const = 0;
 
+    //! NOTE Whether the plugin file has been modified since it was registered
+    virtual bool isChanged(const io::path_t& pluginPath) const = 0;
+
     virtual Ret registerPlugin(const AudioPluginInfo& info) = 0;
     virtual Ret unregisterPlugin(const audio::AudioResourceId& resourceId) = 0;
 };
@@ -109,6 +109,7 @@ Ret KnownAudioPluginsRegister::load()
     m_loaded = false;
     m_pluginInfoMap.clear();
     m_pluginPaths.clear();
+    m_pluginModifiedTimes.clear();
 
     io::path_t knownAudioPluginsPath = configuration()->knownAudioPluginsFilePath();
     if (!fileSystem()->exists(knownAudioPluginsPath)) {
@@ -140,6 +141,11 @@ Ret KnownAudioPluginsRegister::load()
         info.enabled = object.value("enabled").toBool();
         info.errorCode = object.value("errorCode").toInt();
 
+        std::string modified = object.value("modified").toStdString();
+        if (!modified.empty()) {
+            m_pluginModifiedTimes.insert_or_assign(info.path, DateTime::fromStringISOFormat(String::fromStdString(modified)));
+        }
+
         m_pluginPaths.insert(info.path);
         m_pluginInfoMap.emplace(info.meta.id, std::move(info));
     }
@@ -186,6 +192,16 @@ bool KnownAudioPluginsRegister::exists(const AudioResourceId& resourceId) const
     return muse::contains(m_pluginInfoMap, resourceId);
 }
 
+bool KnownAudioPluginsRegister::isChanged(const io::path_t& pluginPath) const
+{
+    auto it = m_pluginModifiedTimes.find(pluginPath);
+    if (it == m_pluginModifiedTimes.end()) {
+        return false;
+    }
+
+    return fileSystem()->lastModified(pluginPath) != it->second;
+}
+
 Ret KnownAudioPluginsRegister::registerPlugin(const AudioPluginInfo& info)
 {
     IF_ASSERT_FAILED(m_loaded) {
@@ -202,6 +218,11 @@ Ret KnownAudioPluginsRegister::registerPlugin(const AudioPluginInfo& info)
     m_pluginInfoMap.emplace(info.meta.id, info);
     m_pluginPaths.insert(info.path);
 
+    DateTime modified = fileSystem()->lastModified(info.path);
+    if (modified != DateTime()) {
+        m_pluginModifiedTimes.insert_or_assign(info.path, modified);
+    }
+
     Ret ret = writePluginsInfo();
     return ret;
 }
@@ -219,6 +240,7 @@ Ret KnownAudioPluginsRegister::unregisterPlugin(const AudioResourceId& resourceI
     for (const auto& pair : m_pluginInfoMap) {
         if (pair.first == resourceId) {
             muse::remove(m_pluginPaths, pair.second.path);
+            m_pluginModifiedTimes.erase(pair.second.path);
         }
     }
 
@@ -246,6 +268,11 @@ Ret KnownAudioPluginsRegister::writePluginsInfo()
             obj.set("errorCode", info.errorCode);
         }
 
+        auto modifiedIt = m_pluginModifiedTimes.find(info.path);
+        if (modifiedIt != m_pluginModifiedTimes.end()) {
+            obj.set("modified", modifiedIt->second.toString().toStdString());
+        }
+
         array << obj;
     }
 
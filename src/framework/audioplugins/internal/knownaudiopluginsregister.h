@@ -24,6 +24,7 @@
 
 #include "global/modularity/ioc.h"
 #include "global/io/ifilesystem.h"
+#include "global/types/datetime.h"
 
 #include "../iknownaudiopluginsregister.h"
 #include "../iaudiopluginsconfiguration.h"
@@ -47,6 +48,8 @@ public:
     bool exists(const io::path_t& pluginPath) const override;
     bool exists(const audio::AudioResourceId& resourceId) const override;
 
+    bool isChanged(const io::path_t& pluginPath) const override;
+
     Ret registerPlugin(const AudioPluginInfo& info) override;
     Ret unregisterPlugin(const audio::AudioResourceId& resourceId) override;
 
@@ -56,5 +59,6 @@ private:
     bool m_loaded = false;
     std::multimap<audio::AudioResourceId, AudioPluginInfo> m_pluginInfoMap;
     std::set<io::path_t> m_pluginPaths;
+    std::map<io::path_t, DateTime> m_pluginModifiedTimes;
 };
 }
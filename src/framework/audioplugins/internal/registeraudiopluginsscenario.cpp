@@ -54,6 +54,7 @@ Ret RegisterAudioPluginsScenario::registerNewPlugins()
     TRACEFUNC;
 
     io::paths_t newPluginPaths;
+    io::paths_t changedPluginPaths;
 
     for (IAudioPluginsScannerPtr scanner : scannerRegister()->scanners()) {
         io::paths_t paths = scanner->scanPlugins();
@@ -61,6 +62,9 @@ Ret RegisterAudioPluginsScenario::registerNewPlugins()
         for (const io::path_t& path : paths) {
             if (!knownPluginsRegister()->exists(path)) {
                 newPluginPaths.push_back(path);
+            } else if (knownPluginsRegister()->isChanged(path)) {
+                changedPluginPaths.push_back(path);
+                newPluginPaths.push_back(path);
             }
         }
     }
@@ -69,6 +73,11 @@ Ret RegisterAudioPluginsScenario::registerNewPlugins()
         return muse::make_ok();
     }
 
+    //! NOTE Updated plugins are registered again, so their previous entries are removed first
+    for (const io::path_t& path : changedPluginPaths) {
+        unregisterPluginsAt(path);
+    }
+
     processPluginsRegistration(newPluginPaths);
 
     Ret ret = knownPluginsRegister()->load();
@@ -172,6 +181,20 @@ Ret RegisterAudioPluginsScenario::registerFailedPlugin(const io::path_t& pluginP
     return ret;
 }
 
+void RegisterAudioPluginsScenario::unregisterPluginsAt(const io::path_t& pluginPath)
+{
+    std::vector<AudioPluginInfo> infoList = knownPluginsRegister()->pluginInfoList([&pluginPath](const AudioPluginInfo& info) {
+        return info.path == pluginPath;
+    });
+
+    for (const AudioPluginInfo& info : infoList) {
+        Ret ret = knownPluginsRegister()->unregisterPlugin(info.meta.id);
+        if (!ret) {
+            LOGE() << "Could not unregister plugin: " << info.meta.id << ", err: " << ret.toString();
+        }
+    }
+}
+
 IAudioPluginMetaReaderPtr RegisterAudioPluginsScenario::metaReader(const io::path_t& pluginPath) const
 {
     for (IAudioPluginMetaReaderPtr reader : metaReaderRegister()->readers()) {
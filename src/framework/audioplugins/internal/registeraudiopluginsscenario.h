@@ -56,6 +56,7 @@ public:
 
 private:
     void processPluginsRegistration(const io::paths_t& pluginPaths);
+    void unregisterPluginsAt(const io::path_t& pluginPath);
     IAudioPluginMetaReaderPtr metaReader(const io::path_t& pluginPath) const;
 
     Progress m_progress;
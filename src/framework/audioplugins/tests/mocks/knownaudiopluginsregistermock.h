@@ -37,6 +37,8 @@ public:
     MOCK_METHOD(bool, exists, (const io::path_t&), (const, override));
     MOCK_METHOD(bool, exists, (const audio::AudioResourceId&), (const, override));
 
+    MOCK_METHOD(bool, isChanged, (const io::path_t&), (const, override));
+
     MOCK_METHOD(Ret, registerPlugin, (const AudioPluginInfo&), (override));
     MOCK_METHOD(Ret, unregisterPlugin, (const audio::AudioResourceId&), (override));
 };
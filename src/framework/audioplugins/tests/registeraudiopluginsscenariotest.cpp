@@ -235,6 +235,64 @@ TEST_F(AudioPlugins_RegisterAudioPluginsScenarioTest, RegisterNewPlugins_NoNewPl
     EXPECT_TRUE(ret);
 }
 
+TEST_F(AudioPlugins_RegisterAudioPluginsScenarioTest, RegisterNewPlugins_ChangedPlugins)
+{
+    // [GIVEN] All found plugins (all are already registered)
+    paths_t foundPluginPaths = {
+        "/some/test/path/to/plugin/AAA.vst3", // updated since registration
+        "/some/test/path/to/plugin/BBB.vst3",
+    };
+
+    for (IAudioPluginsScannerPtr scanner : m_scanners) {
+        AudioPluginsScannerMock* mock = dynamic_cast<AudioPluginsScannerMock*>(scanner.get());
+        ASSERT_TRUE(mock);
+
+        ON_CALL(*mock, scanPlugins())
+        .WillByDefault(Return(foundPluginPaths));
+    }
+
+    for (const path_t& pluginPath : foundPluginPaths) {
+        ON_CALL(*m_knownPlugins, exists(pluginPath))
+        .WillByDefault(Return(true));
+    }
+
+    ON_CALL(*m_knownPlugins, isChanged(foundPluginPaths[0]))
+    .WillByDefault(Return(true));
+
+    AudioPluginInfo changedPluginInfo;
+    changedPluginInfo.path = foundPluginPaths[0];
+    changedPluginInfo.meta.id = "AAA";
+
+    ON_CALL(*m_knownPlugins, pluginInfoList(_))
+    .WillByDefault(Return(std::vector<AudioPluginInfo> { changedPluginInfo }));
+
+    // [THEN] The previous entries of the updated plugin are removed
+    EXPECT_CALL(*m_knownPlugins, unregisterPlugin(changedPluginInfo.meta.id))
+    .WillOnce(Return(muse::make_ok()));
+
+    EXPECT_CALL(*m_interactive, showProgress(_, _))
+    .WillOnce(Return(muse::make_ok()));
+
+    // [THEN] Only the updated plugin is registered again
+    std::vector<std::string> args = { "--register-audio-plugin", foundPluginPaths[0].toStdString() };
+    EXPECT_CALL(*m_process, execute(m_appPath, args))
+    .WillOnce(Return(0));
+
+    args = { "--register-audio-plugin", foundPluginPaths[1].toStdString() };
+    EXPECT_CALL(*m_process, execute(m_appPath, args))
+    .Times(0);
+
+    // [THEN] The register is refreshed
+    EXPECT_CALL(*m_knownPlugins, load())
+    .WillOnce(Return(muse::make_ok()));
+
+    // [WHEN] Register new plugins
+    Ret ret = m_scenario->registerNewPlugins();
+
+    // [THEN] No error
+    EXPECT_TRUE(ret);
+}
+
 TEST_F(AudioPlugins_RegisterAudioPluginsScenarioTest, RegisterPlugin)
 {
     // [GIVEN] Some plugin we want to register
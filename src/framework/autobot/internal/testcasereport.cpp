@@ -21,7 +21,12 @@
  */
 #include "testcasereport.h"
 
+#include <algorithm>
+#include <cmath>
+
 #include <QDateTime>
+#include <QJsonDocument>
+#include <QJsonObject>
 
 #include "io/path.h"
 #include "log.h"
@@ -40,6 +45,32 @@ static QString formatVal(const ITestCaseContext::Val& val)
     return val.toString();
 }
 
+static double percentile(const std::vector<double>& sorted, double p)
+{
+    size_t idx = static_cast<size_t>(std::ceil(p * sorted.size()));
+    return sorted.at(std::clamp<size_t>(idx, 1, sorted.size()) - 1);
+}
+
+static QJsonObject samplesToJson(std::vector<double> samples)
+{
+    std::sort(samples.begin(), samples.end());
+
+    double total = 0.0;
+    for (double s : samples) {
+        total += s;
+    }
+
+    QJsonObject obj;
+    obj["count"] = static_cast<int>(samples.size());
+    obj["min"] = samples.front();
+    obj["p50"] = percentile(samples, 0.5);
+    obj["p90"] = percentile(samples, 0.9);
+    obj["p99"] = percentile(samples, 0.99);
+    obj["max"] = samples.back();
+    obj["total"] = total;
+    return obj;
+}
+
 Ret TestCaseReport::beginReport(const TestCase& testCase)
 {
     io::path_t reportsPath = configuration()->reportsPath();
@@ -59,6 +90,10 @@ Ret TestCaseReport::beginReport(const TestCase& testCase)
                          + "_" + now.toString("yyMMddhhmmss")
                          + ".txt";
 
+    m_testCaseName = tcname;
+    m_timingsPath = reportPath.left(reportPath.length() - 4) + ".json";
+    m_samples.clear();
+
     m_file.setFileName(reportPath);
     if (!m_file.open(QIODevice::WriteOnly)) {
         return make_ret(Ret::Code::UnknownError);
@@ -97,6 +132,53 @@ void TestCaseReport::endReport(bool aborted)
 
     m_stream.flush();
     m_file.close();
+
+    writeTimings(aborted);
+}
+
+//! NOTE Every finished step adds its duration to the samples of its name,
+//! and a step value holding an array of numbers (e.g. the latency of each
+//! entered note, measured by the script) is added as "<step>.<key>"
+void TestCaseReport::collectSamples(const StepInfo& stepInfo, const ITestCaseContextPtr& ctx)
+{
+    m_samples[stepInfo.name].push_back(stepInfo.durationMsec);
+
+    const ITestCaseContext::StepContext& step = ctx->currentStep();
+    for (auto it = step.vals.cbegin(); it != step.vals.cend(); ++it) {
+        if (!it->second.isArray()) {
+            continue;
+        }
+
+        std::vector<double>& samples = m_samples[stepInfo.name + "." + it->first];
+        const int length = it->second.property("length").toInt();
+        for (int i = 0; i < length; ++i) {
+            QJSValue v = it->second.property(static_cast<quint32>(i));
+            if (v.isNumber()) {
+                samples.push_back(v.toNumber());
+            }
+        }
+    }
+}
+
+void TestCaseReport::writeTimings(bool aborted)
+{
+    QJsonObject steps;
+    for (const auto& pair : m_samples) {
+        if (!pair.second.empty()) {
+            steps[pair.first] = samplesToJson(pair.second);
+        }
+    }
+
+    QJsonObject root;
+    root["test"] = m_testCaseName;
+    root["aborted"] = aborted;
+    root["steps"] = steps;
+
+    QByteArray json = QJsonDocument(root).toJson();
+    Ret ret = fileSystem()->writeFile(m_timingsPath, ByteArray::fromQByteArrayNoCopy(json));
+    if (!ret) {
+        LOGE() << "failed write timings: " << m_timingsPath << ", err: " << ret.toString();
+    }
 }
 
 void TestCaseReport::onStepStatusChanged(const StepInfo& stepInfo, const ITestCaseContextPtr& ctx)
@@ -116,6 +198,8 @@ void TestCaseReport::onStepStatusChanged(const StepInfo& stepInfo, const ITestCa
             m_stream << "    " << it->first << ": " << formatVal(it->second) << Qt::endl;
         }
 
+        collectSamples(stepInfo, ctx);
+
         m_stream << "  finished step: " << stepInfo.name << " [" << stepInfo.durationMsec << " msec]" << Qt::endl;
     } break;
     case StepStatus::Skipped: {
@@ -22,6 +22,9 @@
 #ifndef MUSE_AUTOBOT_TESTCASEREPORT_H
 #define MUSE_AUTOBOT_TESTCASEREPORT_H
 
+#include <map>
+#include <vector>
+
 #include <QFile>
 #include <QTextStream>
 
@@ -49,9 +52,16 @@ public:
 
 private:
 
+    void collectSamples(const StepInfo& stepInfo, const ITestCaseContextPtr& ctx);
+    void writeTimings(bool aborted);
+
     QFile m_file;
     QTextStream m_stream;
     bool m_opened = false;
+
+    QString m_testCaseName;
+    QString m_timingsPath;
+    std::map<QString, std::vector<double> > m_samples;
 };
 }
 
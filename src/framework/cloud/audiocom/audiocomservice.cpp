@@ -47,6 +47,8 @@ static const QUrl AUDIOCOM_UPLOAD_AUDIO_API_URL(AUDIOCOM_API_ROOT_URL + "/audio"
 
 static const QString AUDIOCOM_LOGO_URL(AUDIOCOM_CLOUD_URL + "/img/mu-app-logo.svg");
 
+static constexpr int MAX_AUDIO_UPLOAD_ATTEMPTS = 3;
+
 static QString audioMime(const QString& audioFormat)
 {
     if (audioFormat == "mp3") {
@@ -282,9 +284,25 @@ Ret AudioComService::doUploadAudio(network::INetworkManagerPtr uploadManager, QI
 
     Ret ret(true);
     QBuffer receivedData;
-    OutgoingDevice device(&audioData);
 
-    ret = uploadManager->put(url, &device, &receivedData, headers);
+    //! NOTE The audio is uploaded with a single PUT to a prepared url, so it can be repeated
+    //! when the connection fails or times out, instead of making the user export again
+    for (int attempt = 1; attempt <= MAX_AUDIO_UPLOAD_ATTEMPTS; ++attempt) {
+        audioData.seek(0);
+        receivedData.setData(QByteArray());
+
+        OutgoingDevice device(&audioData);
+        ret = uploadManager->put(url, &device, &receivedData, headers);
+
+        const bool isTransient = ret.code() == static_cast<int>(network::Err::Timeout)
+                                 || (ret.code() == static_cast<int>(network::Err::NetworkError) && statusCode(ret) == 0)
+                                 || statusCode(ret) >= 500;
+        if (ret || !isTransient) {
+            break;
+        }
+
+        LOGW() << "audio upload attempt " << attempt << " failed: " << ret.toString();
+    }
 
     if (!ret) {
         printServerReply(receivedData);
@@ -29,7 +29,7 @@ using namespace muse::diagnostics;
 using namespace muse::profiler;
 
 ProfilerViewModel::ProfilerViewModel(QObject* parent)
-    : QAbstractListModel(parent)
+    : QAbstractListModel(parent), Injectable(muse::iocCtxForQmlObject(this))
 {
 }
 
@@ -68,20 +68,19 @@ void ProfilerViewModel::reload()
 {
     m_allList.clear();
 
-    QString group = "Main thread";
-    QString str = QString::fromStdString(Profiler::instance()->threadsDataString(Profiler::Data::OnlyMain));
-    QStringList list = str.split("\n");
-    foreach (const QString& data, list) {
-        Item item;
-        item.group = group;
-        item.data = data;
+    appendGroup("Main thread", QString::fromStdString(Profiler::instance()->threadsDataString(Profiler::Data::OnlyMain)));
+    appendGroup("Other thread", QString::fromStdString(Profiler::instance()->threadsDataString(Profiler::Data::OnlyOther)));
 
-        m_allList.append(item);
+    if (audioProfiler() && audioProfiler()->isEnabled()) {
+        appendGroup("Audio worker", QString::fromStdString(audioProfiler()->dump()));
     }
 
-    group = "Other thread";
-    str = QString::fromStdString(Profiler::instance()->threadsDataString(Profiler::Data::OnlyOther));
-    list = str.split("\n");
+    find(m_searchText);
+}
+
+void ProfilerViewModel::appendGroup(const QString& group, const QString& str)
+{
+    QStringList list = str.split("\n");
     foreach (const QString& data, list) {
         Item item;
         item.group = group;
@@ -89,8 +88,6 @@ void ProfilerViewModel::reload()
 
         m_allList.append(item);
     }
-
-    find(m_searchText);
 }
 
 void ProfilerViewModel::find(const QString& str)
@@ -116,10 +113,19 @@ void ProfilerViewModel::find(const QString& str)
 void ProfilerViewModel::clear()
 {
     PROFILER_CLEAR;
+
+    if (audioProfiler()) {
+        audioProfiler()->reset();
+    }
+
     reload();
 }
 
 void ProfilerViewModel::print()
 {
     PROFILER_PRINT;
+
+    if (audioProfiler() && audioProfiler()->isEnabled()) {
+        LOGI() << "Audio worker profile:\n" << audioProfiler()->dump();
+    }
 }
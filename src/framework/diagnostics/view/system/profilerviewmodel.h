@@ -24,10 +24,16 @@
 
 #include <QAbstractListModel>
 
+#include "modularity/ioc.h"
+#include "audio/iaudioprofiler.h"
+
 namespace muse::diagnostics {
-class ProfilerViewModel : public QAbstractListModel
+class ProfilerViewModel : public QAbstractListModel, public Injectable
 {
     Q_OBJECT
+
+    Inject<audio::IAudioProfiler> audioProfiler = { this };
+
 public:
     explicit ProfilerViewModel(QObject* parent = 0);
 
@@ -41,6 +47,7 @@ public:
     Q_INVOKABLE void print();
 
 private:
+    void appendGroup(const QString& group, const QString& str);
 
     enum Roles {
         rData = Qt::UserRole + 1,
@@ -221,6 +221,21 @@ bool DockBase::inited() const
     return m_inited;
 }
 
+bool DockBase::contentActive() const
+{
+    return m_contentActive;
+}
+
+void DockBase::updateContentActive()
+{
+    if (m_contentActive || !m_inited || !m_dockWidget || !m_dockWidget->isVisible()) {
+        return;
+    }
+
+    m_contentActive = true;
+    emit contentActiveChanged();
+}
+
 DockType DockBase::type() const
 {
     return m_properties.type;
@@ -412,6 +427,7 @@ void DockBase::init()
 
     setVisible(m_dockWidget->isOpen());
     setInited(true);
+    updateContentActive();
 
     applySizeConstraints();
     updateFloatingStatus();
@@ -630,6 +646,8 @@ void DockBase::componentComplete()
         emit reorderNavigationRequested();
     });
 
+    connect(m_dockWidget, &KDDockWidgets::DockWidgetQuick::visibleChanged, this, &DockBase::updateContentActive);
+
     m_defaultVisibility = isVisible();
 }
 
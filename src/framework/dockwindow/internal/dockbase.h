@@ -64,6 +64,11 @@ class DockBase : public QQuickItem
 
     Q_PROPERTY(bool inited READ inited NOTIFY initedChanged)
 
+    //! NOTE Becomes true the first time the dock is actually shown and stays true afterwards.
+    //! Panels can bind the loader of their content to it, so that docks that are never shown
+    //! in a session (e.g. background tabs) don't instantiate their content on workspace restore
+    Q_PROPERTY(bool contentActive READ contentActive NOTIFY contentActiveChanged)
+
     Q_PROPERTY(muse::ui::NavigationPanel * contentNavigationPanel READ contentNavigationPanel
                WRITE setContentNavigationPanel NOTIFY contentNavigationPanelChanged)
 
@@ -100,6 +105,7 @@ public:
     bool floating() const;
 
     bool inited() const;
+    bool contentActive() const;
 
     virtual void init();
     virtual void resetToDefault();
@@ -167,6 +173,7 @@ signals:
     void floatingChanged();
 
     void initedChanged();
+    void contentActiveChanged();
 
     void contentNavigationPanelChanged();
 
@@ -195,6 +202,7 @@ private:
     void writeProperties();
 
     void setInited(bool inited);
+    void updateContentActive();
 
     QString m_title;
 
@@ -217,6 +225,7 @@ private:
     bool m_floating = false;
 
     bool m_inited = false;
+    bool m_contentActive = false;
     KDDockWidgets::DockWidgetQuick* m_dockWidget = nullptr;
     ui::NavigationPanel* m_contentNavigationPanel = nullptr;
 };
@@ -290,6 +290,16 @@ void BufferedPaintProvider::drawPolygon(const PointF* points, size_t pointCount,
     editableData().polygons.push_back(DrawPolygon { pol, mode });
 }
 
+void BufferedPaintProvider::drawLines(const LineF* lines, size_t lineCount)
+{
+    //! NOTE Recorded as separate polylines, so the data is the same as for single lines
+    std::vector<DrawPolygon>& polygons = editableData().polygons;
+    polygons.reserve(polygons.size() + lineCount);
+    for (size_t i = 0; i < lineCount; ++i) {
+        polygons.push_back(DrawPolygon { PolygonF({ lines[i].p1(), lines[i].p2() }), PolygonMode::Polyline });
+    }
+}
+
 void BufferedPaintProvider::drawText(const PointF& point, const String& text)
 {
     editableData().texts.push_back(DrawText { DrawText::Point, RectF(point, SizeF()), 0, text });
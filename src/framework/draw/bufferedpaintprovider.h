@@ -67,6 +67,7 @@ public:
     // drawing functions
     void drawPath(const PainterPath& path) override;
     void drawPolygon(const PointF* points, size_t pointCount, PolygonMode mode) override;
+    void drawLines(const LineF* lines, size_t lineCount) override;
 
     void drawText(const PointF& point, const String& text) override;
     void drawText(const RectF& rect, int flags, const String& text) override;
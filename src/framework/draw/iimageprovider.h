@@ -28,6 +28,7 @@
 #include "types/geometry.h"
 #include "types/pixmap.h"
 #include "types/color.h"
+#include "types/drawdata.h"
 #include "ipaintprovider.h"
 
 namespace muse::draw {
@@ -46,6 +47,10 @@ public:
     virtual IPaintProviderPtr painterForImage(std::shared_ptr<Pixmap> pixmap) = 0;
 
     virtual void saveAsPng(std::shared_ptr<Pixmap> px, io::IODevice* device) = 0;
+
+    //! NOTE Paints the data into an image of the given size and returns it encoded as PNG.
+    //! Can be called from any thread, if the data contains no pixmaps
+    virtual ByteArray drawDataToPng(const DrawDataPtr& data, const Size& size, int dpm, const Color& background) const = 0;
 };
 }
 
@@ -85,7 +85,9 @@ bool FontProviderDispatcher::inFontUcs4(const muse::draw::Font& f, char32_t ucs4
 // Text
 double FontProviderDispatcher::horizontalAdvance(const muse::draw::Font& f, const muse::String& string) const
 {
-    return m_qtFProvider->horizontalAdvance(f, string);
+    return m_textMetricsCache.horizontalAdvance(f, string, [this, &f, &string]() {
+        return m_qtFProvider->horizontalAdvance(f, string);
+    });
 }
 
 double FontProviderDispatcher::horizontalAdvance(const muse::draw::Font& f, const muse::Char& ch) const
@@ -95,7 +97,9 @@ double FontProviderDispatcher::horizontalAdvance(const muse::draw::Font& f, cons
 
 RectF FontProviderDispatcher::boundingRect(const muse::draw::Font& f, const muse::String& string) const
 {
-    return m_qtFProvider->boundingRect(f, string);
+    return m_textMetricsCache.rect(TextMetricsCache::Metric::BoundingRect, f, string, [this, &f, &string]() {
+        return m_qtFProvider->boundingRect(f, string);
+    });
 }
 
 RectF FontProviderDispatcher::boundingRect(const muse::draw::Font& f, const muse::Char& ch) const
@@ -112,7 +116,9 @@ RectF FontProviderDispatcher::boundingRect(const muse::draw::Font& f, const Rect
 
 RectF FontProviderDispatcher::tightBoundingRect(const muse::draw::Font& f, const muse::String& string) const
 {
-    return m_qtFProvider->tightBoundingRect(f, string);
+    return m_textMetricsCache.rect(TextMetricsCache::Metric::TightBoundingRect, f, string, [this, &f, &string]() {
+        return m_qtFProvider->tightBoundingRect(f, string);
+    });
 }
 
 // Score symbols
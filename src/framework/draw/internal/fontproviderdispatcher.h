@@ -24,6 +24,7 @@
 #include <memory>
 
 #include "../ifontprovider.h"
+#include "textmetricscache.h"
 
 namespace muse::draw {
 class FontProvider;
@@ -61,5 +62,7 @@ public:
 private:
     std::shared_ptr<FontProvider> m_mainFProvider;
     std::shared_ptr<QFontProvider> m_qtFProvider;
+
+    TextMetricsCache m_textMetricsCache;
 };
 }
@@ -176,6 +176,13 @@ double FontsEngine::horizontalAdvance(const Font& f, const std::u32string& text)
         return 0.0;
     }
 
+    return m_textMetricsCache.horizontalAdvance(f, String::fromUcs4(text.data(), text.size()), [this, &f, &text]() {
+        return doHorizontalAdvance(f, text);
+    });
+}
+
+double FontsEngine::doHorizontalAdvance(const Font& f, const std::u32string& text) const
+{
     RequireFace* rf = fontFace(f);
     IF_ASSERT_FAILED(rf && rf->face) {
         return 0.0;
@@ -207,6 +214,14 @@ RectF FontsEngine::boundingRect(const Font& f, const std::u32string& text) const
         return RectF();
     }
 
+    return m_textMetricsCache.rect(TextMetricsCache::Metric::BoundingRect, f, String::fromUcs4(text.data(), text.size()),
+                                   [this, &f, &text]() {
+        return doBoundingRect(f, text);
+    });
+}
+
+RectF FontsEngine::doBoundingRect(const Font& f, const std::u32string& text) const
+{
     RequireFace* rf = fontFace(f);
     IF_ASSERT_FAILED(rf && rf->face) {
         return RectF();
@@ -268,6 +283,14 @@ RectF FontsEngine::tightBoundingRect(const Font& f, const std::u32string& text)
         return RectF();
     }
 
+    return m_textMetricsCache.rect(TextMetricsCache::Metric::TightBoundingRect, f, String::fromUcs4(text.data(), text.size()),
+                                   [this, &f, &text]() {
+        return doTightBoundingRect(f, text);
+    });
+}
+
+RectF FontsEngine::doTightBoundingRect(const Font& f, const std::u32string& text) const
+{
     RequireFace* rf = fontFace(f);
     IF_ASSERT_FAILED(rf && rf->face) {
         return RectF();
@@ -28,6 +28,7 @@
 
 #include "global/modularity/ioc.h"
 #include "ifontsdatabase.h"
+#include "textmetricscache.h"
 
 //#include "fontrendercache.h"
 
@@ -90,6 +91,10 @@ private:
     IFontFace* createFontFace(const io::path_t& path) const;
     RequireFace* fontFace(const Font& f, bool isSymbolMode = false) const;
 
+    double doHorizontalAdvance(const Font& f, const std::u32string& text) const;
+    RectF doBoundingRect(const Font& f, const std::u32string& text) const;
+    RectF doTightBoundingRect(const Font& f, const std::u32string& text) const;
+
     std::vector<TextBlock> splitTextByLines(const std::u32string& text) const;
     std::vector<TextBlock> splitTextByFontFaces(const RequireFace* rf, const TextBlock& text) const;
 
@@ -98,6 +103,8 @@ private:
     mutable std::vector<IFontFace*> m_loadedFaces;
     mutable std::vector<RequireFace*> m_requiredFaces;
 
+    TextMetricsCache m_textMetricsCache;
+
     //mutable FontRenderCache m_renderCache;
 };
 }
@@ -1,9 +1,13 @@
 #include "qimageprovider.h"
 
 #include <QBuffer>
+#include <QImage>
+#include <QPainter>
 
 #include "qimagepainterprovider.h"
 #include "types/pixmap.h"
+#include "utils/drawdatapaint.h"
+#include "painter.h"
 
 #include "log.h"
 
@@ -49,3 +53,25 @@ void QImageProvider::saveAsPng(std::shared_ptr<Pixmap> px, io::IODevice* device)
     Pixmap::toQPixmap(*px).save(&buf, FILE_FORMAT);
     device->write(buf.data());
 }
+
+ByteArray QImageProvider::drawDataToPng(const DrawDataPtr& data, const Size& size, int dpm, const Color& background) const
+{
+    //! NOTE Only QImage is used here, QPixmap is not allowed outside of the GUI thread
+    QImage image(size.width(), size.height(), QImage::Format_ARGB32_Premultiplied);
+    image.setDotsPerMeterX(dpm);
+    image.setDotsPerMeterY(dpm);
+    image.fill(background.toQColor());
+
+    {
+        QPainter qpainter(&image);
+        Painter painter(std::make_shared<QPainterProvider>(&qpainter), "drawdata_png");
+        DrawDataPaint::paint(&painter, data);
+        painter.endDraw();
+    }
+
+    QBuffer buf;
+    buf.open(QIODevice::WriteOnly);
+    image.save(&buf, FILE_FORMAT);
+
+    return ByteArray::fromQByteArray(buf.data());
+}
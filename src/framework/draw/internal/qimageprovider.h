@@ -34,5 +34,7 @@ public:
 
     IPaintProviderPtr painterForImage(std::shared_ptr<Pixmap> pixmap) override;
     void saveAsPng(std::shared_ptr<Pixmap> px, io::IODevice* device) override;
+
+    ByteArray drawDataToPng(const DrawDataPtr& data, const Size& size, int dpm, const Color& background) const override;
 };
 }
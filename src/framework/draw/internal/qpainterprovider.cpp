@@ -230,6 +230,13 @@ void QPainterProvider::drawPolygon(const PointF* points, size_t pointCount, Poly
     }
 }
 
+void QPainterProvider::drawLines(const LineF* lines, size_t lineCount)
+{
+    static_assert(sizeof(QLineF) == sizeof(LineF), "sizeof(QLineF) and sizeof(LineF) must be equal");
+
+    m_painter->drawLines(reinterpret_cast<const QLineF*>(lines), int(lineCount));
+}
+
 void QPainterProvider::drawText(const PointF& point, const String& text)
 {
     QPointF p = point.toQPointF();
@@ -303,8 +310,66 @@ void QPainterProvider::drawTextWorkaround(const Font& f, const PointF& pos, cons
     m_painter->restore();
 }
 
+QPainterProvider::SymbolFont& QPainterProvider::symbolFont()
+{
+    // The font of the painter is resolved for the paint device, so the raw font has the right pixel size
+    const QFont& font = m_painter->font();
+    for (SymbolFont& sf : m_symbolFonts) {
+        if (sf.font == font) {
+            return sf;
+        }
+    }
+
+    //! NOTE Usually only a few fonts are used for symbols (one per mag)
+    static constexpr size_t MAX_SYMBOL_FONTS = 16;
+    if (m_symbolFonts.size() >= MAX_SYMBOL_FONTS) {
+        m_symbolFonts.erase(m_symbolFonts.begin());
+    }
+
+    SymbolFont& sf = m_symbolFonts.emplace_back();
+    sf.font = font;
+    sf.rawFont = QRawFont::fromFont(font);
+    return sf;
+}
+
+const QGlyphRun* QPainterProvider::symbolGlyphRun(char32_t ucs4Code)
+{
+    SymbolFont& sf = symbolFont();
+
+    auto it = sf.runs.constFind(ucs4Code);
+    if (it != sf.runs.constEnd()) {
+        return it->isEmpty() ? nullptr : &it.value();
+    }
+
+    QGlyphRun run;
+    if (sf.rawFont.isValid()) {
+        const QString str = QString::fromUcs4(&ucs4Code, 1);
+        quint32 glyphIndex = 0;
+        int glyphCount = 1;
+        if (sf.rawFont.glyphIndexesForChars(str.constData(), static_cast<int>(str.size()), &glyphIndex, &glyphCount)
+            && glyphCount == 1 && glyphIndex != 0) {
+            run.setRawFont(sf.rawFont);
+            run.setGlyphIndexes({ glyphIndex });
+            run.setPositions({ QPointF() });
+        }
+    }
+
+    // an empty run means the symbol isn't in the font, it's drawn as text then (with font fallback)
+    QGlyphRun& cached = sf.runs[ucs4Code];
+    cached = run;
+    return cached.isEmpty() ? nullptr : &cached;
+}
+
 void QPainterProvider::drawSymbol(const PointF& point, char32_t ucs4Code)
 {
+    //! NOTE Drawing the symbol as text would shape a one-char string on every call,
+    //! so the glyph run of the symbol is prepared once per font.
+    //! The rasterized glyphs are cached by the paint engine, in the glyph cache of the font engine
+    if (const QGlyphRun* run = symbolGlyphRun(ucs4Code)) {
+        m_painter->drawGlyphRun(point.toQPointF(), *run);
+        return;
+    }
+
     static QHash<char32_t, QString> cache;
     if (!cache.contains(ucs4Code)) {
         cache[ucs4Code] = QString::fromUcs4(&ucs4Code, 1);
@@ -21,6 +21,13 @@
  */
 #pragma once
 
+#include <vector>
+
+#include <QFont>
+#include <QGlyphRun>
+#include <QHash>
+#include <QRawFont>
+
 #include "../ipaintprovider.h"
 
 class QPainter;
@@ -71,6 +78,7 @@ public:
     // drawing functions
     void drawPath(const PainterPath& path) override;
     void drawPolygon(const PointF* points, size_t pointCount, PolygonMode mode) override;
+    void drawLines(const LineF* lines, size_t lineCount) override;
 
     void drawText(const PointF& point, const String& text) override;
     void drawText(const RectF& rect, int flags, const String& text) override;
@@ -93,8 +101,19 @@ protected:
     QPainter* m_painter = nullptr;
 
 private:
+    //! NOTE Prepared glyph runs of the symbols of one font
+    struct SymbolFont {
+        QFont font;
+        QRawFont rawFont;
+        QHash<char32_t, QGlyphRun> runs;
+    };
+
+    SymbolFont& symbolFont();
+    const QGlyphRun* symbolGlyphRun(char32_t ucs4Code);
+
     bool m_ownsPainter = false;
     DrawObjectsLogger* m_drawObjectsLogger = nullptr;
+    std::vector<SymbolFont> m_symbolFonts;
     Font m_font;
     Pen m_pen;
     Brush m_brush;
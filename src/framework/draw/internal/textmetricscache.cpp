@@ -0,0 +1,121 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2024 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "textmetricscache.h"
+
+using namespace muse;
+using namespace muse::draw;
+
+static inline void hashCombine(size_t& seed, size_t v)
+{
+    seed ^= v + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+}
+
+size_t TextMetricsCache::KeyHash::operator()(const Key& k) const
+{
+    //! NOTE The family is compared case insensitive, so it isn't hashed,
+    //! fonts that differ only by the family fall into the same bucket
+    size_t h = k.text.hash();
+    hashCombine(h, static_cast<size_t>(k.metric));
+    hashCombine(h, std::hash<double> {}(k.font.pointSizeF()));
+    hashCombine(h, static_cast<size_t>(k.font.pixelSize()));
+    hashCombine(h, static_cast<size_t>(k.font.weight()));
+    hashCombine(h, static_cast<size_t>(k.font.type()));
+    hashCombine(h, static_cast<size_t>(k.font.italic()));
+    return h;
+}
+
+TextMetricsCache::TextMetricsCache(size_t capacity)
+    : m_capacity(capacity)
+{
+}
+
+double TextMetricsCache::horizontalAdvance(const Font& f, const String& text, const std::function<double()>& func) const
+{
+    Key key { Metric::HorizontalAdvance, f, text };
+    Value value;
+    if (find(key, value)) {
+        return value.advance;
+    }
+
+    value.advance = func();
+    insert(std::move(key), value);
+    return value.advance;
+}
+
+RectF TextMetricsCache::rect(Metric metric, const Font& f, const String& text, const std::function<RectF()>& func) const
+{
+    Key key { metric, f, text };
+    Value value;
+    if (find(key, value)) {
+        return value.rect;
+    }
+
+    value.rect = func();
+    insert(std::move(key), value);
+    return value.rect;
+}
+
+bool TextMetricsCache::find(const Key& key, Value& value) const
+{
+    std::lock_guard lock(m_mutex);
+
+    auto it = m_index.find(key);
+    if (it == m_index.end()) {
+        return false;
+    }
+
+    // move to front
+    m_entries.splice(m_entries.begin(), m_entries, it->second);
+    value = it->second->second;
+    return true;
+}
+
+void TextMetricsCache::insert(Key&& key, const Value& value) const
+{
+    std::lock_guard lock(m_mutex);
+
+    // may be calculated by another thread meanwhile
+    if (m_index.find(key) != m_index.end()) {
+        return;
+    }
+
+    m_entries.emplace_front(std::move(key), value);
+    m_index.emplace(m_entries.front().first, m_entries.begin());
+
+    if (m_entries.size() > m_capacity) {
+        m_index.erase(m_entries.back().first);
+        m_entries.pop_back();
+    }
+}
+
+void TextMetricsCache::clear()
+{
+    std::lock_guard lock(m_mutex);
+    m_entries.clear();
+    m_index.clear();
+}
+
+size_t TextMetricsCache::size() const
+{
+    std::lock_guard lock(m_mutex);
+    return m_entries.size();
+}
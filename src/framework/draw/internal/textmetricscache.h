@@ -0,0 +1,92 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2024 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+
+#include "global/types/string.h"
+#include "../types/font.h"
+#include "../types/geometry.h"
+
+namespace muse::draw {
+//! NOTE Bounded LRU cache of text metrics, the key is (metric, font, text).
+//! Layout measures the same strings (lyrics, dynamics...) over and over, shaping them every time is expensive.
+//! Lookups are thread-safe.
+class TextMetricsCache
+{
+public:
+    enum class Metric {
+        HorizontalAdvance,
+        BoundingRect,
+        TightBoundingRect
+    };
+
+    static constexpr size_t DEFAULT_CAPACITY = 4096;
+
+    explicit TextMetricsCache(size_t capacity = DEFAULT_CAPACITY);
+
+    //! NOTE Returns the cached value, or calculates it with the func and caches it
+    double horizontalAdvance(const Font& f, const String& text, const std::function<double()>& func) const;
+    RectF rect(Metric metric, const Font& f, const String& text, const std::function<RectF()>& func) const;
+
+    void clear();
+    size_t size() const;
+
+private:
+    struct Key {
+        Metric metric = Metric::HorizontalAdvance;
+        Font font;
+        String text;
+
+        bool operator==(const Key& k) const
+        {
+            // Font doesn't compare the type and pixel size, but the metrics may depend on them
+            return metric == k.metric && text == k.text && font == k.font
+                   && font.type() == k.font.type() && font.pixelSize() == k.font.pixelSize();
+        }
+    };
+
+    struct KeyHash {
+        size_t operator()(const Key& k) const;
+    };
+
+    struct Value {
+        double advance = 0.0;
+        RectF rect;
+    };
+
+    using Entries = std::list<std::pair<Key, Value> >;
+
+    bool find(const Key& key, Value& value) const;
+    void insert(Key&& key, const Value& value) const;
+
+    size_t m_capacity = DEFAULT_CAPACITY;
+
+    mutable std::mutex m_mutex;
+    mutable Entries m_entries; // most recently used first
+    mutable std::unordered_map<Key, Entries::iterator, KeyHash> m_index;
+};
+}
@@ -71,6 +71,7 @@ public:
     // drawing functions
     virtual void drawPath(const PainterPath& path) = 0;
     virtual void drawPolygon(const PointF* points, size_t pointCount, PolygonMode mode) = 0;
+    virtual void drawLines(const LineF* lines, size_t lineCount) = 0;
 
     virtual void drawText(const PointF& point, const String& text) = 0;
     virtual void drawText(const RectF& rect, int flags, const String& text) = 0;
@@ -334,11 +334,15 @@ void Painter::drawPath(const PainterPath& path)
 void Painter::drawLines(const LineF* lines, size_t lineCount)
 {
     for (size_t i = 0; i < lineCount; ++i) {
-        PointF pts[2] = { lines[i].p1(), lines[i].p2() };
-        if (pts[0] == pts[1]) {
+        if (lines[i].p1() == lines[i].p2()) {
             LOGE() << "draw point not implemented";
         }
-        drawPolyline(pts, 2);
+    }
+
+    //! NOTE All lines are passed to the provider at once (ex. staff lines)
+    m_provider->drawLines(lines, lineCount);
+    if (extended) {
+        extended->drawLines(lines, lineCount);
     }
 }
 
@@ -0,0 +1,119 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2024 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <gtest/gtest.h>
+
+#include <thread>
+#include <vector>
+
+#include "draw/internal/textmetricscache.h"
+
+using namespace muse;
+using namespace muse::draw;
+
+class Draw_TextMetricsCacheTests : public ::testing::Test
+{
+public:
+};
+
+TEST_F(Draw_TextMetricsCacheTests, CalculatesOnce)
+{
+    //! GIVEN Empty cache
+    TextMetricsCache cache;
+    Font font(u"Edwin", Font::Type::Text);
+    font.setPointSizeF(10.0);
+
+    int calls = 0;
+    auto advance = [&calls]() { ++calls; return 42.0; };
+
+    //! DO Request the same metric twice
+    EXPECT_DOUBLE_EQ(cache.horizontalAdvance(font, u"lyrics", advance), 42.0);
+    EXPECT_DOUBLE_EQ(cache.horizontalAdvance(font, u"lyrics", advance), 42.0);
+
+    //! CHECK Calculated only once
+    EXPECT_EQ(calls, 1);
+
+    //! DO Request with other text, font size and metric
+    cache.horizontalAdvance(font, u"verse", advance);
+
+    Font bigger = font;
+    bigger.setPointSizeF(12.0);
+    cache.horizontalAdvance(bigger, u"lyrics", advance);
+
+    cache.rect(TextMetricsCache::Metric::BoundingRect, font, u"lyrics", []() { return RectF(0, 0, 1, 1); });
+
+    //! CHECK Each is a new entry
+    EXPECT_EQ(calls, 3);
+    EXPECT_EQ(cache.size(), 4);
+}
+
+TEST_F(Draw_TextMetricsCacheTests, EvictsLeastRecentlyUsed)
+{
+    //! GIVEN Cache for two entries
+    TextMetricsCache cache(2);
+    Font font(u"Edwin", Font::Type::Text);
+
+    int calls = 0;
+    auto advance = [&calls]() { ++calls; return 1.0; };
+
+    cache.horizontalAdvance(font, u"a", advance);
+    cache.horizontalAdvance(font, u"b", advance);
+
+    //! DO Use "a", then add "c"
+    cache.horizontalAdvance(font, u"a", advance);
+    cache.horizontalAdvance(font, u"c", advance);
+
+    //! CHECK "b" was evicted, "a" wasn't
+    EXPECT_EQ(cache.size(), 2);
+    EXPECT_EQ(calls, 3);
+
+    cache.horizontalAdvance(font, u"a", advance);
+    EXPECT_EQ(calls, 3);
+
+    cache.horizontalAdvance(font, u"b", advance);
+    EXPECT_EQ(calls, 4);
+}
+
+TEST_F(Draw_TextMetricsCacheTests, Threads)
+{
+    //! GIVEN Cache smaller than the number of the requested strings
+    TextMetricsCache cache(64);
+    Font font(u"Edwin", Font::Type::Text);
+
+    //! DO Request from several threads
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([&cache, &font]() {
+            for (int i = 0; i < 10000; ++i) {
+                const int n = i % 100;
+                double v = cache.horizontalAdvance(font, String::number(n), [n]() { return double(n); });
+                EXPECT_DOUBLE_EQ(v, double(n));
+            }
+        });
+    }
+
+    for (std::thread& t : threads) {
+        t.join();
+    }
+
+    //! CHECK The size is bounded
+    EXPECT_LE(cache.size(), 64);
+}
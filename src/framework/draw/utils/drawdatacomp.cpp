@@ -21,7 +21,9 @@
  */
 #include "drawdatacomp.h"
 
+#include <cmath>
 #include <list>
+#include <unordered_map>
 
 #include "global/realfn.h"
 #include "global/containers.h"
@@ -537,11 +539,102 @@ static bool contains(const std::list<T>& v1, const T& val, DrawDataComp::Toleran
     return false;
 }
 
+static void hashCombine(size_t& seed, size_t v)
+{
+    seed ^= v + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+}
+
+static void hashCombine(size_t& seed, double v)
+{
+    // same precision as isEqual, so the values it treats as equal get the same hash
+    hashCombine(seed, std::hash<long long> {}(std::llround(RealFloor(v, DEFAULT_PREC) * 1000)));
+}
+
+static void hashCombine(size_t& seed, const RectF& r)
+{
+    hashCombine(seed, r.x());
+    hashCombine(seed, r.y());
+    hashCombine(seed, r.width());
+    hashCombine(seed, r.height());
+}
+
+static size_t itemHash(const DrawData::Item* obj, const DrawData::Data* data)
+{
+    size_t seed = std::hash<std::string> {}(obj->name);
+    hashCombine(seed, static_cast<size_t>(data->state));
+    return seed;
+}
+
+static size_t hashOf(const Path& p)
+{
+    size_t seed = itemHash(p.obj, p.data);
+    hashCombine(seed, static_cast<size_t>(p.path->mode));
+    for (size_t i = 0; i < p.path->path.elementCount(); ++i) {
+        PainterPath::Element e = p.path->path.elementAt(i);
+        hashCombine(seed, static_cast<size_t>(e.type));
+        hashCombine(seed, e.x);
+        hashCombine(seed, e.y);
+    }
+    return seed;
+}
+
+static size_t hashOf(const Polygon& p)
+{
+    size_t seed = itemHash(p.obj, p.data);
+    hashCombine(seed, static_cast<size_t>(p.polygon->mode));
+    for (size_t i = 0; i < p.polygon->polygon.size(); ++i) {
+        const PointF& pt = p.polygon->polygon.at(i);
+        hashCombine(seed, pt.x());
+        hashCombine(seed, pt.y());
+    }
+    return seed;
+}
+
+static size_t hashOf(const Text& p)
+{
+    size_t seed = itemHash(p.obj, p.data);
+    hashCombine(seed, static_cast<size_t>(p.text->mode));
+    hashCombine(seed, static_cast<size_t>(p.text->flags));
+    hashCombine(seed, p.text->text.hash());
+    hashCombine(seed, p.text->rect);
+    return seed;
+}
+
+static size_t hashOf(const comp::Pixmap& p)
+{
+    size_t seed = itemHash(p.obj, p.data);
+    hashCombine(seed, static_cast<size_t>(p.pixmap->mode));
+    hashCombine(seed, p.pixmap->rect);
+    return seed;
+}
+
+//! NOTE Most of the items are the same in both lists, they are matched by their hash.
+//! Without tolerance a different hash means a different item,
+//! with tolerance the remaining ones are still compared one by one
 template<class T>
 static void difference(std::list<T>& diff, const std::list<T>& v1, const std::list<T>& v2, DrawDataComp::Tolerance tolerance)
 {
+    std::unordered_multimap<size_t, const T*> index;
+    index.reserve(v2.size());
+    for (const T& t : v2) {
+        index.emplace(hashOf(t), &t);
+    }
+
     for (const T& t : v1) {
-        if (!contains(v2, t, tolerance)) {
+        bool found = false;
+        auto range = index.equal_range(hashOf(t));
+        for (auto it = range.first; it != range.second; ++it) {
+            if (isEqual(*it->second, t, tolerance)) {
+                found = true;
+                break;
+            }
+        }
+
+        if (!found && tolerance.base > 0) {
+            found = contains(v2, t, tolerance);
+        }
+
+        if (!found) {
             diff.push_back(t);
         }
     }
@@ -26,10 +26,9 @@
 using namespace muse;
 using namespace muse::draw;
 
-static void drawItem(IPaintProviderPtr& provider, const DrawData::Item& item, const std::map<int, DrawData::State>& states,
-                     const Color& overlay)
+static void drawData(IPaintProviderPtr& provider, const DrawData::Item& item, const std::map<int, DrawData::State>& states,
+                     const Transform& base, const Color& overlay)
 {
-    // first draw obj itself
     for (const DrawData::Data& d : item.datas) {
         DrawData::State st = states.at(d.state);
         if (overlay.isValid()) {
@@ -40,7 +39,7 @@ static void drawItem(IPaintProviderPtr& provider, const DrawData::Item& item, co
         provider->setPen(st.pen);
         provider->setBrush(st.brush);
         provider->setFont(st.font);
-        provider->setTransform(st.transform);
+        provider->setTransform(st.transform * base);
         provider->setAntialiasing(st.isAntialiasing);
         provider->setCompositionMode(st.compositionMode);
 
@@ -73,15 +72,87 @@ static void drawItem(IPaintProviderPtr& provider, const DrawData::Item& item, co
             }
         }
     }
+}
+
+static void drawItem(IPaintProviderPtr& provider, const DrawData::Item& item, const std::map<int, DrawData::State>& states,
+                     const Transform& base, const Color& overlay)
+{
+    // first draw obj itself
+    drawData(provider, item, states, base, overlay);
 
     // second draw chilren
     for (const DrawData::Item& ch : item.chilren) {
-        drawItem(provider, ch, states, overlay);
+        drawItem(provider, ch, states, base, overlay);
+    }
+}
+
+namespace {
+//! NOTE Not every provider implements save/restore, so the state used by the painter is restored explicitly
+class ProviderStateGuard
+{
+public:
+    ProviderStateGuard(IPaintProviderPtr& provider)
+        : m_provider(provider), m_pen(provider->pen()), m_brush(provider->brush()), m_font(provider->font()),
+        m_transform(provider->transform())
+    {
+        m_provider->save();
+    }
+
+    ~ProviderStateGuard()
+    {
+        m_provider->restore();
+        m_provider->setPen(m_pen);
+        m_provider->setBrush(m_brush);
+        m_provider->setFont(m_font);
+        m_provider->setTransform(m_transform);
     }
+
+    const Transform& transform() const { return m_transform; }
+
+private:
+    IPaintProviderPtr& m_provider;
+    Pen m_pen;
+    Brush m_brush;
+    Font m_font;
+    Transform m_transform;
+};
 }
 
 void DrawDataPaint::paint(Painter* painter, const DrawDataPtr& data, const Color& overlay)
 {
     IPaintProviderPtr provider = painter->provider();
-    drawItem(provider, data->item, data->states, overlay);
+    ProviderStateGuard guard(provider);
+
+    drawItem(provider, data->item, data->states, guard.transform(), overlay);
+}
+
+void DrawDataPaint::paint(Painter* painter, const DrawDataPtr& data, const ChildFilter& filter)
+{
+    IPaintProviderPtr provider = painter->provider();
+    ProviderStateGuard guard(provider);
+
+    drawData(provider, data->item, data->states, guard.transform(), Color());
+
+    const std::vector<DrawData::Item>& children = data->item.chilren;
+    for (size_t i = 0; i < children.size(); ++i) {
+        if (filter(i)) {
+            drawItem(provider, children.at(i), data->states, guard.transform(), Color());
+        }
+    }
+}
+
+void DrawDataPaint::paint(Painter* painter, const DrawDataPtr& data, const std::vector<size_t>& childIndices)
+{
+    IPaintProviderPtr provider = painter->provider();
+    ProviderStateGuard guard(provider);
+
+    drawData(provider, data->item, data->states, guard.transform(), Color());
+
+    const std::vector<DrawData::Item>& children = data->item.chilren;
+    for (size_t i : childIndices) {
+        IF_ASSERT_FAILED(i < children.size()) {
+            break;
+        }
+        drawItem(provider, children.at(i), data->states, guard.transform(), Color());
+    }
 }
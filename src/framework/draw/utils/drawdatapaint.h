@@ -22,6 +22,9 @@
 #ifndef MUSE_DRAW_DRAWDATAPAINT_H
 #define MUSE_DRAW_DRAWDATAPAINT_H
 
+#include <functional>
+#include <vector>
+
 #include "../painter.h"
 #include "../types/drawdata.h"
 
@@ -31,7 +34,16 @@ class DrawDataPaint
 public:
     DrawDataPaint() = default;
 
+    //! NOTE The recorded transforms are combined with the current transform of the painter,
+    //! so the data can be replayed into a translated or scaled painter
     static void paint(Painter* painter, const DrawDataPtr& data, const Color& overlay = Color());
+
+    //! NOTE Paints the root object and only those of its children, for which the filter returns true
+    using ChildFilter = std::function<bool (size_t childIdx)>;
+    static void paint(Painter* painter, const DrawDataPtr& data, const ChildFilter& filter);
+
+    //! NOTE Paints the root object and the children with the given indices, which must be sorted
+    static void paint(Painter* painter, const DrawDataPtr& data, const std::vector<size_t>& childIndices);
 };
 }
 
@@ -32,9 +32,11 @@
 
 using namespace muse;
 
-int ObjectAllocator::s_used = 0;
+std::atomic<int> ObjectAllocator::s_used = 0;
 size_t ObjectAllocator::DEFAULT_BLOCK_SIZE(1024 * 256); // 256 kB
 
+static thread_local ObjectArena* s_currentArena = nullptr;
+
 static inline size_t align(size_t n)
 {
     return (n + sizeof(intptr_t) - 1) & ~(sizeof(intptr_t) - 1);
@@ -78,9 +80,24 @@ const char* ObjectAllocator::name() const
     return m_name;
 }
 
+size_t ObjectAllocator::headerSize()
+{
+    return align(sizeof(Header));
+}
+
 void* ObjectAllocator::alloc(size_t size)
 {
-    size = align(size);
+    if (ObjectArena* arena = ObjectArena::current()) {
+        void* ptr = arena->alloc(size);
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_statistic.totalAllocatedCount++;
+        return ptr;
+    }
+
+    size = align(size) + headerSize();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
 
     if (!m_chunkSize) {
         m_chunkSize = size;
@@ -106,24 +123,40 @@ void* ObjectAllocator::alloc(size_t size)
 
     m_statistic.totalAllocatedCount++;
 
-    return freeChunk;
+    reinterpret_cast<Header*>(freeChunk)->arena = nullptr;
+    return reinterpret_cast<uint8_t*>(freeChunk) + headerSize();
 }
 
-void ObjectAllocator::free(void* chunk)
+void ObjectAllocator::free(void* ptr)
 {
+    Header* header = reinterpret_cast<Header*>(reinterpret_cast<uint8_t*>(ptr) - headerSize());
+    if (header->arena) {
+        header->arena->free(ptr);
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_statistic.totalFreeCount++;
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    Chunk* chunk = reinterpret_cast<Chunk*>(header);
+
     // The freed chunk's next pointer points to the
     // current allocation pointer:
-    reinterpret_cast<Chunk*>(chunk)->next = m_free;
+    chunk->next = m_free;
 
     // And the allocation pointer is now set
     // to the returned (free) chunk:
-    m_free = reinterpret_cast<Chunk*>(chunk);
+    m_free = chunk;
 
     m_statistic.totalFreeCount++;
 }
 
 void ObjectAllocator::cleanup()
 {
+    std::lock_guard<std::mutex> lock(m_mutex);
+
     if (m_blocks.empty()) {
         return;
     }
@@ -143,7 +176,7 @@ void ObjectAllocator::cleanup()
         for (size_t i = 0; i < b.chunkCount - 1; ++i) {
             // if not free chunk, then destroy object
             if (freeChunks.find(chunk) == freeChunks.cend()) {
-                m_dtor(reinterpret_cast<void*>(chunk));
+                m_dtor(reinterpret_cast<uint8_t*>(chunk) + headerSize());
             }
 
             chunk->next = reinterpret_cast<Chunk*>(reinterpret_cast<uint8_t*>(chunk) + b.chunkSize);
@@ -151,7 +184,7 @@ void ObjectAllocator::cleanup()
         }
 
         if (freeChunks.find(chunk) == freeChunks.cend()) {
-            m_dtor(reinterpret_cast<void*>(chunk));
+            m_dtor(reinterpret_cast<uint8_t*>(chunk) + headerSize());
         }
 
         if (bi < (m_blocks.size() - 1)) {
@@ -198,6 +231,8 @@ void* ObjectAllocator::not_supported(const char* info)
 
 ObjectAllocator::Info ObjectAllocator::stateInfo() const
 {
+    std::lock_guard<std::mutex> lock(m_mutex);
+
     Info info;
     info.module = m_module;
     info.name = m_name;
@@ -219,21 +254,102 @@ ObjectAllocator::Info ObjectAllocator::stateInfo() const
     return info;
 }
 
+// ============================================
+// ObjectArena
+// ============================================
+ObjectArena::ObjectArena(size_t blockSize)
+    : m_blockSize(blockSize)
+{
+}
+
+ObjectArena::~ObjectArena()
+{
+    if (m_liveObjects > 0) {
+        LOGW() << "arena destroyed with live objects: " << m_liveObjects;
+    }
+
+    for (uint8_t* b : m_blocks) {
+        std::free(b);
+    }
+}
+
+void* ObjectArena::alloc(size_t size)
+{
+    const size_t headerSize = ObjectAllocator::headerSize();
+    size = align(size) + headerSize;
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    if (!m_pos || size_t(m_end - m_pos) < size) {
+        size_t blockSize = std::max(m_blockSize, size);
+        m_pos = reinterpret_cast<uint8_t*>(malloc(blockSize));
+        m_end = m_pos + blockSize;
+        m_blocks.push_back(m_pos);
+        m_allocatedBytes += blockSize;
+    }
+
+    reinterpret_cast<ObjectAllocator::Header*>(m_pos)->arena = this;
+    void* ptr = m_pos + headerSize;
+
+    // Bump the allocation pointer, the memory is only released with the arena
+    m_pos += size;
+    ++m_liveObjects;
+
+    return ptr;
+}
+
+void ObjectArena::free(void*)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    --m_liveObjects;
+}
+
+size_t ObjectArena::allocatedBytes() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_allocatedBytes;
+}
+
+size_t ObjectArena::liveObjects() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_liveObjects;
+}
+
+ObjectArena* ObjectArena::current()
+{
+    return s_currentArena;
+}
+
+ObjectArena::Scope::Scope(ObjectArena* arena)
+    : m_prev(s_currentArena)
+{
+    s_currentArena = arena;
+}
+
+ObjectArena::Scope::~Scope()
+{
+    s_currentArena = m_prev;
+}
+
 // ============================================
 // AllocatorsRegister
 // ============================================
 void AllocatorsRegister::reg(ObjectAllocator* a)
 {
+    std::lock_guard<std::mutex> lock(m_mutex);
     m_allocators.push_back(a);
 }
 
 void AllocatorsRegister::unreg(ObjectAllocator* a)
 {
+    std::lock_guard<std::mutex> lock(m_mutex);
     m_allocators.remove(a);
 }
 
 void AllocatorsRegister::cleanupAll(const std::string& module)
 {
+    std::lock_guard<std::mutex> lock(m_mutex);
     for (ObjectAllocator* a : m_allocators) {
         if (a->module() == module) {
             a->cleanup();
@@ -247,6 +363,8 @@ void AllocatorsRegister::cleanupAll(const std::string& module)
 
 void AllocatorsRegister::printStatistic(const std::string& title)
 {
+    std::lock_guard<std::mutex> lock(m_mutex);
+
     std::stringstream stream;
     stream << "\n\n";
     stream << title << "\n";
@@ -281,6 +399,8 @@ void AllocatorsRegister::printStatistic(const std::string& title)
 
 void AllocatorsRegister::printState(const std::string& title)
 {
+    std::lock_guard<std::mutex> lock(m_mutex);
+
     std::stringstream stream;
     stream << "\n\n";
     stream << title << "\n";
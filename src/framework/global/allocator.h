@@ -22,9 +22,11 @@
 #ifndef MUSE_GLOBAL_ALLOCATOR_H
 #define MUSE_GLOBAL_ALLOCATOR_H
 
+#include <atomic>
 #include <cstdint>
 #include <vector>
 #include <list>
+#include <mutex>
 #include <string>
 
 namespace muse {
@@ -59,6 +61,7 @@ public: \
     } \
 private:
 
+class ObjectArena;
 class ObjectAllocator
 {
 public:
@@ -108,7 +111,7 @@ public:
     static void used();
     static void unused();
 
-    static int s_used;
+    static std::atomic<int> s_used;
 private:
 
     struct Chunk {
@@ -128,8 +131,19 @@ private:
         size_t chunkSize = 0;
     };
 
+    //! NOTE Every chunk starts with a header, that points to the arena
+    //! the object was allocated from (nullptr if it's from the pool)
+    struct Header {
+        ObjectArena* arena = nullptr;
+    };
+
+    static size_t headerSize();
+
     Block allocateBlock(size_t chunkSize) const;
 
+    friend class ObjectArena;
+
+    mutable std::mutex m_mutex;
     const char* m_module = nullptr;
     const char* m_name = nullptr;
     size_t m_chunkSize = 0;
@@ -146,6 +160,48 @@ private:
     Statistic m_statistic;
 };
 
+//! NOTE Bump allocator for the objects of one owner (for example a score).
+//! While an arena is set as current for a thread (see Scope), objects with OBJECT_ALLOCATOR
+//! created on that thread are allocated from it; deleting such an object only runs its destructor,
+//! the memory is released all at once when the arena is destroyed.
+//! The arena must outlive all objects allocated from it.
+class ObjectArena
+{
+public:
+    ObjectArena(size_t blockSize = ObjectAllocator::DEFAULT_BLOCK_SIZE);
+    ~ObjectArena();
+
+    ObjectArena(const ObjectArena&) = delete;
+    ObjectArena& operator=(const ObjectArena&) = delete;
+
+    void* alloc(size_t size);
+    void free(void* ptr);
+
+    size_t allocatedBytes() const;
+    size_t liveObjects() const;
+
+    static ObjectArena* current();
+
+    class Scope
+    {
+    public:
+        Scope(ObjectArena* arena);
+        ~Scope();
+
+    private:
+        ObjectArena* m_prev = nullptr;
+    };
+
+private:
+    mutable std::mutex m_mutex;
+    size_t m_blockSize = 0;
+    std::vector<uint8_t*> m_blocks;
+    uint8_t* m_pos = nullptr;
+    uint8_t* m_end = nullptr;
+    size_t m_allocatedBytes = 0;
+    size_t m_liveObjects = 0;
+};
+
 class AllocatorsRegister
 {
 public:
@@ -165,6 +221,7 @@ public:
     void printState(const std::string& title);
 
 private:
+    std::mutex m_mutex;
     std::list<ObjectAllocator*> m_allocators;
 };
 }
@@ -0,0 +1,229 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2024 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef MUSE_GLOBAL_JOBPOOL_H
+#define MUSE_GLOBAL_JOBPOOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <thread>
+
+#include "taskscheduler.h"
+#include "threadutils.h"
+
+#include "log.h"
+
+namespace muse {
+//! NOTE Runs a batch of jobs on a fixed set of threads and waits for them, ex. once per audio block.
+//! Unlike TaskScheduler, starting a batch does not allocate and does not take a lock while the workers are busy:
+//! the jobs are handed out by an atomic counter, the calling thread takes jobs itself,
+//! and idle workers spin for a while before they park on a condition variable.
+class JobPool
+{
+public:
+    explicit JobPool(const thread_pool_size_t desiredThreadCount = 0)
+        : m_threadPoolSize(validateThreadPoolCapacity(desiredThreadCount)),
+        m_threadPool(std::make_unique<std::thread[]>(m_threadPoolSize))
+    {
+        m_isActive = true;
+        for (thread_pool_size_t i = 0; i < m_threadPoolSize; ++i) {
+            m_threadPool[i] = std::thread(&JobPool::th_workerLoop, this);
+        }
+    }
+
+    ~JobPool()
+    {
+        {
+            const std::lock_guard lock(m_mutex);
+            m_isActive = false;
+        }
+        m_workAvailableCv.notify_all();
+
+        for (thread_pool_size_t i = 0; i < m_threadPoolSize; ++i) {
+            m_threadPool[i].join();
+        }
+    }
+
+    thread_pool_size_t threadPoolSize() const
+    {
+        return m_threadPoolSize;
+    }
+
+    std::set<std::thread::id> threadIdSet() const
+    {
+        std::set<std::thread::id> result;
+
+        for (thread_pool_size_t i = 0; i < m_threadPoolSize; ++i) {
+            result.insert(m_threadPool[i].get_id());
+        }
+
+        return result;
+    }
+
+    bool setThreadsPriority(ThreadPriority priority)
+    {
+        for (thread_pool_size_t i = 0; i < m_threadPoolSize; ++i) {
+            if (!muse::setThreadPriority(m_threadPool[i], priority)) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    //! NOTE Calls job(idx) for every idx in [0, jobCount) and returns when all calls are done.
+    //! Must not be called from several threads at once
+    template<typename FuncT>
+    void run(size_t jobCount, const FuncT& job)
+    {
+        if (jobCount == 0) {
+            return;
+        }
+
+        IF_ASSERT_FAILED(jobCount <= MAX_JOB_COUNT) {
+            return;
+        }
+
+        m_job = &job;
+        m_invoke = [](const void* ctx, size_t idx) {
+            (*static_cast<const FuncT*>(ctx))(idx);
+        };
+        m_remainingJobs.store(jobCount, std::memory_order_relaxed);
+
+        //! NOTE The batch number makes every batch state unique, so a worker never takes a job of a finished batch
+        //! NOTE The state and the parked counter are sequentially consistent,
+        //! so either a parking worker sees the new batch, or its parking is seen here
+        ++m_batch;
+        m_state.store(makeState(m_batch, jobCount, 0));
+
+        if (m_parkedWorkers.load() > 0) {
+            {
+                const std::lock_guard lock(m_mutex);
+            }
+            m_workAvailableCv.notify_all();
+        }
+
+        runJobs();
+
+        while (m_remainingJobs.load(std::memory_order_acquire) > 0) {
+            std::this_thread::yield();
+        }
+    }
+
+private:
+    static constexpr uint64_t INDEX_BITS = 24;
+    static constexpr uint64_t INDEX_MASK = (uint64_t(1) << INDEX_BITS) - 1;
+    static constexpr size_t MAX_JOB_COUNT = INDEX_MASK;
+    static constexpr int SPIN_COUNT = 4000;
+
+    // batch (16 bit) | job count (24 bit) | next job index (24 bit)
+    static uint64_t makeState(uint64_t batch, uint64_t count, uint64_t index)
+    {
+        return ((batch & 0xFFFF) << (2 * INDEX_BITS)) | (count << INDEX_BITS) | index;
+    }
+
+    static size_t stateCount(uint64_t state) { return (state >> INDEX_BITS) & INDEX_MASK; }
+    static size_t stateIndex(uint64_t state) { return state & INDEX_MASK; }
+
+    bool hasJobs() const
+    {
+        uint64_t state = m_state.load();
+        return stateIndex(state) < stateCount(state);
+    }
+
+    void runJobs()
+    {
+        uint64_t state = m_state.load(std::memory_order_acquire);
+
+        while (stateIndex(state) < stateCount(state)) {
+            if (!m_state.compare_exchange_weak(state, state + 1, std::memory_order_acq_rel, std::memory_order_acquire)) {
+                continue;
+            }
+
+            //! NOTE The batch can't finish before this job is done, so the job is still valid here
+            m_invoke(m_job, stateIndex(state));
+            m_remainingJobs.fetch_sub(1, std::memory_order_acq_rel);
+
+            state = m_state.load(std::memory_order_acquire);
+        }
+    }
+
+    void th_workerLoop()
+    {
+        while (m_isActive) {
+            runJobs();
+
+            bool found = false;
+            for (int i = 0; i < SPIN_COUNT && !found; ++i) {
+                std::this_thread::yield();
+                found = hasJobs();
+            }
+
+            if (found) {
+                continue;
+            }
+
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_parkedWorkers.fetch_add(1);
+            m_workAvailableCv.wait(lock, [this] { return hasJobs() || !m_isActive; });
+            m_parkedWorkers.fetch_sub(1);
+        }
+    }
+
+    thread_pool_size_t validateThreadPoolCapacity(const thread_pool_size_t desiredThreadCount) const
+    {
+        thread_pool_size_t maxCapacity = std::thread::hardware_concurrency();
+
+        if (maxCapacity <= 1) {
+            return 1;
+        }
+
+        if (desiredThreadCount <= 0) {
+            return maxCapacity / 2;
+        }
+
+        return desiredThreadCount;
+    }
+
+    std::atomic<bool> m_isActive = false;
+
+    std::atomic<uint64_t> m_state = 0;
+    std::atomic<size_t> m_remainingJobs = 0;
+    std::atomic<int> m_parkedWorkers = 0;
+    uint64_t m_batch = 0;
+
+    const void* m_job = nullptr;
+    void (* m_invoke)(const void* ctx, size_t idx) = nullptr;
+
+    std::mutex m_mutex;
+    std::condition_variable m_workAvailableCv;
+
+    thread_pool_size_t m_threadPoolSize = 0;
+    std::unique_ptr<std::thread[]> m_threadPool = nullptr;
+};
+}
+
+#endif // MUSE_GLOBAL_JOBPOOL_H
@@ -0,0 +1,77 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2024 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef MUSE_GLOBAL_SPSCQUEUE_H
+#define MUSE_GLOBAL_SPSCQUEUE_H
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <type_traits>
+
+namespace muse {
+//! NOTE Bounded queue for exactly one producer thread and one consumer thread.
+//! The slots are preallocated and the indexes are atomics, so pushing and popping
+//! never allocate and never block; tryPush fails when the queue is full
+template<typename T, size_t Capacity>
+class SpscQueue
+{
+    static_assert(std::is_trivially_copyable_v<T>, "the messages are copied into preallocated slots");
+    static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0, "the capacity must be a power of two");
+
+public:
+    bool tryPush(const T& value)
+    {
+        const size_t tail = m_tail.load(std::memory_order_relaxed);
+        if (tail - m_head.load(std::memory_order_acquire) == Capacity) {
+            return false;
+        }
+
+        m_slots[tail & (Capacity - 1)] = value;
+        m_tail.store(tail + 1, std::memory_order_release);
+
+        return true;
+    }
+
+    bool tryPop(T& value)
+    {
+        const size_t head = m_head.load(std::memory_order_relaxed);
+        if (head == m_tail.load(std::memory_order_acquire)) {
+            return false;
+        }
+
+        value = m_slots[head & (Capacity - 1)];
+        m_head.store(head + 1, std::memory_order_release);
+
+        return true;
+    }
+
+private:
+    std::array<T, Capacity> m_slots = {};
+
+    // On separate cache lines, the producer writes the tail and the consumer writes the head
+    alignas(64) std::atomic<size_t> m_tail = 0;
+    alignas(64) std::atomic<size_t> m_head = 0;
+};
+}
+
+#endif // MUSE_GLOBAL_SPSCQUEUE_H
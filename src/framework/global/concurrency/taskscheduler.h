@@ -89,7 +89,7 @@ public:
         std::function<void()> taskFunctor = std::bind(std::forward<FuncT>(task), std::forward<ArgsT>(args)...);
         {
             const std::lock_guard lock(m_mutex);
-            m_taskQueue.push(taskFunctor);
+            m_taskQueue.push(std::move(taskFunctor));
         }
         m_newTaskAvailableCv.notify_one();
     }
@@ -99,7 +99,7 @@ public:
     {
         std::function<ReturnT()> taskFunctor = std::bind(std::forward<FuncT>(task), std::forward<ArgsT>(args)...);
         std::shared_ptr<std::promise<ReturnT> > promise = std::make_shared<std::promise<ReturnT> >();
-        push([taskFunctor, promise] {
+        push([taskFunctor = std::move(taskFunctor), promise] {
             try {
                 if constexpr (std::is_void_v<ReturnT>) {
                     std::invoke(taskFunctor);
@@ -123,7 +123,7 @@ public:
     {
         m_isWaitingForAllTasksDone = true;
         std::unique_lock<std::mutex> tasks_lock(m_mutex);
-        m_taskFinishedCv.wait(tasks_lock, [this] { return m_taskQueue.empty(); });
+        m_taskFinishedCv.wait(tasks_lock, [this] { return m_taskQueue.empty() && m_runningTaskCount == 0; });
         m_isWaitingForAllTasksDone = false;
     }
 
@@ -174,15 +174,20 @@ private:
                 return;
             }
 
-            std::function<void()> task = m_taskQueue.front();
+            std::function<void()> task = std::move(m_taskQueue.front());
             m_taskQueue.pop();
+            ++m_runningTaskCount;
 
             lock.unlock();
 
             task();
 
+            lock.lock();
+            --m_runningTaskCount;
+            lock.unlock();
+
             if (m_isWaitingForAllTasksDone) {
-                m_taskFinishedCv.notify_one();
+                m_taskFinishedCv.notify_all();
             }
         }
     }
@@ -194,6 +199,7 @@ private:
     std::condition_variable m_newTaskAvailableCv;
     std::condition_variable m_taskFinishedCv;
     std::queue<std::function<void()> > m_taskQueue;
+    size_t m_runningTaskCount = 0;
 
     thread_pool_size_t m_threadPoolSize = 0;
     std::unique_ptr<std::thread[]> m_threadPool = nullptr;
@@ -0,0 +1,180 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2024 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "mappedfile.h"
+
+#include <filesystem>
+
+#ifdef Q_OS_WIN
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "ioretcodes.h"
+
+#include "log.h"
+
+using namespace muse;
+using namespace muse::io;
+
+MappedFile::MappedFile(const path_t& filePath)
+    : m_filePath(filePath)
+{
+}
+
+MappedFile::~MappedFile()
+{
+    close();
+    unmap();
+}
+
+path_t MappedFile::filePath() const
+{
+    return m_filePath;
+}
+
+bool MappedFile::doOpen(OpenMode m)
+{
+    if (m != OpenMode::ReadOnly) {
+        setError(int(Err::FSWriteError), "A mapped file can only be opened for reading");
+        return false;
+    }
+
+    unmap();
+
+    const std::filesystem::path path = std::filesystem::u8path(m_filePath.toStdString());
+
+#ifdef Q_OS_WIN
+    HANDLE file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        setError(int(Err::FSReadError), "Unable to open the file");
+        return false;
+    }
+
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(file, &fileSize)) {
+        CloseHandle(file);
+        setError(int(Err::FSReadError), "Unable to get the file size");
+        return false;
+    }
+
+    //! NOTE An empty file can not be mapped, it is just empty
+    if (fileSize.QuadPart == 0) {
+        CloseHandle(file);
+        return true;
+    }
+
+    HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    void* data = mapping ? MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0) : nullptr;
+    if (!data) {
+        if (mapping) {
+            CloseHandle(mapping);
+        }
+        CloseHandle(file);
+        setError(int(Err::FSReadError), "Unable to map the file");
+        return false;
+    }
+
+    m_file = file;
+    m_mapping = mapping;
+    m_data = static_cast<const uint8_t*>(data);
+    m_size = static_cast<size_t>(fileSize.QuadPart);
+#else
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        setError(int(Err::FSReadError), "Unable to open the file");
+        return false;
+    }
+
+    struct stat fileStat;
+    if (fstat(fd, &fileStat) != 0) {
+        ::close(fd);
+        setError(int(Err::FSReadError), "Unable to get the file size");
+        return false;
+    }
+
+    //! NOTE An empty file can not be mapped, it is just empty
+    if (fileStat.st_size == 0) {
+        ::close(fd);
+        return true;
+    }
+
+    size_t size = static_cast<size_t>(fileStat.st_size);
+    void* data = mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+
+    //! NOTE The mapping stays valid after the descriptor is closed
+    ::close(fd);
+
+    if (data == MAP_FAILED) {
+        setError(int(Err::FSReadError), "Unable to map the file");
+        return false;
+    }
+
+    m_data = static_cast<const uint8_t*>(data);
+    m_size = size;
+#endif
+
+    return true;
+}
+
+void MappedFile::unmap()
+{
+    if (!m_data) {
+        return;
+    }
+
+#ifdef Q_OS_WIN
+    UnmapViewOfFile(m_data);
+    CloseHandle(static_cast<HANDLE>(m_mapping));
+    CloseHandle(static_cast<HANDLE>(m_file));
+    m_mapping = nullptr;
+    m_file = nullptr;
+#else
+    munmap(const_cast<uint8_t*>(m_data), m_size);
+#endif
+
+    m_data = nullptr;
+    m_size = 0;
+}
+
+size_t MappedFile::dataSize() const
+{
+    return m_size;
+}
+
+const uint8_t* MappedFile::rawData() const
+{
+    return m_data;
+}
+
+bool MappedFile::resizeData(size_t)
+{
+    return false;
+}
+
+size_t MappedFile::writeData(const uint8_t*, size_t)
+{
+    return 0;
+}
@@ -0,0 +1,65 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2024 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef MUSE_IO_MAPPEDFILE_H
+#define MUSE_IO_MAPPEDFILE_H
+
+#include "iodevice.h"
+#include "path.h"
+
+namespace muse::io {
+//! NOTE A read-only file device over a memory mapping of the file.
+//! Unlike File, the content is not read at open: the pages are loaded by the OS on first access,
+//! so only the parts that are really read cost anything. The file must not be truncated while it is open
+class MappedFile : public IODevice
+{
+public:
+    MappedFile(const path_t& filePath);
+    ~MappedFile() override;
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    path_t filePath() const;
+
+protected:
+
+    bool doOpen(OpenMode m) override;
+    size_t dataSize() const override;
+    const uint8_t* rawData() const override;
+    bool resizeData(size_t size) override;
+    size_t writeData(const uint8_t* data, size_t len) override;
+
+private:
+    void unmap();
+
+    path_t m_filePath;
+    const uint8_t* m_data = nullptr;
+    size_t m_size = 0;
+
+#ifdef Q_OS_WIN
+    void* m_file = nullptr;
+    void* m_mapping = nullptr;
+#endif
+};
+}
+
+#endif // MUSE_IO_MAPPEDFILE_H
@@ -21,10 +21,16 @@
  */
 #include "zipcontainer.h"
 
+#include <algorithm>
 #include <ctime>
 #include <cstring>
+#include <future>
+#include <mutex>
+#include <unordered_map>
 #include <zlib.h>
 
+#include "global/containers.h"
+#include "global/concurrency/taskscheduler.h"
 #include "global/io/dir.h"
 
 #include "log.h"
@@ -149,37 +155,103 @@ static int inflate(Bytef* dest, ulong* destLen, const Bytef* source, ulong sourc
     return err;
 }
 
-static int deflate(Bytef* dest, ulong* destLen, const Bytef* source, ulong sourceLen)
+//! NOTE Like in pigz, big files are split into chunks which are compressed in parallel.
+//! Each chunk uses the end of the previous one as the dictionary, and all of them except the last one
+//! end on a byte boundary (Z_SYNC_FLUSH), so that together they make one deflate stream
+static constexpr size_t DEFLATE_CHUNK_SIZE = 128 * 1024;
+static constexpr size_t DEFLATE_DICT_SIZE = 32 * 1024;
+
+struct DeflateChunk {
+    const uint8_t* data = nullptr;
+    size_t size = 0;
+    size_t dictSize = 0; // the dictionary is right before the data
+    bool isLast = false;
+
+    ByteArray compressed;
+    int result = Z_OK;
+};
+
+static int deflateChunk(DeflateChunk& chunk)
 {
     z_stream stream;
-    int err;
+    std::memset(&stream, 0, sizeof(z_stream));
 
-    stream.next_in = const_cast<Bytef*>(source);
-    stream.avail_in = (uInt)sourceLen;
-    stream.next_out = dest;
-    stream.avail_out = (uInt) * destLen;
-    if ((uLong)stream.avail_out != *destLen) {
-        return Z_BUF_ERROR;
+    int err = deflateInit2(&stream, Z_DEFAULT_COMPRESSION, Z_DEFLATED, -MAX_WBITS, 8, Z_DEFAULT_STRATEGY);
+    if (err != Z_OK) {
+        return err;
     }
 
-    stream.zalloc = (alloc_func)0;
-    stream.zfree = (free_func)0;
-    stream.opaque = (voidpf)0;
+    if (chunk.dictSize > 0) {
+        err = deflateSetDictionary(&stream, chunk.data - chunk.dictSize, (uInt)chunk.dictSize);
+        if (err != Z_OK) {
+            deflateEnd(&stream);
+            return err;
+        }
+    }
 
-    err = deflateInit2(&stream, Z_DEFAULT_COMPRESSION, Z_DEFLATED, -MAX_WBITS, 8, Z_DEFAULT_STRATEGY);
-    if (err != Z_OK) {
-        return err;
+    // the sync flush adds an empty stored block to what the bound is for
+    chunk.compressed.resize(deflateBound(&stream, (uLong)chunk.size) + 16);
+
+    stream.next_in = const_cast<Bytef*>(chunk.data);
+    stream.avail_in = (uInt)chunk.size;
+    stream.next_out = chunk.compressed.data();
+    stream.avail_out = (uInt)chunk.compressed.size();
+
+    err = deflate(&stream, chunk.isLast ? Z_FINISH : Z_SYNC_FLUSH);
+
+    bool done = chunk.isLast ? err == Z_STREAM_END : (err == Z_OK && stream.avail_in == 0 && stream.avail_out > 0);
+    chunk.compressed.resize(stream.total_out);
+
+    // not finished streams are reported as Z_DATA_ERROR, which is expected for the chunks except the last one
+    deflateEnd(&stream);
+
+    if (!done) {
+        return (err == Z_OK || err == Z_STREAM_END) ? Z_BUF_ERROR : err;
     }
 
-    err = deflate(&stream, Z_FINISH);
-    if (err != Z_STREAM_END) {
-        deflateEnd(&stream);
-        return err == Z_OK ? Z_BUF_ERROR : err;
+    return Z_OK;
+}
+
+static void appendDeflateChunks(const ByteArray& contents, std::vector<DeflateChunk>& chunks)
+{
+    const uint8_t* data = contents.constData();
+    const size_t size = contents.size();
+
+    size_t offset = 0;
+    do {
+        DeflateChunk chunk;
+        chunk.data = data + offset;
+        chunk.size = std::min(DEFLATE_CHUNK_SIZE, size - offset);
+        chunk.dictSize = std::min(DEFLATE_DICT_SIZE, offset);
+
+        offset += chunk.size;
+        chunk.isLast = offset == size;
+
+        chunks.push_back(std::move(chunk));
+    } while (offset < size);
+}
+
+static void deflateChunks(std::vector<DeflateChunk>& chunks)
+{
+    if (chunks.size() == 1) {
+        chunks.front().result = deflateChunk(chunks.front());
+        return;
     }
-    *destLen = stream.total_out;
 
-    err = deflateEnd(&stream);
-    return err;
+    static muse::TaskScheduler scheduler;
+
+    std::vector<std::future<void> > futures;
+    futures.reserve(chunks.size());
+
+    for (DeflateChunk& chunk : chunks) {
+        futures.push_back(scheduler.submit([&chunk]() {
+            chunk.result = deflateChunk(chunk);
+        }));
+    }
+
+    for (std::future<void>& f : futures) {
+        f.get();
+    }
 }
 
 namespace WindowsFileAttributes {
@@ -374,17 +446,40 @@ struct ZipContainer::Impl {
 
     bool dirtyFileTree = true;
     std::vector<FileHeader> fileHeaders;
+    std::unordered_map<std::string, size_t> fileIndex;
     ByteArray comment;
     uint start_of_directory = 0;
     ZipContainer::Status status = ZipContainer::NoError;
 
     ZipContainer::CompressionPolicy compressionPolicy = ZipContainer::AlwaysCompress;
 
+    std::shared_ptr<ZipCompressionCache> compressionCache;
+    std::unordered_map<std::string, ZipCompressionCache::Entry> writtenEntries;
+
+    //! NOTE Guards the file tree and the device position while reading,
+    //! so that several files can be extracted from different threads
+    std::mutex readMutex;
+
     enum EntryType {
         Directory, File, Symlink
     };
 
+    struct PendingEntry {
+        EntryType type = File;
+        std::string fileName;
+        const ByteArray* contents = nullptr;
+
+        ZipContainer::CompressionPolicy compression = ZipContainer::AlwaysCompress;
+        uint crc = 0;
+        ByteArray data;
+        bool isCached = false;
+        size_t firstChunk = 0;
+        size_t chunkCount = 0;
+    };
+
     void addEntry(EntryType type, const std::string& fileName, const ByteArray& contents);
+    void addEntries(std::vector<PendingEntry>& entries);
+    void writeEntry(const PendingEntry& entry);
     bool writeToDevice(const uint8_t* data, size_t len);
     bool writeToDevice(const ByteArray& data);
 
@@ -392,6 +487,8 @@ struct ZipContainer::Impl {
         : device(d) {}
 
     void scanFiles();
+    void addHeader(FileHeader&& header);
+    size_t indexOf(const std::string& fileName) const;
     ZipContainer::FileInfo fillFileInfo(size_t index) const;
 };
 
@@ -412,80 +509,98 @@ void ZipContainer::Impl::scanFiles()
     }
 
     dirtyFileTree = false;
-    uint8_t tmp[4];
-    device->read(tmp, 4);
-    if (readUInt(tmp) != 0x04034b50) {
+
+    //! NOTE The device data is in memory (or mapped), so the index is parsed in place
+    const uint8_t* data = device->readData();
+    const size_t size = device->size();
+
+    if (size < 4 || readUInt(data) != 0x04034b50) {
         LOGW("Zip: not a zip file!");
         return;
     }
 
-    // find EndOfDirectory header
-    int i = 0;
-    int start_of_directory_local = -1;
-    int num_dir_entries = 0;
+    // find EndOfDirectory header, it is followed by the comment of up to 65535 bytes
+    size_t i = 0;
     EndOfDirectory eod;
-    while (start_of_directory_local == -1) {
-        const int pos = int(device->size()) - int(sizeof(EndOfDirectory)) - i;
-        if (pos < 0 || i > 65535) {
+    while (true) {
+        if (size < sizeof(EndOfDirectory) + i || i > 65535) {
             LOGW("Zip: EndOfDirectory not found");
             return;
         }
 
-        device->seek(pos);
-        device->read((uint8_t*)&eod, sizeof(EndOfDirectory));
-        if (readUInt(eod.signature) == 0x06054b50) {
+        const size_t pos = size - sizeof(EndOfDirectory) - i;
+        if (readUInt(data + pos) == 0x06054b50) {
+            std::memcpy(&eod, data + pos, sizeof(EndOfDirectory));
             break;
         }
         ++i;
     }
 
     // have the eod
-    start_of_directory_local = readUInt(eod.dir_start_offset);
-    num_dir_entries = readUShort(eod.num_dir_entries);
-    ZDEBUG("start_of_directory at %d, num_dir_entries=%d", start_of_directory_local, num_dir_entries);
-    int comment_length = readUShort(eod.comment_length);
+    const size_t start_of_directory_local = readUInt(eod.dir_start_offset);
+    const int num_dir_entries = readUShort(eod.num_dir_entries);
+    ZDEBUG("start_of_directory at %zu, num_dir_entries=%d", start_of_directory_local, num_dir_entries);
+    size_t comment_length = readUShort(eod.comment_length);
     if (comment_length != i) {
         LOGW("Zip: failed to parse zip file.");
     }
-    comment = device->read(std::min(comment_length, i));
+    comment = ByteArray(data + size - i, std::min(comment_length, i));
 
-    device->seek(start_of_directory_local);
-    for (i = 0; i < num_dir_entries; ++i) {
+    size_t pos = start_of_directory_local;
+    auto readField = [&](size_t length, ByteArray& field) {
+        if (pos + length > size) {
+            return false;
+        }
+        field = ByteArray(data + pos, length);
+        pos += length;
+        return true;
+    };
+
+    fileHeaders.reserve(num_dir_entries);
+    for (int entry = 0; entry < num_dir_entries; ++entry) {
         FileHeader header;
-        int read = (int)device->read((uint8_t*)&header.h, sizeof(CentralFileHeader));
-        if (read < (int)sizeof(CentralFileHeader)) {
+        if (pos + sizeof(CentralFileHeader) > size) {
             LOGW("Zip: Failed to read complete header, index may be incomplete");
             break;
         }
+        std::memcpy(&header.h, data + pos, sizeof(CentralFileHeader));
+        pos += sizeof(CentralFileHeader);
+
         if (readUInt(header.h.signature) != 0x02014b50) {
             LOGW("Zip: invalid header signature, index may be incomplete");
             break;
         }
 
-        size_t l = readUShort(header.h.file_name_length);
-        header.file_name = device->read(l);
-        if (header.file_name.size() != l) {
+        if (!readField(readUShort(header.h.file_name_length), header.file_name)) {
             LOGW("Zip: Failed to read filename from zip index, index may be incomplete");
             break;
         }
-        l = readUShort(header.h.extra_field_length);
-        header.extra_field = device->read(l);
-        if (header.extra_field.size() != l) {
+        if (!readField(readUShort(header.h.extra_field_length), header.extra_field)) {
             LOGW("Zip: Failed to read extra field in zip file, skipping file, index may be incomplete");
             break;
         }
-        l = readUShort(header.h.file_comment_length);
-        header.file_comment = device->read(l);
-        if (header.file_comment.size() != l) {
+        if (!readField(readUShort(header.h.file_comment_length), header.file_comment)) {
             LOGW("Zip: Failed to read read file comment, index may be incomplete");
             break;
         }
 
-        ZDEBUG("found file '%s'", header.file_name.data());
-        fileHeaders.push_back(header);
+        ZDEBUG("found file '%s'", header.file_name.constChar());
+        addHeader(std::move(header));
     }
 }
 
+void ZipContainer::Impl::addHeader(FileHeader&& header)
+{
+    fileIndex.emplace(std::string(header.file_name.constChar(), header.file_name.size()), fileHeaders.size());
+    fileHeaders.push_back(std::move(header));
+}
+
+size_t ZipContainer::Impl::indexOf(const std::string& fileName) const
+{
+    auto it = fileIndex.find(fileName);
+    return it != fileIndex.end() ? it->second : muse::nidx;
+}
+
 ZipContainer::FileInfo ZipContainer::Impl::fillFileInfo(size_t index) const
 {
     ZipContainer::FileInfo fileInfo;
@@ -560,29 +675,102 @@ ZipContainer::FileInfo ZipContainer::Impl::fillFileInfo(size_t index) const
 }
 
 void ZipContainer::Impl::addEntry(EntryType type, const std::string& fileName, const ByteArray& contents)
+{
+    std::vector<PendingEntry> entries(1);
+    entries.front().type = type;
+    entries.front().fileName = fileName;
+    entries.front().contents = &contents;
+    addEntries(entries);
+}
+
+void ZipContainer::Impl::addEntries(std::vector<PendingEntry>& entries)
 {
     if (!(device->isOpen() || device->open(IODevice::WriteOnly))) {
         status = ZipContainer::FileOpenError;
         return;
     }
-    device->seek(start_of_directory);
 
-    // don't compress small files
-    ZipContainer::CompressionPolicy compression = compressionPolicy;
-    if (compressionPolicy == ZipContainer::AutoCompress) {
-        if (contents.size() < 64) {
-            compression = ZipContainer::NeverCompress;
-        } else {
-            compression = ZipContainer::AlwaysCompress;
+    //! NOTE All the files are compressed at once, so that the small ones are compressed in parallel too
+    std::vector<DeflateChunk> chunks;
+    for (PendingEntry& entry : entries) {
+        const ByteArray& contents = *entry.contents;
+
+        // don't compress small files
+        entry.compression = compressionPolicy;
+        if (compressionPolicy == ZipContainer::AutoCompress) {
+            if (contents.size() < 64) {
+                entry.compression = ZipContainer::NeverCompress;
+            } else {
+                entry.compression = ZipContainer::AlwaysCompress;
+            }
+        }
+
+        entry.crc = ::crc32(0, 0, 0);
+        entry.crc = ::crc32(entry.crc, (const uint8_t*)contents.constData(), (uint)contents.size());
+
+        if (entry.compression != ZipContainer::AlwaysCompress) {
+            entry.data = contents;
+            continue;
         }
+
+        if (compressionCache) {
+            std::lock_guard lock(compressionCache->mutex);
+            auto it = compressionCache->entries.find(entry.fileName);
+            if (it != compressionCache->entries.end() && it->second.crc == entry.crc && it->second.size == contents.size()) {
+                entry.data = it->second.data;
+                entry.isCached = true;
+                continue;
+            }
+        }
+
+        entry.firstChunk = chunks.size();
+        appendDeflateChunks(contents, chunks);
+        entry.chunkCount = chunks.size() - entry.firstChunk;
+    }
+
+    deflateChunks(chunks);
+
+    for (PendingEntry& entry : entries) {
+        if (entry.chunkCount > 0) {
+            size_t size = 0;
+            int result = Z_OK;
+            for (size_t i = entry.firstChunk; i < entry.firstChunk + entry.chunkCount; ++i) {
+                size += chunks.at(i).compressed.size();
+                if (chunks.at(i).result != Z_OK) {
+                    result = chunks.at(i).result;
+                }
+            }
+
+            if (result == Z_OK) {
+                entry.data.reserve(size);
+                for (size_t i = entry.firstChunk; i < entry.firstChunk + entry.chunkCount; ++i) {
+                    entry.data.push_back(chunks.at(i).compressed);
+                }
+            } else {
+                LOGW("Zip: Error %d while compressing file %s, skipping", result, entry.fileName.c_str());
+            }
+        }
+
+        if (entry.compression == ZipContainer::AlwaysCompress && compressionCache) {
+            writtenEntries[entry.fileName] = ZipCompressionCache::Entry { entry.crc, entry.contents->size(), entry.data };
+        }
+
+        writeEntry(entry);
     }
+}
+
+void ZipContainer::Impl::writeEntry(const PendingEntry& entry)
+{
+    const ByteArray& data = entry.data;
+
+    device->seek(start_of_directory);
 
     FileHeader header;
     std::memset(&header.h, 0, sizeof(CentralFileHeader));
     writeUInt(header.h.signature, 0x02014b50);
 
     writeUShort(header.h.version_needed, ZIP_VERSION);
-    writeUInt(header.h.uncompressed_size, (uint)contents.size());
+    writeUInt(header.h.uncompressed_size, (uint)entry.contents->size());
 
     std::time_t t = std::time(0);   // get time now
     std::tm now;
@@ -592,44 +780,21 @@ void ZipContainer::Impl::addEntry(EntryType type, const std::string& fileName, c
     localtime_r(&t, &now);
 #endif
     writeMSDosDate(header.h.last_mod_file, now);
-    ByteArray data = contents;
-    if (compression == ZipContainer::AlwaysCompress) {
-        writeUShort(header.h.compression_method, CompressionMethodDeflated);
 
-        ulong len = (ulong)contents.size();
-        // shamelessly copied form zlib
-        len += (len >> 12) + (len >> 14) + 11;
-        int res;
-        do {
-            data.resize(len);
-            res = deflate((uint8_t*)data.data(), &len, (const uint8_t*)contents.constData(), (ulong)contents.size());
-
-            switch (res) {
-            case Z_OK:
-                data.resize(len);
-                break;
-            case Z_MEM_ERROR:
-                LOGW("Zip: Z_MEM_ERROR: Not enough memory to compress file, skipping");
-                data.resize(0);
-                break;
-            case Z_BUF_ERROR:
-                len *= 2;
-                break;
-            }
-        } while (res == Z_BUF_ERROR);
+    if (entry.compression == ZipContainer::AlwaysCompress) {
+        writeUShort(header.h.compression_method, CompressionMethodDeflated);
     }
+
 // TODO add a check if data.size() > contents.size().  Then try to store the original and revert the compression method to be uncompressed
     writeUInt(header.h.compressed_size, (uint)data.size());
-    uint crc_32 = ::crc32(0, 0, 0);
-    crc_32 = ::crc32(crc_32, (const uint8_t*)contents.constData(), (uint)contents.size());
-    writeUInt(header.h.crc_32, crc_32);
+    writeUInt(header.h.crc_32, entry.crc);
 
     // if bit 11 is set, the filename and comment fields must be encoded using UTF-8
     ushort general_purpose_bits = Utf8Names; // always use utf-8
     writeUShort(header.h.general_purpose_bits, general_purpose_bits);
 
     //const bool inUtf8 = (general_purpose_bits & Utf8Names) != 0;
-    header.file_name = ByteArray(fileName.c_str(), fileName.size());
+    header.file_name = ByteArray(entry.fileName.c_str(), entry.fileName.size());
     if (header.file_name.size() > 0xffff) {
         LOGW("Zip: Filename is too long, chopping it to 65535 bytes");
         header.file_name = header.file_name.left(0xffff); // ### don't break the utf-8 sequence, if any
@@ -649,7 +814,7 @@ void ZipContainer::Impl::addEntry(EntryType type, const std::string& fileName, c
                     | UnixFileAttributes::ExeUser
                     | UnixFileAttributes::ReadGroup
                     | UnixFileAttributes::ReadOther;
-    switch (type) {
+    switch (entry.type) {
     case Symlink:
         mode |= UnixFileAttributes::SymLink;
         break;
@@ -666,7 +831,7 @@ void ZipContainer::Impl::addEntry(EntryType type, const std::string& fileName, c
     writeUInt(header.h.external_file_attributes, mode << 16);
     writeUInt(header.h.offset_local_header, start_of_directory);
 
-    fileHeaders.push_back(header);
+    addHeader(FileHeader(header));
 
     bool ok = true;
 
@@ -707,6 +872,7 @@ ZipContainer::~ZipContainer()
 
 std::vector<ZipContainer::FileInfo> ZipContainer::fileInfoList() const
 {
+    const std::lock_guard lock(p->readMutex);
     p->scanFiles();
     std::vector<FileInfo> files;
     const size_t numFileHeaders = p->fileHeaders.size();
@@ -719,40 +885,29 @@ std::vector<ZipContainer::FileInfo> ZipContainer::fileInfoList() const
 
 int ZipContainer::count() const
 {
+    const std::lock_guard lock(p->readMutex);
     p->scanFiles();
     return (int)p->fileHeaders.size();
 }
 
 bool ZipContainer::fileExists(const std::string& fileName) const
 {
+    const std::lock_guard lock(p->readMutex);
     p->scanFiles();
-    ByteArray fileNameBa = ByteArray::fromRawData(fileName.c_str(), fileName.size());
-    for (size_t i = 0; i < p->fileHeaders.size(); ++i) {
-        if (p->fileHeaders.at(i).file_name == fileNameBa) {
-            return true;
-        }
-    }
-    return false;
+    return p->indexOf(fileName) != muse::nidx;
 }
 
 ByteArray ZipContainer::fileData(const std::string& fileName) const
 {
+    std::unique_lock lock(p->readMutex);
     p->scanFiles();
 
-    ByteArray fileNameBa = ByteArray::fromRawData(fileName.c_str(), fileName.size());
-
-    size_t i;
-    for (i = 0; i < p->fileHeaders.size(); ++i) {
-        if (p->fileHeaders.at(i).file_name == fileNameBa) {
-            break;
-        }
-    }
-
-    if (i == p->fileHeaders.size()) {
+    const size_t i = p->indexOf(fileName);
+    if (i == muse::nidx) {
         return ByteArray();
     }
 
-    FileHeader header = p->fileHeaders.at(i);
+    const FileHeader& header = p->fileHeaders.at(i);
 
     ushort version_needed = readUShort(header.h.version_needed);
     if (version_needed > ZIP_VERSION) {
@@ -761,39 +916,52 @@ ByteArray ZipContainer::fileData(const std::string& fileName) const
     }
 
     ushort general_purpose_bits = readUShort(header.h.general_purpose_bits);
-    int compressed_size = readUInt(header.h.compressed_size);
-    int uncompressed_size = readUInt(header.h.uncompressed_size);
-    int start = readUInt(header.h.offset_local_header);
-
-    p->device->seek(start);
-    LocalFileHeader lh;
-    p->device->read((uint8_t*)&lh, sizeof(LocalFileHeader));
-    uint skip = readUShort(lh.file_name_length) + readUShort(lh.extra_field_length);
-    p->device->seek(p->device->pos() + skip);
-
-    int compression_method = readUShort(lh.compression_method);
+    size_t compressed_size = readUInt(header.h.compressed_size);
+    size_t uncompressed_size = readUInt(header.h.uncompressed_size);
+    size_t start = readUInt(header.h.offset_local_header);
 
     if ((general_purpose_bits & Encrypted) != 0) {
         LOGW("Zip: Unsupported encryption method is needed to extract the data.");
         return ByteArray();
     }
 
-    ByteArray compressed = p->device->read(compressed_size);
+    //! NOTE The device data does not change while reading, so the entry is inflated
+    //! straight from it, without copying the compressed data and without holding the lock
+    const uint8_t* data = p->device->readData();
+    const size_t size = p->device->size();
+    lock.unlock();
+
+    if (start + sizeof(LocalFileHeader) > size) {
+        LOGW("Zip: Local file header of %s is out of the file.", fileName.c_str());
+        return ByteArray();
+    }
+
+    LocalFileHeader lh;
+    std::memcpy(&lh, data + start, sizeof(LocalFileHeader));
+    const size_t dataStart = start + sizeof(LocalFileHeader) + readUShort(lh.file_name_length) + readUShort(lh.extra_field_length);
+    if (dataStart > size) {
+        LOGW("Zip: Data of %s is out of the file.", fileName.c_str());
+        return ByteArray();
+    }
+
+    //! NOTE Same as reading from the device: the sizes are clamped to the available data
+    compressed_size = std::min(compressed_size, size - dataStart);
+    const uint8_t* compressed = data + dataStart;
+
+    int compression_method = readUShort(lh.compression_method);
+
     if (compression_method == CompressionMethodStored) {
         // no compression
-        compressed.truncate(uncompressed_size);
-        return compressed;
+        return ByteArray(compressed, std::min(compressed_size, uncompressed_size));
     } else if (compression_method == CompressionMethodDeflated) {
         // Deflate
         //qDebug("compressed=%d", compressed.size());
-        compressed.truncate(compressed_size);
         ByteArray baunzip;
-        ulong len = std::max(uncompressed_size,  1);
+        ulong len = std::max(uncompressed_size, size_t(1));
         int res;
         do {
             baunzip.resize(len);
-            res = inflate((uint8_t*)baunzip.data(), &len,
-                          (const uint8_t*)compressed.constData(), compressed_size);
+            res = inflate((uint8_t*)baunzip.data(), &len, compressed, (ulong)compressed_size);
 
             switch (res) {
             case Z_OK:
@@ -834,11 +1002,28 @@ ZipContainer::CompressionPolicy ZipContainer::compressionPolicy() const
     return p->compressionPolicy;
 }
 
+void ZipContainer::setCompressionCache(std::shared_ptr<ZipCompressionCache> cache)
+{
+    p->compressionCache = cache;
+}
+
 void ZipContainer::addFile(const std::string& fileName, const ByteArray& data)
 {
     p->addEntry(Impl::File, Dir::fromNativeSeparators(fileName).toStdString(), data);
 }
 
+void ZipContainer::addFiles(const std::vector<std::pair<std::string, ByteArray> >& files)
+{
+    std::vector<Impl::PendingEntry> entries(files.size());
+    for (size_t i = 0; i < files.size(); ++i) {
+        entries[i].type = Impl::File;
+        entries[i].fileName = Dir::fromNativeSeparators(files[i].first).toStdString();
+        entries[i].contents = &files[i].second;
+    }
+
+    p->addEntries(entries);
+}
+
 void ZipContainer::addDirectory(const std::string& dirName)
 {
     std::string name(Dir::fromNativeSeparators(dirName).toStdString());
@@ -888,5 +1073,12 @@ void ZipContainer::close()
     if (!ok) {
         p->status = ZipContainer::FileWriteError;
     }
+
+    // the files which were not written this time are dropped from the cache
+    if (p->compressionCache && p->status == ZipContainer::NoError) {
+        std::lock_guard lock(p->compressionCache->mutex);
+        p->compressionCache->entries = std::move(p->writtenEntries);
+        p->writtenEntries.clear();
+    }
 }
 }
@@ -23,11 +23,30 @@
 #define MUSE_GLOBAL_ZIPCONTAINER_H
 
 #include <ctime>
+#include <memory>
+#include <mutex>
 #include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include "io/iodevice.h"
 
 namespace muse {
+//! NOTE Keeps the compressed files between writes, so that the files
+//! which did not change since the previous write are not compressed again
+struct ZipCompressionCache
+{
+    struct Entry {
+        uint32_t crc = 0;
+        size_t size = 0;
+        ByteArray data;
+    };
+
+    std::mutex mutex;
+    std::unordered_map<std::string, Entry> entries;
+};
+
 class ZipContainer
 {
 public:
@@ -76,7 +95,11 @@ public:
     void setCompressionPolicy(CompressionPolicy policy);
     CompressionPolicy compressionPolicy() const;
 
+    void setCompressionCache(std::shared_ptr<ZipCompressionCache> cache);
+
     void addFile(const std::string& fileName, const ByteArray& data);
+    //! NOTE The files are compressed in parallel
+    void addFiles(const std::vector<std::pair<std::string, ByteArray> >& files);
     void addDirectory(const std::string& dirName);
 
 private:
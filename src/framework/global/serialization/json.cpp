@@ -23,6 +23,7 @@
 
 #include <cmath>
 #include <cassert>
+#include <type_traits>
 
 #define PICOJSON_USE_LOCALE 1
 #define PICOJSON_ASSERT assert
@@ -47,6 +48,16 @@ static inline picojson::value& val_mut(std::shared_ptr<JsonData>& d)
     return d->val;
 }
 
+static_assert(std::is_standard_layout_v<JsonData>, "JsonData must be pointer-interconvertible with picojson::value");
+
+//! NOTE Returns data that shares ownership with the parent instead of copying the subtree,
+//! so reading nested values of a large document is cheap. A write through the child
+//! detaches it (its use_count includes the parent's), like for any other shared value
+static inline std::shared_ptr<JsonData> child_data(const std::shared_ptr<JsonData>& parent, const picojson::value& child)
+{
+    return std::shared_ptr<JsonData>(parent, reinterpret_cast<JsonData*>(const_cast<picojson::value*>(&child)));
+}
+
 // =======================================
 // JsonValue
 // =======================================
@@ -414,9 +425,7 @@ void JsonArray::resize(size_t i)
 
 JsonValue JsonArray::at(size_t i) const
 {
-    std::shared_ptr<JsonData> d = std::make_shared<JsonData>();
-    d->val = array_const(m_data).at(i);
-    return JsonValue(d);
+    return JsonValue(child_data(m_data, array_const(m_data).at(i)));
 }
 
 JsonArray& JsonArray::set(size_t i, bool v)
@@ -616,9 +625,7 @@ JsonValue JsonObject::value(const std::string& key, JsonValue def) const
     const picojson::object& o = object_const(m_data);
     auto it = o.find(key);
     if (it != o.cend()) {
-        std::shared_ptr<JsonData> d = std::make_shared<JsonData>();
-        d->val = it->second;
-        return JsonValue(d);
+        return JsonValue(child_data(m_data, it->second));
     }
     return def;
 }
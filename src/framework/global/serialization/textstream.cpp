@@ -20,11 +20,21 @@
  * along with this program.  If not, see <https://www.gnu.org/licenses/>.
  */
 #include "textstream.h"
+
+#include <charconv>
+#include <cstring>
 #include <sstream>
 
 using namespace muse;
 
-static constexpr int TEXTSTREAM_BUFFERSIZE = 16384;
+static constexpr size_t TEXTSTREAM_BUFFERSIZE = 65536;
+
+template<typename T>
+static std::string_view formatInteger(char (& buf)[24], T val)
+{
+    std::to_chars_result res = std::to_chars(buf, buf + sizeof(buf), val);
+    return std::string_view(buf, res.ptr - buf);
+}
 
 TextStream::TextStream(io::IODevice* device)
     : m_device(device)
@@ -44,7 +54,7 @@ void TextStream::setDevice(io::IODevice* device)
 void TextStream::flush()
 {
     if (m_device && m_device->isOpen()) {
-        m_device->write(m_buf);
+        m_device->write(reinterpret_cast<const uint8_t*>(m_buf.data()), m_buf.size());
         m_buf.clear();
     }
 }
@@ -57,57 +67,62 @@ TextStream& TextStream::operator<<(char ch)
 
 TextStream& TextStream::operator<<(int val)
 {
-    std::stringstream ss;
-    ss << val;
-    write(ss.str().c_str(), ss.str().size());
+    char buf[24];
+    std::string_view s = formatInteger(buf, val);
+    write(s.data(), s.size());
     return *this;
 }
 
 TextStream& TextStream::operator<<(unsigned int val)
 {
-    std::stringstream ss;
-    ss << val;
-    write(ss.str().c_str(), ss.str().size());
+    char buf[24];
+    std::string_view s = formatInteger(buf, val);
+    write(s.data(), s.size());
     return *this;
 }
 
 TextStream& TextStream::operator<<(double val)
 {
-    std::stringstream ss;
+    //! NOTE Constructing a stream is expensive (it initializes a locale),
+    //! so one stream per thread is reused
+    thread_local std::ostringstream ss;
+    ss.str(std::string());
+    ss.clear();
     ss << val;
-    write(ss.str().c_str(), ss.str().size());
+    std::string s = ss.str();
+    write(s.c_str(), s.size());
     return *this;
 }
 
 TextStream& TextStream::operator<<(signed long int val)
 {
-    std::stringstream ss;
-    ss << val;
-    write(ss.str().c_str(), ss.str().size());
+    char buf[24];
+    std::string_view s = formatInteger(buf, val);
+    write(s.data(), s.size());
     return *this;
 }
 
 TextStream& TextStream::operator<<(unsigned long int val)
 {
-    std::stringstream ss;
-    ss << val;
-    write(ss.str().c_str(), ss.str().size());
+    char buf[24];
+    std::string_view s = formatInteger(buf, val);
+    write(s.data(), s.size());
     return *this;
 }
 
 TextStream& TextStream::operator<<(signed long long val)
 {
-    std::stringstream ss;
-    ss << val;
-    write(ss.str().c_str(), ss.str().size());
+    char buf[24];
+    std::string_view s = formatInteger(buf, val);
+    write(s.data(), s.size());
     return *this;
 }
 
 TextStream& TextStream::operator<<(unsigned long long val)
 {
-    std::stringstream ss;
-    ss << val;
-    write(ss.str().c_str(), ss.str().size());
+    char buf[24];
+    std::string_view s = formatInteger(buf, val);
+    write(s.data(), s.size());
     return *this;
 }
 
@@ -147,14 +162,31 @@ TextStream& TextStream::operator<<(const AsciiStringView& s)
 
 TextStream& TextStream::operator<<(const String& s)
 {
-    ByteArray b = s.toUtf8();
-    write(reinterpret_cast<const char*>(b.constData()), b.size());
+    //! NOTE Converted straight into the buffer, most of the strings are ascii
+    std::u16string_view v = s.toStdU16StringView();
+    size_t i = 0;
+    for (; i < v.size() && v[i] < 0x80; ++i) {
+        m_buf.push_back(static_cast<char>(v[i]));
+    }
+
+    if (i < v.size()) {
+        UtfCodec::utf16to8(v.substr(i), m_buf);
+    }
+
+    if (m_device && m_buf.size() > TEXTSTREAM_BUFFERSIZE) {
+        flush();
+    }
+
     return *this;
 }
 
 void TextStream::write(const char* ch, size_t len)
 {
-    m_buf.push_back(reinterpret_cast<const uint8_t*>(ch), len);
+    if (m_buf.capacity() == 0) {
+        m_buf.reserve(TEXTSTREAM_BUFFERSIZE + 1024);
+    }
+
+    m_buf.append(ch, len);
     if (m_device && m_buf.size() > TEXTSTREAM_BUFFERSIZE) {
         flush();
     }
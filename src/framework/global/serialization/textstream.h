@@ -26,6 +26,8 @@
 #include "../types/bytearray.h"
 #include "../types/string.h"
 
+#include <string>
+
 #ifndef NO_QT_SUPPORT
 #include <QString>
 #endif
@@ -63,7 +65,7 @@ public:
 private:
     void write(const char* ch, size_t len);
     io::IODevice* m_device = nullptr;
-    ByteArray m_buf;
+    std::string m_buf;
 };
 }
 
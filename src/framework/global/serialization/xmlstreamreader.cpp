@@ -22,27 +22,694 @@
 #include "xmlstreamreader.h"
 
 #include <cstring>
+#include <deque>
+#include <limits>
+#include <memory>
+#include <set>
+#include <string>
+#include <string_view>
+#include <unordered_map>
 
 #include "global/types/string.h"
-#ifdef SYSTEM_TINYXML
-#include <tinyxml2.h>
-#else
-#include "thirdparty/tinyxml/tinyxml2.h"
-#endif
 
 #include "log.h"
 
 using namespace muse;
 using namespace muse::io;
-using namespace tinyxml2;
+
+//! NOTE The device is read by chunks of this size, a token longer than a chunk grows the next one
+static constexpr size_t CHUNK_SIZE = 64 * 1024;
+
+//! NOTE Snapshot layout: the header, the token records, the string pool.
+//! A record is the token type, the line and the string references of the token,
+//! a reference is an offset in the pool, where a string is stored as its size, the chars and '\0'
+static constexpr char SNAPSHOT_MAGIC[4] = { 'M', 'X', 'S', 'N' };
+static constexpr uint32_t SNAPSHOT_VERSION = 1;
+
+namespace {
+struct SnapshotHeader {
+    char magic[4];
+    uint32_t version = 0;
+    uint64_t recordsSize = 0;
+    uint64_t poolSize = 0;
+};
+}
+
+namespace {
+enum class ParseResult {
+    Done,
+    NeedMoreData,
+    Failed
+};
+}
+
+static inline bool isSpace(char c)
+{
+    return c == ' ' || c == '\n' || c == '\t' || c == '\r';
+}
+
+static inline bool isNameEnd(char c)
+{
+    return isSpace(c) || c == '>' || c == '/' || c == '=';
+}
+
+static size_t writeUtf8(uint32_t code, char* out)
+{
+    if (code < 0x80) {
+        out[0] = static_cast<char>(code);
+        return 1;
+    }
+    if (code < 0x800) {
+        out[0] = static_cast<char>(0xC0 | (code >> 6));
+        out[1] = static_cast<char>(0x80 | (code & 0x3F));
+        return 2;
+    }
+    if (code < 0x10000) {
+        out[0] = static_cast<char>(0xE0 | (code >> 12));
+        out[1] = static_cast<char>(0x80 | ((code >> 6) & 0x3F));
+        out[2] = static_cast<char>(0x80 | (code & 0x3F));
+        return 3;
+    }
+    out[0] = static_cast<char>(0xF0 | (code >> 18));
+    out[1] = static_cast<char>(0x80 | ((code >> 12) & 0x3F));
+    out[2] = static_cast<char>(0x80 | ((code >> 6) & 0x3F));
+    out[3] = static_cast<char>(0x80 | (code & 0x3F));
+    return 4;
+}
+
+//! Decodes the entity at the start of str into out, returns the length of the entity or 0 if it is not a known one.
+//! The decoded value is never longer than the entity, so out can point into str
+static size_t decodeEntity(const char* str, size_t size, char* out, size_t& written)
+{
+    std::string_view view(str, std::min(size, size_t(12)));
+    size_t semicolon = view.find(';');
+    if (semicolon == std::string_view::npos) {
+        return 0;
+    }
+
+    std::string_view entity = view.substr(1, semicolon - 1);
+
+    static const std::pair<std::string_view, char> NAMED[] = {
+        { "lt", '<' }, { "gt", '>' }, { "amp", '&' }, { "quot", '"' }, { "apos", '\'' }
+    };
+
+    for (const auto& named : NAMED) {
+        if (entity == named.first) {
+            out[0] = named.second;
+            written = 1;
+            return semicolon + 1;
+        }
+    }
+
+    if (entity.size() < 2 || entity[0] != '#') {
+        return 0;
+    }
+
+    bool isHex = entity[1] == 'x' || entity[1] == 'X';
+    std::string_view digits = entity.substr(isHex ? 2 : 1);
+    if (digits.empty()) {
+        return 0;
+    }
+
+    uint32_t code = 0;
+    for (char c : digits) {
+        uint32_t digit = 0;
+        if (c >= '0' && c <= '9') {
+            digit = c - '0';
+        } else if (isHex && c >= 'a' && c <= 'f') {
+            digit = c - 'a' + 10;
+        } else if (isHex && c >= 'A' && c <= 'F') {
+            digit = c - 'A' + 10;
+        } else {
+            return 0;
+        }
+        code = code * (isHex ? 16 : 10) + digit;
+    }
+
+    if (code == 0 || code > 0x10FFFF) {
+        return 0;
+    }
+
+    written = writeUtf8(code, out);
+    return semicolon + 1;
+}
+
+//! Normalizes the line ends and, if needed, replaces the entities in [from, to), returns the new end
+static size_t decodeInPlace(char* data, size_t from, size_t to, bool processEntities)
+{
+    size_t r = from;
+    while (r < to && data[r] != '\r' && !(processEntities && data[r] == '&')) {
+        ++r;
+    }
+
+    size_t w = r;
+    while (r < to) {
+        char c = data[r];
+        if (c == '\r') {
+            data[w++] = '\n';
+            r += (r + 1 < to && data[r + 1] == '\n') ? 2 : 1;
+            continue;
+        }
+
+        if (c == '&' && processEntities) {
+            size_t written = 0;
+            size_t length = decodeEntity(data + r, to - r, data + w, written);
+            if (length > 0) {
+                w += written;
+                r += length;
+                continue;
+            }
+        }
+
+        data[w++] = c;
+        ++r;
+    }
+
+    return w;
+}
 
 struct XmlStreamReader::Xml {
-    XMLDocument doc;
-    XMLNode* node = nullptr;
-    XMLError err;
+    struct Chunk {
+        std::unique_ptr<char[]> data;
+        size_t capacity = 0;
+        size_t size = 0;
+        uint64_t offset = 0;                    //!< of the first byte in the document
+        uint64_t usedUntil = UINT64_MAX;        //!< the data after this offset was moved to the next chunk
+    };
+
+    struct AttributeRange {
+        size_t nameBegin = 0;
+        size_t nameEnd = 0;
+        size_t valueBegin = 0;
+        size_t valueEnd = 0;
+    };
+
+    IODevice* device = nullptr;
+    bool isReadingByChunks = false;
+    std::deque<Chunk> chunks;
+    size_t pos = 0;                             //!< in the last chunk
+    bool isInsideMarkup = false;                //!< the '<' before pos is already consumed
+    bool isEmptyElement = false;
+    uint64_t lastStartElementOffset = 0;
+
+    AsciiStringView name;
+    AsciiStringView text;
+    AsciiStringView dtd;
+    std::vector<std::pair<AsciiStringView, AsciiStringView> > attributes;
+    std::vector<AttributeRange> attributeRanges;
+
+    std::vector<std::string> openElements;
+    size_t depth = 0;
+
+    //! NOTE When reading a snapshot, the views point into its string pool
+    ByteArray snapshot;
+    const uint8_t* records = nullptr;
+    size_t recordsSize = 0;
+    size_t recordPos = 0;
+    const char* pool = nullptr;
+    size_t poolSize = 0;
+
+    //! NOTE When reading by chunks the element names are interned, so the tag names stay valid
+    //! while the children of the element are read. The names are a small vocabulary
+    std::set<std::string, std::less<> > names;
+
+    int64_t line = 1;
+
+    Error err = NoError;
+    String errorText;
     String customErr;
+
+    void setError(Error e, const char* id, const std::string& details = std::string())
+    {
+        err = e;
+        errorText = String::fromUtf8(id) + u", line " + String::number(line);
+        if (!details.empty()) {
+            errorText += u": " + String::fromStdString(details);
+        }
+        LOGE() << errorText;
+    }
+
+    void addChunk(size_t capacity, uint64_t offset)
+    {
+        Chunk chunk;
+        chunk.data = std::make_unique<char[]>(capacity + 1);
+        chunk.capacity = capacity;
+        chunk.offset = offset;
+        chunks.push_back(std::move(chunk));
+    }
+
+    AsciiStringView elementName(const char* data, size_t size)
+    {
+        if (!isReadingByChunks) {
+            return AsciiStringView(data, size);
+        }
+
+        std::string_view key(data, size);
+        auto it = names.find(key);
+        if (it == names.end()) {
+            it = names.emplace(key).first;
+        }
+
+        return AsciiStringView(it->c_str(), it->size());
+    }
+
+    void countLines(const char* data, size_t from, size_t to)
+    {
+        for (size_t i = from; i < to; ++i) {
+            if (data[i] == '\n') {
+                ++line;
+            }
+        }
+    }
+
+    //! Reads more data from the device, the incomplete token at pos stays contiguous
+    bool readMore()
+    {
+        if (!device) {
+            return false;
+        }
+
+        Chunk* chunk = &chunks.back();
+
+        if (chunk->size == chunk->capacity) {
+            const size_t tail = chunk->size - pos;
+            const uint64_t offset = chunk->offset + pos;
+
+            chunk->usedUntil = offset;
+            addChunk(std::max(CHUNK_SIZE, tail * 2), offset);
+
+            Chunk* next = &chunks.back();
+            std::memcpy(next->data.get(), chunk->data.get() + pos, tail);
+            next->size = tail;
+            pos = 0;
+            chunk = next;
+        }
+
+        size_t read = device->read(reinterpret_cast<uint8_t*>(chunk->data.get() + chunk->size), chunk->capacity - chunk->size);
+        if (read == 0) {
+            device = nullptr;
+            return false;
+        }
+
+        chunk->size += read;
+        chunk->data[chunk->size] = '\0';
+
+        return true;
+    }
+
+    //! The views of the last start element and of the following tokens may still be used
+    void releaseChunks()
+    {
+        while (chunks.size() > 1 && chunks.front().usedUntil <= lastStartElementOffset) {
+            chunks.pop_front();
+        }
+    }
+
+    template<typename T>
+    bool readRecord(T& value)
+    {
+        if (recordPos + sizeof(T) > recordsSize) {
+            return false;
+        }
+
+        std::memcpy(&value, records + recordPos, sizeof(T));
+        recordPos += sizeof(T);
+        return true;
+    }
+
+    bool readPoolString(AsciiStringView& str)
+    {
+        uint32_t offset = 0;
+        if (!readRecord(offset)) {
+            return false;
+        }
+
+        uint32_t size = 0;
+        if (static_cast<size_t>(offset) + sizeof(size) > poolSize) {
+            return false;
+        }
+
+        std::memcpy(&size, pool + offset, sizeof(size));
+        const size_t begin = static_cast<size_t>(offset) + sizeof(size);
+        if (begin + size >= poolSize || pool[begin + size] != '\0') {
+            return false;
+        }
+
+        str = AsciiStringView(pool + begin, size);
+        return true;
+    }
+
+    bool readSnapshotToken(TokenType& type);
+
+    ParseResult parseToken(TokenType& type);
+    ParseResult parseMarkup(TokenType& type);
+    ParseResult parseStartElement(TokenType& type);
+    ParseResult parseEndElement(TokenType& type);
 };
 
+bool XmlStreamReader::Xml::readSnapshotToken(TokenType& type)
+{
+    uint8_t recordType = 0;
+    uint32_t recordLine = 0;
+    if (!readRecord(recordType) || !readRecord(recordLine)) {
+        return false;
+    }
+
+    type = static_cast<TokenType>(recordType);
+    line = recordLine;
+    name = AsciiStringView();
+    text = AsciiStringView();
+
+    switch (type) {
+    case TokenType::StartElement: {
+        uint16_t count = 0;
+        if (!readPoolString(name) || !readRecord(count)) {
+            return false;
+        }
+
+        attributes.clear();
+        for (uint16_t i = 0; i < count; ++i) {
+            AsciiStringView attrName;
+            AsciiStringView attrValue;
+            if (!readPoolString(attrName) || !readPoolString(attrValue)) {
+                return false;
+            }
+            attributes.emplace_back(attrName, attrValue);
+        }
+        return true;
+    }
+    case TokenType::EndElement:
+        return readPoolString(name);
+    case TokenType::Characters:
+    case TokenType::Comment:
+        return readPoolString(text);
+    case TokenType::DTD:
+        return readPoolString(dtd);
+    case TokenType::StartDocument:
+        return true;
+    default:
+        break;
+    }
+
+    return false;
+}
+
+ParseResult XmlStreamReader::Xml::parseToken(TokenType& type)
+{
+    Chunk& chunk = chunks.back();
+    char* data = chunk.data.get();
+    const size_t end = chunk.size;
+
+    if (isInsideMarkup) {
+        return parseMarkup(type);
+    }
+
+    size_t i = pos;
+    while (i < end && isSpace(data[i])) {
+        ++i;
+    }
+
+    if (i == end) {
+        return ParseResult::NeedMoreData;
+    }
+
+    if (data[i] == '<') {
+        countLines(data, pos, i);
+        pos = i + 1;
+        isInsideMarkup = true;
+        return parseMarkup(type);
+    }
+
+    //! NOTE The leading whitespaces belong to the text
+    const char* lt = static_cast<const char*>(std::memchr(data + i, '<', end - i));
+    if (!lt) {
+        return ParseResult::NeedMoreData;
+    }
+
+    size_t textEnd = lt - data;
+    countLines(data, pos, textEnd);
+
+    size_t decodedEnd = decodeInPlace(data, pos, textEnd, true);
+    data[decodedEnd] = '\0';
+
+    type = TokenType::Characters;
+    name = AsciiStringView();
+    text = AsciiStringView(data + pos, decodedEnd - pos);
+
+    pos = textEnd + 1;
+    isInsideMarkup = true;
+
+    return ParseResult::Done;
+}
+
+ParseResult XmlStreamReader::Xml::parseMarkup(TokenType& type)
+{
+    Chunk& chunk = chunks.back();
+    char* data = chunk.data.get();
+    std::string_view view(data, chunk.size);
+
+    if (pos >= view.size()) {
+        return ParseResult::NeedMoreData;
+    }
+
+    auto complete = [&](TokenType t, size_t from, size_t to, size_t next, bool decode) {
+        countLines(data, pos, next);
+
+        size_t decodedEnd = decode ? decodeInPlace(data, from, to, false) : to;
+        data[decodedEnd] = '\0';
+
+        type = t;
+        name = AsciiStringView();
+        text = AsciiStringView(data + from, decodedEnd - from);
+
+        pos = next;
+        isInsideMarkup = false;
+
+        return ParseResult::Done;
+    };
+
+    switch (data[pos]) {
+    case '/':
+        return parseEndElement(type);
+    case '?': {
+        size_t close = view.find("?>", pos + 1);
+        if (close == std::string_view::npos) {
+            return ParseResult::NeedMoreData;
+        }
+
+        ParseResult result = complete(TokenType::StartDocument, pos + 1, close, close + 2, false);
+        text = AsciiStringView();
+        return result;
+    }
+    case '!': {
+        static constexpr std::string_view COMMENT = "!--";
+        static constexpr std::string_view CDATA = "![CDATA[";
+
+        std::string_view rest = view.substr(pos);
+        if (rest.size() < CDATA.size() && CDATA.substr(0, rest.size()) == rest) {
+            return ParseResult::NeedMoreData;
+        }
+
+        if (rest.substr(0, COMMENT.size()) == COMMENT) {
+            size_t close = view.find("-->", pos + COMMENT.size());
+            if (close == std::string_view::npos) {
+                return ParseResult::NeedMoreData;
+            }
+            return complete(TokenType::Comment, pos + COMMENT.size(), close, close + 3, true);
+        }
+
+        if (rest.substr(0, CDATA.size()) == CDATA) {
+            size_t close = view.find("]]>", pos + CDATA.size());
+            if (close == std::string_view::npos) {
+                return ParseResult::NeedMoreData;
+            }
+            return complete(TokenType::Characters, pos + CDATA.size(), close, close + 3, true);
+        }
+
+        size_t close = view.find('>', pos + 1);
+        if (close == std::string_view::npos) {
+            return ParseResult::NeedMoreData;
+        }
+
+        ParseResult result = complete(TokenType::DTD, pos + 1, close, close + 1, false);
+        dtd = text;
+        text = AsciiStringView();
+        return result;
+    }
+    default:
+        break;
+    }
+
+    return parseStartElement(type);
+}
+
+ParseResult XmlStreamReader::Xml::parseStartElement(TokenType& type)
+{
+    Chunk& chunk = chunks.back();
+    char* data = chunk.data.get();
+    std::string_view view(data, chunk.size);
+    const size_t end = view.size();
+
+    size_t i = pos;
+    while (i < end && !isNameEnd(data[i])) {
+        ++i;
+    }
+
+    if (i == end) {
+        return ParseResult::NeedMoreData;
+    }
+
+    const size_t nameEnd = i;
+    if (nameEnd == pos) {
+        setError(NotWellFormedError, "XML_ERROR_PARSING_ELEMENT");
+        return ParseResult::Failed;
+    }
+
+    attributeRanges.clear();
+    bool isEmpty = false;
+
+    while (true) {
+        while (i < end && isSpace(data[i])) {
+            ++i;
+        }
+
+        if (i == end) {
+            return ParseResult::NeedMoreData;
+        }
+
+        if (data[i] == '>') {
+            ++i;
+            break;
+        }
+
+        if (data[i] == '/') {
+            if (i + 1 == end) {
+                return ParseResult::NeedMoreData;
+            }
+            if (data[i + 1] != '>') {
+                setError(NotWellFormedError, "XML_ERROR_PARSING_ELEMENT");
+                return ParseResult::Failed;
+            }
+            isEmpty = true;
+            i += 2;
+            break;
+        }
+
+        AttributeRange range;
+        range.nameBegin = i;
+        while (i < end && !isNameEnd(data[i])) {
+            ++i;
+        }
+        range.nameEnd = i;
+
+        while (i < end && isSpace(data[i])) {
+            ++i;
+        }
+
+        if (i + 1 >= end) {
+            return ParseResult::NeedMoreData;
+        }
+
+        if (range.nameEnd == range.nameBegin || data[i] != '=') {
+            setError(NotWellFormedError, "XML_ERROR_PARSING_ATTRIBUTE", std::string(view.substr(pos, nameEnd - pos)));
+            return ParseResult::Failed;
+        }
+
+        ++i;
+        while (i < end && isSpace(data[i])) {
+            ++i;
+        }
+
+        if (i == end) {
+            return ParseResult::NeedMoreData;
+        }
+
+        const char quote = data[i];
+        if (quote != '"' && quote != '\'') {
+            setError(NotWellFormedError, "XML_ERROR_PARSING_ATTRIBUTE", std::string(view.substr(pos, nameEnd - pos)));
+            return ParseResult::Failed;
+        }
+
+        range.valueBegin = i + 1;
+        range.valueEnd = view.find(quote, range.valueBegin);
+        if (range.valueEnd == std::string_view::npos) {
+            return ParseResult::NeedMoreData;
+        }
+
+        i = range.valueEnd + 1;
+        attributeRanges.push_back(range);
+    }
+
+    //! NOTE The element is complete, now the delimiters can be replaced by the terminating zeros
+    countLines(data, pos, i);
+
+    data[nameEnd] = '\0';
+    name = elementName(data + pos, nameEnd - pos);
+    text = AsciiStringView();
+
+    attributes.clear();
+    for (const AttributeRange& range : attributeRanges) {
+        data[range.nameEnd] = '\0';
+        size_t valueEnd = decodeInPlace(data, range.valueBegin, range.valueEnd, true);
+        data[valueEnd] = '\0';
+
+        attributes.emplace_back(AsciiStringView(data + range.nameBegin, range.nameEnd - range.nameBegin),
+                                AsciiStringView(data + range.valueBegin, valueEnd - range.valueBegin));
+    }
+
+    if (depth == openElements.size()) {
+        openElements.emplace_back();
+    }
+    openElements[depth].assign(name.ascii(), name.size());
+    ++depth;
+
+    lastStartElementOffset = chunk.offset + pos;
+    isEmptyElement = isEmpty;
+
+    type = TokenType::StartElement;
+    pos = i;
+    isInsideMarkup = false;
+
+    return ParseResult::Done;
+}
+
+ParseResult XmlStreamReader::Xml::parseEndElement(TokenType& type)
+{
+    Chunk& chunk = chunks.back();
+    char* data = chunk.data.get();
+    std::string_view view(data, chunk.size);
+
+    size_t close = view.find('>', pos + 1);
+    if (close == std::string_view::npos) {
+        return ParseResult::NeedMoreData;
+    }
+
+    const size_t nameBegin = pos + 1;
+    size_t nameEnd = nameBegin;
+    while (nameEnd < close && !isSpace(data[nameEnd])) {
+        ++nameEnd;
+    }
+
+    std::string_view endName = view.substr(nameBegin, nameEnd - nameBegin);
+    if (depth == 0 || openElements[depth - 1] != endName) {
+        setError(NotWellFormedError, "XML_ERROR_MISMATCHED_ELEMENT", std::string(endName));
+        return ParseResult::Failed;
+    }
+
+    countLines(data, pos, close + 1);
+
+    data[nameEnd] = '\0';
+    name = elementName(data + nameBegin, nameEnd - nameBegin);
+    text = AsciiStringView();
+    --depth;
+
+    type = TokenType::EndElement;
+    pos = close + 1;
+    isInsideMarkup = false;
+
+    return ParseResult::Done;
+}
+
 XmlStreamReader::XmlStreamReader()
 {
     m_xml = new Xml();
@@ -51,8 +718,7 @@ XmlStreamReader::XmlStreamReader()
 XmlStreamReader::XmlStreamReader(IODevice* device)
 {
     m_xml = new Xml();
-    ByteArray data = device->readAll();
-    setData(data);
+    setDevice(device);
 }
 
 XmlStreamReader::XmlStreamReader(const ByteArray& data)
@@ -78,20 +744,17 @@ XmlStreamReader::~XmlStreamReader()
 
 void XmlStreamReader::setData(const ByteArray& data_)
 {
-    m_xml->doc.Clear();
-    m_xml->customErr.clear();
+    *m_xml = Xml();
     m_token = TokenType::Invalid;
 
     if (data_.size() < 4) {
-        m_xml->err = XML_ERROR_EMPTY_DOCUMENT;
-        LOGE() << m_xml->doc.ErrorIDToName(m_xml->err);
+        m_xml->setError(NotWellFormedError, "XML_ERROR_EMPTY_DOCUMENT");
         return;
     }
 
     UtfCodec::Encoding enc = UtfCodec::xmlEncoding(data_);
     if (enc == UtfCodec::Encoding::Unknown) {
-        m_xml->err = XML_CAN_NOT_CONVERT_TEXT;
-        LOGE() << "unknown encoding";
+        m_xml->setError(NotWellFormedError, "XML_CAN_NOT_CONVERT_TEXT", "unknown encoding");
         return;
     }
 
@@ -104,75 +767,188 @@ void XmlStreamReader::setData(const ByteArray& data_)
         data = u16.toUtf8();
     }
 
-    m_xml->err = m_xml->doc.Parse(reinterpret_cast<const char*>(data.constData()), data.size());
+    //! NOTE The data is tokenized in place, so it is copied once (there is no document tree)
+    m_xml->addChunk(data.size(), 0);
+    Xml::Chunk& chunk = m_xml->chunks.back();
+    std::memcpy(chunk.data.get(), data.constChar(), data.size());
+    chunk.size = data.size();
+    chunk.data[chunk.size] = '\0';
 
-    if (m_xml->err == XML_SUCCESS) {
-        m_token = TokenType::NoToken;
-    } else {
-        LOGE() << m_xml->doc.ErrorIDToName(m_xml->err);
+    if (chunk.size >= 3 && std::memcmp(chunk.data.get(), "\xEF\xBB\xBF", 3) == 0) {
+        m_xml->pos = 3;
     }
+
+    m_token = TokenType::NoToken;
 }
 
-bool XmlStreamReader::readNextStartElement()
+void XmlStreamReader::setDevice(IODevice* device)
 {
-    while (readNext() != Invalid) {
-        if (isEndElement()) {
-            return false;
-        } else if (isStartElement()) {
-            return true;
+    *m_xml = Xml();
+    m_token = TokenType::Invalid;
+
+    m_xml->device = device;
+    m_xml->isReadingByChunks = true;
+    m_xml->addChunk(CHUNK_SIZE, 0);
+
+    while (m_xml->chunks.back().size < 4 && m_xml->readMore()) {
+    }
+
+    const Xml::Chunk& chunk = m_xml->chunks.back();
+    ByteArray head = ByteArray::fromRawData(chunk.data.get(), chunk.size);
+
+    UtfCodec::Encoding enc = head.size() < 4 ? UtfCodec::Encoding::Unknown : UtfCodec::xmlEncoding(head);
+    if (enc != UtfCodec::Encoding::UTF_8) {
+        //! NOTE Other encodings are rare, they are converted at once
+        ByteArray data(chunk.data.get(), chunk.size);
+        if (m_xml->device) {
+            data.push_back(device->readAll());
         }
+        setData(data);
+        return;
     }
-    return false;
-}
 
-bool XmlStreamReader::atEnd() const
-{
-    return m_token == TokenType::EndDocument || m_token == TokenType::Invalid;
+    if (std::memcmp(chunk.data.get(), "\xEF\xBB\xBF", 3) == 0) {
+        m_xml->pos = 3;
+    }
+
+    m_token = TokenType::NoToken;
 }
 
-static XmlStreamReader::TokenType resolveToken(XMLNode* n, bool isStartElement)
+ByteArray XmlStreamReader::makeSnapshot(const ByteArray& data)
 {
-    if (n->ToElement()) {
-        return isStartElement ? XmlStreamReader::TokenType::StartElement : XmlStreamReader::TokenType::EndElement;
-    } else if (n->ToText()) {
-        return XmlStreamReader::TokenType::Characters;
-    } else if (n->ToComment()) {
-        return XmlStreamReader::TokenType::Comment;
-    } else if (n->ToDeclaration()) {
-        return XmlStreamReader::TokenType::StartDocument;
-    } else if (n->ToDocument()) {
-        return XmlStreamReader::TokenType::EndDocument;
-    } else if (n->ToUnknown()) {
-        return XmlStreamReader::TokenType::DTD;
+    //! NOTE The pool offsets are 32 bit, each string of the pool takes at least one byte of the document
+    if (data.size() > std::numeric_limits<uint32_t>::max() / 8) {
+        LOGE() << "the document is too large for a snapshot";
+        return ByteArray();
     }
-    return XmlStreamReader::TokenType::Unknown;
-}
 
-static std::pair<XMLNode*, XmlStreamReader::TokenType> resolveNode(XMLNode* currentNode, XmlStreamReader::TokenType currentToken)
-{
-    if (currentToken == XmlStreamReader::TokenType::StartElement) {
-        XMLNode* child = currentNode->FirstChild();
-        if (child) {
-            return { child, resolveToken(child, true) };
+    std::vector<uint8_t> records;
+    std::string pool;
+
+    //! NOTE The strings are interned, the names and many of the values are a small vocabulary.
+    //! The keys point into the reader data, which stays valid as long as the reader
+    std::unordered_map<std::string_view, uint32_t> offsets;
+
+    auto append = [&records](const auto& value) {
+        const uint8_t* bytes = reinterpret_cast<const uint8_t*>(&value);
+        records.insert(records.end(), bytes, bytes + sizeof(value));
+    };
+
+    auto appendString = [&](const AsciiStringView& str) {
+        const std::string_view key(str.ascii(), str.size());
+        auto it = offsets.find(key);
+        if (it == offsets.end()) {
+            const uint32_t size = static_cast<uint32_t>(str.size());
+            const uint32_t offset = static_cast<uint32_t>(pool.size());
+            pool.append(reinterpret_cast<const char*>(&size), sizeof(size));
+            pool.append(str.ascii(), str.size());
+            pool.push_back('\0');
+            it = offsets.emplace(key, offset).first;
+        }
+        append(it->second);
+    };
+
+    XmlStreamReader reader(data);
+    while (true) {
+        const TokenType type = reader.readNext();
+        if (type == TokenType::Invalid) {
+            return ByteArray();
         }
 
-        XMLNode* sibling = currentNode->NextSibling();
-        if (!sibling || sibling->ToElement() || sibling->ToText()) {
-            return { currentNode, XmlStreamReader::TokenType::EndElement };
+        if (type == TokenType::EndDocument) {
+            break;
+        }
+
+        append(static_cast<uint8_t>(type));
+        append(static_cast<uint32_t>(reader.m_xml->line));
+
+        switch (type) {
+        case TokenType::StartElement: {
+            const auto& attributes = reader.m_xml->attributes;
+            if (attributes.size() > std::numeric_limits<uint16_t>::max()) {
+                return ByteArray();
+            }
+
+            appendString(reader.m_xml->name);
+            append(static_cast<uint16_t>(attributes.size()));
+            for (const auto& a : attributes) {
+                appendString(a.first);
+                appendString(a.second);
+            }
+        } break;
+        case TokenType::EndElement:
+            appendString(reader.m_xml->name);
+            break;
+        case TokenType::Characters:
+        case TokenType::Comment:
+            appendString(reader.m_xml->text);
+            break;
+        case TokenType::DTD:
+            appendString(reader.m_xml->dtd);
+            break;
+        default:
+            break;
         }
     }
 
-    XMLNode* sibling = currentNode->NextSibling();
-    if (sibling) {
-        return { sibling, resolveToken(sibling, true) };
+    SnapshotHeader header;
+    std::memcpy(header.magic, SNAPSHOT_MAGIC, sizeof(SNAPSHOT_MAGIC));
+    header.version = SNAPSHOT_VERSION;
+    header.recordsSize = records.size();
+    header.poolSize = pool.size();
+
+    ByteArray snapshot;
+    snapshot.reserve(sizeof(header) + records.size() + pool.size());
+    snapshot.push_back(reinterpret_cast<const uint8_t*>(&header), sizeof(header));
+    snapshot.push_back(records.data(), records.size());
+    snapshot.push_back(reinterpret_cast<const uint8_t*>(pool.data()), pool.size());
+
+    return snapshot;
+}
+
+bool XmlStreamReader::setSnapshot(const ByteArray& snapshot)
+{
+    *m_xml = Xml();
+    m_token = TokenType::Invalid;
+
+    SnapshotHeader header;
+    if (snapshot.size() < sizeof(header)) {
+        m_xml->setError(NotWellFormedError, "XML_ERROR_EMPTY_DOCUMENT");
+        return false;
     }
 
-    XMLNode* parent = currentNode->Parent();
-    if (parent) {
-        return { parent, resolveToken(parent, false) };
+    std::memcpy(&header, snapshot.constData(), sizeof(header));
+    if (std::memcmp(header.magic, SNAPSHOT_MAGIC, sizeof(SNAPSHOT_MAGIC)) != 0 || header.version != SNAPSHOT_VERSION
+        || header.recordsSize + header.poolSize != snapshot.size() - sizeof(header)) {
+        m_xml->setError(NotWellFormedError, "XML_ERROR_PARSING", "not a snapshot or an unsupported one");
+        return false;
     }
 
-    return { nullptr, XmlStreamReader::TokenType::EndDocument };
+    m_xml->snapshot = snapshot; // no copy, implicit sharing
+    m_xml->records = m_xml->snapshot.constData() + sizeof(header);
+    m_xml->recordsSize = header.recordsSize;
+    m_xml->pool = reinterpret_cast<const char*>(m_xml->records + header.recordsSize);
+    m_xml->poolSize = header.poolSize;
+
+    m_token = TokenType::NoToken;
+    return true;
+}
+
+bool XmlStreamReader::readNextStartElement()
+{
+    while (readNext() != Invalid) {
+        if (isEndElement()) {
+            return false;
+        } else if (isStartElement()) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool XmlStreamReader::atEnd() const
+{
+    return m_token == TokenType::EndDocument || m_token == TokenType::Invalid;
 }
 
 XmlStreamReader::TokenType XmlStreamReader::readNext()
@@ -181,65 +957,110 @@ XmlStreamReader::TokenType XmlStreamReader::readNext()
         return m_token;
     }
 
-    if (m_xml->err != XML_SUCCESS || m_token == EndDocument) {
-        m_xml->node = nullptr;
+    if (m_xml->err != NoError || m_token == EndDocument || (m_xml->chunks.empty() && !m_xml->records)) {
         m_token = TokenType::Invalid;
         return m_token;
     }
 
-    if (!m_xml->node) {
-        m_xml->node = m_xml->doc.FirstChild();
-        m_token = m_xml->node->ToDeclaration() ? TokenType::StartDocument : resolveToken(m_xml->node, true);
+    if (m_xml->isEmptyElement) {
+        //! NOTE The name of the element stays the same
+        m_xml->isEmptyElement = false;
+        m_xml->text = AsciiStringView();
+        --m_xml->depth;
+        m_token = TokenType::EndElement;
         return m_token;
     }
 
-    std::pair<XMLNode*, XmlStreamReader::TokenType> p = resolveNode(m_xml->node, m_token);
+    TokenType type = TokenType::Invalid;
+    if (m_xml->records) {
+        if (m_xml->recordPos == m_xml->recordsSize) {
+            m_xml->name = AsciiStringView();
+            m_xml->text = AsciiStringView();
+            m_token = TokenType::EndDocument;
+            return m_token;
+        }
+
+        if (!m_xml->readSnapshotToken(type)) {
+            m_xml->setError(NotWellFormedError, "XML_ERROR_PARSING", "broken snapshot");
+            m_token = TokenType::Invalid;
+            return m_token;
+        }
+    } else {
+        m_xml->releaseChunks();
 
-    m_xml->node = p.first;
-    m_token = p.second;
+        while (true) {
+            ParseResult result = m_xml->parseToken(type);
+            if (result == ParseResult::Done) {
+                break;
+            }
+
+            if (result == ParseResult::Failed) {
+                m_token = TokenType::Invalid;
+                return m_token;
+            }
+
+            if (!m_xml->readMore()) {
+                m_xml->name = AsciiStringView();
+                m_xml->text = AsciiStringView();
+
+                if (m_xml->isInsideMarkup || m_xml->depth > 0) {
+                    m_xml->setError(PrematureEndOfDocumentError, "XML_ERROR_PARSING", "unexpected end of document");
+                    m_token = TokenType::Invalid;
+                } else if (m_token == TokenType::NoToken) {
+                    m_xml->setError(NotWellFormedError, "XML_ERROR_EMPTY_DOCUMENT");
+                    m_token = TokenType::Invalid;
+                } else {
+                    m_token = TokenType::EndDocument;
+                }
+
+                return m_token;
+            }
+        }
+    }
+
+    m_token = type;
 
     if (m_token == XmlStreamReader::TokenType::DTD) {
-        tryParseEntity(m_xml);
+        tryParseEntity(m_xml->dtd);
     }
 
     return m_token;
 }
 
-#if (defined (_MSCVER) || defined (_MSC_VER))
-#define strdup _strdup // avoid a warning from MSVC on a perfectly valid POSIX function
-#endif
-void XmlStreamReader::tryParseEntity(Xml* xml)
-{
-    static const char* ENTITY = { "ENTITY" };
-
-    const char* str = xml->node->Value();
-    if (std::strncmp(str, ENTITY, 6) == 0) {
-        // Syntax: '<!ENTITY [%] Name [SYSTEM|PUBLIC] "Value" [additional info] >'
-        // the '<!' and '>' stripped away already from str
-        // let's ignore %, SYSTEM, PUBLIC and any spaces in the 1st token
-        // and not read the (optional) 3rd token at all
-        char* string = strdup(str); // create local copy
-        const char sep[] = "\"";
-        char* token = std::strtok(string + 6, sep); // start at the space after "ENTITY"
-        String name = String::fromUtf8(token).remove(u"%").remove(u"SYSTEM").remove(u"PUBLIC").remove(u" ");
-        token = std::strtok(NULL, sep); // read 2nd token
-        String value = String::fromUtf8(token);
-        free(string); // not needed anymore
+void XmlStreamReader::tryParseEntity(const AsciiStringView& value)
+{
+    static constexpr std::string_view ENTITY = "ENTITY";
+
+    std::string_view str(value.ascii(), value.size());
+    if (str.substr(0, ENTITY.size()) != ENTITY) {
+        return;
+    }
+
+    // Syntax: '<!ENTITY [%] Name [SYSTEM|PUBLIC] "Value" [additional info] >'
+    // the '<!' and '>' stripped away already from str
+    // let's ignore %, SYSTEM, PUBLIC and any spaces in the 1st token
+    // and not read the (optional) 3rd token at all
+    size_t nameEnd = str.find('"', ENTITY.size());
+    size_t valueEnd = nameEnd == std::string_view::npos ? nameEnd : str.find('"', nameEnd + 1);
+
+    if (valueEnd != std::string_view::npos) {
+        std::string_view nameToken = str.substr(ENTITY.size(), nameEnd - ENTITY.size());
+        std::string_view valueToken = str.substr(nameEnd + 1, valueEnd - nameEnd - 1);
+
+        String name = String::fromUtf8(std::string(nameToken).c_str()).remove(u"%").remove(u"SYSTEM").remove(u"PUBLIC").remove(u" ");
+        String v = String::fromUtf8(std::string(valueToken).c_str());
         if (!name.empty()) {
-            m_entities[u'&' + name + u';'] = value;
+            m_entities[u'&' + name + u';'] = v;
             return;
         }
-        LOGW() << "Ignoring malformed ENTITY: " << str;
     }
-}
 
-#if (defined(_MSCVER) || defined(_MSC_VER))
-#undef strdup
-#endif
+    LOGW() << "Ignoring malformed ENTITY: " << value.ascii();
+}
 
-String XmlStreamReader::nodeValue(Xml* xml) const
+String XmlStreamReader::nodeValue(const AsciiStringView& value) const
 {
-    String str = String::fromUtf8(xml->node->Value());
+    String str = String::fromUtf8(value.ascii());
     if (!m_entities.empty()) {
         for (const auto& p : m_entities) {
             str.replace(p.first, p.second);
@@ -289,7 +1110,7 @@ void XmlStreamReader::skipCurrentElement()
 
 AsciiStringView XmlStreamReader::name() const
 {
-    return (m_xml->node && m_xml->node->ToElement()) ? m_xml->node->Value() : AsciiStringView();
+    return (m_token == TokenType::StartElement || m_token == TokenType::EndElement) ? m_xml->name : AsciiStringView();
 }
 
 bool XmlStreamReader::hasAttribute(const char* name) const
@@ -298,24 +1119,18 @@ bool XmlStreamReader::hasAttribute(const char* name) const
         return false;
     }
 
-    XMLElement* e = m_xml->node->ToElement();
-    if (!e) {
-        return false;
+    const AsciiStringView key(name);
+    for (const auto& a : m_xml->attributes) {
+        if (a.first == key) {
+            return true;
+        }
     }
-    return e->FindAttribute(name) != nullptr;
+    return false;
 }
 
 String XmlStreamReader::attribute(const char* name) const
 {
-    if (m_token != TokenType::StartElement) {
-        return String();
-    }
-
-    XMLElement* e = m_xml->node->ToElement();
-    if (!e) {
-        return String();
-    }
-    return String::fromUtf8(e->Attribute(name));
+    return String::fromUtf8(asciiAttribute(name).ascii());
 }
 
 String XmlStreamReader::attribute(const char* name, const String& def) const
@@ -329,11 +1144,13 @@ AsciiStringView XmlStreamReader::asciiAttribute(const char* name) const
         return AsciiStringView();
     }
 
-    XMLElement* e = m_xml->node->ToElement();
-    if (!e) {
-        return AsciiStringView();
+    const AsciiStringView key(name);
+    for (const auto& a : m_xml->attributes) {
+        if (a.first == key) {
+            return a.second;
+        }
     }
-    return e->Attribute(name);
+    return AsciiStringView();
 }
 
 AsciiStringView XmlStreamReader::asciiAttribute(const char* name, const AsciiStringView& def) const
@@ -368,15 +1185,10 @@ std::vector<XmlStreamReader::Attribute> XmlStreamReader::attributes() const
         return attrs;
     }
 
-    XMLElement* e = m_xml->node->ToElement();
-    if (!e) {
-        return attrs;
-    }
-
-    for (const XMLAttribute* xa = e->FirstAttribute(); xa; xa = xa->Next()) {
+    for (const auto& xa : m_xml->attributes) {
         Attribute a;
-        a.name = xa->Name();
-        a.value = String::fromUtf8(xa->Value());
+        a.name = xa.first;
+        a.value = String::fromUtf8(xa.second.ascii());
         attrs.push_back(std::move(a));
     }
     return attrs;
@@ -384,16 +1196,16 @@ std::vector<XmlStreamReader::Attribute> XmlStreamReader::attributes() const
 
 String XmlStreamReader::text() const
 {
-    if (m_xml->node && (m_xml->node->ToText() || m_xml->node->ToComment())) {
-        return nodeValue(m_xml);
+    if (m_token == TokenType::Characters || m_token == TokenType::Comment) {
+        return nodeValue(m_xml->text);
     }
     return String();
 }
 
 AsciiStringView XmlStreamReader::asciiText() const
 {
-    if (m_xml->node && (m_xml->node->ToText() || m_xml->node->ToComment())) {
-        return m_xml->node->Value();
+    if (m_token == TokenType::Characters || m_token == TokenType::Comment) {
+        return m_xml->text;
     }
     return AsciiStringView();
 }
@@ -405,14 +1217,12 @@ String XmlStreamReader::readText()
         while (1) {
             switch (readNext()) {
             case Characters:
-                result = nodeValue(m_xml);
+                result = nodeValue(m_xml->text);
                 break;
             case EndElement:
                 return result;
-            case Comment:
-                break;
-            case StartElement:
-                break;
+            case Invalid:
+                return result;
             default:
                 break;
             }
@@ -428,14 +1238,12 @@ AsciiStringView XmlStreamReader::readAsciiText()
         while (1) {
             switch (readNext()) {
             case Characters:
-                result = AsciiStringView(m_xml->node->Value());
+                result = m_xml->text;
                 break;
             case EndElement:
                 return result;
-            case Comment:
-                break;
-            case StartElement:
-                break;
+            case Invalid:
+                return result;
             default:
                 break;
             }
@@ -458,7 +1266,7 @@ double XmlStreamReader::readDouble(bool* ok)
 
 int64_t XmlStreamReader::lineNumber() const
 {
-    return m_xml->doc.ErrorLineNum();
+    return m_xml->line;
 }
 
 int64_t XmlStreamReader::columnNumber() const
@@ -472,12 +1280,7 @@ XmlStreamReader::Error XmlStreamReader::error() const
         return CustomError;
     }
 
-    XMLError err = m_xml->doc.ErrorID();
-    if (err == XML_SUCCESS) {
-        return NoError;
-    }
-
-    return NotWellFormedError;
+    return m_xml->err;
 }
 
 bool XmlStreamReader::isError() const
@@ -490,7 +1293,7 @@ String XmlStreamReader::errorString() const
     if (!m_xml->customErr.empty()) {
         return m_xml->customErr;
     }
-    return String::fromUtf8(m_xml->doc.ErrorStr());
+    return m_xml->errorText;
 }
 
 void XmlStreamReader::raiseError(const String& message)
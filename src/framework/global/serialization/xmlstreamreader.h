@@ -34,6 +34,10 @@
 #endif
 
 namespace muse {
+//! NOTE A pull parser, which tokenizes the data in place.
+//! The returned AsciiStringView values point into the read data: when reading from a ByteArray
+//! they are valid as long as the reader. When reading from a device by chunks, the element names
+//! stay valid as long as the reader, the other values until the reader moves past the next start element
 class XmlStreamReader
 {
 public:
@@ -78,6 +82,11 @@ public:
 
     void setData(const ByteArray& data);
 
+    //! NOTE A snapshot is the token stream of a document in a compact binary form,
+    //! reading it skips the tokenizing. It is meant for local caches, the format is not portable
+    static ByteArray makeSnapshot(const ByteArray& data);
+    bool setSnapshot(const ByteArray& snapshot);
+
     bool readNextStartElement();
     bool atEnd() const;
     void skipCurrentElement();
@@ -122,8 +131,9 @@ public:
 private:
     struct Xml;
 
-    void tryParseEntity(Xml* xml);
-    String nodeValue(Xml* xml) const;
+    void setDevice(io::IODevice* device);
+    void tryParseEntity(const AsciiStringView& value);
+    String nodeValue(const AsciiStringView& value) const;
 
     Xml* m_xml = nullptr;
     TokenType m_token = TokenType::NoToken;
@@ -21,7 +21,10 @@
  */
 #include "xmlstreamwriter.h"
 
-#include "global/containers.h"
+#include <algorithm>
+#include <cstring>
+#include <string_view>
+
 #include "textstream.h"
 
 #include "log.h"
@@ -29,18 +32,68 @@
 using namespace muse;
 
 struct XmlStreamWriter::Impl {
-    std::list<std::string> stack;
+    std::vector<std::string> stack;
     TextStream stream;
+    std::string utf8;
 
     void putLevel()
     {
-        size_t level = stack.size();
-        for (size_t i = 0; i < level * 2; ++i) {
-            stream << ' ';
+        static constexpr std::string_view SPACES = "                                                                ";
+
+        size_t count = stack.size() * 2;
+        while (count > 0) {
+            size_t n = std::min(count, SPACES.size());
+            stream << AsciiStringView(SPACES.data(), n);
+            count -= n;
+        }
+    }
+
+    //! NOTE The same as String::toXmlEscaped, but written straight to the stream.
+    //! All the escaped characters are ascii, so utf-8 can be escaped byte by byte
+    void writeEscaped(const char* s, size_t len)
+    {
+        size_t start = 0;
+        for (size_t i = 0; i < len; ++i) {
+            const char* escaped = nullptr;
+            switch (s[i]) {
+            case '<': escaped = "&lt;";
+                break;
+            case '>': escaped = "&gt;";
+                break;
+            case '&': escaped = "&amp;";
+                break;
+            case '\"': escaped = "&quot;";
+                break;
+            default:
+                // ignore invalid characters in xml 1.0
+                if (static_cast<unsigned char>(s[i]) < 0x20 && s[i] != 0x09 && s[i] != 0x0A && s[i] != 0x0D) {
+                    escaped = "";
+                }
+                break;
+            }
+
+            if (escaped) {
+                stream << AsciiStringView(s + start, i - start) << escaped;
+                start = i + 1;
+            }
         }
+
+        stream << AsciiStringView(s + start, len - start);
+    }
+
+    void writeEscaped(const String& s)
+    {
+        utf8.clear();
+        UtfCodec::utf16to8(s.toStdU16StringView(), utf8);
+        writeEscaped(utf8.data(), utf8.size());
     }
 };
 
+static AsciiStringView elementName(const std::string& nameWithAttributes)
+{
+    return AsciiStringView(nameWithAttributes.data(), std::min(nameWithAttributes.find(' '), nameWithAttributes.size()));
+}
+
 XmlStreamWriter::XmlStreamWriter()
 {
     m_impl = new Impl();
@@ -114,11 +167,15 @@ void XmlStreamWriter::writeValue(const Value& v)
         break;
     case 7: m_impl->stream << std::get<double>(v);
         break;
-    case 8: m_impl->stream << escapeString(AsciiStringView(std::get<const char*>(v)));
-        break;
-    case 9: m_impl->stream << escapeString(std::get<AsciiStringView>(v));
-        break;
-    case 10: m_impl->stream << escapeString(std::get<String>(v));
+    case 8: {
+        const char* s = std::get<const char*>(v);
+        m_impl->writeEscaped(s, std::strlen(s));
+    } break;
+    case 9: {
+        const AsciiStringView& s = std::get<AsciiStringView>(v);
+        m_impl->writeEscaped(s.ascii(), s.size());
+    } break;
+    case 10: m_impl->writeEscaped(std::get<String>(v));
         break;
     default:
         LOGI() << "index: " << v.index();
@@ -151,16 +208,44 @@ void XmlStreamWriter::startElement(const String& name, const Attributes& attrs)
 
 void XmlStreamWriter::startElementRaw(const String& name)
 {
+    std::string nameWithAttributes = name.toStdString();
+    AsciiStringView ename = elementName(nameWithAttributes);
+
     m_impl->putLevel();
-    m_impl->stream << '<' << name << '>' << '\n';
-    m_impl->stack.push_back(name.split(' ')[0].toStdString());
+    m_impl->stream << '<' << nameWithAttributes << '>' << '\n';
+    m_impl->stack.emplace_back(ename.ascii(), ename.size());
 }
 
 void XmlStreamWriter::endElement()
 {
     m_impl->putLevel();
-    m_impl->stream << "</" << muse::takeLast(m_impl->stack) << '>' << '\n';
-    flush();
+    m_impl->stream << "</" << m_impl->stack.back() << '>' << '\n';
+    m_impl->stack.pop_back();
+
+    //! NOTE The document is complete, make it available on the device.
+    //! Otherwise the stream is written to the device when its buffer is full
+    if (m_impl->stack.empty()) {
+        flush();
+    }
+}
+
+size_t XmlStreamWriter::depth() const
+{
+    return m_impl->stack.size();
+}
+
+void XmlStreamWriter::startFragment(size_t depth)
+{
+    IF_ASSERT_FAILED(m_impl->stack.empty()) {
+        return;
+    }
+
+    m_impl->stack.resize(depth);
+}
+
+void XmlStreamWriter::writeFragment(const ByteArray& xml)
+{
+    m_impl->stream << xml;
 }
 
 // <element attr="value" />
@@ -213,10 +298,10 @@ void XmlStreamWriter::elementRaw(const String& nameWithAttributes, const Value&
     if (body.index() == 0) {
         m_impl->stream << '<' << nameWithAttributes << "/>\n";
     } else {
-        String ename(String(nameWithAttributes).split(' ')[0]);
-        m_impl->stream << '<' << nameWithAttributes << '>';
+        std::string s = nameWithAttributes.toStdString();
+        m_impl->stream << '<' << s << '>';
         writeValue(body);
-        m_impl->stream << "</" << ename << '>' << '\n';
+        m_impl->stream << "</" << elementName(s) << '>' << '\n';
     }
 }
 
@@ -226,10 +311,10 @@ void XmlStreamWriter::elementStringRaw(const String& nameWithAttributes, const S
     if (body.isEmpty()) {
         m_impl->stream << '<' << nameWithAttributes << "/>\n";
     } else {
-        String ename(String(nameWithAttributes).split(' ')[0]);
-        m_impl->stream << '<' << nameWithAttributes << '>';
+        std::string s = nameWithAttributes.toStdString();
+        m_impl->stream << '<' << s << '>';
         m_impl->stream << body;
-        m_impl->stream << "</" << ename << '>' << '\n';
+        m_impl->stream << "</" << elementName(s) << '>' << '\n';
     }
 }
 
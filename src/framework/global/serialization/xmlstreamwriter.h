@@ -22,9 +22,10 @@
 #ifndef MUSE_GLOBAL_XMLSTREAMWRITER_H
 #define MUSE_GLOBAL_XMLSTREAMWRITER_H
 
-#include <list>
 #include <variant>
+#include <vector>
 
+#include "types/bytearray.h"
 #include "types/string.h"
 #include "io/iodevice.h"
 
@@ -61,6 +62,13 @@ public:
 
     void comment(const String& text);
 
+    //! NOTE Parts of a document can be written separately (e.g. on other threads).
+    //! A fragment writer is indented as if it was at the given depth of the document,
+    //! and its output is inserted into the document with writeFragment
+    size_t depth() const;
+    void startFragment(size_t depth);
+    void writeFragment(const ByteArray& xml);
+
     static String escapeSymbol(char16_t c);
     static String escapeString(const AsciiStringView& s);
     static String escapeString(const String& s);
@@ -23,6 +23,7 @@
 
 #include "global/io/file.h"
 #include "global/io/dir.h"
+#include "global/io/mappedfile.h"
 #include "internal/zipcontainer.h"
 
 using namespace muse;
@@ -39,7 +40,7 @@ ZipReader::ZipReader(const io::path_t& filePath)
     : m_filePath(filePath)
 {
     m_impl = new Impl();
-    m_impl->device = new File(filePath);
+    m_impl->device = new MappedFile(filePath);
     m_impl->isSelfDevice = true;
     if (m_impl->device->open(IODevice::ReadOnly)) {
     }
@@ -90,6 +91,7 @@ std::vector<ZipReader::FileInfo> ZipReader::fileInfoList() const
         fi.isFile = qfi.isFile;
         fi.isSymLink = qfi.isSymLink;
         fi.size = qfi.size;
+        fi.crc = qfi.crc;
 
         ret.push_back(std::move(fi));
     }
@@ -40,6 +40,7 @@ public:
         bool isFile = false;
         bool isSymLink = false;
         uint64_t size = 0;
+        uint32_t crc = 0;
 
         bool isValid() const { return isDir || isFile || isSymLink; }
     };
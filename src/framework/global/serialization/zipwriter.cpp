@@ -89,8 +89,29 @@ bool ZipWriter::hasError() const
     return m_impl->zip->status() != ZipContainer::NoError;
 }
 
+std::shared_ptr<ZipCompressionCache> ZipWriter::makeCompressionCache()
+{
+    return std::make_shared<ZipCompressionCache>();
+}
+
+void ZipWriter::setCompressionCache(std::shared_ptr<ZipCompressionCache> cache)
+{
+    m_impl->zip->setCompressionCache(cache);
+}
+
+void ZipWriter::setCompressionEnabled(bool enabled)
+{
+    m_impl->zip->setCompressionPolicy(enabled ? ZipContainer::AlwaysCompress : ZipContainer::NeverCompress);
+}
+
 void ZipWriter::addFile(const std::string& fileName, const ByteArray& data)
 {
     m_impl->zip->addFile(fileName, data);
     flush();
 }
+
+void ZipWriter::addFiles(const std::vector<std::pair<std::string, ByteArray> >& files)
+{
+    m_impl->zip->addFiles(files);
+    flush();
+}
@@ -22,10 +22,17 @@
 #ifndef MUSE_GLOBAL_ZIPWRITER_H
 #define MUSE_GLOBAL_ZIPWRITER_H
 
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
 #include "io/path.h"
 #include "io/iodevice.h"
+#include "types/bytearray.h"
 
 namespace muse {
+struct ZipCompressionCache;
 class ZipWriter
 {
 public:
@@ -37,7 +44,18 @@ public:
     void close();
     bool hasError() const;
 
+    //! NOTE The files which did not change since the previous write with the same cache
+    //! are not compressed again
+    static std::shared_ptr<ZipCompressionCache> makeCompressionCache();
+    void setCompressionCache(std::shared_ptr<ZipCompressionCache> cache);
+
+    //! NOTE The files are stored without compression if disabled,
+    //! for when the writing speed matters more than the size (e.g. autosave)
+    void setCompressionEnabled(bool enabled);
+
     void addFile(const std::string& fileName, const ByteArray& data);
+    //! NOTE The files are compressed in parallel
+    void addFiles(const std::vector<std::pair<std::string, ByteArray> >& files);
 
 private:
 
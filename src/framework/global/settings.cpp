@@ -31,6 +31,8 @@
 #include "multiinstances/resourcelockguard.h"
 #endif
 
+#include "async/async.h"
+
 #include "log.h"
 
 using namespace muse;
@@ -60,6 +62,11 @@ Settings::Settings()
 
 Settings::~Settings()
 {
+    //! NOTE Normally flushed by the queued call on deinit, this is the last chance
+    for (const auto& pair : m_pendingWrites) {
+        m_settings->setValue(QString::fromStdString(pair.first.key), pair.second.toQVariant());
+    }
+
     delete m_settings;
 }
 
@@ -78,6 +85,8 @@ const Settings::Items& Settings::items() const
  */
 void Settings::reload()
 {
+    flushPendingWrites();
+
     Items items = readItems();
 
     for (auto it = items.cbegin(); it != items.cend(); ++it) {
@@ -87,11 +96,14 @@ void Settings::reload()
 
 void Settings::load()
 {
+    flushPendingWrites();
+
     m_items = readItems();
 }
 
 void Settings::reset(bool keepDefaultSettings, bool notifyAboutChanges)
 {
+    m_pendingWrites.clear();
     m_settings->clear();
 
     m_isTransactionStarted = false;
@@ -207,11 +219,38 @@ void Settings::setLocalValue(const Key& key, const Val& value)
 
 void Settings::writeValue(const Key& key, const Val& value)
 {
+    //! NOTE Values are held in memory already, so the writes of one burst
+    //! (e.g. dragging a splitter or a fader) are coalesced into one flush,
+    //! which takes the resource lock and notifies other instances only once
+    m_pendingWrites[key] = value;
+
+    if (m_flushScheduled) {
+        return;
+    }
+
+    m_flushScheduled = true;
+    async::Async::call(this, [this]() {
+        flushPendingWrites();
+    });
+}
+
+void Settings::flushPendingWrites()
+{
+    m_flushScheduled = false;
+
+    if (m_pendingWrites.empty()) {
+        return;
+    }
+
 #ifdef MUSE_MODULE_MULTIINSTANCES
     muse::mi::WriteResourceLockGuard resource_lock(multiInstancesProvider.get(), SETTINGS_RESOURCE_NAME);
 #endif
-    // TODO: implement writing/reading first part of key (module name)
-    m_settings->setValue(QString::fromStdString(key.key), value.toQVariant());
+    for (const auto& pair : m_pendingWrites) {
+        // TODO: implement writing/reading first part of key (module name)
+        m_settings->setValue(QString::fromStdString(pair.first.key), pair.second.toQVariant());
+    }
+
+    m_pendingWrites.clear();
 }
 
 QString Settings::dataPath() const
@@ -25,6 +25,7 @@
 #include <string>
 
 #include "types/val.h"
+#include "async/asyncable.h"
 #include "async/channel.h"
 #include "io/path.h"
 
@@ -42,7 +43,7 @@
 class QSettings;
 
 namespace muse {
-class Settings
+class Settings : public async::Asyncable
 {
 #ifdef MUSE_MODULE_MULTIINSTANCES
     GlobalInject<muse::mi::IMultiInstancesProvider> multiInstancesProvider;
@@ -123,6 +124,7 @@ private:
 
     Items readItems() const;
     void writeValue(const Key& key, const Val& value);
+    void flushPendingWrites();
 
     QString dataPath() const;
 
@@ -131,6 +133,9 @@ private:
     mutable Items m_localSettings;
     mutable bool m_isTransactionStarted = false;
     mutable std::map<Key, async::Channel<Val> > m_channels;
+
+    std::map<Key, Val> m_pendingWrites;
+    bool m_flushScheduled = false;
 };
 
 inline Settings* settings()
@@ -0,0 +1,207 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2026 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "startuptrace.h"
+
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "io/file.h"
+#include "serialization/json.h"
+#include "runtime.h"
+
+#include "log.h"
+
+using namespace muse;
+using namespace muse::profiler;
+
+namespace {
+struct Event {
+    std::string name;
+    std::string category;
+    char phase = 'X';
+    int64_t beginUs = 0;
+    int64_t durationUs = 0;
+    int threadIdx = 0;
+};
+
+struct TraceData {
+    std::mutex mutex;
+    bool started = false;
+    io::path_t outputPath;
+    std::vector<Event> events;
+    std::map<std::thread::id, int> threadIndexes;
+    std::vector<std::string> threadNames;
+};
+
+TraceData& traceData()
+{
+    static TraceData data;
+    return data;
+}
+
+//! NOTE Must be called with the mutex locked
+int threadIndex(TraceData& data)
+{
+    std::thread::id id = std::this_thread::get_id();
+    auto it = data.threadIndexes.find(id);
+    if (it != data.threadIndexes.end()) {
+        return it->second;
+    }
+
+    std::string name = runtime::threadName();
+    if (name.empty()) {
+        name = id == runtime::mainThreadId() ? "main" : "thread " + runtime::toString(id);
+    }
+
+    int idx = static_cast<int>(data.threadNames.size());
+    data.threadIndexes.emplace(id, idx);
+    data.threadNames.push_back(name);
+
+    return idx;
+}
+
+void appendEvent(Event&& event)
+{
+    TraceData& data = traceData();
+    std::lock_guard lock(data.mutex);
+    if (!data.started) {
+        return;
+    }
+
+    event.threadIdx = threadIndex(data);
+    data.events.push_back(std::move(event));
+}
+}
+
+void StartupTrace::start(const io::path_t& outputPath)
+{
+    TraceData& data = traceData();
+    std::lock_guard lock(data.mutex);
+
+    data.started = true;
+    data.outputPath = outputPath;
+    data.events.clear();
+    data.threadIndexes.clear();
+    data.threadNames.clear();
+}
+
+bool StartupTrace::isStarted()
+{
+    TraceData& data = traceData();
+    std::lock_guard lock(data.mutex);
+    return data.started;
+}
+
+void StartupTrace::addEvent(const std::string& name, const std::string& category, int64_t beginUs, int64_t durationUs)
+{
+    appendEvent(Event { name, category, 'X', beginUs, durationUs, 0 });
+}
+
+void StartupTrace::addInstantEvent(const std::string& name, const std::string& category)
+{
+    appendEvent(Event { name, category, 'i', nowUs(), 0, 0 });
+}
+
+Ret StartupTrace::finish()
+{
+    TraceData& data = traceData();
+    std::lock_guard lock(data.mutex);
+    if (!data.started) {
+        return make_ok();
+    }
+
+    data.started = false;
+
+    JsonArray events;
+
+    for (size_t i = 0; i < data.threadNames.size(); ++i) {
+        JsonObject args;
+        args.set("name", data.threadNames.at(i));
+
+        JsonObject obj;
+        obj.set("name", "thread_name");
+        obj.set("ph", "M");
+        obj.set("pid", 1);
+        obj.set("tid", static_cast<int>(i));
+        obj.set("args", args);
+        events << obj;
+    }
+
+    for (const Event& event : data.events) {
+        JsonObject obj;
+        obj.set("name", event.name);
+        obj.set("cat", event.category);
+        obj.set("ph", std::string(1, event.phase));
+        obj.set("ts", static_cast<double>(event.beginUs));
+        if (event.phase == 'X') {
+            obj.set("dur", static_cast<double>(event.durationUs));
+        } else {
+            obj.set("s", "g");
+        }
+        obj.set("pid", 1);
+        obj.set("tid", event.threadIdx);
+        events << obj;
+    }
+
+    JsonObject root;
+    root.set("traceEvents", events);
+    root.set("displayTimeUnit", "ms");
+
+    Ret ret = io::File::writeFile(data.outputPath, JsonDocument(root).toJson(JsonDocument::Format::Compact));
+    if (!ret) {
+        LOGE() << "failed write startup trace to " << data.outputPath << ", err: " << ret.toString();
+        return ret;
+    }
+
+    LOGI() << "startup trace written to " << data.outputPath;
+
+    return ret;
+}
+
+int64_t StartupTrace::nowUs()
+{
+    using namespace std::chrono;
+    return duration_cast<microseconds>(steady_clock::now().time_since_epoch()).count();
+}
+
+StartupTrace::Scope::Scope(const std::string& name, const std::string& category)
+{
+    if (!StartupTrace::isStarted()) {
+        return;
+    }
+
+    m_name = name;
+    m_category = category;
+    m_beginUs = StartupTrace::nowUs();
+}
+
+StartupTrace::Scope::~Scope()
+{
+    if (m_beginUs < 0) {
+        return;
+    }
+
+    StartupTrace::addEvent(m_name, m_category, m_beginUs, StartupTrace::nowUs() - m_beginUs);
+}
@@ -0,0 +1,72 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2026 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef MUSE_GLOBAL_STARTUPTRACE_H
+#define MUSE_GLOBAL_STARTUPTRACE_H
+
+#include <cstdint>
+#include <string>
+
+#include "io/path.h"
+#include "types/ret.h"
+
+namespace muse::profiler {
+/*!
+ * muse::profiler::StartupTrace
+ * Records named phases and writes them in the Chrome trace event format,
+ * so they can be viewed in chrome://tracing or Perfetto.
+ * Unlike TRACEFUNC, it does not depend on the profiler being compiled in,
+ * and does nothing until it is started.
+ * usage:
+ *      StartupTrace::start("startup.json");
+ *      {
+ *          StartupTrace::Scope scope("onInit", "notation");
+ *          ...
+ *      }
+ *      StartupTrace::finish();
+ */
+class StartupTrace
+{
+public:
+    static void start(const io::path_t& outputPath);
+    static bool isStarted();
+
+    static void addEvent(const std::string& name, const std::string& category, int64_t beginUs, int64_t durationUs);
+    static void addInstantEvent(const std::string& name, const std::string& category);
+
+    //! NOTE Writes the collected events and stops recording
+    static Ret finish();
+
+    static int64_t nowUs();
+
+    struct Scope {
+        Scope(const std::string& name, const std::string& category);
+        ~Scope();
+
+    private:
+        std::string m_name;
+        std::string m_category;
+        int64_t m_beginUs = -1;
+    };
+};
+}
+
+#endif // MUSE_GLOBAL_STARTUPTRACE_H
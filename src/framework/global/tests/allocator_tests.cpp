@@ -23,6 +23,7 @@
 
 #include <cstdint>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include "allocator.h"
@@ -166,7 +167,7 @@ TEST_F(Global_AllocatorTests, Single_BigNewDelete)
 TEST_F(Global_AllocatorTests, Many_NewCleanup)
 {
     //! GIVEN the default size of the allocator block is less than the size of all items
-    size_t itemSize = sizeof(Item8);
+    size_t itemSize = sizeof(Item8) + sizeof(void*); // item + chunk header
     ObjectAllocator::DEFAULT_BLOCK_SIZE = itemSize * 4;  // bytes
 
     //! DO Create Items (more then one block size)
@@ -200,3 +201,67 @@ TEST_F(Global_AllocatorTests, Many_NewCleanup)
     EXPECT_EQ(info.totalChunks, 12); // DEFAULT_BLOCK_SIZE * 3
     EXPECT_EQ(info.freeChunks, 12);
 }
+
+TEST_F(Global_AllocatorTests, Arena_NewDelete)
+{
+    ObjectAllocator::Info poolInfo = Item13::allocator().stateInfo();
+
+    ObjectArena arena;
+    std::vector<ItemBase*> items;
+
+    //! DO Create Items of different types while the arena is current
+    {
+        ObjectArena::Scope scope(&arena);
+        for (size_t i = 0; i < 10; ++i) {
+            items.push_back(new Item13(static_cast<uint8_t>(i)));
+            items.push_back(new Item131(static_cast<uint8_t>(i)));
+        }
+    }
+
+    //! CHECK Items are allocated from the arena, not from the pool
+    for (ItemBase* item : items) {
+        EXPECT_TRUE(item->alive());
+    }
+
+    EXPECT_EQ(arena.liveObjects(), 20);
+    EXPECT_GT(arena.allocatedBytes(), 0);
+    EXPECT_EQ(Item13::allocator().stateInfo().totalChunks, poolInfo.totalChunks);
+
+    //! DO Destroy Items (outside of the arena scope)
+    for (ItemBase* item : items) {
+        delete item;
+    }
+
+    //! CHECK
+    EXPECT_EQ(arena.liveObjects(), 0);
+}
+
+TEST_F(Global_AllocatorTests, Arena_Threads)
+{
+    //! GIVEN two arenas used on two threads at the same time
+    ObjectArena arena1;
+    ObjectArena arena2;
+
+    auto func = [](ObjectArena* arena) {
+        ObjectArena::Scope scope(arena);
+        std::vector<ItemBase*> items;
+        for (size_t i = 0; i < 100; ++i) {
+            items.push_back(new Item8(static_cast<uint8_t>(i)));
+        }
+
+        for (ItemBase* item : items) {
+            delete item;
+        }
+    };
+
+    std::thread t1(func, &arena1);
+    std::thread t2(func, &arena2);
+    t1.join();
+    t2.join();
+
+    //! CHECK
+    EXPECT_EQ(arena1.liveObjects(), 0);
+    EXPECT_EQ(arena2.liveObjects(), 0);
+    EXPECT_EQ(arena1.allocatedBytes(), arena2.allocatedBytes());
+    EXPECT_EQ(ObjectArena::current(), nullptr);
+}
@@ -199,3 +199,28 @@ TEST_F(Global_Types_ByteArrayTests, Modification)
     EXPECT_EQ(ba10.size(), 0);
     EXPECT_TRUE(ba10.empty());
 }
+
+TEST_F(Global_Types_ByteArrayTests, RawDataDetach)
+{
+    const char* raw = "hello";
+
+    //! DO make two copies of a raw data wrapper and change both
+    ByteArray ba1 = ByteArray::fromRawData(raw, 5);
+    ByteArray ba2 = ba1;
+    ba1.data()[0] = 'j';
+    ba2.data()[0] = 'm';
+
+    //! CHECK (each copy has its own data, the raw data is not touched)
+    EXPECT_EQ(std::strcmp(ba1.constChar(), "jello"), 0);
+    EXPECT_EQ(std::strcmp(ba2.constChar(), "mello"), 0);
+    EXPECT_EQ(std::strcmp(raw, "hello"), 0);
+
+    //! DO change an empty array
+    ByteArray ba3;
+    ba3.push_back('x');
+
+    //! CHECK (other empty arrays stay empty)
+    EXPECT_EQ(ba3.size(), 1);
+    EXPECT_TRUE(ByteArray().empty());
+    EXPECT_EQ(std::strcmp(ByteArray().constChar(), ""), 0);
+}
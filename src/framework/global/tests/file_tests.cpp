@@ -27,6 +27,7 @@
 #include <string>
 
 #include "io/file.h"
+#include "io/mappedfile.h"
 #include "io/path.h"
 #include "types/bytearray.h"
 
@@ -212,3 +213,36 @@ TEST_F(Global_IO_FileTests, FileTests_Exists_Append)
         EXPECT_EQ(refba, data);
     }
 }
+
+TEST_F(Global_IO_FileTests, FileTests_Mapped)
+{
+    path_t filePath("FileTests_Mapped.txt");
+    std::string ref = "Hello Mapped World!";
+    {
+        //! GIVEN Some file
+        File f(filePath);
+        EXPECT_TRUE(f.open(IODevice::WriteOnly));
+        f.write(ByteArray(reinterpret_cast<const uint8_t*>(ref.c_str()), ref.size()));
+    }
+
+    {
+        //! GIVEN The mapped file
+        MappedFile f(filePath);
+
+        //! CHECK It can not be written
+        EXPECT_FALSE(f.open(IODevice::WriteOnly));
+
+        //! DO Open file
+        EXPECT_TRUE(f.open(IODevice::ReadOnly));
+
+        //! CHECK The data is the same as written
+        EXPECT_EQ(f.size(), ref.size());
+        EXPECT_EQ(std::memcmp(f.readData(), ref.c_str(), ref.size()), 0);
+
+        EXPECT_TRUE(f.seek(6));
+        EXPECT_EQ(f.read(6), ByteArray("Mapped"));
+        EXPECT_EQ(f.readAll(), ByteArray(" World!"));
+    }
+
+    File::remove(filePath);
+}
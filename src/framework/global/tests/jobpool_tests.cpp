@@ -0,0 +1,71 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2024 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <vector>
+
+#include "concurrency/jobpool.h"
+
+using namespace muse;
+
+class Global_Concurrency_JobPoolTests : public ::testing::Test
+{
+};
+
+TEST_F(Global_Concurrency_JobPoolTests, EveryJobRunsOnce)
+{
+    //! GIVE A pool and many batches of jobs
+    JobPool pool(4);
+
+    constexpr size_t JOB_COUNT = 64;
+    constexpr size_t BATCH_COUNT = 1000;
+
+    std::vector<std::atomic<int> > calls(JOB_COUNT);
+
+    //! DO
+    for (size_t batch = 0; batch < BATCH_COUNT; ++batch) {
+        pool.run(JOB_COUNT, [&calls](size_t idx) {
+            calls[idx].fetch_add(1);
+        });
+
+        //! CHECK All jobs of the batch are done, when run returns
+        for (size_t i = 0; i < JOB_COUNT; ++i) {
+            ASSERT_EQ(calls[i].load(), static_cast<int>(batch + 1));
+        }
+    }
+}
+
+TEST_F(Global_Concurrency_JobPoolTests, EmptyBatch)
+{
+    //! GIVE
+    JobPool pool(2);
+    bool called = false;
+
+    //! DO
+    pool.run(0, [&called](size_t) {
+        called = true;
+    });
+
+    //! CHECK
+    EXPECT_FALSE(called);
+}
@@ -117,3 +117,28 @@ TEST_F(Global_Ser_Json, WriteRead)
         EXPECT_EQ(keys.at(1), "key2");
     }
 }
+
+TEST_F(Global_Ser_Json, NestedValuesAreDetachedOnWrite)
+{
+    JsonObject root;
+    root["o"] = JsonObject().set("key", "value");
+    root["a"] = JsonArray({ 1, 2 });
+
+    // Read nested values
+    JsonObject obj = root.value("o").toObject();
+    JsonArray ar = root.value("a").toArray();
+
+    // Change them, the root must stay unchanged
+    obj.set("key", "changed");
+    ar.append(3);
+
+    EXPECT_EQ(root.value("o").toObject().value("key").toString(), u"value");
+    EXPECT_EQ(root.value("a").toArray().size(), 2);
+    EXPECT_EQ(obj.value("key").toString(), u"changed");
+    EXPECT_EQ(ar.size(), 3);
+
+    // Change the root, the values read before must stay unchanged
+    root["o"] = JsonObject().set("key", "new");
+
+    EXPECT_EQ(obj.value("key").toString(), u"changed");
+}
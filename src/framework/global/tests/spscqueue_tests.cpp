@@ -0,0 +1,88 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2024 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include <thread>
+
+#include "concurrency/spscqueue.h"
+
+using namespace muse;
+
+class Global_Concurrency_SpscQueueTests : public ::testing::Test
+{
+};
+
+TEST_F(Global_Concurrency_SpscQueueTests, PushUntilFull)
+{
+    //! GIVE An empty queue
+    SpscQueue<int, 4> queue;
+
+    //! DO Push more values than it can hold
+    for (int i = 0; i < 4; ++i) {
+        EXPECT_TRUE(queue.tryPush(i));
+    }
+
+    //! CHECK The extra value is rejected
+    EXPECT_FALSE(queue.tryPush(4));
+
+    //! CHECK The values come out in order, then the queue is empty
+    int value = -1;
+    for (int i = 0; i < 4; ++i) {
+        EXPECT_TRUE(queue.tryPop(value));
+        EXPECT_EQ(value, i);
+    }
+
+    EXPECT_FALSE(queue.tryPop(value));
+}
+
+TEST_F(Global_Concurrency_SpscQueueTests, ProducerAndConsumerThreads)
+{
+    //! GIVE A small queue, so that the producer often finds it full
+    SpscQueue<size_t, 8> queue;
+    constexpr size_t VALUE_COUNT = 100000;
+
+    //! DO
+    std::thread producer([&queue]() {
+        for (size_t i = 0; i < VALUE_COUNT;) {
+            if (queue.tryPush(i)) {
+                ++i;
+            } else {
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    //! CHECK Every value arrives once and in order
+    size_t expected = 0;
+    while (expected < VALUE_COUNT) {
+        size_t value = 0;
+        if (queue.tryPop(value)) {
+            ASSERT_EQ(value, expected);
+            ++expected;
+        } else {
+            std::this_thread::yield();
+        }
+    }
+
+    producer.join();
+}
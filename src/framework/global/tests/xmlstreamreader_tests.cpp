@@ -0,0 +1,227 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2024 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <gtest/gtest.h>
+
+#include <string>
+
+#include "io/buffer.h"
+#include "serialization/xmlstreamreader.h"
+#include "types/bytearray.h"
+
+using namespace muse;
+using namespace muse::io;
+
+class Global_Ser_XmlStreamReader : public ::testing::Test
+{
+public:
+};
+
+static ByteArray toByteArray(const std::string& str)
+{
+    return ByteArray(str.c_str(), str.size());
+}
+
+TEST_F(Global_Ser_XmlStreamReader, Tokens)
+{
+    //! GIVEN A document with all the kinds of tokens
+    ByteArray data = toByteArray("<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+                                 "<museScore version=\"4.20\">\n"
+                                 "  <!-- comment -->\n"
+                                 "  <Chord><Note/><pitch>60</pitch></Chord>\n"
+                                 "</museScore>\n");
+
+    XmlStreamReader xml(data);
+
+    //! CHECK The tokens are read in the document order
+    EXPECT_EQ(xml.readNext(), XmlStreamReader::StartDocument);
+    EXPECT_TRUE(xml.readNextStartElement());
+    EXPECT_EQ(xml.name(), "museScore");
+    EXPECT_EQ(xml.asciiAttribute("version"), "4.20");
+    EXPECT_EQ(xml.readNext(), XmlStreamReader::Comment);
+    EXPECT_EQ(xml.asciiText(), " comment ");
+    EXPECT_TRUE(xml.readNextStartElement());
+    EXPECT_EQ(xml.name(), "Chord");
+
+    //! CHECK An empty element is followed by its end element
+    EXPECT_TRUE(xml.readNextStartElement());
+    EXPECT_EQ(xml.name(), "Note");
+    EXPECT_EQ(xml.readNext(), XmlStreamReader::EndElement);
+    EXPECT_EQ(xml.name(), "Note");
+
+    EXPECT_TRUE(xml.readNextStartElement());
+    EXPECT_EQ(xml.name(), "pitch");
+    EXPECT_EQ(xml.readInt(), 60);
+    EXPECT_EQ(xml.name(), "pitch");
+
+    EXPECT_FALSE(xml.readNextStartElement());
+    EXPECT_EQ(xml.name(), "Chord");
+    EXPECT_FALSE(xml.readNextStartElement());
+    EXPECT_EQ(xml.name(), "museScore");
+    EXPECT_EQ(xml.readNext(), XmlStreamReader::EndDocument);
+    EXPECT_EQ(xml.readNext(), XmlStreamReader::Invalid);
+    EXPECT_FALSE(xml.isError());
+}
+
+TEST_F(Global_Ser_XmlStreamReader, Entities)
+{
+    //! GIVEN A document with entities and line ends to normalize
+    ByteArray data = toByteArray("<!ENTITY custom \"value\">\r\n"
+                                 "<a x='&lt;&amp;&gt;' y=\"&#65;&#x263A;\">line\r\nnext &quot;&custom;&quot;"
+                                 "<![CDATA[<raw> &amp;]]></a>");
+
+    XmlStreamReader xml(data);
+
+    //! CHECK The entities are replaced
+    EXPECT_TRUE(xml.readNextStartElement());
+    EXPECT_EQ(xml.asciiAttribute("x"), "<&>");
+    EXPECT_EQ(xml.attribute("y"), String(u"A☺"));
+    EXPECT_FALSE(xml.hasAttribute("z"));
+    EXPECT_EQ(xml.intAttribute("z", 5), 5);
+
+    EXPECT_EQ(xml.readNext(), XmlStreamReader::Characters);
+    EXPECT_EQ(xml.asciiText(), "line\nnext \"&custom;\"");
+    EXPECT_EQ(xml.text(), String(u"line\nnext \"value\""));
+
+    EXPECT_EQ(xml.readNext(), XmlStreamReader::Characters);
+    EXPECT_EQ(xml.asciiText(), "<raw> &amp;");
+    EXPECT_EQ(xml.readNext(), XmlStreamReader::EndElement);
+}
+
+TEST_F(Global_Ser_XmlStreamReader, NotWellFormed)
+{
+    //! GIVEN A document with a mismatched end element
+    XmlStreamReader mismatched(toByteArray("<a><b></a>"));
+
+    //! CHECK The tokens before the error are read, then the reader fails
+    EXPECT_TRUE(mismatched.readNextStartElement());
+    EXPECT_TRUE(mismatched.readNextStartElement());
+    EXPECT_EQ(mismatched.readNext(), XmlStreamReader::Invalid);
+    EXPECT_EQ(mismatched.error(), XmlStreamReader::NotWellFormedError);
+
+    //! GIVEN A truncated document
+    XmlStreamReader truncated(toByteArray("<a><b>text</b>"));
+
+    //! CHECK The reader fails at the end of the data
+    EXPECT_TRUE(truncated.readNextStartElement());
+    EXPECT_TRUE(truncated.readNextStartElement());
+    EXPECT_EQ(truncated.readAsciiText(), "text");
+    EXPECT_EQ(truncated.readNext(), XmlStreamReader::Invalid);
+    EXPECT_EQ(truncated.error(), XmlStreamReader::PrematureEndOfDocumentError);
+}
+
+TEST_F(Global_Ser_XmlStreamReader, ReadDeviceByChunks)
+{
+    //! GIVEN A document, which is much larger than a read chunk and contains a token longer than a chunk
+    std::string doc = "<score>";
+    for (int i = 0; i < 20000; ++i) {
+        doc += "<note id=\"" + std::to_string(i) + "\"><pitch>" + std::to_string(i % 128) + "</pitch></note>";
+    }
+    const std::string longText(200 * 1024, 'x');
+    doc += "<text>" + longText + "</text></score>";
+
+    ByteArray data = toByteArray(doc);
+    Buffer buf(&data);
+    buf.open(IODevice::ReadOnly);
+
+    XmlStreamReader xml(&buf);
+
+    //! CHECK All the tokens are read across the chunk boundaries
+    EXPECT_TRUE(xml.readNextStartElement());
+    EXPECT_EQ(xml.name(), "score");
+
+    int notes = 0;
+    while (xml.readNextStartElement()) {
+        const AsciiStringView tag(xml.name());
+
+        if (tag == "note") {
+            EXPECT_EQ(xml.intAttribute("id"), notes);
+            EXPECT_TRUE(xml.readNextStartElement());
+            EXPECT_EQ(xml.readInt(), notes % 128);
+            xml.skipCurrentElement();
+
+            //! CHECK The name stays valid while the children are read
+            EXPECT_EQ(tag, "note");
+            ++notes;
+        } else if (tag == "text") {
+            EXPECT_EQ(xml.readAsciiText(), AsciiStringView(longText.c_str(), longText.size()));
+        } else {
+            xml.skipCurrentElement();
+        }
+    }
+
+    EXPECT_EQ(notes, 20000);
+    EXPECT_EQ(xml.readNext(), XmlStreamReader::EndDocument);
+    EXPECT_FALSE(xml.isError());
+}
+
+TEST_F(Global_Ser_XmlStreamReader, Snapshot)
+{
+    //! GIVEN A document and its snapshot
+    ByteArray data = toByteArray("<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+                                 "<!ENTITY custom \"value\">\n"
+                                 "<museScore version=\"4.20\">\n"
+                                 "  <!-- comment -->\n"
+                                 "  <Chord><Note pitch=\"60\" tpc='14'/><text>&lt;&custom;&gt;</text></Chord>\n"
+                                 "  <Chord><Note pitch=\"62\"/><![CDATA[<raw>]]></Chord>\n"
+                                 "</museScore>\n");
+
+    ByteArray snapshot = XmlStreamReader::makeSnapshot(data);
+    EXPECT_FALSE(snapshot.empty());
+
+    XmlStreamReader xml(data);
+    XmlStreamReader snap;
+    EXPECT_TRUE(snap.setSnapshot(snapshot));
+
+    //! CHECK The snapshot gives the same tokens as the document
+    while (true) {
+        XmlStreamReader::TokenType type = xml.readNext();
+        EXPECT_EQ(snap.readNext(), type);
+        EXPECT_EQ(snap.name(), xml.name());
+        EXPECT_EQ(snap.asciiText(), xml.asciiText());
+        EXPECT_EQ(snap.text(), xml.text());
+        EXPECT_EQ(snap.lineNumber(), xml.lineNumber());
+
+        std::vector<XmlStreamReader::Attribute> attrs = xml.attributes();
+        std::vector<XmlStreamReader::Attribute> snapAttrs = snap.attributes();
+        EXPECT_EQ(snapAttrs.size(), attrs.size());
+        for (size_t i = 0; i < std::min(attrs.size(), snapAttrs.size()); ++i) {
+            EXPECT_EQ(snapAttrs.at(i).name, attrs.at(i).name);
+            EXPECT_EQ(snapAttrs.at(i).value, attrs.at(i).value);
+        }
+
+        if (type == XmlStreamReader::EndDocument || type == XmlStreamReader::Invalid) {
+            break;
+        }
+    }
+    EXPECT_FALSE(snap.isError());
+
+    //! CHECK A document, which is not well formed, has no snapshot
+    EXPECT_TRUE(XmlStreamReader::makeSnapshot(toByteArray("<a><b></a>")).empty());
+
+    //! CHECK A broken snapshot is refused or fails while reading
+    XmlStreamReader broken;
+    EXPECT_FALSE(broken.setSnapshot(data));
+    EXPECT_TRUE(broken.isError());
+
+    ByteArray truncated = snapshot.left(snapshot.size() - 1);
+    EXPECT_FALSE(broken.setSnapshot(truncated));
+}
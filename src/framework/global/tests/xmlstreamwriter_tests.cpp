@@ -0,0 +1,135 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2024 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <gtest/gtest.h>
+
+#include <string>
+
+#include "io/buffer.h"
+#include "serialization/xmlstreamwriter.h"
+#include "types/bytearray.h"
+
+using namespace muse;
+using namespace muse::io;
+
+class Global_Ser_XmlStreamWriter : public ::testing::Test
+{
+public:
+};
+
+static std::string toString(const ByteArray& data)
+{
+    return std::string(data.constChar(), data.size());
+}
+
+TEST_F(Global_Ser_XmlStreamWriter, Document)
+{
+    //! GIVEN A writer to a buffer
+    ByteArray data;
+    Buffer buf(&data);
+    buf.open(IODevice::WriteOnly);
+
+    XmlStreamWriter xml(&buf);
+
+    //! DO Write a document with nested elements, attributes and values
+    xml.startDocument();
+    xml.startElement("museScore", { { "version", "4.20" } });
+    xml.comment(u"comment");
+    xml.startElement("Chord");
+    xml.element("Note", { { "x", 1.5 }, { "y", -2 } });
+    xml.element("pitch", 60);
+    xml.element("velocity", 1234567890123LL);
+    xml.element("offset", 0.1);
+    xml.element("text", String(u"a < b & \"c\" > d é"));
+    xml.element("ascii", "x<y");
+    xml.endElement();
+    xml.endElement();
+
+    //! CHECK The document is available on the device once the root element is closed
+    EXPECT_EQ(toString(data),
+              "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+              "<museScore version=\"4.20\">\n"
+              "  <!-- comment -->\n"
+              "  <Chord>\n"
+              "    <Note x=\"1.5\" y=\"-2\"/>\n"
+              "    <pitch>60</pitch>\n"
+              "    <velocity>1234567890123</velocity>\n"
+              "    <offset>0.1</offset>\n"
+              "    <text>a &lt; b &amp; &quot;c&quot; &gt; d \xc3\xa9</text>\n"
+              "    <ascii>x&lt;y</ascii>\n"
+              "    </Chord>\n"
+              "  </museScore>\n");
+}
+
+TEST_F(Global_Ser_XmlStreamWriter, InvalidCharacters)
+{
+    //! GIVEN A writer to a buffer
+    ByteArray data;
+    Buffer buf(&data);
+    buf.open(IODevice::WriteOnly);
+
+    XmlStreamWriter xml(&buf);
+
+    //! DO Write text with characters not allowed in xml 1.0
+    xml.element("text", String(u"a\u0001b\tc"));
+    xml.flush();
+
+    //! CHECK They are dropped
+    EXPECT_EQ(toString(data), "<text>ab\tc</text>\n");
+}
+
+TEST_F(Global_Ser_XmlStreamWriter, Fragment)
+{
+    //! GIVEN A fragment written separately at the depth of the document it belongs to
+    ByteArray fragmentData;
+    Buffer fragmentBuf(&fragmentData);
+    fragmentBuf.open(IODevice::WriteOnly);
+
+    XmlStreamWriter fragment(&fragmentBuf);
+    fragment.startFragment(2);
+    fragment.startElement("Staff", { { "id", 1 } });
+    fragment.element("Measure");
+    fragment.endElement();
+    fragment.flush();
+
+    //! DO Insert it into the document
+    ByteArray data;
+    Buffer buf(&data);
+    buf.open(IODevice::WriteOnly);
+
+    XmlStreamWriter xml(&buf);
+    xml.startElement("museScore");
+    xml.startElement("Score");
+    EXPECT_EQ(xml.depth(), 2u);
+    xml.writeFragment(fragmentData);
+    xml.endElement();
+    xml.endElement();
+
+    //! CHECK The document is the same as if the fragment was written by the document writer
+    EXPECT_EQ(toString(data),
+              "<museScore>\n"
+              "  <Score>\n"
+              "    <Staff id=\"1\">\n"
+              "      <Measure/>\n"
+              "      </Staff>\n"
+              "    </Score>\n"
+              "  </museScore>\n");
+}
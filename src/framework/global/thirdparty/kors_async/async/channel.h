@@ -49,8 +49,15 @@ public:
 
     void send(const T&... d)
     {
+        //! NOTE Nothing to allocate and pack if nobody listens
+        if (!isConnected()) {
+            return;
+        }
+
         NotifyData nd;
-        nd.setArg<T...>(0, d ...);
+        if constexpr (sizeof...(T) > 0) {
+            nd.setArg<T...>(0, d ...);
+        }
         ptr()->invoke(Receive, nd);
     }
 
@@ -78,7 +85,7 @@ public:
 
     bool isConnected() const
     {
-        return m_ptr && ptr()->isConnected();
+        return m_ptr && m_ptr->isConnected();
     }
 
 private:
@@ -99,7 +106,14 @@ private:
         Call f;
         ReceiveCall(Call _f)
             : f(_f) {}
-        void received(const NotifyData& d) { std::apply(f, d.args<Arg...>()); }
+        void received(const NotifyData& d)
+        {
+            if constexpr (sizeof...(Arg) > 0) {
+                std::apply(f, d.args<Arg...>());
+            } else {
+                f();
+            }
+        }
     };
 
     struct IClose {
@@ -52,7 +52,7 @@ void AbstractInvoker::invoke(int type)
 void AbstractInvoker::invoke(int type, const NotifyData& data)
 {
     auto it = m_callbacks.find(type);
-    if (it == m_callbacks.end()) {
+    if (it == m_callbacks.end() || it->second.empty()) {
         return;
     }
 
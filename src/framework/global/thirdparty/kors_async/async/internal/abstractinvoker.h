@@ -44,8 +44,7 @@ public:
     template<typename ... T>
     void setArg(int i, const T&... val)
     {
-        IArg* p = new Arg<T...>(val ...);
-        m_args.insert(m_args.begin() + i, std::shared_ptr<IArg>(p));
+        m_args.insert(m_args.begin() + i, std::make_shared<Arg<T...> >(val ...));
     }
 
     template<typename T>
@@ -59,12 +58,15 @@ public:
         return std::get<0>(d->val);
     }
 
+    //! NOTE: Returns a reference to the stored arguments, so that receivers taking them by const reference
+    //! don't get a copy of them each (the payload may be big, e.g. playback events of a whole track)
     template<typename ... T>
-    std::tuple<T...> args(int i = 0) const
+    const std::tuple<T...>& args(int i = 0) const
     {
         IArg* p = m_args.at(i).get();
         if (!p) {
-            return {};
+            static const std::tuple<T...> empty;
+            return empty;
         }
         Arg<T...>* d = reinterpret_cast<Arg<T...>*>(p);
         return d->val;
@@ -75,7 +75,8 @@ std::string FileLogDest::name() const
 
 void FileLogDest::write(const LogMsg& logMsg)
 {
-    m_file << m_layout.output(logMsg) << std::endl;
+    //! NOTE Flush once per message, so the log survives a crash
+    m_file << m_layout.output(logMsg) << '\n';
     m_file.flush();
 }
 
@@ -23,12 +23,12 @@ SOFTWARE.
 */
 #include "ioc.h"
 
-#include <map>
+#include <unordered_map>
 #include <utility>
 
 std::mutex kors::modularity::StaticMutex::mutex;
 
-static std::map<kors::modularity::IoCID, kors::modularity::ModulesIoC*> s_map;
+static std::unordered_map<kors::modularity::IoCID, kors::modularity::ModulesIoC*> s_map;
 
 kors::modularity::ModulesIoC* kors::modularity::_ioc(const ContextPtr& ctx)
 {
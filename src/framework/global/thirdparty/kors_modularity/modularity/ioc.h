@@ -24,6 +24,7 @@ SOFTWARE.
 #ifndef KORS_MODULARITY_IOC_H
 #define KORS_MODULARITY_IOC_H
 
+#include <atomic>
 #include <memory>
 #include <mutex>
 #include <string_view>
@@ -57,6 +58,15 @@ public:
     Inject(const Injectable* o)
         : m_inj(o) {}
 
+    Inject(const Inject& other)
+        : m_ctx(other.m_ctx), m_inj(other.m_inj)
+    {
+        if (other.m_resolved.load(std::memory_order_acquire)) {
+            m_i = other.m_i;
+            m_resolved.store(true, std::memory_order_relaxed);
+        }
+    }
+
     const ContextPtr& iocContext() const
     {
         if (m_ctx) {
@@ -74,11 +84,14 @@ public:
 
     const std::shared_ptr<I>& get() const
     {
-        if (!m_i) {
+        //! NOTE Once resolved, the pointer is published through m_resolved,
+        //! so later calls neither take the mutex nor race with the writer
+        if (!m_resolved.load(std::memory_order_acquire)) {
             const std::lock_guard<std::mutex> lock(StaticMutex::mutex);
-            if (!m_i) {
+            if (!m_resolved.load(std::memory_order_relaxed)) {
                 static std::string_view module = "";
                 m_i = _ioc(iocContext())->template resolve<I>(module);
+                m_resolved.store(m_i != nullptr, std::memory_order_release);
             }
         }
         return m_i;
@@ -86,7 +99,9 @@ public:
 
     void set(std::shared_ptr<I> impl)
     {
+        const std::lock_guard<std::mutex> lock(StaticMutex::mutex);
         m_i = impl;
+        m_resolved.store(m_i != nullptr, std::memory_order_release);
     }
 
     const std::shared_ptr<I>& operator()() const
@@ -99,6 +114,7 @@ private:
     const ContextPtr m_ctx;
     const Injectable* m_inj = nullptr;
     mutable std::shared_ptr<I> m_i = nullptr;
+    mutable std::atomic<bool> m_resolved { false };
 };
 
 template<class I>
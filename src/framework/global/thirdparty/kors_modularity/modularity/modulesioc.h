@@ -25,8 +25,8 @@ SOFTWARE.
 #define KORS_MODULARITY_MODULESIOC_H
 
 #include <memory>
-#include <map>
 #include <string>
+#include <unordered_map>
 #include <cassert>
 #include <iostream>
 
@@ -238,7 +238,7 @@ private:
         std::shared_ptr<IModuleInterface> p;
     };
 
-    std::map<std::string_view, Service > m_map;
+    std::unordered_map<std::string_view, Service> m_map;
 };
 
 template<class T>
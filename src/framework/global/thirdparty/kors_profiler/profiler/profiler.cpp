@@ -237,6 +237,7 @@ void Profiler::clear()
         }
         m_funcs.threads[MAIN_THREAD_INDEX] = std::this_thread::get_id();
         m_funcs.lastIndex.store(1);
+        ++m_funcs.generation;
     }
     {
         std::lock_guard<std::mutex> lock(m_steps.mutex);
@@ -376,6 +377,27 @@ void Profiler::StepTimer::nextStep()
 }
 
 int Profiler::FuncsData::threadIndex(std::thread::id th)
+{
+    //! NOTE Called for every measured function, so remember the index per thread
+    //! instead of scanning all registered threads each time
+    thread_local size_t cachedGeneration = static_cast<size_t>(-1);
+    thread_local int cachedIndex = -1;
+
+    const size_t gen = generation.load();
+    if (cachedIndex != -1 && cachedGeneration == gen) {
+        return cachedIndex;
+    }
+
+    int idx = findOrAddThread(th);
+    if (idx != -1) {
+        cachedGeneration = gen;
+        cachedIndex = idx;
+    }
+
+    return idx;
+}
+
+int Profiler::FuncsData::findOrAddThread(std::thread::id th)
 {
     size_t _last = lastIndex.load();
     if (_last >= threads.size()) {
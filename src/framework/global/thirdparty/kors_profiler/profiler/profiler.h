@@ -260,11 +260,13 @@ private:
     struct FuncsData {
         std::mutex mutex;
         std::atomic<size_t> lastIndex = 0;
+        std::atomic<size_t> generation = 0; // incremented on clear
         std::vector<std::thread::id> threads;
         std::vector<FuncTimers> timers;
         std::set<std::string> staticInfo;
 
         int threadIndex(std::thread::id th);
+        int findOrAddThread(std::thread::id th);
     };
 
     typedef std::unordered_map<std::string, ElapsedTimer* > Timers;
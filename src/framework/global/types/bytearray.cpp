@@ -26,11 +26,17 @@
 
 using namespace muse;
 
+//! NOTE Empty arrays (and raw data wrappers) share one buffer,
+//! it's never written to, since detach() copies while it's shared
+static const std::shared_ptr<std::vector<uint8_t> >& emptyData()
+{
+    static const std::shared_ptr<std::vector<uint8_t> > data = std::make_shared<std::vector<uint8_t> >(1, 0);
+    return data;
+}
+
 ByteArray::ByteArray()
+    : m_data(emptyData())
 {
-    m_data = std::make_shared<Data>();
-    m_data->resize(1);
-    m_data->operator [](0) = 0;
 }
 
 ByteArray::ByteArray(const uint8_t* data, size_t size)
@@ -106,8 +112,8 @@ void ByteArray::detach()
     }
 
     if (m_raw.data) {
-        m_data->resize(m_raw.size + 1);
-        m_data->operator [](m_raw.size) = 0;
+        //! NOTE Copies of a raw wrapper share m_data, so allocate a new one
+        m_data = std::make_shared<Data>(m_raw.size + 1);
         std::memcpy(m_data->data(), m_raw.data, m_raw.size);
         m_raw.data = nullptr;
         return;
@@ -191,8 +197,8 @@ void ByteArray::push_back(const uint8_t* b, size_t len)
     Data& data = *m_data.get();
     data.resize(nsize + 1);
     data[nsize] = 0;
-    for (size_t i = 0; i < len; ++i) {
-        data[start + i] = b[i];
+    if (len > 0) {
+        std::memcpy(data.data() + start, b, len);
     }
 }
 
@@ -39,7 +39,9 @@ public:
 
     SharedHashMap()
     {
-        m_dataPtr = std::make_shared<Data>();
+        //! NOTE: See SharedMap()
+        static const DataPtr s_emptyData = std::make_shared<Data>();
+        m_dataPtr = s_emptyData;
     }
 
     SharedHashMap(const size_t reserveSize)
@@ -41,7 +41,10 @@ public:
 
     SharedMap()
     {
-        m_dataPtr = std::make_shared<Data>();
+        //! NOTE: Default constructed maps share the same empty data until they are modified,
+        //! so plenty of unused maps (e.g. empty curves in playback events) don't allocate anything
+        static const DataPtr s_emptyData = std::make_shared<Data>();
+        m_dataPtr = s_emptyData;
     }
 
     SharedMap(std::initializer_list<PairType> initList)
@@ -281,14 +281,28 @@ void UtfCodec::replaceInvalid(std::string_view src, std::string& dst)
 // String
 // ============================
 
+//! NOTE Default constructed and empty strings are very common (most of the DOM string members),
+//! so they share one buffer instead of allocating their own.
+//! The buffer is never modified: the static reference keeps its use count above 1, so mutStr() detaches first
+static const std::shared_ptr<std::u16string>& emptyData()
+{
+    static const std::shared_ptr<std::u16string> empty = std::make_shared<std::u16string>();
+    return empty;
+}
+
 String::String()
+    : m_data(emptyData())
 {
-    m_data = std::make_shared<std::u16string>();
 }
 
 String::String(const char16_t* str)
 {
-    m_data = std::make_shared<std::u16string>(str ? str : u"");
+    if (!str || !*str) {
+        m_data = emptyData();
+        return;
+    }
+
+    m_data = std::make_shared<std::u16string>(str);
 #ifdef MUSE_STRING_DEBUG_HACK
     updateDebugView();
 #endif
@@ -305,8 +319,8 @@ String::String(const Char& ch)
 
 String::String(const Char* unicode, size_t size)
 {
-    if (!unicode) {
-        m_data = std::make_shared<std::u16string>();
+    if (!unicode || size == 0) {
+        m_data = emptyData();
         return;
     }
 
@@ -632,6 +646,11 @@ std::u16string String::toStdU16String() const
     return constStr();
 }
 
+std::u16string_view String::toStdU16StringView() const
+{
+    return std::u16string_view(constStr());
+}
+
 String String::fromUcs4(const char32_t* str, size_t size)
 {
     std::u32string_view v32;
@@ -268,6 +268,7 @@ public:
     static String fromStdString(const std::string& str);
     std::string toStdString() const;
     std::u16string toStdU16String() const;
+    std::u16string_view toStdU16StringView() const; // valid while the string is alive and not changed
 
     static String fromUcs4(const char32_t* str, size_t size = muse::nidx);
     static String fromUcs4(char32_t chr);
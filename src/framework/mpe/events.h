@@ -221,6 +221,8 @@ private:
         for (auto& pair : m_pitchCtx.pitchCurve) {
             pair.second = static_cast<pitch_level_t>(RealRound(static_cast<float>(pair.second) * ratio * patternUnitRatio, 0));
         }
+
+        m_pitchCtx.pitchCurve.intern();
     }
 
     void calculateExpressionCurve(const ArticulationMap& articulationsApplied, const float requiredVelocityFraction)
@@ -252,6 +254,8 @@ private:
         for (auto& pair : m_expressionCtx.expressionCurve) {
             pair.second = static_cast<dynamic_level_t>(RealRound(pair.second * ratio, 0));
         }
+
+        m_expressionCtx.expressionCurve.intern();
     }
 
     ArrangementContext m_arrangementCtx;
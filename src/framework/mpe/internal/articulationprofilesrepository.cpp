@@ -116,9 +116,9 @@ ArticulationsProfilePtr ArticulationProfilesRepository::loadProfile(const io::pa
 
     QJsonObject articulationPatterns = rootObj.value(PATTERNS_KEY).toObject();
 
-    for (const QString& key : articulationPatterns.keys()) {
-        result->setPattern(articulationTypeFromString(key),
-                           patternsScopeFromJson(articulationPatterns.value(key).toArray()));
+    for (auto it = articulationPatterns.constBegin(); it != articulationPatterns.constEnd(); ++it) {
+        result->setPattern(articulationTypeFromString(it.key()),
+                           patternsScopeFromJson(it.value().toArray()));
     }
 
     return result;
@@ -23,6 +23,7 @@
 #ifndef MUSE_MPE_STRINGUTILS_H
 #define MUSE_MPE_STRINGUTILS_H
 
+#include <QHash>
 #include <QString>
 #include <unordered_map>
 
@@ -171,15 +172,17 @@ inline QString articulationFamilyToString(const ArticulationFamily family)
 
 inline ArticulationType articulationTypeFromString(const QString& str)
 {
-    auto search = std::find_if(ARTICULATION_TYPE_NAMES.begin(), ARTICULATION_TYPE_NAMES.end(), [str](const auto& pair) {
-        return pair.second == str;
-    });
-
-    if (search == ARTICULATION_TYPE_NAMES.cend()) {
-        return ArticulationType::Undefined;
-    }
-
-    return search->first;
+    //! NOTE Every pattern of a profile is keyed by its type name, so look names up by hash rather than scanning all types
+    static const QHash<QString, ArticulationType> TYPES_BY_NAME = []() {
+        QHash<QString, ArticulationType> result;
+        result.reserve(static_cast<int>(ARTICULATION_TYPE_NAMES.size()));
+        for (const auto& pair : ARTICULATION_TYPE_NAMES) {
+            result.insert(pair.second, pair.first);
+        }
+        return result;
+    }();
+
+    return TYPES_BY_NAME.value(str, ArticulationType::Undefined);
 }
 
 inline QString articulationTypeToString(const ArticulationType type)
@@ -30,6 +30,7 @@
 #include <unordered_set>
 #include <map>
 #include <set>
+#include <tuple>
 #include <vector>
 
 #include "types/sharedhashmap.h"
@@ -128,6 +129,34 @@ struct ValuesCurve : public SharedMap<duration_percentage_t, T>
 
         return (factor + 1.f) / 2.f;
     }
+
+    //! NOTE: Makes the curve share its data with an equal curve interned before on the same thread.
+    //! Most of the notes of a score end up with one of a few distinct curves,
+    //! so that no note keeps its own copy of them
+    void intern()
+    {
+        using Data = typename SharedMap<duration_percentage_t, T>::Data;
+        using DataPtr = typename SharedMap<duration_percentage_t, T>::DataPtr;
+
+        static constexpr size_t MAX_POOL_SIZE = 4096;
+        thread_local std::map<Data, DataPtr> pool;
+
+        if (!this->m_dataPtr || this->m_dataPtr->empty()) {
+            return;
+        }
+
+        auto search = pool.find(*this->m_dataPtr);
+        if (search != pool.end()) {
+            this->m_dataPtr = search->second;
+            return;
+        }
+
+        if (pool.size() >= MAX_POOL_SIZE) {
+            pool.clear(); // the data stays alive in the curves sharing it
+        }
+
+        pool.emplace(*this->m_dataPtr, this->m_dataPtr);
+    }
 };
 
 // Pitch
@@ -520,6 +549,11 @@ struct ArticulationsProfile
         m_patterns.insert_or_assign(type, scope);
     }
 
+    void setPattern(const ArticulationType type, ArticulationPattern&& scope)
+    {
+        m_patterns.insert_or_assign(type, std::move(scope));
+    }
+
     void removePattern(const ArticulationType type)
     {
         m_patterns.erase(type);
@@ -735,6 +769,15 @@ struct ArticulationMap : public SharedHashMap<ArticulationType, ArticulationAppl
             return;
         }
 
+        AverageDataKey key = averageDataKey();
+        AverageDataCache& cache = averageDataCache();
+
+        auto search = cache.find(key);
+        if (search != cache.cend()) {
+            applyAverageData(search->second);
+            return;
+        }
+
         resetData();
 
         ParamsSum paramsSum;
@@ -749,9 +792,122 @@ struct ArticulationMap : public SharedHashMap<ArticulationType, ArticulationAppl
         }
 
         calculateAverage(paramsSum);
+
+        if (cache.size() >= MAX_AVERAGE_DATA_CACHE_SIZE) {
+            cache.clear();
+        }
+
+        cache.emplace(std::move(key), currentAverageData());
     }
 
 private:
+    //! NOTE: The average data only depends on the applied pattern segments and the occupied ranges,
+    //! and identical combinations of articulations are very common across a score (staccato + accent, trills etc.),
+    //! so the results are cached per thread instead of being recomputed for every note
+    struct AverageData {
+        duration_percentage_t durationFactor = HUNDRED_PERCENT;
+        duration_percentage_t timestampOffset = 0;
+        pitch_level_t pitchRange = 0;
+        dynamic_level_t maxAmplitudeLevel = 0;
+        dynamic_level_t dynamicRange = 0;
+        PitchPattern::PitchOffsetMap pitchOffsetMap;
+        ExpressionPattern::DynamicOffsetMap dynamicOffsetMap;
+    };
+
+    struct AverageDataKeyItem {
+        ArticulationPatternSegment segment;
+        pitch_level_t occupiedPitchChangesRange = 0;
+        dynamic_level_t occupiedDynamicChangesRange = 0;
+        pitch_level_t overallPitchChangesRange = 0;
+        dynamic_level_t overallDynamicChangesRange = 0;
+    };
+
+    using AverageDataKey = std::vector<AverageDataKeyItem>;
+
+    struct AverageDataKeyLess {
+        bool operator()(const AverageDataKey& first, const AverageDataKey& second) const
+        {
+            return std::lexicographical_compare(first.cbegin(), first.cend(), second.cbegin(), second.cend(), &AverageDataKeyLess::itemLess);
+        }
+
+        static bool itemLess(const AverageDataKeyItem& first, const AverageDataKeyItem& second)
+        {
+            auto params = [](const AverageDataKeyItem& item) {
+                return std::make_tuple(item.segment.arrangementPattern.durationFactor,
+                                       item.segment.arrangementPattern.timestampOffset,
+                                       item.occupiedPitchChangesRange,
+                                       item.occupiedDynamicChangesRange,
+                                       item.overallPitchChangesRange,
+                                       item.overallDynamicChangesRange);
+            };
+
+            auto firstParams = params(first);
+            auto secondParams = params(second);
+
+            if (firstParams != secondParams) {
+                return firstParams < secondParams;
+            }
+
+            const PitchPattern::PitchOffsetMap& firstPitchOffsets = first.segment.pitchPattern.pitchOffsetMap;
+            const PitchPattern::PitchOffsetMap& secondPitchOffsets = second.segment.pitchPattern.pitchOffsetMap;
+
+            if (firstPitchOffsets != secondPitchOffsets) {
+                return std::lexicographical_compare(firstPitchOffsets.cbegin(), firstPitchOffsets.cend(),
+                                                    secondPitchOffsets.cbegin(), secondPitchOffsets.cend());
+            }
+
+            const ExpressionPattern::DynamicOffsetMap& firstDynamicOffsets = first.segment.expressionPattern.dynamicOffsetMap;
+            const ExpressionPattern::DynamicOffsetMap& secondDynamicOffsets = second.segment.expressionPattern.dynamicOffsetMap;
+
+            return std::lexicographical_compare(firstDynamicOffsets.cbegin(), firstDynamicOffsets.cend(),
+                                                secondDynamicOffsets.cbegin(), secondDynamicOffsets.cend());
+        }
+    };
+
+    using AverageDataCache = std::map<AverageDataKey, AverageData, AverageDataKeyLess>;
+
+    static constexpr size_t MAX_AVERAGE_DATA_CACHE_SIZE = 4096;
+
+    static AverageDataCache& averageDataCache()
+    {
+        thread_local AverageDataCache cache;
+        return cache;
+    }
+
+    AverageDataKey averageDataKey() const
+    {
+        AverageDataKey result;
+        result.reserve(size());
+
+        for (auto it = cbegin(); it != cend(); ++it) {
+            const ArticulationAppliedData& data = it->second;
+            result.push_back({ data.appliedPatternSegment,
+                               data.occupiedPitchChangesRange,
+                               data.occupiedDynamicChangesRange,
+                               data.meta.overallPitchChangesRange,
+                               data.meta.overallDynamicChangesRange });
+        }
+
+        return result;
+    }
+
+    AverageData currentAverageData() const
+    {
+        return { m_averageDurationFactor, m_averageTimestampOffset, m_averagePitchRange, m_averageMaxAmplitudeLevel,
+                 m_averageDynamicRange, m_averagePitchOffsetMap, m_averageDynamicOffsetMap };
+    }
+
+    void applyAverageData(const AverageData& data)
+    {
+        m_averageDurationFactor = data.durationFactor;
+        m_averageTimestampOffset = data.timestampOffset;
+        m_averagePitchRange = data.pitchRange;
+        m_averageMaxAmplitudeLevel = data.maxAmplitudeLevel;
+        m_averageDynamicRange = data.dynamicRange;
+        m_averagePitchOffsetMap = data.pitchOffsetMap;
+        m_averageDynamicOffsetMap = data.dynamicOffsetMap;
+    }
+
     void resetData()
     {
         m_averageDurationFactor = 0;
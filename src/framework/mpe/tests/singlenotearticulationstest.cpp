@@ -335,6 +335,66 @@ TEST_F(MPE_SingleNoteArticulationsTest, PocoTenuto)
     EXPECT_EQ(event.arrangementCtx().actualDuration, m_nominalDuration * 0.75);
 }
 
+/**
+ * @brief MPE_SingleNoteArticulationsTest_PocoTenuto_RepeatedCombination
+ * @details In this case we're gonna calculate the average data of the same staccato + tenuto combination for two different notes,
+ *          and a combination with a modified staccato pattern. The repeated combination is expected to produce exactly
+ *          the same data, and the modified one must not reuse it
+ */
+TEST_F(MPE_SingleNoteArticulationsTest, PocoTenuto_RepeatedCombination)
+{
+    // [GIVEN] Articulation patterns "Staccato" and "Tenuto"
+    ArticulationPatternSegment staccatoPattern;
+    staccatoPattern.arrangementPattern = createArrangementPattern(5 * TEN_PERCENT /*duration_factor*/, 0 /*timestamp_offset*/);
+    staccatoPattern.pitchPattern = createSimplePitchPattern(0 /*increment_pitch_diff*/);
+    staccatoPattern.expressionPattern = createSimpleExpressionPattern(dynamicLevelFromType(DynamicType::f));
+
+    ArticulationPatternSegment tenutoPattern;
+    tenutoPattern.arrangementPattern = createArrangementPattern(HUNDRED_PERCENT /*duration_factor*/, 0 /*timestamp_offset*/);
+    tenutoPattern.pitchPattern = createSimplePitchPattern(0 /*increment_pitch_diff*/);
+    tenutoPattern.expressionPattern = createSimpleExpressionPattern(m_nominalDynamic);
+
+    auto buildArticulations = [this](const ArticulationPatternSegment& staccato, const ArticulationPatternSegment& tenuto) {
+        ArticulationPattern staccatoScope;
+        staccatoScope.emplace(0, staccato);
+
+        ArticulationPattern tenutoScope;
+        tenutoScope.emplace(0, tenuto);
+
+        ArticulationMap result;
+        result.emplace(ArticulationType::Staccato, ArticulationAppliedData(ArticulationMeta(ArticulationType::Staccato, staccatoScope,
+                                                                                            m_nominalTimestamp, m_nominalDuration),
+                                                                           0, HUNDRED_PERCENT));
+        result.emplace(ArticulationType::Tenuto, ArticulationAppliedData(ArticulationMeta(ArticulationType::Tenuto, tenutoScope,
+                                                                                          m_nominalTimestamp, m_nominalDuration),
+                                                                         0, HUNDRED_PERCENT));
+        result.preCalculateAverageData();
+
+        return result;
+    };
+
+    // [WHEN] The average data of the same combination is calculated twice
+    ArticulationMap first = buildArticulations(staccatoPattern, tenutoPattern);
+    ArticulationMap second = buildArticulations(staccatoPattern, tenutoPattern);
+
+    // [THEN] We expect the same data for both of them
+    EXPECT_EQ(first.averageDurationFactor(), 75 * ONE_PERCENT);
+    EXPECT_EQ(first.averageDurationFactor(), second.averageDurationFactor());
+    EXPECT_EQ(first.averageTimestampOffset(), second.averageTimestampOffset());
+    EXPECT_EQ(first.averageMaxAmplitudeLevel(), second.averageMaxAmplitudeLevel());
+    EXPECT_EQ(first.averageDynamicRange(), second.averageDynamicRange());
+    EXPECT_EQ(first.averagePitchRange(), second.averagePitchRange());
+    EXPECT_TRUE(first.averageDynamicOffsetMap() == second.averageDynamicOffsetMap());
+    EXPECT_TRUE(first.averagePitchOffsetMap() == second.averagePitchOffsetMap());
+
+    // [WHEN] The staccato pattern is modified
+    staccatoPattern.arrangementPattern = createArrangementPattern(3 * TEN_PERCENT /*duration_factor*/, 0 /*timestamp_offset*/);
+    ArticulationMap modified = buildArticulations(staccatoPattern, tenutoPattern);
+
+    // [THEN] We expect the average duration to reflect the modified pattern
+    EXPECT_EQ(modified.averageDurationFactor(), 65 * ONE_PERCENT);
+}
+
 /**
  * @brief MPE_SingleNoteArticulationsTest_QuickFall
  * @details In this case we're gonna build a simple note event with the quick fall articulation
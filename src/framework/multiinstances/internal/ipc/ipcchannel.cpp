@@ -101,6 +101,13 @@ Code IpcChannel::syncRequestToAll(const QString& method, const QStringList& args
 
     int total = m_selfSocket->instances().count();
     total -= 1;     //! NOTE Exclude itself
+
+    //! NOTE The instance list is known and contains only us, nobody would answer,
+    //! so don't wait for the timeout. An empty list means it hasn't been received yet
+    if (total == 0) {
+        return Code::AllAnswered;
+    }
+
     int received = 0;
 
     m_msgCallback = [method, total, &received, &loop, onReceived](const Msg& msg) {
@@ -83,25 +83,37 @@ InstrumentInfo findInstrument(MuseSamplerLibHandlerPtr libHandler, const AudioRe
     return InstrumentInfo();
 }
 
-void MuseSamplerResolver::init()
+void MuseSamplerResolver::init(bool lazy)
 {
-    if (doInit(configuration()->userLibraryPath())) {
-        return;
+    //! NOTE Loading the library takes a while, when lazy it is loaded on first use
+    if (!lazy) {
+        libHandler();
     }
+}
+
+const MuseSamplerLibHandlerPtr& MuseSamplerResolver::libHandler() const
+{
+    std::call_once(m_loadFlag, [this]() {
+        if (doInit(configuration()->userLibraryPath())) {
+            return;
+        }
+
+        doInit(configuration()->fallbackLibraryPath());
+    });
 
-    doInit(configuration()->fallbackLibraryPath());
+    return m_libHandler;
 }
 
 bool MuseSamplerResolver::reloadMuseSampler()
 {
-    if (!m_libHandler) {
+    if (!libHandler()) {
         return false;
     }
 
-    return m_libHandler->reloadAllInstruments() == ms_Result_OK;
+    return libHandler()->reloadAllInstruments() == ms_Result_OK;
 }
 
-bool MuseSamplerResolver::doInit(const io::path_t& libPath)
+bool MuseSamplerResolver::doInit(const io::path_t& libPath) const
 {
     m_libHandler = std::make_shared<MuseSamplerLibHandler>(libPath, configuration()->useLegacyAudition());
 
@@ -122,9 +134,9 @@ bool MuseSamplerResolver::doInit(const io::path_t& libPath)
 
 ISynthesizerPtr MuseSamplerResolver::resolveSynth(const TrackId /*trackId*/, const AudioInputParams& params) const
 {
-    InstrumentInfo instrument = findInstrument(m_libHandler, params.resourceMeta);
+    InstrumentInfo instrument = findInstrument(libHandler(), params.resourceMeta);
     if (instrument.isValid()) {
-        return std::make_shared<MuseSamplerWrapper>(m_libHandler, instrument, params, iocContext());
+        return std::make_shared<MuseSamplerWrapper>(libHandler(), instrument, params, iocContext());
     }
 
     return nullptr;
@@ -134,7 +146,7 @@ bool MuseSamplerResolver::hasCompatibleResources(const PlaybackSetupData& setup)
 {
     UNUSED(setup);
 
-    if (!m_libHandler) {
+    if (!libHandler()) {
         return false;
     }
 
@@ -145,19 +157,19 @@ AudioResourceMetaList MuseSamplerResolver::resolveResources() const
 {
     AudioResourceMetaList result;
 
-    if (!m_libHandler) {
+    if (!libHandler()) {
         return result;
     }
 
-    auto instrumentList = m_libHandler->getInstrumentList();
-    while (auto instrument = m_libHandler->getNextInstrument(instrumentList))
+    auto instrumentList = libHandler()->getInstrumentList();
+    while (auto instrument = libHandler()->getNextInstrument(instrumentList))
     {
-        int instrumentId = m_libHandler->getInstrumentId(instrument);
-        String internalName = String::fromUtf8(m_libHandler->getInstrumentName(instrument));
-        String internalCategory = String::fromUtf8(m_libHandler->getInstrumentCategory(instrument));
-        String instrumentPackName = String::fromUtf8(m_libHandler->getInstrumentPackName(instrument));
-        String instrumentSoundId = String::fromUtf8(m_libHandler->getMpeSoundId(instrument));
-        String vendorName = String::fromUtf8(m_libHandler->getInstrumentVendorName(instrument));
+        int instrumentId = libHandler()->getInstrumentId(instrument);
+        String internalName = String::fromUtf8(libHandler()->getInstrumentName(instrument));
+        String internalCategory = String::fromUtf8(libHandler()->getInstrumentCategory(instrument));
+        String instrumentPackName = String::fromUtf8(libHandler()->getInstrumentPackName(instrument));
+        String instrumentSoundId = String::fromUtf8(libHandler()->getMpeSoundId(instrument));
+        String vendorName = String::fromUtf8(libHandler()->getInstrumentVendorName(instrument));
 
         if (instrumentSoundId.empty()) {
             LOGE() << "MISSING INSTRUMENT ID for: " << internalName;
@@ -188,15 +200,15 @@ AudioResourceMetaList MuseSamplerResolver::resolveResources() const
 
 SoundPresetList MuseSamplerResolver::resolveSoundPresets(const AudioResourceMeta& resourceMeta) const
 {
-    InstrumentInfo instrument = findInstrument(m_libHandler, resourceMeta);
+    InstrumentInfo instrument = findInstrument(libHandler(), resourceMeta);
     if (!instrument.msInstrument) {
         return SoundPresetList();
     }
 
-    ms_PresetList presets = m_libHandler->getPresetList(instrument.msInstrument);
+    ms_PresetList presets = libHandler()->getPresetList(instrument.msInstrument);
     SoundPresetList result;
 
-    while (const char* presetCode = m_libHandler->getNextPreset(presets)) {
+    while (const char* presetCode = libHandler()->getNextPreset(presets)) {
         SoundPreset soundPreset;
         soundPreset.code = presetCode;
         soundPreset.name = presetCode;
@@ -232,14 +244,14 @@ void MuseSamplerResolver::clearSources()
 
 std::string MuseSamplerResolver::version() const
 {
-    if (!m_libHandler) {
+    if (!libHandler()) {
         return std::string();
     }
 
-    String ver = String::fromUtf8(m_libHandler->getVersionString());
+    String ver = String::fromUtf8(libHandler()->getVersionString());
 
     if (configuration()->shouldShowBuildNumber()) {
-        ver += u"." + String::number(m_libHandler->getBuildNumber());
+        ver += u"." + String::number(libHandler()->getBuildNumber());
     }
 
     return ver.toStdString();
@@ -247,7 +259,7 @@ std::string MuseSamplerResolver::version() const
 
 bool MuseSamplerResolver::isInstalled() const
 {
-    if (m_libHandler) {
+    if (libHandler()) {
         return true;
     }
 
@@ -256,16 +268,16 @@ bool MuseSamplerResolver::isInstalled() const
 
 float MuseSamplerResolver::defaultReverbLevel(const String& instrumentSoundId) const
 {
-    if (!m_libHandler || !m_libHandler->getReverbLevel || instrumentSoundId.empty()) {
+    if (!libHandler() || !libHandler()->getReverbLevel || instrumentSoundId.empty()) {
         return 0.f;
     }
 
-    auto instrumentList = m_libHandler->getInstrumentList();
-    while (auto instrument = m_libHandler->getNextInstrument(instrumentList)) {
-        String soundId = String::fromUtf8(m_libHandler->getMpeSoundId(instrument));
+    auto instrumentList = libHandler()->getInstrumentList();
+    while (auto instrument = libHandler()->getNextInstrument(instrumentList)) {
+        String soundId = String::fromUtf8(libHandler()->getMpeSoundId(instrument));
 
         if (instrumentSoundId == soundId) {
-            return m_libHandler->getReverbLevel(instrument) / 100.f;
+            return libHandler()->getReverbLevel(instrument) / 100.f;
         }
     }
 
@@ -274,25 +286,25 @@ float MuseSamplerResolver::defaultReverbLevel(const String& instrumentSoundId) c
 
 ByteArray MuseSamplerResolver::drumMapping(int instrumentId) const
 {
-    if (!m_libHandler) {
+    if (!libHandler()) {
         return ByteArray();
     }
 
-    const char* mapping_cstr = m_libHandler->getDrumMapping(instrumentId);
+    const char* mapping_cstr = libHandler()->getDrumMapping(instrumentId);
     return mapping_cstr ? ByteArray(mapping_cstr) : ByteArray();
 }
 
 std::vector<Instrument> MuseSamplerResolver::instruments() const
 {
-    if (!m_libHandler) {
+    if (!libHandler()) {
         return {};
     }
 
     std::vector<Instrument> result;
 
-    auto instrumentList = m_libHandler->getInstrumentList();
-    while (auto msInstrument = m_libHandler->getNextInstrument(instrumentList)) {
-        const char* json_cstr = m_libHandler->getInstrumentInfoJson(msInstrument);
+    auto instrumentList = libHandler()->getInstrumentList();
+    while (auto msInstrument = libHandler()->getNextInstrument(instrumentList)) {
+        const char* json_cstr = libHandler()->getInstrumentInfoJson(msInstrument);
         if (!json_cstr) {
             continue;
         }
@@ -309,13 +321,13 @@ std::vector<Instrument> MuseSamplerResolver::instruments() const
             continue;
         }
 
-        int id = m_libHandler->getInstrumentId(msInstrument);
+        int id = libHandler()->getInstrumentId(msInstrument);
         JsonObject obj = doc.rootObject();
 
         Instrument instrument;
         instrument.id = buildMuseInstrumentId(instrument.category, instrument.name, id);
-        instrument.soundId = String::fromUtf8(m_libHandler->getMpeSoundId(msInstrument));
-        instrument.musicXmlId = String::fromUtf8(m_libHandler->getMusicXmlSoundId(msInstrument));
+        instrument.soundId = String::fromUtf8(libHandler()->getMpeSoundId(msInstrument));
+        instrument.musicXmlId = String::fromUtf8(libHandler()->getMusicXmlSoundId(msInstrument));
         instrument.name = obj.value("FriendlyName").toString();
         instrument.abbreviation = obj.value("Abbreviation").toString();
         instrument.category = obj.value("Category").toString();
@@ -333,7 +345,7 @@ std::vector<Instrument> MuseSamplerResolver::instruments() const
 
 void MuseSamplerResolver::loadSoundPresetAttributes(SoundPresetAttributes& attributes, int instrumentId, const char* presetCode) const
 {
-    const char* articulations_cstr = m_libHandler->getTextArticulations(instrumentId, presetCode);
+    const char* articulations_cstr = libHandler()->getTextArticulations(instrumentId, presetCode);
     if (articulations_cstr) {
         String articulation = String::fromAscii(articulations_cstr);
 
@@ -23,6 +23,8 @@
 #ifndef MUSE_MUSESAMPLER_MUSESAMPLERRESOLVER_H
 #define MUSE_MUSESAMPLER_MUSESAMPLERRESOLVER_H
 
+#include <mutex>
+
 #include "audio/isynthresolver.h"
 #include "modularity/ioc.h"
 
@@ -40,7 +42,7 @@ public:
     MuseSamplerResolver(const modularity::ContextPtr& iocCtx)
         : Injectable(iocCtx) {}
 
-    void init();
+    void init(bool lazy = false);
     bool reloadMuseSampler();
 
     muse::audio::synth::ISynthesizerPtr resolveSynth(const muse::audio::TrackId trackId,
@@ -60,13 +62,15 @@ public:
     std::vector<Instrument> instruments() const override;
 
 private:
-    bool doInit(const io::path_t& libPath);
+    const MuseSamplerLibHandlerPtr& libHandler() const;
+    bool doInit(const io::path_t& libPath) const;
 
     void loadSoundPresetAttributes(muse::audio::SoundPresetAttributes& attributes, int instrumentId, const char* presetCode) const;
 
     String buildMuseInstrumentId(const String& category, const String& name, int uniqueId) const;
 
-    MuseSamplerLibHandlerPtr m_libHandler = nullptr;
+    mutable std::once_flag m_loadFlag;
+    mutable MuseSamplerLibHandlerPtr m_libHandler = nullptr;
 };
 }
 
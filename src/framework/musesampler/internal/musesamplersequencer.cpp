@@ -20,6 +20,8 @@
  * along with this program.  If not, see <https://www.gnu.org/licenses/>.
  */
 
+#include <algorithm>
+
 #include "musesamplersequencer.h"
 
 #include "apitypes.h"
@@ -112,9 +114,34 @@ void MuseSamplerSequencer::init(MuseSamplerLibHandlerPtr samplerLib, ms_MuseSamp
     m_defaultPresetCode = std::move(defaultPresetCode);
 }
 
+const MuseSamplerSequencer::AuditionEventList& MuseSamplerSequencer::moveAuditionForward(const audio::msecs_t nextMicros)
+{
+    ONLY_AUDIO_WORKER_THREAD;
+
+    m_dueAuditionEvents.clear();
+
+    const audio::msecs_t blockEnd = m_auditionPosition + nextMicros;
+
+    while (m_auditionCursor < m_auditionEvents.size() && m_auditionEvents[m_auditionCursor].timestamp <= blockEnd) {
+        // The buffer is reserved in updateOffStreamEvents(), growing it here would allocate on the audio thread
+        IF_ASSERT_FAILED(m_dueAuditionEvents.size() < m_dueAuditionEvents.capacity()) {
+            break;
+        }
+
+        m_dueAuditionEvents.push_back(m_auditionEvents[m_auditionCursor].event);
+        ++m_auditionCursor;
+    }
+
+    m_auditionPosition = blockEnd;
+
+    return m_dueAuditionEvents;
+}
+
 void MuseSamplerSequencer::updateOffStreamEvents(const PlaybackEventsMap& events, const PlaybackParamList& params)
 {
-    m_offStreamEvents.clear();
+    m_auditionEvents.clear();
+    m_auditionCursor = 0;
+    m_auditionPosition = 0;
 
     if (m_onOffStreamFlushed) {
         m_onOffStreamFlushed();
@@ -152,19 +179,53 @@ void MuseSamplerSequencer::updateOffStreamEvents(const PlaybackEventsMap& events
             noteOn.msEvent._syllable_starts_at_note = m_offStreamCache.syllableStartsAtNote;
             noteOn.msTrack = track;
 
-            timestamp_t timestampFrom = arrangementCtx.actualTimestamp;
-            m_offStreamEvents[arrangementCtx.actualTimestamp].emplace(std::move(noteOn));
-
             AuditionStopNoteEvent noteOff;
             noteOff.msEvent = { noteOn.msEvent._pitch };
             noteOff.msTrack = track;
 
+            timestamp_t timestampFrom = arrangementCtx.actualTimestamp;
             timestamp_t timestampTo = timestampFrom + arrangementCtx.actualDuration;
-            m_offStreamEvents[timestampTo].emplace(std::move(noteOff));
+
+            m_auditionEvents.push_back({ timestampFrom, std::move(noteOn) });
+            m_auditionEvents.push_back({ timestampTo, std::move(noteOff) });
         }
     }
 
-    updateOffSequenceIterator();
+    std::sort(m_auditionEvents.begin(), m_auditionEvents.end(), auditionEventLess);
+
+    auto duplicatesIt = std::unique(m_auditionEvents.begin(), m_auditionEvents.end(),
+                                    [](const TimedAuditionEvent& first, const TimedAuditionEvent& second) {
+        return !auditionEventLess(first, second) && !auditionEventLess(second, first);
+    });
+    m_auditionEvents.erase(duplicatesIt, m_auditionEvents.end());
+
+    m_dueAuditionEvents.clear();
+    m_dueAuditionEvents.reserve(m_auditionEvents.size());
+}
+
+bool MuseSamplerSequencer::auditionEventLess(const TimedAuditionEvent& first, const TimedAuditionEvent& second)
+{
+    if (first.timestamp != second.timestamp) {
+        return first.timestamp < second.timestamp;
+    }
+
+    // The same order as in the event sequences: note-ons go first, then the notes are sorted by pitch
+    if (first.event.index() != second.event.index()) {
+        return first.event.index() < second.event.index();
+    }
+
+    if (std::holds_alternative<AuditionStartNoteEvent>(first.event)) {
+        const ms_AuditionStartNoteEvent_4& e1 = std::get<AuditionStartNoteEvent>(first.event).msEvent;
+        const ms_AuditionStartNoteEvent_4& e2 = std::get<AuditionStartNoteEvent>(second.event).msEvent;
+        if (e1._pitch == e2._pitch) {
+            return e1._offset_cents < e2._offset_cents;
+        }
+
+        return e1._pitch < e2._pitch;
+    }
+
+    return std::get<AuditionStopNoteEvent>(first.event).msEvent._pitch
+           < std::get<AuditionStopNoteEvent>(second.event).msEvent._pitch;
 }
 
 void MuseSamplerSequencer::updateMainStreamEvents(const PlaybackEventsMap& events, const DynamicLevelLayers& dynamics,
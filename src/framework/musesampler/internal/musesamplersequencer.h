@@ -64,8 +64,15 @@ namespace muse::musesampler {
 class MuseSamplerSequencer : public muse::audio::AbstractEventSequencer<mpe::NoteEvent, AuditionStartNoteEvent, AuditionStopNoteEvent>
 {
 public:
+    using AuditionEvent = std::variant<AuditionStartNoteEvent, AuditionStopNoteEvent>;
+    using AuditionEventList = std::vector<AuditionEvent>;
+
     void init(MuseSamplerLibHandlerPtr samplerLib, ms_MuseSampler sampler, IMuseSamplerTracks* tracks, std::string&& defaultPresetCode);
 
+    //! NOTE: Returns the audition events due within the next block.
+    //! Doesn't allocate: the events are staged in the buffers preallocated by updateOffStreamEvents()
+    const AuditionEventList& moveAuditionForward(const audio::msecs_t nextMicros);
+
 private:
     void updateOffStreamEvents(const mpe::PlaybackEventsMap& events, const mpe::PlaybackParamList& params) override;
     void updateMainStreamEvents(const mpe::PlaybackEventsMap& events, const mpe::DynamicLevelLayers& dynamics,
@@ -116,6 +123,13 @@ private:
 
     void parseOffStreamParams(const mpe::PlaybackParamList& params, OffStreamParams& out) const;
 
+    struct TimedAuditionEvent {
+        audio::msecs_t timestamp = 0;
+        AuditionEvent event;
+    };
+
+    static bool auditionEventLess(const TimedAuditionEvent& first, const TimedAuditionEvent& second);
+
     MuseSamplerLibHandlerPtr m_samplerLib = nullptr;
     ms_MuseSampler m_sampler = nullptr;
     IMuseSamplerTracks* m_tracks = nullptr;
@@ -124,6 +138,11 @@ private:
 
     std::string m_defaultPresetCode;
     OffStreamParams m_offStreamCache;
+
+    std::vector<TimedAuditionEvent> m_auditionEvents;
+    AuditionEventList m_dueAuditionEvents;
+    size_t m_auditionCursor = 0;
+    audio::msecs_t m_auditionPosition = 0;
 };
 }
 
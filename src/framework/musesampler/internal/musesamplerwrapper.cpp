@@ -109,12 +109,8 @@ samples_t MuseSamplerWrapper::process(float* buffer, samples_t samplesPerChannel
 
     if (!active) {
         msecs_t nextMicros = samplesToMsecs(samplesPerChannel, m_sampleRate);
-        MuseSamplerSequencer::EventSequenceMap sequences = m_sequencer.movePlaybackForward(nextMicros);
-
-        for (const auto& pair : sequences) {
-            for (const MuseSamplerSequencer::EventType& event : pair.second) {
-                handleAuditionEvents(event);
-            }
+        for (const MuseSamplerSequencer::AuditionEvent& event : m_sequencer.moveAuditionForward(nextMicros)) {
+            handleAuditionEvents(event);
         }
     }
 
@@ -370,7 +366,7 @@ void MuseSamplerWrapper::prepareOutputBuffer(const samples_t samples)
     m_bus._channels = m_internalBuffer.data();
 }
 
-void MuseSamplerWrapper::handleAuditionEvents(const MuseSamplerSequencer::EventType& event)
+void MuseSamplerWrapper::handleAuditionEvents(const MuseSamplerSequencer::AuditionEvent& event)
 {
     IF_ASSERT_FAILED(m_samplerLib && m_sampler) {
         return;
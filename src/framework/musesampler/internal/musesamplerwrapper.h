@@ -76,7 +76,7 @@ private:
     std::string resolveDefaultPresetCode(const InstrumentInfo& instrument) const;
 
     void prepareOutputBuffer(const muse::audio::samples_t samples);
-    void handleAuditionEvents(const MuseSamplerSequencer::EventType& event);
+    void handleAuditionEvents(const MuseSamplerSequencer::AuditionEvent& event);
     void setCurrentPosition(const muse::audio::samples_t samples);
     void extractOutputSamples(muse::audio::samples_t samples, float* output);
 
@@ -76,7 +76,8 @@ void MuseSamplerModule::onInit(const IApplication::RunMode& mode)
     }
 
     m_configuration->init();
-    m_resolver->init();
+    //! NOTE Console conversions rarely play back, so the library is loaded on first use there
+    m_resolver->init(/*lazy*/ IApplication::RunMode::ConsoleApp == mode);
     m_actionController->init([this]() {
         return m_resolver->reloadMuseSampler();
     });
@@ -81,6 +81,11 @@ samples_t AudioConfigurationStub::minSamplesToReserve(RenderMode) const
     return 0;
 }
 
+samples_t AudioConfigurationStub::samplesToRenderAhead(RenderMode) const
+{
+    return 0;
+}
+
 samples_t AudioConfigurationStub::samplesToPreallocate() const
 {
     return 0;
@@ -144,3 +149,8 @@ bool AudioConfigurationStub::shouldMeasureInputLag() const
 {
     return false;
 }
+
+bool AudioConfigurationStub::shouldProfileAudioWorker() const
+{
+    return false;
+}
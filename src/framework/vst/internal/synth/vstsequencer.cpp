@@ -79,11 +79,9 @@ void VstSequencer::updateMainStreamEvents(const mpe::PlaybackEventsMap& events,
     }
 
     updatePlaybackEvents(m_mainStreamEvents, events);
-    updateMainSequenceIterator();
 
     if (m_useDynamicEvents) {
         updateDynamicEvents(m_dynamicEvents, dynamics);
-        updateDynamicChangesIterator();
     }
 }
 
@@ -46,6 +46,10 @@ public:
     virtual const std::vector<int>& availableSampleRates() const = 0;
 
     virtual muse::audio::samples_t exportBufferSize() const = 0;
+
+    virtual bool exportNormalizeLoudness() const = 0;
+    virtual void setExportNormalizeLoudness(bool normalize) = 0;
+    virtual float exportTargetLoudness() const = 0;
 };
 }
 
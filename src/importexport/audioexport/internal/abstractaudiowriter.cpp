@@ -101,6 +101,20 @@ Ret AbstractAudioWriter::doWriteAndWait(INotationPtr notation,
         return make_ret(Ret::Code::InternalError);
     }
 
+    SoundTrackFormat exportFormat = format;
+    if (configuration()->exportNormalizeLoudness()) {
+        exportFormat.targetLoudness = configuration()->exportTargetLoudness();
+    }
+
+    return writeSoundTracksAndWait(notation, { SoundTrackDestination { muse::io::path_t(path), exportFormat } });
+}
+
+Ret AbstractAudioWriter::writeSoundTracksAndWait(INotationPtr notation, const SoundTrackDestinationList& destinations)
+{
+    IF_ASSERT_FAILED(!destinations.empty()) {
+        return make_ret(Ret::Code::InternalError);
+    }
+
     m_isCompleted = false;
     m_writeRet = muse::Ret();
 
@@ -113,7 +127,7 @@ Ret AbstractAudioWriter::doWriteAndWait(INotationPtr notation,
     });
 
     playback()->sequenceIdList()
-    .onResolve(this, [this, path, &format](const TrackSequenceIdList& sequenceIdList) {
+    .onResolve(this, [this, &destinations](const TrackSequenceIdList& sequenceIdList) {
         m_progress.started.notify();
 
         for (const TrackSequenceId sequenceId : sequenceIdList) {
@@ -122,9 +136,9 @@ Ret AbstractAudioWriter::doWriteAndWait(INotationPtr notation,
                 m_progress.progressChanged.send(current, total, title);
             });
 
-            playback()->audioOutput()->saveSoundTrack(sequenceId, muse::io::path_t(path), std::move(format))
-            .onResolve(this, [this, path](const bool /*result*/) {
-                LOGD() << "Successfully saved sound track by path: " << path;
+            playback()->audioOutput()->saveSoundTracks(sequenceId, destinations)
+            .onResolve(this, [this](const bool /*result*/) {
+                LOGD() << "Successfully saved sound tracks";
                 m_writeRet = muse::make_ok();
                 m_isCompleted = true;
                 m_progress.finished.send(muse::make_ok());
@@ -54,6 +54,9 @@ public:
     muse::Progress* progress() override;
     void abort() override;
 
+    //! Renders the notation once and encodes it into every destination in parallel
+    muse::Ret writeSoundTracksAndWait(notation::INotationPtr notation, const muse::audio::SoundTrackDestinationList& destinations);
+
 protected:
     muse::Ret doWriteAndWait(notation::INotationPtr notation, muse::io::IODevice& dstDevice, const muse::audio::SoundTrackFormat& format);
 
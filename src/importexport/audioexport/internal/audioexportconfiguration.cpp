@@ -31,11 +31,15 @@ using namespace muse::audio;
 
 static const Settings::Key EXPORT_SAMPLE_RATE_KEY("iex_audioexport", "export/audio/sampleRate");
 static const Settings::Key EXPORT_MP3_BITRATE("iex_audioexport", "export/audio/mp3Bitrate");
+static const Settings::Key EXPORT_NORMALIZE_LOUDNESS_KEY("iex_audioexport", "export/audio/normalizeLoudness");
+static const Settings::Key EXPORT_TARGET_LOUDNESS_KEY("iex_audioexport", "export/audio/targetLoudness");
 
 void AudioExportConfiguration::init()
 {
     settings()->setDefaultValue(EXPORT_SAMPLE_RATE_KEY, Val(44100));
     settings()->setDefaultValue(EXPORT_MP3_BITRATE, Val(128));
+    settings()->setDefaultValue(EXPORT_NORMALIZE_LOUDNESS_KEY, Val(false));
+    settings()->setDefaultValue(EXPORT_TARGET_LOUDNESS_KEY, Val(-14.0));
 }
 
 int AudioExportConfiguration::exportMp3Bitrate() const
@@ -79,3 +83,18 @@ samples_t AudioExportConfiguration::exportBufferSize() const
 {
     return 4096;
 }
+
+bool AudioExportConfiguration::exportNormalizeLoudness() const
+{
+    return settings()->value(EXPORT_NORMALIZE_LOUDNESS_KEY).toBool();
+}
+
+void AudioExportConfiguration::setExportNormalizeLoudness(bool normalize)
+{
+    settings()->setSharedValue(EXPORT_NORMALIZE_LOUDNESS_KEY, Val(normalize));
+}
+
+float AudioExportConfiguration::exportTargetLoudness() const
+{
+    return settings()->value(EXPORT_TARGET_LOUDNESS_KEY).toFloat();
+}
@@ -41,6 +41,10 @@ public:
 
     muse::audio::samples_t exportBufferSize() const override;
 
+    bool exportNormalizeLoudness() const override;
+    void setExportNormalizeLoudness(bool normalize) override;
+    float exportTargetLoudness() const override;
+
 private:
     std::optional<int> m_exportMp3BitrateOverride = std::nullopt;
 };
@@ -207,10 +207,10 @@ static void setPitchByOttavaType(mu::engraving::Note* note, mu::engraving::Ottav
     }
 }
 
-GPConverter::GPConverter(Score* score, std::unique_ptr<GPDomModel>&& gpDom, const muse::modularity::ContextPtr& iocCtx)
-    : muse::Injectable(iocCtx), _score(score), _gpDom(std::move(gpDom))
+//! NOTE The drum tables are constant, so they are built once and shared by all imports
+static const std::map<uint16_t, uint16_t>& drumExtension()
 {
-    _drumExtension = {
+    static const std::map<uint16_t, uint16_t> extension {
         { 91, 40 }, //Snare(rim shot)
         { 92, 42 }, //Hi Hat (half)
         { 93, 51 }, //Ride (edje)
@@ -249,8 +249,23 @@ GPConverter::GPConverter(Score* score, std::unique_ptr<GPDomModel>&& gpDom, cons
         { 127, 59 }//Ride (bell)
     };
 
-    _drumResolver = std::make_unique<GPDrumSetResolver>();
-    _drumResolver->initGPDrum();
+    return extension;
+}
+
+static const GPDrumSetResolver& drumResolver()
+{
+    static const GPDrumSetResolver resolver = [] {
+        GPDrumSetResolver r;
+        r.initGPDrum();
+        return r;
+    }();
+
+    return resolver;
+}
+
+GPConverter::GPConverter(Score* score, std::unique_ptr<GPDomModel>&& gpDom, const muse::modularity::ContextPtr& iocCtx)
+    : muse::Injectable(iocCtx), _score(score), _gpDom(std::move(gpDom))
+{
     m_continiousElementsBuilder = std::make_unique<ContiniousElementsBuilder>(_score);
 }
 
@@ -2127,8 +2142,9 @@ void GPConverter::setPitch(Note* note, const GPNote::MidiPitch& midiPitch)
 
     bool hasDrumStaff = note->part()->hasDrumStaff();
     if (!engravingConfiguration()->guitarProImportExperimental() && hasDrumStaff) {
-        auto it = _drumExtension.find(pitch);
-        if (it != _drumExtension.end()) {
+        const auto& extension = drumExtension();
+        auto it = extension.find(pitch);
+        if (it != extension.end()) {
             pitch =  it->second;
         }
     }
@@ -2173,7 +2189,7 @@ void GPConverter::setTpc(Note* note, int accidental)
 
 int GPConverter::calculateDrumPitch(int element, int variation, const String& instrumentName)
 {
-    return _drumResolver->pitch(element, variation, instrumentName);
+    return drumResolver().pitch(element, variation, instrumentName);
 }
 
 void GPConverter::addDynamic(const GPBeat* gpb, ChordRest* cr)
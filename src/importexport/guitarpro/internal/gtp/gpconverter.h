@@ -172,7 +172,6 @@ private:
 
     mutable GPBeat* m_currentGPBeat = nullptr; // used for passing info from notes
 
-    std::map<uint16_t, uint16_t > _drumExtension;
     mu::engraving::Volta* _lastVolta = nullptr;
     int _lastDiagramIdx = -1;
 
@@ -203,7 +202,6 @@ private:
 
     mu::engraving::BeamMode m_previousBeamMode = mu::engraving::BeamMode::AUTO;
 
-    std::unique_ptr<GPDrumSetResolver> _drumResolver;
     std::unique_ptr<ContiniousElementsBuilder> m_continiousElementsBuilder;
 };
 } // namespace mu::iex::guitarpro
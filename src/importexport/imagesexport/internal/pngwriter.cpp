@@ -22,9 +22,12 @@
 
 #include "pngwriter.h"
 
+#include <algorithm>
 #include <cmath>
-#include <QImage>
+#include <deque>
+#include <future>
 #include <QBuffer>
+#include <QThread>
 
 #include "log.h"
 
@@ -39,16 +42,73 @@ std::vector<INotationWriter::UnitType> PngWriter::supportedUnitTypes() const
     return { UnitType::PER_PAGE };
 }
 
+static ByteArray encodePng(const QImage& image)
+{
+    QByteArray qdata;
+    QBuffer buf(&qdata);
+    buf.open(QIODevice::WriteOnly);
+    image.save(&buf, "png");
+
+    return ByteArray::fromQByteArray(qdata);
+}
+
 Ret PngWriter::write(INotationPtr notation, io::IODevice& destinationDevice, const Options& options)
 {
     IF_ASSERT_FAILED(notation) {
         return make_ret(Ret::Code::UnknownError);
     }
 
+    const int pageNumber = muse::value(options, OptionKey::PAGE_NUMBER, Val(0)).toInt();
+    destinationDevice.write(encodePng(paintPage(notation, pageNumber, options)));
+
+    return true;
+}
+
+Ret PngWriter::writePages(INotationPtr notation, const std::vector<io::IODevice*>& devices, const Options& options)
+{
+    IF_ASSERT_FAILED(notation) {
+        return make_ret(Ret::Code::UnknownError);
+    }
+
+    //! NOTE Painting the score is not thread safe (it changes the printing state of the score
+    //! and global paint settings), so the pages are painted one by one on this thread,
+    //! while the PNG compression, which takes most of the time, runs on worker threads.
+    //! The number of pending pages is limited to keep the memory for page images bounded.
+    const size_t maxPendingPages = static_cast<size_t>(std::max(QThread::idealThreadCount(), 1));
+
+    std::deque<std::future<ByteArray> > pending;
+    size_t nextDeviceIdx = 0;
+
+    auto writeNextPending = [&]() {
+        devices[nextDeviceIdx]->write(pending.front().get());
+        pending.pop_front();
+        ++nextDeviceIdx;
+    };
+
+    for (size_t i = 0; i < devices.size(); ++i) {
+        if (pending.size() >= maxPendingPages) {
+            writeNextPending();
+        }
+
+        QImage image = paintPage(notation, static_cast<int>(i), options);
+        pending.push_back(std::async(std::launch::async, [image = std::move(image)]() {
+            return encodePng(image);
+        }));
+    }
+
+    while (!pending.empty()) {
+        writeNextPending();
+    }
+
+    return true;
+}
+
+QImage PngWriter::paintPage(INotationPtr notation, int pageNumber, const Options& options) const
+{
     const float CANVAS_DPI = configuration()->exportPngDpiResolution();
 
     INotationPainting::Options opt;
-    opt.fromPage = muse::value(options, OptionKey::PAGE_NUMBER, Val(0)).toInt();
+    opt.fromPage = pageNumber;
     opt.toPage = opt.fromPage;
     opt.trimMarginPixelSize = configuration()->trimMarginPixelSize();
     opt.deviceDpi = CANVAS_DPI;
@@ -67,17 +127,10 @@ Ret PngWriter::write(INotationPtr notation, io::IODevice& destinationDevice, con
                                                     Val(configuration()->exportPngWithTransparentBackground())).toBool();
     image.fill(TRANSPARENT_BACKGROUND ? Qt::transparent : Qt::white);
 
-    muse::draw::Painter painter(&image, "pngwriter");
-
-    notation->painting()->paintPng(&painter, opt);
-
-    QByteArray qdata;
-    QBuffer buf(&qdata);
-    buf.open(QIODevice::WriteOnly);
-    image.save(&buf, "png");
-
-    ByteArray data = ByteArray::fromQByteArrayNoCopy(qdata);
-    destinationDevice.write(data);
+    {
+        muse::draw::Painter painter(&image, "pngwriter");
+        notation->painting()->paintPng(&painter, opt);
+    }
 
-    return true;
+    return image;
 }
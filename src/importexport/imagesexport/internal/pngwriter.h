@@ -23,6 +23,8 @@
 #ifndef MU_IMPORTEXPORT_PNGWRITER_H
 #define MU_IMPORTEXPORT_PNGWRITER_H
 
+#include <QImage>
+
 #include "abstractimagewriter.h"
 
 #include "../iimagesexportconfiguration.h"
@@ -39,6 +41,11 @@ public:
 
     std::vector<project::INotationWriter::UnitType> supportedUnitTypes() const override;
     muse::Ret write(notation::INotationPtr notation, muse::io::IODevice& dstDevice, const Options& options = Options()) override;
+    muse::Ret writePages(notation::INotationPtr notation, const std::vector<muse::io::IODevice*>& devices,
+                         const Options& options = Options()) override;
+
+private:
+    QImage paintPage(notation::INotationPtr notation, int pageNumber, const Options& options) const;
 };
 }
 
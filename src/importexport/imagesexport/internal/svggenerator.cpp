@@ -22,6 +22,7 @@
 
 #include <QBuffer>
 #include <QFile>
+#include <QHash>
 #include <QMimeDatabase>
 #include <QMimeType>
 #include <QPaintEngine>
@@ -179,9 +180,9 @@ public:
     QTextStream* stream;
     int resolution;
 
-    QString header;
-//    QString defs; // NEEDED FOR GRADIENTS
-    QString body;
+    // Repeated shapes (mostly glyphs) are written once into <defs> and then referenced by <use>
+    bool reuseShapes = false;
+    QHash<QString, int> shapeIds;
 
     QBrush brush;
     QPen pen;
@@ -374,6 +375,13 @@ public:
         d_func()->resolution = resolution;
     }
 
+    bool reuseShapes() const { return d_func()->reuseShapes; }
+    void setReuseShapes(bool reuse)
+    {
+        Q_ASSERT(!isActive());
+        d_func()->reuseShapes = reuse;
+    }
+
 ///////////////////////////////////////////////////////////////////////////////
 // UNUSED GRADIENT CODE:
 //    void saveLinearGradientBrush(const QGradient *g)
@@ -477,6 +485,9 @@ public:
         return *d_func()->stream;
     }
 
+    void writePathData(QTextStream& str, const QPainterPath& p, qreal dx, qreal dy) const;
+    bool writeReusedShape(const QPainterPath& p);
+
     //////////////////////////////
     // SvgPaintEngine::qpenToSVG()
     //////////////////////////////
@@ -958,6 +969,32 @@ void SvgGenerator::setResolution(int dpi)
     d->engine->setResolution(dpi);
 }
 
+/*!
+    \property SvgGenerator::reuseShapes
+    \brief whether repeated shapes are written only once
+
+    When enabled, every path that is drawn more than once with the same
+    outline (noteheads, accidentals and other glyphs) is written once into
+    a <defs> element and then referenced by <use> elements. This makes the
+    generated file considerably smaller for large scores.
+    Disabled by default.
+*/
+bool SvgGenerator::reuseShapes() const
+{
+    Q_D(const SvgGenerator);
+    return d->engine->reuseShapes();
+}
+
+void SvgGenerator::setReuseShapes(bool reuse)
+{
+    Q_D(SvgGenerator);
+    if (d->engine->isActive()) {
+        LOGW("SvgGenerator::setReuseShapes(), cannot change shape reuse while SVG is being generated");
+        return;
+    }
+    d->engine->setReuseShapes(reuse);
+}
+
 /*!
     Returns the paint engine used to render graphics to be converted to SVG
     format information.
@@ -1040,9 +1077,14 @@ bool SvgPaintEngine::begin(QPaintDevice*)
         return false;
     }
 
+    // Everything is streamed directly to the output device while painting,
+    // so the document is never held in memory as a whole
+    d->stream = new QTextStream(d->outputDevice);
+    d->stream->setEncoding(QStringConverter::Utf8);
+    d->shapeIds.clear();
+
     // Stream the headers
-    d->stream = new QTextStream(&d->header);
-    stream() << "<?xml version=\"1.0\" encoding=\"UTF-8\" standalone=\"no\"?>" << Qt::endl << SVG_BEGIN;
+    stream() << "<?xml version=\"1.0\" encoding=\"UTF-8\" standalone=\"no\"?>" << '\n' << SVG_BEGIN;
     if (d->viewBox.isValid()) {
         // viewBox has floating point values, size width/height is integer
         stream() << SVG_WIDTH << d->viewBox.width() / mu::engraving::DPMM << SVG_MM << SVG_QUOTE
@@ -1051,24 +1093,18 @@ bool SvgPaintEngine::begin(QPaintDevice*)
         stream() << SVG_VIEW_BOX << d->viewBox.left()
                  << SVG_SPACE << d->viewBox.top()
                  << SVG_SPACE << d->viewBox.width()
-                 << SVG_SPACE << d->viewBox.height() << SVG_QUOTE << Qt::endl;
+                 << SVG_SPACE << d->viewBox.height() << SVG_QUOTE << '\n';
     }
     stream() << " xmlns=\"http://www.w3.org/2000/svg\""
                 " xmlns:xlink=\"http://www.w3.org/1999/xlink\""
-                " version=\"1.2\" baseProfile=\"tiny\">" << Qt::endl;
+                " version=\"1.2\" baseProfile=\"tiny\">" << '\n';
     if (!d->attributes.title.isEmpty()) {
-        stream() << SVG_TITLE_BEGIN << d->attributes.title.toHtmlEscaped() << SVG_TITLE_END << Qt::endl;
+        stream() << SVG_TITLE_BEGIN << d->attributes.title.toHtmlEscaped() << SVG_TITLE_END << '\n';
     }
     if (!d->attributes.description.isEmpty()) {
-        stream() << SVG_DESC_BEGIN << d->attributes.description.toHtmlEscaped() << SVG_DESC_END << Qt::endl;
+        stream() << SVG_DESC_BEGIN << d->attributes.description.toHtmlEscaped() << SVG_DESC_END << '\n';
     }
 
-// <defs> is currently empty. It's necessary for gradients.
-//    d->stream->setString(&d->defs);
-//    *d->stream << "<defs>\n";
-
-    // Point the stream at the body string, for other functions to populate
-    d->stream->setString(&d->body);
     return true;
 }
 
@@ -1076,21 +1112,12 @@ bool SvgPaintEngine::end()
 {
     Q_D(SvgPaintEngine);
 
-// <defs> is currently empty
-//    d->stream->setString(&d->defs);
-//    stream() << "</defs>\n";
-
-    // Point the stream at the real output device (the .svg file)
-    d->stream->setDevice(d->outputDevice);
-    d->stream->setEncoding(QStringConverter::Utf8);
-
-    // Stream our strings out to the device, in order
-    stream() << d->header;
-//    stream() << d->defs;
-    stream() << d->body;
-    stream() << SVG_END << Qt::endl;
+    stream() << SVG_END << '\n';
+    stream().flush();
 
     delete d->stream;
+    d->stream = nullptr;
+    d->shapeIds.clear();
     return true;
 }
 
@@ -1149,7 +1176,7 @@ void SvgPaintEngine::writeImage(const QRectF& r, const QByteArray& imageData, co
              << SVG_PRESERVE_ASPECT << SVG_NONE << SVG_QUOTE;
 
     stream() << " xlink:href=\"data:" << mimeFormat << ";base64,"
-             << imageData.toBase64() << SVG_QUOTE << SVG_ELEMENT_END << Qt::endl;
+             << imageData.toBase64() << SVG_QUOTE << SVG_ELEMENT_END << '\n';
 }
 
 void SvgPaintEngine::updateState(const QPaintEngineState& s)
@@ -1204,37 +1231,27 @@ void SvgPaintEngine::updateState(const QPaintEngineState& s)
     }
 }
 
-void SvgPaintEngine::drawPath(const QPainterPath& p)
+void SvgPaintEngine::writePathData(QTextStream& str, const QPainterPath& p, qreal dx, qreal dy) const
 {
-    stream() << SVG_PATH << stateString;
-
-    // fill-rule is here because UpdateState() doesn't have a QPainterPath arg
-    // Majority of <path>s use the default value: fill-rule="nonzero"
-    if (p.fillRule() == Qt::OddEvenFill) {
-        stream() << SVG_FILL_RULE;
-    }
-
-    // Path data
-    stream() << SVG_D;
     for (int i = 0; i < p.elementCount(); ++i) {
         const QPainterPath::Element& e = p.elementAt(i);
-        qreal x = e.x + _dx;
-        qreal y = e.y + _dy;
+        qreal x = e.x + dx;
+        qreal y = e.y + dy;
         switch (e.type) {
         case QPainterPath::MoveToElement:
-            stream() << SVG_MOVE << x << SVG_COMMA << y;
+            str << SVG_MOVE << x << SVG_COMMA << y;
             break;
         case QPainterPath::LineToElement:
-            stream() << SVG_LINE << x << SVG_COMMA << y;
+            str << SVG_LINE << x << SVG_COMMA << y;
             break;
         case QPainterPath::CurveToElement:
-            stream() << SVG_CURVE << x << SVG_COMMA << y;
+            str << SVG_CURVE << x << SVG_COMMA << y;
             ++i;
             while (i < p.elementCount()) {
                 const QPainterPath::Element& ee = p.elementAt(i);
                 if (ee.type == QPainterPath::CurveToDataElement) {
-                    stream() << SVG_SPACE << ee.x + _dx
-                             << SVG_COMMA << ee.y + _dy;
+                    str << SVG_SPACE << ee.x + dx
+                        << SVG_COMMA << ee.y + dy;
                     ++i;
                 } else {
                     --i;
@@ -1246,10 +1263,74 @@ void SvgPaintEngine::drawPath(const QPainterPath& p)
             break;
         }
         if (i <= p.elementCount() - 1) {
-            stream() << SVG_SPACE;
+            str << SVG_SPACE;
         }
     }
-    stream() << SVG_QUOTE << SVG_ELEMENT_END << Qt::endl;
+}
+
+bool SvgPaintEngine::writeReusedShape(const QPainterPath& p)
+{
+    // Lines and rectangles are shorter than a <use> referring to them
+    static constexpr int MIN_REUSED_SHAPE_ELEMENTS = 8;
+
+    Q_D(SvgPaintEngine);
+    if (!d->reuseShapes || p.elementCount() < MIN_REUSED_SHAPE_ELEMENTS) {
+        return false;
+    }
+
+    // The shape is stored relative to its first point,
+    // so equal glyphs at different positions share one definition
+    const QPainterPath::Element& origin = p.elementAt(0);
+
+    QString shapeData;
+    QTextStream shapeStream(&shapeData);
+    if (p.fillRule() == Qt::OddEvenFill) {
+        shapeStream << SVG_FILL_RULE;
+    }
+    shapeStream << SVG_D;
+    writePathData(shapeStream, p, -origin.x, -origin.y);
+    shapeStream << SVG_QUOTE;
+    shapeStream.flush();
+
+    auto it = d->shapeIds.constFind(shapeData);
+    int shapeId = 0;
+    if (it == d->shapeIds.cend()) {
+        // Defined in place, the first time the shape is drawn
+        shapeId = static_cast<int>(d->shapeIds.size()) + 1;
+        d->shapeIds.insert(shapeData, shapeId);
+
+        stream() << "<defs>" << SVG_PATH << " id=\"shape" << shapeId << SVG_QUOTE
+                 << shapeData << SVG_ELEMENT_END << "</defs>" << '\n';
+    } else {
+        shapeId = it.value();
+    }
+
+    stream() << "<use xlink:href=\"#shape" << shapeId << SVG_QUOTE << stateString
+             << SVG_X << SVG_QUOTE << origin.x + _dx << SVG_QUOTE
+             << SVG_Y << SVG_QUOTE << origin.y + _dy << SVG_QUOTE
+             << SVG_ELEMENT_END << '\n';
+
+    return true;
+}
+
+void SvgPaintEngine::drawPath(const QPainterPath& p)
+{
+    if (writeReusedShape(p)) {
+        return;
+    }
+
+    stream() << SVG_PATH << stateString;
+
+    // fill-rule is here because UpdateState() doesn't have a QPainterPath arg
+    // Majority of <path>s use the default value: fill-rule="nonzero"
+    if (p.fillRule() == Qt::OddEvenFill) {
+        stream() << SVG_FILL_RULE;
+    }
+
+    // Path data
+    stream() << SVG_D;
+    writePathData(stream(), p, _dx, _dy);
+    stream() << SVG_QUOTE << SVG_ELEMENT_END << '\n';
 }
 
 void SvgPaintEngine::drawPolygon(const QPointF* points, int pointCount,
@@ -1276,7 +1357,7 @@ void SvgPaintEngine::drawPolygon(const QPointF* points, int pointCount,
                 stream() << SVG_SPACE;
             }
         }
-        stream() << SVG_QUOTE << SVG_ELEMENT_END << Qt::endl;
+        stream() << SVG_QUOTE << SVG_ELEMENT_END << '\n';
     } else {
         path.closeSubpath();
         drawPath(path);
@@ -22,7 +22,7 @@
 
 #include "svgwriter.h"
 
-#include <QBuffer>
+#include <QIODevice>
 
 #include "draw/painter.h"
 
@@ -44,6 +44,30 @@ using namespace mu::notation;
 using namespace muse;
 using namespace muse::io;
 
+namespace {
+//! NOTE Lets SvgGenerator stream the document straight into the destination device
+class IODeviceAdapter : public QIODevice
+{
+public:
+    explicit IODeviceAdapter(io::IODevice& device)
+        : m_device(device) {}
+
+protected:
+    qint64 readData(char*, qint64) override
+    {
+        return -1;
+    }
+
+    qint64 writeData(const char* data, qint64 len) override
+    {
+        return static_cast<qint64>(m_device.write(reinterpret_cast<const uint8_t*>(data), static_cast<size_t>(len)));
+    }
+
+private:
+    io::IODevice& m_device;
+};
+}
+
 std::vector<INotationWriter::UnitType> SvgWriter::supportedUnitTypes() const
 {
     return { UnitType::PER_PAGE };
@@ -77,14 +101,14 @@ Ret SvgWriter::write(INotationPtr notation, io::IODevice& destinationDevice, con
 
     mu::engraving::Page* page = pages.at(PAGE_NUMBER);
 
-    QByteArray qdata;
-    QBuffer buf(&qdata);
-    buf.open(QIODevice::WriteOnly);
+    IODeviceAdapter outputDevice(destinationDevice);
+    outputDevice.open(QIODevice::WriteOnly);
 
     SvgGenerator printer;
     QString title(score->name());
     printer.setTitle(pages.size() > 1 ? QString("%1 (%2)").arg(title).arg(PAGE_NUMBER + 1) : title);
-    printer.setOutputDevice(&buf);
+    printer.setOutputDevice(&outputDevice);
+    printer.setReuseShapes(true);
 
     const int TRIM_MARGIN_SIZE = configuration()->trimMarginPixelSize();
 
@@ -246,9 +270,7 @@ Ret SvgWriter::write(INotationPtr notation, io::IODevice& destinationDevice, con
     }
 
     painter.endDraw();
-
-    ByteArray data = ByteArray::fromQByteArrayNoCopy(qdata);
-    destinationDevice.write(data);
+    outputDevice.close();
 
     // Clean up and return
     mu::engraving::MScore::pixelRatio = pixelRationBackup;
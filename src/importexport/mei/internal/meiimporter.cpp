@@ -1207,7 +1207,8 @@ bool MeiImporter::readStaffDefs(pugi::xml_node parentNode)
 
 bool MeiImporter::readStaffGrps(pugi::xml_node parentNode, int& staffSpan, int column, size_t& idx)
 {
-    pugi::xpath_node_set children = parentNode.select_nodes("./*");
+    static const pugi::xpath_query childrenQuery("./*");
+    pugi::xpath_node_set children = parentNode.select_nodes(childrenQuery);
 
     bool success = true;
 
@@ -1266,7 +1267,8 @@ bool MeiImporter::readSectionElements(pugi::xml_node parentNode)
         }
     }
 
-    pugi::xpath_node_set elements = parentNode.select_nodes("./*");
+    static const pugi::xpath_query childrenQuery("./*");
+    pugi::xpath_node_set elements = parentNode.select_nodes(childrenQuery);
     for (pugi::xpath_node xpathNode : elements) {
         std::string elementName = std::string(xpathNode.node().name());
         if (elementName == "section") {
@@ -1458,7 +1460,8 @@ bool MeiImporter::readStaves(pugi::xml_node parentNode, Measure* measure, Fracti
 
     bool success = true;
 
-    pugi::xpath_node_set staves = parentNode.select_nodes("./staff");
+    static const pugi::xpath_query staffQuery("./staff");
+    pugi::xpath_node_set staves = parentNode.select_nodes(staffQuery);
     // Critical error
     if (staves.empty()) {
         success = false;
@@ -1527,7 +1530,8 @@ bool MeiImporter::readLayers(pugi::xml_node parentNode, Measure* measure, int st
 
     bool success = true;
 
-    pugi::xpath_node_set layers = parentNode.select_nodes("./layer");
+    static const pugi::xpath_query layerQuery("./layer");
+    pugi::xpath_node_set layers = parentNode.select_nodes(layerQuery);
     // Critical error
     if (layers.empty()) {
         success = false;
@@ -1568,7 +1572,8 @@ bool MeiImporter::readElements(pugi::xml_node parentNode, Measure* measure, int
 
     bool success = true;
 
-    pugi::xpath_node_set elements = parentNode.select_nodes("./*");
+    static const pugi::xpath_query childrenQuery("./*");
+    pugi::xpath_node_set elements = parentNode.select_nodes(childrenQuery);
     for (pugi::xpath_node xpathNode : elements) {
         std::string elementName = std::string(xpathNode.node().name());
         if (elementName == "beam") {
@@ -1612,7 +1617,8 @@ bool MeiImporter::readArtics(pugi::xml_node parentNode, Chord* chord)
 
     bool success = true;
 
-    pugi::xpath_node_set elements = parentNode.select_nodes("./artic");
+    static const pugi::xpath_query articQuery("./artic");
+    pugi::xpath_node_set elements = parentNode.select_nodes(articQuery);
     for (pugi::xpath_node xpathNode : elements) {
         success = success && this->readArtic(xpathNode.node(), chord);
     }
@@ -1730,7 +1736,8 @@ bool MeiImporter::readChord(pugi::xml_node chordNode, Measure* measure, int trac
         }
     }
 
-    pugi::xpath_node_set notes = chordNode.select_nodes(".//note");
+    static const pugi::xpath_query noteQuery(".//note");
+    pugi::xpath_node_set notes = chordNode.select_nodes(noteQuery);
     for (pugi::xpath_node xpathNode : notes) {
         this->readNote(xpathNode.node(), measure, track, chordTicks, chord);
     }
@@ -1891,7 +1898,8 @@ bool MeiImporter::readNote(pugi::xml_node noteNode, Measure* measure, int track,
         this->readGracedAtt(meiNote);
     }
 
-    pugi::xml_node accidNode = noteNode.select_node(".//accid").node();
+    static const pugi::xpath_query accidQuery(".//accid");
+    pugi::xml_node accidNode = noteNode.select_node(accidQuery).node();
     libmei::Accid meiAccid;
     if (accidNode) {
         meiAccid.Read(accidNode);
@@ -2077,7 +2085,8 @@ bool MeiImporter::readVerses(pugi::xml_node parentNode, Chord* chord)
 
     bool success = true;
 
-    pugi::xpath_node_set elements = parentNode.select_nodes("./verse");
+    static const pugi::xpath_query verseQuery("./verse");
+    pugi::xpath_node_set elements = parentNode.select_nodes(verseQuery);
     for (pugi::xpath_node xpathNode : elements) {
         success = success && this->readVerse(xpathNode.node(), chord);
     }
@@ -2123,7 +2132,8 @@ bool MeiImporter::readVerse(pugi::xml_node verseNode, Chord* chord)
     bool success = true;
 
     // If the verse has a syl with @con="u", add it to the lyrics to extend
-    pugi::xpath_node extender = verseNode.select_node("./syl[@con='u']");
+    static const pugi::xpath_query extenderQuery("./syl[@con='u']");
+    pugi::xpath_node extender = verseNode.select_node(extenderQuery);
     if (extender) {
         m_lyricExtenders[chord->track()][no] = std::make_pair(lyrics, nullptr);
     }
@@ -2137,7 +2147,8 @@ bool MeiImporter::readVerse(pugi::xml_node verseNode, Chord* chord)
 
     // Aggregate the syllable into line blocks
     Convert::textWithSmufl textBlocks;
-    pugi::xpath_node_set elements = verseNode.select_nodes("./syl");
+    static const pugi::xpath_query sylQuery("./syl");
+    pugi::xpath_node_set elements = verseNode.select_nodes(sylQuery);
 
     // If we have more than one syl we assume to have elision
     ElisionType elision = (elements.size() > 1) ? ElisionFirst : ElisionNone;
@@ -2180,7 +2191,9 @@ bool MeiImporter::readControlEvents(pugi::xml_node parentNode, Measure* measure)
 
     bool success = true;
 
-    pugi::xpath_node_set elements = parentNode.select_nodes("./*");
+    static const pugi::xpath_query childrenQuery("./*");
+    static const pugi::xpath_query fbQuery("./fb");
+    pugi::xpath_node_set elements = parentNode.select_nodes(childrenQuery);
     for (pugi::xpath_node xpathNode : elements) {
         std::string elementName = std::string(xpathNode.node().name());
         if (elementName == "arpeg") {
@@ -2198,7 +2211,7 @@ bool MeiImporter::readControlEvents(pugi::xml_node parentNode, Measure* measure)
         } else if (elementName == "hairpin") {
             success = success && this->readHairpin(xpathNode.node(), measure);
         } else if (elementName == "harm") {
-            if (xpathNode.node().select_node("./fb")) {
+            if (xpathNode.node().select_node(fbQuery)) {
                 success = success && this->readFb(xpathNode.node(), measure);
             } else {
                 success = success && this->readHarm(xpathNode.node(), measure);
@@ -2416,7 +2429,8 @@ bool MeiImporter::readF(pugi::xml_node fNode, engraving::FiguredBass* figuredBas
 bool MeiImporter::readFb(pugi::xml_node harmNode, Measure* measure)
 {
     // Already checked in MeiImporter::readControlEvents
-    pugi::xml_node fbNode = harmNode.select_node("./fb").node();
+    static const pugi::xpath_query fbQuery("./fb");
+    pugi::xml_node fbNode = harmNode.select_node(fbQuery).node();
 
     IF_ASSERT_FAILED(fbNode && measure) {
         return false;
@@ -2442,7 +2456,8 @@ bool MeiImporter::readFb(pugi::xml_node harmNode, Measure* measure)
 
     bool success = true;
 
-    pugi::xpath_node_set fs = fbNode.select_nodes("./f");
+    static const pugi::xpath_query fQuery("./f");
+    pugi::xpath_node_set fs = fbNode.select_nodes(fQuery);
     for (pugi::xpath_node xpathNode : fs) {
         success = success && this->readF(xpathNode.node(), figuredBass);
     }
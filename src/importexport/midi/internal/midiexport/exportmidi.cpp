@@ -247,11 +247,22 @@ bool ExportMidi::write(QIODevice* device, bool midiExpandRepeats, bool exportRPN
 
     writeHeader(context);
 
+    if (m_midiFile.writeHeader(device)) {
+        return false;
+    }
+
     staff_idx_t staffIdx = 0;
     for (auto& track: tracks) {
         Staff* staff = m_score->staff(staffIdx);
         Part* part   = staff->part();
 
+        staff_idx_t equivalentStaffIdx = staffIdx;
+        for (Staff* st : m_score->masterScore()->staves()) {
+            if (staff->id() == st->id()) {
+                equivalentStaffIdx = st->idx();
+            }
+        }
+
         track.setOutPort(part->midiPort());
         track.setOutChannel(part->midiChannel());
 
@@ -320,13 +331,6 @@ bool ExportMidi::write(QIODevice* device, bool midiExpandRepeats, bool exportRPN
                                                                                                 event.pitch(), 0));
                         }
 
-                        staff_idx_t equivalentStaffIdx = staffIdx;
-                        for (Staff* st : m_score->masterScore()->staves()) {
-                            if (staff->id() == st->id()) {
-                                equivalentStaffIdx = st->idx();
-                            }
-                        }
-
                         if (event.getOriginatingStaff() != equivalentStaffIdx) {
                             continue;
                         }
@@ -403,9 +407,17 @@ bool ExportMidi::write(QIODevice* device, bool midiExpandRepeats, bool exportRPN
                 }
             }
         }
+
+        // write the track as soon as it is complete and release its events,
+        // so only one track is held in memory at a time
+        if (m_midiFile.writeTrack(track)) {
+            return false;
+        }
+        track.events().clear();
+
         ++staffIdx;
     }
-    return !m_midiFile.write(device);
+    return true;
 }
 
 bool ExportMidi::write(const QString& name, bool midiExpandRepeats, bool exportRPNs, const SynthesizerState& synthState)
@@ -227,6 +227,7 @@ double findMatchRank(const std::set<ReducedFraction>& beatSet,
         saliences.insert({ MidiTempo::time2Tick(e.time, ticksPerSec), e.salience });
     }
     std::vector<ReducedFraction> beatsOfBar;
+    std::vector<std::map<ReducedFraction, double>::const_iterator> beatSaliences;
     double matchFrac = 0;
     int matchCount = 0;
     int beatCount = 0;
@@ -238,14 +239,18 @@ double findMatchRank(const std::set<ReducedFraction>& beatSet,
             beatCount = 0;
             int relationCount = 0;
             int relationMatches = 0;
+            beatSaliences.clear();
+            for (const auto& b: beatsOfBar) {
+                beatSaliences.push_back(saliences.find(b));
+            }
             for (size_t i = 0; i != beatsOfBar.size() - 1; ++i) {
-                const auto s1 = saliences.find(beatsOfBar[i]);
+                const auto s1 = beatSaliences[i];
                 for (size_t j = i + 1; j != beatsOfBar.size(); ++j) {
                     ++relationCount;              // before s1 search check
                     if (s1 == saliences.end()) {
                         continue;
                     }
-                    const auto s2 = saliences.find(beatsOfBar[j]);
+                    const auto s2 = beatSaliences[j];
                     if (s2 == saliences.end()) {
                         continue;
                     }
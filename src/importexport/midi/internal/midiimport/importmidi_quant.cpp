@@ -1101,6 +1101,10 @@ void applyDynamicProgramming(std::vector<QuantData>& quantData)
 
     for (size_t chordIndex = 0; chordIndex != quantData.size(); ++chordIndex) {
         QuantData& d = quantData[chordIndex];
+        size_t prevEarlierEnd = 0;
+        double prevEarlierMinPenalty = std::numeric_limits<double>::max();
+        int prevEarlierMinPos = -1;
+
         for (size_t pos = 0; pos != d.positions.size(); ++pos) {
             QuantPos& p = d.positions[pos];
 
@@ -1125,27 +1129,30 @@ void applyDynamicProgramming(std::vector<QuantData>& quantData)
                 continue;
             }
 
+            // positions of the previous chord are sorted by time, so the candidates
+            // earlier than p form a prefix: extend its running minimum instead of
+            // rescanning all previous positions for every position of this chord
             const QuantData& dPrev = quantData[chordIndex - 1];
-            double minPenalty = std::numeric_limits<double>::max();
-            int minPos = -1;
-
-            for (size_t posPrev = 0; posPrev != dPrev.positions.size(); ++posPrev) {
-                const QuantPos& pPrev = dPrev.positions[posPrev];
-                if (pPrev.time > p.time) {
-                    continue;
+            while (prevEarlierEnd != dPrev.positions.size()
+                   && dPrev.positions[prevEarlierEnd].time < p.time) {
+                const QuantPos& pPrev = dPrev.positions[prevEarlierEnd];
+                if (pPrev.penalty < prevEarlierMinPenalty) {
+                    prevEarlierMinPenalty = pPrev.penalty;
+                    prevEarlierMinPos = static_cast<int>(prevEarlierEnd);
                 }
+                ++prevEarlierEnd;
+            }
 
-                double penalty = pPrev.penalty;
-                if (pPrev.time == p.time) {
-                    if (!d.canMergeWithPrev) {
-                        continue;
-                    }
-                    penalty += d.quant.toDouble() * MERGE_PENALTY_COEFF;
-                }
+            double minPenalty = prevEarlierMinPenalty;
+            int minPos = prevEarlierMinPos;
 
+            if (d.canMergeWithPrev && prevEarlierEnd != dPrev.positions.size()
+                && dPrev.positions[prevEarlierEnd].time == p.time) {
+                const double penalty = dPrev.positions[prevEarlierEnd].penalty
+                                       + d.quant.toDouble() * MERGE_PENALTY_COEFF;
                 if (penalty < minPenalty) {
                     minPenalty = penalty;
-                    minPos = static_cast<int>(posPrev);
+                    minPos = static_cast<int>(prevEarlierEnd);
                 }
             }
 
@@ -91,12 +91,9 @@ MidiFile::MidiFile()
 
 bool MidiFile::write(QIODevice* out)
 {
-    fp = out;
-    write("MThd", 4);
-    writeLong(6);                   // header len
-    writeShort(_format);            // format
-    writeShort(static_cast<int>(_tracks.size()));
-    writeShort(_division);
+    if (writeHeader(out)) {
+        return true;
+    }
     for (const auto& t: _tracks) {
         if (writeTrack(t)) {
             return true;
@@ -105,6 +102,26 @@ bool MidiFile::write(QIODevice* out)
     return false;
 }
 
+//---------------------------------------------------------
+//   writeHeader
+//    write the header chunk for all tracks to out,
+//    the tracks follow with writeTrack()
+//    returns true on error
+//---------------------------------------------------------
+
+bool MidiFile::writeHeader(QIODevice* out)
+{
+    fp = out;
+    if (write("MThd", 4)) {
+        return true;
+    }
+    writeLong(6);                   // header len
+    writeShort(_format);            // format
+    writeShort(static_cast<int>(_tracks.size()));
+    writeShort(_division);
+    return false;
+}
+
 //---------------------------------------------------------
 //   write
 //---------------------------------------------------------
@@ -96,7 +96,6 @@ protected:
     bool write(const void*, qint64);
     void writeShort(int);
     void writeLong(int);
-    bool writeTrack(const MidiTrack&);
     void putvl(unsigned);
     void put(unsigned char c) { write(&c, 1); }
     void writeStatus(int type, int channel);
@@ -115,6 +114,8 @@ public:
     MidiFile();
     bool read(QIODevice*);
     bool write(QIODevice*);
+    bool writeHeader(QIODevice*);
+    bool writeTrack(const MidiTrack&);
 
     std::vector<MidiTrack>& tracks() { return _tracks; }
     const std::vector<MidiTrack>& tracks() const { return _tracks; }
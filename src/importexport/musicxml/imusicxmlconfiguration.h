@@ -64,5 +64,12 @@ public:
     virtual bool inferTextType() const = 0;
     virtual void setInferTextType(bool value) = 0;
     virtual void setInferTextTypeOverride(std::optional<bool> value) = 0;
+
+    enum class MusicXmlValidationMode {
+        Always, OnImportError, Never
+    };
+
+    virtual MusicXmlValidationMode validationMode() const = 0;
+    virtual void setValidationMode(MusicXmlValidationMode mode) = 0;
 };
 }
@@ -273,6 +273,23 @@ private:
     bool m_technicalPrinted = false;
 };
 
+//---------------------------------------------------------
+//   spanner index -- exportable spanners of a score,
+//   looked up by chord/rest and by end tick
+//---------------------------------------------------------
+
+class SpannerIndex
+{
+public:
+    void build(const Score* score);
+    const std::vector<const Slur*>& slurs(const ChordRest* chordRest) const;
+    const std::vector<const Spanner*>& spannersEndingAt(const Fraction& tick2) const;
+
+private:
+    std::unordered_map<const EngravingItem*, std::vector<const Slur*> > m_slurs;
+    std::unordered_map<int, std::vector<const Spanner*> > m_spannersByTick2;
+};
+
 //---------------------------------------------------------
 //   slur handler -- prints <slur> tags
 //---------------------------------------------------------
@@ -281,7 +298,7 @@ class SlurHandler
 {
 public:
     SlurHandler();
-    void doSlurs(const ChordRest* chordRest, Notations& notations, XmlWriter& xml);
+    void doSlurs(const ChordRest* chordRest, const SpannerIndex& spanners, Notations& notations, XmlWriter& xml);
 
 private:
     void doSlurStart(const Slur* s, Notations& notations, XmlWriter& xml);
@@ -395,6 +412,7 @@ public:
     double getTenthsFromInches(double) const;
     double getTenthsFromDots(double) const;
     Fraction tick() const { return m_tick; }
+    const SpannerIndex& spannerIndex() const { return m_spannerIndex; }
     void writeInstrumentChange(const InstrumentChange* instrChange);
     void writeInstrumentDetails(const Instrument* instrument, const bool concertPitch);
 
@@ -467,6 +485,7 @@ private:
     TrillHash m_trillStart;
     TrillHash m_trillStop;
     MusicXmlInstrumentMap m_instrMap;
+    SpannerIndex m_spannerIndex;
 };
 
 //---------------------------------------------------------
@@ -873,30 +892,25 @@ static const ChordRest* findFirstChordRest(const Slur* s)
 //   doSlurs
 //---------------------------------------------------------
 
-void SlurHandler::doSlurs(const ChordRest* chordRest, Notations& notations, XmlWriter& xml)
+void SlurHandler::doSlurs(const ChordRest* chordRest, const SpannerIndex& spanners, Notations& notations, XmlWriter& xml)
 {
-    // loop over all slurs twice, first to handle the stops, then the starts
+    // slur(s) starting or stopping at this chord
+    const std::vector<const Slur*>& slurs = spanners.slurs(chordRest);
+
+    // loop over the slurs twice, first to handle the stops, then the starts
     for (int i = 0; i < 2; ++i) {
-        // search for slur(s) starting or stopping at this chord
-        for (const auto& it : chordRest->score()->spanner()) {
-            auto sp = it.second;
-            if (sp->generated() || sp->type() != ElementType::SLUR || !ExportMusicXml::canWrite(sp)) {
-                continue;
-            }
-            if (chordRest == sp->startElement() || chordRest == sp->endElement()) {
-                const Slur* s = static_cast<const Slur*>(sp);
-                const ChordRest* firstChordRest = findFirstChordRest(s);
-                if (firstChordRest) {
-                    if (i == 0) {
-                        // first time: do slur stops
-                        if (firstChordRest != chordRest) {
-                            doSlurStop(s, notations, xml);
-                        }
-                    } else {
-                        // second time: do slur starts
-                        if (firstChordRest == chordRest) {
-                            doSlurStart(s, notations, xml);
-                        }
+        for (const Slur* s : slurs) {
+            const ChordRest* firstChordRest = findFirstChordRest(s);
+            if (firstChordRest) {
+                if (i == 0) {
+                    // first time: do slur stops
+                    if (firstChordRest != chordRest) {
+                        doSlurStop(s, notations, xml);
+                    }
+                } else {
+                    // second time: do slur starts
+                    if (firstChordRest == chordRest) {
+                        doSlurStart(s, notations, xml);
                     }
                 }
             }
@@ -4378,7 +4392,7 @@ void ExportMusicXml::chord(Chord* chord, staff_idx_t staff, const std::vector<Ly
                 tupletStartStop(chord, notations, m_xml);
             }
 
-            m_sh.doSlurs(chord, notations, m_xml);
+            m_sh.doSlurs(chord, m_spannerIndex, notations, m_xml);
 
             chordAttributes(chord, notations, technical, m_trillStart, m_trillStop);
         }
@@ -4574,7 +4588,7 @@ void ExportMusicXml::rest(Rest* rest, staff_idx_t staff, const std::vector<Lyric
 
     writeNotationSymbols(m_xml, notations, rest->el(), false);
 
-    m_sh.doSlurs(rest, notations, m_xml);
+    m_sh.doSlurs(rest, m_spannerIndex, notations, m_xml);
 
     tupletStartStop(rest, notations, m_xml);
     notations.etag(m_xml);
@@ -6808,14 +6822,8 @@ static void spannerStart(ExportMusicXml* exp, track_idx_t strack, track_idx_t et
 static void spannerStop(ExportMusicXml* exp, track_idx_t strack, track_idx_t etrack, const Fraction& tick2, staff_idx_t sstaff,
                         std::set<const Spanner*>& stopped)
 {
-    for (auto it : exp->score()->spanner()) {
-        const Spanner* e = it.second;
-
-        if (!exp->canWrite(e)) {
-            continue;
-        }
-
-        if (e->tick2() != tick2 || e->track() < strack || e->track() >= etrack) {
+    for (const Spanner* e : exp->spannerIndex().spannersEndingAt(tick2)) {
+        if (e->track() < strack || e->track() >= etrack) {
             continue;
         }
 
@@ -8430,6 +8438,7 @@ void ExportMusicXml::write(muse::io::IODevice* dev)
     }
 
     m_jumpElements = findJumpElements(m_score);
+    m_spannerIndex.build(m_score);
 
     m_xml.setDevice(dev);
     m_xml.startDocument();
@@ -8888,4 +8897,52 @@ bool ExportMusicXml::canWrite(const EngravingItem* e)
 {
     return e->visible() || configuration()->exportInvisibleElements();
 }
+
+//---------------------------------------------------------
+//   SpannerIndex
+//---------------------------------------------------------
+
+/**
+ Collect the exportable spanners of \a score once, so that the per chord/rest
+ lookups while writing the parts don't have to walk the whole spanner map.
+ Within each list, spanners keep the order of the score's spanner map.
+ */
+
+void SpannerIndex::build(const Score* score)
+{
+    m_slurs.clear();
+    m_spannersByTick2.clear();
+
+    for (const auto& it : score->spanner()) {
+        const Spanner* sp = it.second;
+        if (!ExportMusicXml::canWrite(sp)) {
+            continue;
+        }
+
+        m_spannersByTick2[sp->tick2().ticks()].push_back(sp);
+
+        if (sp->generated() || !sp->isSlur()) {
+            continue;
+        }
+        const Slur* s = toSlur(sp);
+        m_slurs[s->startElement()].push_back(s);
+        if (s->endElement() != s->startElement()) {
+            m_slurs[s->endElement()].push_back(s);
+        }
+    }
+}
+
+const std::vector<const Slur*>& SpannerIndex::slurs(const ChordRest* chordRest) const
+{
+    static const std::vector<const Slur*> empty;
+    auto it = m_slurs.find(chordRest);
+    return it != m_slurs.end() ? it->second : empty;
+}
+
+const std::vector<const Spanner*>& SpannerIndex::spannersEndingAt(const Fraction& tick2) const
+{
+    static const std::vector<const Spanner*> empty;
+    auto it = m_spannersByTick2.find(tick2.ticks());
+    return it != m_spannersByTick2.end() ? it->second : empty;
+}
 }
@@ -37,6 +37,8 @@
 #include "engraving/dom/score.h"
 #include "engraving/engravingerrors.h"
 
+#include "importexport/musicxml/imusicxmlconfiguration.h"
+
 #include "importmusicxml.h"
 #include "importmusicxmllogger.h"
 #include "importmusicxmlpass1.h"
@@ -92,15 +94,20 @@ Err importMusicXmlfromBuffer(Score* score, const String& /*name*/, const ByteArr
     //logger.setLoggingLevel(MusicXmlLogger::Level::MXML_INFO);
     //logger.setLoggingLevel(MusicXmlLogger::Level::MXML_TRACE); // also include tracing
 
+    //! NOTE The document is tokenized once, both passes replay the tokens of the snapshot.
+    //! If it can't be made (e.g. a malformed document), the passes parse the data and report the errors
+    const ByteArray snapshot = XmlStreamReader::makeSnapshot(data);
+    const bool useSnapshot = !snapshot.empty();
+
     // pass 1
     MusicXmlParserPass1 pass1(score, &logger);
-    Err res = pass1.parse(data);
+    Err res = useSnapshot ? pass1.parseSnapshot(snapshot) : pass1.parse(data);
     const String pass1_errors = pass1.errors();
 
     // pass 2
     MusicXmlParserPass2 pass2(score, pass1, &logger);
     if (res == Err::NoError) {
-        res = pass2.parse(data);
+        res = useSnapshot ? pass2.parseSnapshot(snapshot) : pass2.parse(data);
     }
 
     for (const Part* part : score->parts()) {
@@ -186,6 +193,16 @@ static bool extractRootfile(const String& name, ByteArray& data)
     return true;
 }
 
+//---------------------------------------------------------
+//   musicXmlValidationMode
+//---------------------------------------------------------
+
+static IMusicXmlConfiguration::MusicXmlValidationMode musicXmlValidationMode()
+{
+    auto conf = modularity::globalIoc()->resolve<IMusicXmlConfiguration>("iex_musicxml");
+    return conf ? conf->validationMode() : IMusicXmlConfiguration::MusicXmlValidationMode::Always;
+}
+
 //---------------------------------------------------------
 //   doValidateAndImport
 //---------------------------------------------------------
@@ -198,7 +215,10 @@ static Err doValidateAndImport(Score* score, const String& name, const ByteArray
 {
     Err res;
 
-    if (!forceMode) {
+    using ValidationMode = IMusicXmlConfiguration::MusicXmlValidationMode;
+    const ValidationMode mode = forceMode ? ValidationMode::Never : musicXmlValidationMode();
+
+    if (mode == ValidationMode::Always) {
         // Validate the file
         res = MusicXmlValidation::validate(name, data);
         if (res != Err::NoError) {
@@ -209,6 +229,12 @@ static Err doValidateAndImport(Score* score, const String& name, const ByteArray
     // actually do the import
     res = importMusicXmlfromBuffer(score, name, data);
     //LOGD("res %d", static_cast<int>(res));
+
+    if (res != Err::NoError && res != Err::UserAbort && mode == ValidationMode::OnImportError) {
+        // the schema errors usually explain why the import failed
+        MusicXmlValidation::logValidationErrors(name, data);
+    }
+
     return res;
 }
 
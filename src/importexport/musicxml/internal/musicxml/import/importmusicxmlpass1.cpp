@@ -1240,8 +1240,33 @@ static void fixupSigmap(MusicXmlLogger* logger, Score* score, const std::vector<
 Err MusicXmlParserPass1::parse(const ByteArray& data)
 {
     m_logger->logDebugTrace(u"MusicXmlParserPass1::parse device");
-    m_parts.clear();
     m_e.setData(data);
+    return parseAndCreateMeasures();
+}
+
+//---------------------------------------------------------
+//   parseSnapshot
+//---------------------------------------------------------
+
+/**
+ Parse MusicXML from the token snapshot \a snapshot (see XmlStreamReader::makeSnapshot())
+ and extract pass 1 data.
+ */
+
+Err MusicXmlParserPass1::parseSnapshot(const ByteArray& snapshot)
+{
+    m_logger->logDebugTrace(u"MusicXmlParserPass1::parse snapshot");
+    m_e.setSnapshot(snapshot);
+    return parseAndCreateMeasures();
+}
+
+//---------------------------------------------------------
+//   parseAndCreateMeasures
+//---------------------------------------------------------
+
+Err MusicXmlParserPass1::parseAndCreateMeasures()
+{
+    m_parts.clear();
     Err res = parse();
     if (res != Err::NoError) {
         return res;
@@ -138,6 +138,7 @@ public:
     MusicXmlParserPass1(engraving::Score* score, MusicXmlLogger* logger);
     void initPartState(const muse::String& partId);
     engraving::Err parse(const muse::ByteArray& data);
+    engraving::Err parseSnapshot(const muse::ByteArray& snapshot);
     engraving::Err parse();
     muse::String errors() const { return m_errors; }
     void scorePartwise();
@@ -216,6 +217,7 @@ public:
 
 private:
     // functions
+    engraving::Err parseAndCreateMeasures();
     void addError(const muse::String& error);        // Add an error to be shown in the GUI
     void setExporterSoftware(muse::String& exporter);
 
@@ -1862,6 +1862,21 @@ Err MusicXmlParserPass2::parse(const ByteArray& data)
     return res;
 }
 
+//---------------------------------------------------------
+//   parseSnapshot
+//---------------------------------------------------------
+
+/**
+ Parse MusicXML from the token snapshot \a snapshot (see XmlStreamReader::makeSnapshot())
+ and extract pass 2 data.
+ */
+
+Err MusicXmlParserPass2::parseSnapshot(const ByteArray& snapshot)
+{
+    m_e.setSnapshot(snapshot);
+    return parse();
+}
+
 //---------------------------------------------------------
 //   parse
 //---------------------------------------------------------
@@ -1951,6 +1966,9 @@ void MusicXmlParserPass2::scorePartwise()
 {
     while (m_e.readNextStartElement()) {
         if (m_e.name() == "part") {
+            //! NOTE Parts are imported one after another on purpose: all parts add their elements
+            //! to the same measures and segments, and spanners, ties and system elements
+            //! cross parts, so importing parts concurrently would race on the score
             part();
         } else if (m_e.name() == "part-list") {
             partList();
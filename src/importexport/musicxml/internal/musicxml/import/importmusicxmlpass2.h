@@ -401,6 +401,7 @@ class MusicXmlParserPass2
 public:
     MusicXmlParserPass2(engraving::Score* score, MusicXmlParserPass1& pass1, MusicXmlLogger* logger);
     engraving::Err parse(const muse::ByteArray& data);
+    engraving::Err parseSnapshot(const muse::ByteArray& snapshot);
     muse::String errors() const { return m_errors; }
 
     // part specific data interface functions
@@ -32,6 +32,10 @@ Err MusicXmlValidation::validate(const muse::String&, const muse::ByteArray&)
     return Err::NoError;
 }
 
+void MusicXmlValidation::logValidationErrors(const muse::String&, const muse::ByteArray&)
+{
+}
+
 #else
 
 #include <QAbstractMessageHandler>
@@ -174,7 +178,12 @@ static int musicXmlValidationErrorDialog(QString text, QString detailedText)
     return errorDialog.exec();
 }
 
-Err MusicXmlValidation::validate(const String& name, const muse::ByteArray& data)
+//---------------------------------------------------------
+//   validateSchema
+//    return Err::FileBadFormat if the schema could not be loaded
+//---------------------------------------------------------
+
+static Err validateSchema(const String& name, const muse::ByteArray& data, bool& valid, QString& errors)
 {
     //QElapsedTimer t;
     //t.start();
@@ -189,16 +198,29 @@ Err MusicXmlValidation::validate(const String& name, const muse::ByteArray& data
     // validate the data
     QXmlSchemaValidator validator(schema);
     const QByteArray qdata = data.toQByteArrayNoCopy();
-    bool valid = validator.validate(qdata, QUrl::fromLocalFile(name));
+    valid = validator.validate(qdata, QUrl::fromLocalFile(name));
+    errors = messageHandler.getErrors();
     //LOGD("Validation time elapsed: %d ms", t.elapsed());
 
+    return Err::NoError;
+}
+
+Err MusicXmlValidation::validate(const String& name, const muse::ByteArray& data)
+{
+    bool valid = true;
+    QString errors;
+    Err res = validateSchema(name, data, valid, errors);
+    if (res != Err::NoError) {
+        return res;
+    }
+
     if (!valid) {
         LOGD("importMusicXml() file '%s' is not a valid MusicXML file", muPrintable(name));
         QString strErr = muse::qtrc("iex_musicxml", "File “%1” is not a valid MusicXML file.").arg(name);
         if (MScore::noGui) {
             return Err::NoError;         // might as well try anyhow in converter mode
         }
-        if (musicXmlValidationErrorDialog(strErr, messageHandler.getErrors()) != QMessageBox::Yes) {
+        if (musicXmlValidationErrorDialog(strErr, errors) != QMessageBox::Yes) {
             return Err::UserAbort;
         }
     }
@@ -206,4 +228,22 @@ Err MusicXmlValidation::validate(const String& name, const muse::ByteArray& data
     return Err::NoError;
 }
 
+//---------------------------------------------------------
+//   logValidationErrors
+//---------------------------------------------------------
+
+/**
+ Validate \a data and log the schema errors, without asking the user anything.
+ Used to explain a failed import when validation was skipped up front.
+ */
+
+void MusicXmlValidation::logValidationErrors(const String& name, const muse::ByteArray& data)
+{
+    bool valid = true;
+    QString errors;
+    if (validateSchema(name, data, valid, errors) == Err::NoError && !valid) {
+        LOGW() << "file " << name << " is not a valid MusicXML file:\n" << errors.toStdString();
+    }
+}
+
 #endif // MUSICXML_NO_VALIDATION
@@ -31,5 +31,6 @@ class MusicXmlValidation
 public:
 
     static engraving::Err validate(const muse::String& name, const muse::ByteArray& data);
+    static void logValidationErrors(const muse::String& name, const muse::ByteArray& data);
 };
 }
@@ -39,6 +39,7 @@ static const Settings::Key MUSICXML_EXPORT_INVISIBLE_ELEMENTS_KEY(module_name, "
 static const Settings::Key MIGRATION_APPLY_EDWIN_FOR_XML(module_name, "import/compatibility/apply_edwin_for_xml");
 static const Settings::Key MIGRATION_NOT_ASK_AGAIN_KEY(module_name, "import/compatibility/do_not_ask_me_again");
 static const Settings::Key MUSICXML_IMPORT_INFER_TEXT_TYPE(module_name, "import/musicXml/importInferTextType");
+static const Settings::Key MUSICXML_IMPORT_VALIDATION_MODE_KEY(module_name, "import/musicXml/validationMode");
 
 void MusicXmlConfiguration::init()
 {
@@ -59,6 +60,11 @@ void MusicXmlConfiguration::init()
     settings()->setDefaultValue(MIGRATION_APPLY_EDWIN_FOR_XML, Val(false));
     settings()->setDefaultValue(MIGRATION_NOT_ASK_AGAIN_KEY, Val(false));
     settings()->setDefaultValue(MUSICXML_IMPORT_INFER_TEXT_TYPE, Val(false));
+    settings()->setDefaultValue(MUSICXML_IMPORT_VALIDATION_MODE_KEY, Val(MusicXmlValidationMode::Always));
+    settings()->setDescription(MUSICXML_IMPORT_VALIDATION_MODE_KEY,
+                               //: 0: always validate, 1: validate only when the import fails, 2: never validate
+                               muse::trc("iex_musicxml", "Validate imported MusicXML files against the schema"));
+    settings()->setCanBeManuallyEdited(MUSICXML_IMPORT_VALIDATION_MODE_KEY, true);
 }
 
 bool MusicXmlConfiguration::importBreaks() const
@@ -168,3 +174,13 @@ void MusicXmlConfiguration::setInferTextTypeOverride(std::optional<bool> value)
 {
     m_inferTextTypeOverride = value;
 }
+
+MusicXmlConfiguration::MusicXmlValidationMode MusicXmlConfiguration::validationMode() const
+{
+    return settings()->value(MUSICXML_IMPORT_VALIDATION_MODE_KEY).toEnum<MusicXmlValidationMode>();
+}
+
+void MusicXmlConfiguration::setValidationMode(MusicXmlValidationMode mode)
+{
+    settings()->setSharedValue(MUSICXML_IMPORT_VALIDATION_MODE_KEY, Val(mode));
+}
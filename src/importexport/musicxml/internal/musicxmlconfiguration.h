@@ -58,6 +58,9 @@ public:
     void setInferTextType(bool value) override;
     void setInferTextTypeOverride(std::optional<bool> value) override;
 
+    MusicXmlValidationMode validationMode() const override;
+    void setValidationMode(MusicXmlValidationMode mode) override;
+
 private:
     std::optional<bool> m_needUseDefaultFontOverride;
     std::optional<bool> m_inferTextTypeOverride;
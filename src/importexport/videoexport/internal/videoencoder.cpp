@@ -75,6 +75,7 @@ VideoEncoder::VideoEncoder()
 
 VideoEncoder::~VideoEncoder()
 {
+    stopEncodingThread();
     delete m_ffmpeg;
 }
 
@@ -254,6 +255,8 @@ bool VideoEncoder::open(const muse::io::path_t& fileName, unsigned width, unsign
 
 void VideoEncoder::close()
 {
+    stopEncodingThread();
+
     if (!m_ffmpeg->opened) {
         return;
     }
@@ -447,3 +450,62 @@ bool VideoEncoder::convertImage_sws(const QImage& img)
 
     return true;
 }
+
+bool VideoEncoder::queueImage(const QImage& img)
+{
+    //! NOTE A few frames are enough to keep the encoder busy while the next one is painted
+    constexpr size_t MAX_QUEUED_IMAGES = 4;
+
+    if (!m_ffmpeg->opened) {
+        return false;
+    }
+
+    if (!m_encodingThread.joinable()) {
+        m_stopEncoding = false;
+        m_encodingThread = std::thread(&VideoEncoder::encodingLoop, this);
+    }
+
+    std::unique_lock lock(m_queueMutex);
+    m_queueChanged.wait(lock, [this]() { return m_queue.size() < MAX_QUEUED_IMAGES; });
+
+    m_queue.push_back(img);
+    m_queueChanged.notify_all();
+
+    return true;
+}
+
+void VideoEncoder::encodingLoop()
+{
+    while (true) {
+        QImage img;
+        {
+            std::unique_lock lock(m_queueMutex);
+            m_queueChanged.wait(lock, [this]() { return !m_queue.empty() || m_stopEncoding; });
+
+            if (m_queue.empty()) {
+                return;
+            }
+
+            img = std::move(m_queue.front());
+            m_queue.pop_front();
+        }
+        m_queueChanged.notify_all();
+
+        encodeImage(img);
+    }
+}
+
+void VideoEncoder::stopEncodingThread()
+{
+    if (!m_encodingThread.joinable()) {
+        return;
+    }
+
+    {
+        std::lock_guard lock(m_queueMutex);
+        m_stopEncoding = true;
+    }
+    m_queueChanged.notify_all();
+
+    m_encodingThread.join();
+}
@@ -22,6 +22,11 @@
 #ifndef MU_IMPORTEXPORT_VIDEOENCODER_H
 #define MU_IMPORTEXPORT_VIDEOENCODER_H
 
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
 #include <QImage>
 
 #include "io/path.h"
@@ -39,11 +44,23 @@ public:
 
     bool encodeImage(const QImage& img);
 
+    //! NOTE Encodes the image on the encoding thread, so the next image can be painted meanwhile.
+    //! Blocks while the queue of images to encode is full. close() waits for the queued images
+    bool queueImage(const QImage& img);
+
 private:
 
     bool convertImage_sws(const QImage& img);
+    void encodingLoop();
+    void stopEncodingThread();
 
     FFmpeg* m_ffmpeg = nullptr;
+
+    std::thread m_encodingThread;
+    std::mutex m_queueMutex;
+    std::condition_variable m_queueChanged;
+    std::deque<QImage> m_queue;
+    bool m_stopEncoding = false;
 };
 }
 
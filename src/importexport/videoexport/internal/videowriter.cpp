@@ -177,19 +177,36 @@ muse::Ret VideoWriter::generatePagedOriginalVideo(INotationProjectPtr project, c
     score->update();
 
     // Setup painting
-    QImage frame(config.width, config.height, QImage::Format_RGB32);
-    frame.setDotsPerMeterX(std::lrint((CANVAS_DPI * 1000) / engraving::INCH));
-    frame.setDotsPerMeterY(std::lrint((CANVAS_DPI * 1000) / engraving::INCH));
+    //! NOTE The page is painted once into pageImage, every frame is a copy of it with the cursor on top
+    QImage pageImage(config.width, config.height, QImage::Format_RGB32);
+    pageImage.setDotsPerMeterX(std::lrint((CANVAS_DPI * 1000) / engraving::INCH));
+    pageImage.setDotsPerMeterY(std::lrint((CANVAS_DPI * 1000) / engraving::INCH));
+    muse::RectF frameRect = muse::RectF::fromQRectF(QRectF(pageImage.rect()));
 
-    QPainter qp(&frame);
-    qp.setRenderHint(QPainter::Antialiasing, true);
-    qp.setRenderHint(QPainter::TextAntialiasing, true);
-    muse::RectF frameRect = muse::RectF::fromQRectF(QRectF(frame.rect()));
-
-    Painter painter(&qp, "video_writer");
+    // The transform used to paint the page, to paint the cursor in the same coordinates
+    QTransform pageTransform;
+    const Page* paintedPage = nullptr;
 
     auto painting = masterNotation->notation()->painting();
 
+    auto paintPage = [&](const Page* page) {
+        QPainter qp(&pageImage);
+        qp.setRenderHint(QPainter::Antialiasing, true);
+        qp.setRenderHint(QPainter::TextAntialiasing, true);
+
+        Painter painter(&qp, "video_writer");
+        painter.fillRect(frameRect, Color::WHITE);
+
+        INotationPainting::Options opt;
+        opt.fromPage = page->no();
+        opt.toPage = opt.fromPage;
+        opt.deviceDpi = CANVAS_DPI;
+
+        painting->paintPrint(&painter, opt);
+
+        pageTransform = qp.combinedTransform();
+    };
+
     // Setup duration
     INotationPlaybackPtr playback = masterNotation->playback();
     float totalPlayTimeSec = playback->totalPlayTime();
@@ -201,16 +218,19 @@ muse::Ret VideoWriter::generatePagedOriginalVideo(INotationProjectPtr project, c
     //! NOTE: After setting the score above, the number of pages may change - get them again
     pages = masterNotation->notation()->elements()->pages();
 
-    auto pageByTick = [](const PageList& pages, tick_t tick) -> const Page* {
-        for (const Page* p : pages) {
-            if (tick <= static_cast<tick_t>(p->endTick().ticks())) {
-                return p;
-            }
+    //! NOTE The tick mostly grows from frame to frame, so the lookup continues from the last page
+    size_t pageIdx = 0;
+    auto pageByTick = [&pages, &pageIdx](tick_t tick) -> const Page* {
+        if (pageIdx >= pages.size() || (pageIdx > 0 && tick <= static_cast<tick_t>(pages[pageIdx - 1]->endTick().ticks()))) {
+            pageIdx = 0;
+        }
+        while (pageIdx < pages.size() && tick > static_cast<tick_t>(pages[pageIdx]->endTick().ticks())) {
+            ++pageIdx;
         }
-        return nullptr;
+        return pageIdx < pages.size() ? pages[pageIdx] : nullptr;
     };
 
-    const Color CURSOR_COLOR = Color(0, 0, 255, 50);
+    const QColor CURSOR_COLOR = Color(0, 0, 255, 50).toQColor();
 
     PlaybackCursor cursor(application()->iocContext());
     cursor.setNotation(masterNotation->notation());
@@ -227,19 +247,15 @@ muse::Ret VideoWriter::generatePagedOriginalVideo(INotationProjectPtr project, c
 
         tick_t tick = playback->secToTick(currentTimeSec);
 
-        const Page* page = pageByTick(pages, tick);
+        const Page* page = pageByTick(tick);
         if (!page) {
             break;
         }
 
-        INotationPainting::Options opt;
-        opt.fromPage = page->no();
-        opt.toPage = opt.fromPage;
-        opt.deviceDpi = CANVAS_DPI;
-
-        painter.fillRect(frameRect, Color::WHITE);
-
-        painting->paintPrint(&painter, opt);
+        if (page != paintedPage) {
+            paintPage(page);
+            paintedPage = page;
+        }
 
         cursor.move(tick);
 
@@ -247,9 +263,16 @@ muse::Ret VideoWriter::generatePagedOriginalVideo(INotationProjectPtr project, c
         muse::PointF pagePos = page->pos();
         muse::RectF cursorAbsRect = cursorRect.translated(-pagePos);
 
-        painter.fillRect(cursorAbsRect, CURSOR_COLOR);
+        // painting detaches the frame from the page image
+        QImage frame = pageImage;
+        {
+            QPainter qp(&frame);
+            qp.setRenderHint(QPainter::Antialiasing, true);
+            qp.setTransform(pageTransform);
+            qp.fillRect(cursorAbsRect.toQRectF(), CURSOR_COLOR);
+        }
 
-        encoder.encodeImage(frame);
+        encoder.queueImage(frame);
     }
 
     encoder.close();
@@ -639,7 +639,6 @@ void AbstractInspectorModel::loadPropertyItem(PropertyItem* propertyItem, const
         }
 
         QVariant elementCurrentValue = valueFromElementUnits(pid, element->getProperty(pid), element);
-        QVariant elementDefaultValue = valueFromElementUnits(pid, element->propertyDefault(pid), element);
 
         bool isPropertySupportedByElement = elementCurrentValue.isValid();
 
@@ -649,10 +648,17 @@ void AbstractInspectorModel::loadPropertyItem(PropertyItem* propertyItem, const
 
         if (convertElementPropertyValueFunc) {
             elementCurrentValue = convertElementPropertyValueFunc(elementCurrentValue);
-            elementDefaultValue = convertElementPropertyValueFunc(elementDefaultValue);
         }
 
+        //! NOTE: only the first supporting element provides the default value,
+        //! so don't query the defaults of the rest of a large selection
         if (!(propertyValue.isValid() && defaultPropertyValue.isValid())) {
+            QVariant elementDefaultValue = valueFromElementUnits(pid, element->propertyDefault(pid), element);
+
+            if (convertElementPropertyValueFunc) {
+                elementDefaultValue = convertElementPropertyValueFunc(elementDefaultValue);
+            }
+
             propertyValue = elementCurrentValue;
             defaultPropertyValue = elementDefaultValue;
         }
@@ -46,10 +46,34 @@ void InspectorModelWithVoiceAndPositionOptions::createProperties()
 
 void InspectorModelWithVoiceAndPositionOptions::loadProperties()
 {
-    loadPropertyItem(m_voiceBasedPosition);
-    loadPropertyItem(m_voiceAssignment);
-    loadPropertyItem(m_voice);
-    loadPropertyItem(m_centerBetweenStaves);
+    static const PropertyIdSet propertyIdSet {
+        Pid::DIRECTION,
+        Pid::VOICE_ASSIGNMENT,
+        Pid::VOICE,
+        Pid::CENTER_BETWEEN_STAVES,
+    };
+
+    loadProperties(propertyIdSet);
+}
+
+void InspectorModelWithVoiceAndPositionOptions::loadProperties(const PropertyIdSet& propertyIdSet)
+{
+    if (muse::contains(propertyIdSet, Pid::DIRECTION)) {
+        loadPropertyItem(m_voiceBasedPosition);
+    }
+
+    if (muse::contains(propertyIdSet, Pid::VOICE_ASSIGNMENT)) {
+        loadPropertyItem(m_voiceAssignment);
+    }
+
+    if (muse::contains(propertyIdSet, Pid::VOICE)) {
+        loadPropertyItem(m_voice);
+    }
+
+    if (muse::contains(propertyIdSet, Pid::CENTER_BETWEEN_STAVES)) {
+        loadPropertyItem(m_centerBetweenStaves);
+    }
+
     updateIsMultiStaffInstrument();
     updateIsStaveCenteringAvailable();
 }
@@ -62,9 +86,11 @@ void InspectorModelWithVoiceAndPositionOptions::resetProperties()
     m_centerBetweenStaves->resetToDefault();
 }
 
-void InspectorModelWithVoiceAndPositionOptions::onNotationChanged(const PropertyIdSet&, const StyleIdSet&)
+void InspectorModelWithVoiceAndPositionOptions::onNotationChanged(const PropertyIdSet& changedPropertyIdSet, const StyleIdSet&)
 {
-    loadProperties();
+    //! NOTE: reload only the properties touched by the last change, not the whole model,
+    //! the derived models refresh their own properties the same way
+    loadProperties(changedPropertyIdSet);
 }
 
 void InspectorModelWithVoiceAndPositionOptions::updateIsMultiStaffInstrument()
@@ -46,7 +46,7 @@ public:
     void createProperties() override;
     void loadProperties() override;
     void resetProperties() override;
-    void onNotationChanged(const PropertyIdSet&, const StyleIdSet&) override;
+    void onNotationChanged(const PropertyIdSet& changedPropertyIdSet, const StyleIdSet&) override;
 
     PropertyItem* voiceBasedPosition() const;
     PropertyItem* voiceAssignment() const;
@@ -66,6 +66,8 @@ signals:
     void isStaveCenteringAvailableChanged(bool isStaveCenteringAvailable);
 
 private:
+    void loadProperties(const PropertyIdSet& propertyIdSet);
+
     void updateIsMultiStaffInstrument();
     void updateIsStaveCenteringAvailable();
 
@@ -72,18 +72,67 @@ void DynamicsSettingsModel::loadProperties()
 {
     InspectorModelWithVoiceAndPositionOptions::loadProperties();
 
-    loadPropertyItem(m_avoidBarLines);
-    loadPropertyItem(m_dynamicSize, [](const QVariant& elementPropertyValue) -> QVariant {
-        return muse::DataFormatter::roundDouble(elementPropertyValue.toDouble()) * 100;
-    });
-    loadPropertyItem(m_centerOnNotehead);
-
-    loadPropertyItem(m_frameType);
-    loadPropertyItem(m_frameBorderColor);
-    loadPropertyItem(m_frameFillColor);
-    loadPropertyItem(m_frameThickness, formatDoubleFunc);
-    loadPropertyItem(m_frameMargin, formatDoubleFunc);
-    loadPropertyItem(m_frameCornerRadius, formatDoubleFunc);
+    static const PropertyIdSet propertyIdSet {
+        Pid::AVOID_BARLINES,
+        Pid::DYNAMICS_SIZE,
+        Pid::CENTER_ON_NOTEHEAD,
+        Pid::FRAME_TYPE,
+        Pid::FRAME_FG_COLOR,
+        Pid::FRAME_BG_COLOR,
+        Pid::FRAME_WIDTH,
+        Pid::FRAME_PADDING,
+        Pid::FRAME_ROUND,
+    };
+
+    loadProperties(propertyIdSet);
+}
+
+void DynamicsSettingsModel::onNotationChanged(const PropertyIdSet& changedPropertyIdSet, const StyleIdSet& changedStyleIdSet)
+{
+    InspectorModelWithVoiceAndPositionOptions::onNotationChanged(changedPropertyIdSet, changedStyleIdSet);
+
+    loadProperties(changedPropertyIdSet);
+}
+
+void DynamicsSettingsModel::loadProperties(const PropertyIdSet& propertyIdSet)
+{
+    if (muse::contains(propertyIdSet, Pid::AVOID_BARLINES)) {
+        loadPropertyItem(m_avoidBarLines);
+    }
+
+    if (muse::contains(propertyIdSet, Pid::DYNAMICS_SIZE)) {
+        loadPropertyItem(m_dynamicSize, [](const QVariant& elementPropertyValue) -> QVariant {
+            return muse::DataFormatter::roundDouble(elementPropertyValue.toDouble()) * 100;
+        });
+    }
+
+    if (muse::contains(propertyIdSet, Pid::CENTER_ON_NOTEHEAD)) {
+        loadPropertyItem(m_centerOnNotehead);
+    }
+
+    if (muse::contains(propertyIdSet, Pid::FRAME_TYPE)) {
+        loadPropertyItem(m_frameType);
+    }
+
+    if (muse::contains(propertyIdSet, Pid::FRAME_FG_COLOR)) {
+        loadPropertyItem(m_frameBorderColor);
+    }
+
+    if (muse::contains(propertyIdSet, Pid::FRAME_BG_COLOR)) {
+        loadPropertyItem(m_frameFillColor);
+    }
+
+    if (muse::contains(propertyIdSet, Pid::FRAME_WIDTH)) {
+        loadPropertyItem(m_frameThickness, formatDoubleFunc);
+    }
+
+    if (muse::contains(propertyIdSet, Pid::FRAME_PADDING)) {
+        loadPropertyItem(m_frameMargin, formatDoubleFunc);
+    }
+
+    if (muse::contains(propertyIdSet, Pid::FRAME_ROUND)) {
+        loadPropertyItem(m_frameCornerRadius, formatDoubleFunc);
+    }
 
     updateFramePropertiesAvailability();
 }
@@ -48,6 +48,8 @@ public:
     void requestElements() override;
     void loadProperties() override;
     void resetProperties() override;
+    void onNotationChanged(const mu::engraving::PropertyIdSet& changedPropertyIdSet,
+                           const mu::engraving::StyleIdSet& changedStyleIdSet) override;
 
     PropertyItem* avoidBarLines() const;
     PropertyItem* dynamicSize() const;
@@ -61,6 +63,7 @@ public:
     PropertyItem* frameCornerRadius() const;
 
 private:
+    void loadProperties(const mu::engraving::PropertyIdSet& propertyIdSet);
     void updateFramePropertiesAvailability();
 
 private:
@@ -32,6 +32,16 @@ void ExpressionSettingsModel::loadProperties()
     loadPropertyItem(m_snapExpression);
 }
 
+void ExpressionSettingsModel::onNotationChanged(const mu::engraving::PropertyIdSet& changedPropertyIdSet,
+                                                const mu::engraving::StyleIdSet& changedStyleIdSet)
+{
+    InspectorModelWithVoiceAndPositionOptions::onNotationChanged(changedPropertyIdSet, changedStyleIdSet);
+
+    if (muse::contains(changedPropertyIdSet, mu::engraving::Pid::SNAP_TO_DYNAMICS)) {
+        loadPropertyItem(m_snapExpression);
+    }
+}
+
 void ExpressionSettingsModel::resetProperties()
 {
     InspectorModelWithVoiceAndPositionOptions::resetProperties();
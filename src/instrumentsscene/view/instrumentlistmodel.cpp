@@ -21,6 +21,8 @@
  */
 #include "instrumentlistmodel.h"
 
+#include <numeric>
+
 #include "log.h"
 #include "translation.h"
 
@@ -313,28 +315,60 @@ void InstrumentListModel::sortInstruments(Instruments& instruments) const
 {
     TRACEFUNC;
 
-    std::sort(instruments.begin(), instruments.end(), [this](const CombinedInstrument& instrument1, const CombinedInstrument& instrument2) {
-        QString instrumentName1 = instrument1.name.toLower();
-        QString instrumentName2 = instrument2.name.toLower();
-        QString searchText = m_searchText.toLower();
-
-        int searchTextPosition1 = instrumentName1.indexOf(searchText);
-        int searchTextPosition2 = instrumentName2.indexOf(searchText);
-
-        if (searchTextPosition1 == searchTextPosition2) {
-            size_t ti1 = instrument1.currentTemplateIndex;
-            size_t ti2 = instrument2.currentTemplateIndex;
-            if (ti1 < instrument1.templates.size() && ti2 < instrument2.templates.size()) {
-                int instrumentIndex1 = instrument1.templates.at(ti1)->sequenceOrder;
-                int instrumentIndex2 = instrument2.templates.at(ti2)->sequenceOrder;
-                return instrumentIndex1 < instrumentIndex2;
+    //! NOTE The sort keys are computed once per instrument rather than on every comparison,
+    //! the list is re-sorted on each keystroke in the search field
+    struct SortKey {
+        QString lowerName;
+        int searchTextPosition = -1;
+        int sequenceOrder = -1;
+        bool hasTemplate = false;
+    };
+
+    const QString searchText = m_searchText.toLower();
+
+    std::vector<SortKey> keys;
+    keys.reserve(instruments.size());
+
+    for (const CombinedInstrument& instrument : instruments) {
+        SortKey key;
+        key.lowerName = instrument.name.toLower();
+        key.searchTextPosition = key.lowerName.indexOf(searchText);
+
+        size_t ti = instrument.currentTemplateIndex;
+        if (ti < instrument.templates.size()) {
+            key.sequenceOrder = instrument.templates.at(ti)->sequenceOrder;
+            key.hasTemplate = true;
+        }
+
+        keys.push_back(std::move(key));
+    }
+
+    std::vector<size_t> order(keys.size());
+    std::iota(order.begin(), order.end(), 0);
+
+    std::sort(order.begin(), order.end(), [&keys](size_t i1, size_t i2) {
+        const SortKey& key1 = keys[i1];
+        const SortKey& key2 = keys[i2];
+
+        if (key1.searchTextPosition == key2.searchTextPosition) {
+            if (key1.hasTemplate && key2.hasTemplate) {
+                return key1.sequenceOrder < key2.sequenceOrder;
             } else {
-                return instrumentName1 < instrumentName2;
+                return key1.lowerName < key2.lowerName;
             }
         }
 
-        return searchTextPosition1 < searchTextPosition2;
+        return key1.searchTextPosition < key2.searchTextPosition;
     });
+
+    Instruments sorted;
+    sorted.reserve(instruments.size());
+
+    for (size_t i : order) {
+        sorted << std::move(instruments[static_cast<int>(i)]);
+    }
+
+    instruments = std::move(sorted);
 }
 
 void InstrumentListModel::setCurrentGenreIndex(int index)
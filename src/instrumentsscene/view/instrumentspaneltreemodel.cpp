@@ -199,7 +199,12 @@ void InstrumentsPanelTreeModel::setupPartsConnections()
     async::NotifyList<const Part*> notationParts = m_notation->parts()->partList();
 
     notationParts.onChanged(m_partsNotifyReceiver.get(), [this]() {
-        load();
+        //! NOTE The parts list is reported as changed after every undo/redo,
+        //! but most of the time the parts and staves stay the same,
+        //! so refresh the existing items instead of rebuilding the whole tree
+        if (!updateItems()) {
+            load();
+        }
     });
 
     auto updateMasterPartItem = [this](const muse::ID& partId) {
@@ -342,6 +347,67 @@ void InstrumentsPanelTreeModel::load()
     emit isAddingAvailableChanged(true);
 }
 
+bool InstrumentsPanelTreeModel::updateItems()
+{
+    if (m_isLoadingBlocked || !m_rootItem) {
+        return false;
+    }
+
+    async::NotifyList<const Part*> masterParts = m_masterNotation->parts()->partList();
+    sortParts(masterParts);
+
+    if (m_rootItem->childCount() != static_cast<int>(masterParts.size())) {
+        return false;
+    }
+
+    std::vector<async::NotifyList<const Staff*> > masterStaves;
+    masterStaves.reserve(masterParts.size());
+
+    for (size_t i = 0; i < masterParts.size(); ++i) {
+        const AbstractInstrumentsPanelTreeItem* partItem = m_rootItem->childAtRow(static_cast<int>(i));
+        if (!partItem || partItem->id() != masterParts[i]->id()) {
+            return false;
+        }
+
+        async::NotifyList<const Staff*> staves = m_masterNotation->parts()->staffList(partItem->id());
+
+        // the last child is the "Add staff" control
+        if (partItem->childCount() != static_cast<int>(staves.size()) + 1) {
+            return false;
+        }
+
+        for (size_t j = 0; j < staves.size(); ++j) {
+            if (partItem->childAtRow(static_cast<int>(j))->id() != staves[j]->id()) {
+                return false;
+            }
+        }
+
+        masterStaves.push_back(std::move(staves));
+    }
+
+    TRACEFUNC;
+
+    for (size_t i = 0; i < masterParts.size(); ++i) {
+        auto partItem = dynamic_cast<PartTreeItem*>(m_rootItem->childAtRow(static_cast<int>(i)));
+        if (!partItem) {
+            continue;
+        }
+
+        partItem->init(masterParts[i]);
+
+        for (size_t j = 0; j < masterStaves[i].size(); ++j) {
+            auto staffItem = dynamic_cast<StaffTreeItem*>(partItem->childAtRow(static_cast<int>(j)));
+            if (staffItem) {
+                staffItem->init(masterStaves[i][j]);
+            }
+        }
+    }
+
+    updateRemovingAvailability();
+
+    return true;
+}
+
 void InstrumentsPanelTreeModel::sortParts(notation::PartList& parts)
 {
     NotationKey key = notationToKey(m_notation);
@@ -129,6 +129,7 @@ private:
     void onBeforeChangeNotation();
     void setLoadingBlocked(bool blocked);
 
+    bool updateItems();
     void sortParts(notation::PartList& parts);
 
     void setupPartsConnections();
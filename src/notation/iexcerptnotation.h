@@ -38,6 +38,11 @@ public:
     virtual bool isCustom() const = 0;
     virtual bool isEmpty() const = 0;
 
+    //! NOTE While deferred, edits made elsewhere are not laid out in this excerpt
+    //! until it is accessed or undeferred; isLayoutPending() tells whether some are waiting
+    virtual bool isLayoutPending() const = 0;
+    virtual void setLayoutDeferred(bool deferred) = 0;
+
     virtual QString name() const = 0;
     virtual void setName(const QString& name) = 0; // not undoable
     virtual void undoSetName(const QString& name) = 0; // undoable
@@ -147,6 +147,10 @@ public:
     virtual void setIsLimitCanvasScrollArea(bool limited) = 0;
     virtual muse::async::Notification isLimitCanvasScrollAreaChanged() const = 0;
 
+    virtual bool isCanvasHardwareAccelerationEnabled() const = 0;
+    virtual void setIsCanvasHardwareAccelerationEnabled(bool enabled) = 0;
+    virtual muse::async::Notification isCanvasHardwareAccelerationEnabledChanged() const = 0;
+
     virtual bool colorNotesOutsideOfUsablePitchRange() const = 0;
     virtual void setColorNotesOutsideOfUsablePitchRange(bool value) = 0;
 
@@ -46,6 +46,14 @@ public:
     virtual muse::SizeF pageSizeInch(const Options& opt) const = 0;
 
     virtual void paintView(muse::draw::Painter* painter, const muse::RectF& frameRect, bool isPrinting) = 0;
+
+    //! NOTE paintView split in two parts: the score itself (can be cached) and the interaction overlays on top of it
+    virtual void paintViewScore(muse::draw::Painter* painter, const muse::RectF& frameRect, bool isPrinting) = 0;
+    virtual void paintViewInteraction(muse::draw::Painter* painter, bool isPrinting) = 0;
+
+    //! NOTE The view paints the systems from their recorded display lists, which are rebuilt after layout.
+    //! Should be called on the changes of appearance which don't relayout the score (colors, drop target...)
+    virtual void invalidateDisplayLists() = 0;
     virtual void paintPdf(muse::draw::Painter* painter, const Options& opt) = 0;
     virtual void paintPrint(muse::draw::Painter* painter, const Options& opt) = 0;
     virtual void paintPng(muse::draw::Painter* painter, const Options& opt) = 0;
@@ -23,6 +23,7 @@
 #include "excerptnotation.h"
 
 #include "engraving/dom/excerpt.h"
+#include "engraving/dom/masterscore.h"
 #include "engraving/dom/text.h"
 #include "engraving/dom/undo.h"
 
@@ -48,6 +49,10 @@ void ExcerptNotation::init()
         return;
     }
 
+    if (isDeferred()) {
+        m_excerpt->masterScore()->materializeExcerpt(m_excerpt);
+    }
+
     setScore(m_excerpt->excerptScore());
 
     if (isEmpty()) {
@@ -57,6 +62,11 @@ void ExcerptNotation::init()
     m_inited = true;
 }
 
+void ExcerptNotation::initOnFirstUse()
+{
+    m_initOnFirstUse = true;
+}
+
 void ExcerptNotation::reinit(engraving::Excerpt* newExcerpt)
 {
     m_inited = false;
@@ -79,7 +89,55 @@ bool ExcerptNotation::isCustom() const
 
 bool ExcerptNotation::isEmpty() const
 {
-    return m_excerpt->parts().empty();
+    //! NOTE The parts of a deferred excerpt are not known until it is read
+    return !isDeferred() && m_excerpt->parts().empty();
+}
+
+bool ExcerptNotation::isLayoutPending() const
+{
+    const mu::engraving::Score* score = Notation::score();
+    return score && score->isLayoutPending();
+}
+
+void ExcerptNotation::setLayoutDeferred(bool deferred)
+{
+    mu::engraving::Score* score = Notation::score();
+    if (!score) {
+        return;
+    }
+
+    score->setLayoutDeferred(deferred);
+
+    if (!deferred) {
+        score->doPendingLayout();
+    }
+}
+
+bool ExcerptNotation::isOpen() const
+{
+    //! NOTE The deferred excerpts are the ones that were not open when saved
+    return !isDeferred() && Notation::isOpen();
+}
+
+mu::engraving::Score* ExcerptNotation::score() const
+{
+    //! NOTE A deferred excerpt is read the first time its score is needed (viewed, exported, edited...)
+    if (!m_inited && m_initOnFirstUse) {
+        const_cast<ExcerptNotation*>(this)->init();
+    }
+
+    //! NOTE Whoever needs the score of a deferred excerpt gets it laid out up to date
+    mu::engraving::Score* score = Notation::score();
+    if (score && score->isLayoutPending()) {
+        score->doPendingLayout();
+    }
+
+    return score;
+}
+
+bool ExcerptNotation::isDeferred() const
+{
+    return m_excerpt && m_excerpt->masterScore() && m_excerpt->masterScore()->isExcerptDeferred(m_excerpt);
 }
 
 void ExcerptNotation::fillWithDefaultInfo()
@@ -122,6 +180,10 @@ QString ExcerptNotation::name() const
 
 void ExcerptNotation::setName(const QString& name)
 {
+    if (isDeferred()) {
+        init();
+    }
+
     bool changed = name != this->name();
     m_excerpt->setName(name);
 
@@ -172,6 +234,10 @@ INotationPtr ExcerptNotation::notation()
 
 IExcerptNotationPtr ExcerptNotation::clone() const
 {
+    if (isDeferred()) {
+        m_excerpt->masterScore()->materializeExcerpt(m_excerpt);
+    }
+
     mu::engraving::Excerpt* copy = new mu::engraving::Excerpt(*m_excerpt);
     copy->markAsCustom();
 
@@ -35,6 +35,8 @@ public:
     ~ExcerptNotation() override;
 
     void init();
+    //! NOTE For an excerpt whose reading was deferred at load (see MasterScore::deferredExcerpts)
+    void initOnFirstUse();
     void reinit(engraving::Excerpt* newExcerpt);
 
     engraving::Excerpt* excerpt() const;
@@ -43,6 +45,12 @@ public:
     bool isCustom() const override;
     bool isEmpty() const override;
 
+    bool isLayoutPending() const override;
+    void setLayoutDeferred(bool deferred) override;
+
+    bool isOpen() const override;
+    mu::engraving::Score* score() const override;
+
     QString name() const override;
     void setName(const QString& name) override;
     void undoSetName(const QString& name) override;
@@ -55,10 +63,12 @@ public:
     IExcerptNotationPtr clone() const override;
 
 private:
+    bool isDeferred() const;
     void fillWithDefaultInfo();
 
     mu::engraving::Excerpt* m_excerpt = nullptr;
     bool m_inited = false;
+    bool m_initOnFirstUse = false;
 };
 }
 
@@ -622,7 +622,11 @@ void MasterNotation::setExcerptIsOpen(const INotationPtr excerptNotation, bool o
     excerptNotation->setIsOpen(open);
 
     if (open) {
-        excerptNotation->elements()->msScore()->doLayout();
+        //! NOTE The excerpt is laid out when it becomes the current notation (see GlobalContext)
+        //! or when its score is first requested, not while opening several parts at once
+        mu::engraving::Score* score = excerptNotation->elements()->msScore();
+        score->setLayoutDeferred(true);
+        score->doLayoutOrPostpone();
     }
 }
 
@@ -654,7 +658,7 @@ void MasterNotation::updateExcerpts()
     for (IExcerptNotationPtr excerptNotation : m_excerpts) {
         ExcerptNotation* impl = get_impl(excerptNotation);
 
-        if (muse::contains(excerpts, impl->excerpt())) {
+        if (muse::contains(excerpts, impl->excerpt()) || masterScore()->isExcerptDeferred(impl->excerpt())) {
             updatedExcerpts.push_back(excerptNotation);
             continue;
         }
@@ -669,7 +673,9 @@ void MasterNotation::updateExcerpts()
         IExcerptNotationPtr excerptNotation = createAndInitExcerptNotation(excerpt, iocContext());
         bool open = excerpt->excerptScore()->isOpen();
         if (open) {
-            excerptNotation->notation()->elements()->msScore()->doLayout();
+            mu::engraving::Score* score = excerptNotation->notation()->elements()->msScore();
+            score->setLayoutDeferred(true);
+            score->doLayoutOrPostpone();
         }
 
         updatedExcerpts.push_back(excerptNotation);
@@ -797,6 +803,13 @@ void MasterNotation::initExcerptNotations(const std::vector<mu::engraving::Excer
         notationExcerpts.push_back(excerptNotation);
     }
 
+    //! NOTE The excerpts whose reading was deferred at load are inited when their notation is first used
+    for (mu::engraving::Excerpt* excerpt : masterScore()->deferredExcerpts()) {
+        auto excerptNotation = std::make_shared<ExcerptNotation>(excerpt, iocContext());
+        excerptNotation->initOnFirstUse();
+        notationExcerpts.push_back(excerptNotation);
+    }
+
     masterScore()->setExcerptsChanged(false);
 
     doSetExcerpts(notationExcerpts);
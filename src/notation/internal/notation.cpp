@@ -92,7 +92,7 @@ Notation::Notation(const muse::modularity::ContextPtr& iocCtx, mu::engraving::Sc
 
     configuration()->canvasOrientation().ch.onReceive(this, [this](muse::Orientation) {
         if (m_score && m_score->autoLayoutEnabled()) {
-            m_score->doLayout();
+            m_score->doLayoutOrPostpone();
         }
     });
 
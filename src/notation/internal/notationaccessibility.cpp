@@ -22,6 +22,7 @@
 #include "notationaccessibility.h"
 
 #include "translation.h"
+#include "async/async.h"
 
 #include "igetscore.h"
 #include "notation.h"
@@ -47,11 +48,11 @@ NotationAccessibility::NotationAccessibility(const Notation* notation)
 {
     notation->interaction()->selectionChanged().onNotify(this, [this]() {
         setTriggeredCommand("");
-        updateAccessibilityInfo();
+        scheduleAccessibilityInfoUpdate();
     });
 
     notation->notationChanged().onNotify(this, [this]() {
-        updateAccessibilityInfo();
+        scheduleAccessibilityInfoUpdate();
     });
 }
 
@@ -122,6 +123,23 @@ void NotationAccessibility::setTriggeredCommand(const std::string& command)
 #endif
 }
 
+void NotationAccessibility::scheduleAccessibilityInfoUpdate()
+{
+    //! NOTE: a single edit usually emits both selectionChanged and notationChanged,
+    //! and commands like "select all" may emit several in a row,
+    //! so build the info string once, when control returns to the event loop
+    if (m_accessibilityInfoUpdateScheduled) {
+        return;
+    }
+
+    m_accessibilityInfoUpdateScheduled = true;
+
+    Async::call(this, [this]() {
+        m_accessibilityInfoUpdateScheduled = false;
+        updateAccessibilityInfo();
+    });
+}
+
 void NotationAccessibility::updateAccessibilityInfo()
 {
     if (!score()) {
@@ -49,6 +49,7 @@ private:
     const engraving::Score* score() const;
     const engraving::Selection* selection() const;
 
+    void scheduleAccessibilityInfoUpdate();
     void updateAccessibilityInfo();
 
     void setAccessibilityInfo(const QString& info);
@@ -58,6 +59,7 @@ private:
 
     const IGetScore* m_getScore = nullptr;
     muse::ValCh<std::string> m_accessibilityInfo;
+    bool m_accessibilityInfoUpdateScheduled = false;
 };
 }
 
@@ -71,6 +71,7 @@ static const Settings::Key TOOLBAR_KEY(module_name, "ui/toolbar/");
 
 static const Settings::Key IS_CANVAS_ORIENTATION_VERTICAL_KEY(module_name, "ui/canvas/scroll/verticalOrientation");
 static const Settings::Key IS_LIMIT_CANVAS_SCROLL_AREA_KEY(module_name, "ui/canvas/scroll/limitScrollArea");
+static const Settings::Key IS_CANVAS_HARDWARE_ACCELERATION_ENABLED_KEY(module_name, "ui/canvas/misc/hardwareAcceleration");
 
 static const Settings::Key COLOR_NOTES_OUTSIDE_OF_USABLE_PITCH_RANGE(module_name, "score/note/warnPitchRange");
 static const Settings::Key WARN_GUITAR_BENDS(module_name, "score/note/warnGuitarBends");
@@ -192,6 +193,12 @@ void NotationConfiguration::init()
         m_isLimitCanvasScrollAreaChanged.notify();
     });
 
+    settings()->setDefaultValue(IS_CANVAS_HARDWARE_ACCELERATION_ENABLED_KEY, Val(false));
+    settings()->setCanBeManuallyEdited(IS_CANVAS_HARDWARE_ACCELERATION_ENABLED_KEY, true);
+    settings()->valueChanged(IS_CANVAS_HARDWARE_ACCELERATION_ENABLED_KEY).onReceive(this, [this](const Val&) {
+        m_isCanvasHardwareAccelerationEnabledChanged.notify();
+    });
+
     settings()->setDefaultValue(COLOR_NOTES_OUTSIDE_OF_USABLE_PITCH_RANGE, Val(true));
     settings()->setDefaultValue(WARN_GUITAR_BENDS, Val(true));
     settings()->setDefaultValue(REALTIME_DELAY, Val(750));
@@ -700,6 +707,21 @@ Notification NotationConfiguration::isLimitCanvasScrollAreaChanged() const
     return m_isLimitCanvasScrollAreaChanged;
 }
 
+bool NotationConfiguration::isCanvasHardwareAccelerationEnabled() const
+{
+    return settings()->value(IS_CANVAS_HARDWARE_ACCELERATION_ENABLED_KEY).toBool();
+}
+
+void NotationConfiguration::setIsCanvasHardwareAccelerationEnabled(bool enabled)
+{
+    settings()->setSharedValue(IS_CANVAS_HARDWARE_ACCELERATION_ENABLED_KEY, Val(enabled));
+}
+
+Notification NotationConfiguration::isCanvasHardwareAccelerationEnabledChanged() const
+{
+    return m_isCanvasHardwareAccelerationEnabledChanged;
+}
+
 bool NotationConfiguration::colorNotesOutsideOfUsablePitchRange() const
 {
     return settings()->value(COLOR_NOTES_OUTSIDE_OF_USABLE_PITCH_RANGE).toBool();
@@ -152,6 +152,10 @@ public:
     void setIsLimitCanvasScrollArea(bool limited) override;
     muse::async::Notification isLimitCanvasScrollAreaChanged() const override;
 
+    bool isCanvasHardwareAccelerationEnabled() const override;
+    void setIsCanvasHardwareAccelerationEnabled(bool enabled) override;
+    muse::async::Notification isCanvasHardwareAccelerationEnabledChanged() const override;
+
     bool colorNotesOutsideOfUsablePitchRange() const override;
     void setColorNotesOutsideOfUsablePitchRange(bool value) override;
 
@@ -231,6 +235,7 @@ private:
     muse::async::Channel<muse::io::path_t> m_userStylesPathChanged;
     muse::async::Notification m_scoreOrderListPathsChanged;
     muse::async::Notification m_isLimitCanvasScrollAreaChanged;
+    muse::async::Notification m_isCanvasHardwareAccelerationEnabledChanged;
     muse::async::Notification m_isPlayRepeatsChanged;
     muse::async::Notification m_isPlayChordSymbolsChanged;
     muse::ValCh<int> m_pianoKeyboardNumberOfKeys;
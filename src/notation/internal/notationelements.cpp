@@ -98,7 +98,7 @@ std::vector<EngravingItem*> NotationElements::elements(const FilterElementsOptio
 
 mu::engraving::RehearsalMark* NotationElements::rehearsalMark(const std::string& name) const
 {
-    QString qname = QString::fromStdString(name).toLower();
+    const String searchName = String::fromStdString(name);
 
     for (mu::engraving::Segment* segment = score()->firstSegment(mu::engraving::SegmentType::ChordRest); segment;
          segment = segment->next1(mu::engraving::SegmentType::ChordRest)) {
@@ -108,8 +108,7 @@ mu::engraving::RehearsalMark* NotationElements::rehearsalMark(const std::string&
             }
 
             mu::engraving::RehearsalMark* rehearsalMark = static_cast<mu::engraving::RehearsalMark*>(element);
-            QString rehearsalMarkName = rehearsalMark->plainText().toQString().toLower();
-            if (rehearsalMarkName.startsWith(qname)) {
+            if (rehearsalMark->plainText().startsWith(searchName, CaseInsensitive)) {
                 return rehearsalMark;
             }
         }
@@ -581,6 +581,16 @@ std::vector<EngravingItem*> NotationInteraction::hitElements(const PointF& pos,
         return true;
     };
 
+    //! NOTE The hit shapes are built once and reused by the "look nearby" pass,
+    //! building a shape and finding the page position is the costly part of the test
+    struct HitCandidate {
+        EngravingItem* element = nullptr;
+        Shape hitShape;
+    };
+
+    std::vector<HitCandidate> candidates;
+    candidates.reserve(potentiallyHitElements.size());
+
     for (EngravingItem* element : potentiallyHitElements) {
         element->itemDiscovered = 0;
 
@@ -588,22 +598,23 @@ std::vector<EngravingItem*> NotationInteraction::hitElements(const PointF& pos,
             continue;
         }
 
-        if (element->hitShapeContains(posOnPage)) {
+        HitCandidate candidate { element, element->hitShape() };
+        candidate.hitShape.translate(element->pagePos());
+
+        if (candidate.hitShape.contains(posOnPage)) {
             hitElements.push_back(element);
         }
+
+        candidates.push_back(std::move(candidate));
     }
 
     if (hitElements.empty() || (hitElements.size() == 1 && hitElements.front()->isMeasure())) {
         //
         // if no relevant element hit, look nearby
         //
-        for (EngravingItem* element : potentiallyHitElements) {
-            if (!canHitElement(element)) {
-                continue;
-            }
-
-            if (element->hitShapeIntersects(hitRect)) {
-                hitElements.push_back(element);
+        for (const HitCandidate& candidate : candidates) {
+            if (candidate.hitShape.intersects(hitRect)) {
+                hitElements.push_back(candidate.element);
             }
         }
     }
@@ -4137,7 +4148,8 @@ void NotationInteraction::swapSelection()
     QString mimeType = selection.mimeType();
 
     if (mimeType == mu::engraving::mimeStaffListFormat) { // determine size of clipboard selection
-        const QMimeData* mimeData = this->selection()->mimeData();
+        //! NOTE Only the clipboard header is needed, the selection itself is serialized once, below
+        const QMimeData* mimeData = QApplication::clipboard()->mimeData();
         QByteArray data = mimeData ? mimeData->data(mu::engraving::mimeStaffListFormat) : QByteArray();
         mu::engraving::XmlReader reader(data);
         reader.readNextStartElement();
@@ -117,6 +117,13 @@ void NotationMidiInput::doProcessEvents()
         return;
     }
 
+    //! NOTE In note input mode, adding the notes to the score (with the following layout) may take a while,
+    //! so play the received notes first, so that the monitoring is not delayed by the score editing
+    bool played = false;
+    if (isNoteInputMode()) {
+        played = playPreviewNotes();
+    }
+
     std::vector<const Note*> notes;
 
     for (size_t i = 0; i < m_eventsQueue.size(); ++i) {
@@ -141,7 +148,10 @@ void NotationMidiInput::doProcessEvents()
             notesItems.push_back(note);
         }
 
-        playbackController()->playElements(notesItems);
+        if (!played) {
+            playbackController()->playElements(notesItems);
+        }
+
         m_notesReceivedChannel.send(notes);
     }
 
@@ -149,6 +159,34 @@ void NotationMidiInput::doProcessEvents()
     m_processTimer.stop();
 }
 
+bool NotationMidiInput::playPreviewNotes()
+{
+    std::vector<Note*> previewNotes;
+    std::vector<const EngravingItem*> previewItems;
+
+    for (const muse::midi::Event& event : m_eventsQueue) {
+        Note* note = makeNote(event);
+        if (note) {
+            previewNotes.push_back(note);
+            previewItems.push_back(note);
+        }
+    }
+
+    if (previewNotes.empty()) {
+        return false;
+    }
+
+    playbackController()->playElements(previewItems);
+
+    for (Note* note : previewNotes) {
+        Chord* chord = note->chord();
+        delete note;
+        delete chord;
+    }
+
+    return true;
+}
+
 Note* NotationMidiInput::addNoteToScore(const muse::midi::Event& e)
 {
     mu::engraving::Score* sc = score();
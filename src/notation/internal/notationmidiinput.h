@@ -58,6 +58,7 @@ private:
     mu::engraving::Score* score() const;
 
     void doProcessEvents();
+    bool playPreviewNotes();
     Note* addNoteToScore(const muse::midi::Event& e);
     Note* makeNote(const muse::midi::Event& e);
 
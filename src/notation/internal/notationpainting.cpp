@@ -110,7 +110,7 @@ bool NotationPainting::isPaintPageBorder() const
     return false;
 }
 
-void NotationPainting::doPaint(Painter* painter, const Options& opt)
+void NotationPainting::doPaint(Painter* painter, const Options& opt, bool paintInteraction)
 {
     TRACEFUNC;
     if (!score()) {
@@ -125,7 +125,7 @@ void NotationPainting::doPaint(Painter* painter, const Options& opt)
 
     scoreRenderer()->paintScore(painter, score(), myopt);
 
-    if (!myopt.isPrinting) {
+    if (paintInteraction && !myopt.isPrinting) {
         static_cast<NotationInteraction*>(m_notation->interaction().get())->paint(painter);
     }
 }
@@ -178,7 +178,7 @@ void NotationPainting::paintPageSheet(Painter* painter, const Page* page, const
     }
 }
 
-void NotationPainting::paintView(Painter* painter, const RectF& frameRect, bool isPrinting)
+NotationPainting::Options NotationPainting::viewOptions(const RectF& frameRect, bool isPrinting) const
 {
     Options opt;
     opt.isSetViewport = false;
@@ -186,7 +186,40 @@ void NotationPainting::paintView(Painter* painter, const RectF& frameRect, bool
     opt.frameRect = frameRect;
     opt.deviceDpi = uiConfiguration()->logicalDpi();
     opt.isPrinting = isPrinting;
-    doPaint(painter, opt);
+
+    //! NOTE While editing, the edited items are changed without layout
+    INotationInteractionPtr interaction = m_notation->interaction();
+    opt.useDisplayList = !interaction->isTextEditingStarted()
+                         && !interaction->isElementEditStarted()
+                         && !interaction->isGripEditStarted()
+                         && !interaction->isDragStarted();
+    opt.displayListGeneration = m_displayListGeneration;
+
+    return opt;
+}
+
+void NotationPainting::paintView(Painter* painter, const RectF& frameRect, bool isPrinting)
+{
+    doPaint(painter, viewOptions(frameRect, isPrinting));
+}
+
+void NotationPainting::paintViewScore(Painter* painter, const RectF& frameRect, bool isPrinting)
+{
+    doPaint(painter, viewOptions(frameRect, isPrinting), false);
+}
+
+void NotationPainting::paintViewInteraction(Painter* painter, bool isPrinting)
+{
+    if (!score() || isPrinting) {
+        return;
+    }
+
+    static_cast<NotationInteraction*>(m_notation->interaction().get())->paint(painter);
+}
+
+void NotationPainting::invalidateDisplayLists()
+{
+    ++m_displayListGeneration;
 }
 
 void NotationPainting::paintPdf(Painter* painter, const Options& opt)
@@ -56,6 +56,9 @@ public:
     muse::SizeF pageSizeInch(const Options& opt) const override;
 
     void paintView(muse::draw::Painter* painter, const muse::RectF& frameRect, bool isPrinting) override;
+    void paintViewScore(muse::draw::Painter* painter, const muse::RectF& frameRect, bool isPrinting) override;
+    void paintViewInteraction(muse::draw::Painter* painter, bool isPrinting) override;
+    void invalidateDisplayLists() override;
     void paintPdf(muse::draw::Painter* painter, const Options& opt) override;
     void paintPrint(muse::draw::Painter* painter, const Options& opt) override;
     void paintPng(muse::draw::Painter* painter, const Options& opt) override;
@@ -64,7 +67,8 @@ private:
     mu::engraving::Score* score() const;
 
     bool isPaintPageBorder() const;
-    void doPaint(muse::draw::Painter* painter, const Options& opt);
+    void doPaint(muse::draw::Painter* painter, const Options& opt, bool paintInteraction = true);
+    Options viewOptions(const muse::RectF& frameRect, bool isPrinting) const;
     void paintPageBorder(muse::draw::Painter* painter, const mu::engraving::Page* page) const;
     void paintPageSheet(muse::draw::Painter* painter, const engraving::Page* page, const muse::RectF& pageRect,
                         bool printPageBackground) const;
@@ -72,6 +76,7 @@ private:
     Notation* m_notation = nullptr;
 
     muse::async::Notification m_viewModeChanged;
+    int m_displayListGeneration = 0;
 };
 }
 
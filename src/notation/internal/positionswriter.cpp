@@ -68,13 +68,14 @@ static void writeEventPosition(deprecated::XmlWriter& writer, const std::string&
     writer.writeEndElement();
 }
 
-static void writeMeasureEvents(deprecated::XmlWriter& writer, Measure* m, int offset, const QHash<void*, int>& segments)
+static void writeMeasureEvents(deprecated::XmlWriter& writer, Measure* m, int offset, const QHash<void*, int>& segments,
+                               const RepeatList& repeatList)
 {
     for (mu::engraving::Segment* s = m->first(mu::engraving::SegmentType::ChordRest); s;
          s = s->next(mu::engraving::SegmentType::ChordRest)) {
         int tick = s->tick().ticks() + offset;
         int id = segments[(void*)s];
-        int time = lrint(m->score()->repeatList().utick2utime(tick) * 1000);
+        int time = lrint(repeatList.utick2utime(tick) * 1000);
 
         writeEventPosition(writer, std::to_string(id), time);
     }
@@ -117,8 +118,10 @@ Ret PositionsWriter::write(INotationPtr notation, io::IODevice& destinationDevic
     writer.writeStartDocument();
     writer.writeStartElement(SCORE_TAG);
 
-    writeElementsPositions(writer, score);
-    writeEventsPositions(writer, score);
+    //! NOTE The ids are assigned while the elements are written, so the score is walked only once for them
+    QHash<void*, int> elementIds;
+    writeElementsPositions(writer, score, elementIds);
+    writeEventsPositions(writer, score, elementIds);
 
     writer.writeEndElement();
     writer.writeEndDocument();
@@ -140,46 +143,30 @@ qreal PositionsWriter::pngDpiResolution() const
     return (imagesExportConfiguration()->exportPngDpiResolution() / mu::engraving::DPI) * 12.0;
 }
 
-QHash<void*, int> PositionsWriter::elementIds(const mu::engraving::Score* score) const
-{
-    QHash<void*, int> elementIds;
-
-    int id = 0;
-    if (m_elementType == ElementType::SEGMENT) {
-        Measure* m = score->firstMeasureMM();
-        for (mu::engraving::Segment* s = (m ? m->first(mu::engraving::SegmentType::ChordRest) : nullptr);
-             s; s = s->next1MM(mu::engraving::SegmentType::ChordRest)) {
-            elementIds[(void*)s] = id++;
-        }
-    } else {
-        for (Measure* m = score->firstMeasureMM(); m; m = m->nextMeasureMM()) {
-            elementIds[(void*)m] = id++;
-        }
-    }
-
-    return elementIds;
-}
-
-void PositionsWriter::writeElementsPositions(deprecated::XmlWriter& writer, const mu::engraving::Score* score) const
+void PositionsWriter::writeElementsPositions(deprecated::XmlWriter& writer, const mu::engraving::Score* score,
+                                             QHash<void*, int>& elementIds) const
 {
     writer.writeStartElement(ELEMENTS_TAG);
 
     switch (m_elementType) {
     case ElementType::SEGMENT:
-        writeSegmentsPositions(writer, score);
+        writeSegmentsPositions(writer, score, elementIds);
         break;
     case ElementType::MEASURE:
-        writeMeasuresPositions(writer, score);
+        writeMeasuresPositions(writer, score, elementIds);
         break;
     }
 
     writer.writeEndElement();
 }
 
-void PositionsWriter::writeSegmentsPositions(deprecated::XmlWriter& writer, const mu::engraving::Score* score) const
+void PositionsWriter::writeSegmentsPositions(deprecated::XmlWriter& writer, const mu::engraving::Score* score,
+                                             QHash<void*, int>& elementIds) const
 {
     int id = 0;
     qreal ndpi = pngDpiResolution();
+    const Page* lastPage = nullptr;
+    page_idx_t pageIndex = 0;
 
     Measure* measure = score->firstMeasureMM();
     for (mu::engraving::Segment* segment = (measure ? measure->first(mu::engraving::SegmentType::ChordRest) : nullptr);
@@ -199,19 +186,25 @@ void PositionsWriter::writeSegmentsPositions(deprecated::XmlWriter& writer, cons
         int x = segment->pagePos().x() * ndpi;
         int y = segment->pagePos().y() * ndpi;
 
-        Page* page = segment->measure()->system()->page();
-        page_idx_t pageIndex = score->pageIdx(page);
+        const Page* page = segment->measure()->system()->page();
+        if (page != lastPage) {
+            pageIndex = score->pageIdx(page);
+            lastPage = page;
+        }
 
         writeElementPosition(writer, std::to_string(id), PointF(x, y), PointF(sx, sy), pageIndex);
 
-        id++;
+        elementIds[(void*)segment] = id++;
     }
 }
 
-void PositionsWriter::writeMeasuresPositions(deprecated::XmlWriter& writer, const mu::engraving::Score* score) const
+void PositionsWriter::writeMeasuresPositions(deprecated::XmlWriter& writer, const mu::engraving::Score* score,
+                                             QHash<void*, int>& elementIds) const
 {
     int id = 0;
     qreal ndpi = pngDpiResolution();
+    const Page* lastPage = nullptr;
+    page_idx_t pageIndex = 0;
 
     for (Measure* measure = score->firstMeasureMM(); measure; measure = measure->nextMeasureMM()) {
         qreal sx = measure->ldata()->bbox().width() * ndpi;
@@ -219,34 +212,37 @@ void PositionsWriter::writeMeasuresPositions(deprecated::XmlWriter& writer, cons
         qreal x = measure->pagePos().x() * ndpi;
         qreal y = measure->system()->pagePos().y() * ndpi;
 
-        Page* page = measure->system()->page();
-        page_idx_t pageIndex = score->pageIdx(page);
+        const Page* page = measure->system()->page();
+        if (page != lastPage) {
+            pageIndex = score->pageIdx(page);
+            lastPage = page;
+        }
 
         writeElementPosition(writer, std::to_string(id), PointF(x, y), PointF(sx, sy), pageIndex);
 
-        id++;
+        elementIds[(void*)measure] = id++;
     }
 }
 
-void PositionsWriter::writeEventsPositions(deprecated::XmlWriter& writer, const mu::engraving::Score* score) const
+void PositionsWriter::writeEventsPositions(deprecated::XmlWriter& writer, const mu::engraving::Score* score,
+                                           const QHash<void*, int>& elementIds) const
 {
-    QHash<void*, int> elementIds = this->elementIds(score);
-
     writer.writeStartElement(EVENTS_TAG);
 
     score->masterScore()->setExpandRepeats(true);
+    const RepeatList& repeatList = score->repeatList();
 
-    for (const mu::engraving::RepeatSegment* repeatSegment : score->repeatList()) {
+    for (const mu::engraving::RepeatSegment* repeatSegment : repeatList) {
         int startTick = repeatSegment->tick;
         int endTick = startTick + repeatSegment->len();
         int tickOffset = repeatSegment->utick - repeatSegment->tick;
         for (Measure* measure = score->tick2measureMM(Fraction::fromTicks(startTick)); measure; measure = measure->nextMeasureMM()) {
             if (m_elementType == ElementType::SEGMENT) {
-                writeMeasureEvents(writer, measure, tickOffset, elementIds);
+                writeMeasureEvents(writer, measure, tickOffset, elementIds, repeatList);
             } else {
                 int tick = measure->tick().ticks() + tickOffset;
                 int id = elementIds[(void*)measure];
-                int time = std::lrint(measure->score()->repeatList().utick2utime(tick) * 1000);
+                int time = std::lrint(repeatList.utick2utime(tick) * 1000);
 
                 writeEventPosition(writer, std::to_string(id), time);
             }
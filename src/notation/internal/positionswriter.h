@@ -57,13 +57,16 @@ public:
 
 private:
     qreal pngDpiResolution() const;
-    QHash<void*, int> elementIds(const mu::engraving::Score* score) const;
 
-    void writeElementsPositions(muse::deprecated::XmlWriter& writer, const mu::engraving::Score* score) const;
-    void writeSegmentsPositions(muse::deprecated::XmlWriter& writer, const mu::engraving::Score* score) const;
-    void writeMeasuresPositions(muse::deprecated::XmlWriter& writer, const mu::engraving::Score* score) const;
+    void writeElementsPositions(muse::deprecated::XmlWriter& writer, const mu::engraving::Score* score,
+                                QHash<void*, int>& elementIds) const;
+    void writeSegmentsPositions(muse::deprecated::XmlWriter& writer, const mu::engraving::Score* score,
+                                QHash<void*, int>& elementIds) const;
+    void writeMeasuresPositions(muse::deprecated::XmlWriter& writer, const mu::engraving::Score* score,
+                                QHash<void*, int>& elementIds) const;
 
-    void writeEventsPositions(muse::deprecated::XmlWriter& writer, const mu::engraving::Score* score) const;
+    void writeEventsPositions(muse::deprecated::XmlWriter& writer, const mu::engraving::Score* score,
+                              const QHash<void*, int>& elementIds) const;
 
     ElementType m_elementType = ElementType::SEGMENT;
 };
@@ -137,6 +137,10 @@ public:
     MOCK_METHOD(void, setIsLimitCanvasScrollArea, (bool), (override));
     MOCK_METHOD(muse::async::Notification, isLimitCanvasScrollAreaChanged, (), (const, override));
 
+    MOCK_METHOD(bool, isCanvasHardwareAccelerationEnabled, (), (const, override));
+    MOCK_METHOD(void, setIsCanvasHardwareAccelerationEnabled, (bool), (override));
+    MOCK_METHOD(muse::async::Notification, isCanvasHardwareAccelerationEnabledChanged, (), (const, override));
+
     MOCK_METHOD(bool, colorNotesOutsideOfUsablePitchRange, (), (const, override));
     MOCK_METHOD(void, setColorNotesOutsideOfUsablePitchRange, (bool), (override));
 
@@ -22,6 +22,8 @@
 #include "abstractnotationpaintview.h"
 
 #include <QPainter>
+#include <QQuickWindow>
+#include <QSGRendererInterface>
 
 #include "actions/actiontypes.h"
 
@@ -63,6 +65,14 @@ AbstractNotationPaintView::AbstractNotationPaintView(QQuickItem* parent)
     connect(&m_enableAutoScrollTimer, &QTimer::timeout, this, [this]() {
         m_autoScrollEnabled = true;
     });
+
+    //! NOTE Tiles around the visible area are rendered in small portions when the view is idle
+    static constexpr int TILE_PREFETCH_INTERVAL_MS = 20;
+    m_tilePrefetchTimer.setSingleShot(true);
+    m_tilePrefetchTimer.setInterval(TILE_PREFETCH_INTERVAL_MS);
+    connect(&m_tilePrefetchTimer, &QTimer::timeout, this, [this]() {
+        prefetchTiles();
+    });
 }
 
 AbstractNotationPaintView::~AbstractNotationPaintView()
@@ -112,9 +122,36 @@ void AbstractNotationPaintView::load()
         emit viewportChanged();
     });
 
+    updateRenderTarget();
+    configuration()->isCanvasHardwareAccelerationEnabledChanged().onNotify(this, [this]() {
+        updateRenderTarget();
+        scheduleRedraw();
+    });
+
     scheduleRedraw();
 }
 
+void AbstractNotationPaintView::updateRenderTarget()
+{
+    //! NOTE With OpenGL the canvas can be painted by the GL paint engine into a framebuffer object:
+    //! paths and glyphs are rasterized on the GPU, and the cached tiles stay in the texture cache of the engine,
+    //! so scrolling only blits them. Other graphics APIs support only the image target.
+    bool accelerated = configuration()->isCanvasHardwareAccelerationEnabled()
+                       && window()
+                       && window()->rendererInterface()
+                       && window()->rendererInterface()->graphicsApi() == QSGRendererInterface::OpenGL;
+
+    RenderTarget target = accelerated ? QQuickPaintedItem::FramebufferObject : QQuickPaintedItem::Image;
+    if (renderTarget() == target) {
+        return;
+    }
+
+    setRenderTarget(target);
+
+    //! NOTE In the framebuffer the antialiasing of the item means multisampling, without it the paths are jagged
+    setAntialiasing(accelerated);
+}
+
 void AbstractNotationPaintView::initBackground()
 {
     emit backgroundColorChanged(configuration()->backgroundColor());
@@ -244,7 +281,8 @@ void AbstractNotationPaintView::onLoadNotation(INotationPtr)
     m_notation->notationChanged().onNotify(this, [this, interaction]() {
         interaction->hideShadowNote();
         m_shadowNoteRect = RectF();
-        scheduleRedraw();
+        m_playbackCursor->invalidate();
+        onNotationContentChanged();
     });
 
     onNoteInputStateChanged();
@@ -253,7 +291,7 @@ void AbstractNotationPaintView::onLoadNotation(INotationPtr)
     });
 
     interaction->selectionChanged().onNotify(this, [this]() {
-        scheduleRedraw();
+        onNotationContentChanged();
     });
 
     interaction->showItemRequested().onReceive(this, [this](const INotationInteraction::ShowItemRequest& request) {
@@ -261,18 +299,23 @@ void AbstractNotationPaintView::onLoadNotation(INotationPtr)
     });
 
     interaction->textEditingStarted().onNotify(this, [this]() {
+        invalidateTileCache();
         setFlag(ItemAcceptsInputMethod, true);
         setFocus(false); // Remove focus once so that the IME reloads the state
         forceFocusIn();
     });
 
     interaction->textEditingEnded().onReceive(this, [this](const engraving::TextBase*) {
+        invalidateTileCache();
         setFlag(ItemAcceptsInputMethod, false);
         setFocus(false); // Remove focus once so that the IME reloads the state
         forceFocusIn();
     });
 
     interaction->dropChanged().onNotify(this, [this]() {
+        // the drop target is highlighted without relayout
+        invalidateAppearance();
+
         if (!hasActiveFocus()) {
             forceFocusIn(); // grab keyboard focus after element added from palette
         }
@@ -284,6 +327,7 @@ void AbstractNotationPaintView::onLoadNotation(INotationPtr)
     });
 
     m_notation->viewModeChanged().onNotify(this, [this]() {
+        invalidateTileCache();
         updateLoopMarkers();
         ensureViewportInsideScrollableArea();
     });
@@ -326,6 +370,8 @@ void AbstractNotationPaintView::onUnloadNotation(INotationPtr)
     interaction->noteInput()->stateChanged().resetOnNotify(this);
     interaction->selectionChanged().resetOnNotify(this);
 
+    invalidateTileCache();
+
     if (isMainView()) {
         m_notation->accessibility()->setMapToScreenFunc(nullptr);
         m_notation->interaction()->setGetViewRectFunc(nullptr);
@@ -594,10 +640,24 @@ void AbstractNotationPaintView::paint(QPainter* qp)
     Transform guiScalingCompensation;
     guiScalingCompensation.scale(guiScaling, guiScaling);
 
-    painter->setWorldTransform(m_matrix * guiScalingCompensation);
-
+    Transform worldTransform = m_matrix * guiScalingCompensation;
     bool isPrinting = publishMode() || m_inputController->readonly();
-    notation()->painting()->paintView(painter, toLogical(rect), isPrinting);
+
+    bool scorePainted = false;
+    if (isTileCacheUsable()) {
+        scorePainted = m_tileCache.paint(qp, rect, worldTransform, tilePaintFunc(isPrinting));
+    } else {
+        invalidateTileCache();
+    }
+
+    painter->setWorldTransform(worldTransform);
+
+    if (scorePainted) {
+        notation()->painting()->paintViewInteraction(painter, isPrinting);
+        m_tilePrefetchTimer.start();
+    } else {
+        notation()->painting()->paintView(painter, toLogical(rect), isPrinting);
+    }
 
     m_noteInputCursor->paint(painter);
     m_loopInMarker->paint(painter);
@@ -632,18 +692,78 @@ void AbstractNotationPaintView::onNotationSetup()
     });
 
     configuration()->foregroundChanged().onNotify(this, [this]() {
+        invalidateAppearance();
         scheduleRedraw();
     });
 
     uiConfiguration()->currentThemeChanged().onNotify(this, [this]() {
+        invalidateAppearance();
         scheduleRedraw();
     });
 
     engravingConfiguration()->debuggingOptionsChanged().onNotify(this, [this]() {
+        invalidateAppearance();
         scheduleRedraw();
     });
 }
 
+void AbstractNotationPaintView::onNotationContentChanged()
+{
+    invalidateTileCache();
+    scheduleRedraw();
+}
+
+bool AbstractNotationPaintView::isTileCacheUsable() const
+{
+    const INotationInteractionPtr interaction = notationInteraction();
+    if (!interaction) {
+        return false;
+    }
+
+    //! NOTE While editing, the edited items change on every event, caching doesn't make sense
+    return !interaction->isTextEditingStarted()
+           && !interaction->isElementEditStarted()
+           && !interaction->isDragStarted()
+           && !interaction->isGripEditStarted();
+}
+
+void AbstractNotationPaintView::invalidateTileCache()
+{
+    m_tilePrefetchTimer.stop();
+    m_tileCache.clear();
+}
+
+void AbstractNotationPaintView::invalidateAppearance()
+{
+    if (notation()) {
+        notation()->painting()->invalidateDisplayLists();
+    }
+
+    invalidateTileCache();
+}
+
+void AbstractNotationPaintView::prefetchTiles()
+{
+    if (!isInited() || !isTileCacheUsable()) {
+        return;
+    }
+
+    static constexpr int MAX_PREFETCH_TILES = 2;
+
+    bool isPrinting = publishMode() || m_inputController->readonly();
+    if (m_tileCache.prefetch(tilePaintFunc(isPrinting), MAX_PREFETCH_TILES)) {
+        m_tilePrefetchTimer.start();
+    }
+}
+
+NotationTileCache::PaintFunc AbstractNotationPaintView::tilePaintFunc(bool isPrinting) const
+{
+    INotationPaintingPtr painting = notation()->painting();
+    return [painting, isPrinting](muse::draw::Painter* painter, const RectF& logicalRect) {
+        painting->paintViewScore(painter, logicalRect, isPrinting);
+    };
+}
+
 void AbstractNotationPaintView::paintBackground(const RectF& rect, muse::draw::Painter* painter)
 {
     TRACEFUNC;
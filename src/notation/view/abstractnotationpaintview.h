@@ -45,6 +45,7 @@
 #include "playbackcursor.h"
 #include "loopmarker.h"
 #include "continuouspanel.h"
+#include "notationtilecache.h"
 #include "abstractelementpopupmodel.h"
 
 namespace mu::notation {
@@ -185,6 +186,9 @@ protected:
 
     virtual void onMatrixChanged(const muse::draw::Transform& oldMatrix, const muse::draw::Transform& newMatrix, bool overrideZoomType);
 
+    //! NOTE Called when the painted score content changes (edit, selection), invalidates the cache and redraws the view
+    virtual void onNotationContentChanged();
+
 protected slots:
     virtual void onViewSizeChanged();
 
@@ -196,6 +200,13 @@ private:
 
     void clear();
     void initBackground();
+
+    bool isTileCacheUsable() const;
+    void invalidateTileCache();
+    void invalidateAppearance();
+    void updateRenderTarget();
+    void prefetchTiles();
+    NotationTileCache::PaintFunc tilePaintFunc(bool isPrinting) const;
     void initNavigatorOrientation();
 
     bool canReceiveAction(const muse::actions::ActionCode& actionCode) const override;
@@ -276,6 +287,9 @@ private:
     bool m_autoScrollEnabled = true;
     QTimer m_enableAutoScrollTimer;
 
+    NotationTileCache m_tileCache;
+    QTimer m_tilePrefetchTimer;
+
     bool m_isPopupOpen = false;
     bool m_isContextMenuOpen = false;
 
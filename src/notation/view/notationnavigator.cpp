@@ -52,6 +52,16 @@ NotationNavigator::NotationNavigator(QQuickItem* parent)
     : AbstractNotationPaintView(parent), m_cursorRectView(new NotationNavigatorCursorView(this))
 {
     setReadonly(true);
+
+    //! NOTE The navigator shows the whole score at once, so re-rendering it on every edit
+    //! costs as much as painting all pages. Keep showing the cached (slightly outdated) image
+    //! while the user is editing and refresh it at most once per interval
+    static constexpr int CONTENT_REFRESH_INTERVAL_MS = 300;
+    m_contentRefreshTimer.setSingleShot(true);
+    m_contentRefreshTimer.setInterval(CONTENT_REFRESH_INTERVAL_MS);
+    connect(&m_contentRefreshTimer, &QTimer::timeout, this, [this]() {
+        AbstractNotationPaintView::onNotationContentChanged();
+    });
 }
 
 void NotationNavigator::load()
@@ -272,6 +282,13 @@ void NotationNavigator::onViewSizeChanged()
 {
 }
 
+void NotationNavigator::onNotationContentChanged()
+{
+    if (!m_contentRefreshTimer.isActive()) {
+        m_contentRefreshTimer.start();
+    }
+}
+
 void NotationNavigator::paintPageNumbers(QPainter* painter)
 {
     if (notationViewMode() != ViewMode::PAGE) {
@@ -26,6 +26,7 @@
 #include <QMouseEvent>
 #include <QPainter>
 #include <QQuickPaintedItem>
+#include <QTimer>
 
 #include "draw/types/geometry.h"
 #include "modularity/ioc.h"
@@ -88,6 +89,7 @@ private:
 
     void paint(QPainter* painter) override;
     void onViewSizeChanged() override;
+    void onNotationContentChanged() override;
 
     void wheelEvent(QWheelEvent* event) override;
     void mousePressEvent(QMouseEvent* event) override;
@@ -104,6 +106,7 @@ private:
     muse::RectF m_cursorRect;
     NotationNavigatorCursorView* m_cursorRectView = nullptr;
     muse::PointF m_startMove;
+    QTimer m_contentRefreshTimer;
 };
 }
 
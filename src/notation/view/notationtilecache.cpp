@@ -0,0 +1,174 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-Studio-CLA-applies
+ *
+ * MuseScore Studio
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2024 MuseScore Limited
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "notationtilecache.h"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include <QPainter>
+
+#include "realfn.h"
+
+#include "log.h"
+
+using namespace mu::notation;
+using namespace muse;
+using namespace muse::draw;
+
+static constexpr size_t MIN_CACHED_TILES = 64;
+
+void NotationTileCache::clear()
+{
+    m_tiles.clear();
+}
+
+bool NotationTileCache::isEmpty() const
+{
+    return m_tiles.empty();
+}
+
+bool NotationTileCache::paint(QPainter* painter, const RectF& viewRect, const Transform& worldTransform, const PaintFunc& func)
+{
+    TRACEFUNC;
+
+    const double scaling = worldTransform.m11();
+    const qreal dpr = painter->device() ? painter->device()->devicePixelRatioF() : 1.0;
+
+    //! NOTE While zooming every frame has another scaling, don't waste time on the tiles,
+    //! start caching from the next frame with the same scaling
+    if (!muse::RealIsEqual(scaling, m_scaling) || !muse::RealIsEqual(dpr, m_devicePixelRatio)) {
+        clear();
+        m_scaling = scaling;
+        m_devicePixelRatio = dpr;
+        return false;
+    }
+
+    ++m_frame;
+
+    // Align the tile grid to whole pixels, so the tiles are not resampled
+    const double dx = std::round(worldTransform.dx());
+    const double dy = std::round(worldTransform.dy());
+
+    m_firstX = static_cast<int>(std::floor((viewRect.left() - dx) / TILE_SIZE));
+    m_lastX = static_cast<int>(std::floor((viewRect.right() - dx) / TILE_SIZE));
+    m_firstY = static_cast<int>(std::floor((viewRect.top() - dy) / TILE_SIZE));
+    m_lastY = static_cast<int>(std::floor((viewRect.bottom() - dy) / TILE_SIZE));
+
+    painter->save();
+    painter->setClipRect(viewRect.toQRectF());
+
+    for (int y = m_firstY; y <= m_lastY; ++y) {
+        for (int x = m_firstX; x <= m_lastX; ++x) {
+            const Tile& t = tile(TileKey { x, y }, func);
+            painter->drawImage(QPointF(x * TILE_SIZE + dx, y * TILE_SIZE + dy), t.image);
+        }
+    }
+
+    painter->restore();
+
+    evict();
+
+    return true;
+}
+
+bool NotationTileCache::prefetch(const PaintFunc& func, int maxTiles)
+{
+    if (m_lastX < m_firstX || m_lastY < m_firstY) {
+        return false;
+    }
+
+    // One ring of tiles around the visible ones, so scrolling in any direction hits the cache
+    for (int y = m_firstY - 1; y <= m_lastY + 1; ++y) {
+        for (int x = m_firstX - 1; x <= m_lastX + 1; ++x) {
+            TileKey key { x, y };
+            if (m_tiles.find(key) != m_tiles.end()) {
+                continue;
+            }
+
+            if (maxTiles-- <= 0) {
+                return true;
+            }
+
+            tile(key, func);
+        }
+    }
+
+    return false;
+}
+
+NotationTileCache::Tile& NotationTileCache::tile(const TileKey& key, const PaintFunc& func)
+{
+    auto it = m_tiles.find(key);
+    if (it != m_tiles.end()) {
+        it->second.lastUsed = m_frame;
+        return it->second;
+    }
+
+    const int pixels = static_cast<int>(std::ceil(TILE_SIZE * m_devicePixelRatio));
+
+    Tile& t = m_tiles[key];
+    t.lastUsed = m_frame;
+    t.image = QImage(pixels, pixels, QImage::Format_ARGB32_Premultiplied);
+    t.image.setDevicePixelRatio(m_devicePixelRatio);
+    t.image.fill(Qt::transparent);
+
+    // Tile coordinates -> logical coordinates
+    const RectF logicalRect(key.x * TILE_SIZE / m_scaling, key.y * TILE_SIZE / m_scaling, TILE_SIZE / m_scaling, TILE_SIZE / m_scaling);
+
+    QPainter qp(&t.image);
+    qp.setRenderHint(QPainter::Antialiasing, true);
+    qp.setRenderHint(QPainter::TextAntialiasing, true);
+
+    Painter painter(&qp, "tile");
+    Transform transform;
+    transform.translate(-key.x * TILE_SIZE, -key.y * TILE_SIZE);
+    transform.scale(m_scaling, m_scaling);
+    painter.setWorldTransform(transform);
+
+    func(&painter, logicalRect);
+
+    return t;
+}
+
+void NotationTileCache::evict()
+{
+    const size_t visible = static_cast<size_t>((m_lastX - m_firstX + 3) * (m_lastY - m_firstY + 3));
+    const size_t limit = std::max(MIN_CACHED_TILES, visible * 3);
+    if (m_tiles.size() <= limit) {
+        return;
+    }
+
+    // Drop the tiles that were not used for the longest time
+    std::vector<std::pair<uint64_t, TileKey> > byAge;
+    byAge.reserve(m_tiles.size());
+    for (const auto& p : m_tiles) {
+        byAge.push_back({ p.second.lastUsed, p.first });
+    }
+
+    std::sort(byAge.begin(), byAge.end(), [](const auto& a, const auto& b) { return a.first < b.first; });
+
+    const size_t count = m_tiles.size() - limit;
+    for (size_t i = 0; i < count; ++i) {
+        m_tiles.erase(byAge.at(i).second);
+    }
+}
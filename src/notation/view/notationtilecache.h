@@ -0,0 +1,89 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-Studio-CLA-applies
+ *
+ * MuseScore Studio
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2024 MuseScore Limited
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef MU_NOTATION_NOTATIONTILECACHE_H
+#define MU_NOTATION_NOTATIONTILECACHE_H
+
+#include <functional>
+#include <map>
+
+#include <QImage>
+
+#include "draw/painter.h"
+#include "draw/types/geometry.h"
+#include "draw/types/transform.h"
+
+class QPainter;
+
+namespace mu::notation {
+//! NOTE Cache of the rendered score, split into square tiles in device pixels.
+//! Tiles are valid for one scaling of the view; the translation (scrolling) doesn't invalidate them.
+//! Only the score itself is cached, overlays (selection, cursors...) must be painted on top.
+class NotationTileCache
+{
+public:
+    //! NOTE Paints the score content for the given logical rect
+    using PaintFunc = std::function<void (muse::draw::Painter* painter, const muse::RectF& logicalRect)>;
+
+    static constexpr int TILE_SIZE = 256; // device independent pixels
+
+    NotationTileCache() = default;
+
+    void clear();
+    bool isEmpty() const;
+
+    //! NOTE Returns false if the cache can't be used with this transform (zoom in progress),
+    //! in this case the caller should paint directly
+    bool paint(QPainter* painter, const muse::RectF& viewRect, const muse::draw::Transform& worldTransform, const PaintFunc& func);
+
+    //! NOTE Renders up to maxTiles not yet cached tiles around the last painted rect, returns true if there is more to render
+    bool prefetch(const PaintFunc& func, int maxTiles);
+
+private:
+    struct TileKey {
+        int x = 0;
+        int y = 0;
+
+        bool operator<(const TileKey& k) const { return y < k.y || (y == k.y && x < k.x); }
+    };
+
+    struct Tile {
+        QImage image;
+        uint64_t lastUsed = 0;
+    };
+
+    Tile& tile(const TileKey& key, const PaintFunc& func);
+    void evict();
+
+    std::map<TileKey, Tile> m_tiles;
+    double m_scaling = 0.0;
+    qreal m_devicePixelRatio = 1.0;
+    uint64_t m_frame = 0;
+
+    // Last painted area in tile coordinates
+    int m_firstX = 0;
+    int m_lastX = -1;
+    int m_firstY = 0;
+    int m_lastY = -1;
+};
+}
+
+#endif // MU_NOTATION_NOTATIONTILECACHE_H
@@ -21,6 +21,7 @@
  */
 #include "noteinputbarmodel.h"
 
+#include "async/async.h"
 #include "async/notifylist.h"
 #include "types/translatablestring.h"
 
@@ -182,15 +183,15 @@ void NoteInputBarModel::onNotationChanged()
 {
     if (context()->currentNotation()) {
         noteInput()->stateChanged().onNotify(this, [this]() {
-            updateState();
+            scheduleUpdateState();
         });
 
         interaction()->selectionChanged().onNotify(this, [this]() {
-            updateState();
+            scheduleUpdateState();
         });
 
         undoStack()->stackChanged().onNotify(this, [this]() {
-            updateState();
+            scheduleUpdateState();
         });
 
         masterNotation()->hasPartsChanged().onNotify(this, [this]() {
@@ -214,6 +215,22 @@ void NoteInputBarModel::updateItemStateChecked(MenuItem* item, bool checked)
     item->setState(state);
 }
 
+void NoteInputBarModel::scheduleUpdateState()
+{
+    //! NOTE: every entered note changes the undo stack, the selection and the input state,
+    //! update the toolbar once for all of them instead of after each notification
+    if (m_updateStateScheduled) {
+        return;
+    }
+
+    m_updateStateScheduled = true;
+
+    async::Async::call(this, [this]() {
+        m_updateStateScheduled = false;
+        updateState();
+    });
+}
+
 void NoteInputBarModel::updateState()
 {
     for (int i = 0; i < rowCount(); ++i) {
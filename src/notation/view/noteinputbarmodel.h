@@ -67,6 +67,7 @@ private:
 
     void updateItemStateChecked(muse::uicomponents::MenuItem* item, bool checked);
 
+    void scheduleUpdateState();
     void updateState();
     void updateNoteInputState();
     void updateNoteInputModeState();
@@ -119,6 +120,8 @@ private:
     NoteInputState noteInputState() const;
 
     const ChordRest* elementToChordRest(const EngravingItem* element) const;
+
+    bool m_updateStateScheduled = false;
 };
 }
 
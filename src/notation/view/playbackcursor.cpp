@@ -21,6 +21,8 @@
  */
 #include "playbackcursor.h"
 
+#include <algorithm>
+
 #include "engraving/dom/system.h"
 
 using namespace mu::notation;
@@ -38,6 +40,7 @@ void PlaybackCursor::paint(muse::draw::Painter* painter)
 void PlaybackCursor::setNotation(INotationPtr notation)
 {
     m_notation = notation;
+    invalidate();
 }
 
 void PlaybackCursor::move(muse::midi::tick_t tick)
@@ -45,6 +48,11 @@ void PlaybackCursor::move(muse::midi::tick_t tick)
     m_rect = resolveCursorRectByTick(tick);
 }
 
+void PlaybackCursor::invalidate()
+{
+    m_measureCache = MeasureCache();
+}
+
 //! NOTE Copied from ScoreView::moveCursor(const Fraction& tick)
 muse::RectF PlaybackCursor::resolveCursorRectByTick(muse::midi::tick_t _tick) const
 {
@@ -52,60 +60,86 @@ muse::RectF PlaybackCursor::resolveCursorRectByTick(muse::midi::tick_t _tick) co
         return RectF();
     }
 
-    const mu::engraving::Score* score = m_notation->elements()->msScore();
-
     Fraction tick = Fraction::fromTicks(_tick);
 
-    Measure* measure = score->tick2measureMM(tick);
-    if (!measure) {
+    //! NOTE The cursor moves within the same measure most of the time,
+    //! so the positions of its segments are cached, until the measure changes or the score is laid out again
+    if (!m_measureCache.measure || tick < m_measureCache.startTick || tick >= m_measureCache.endTick) {
+        const mu::engraving::Score* score = m_notation->elements()->msScore();
+
+        const Measure* measure = score->tick2measureMM(tick);
+        if (!measure) {
+            return RectF();
+        }
+
+        if (measure != m_measureCache.measure) {
+            m_measureCache = buildMeasureCache(score, measure);
+        }
+
+        if (!m_measureCache.measure) {
+            return RectF();
+        }
+    }
+
+    const std::vector<MeasureCache::Point>& points = m_measureCache.points;
+
+    auto it = std::upper_bound(points.begin(), points.end(), tick, [](const Fraction& t, const MeasureCache::Point& point) {
+        return t < point.tick;
+    });
+
+    if (it == points.begin() || it == points.end()) {
         return RectF();
     }
 
+    const MeasureCache::Point& p2 = *it;
+    const MeasureCache::Point& p1 = *(it - 1);
+
+    int x1 = p1.x;
+    Fraction dt = p2.tick - p1.tick;
+    qreal dx = p2.x - x1;
+    qreal x = x1 + dx * (tick - p1.tick).ticks() / dt.ticks();
+
+    return RectF(x - m_measureCache.spatium, m_measureCache.y, m_measureCache.width, m_measureCache.height);
+}
+
+PlaybackCursor::MeasureCache PlaybackCursor::buildMeasureCache(const mu::engraving::Score* score, const Measure* measure) const
+{
     mu::engraving::System* system = measure->system();
     if (!system) {
-        return RectF();
+        return MeasureCache();
+    }
+
+    MeasureCache cache;
+    cache.startTick = measure->tick();
+    cache.endTick = measure->endTick();
+
+    mu::engraving::Segment* s = measure->first(mu::engraving::SegmentType::ChordRest);
+    if (!s) {
+        return MeasureCache();
     }
 
-    qreal x = 0.0;
-    mu::engraving::Segment* s = nullptr;
-    for (s = measure->first(mu::engraving::SegmentType::ChordRest); s;) {
-        Fraction t1 = s->tick();
-        int x1 = s->canvasPos().x();
-        qreal x2 = 0.0;
-        Fraction t2;
+    for (; s;) {
+        cache.points.push_back({ s->tick(), s->canvasPos().x() });
 
         mu::engraving::Segment* ns = s->next(mu::engraving::SegmentType::ChordRest);
         while (ns && !ns->visible()) {
             ns = ns->next(mu::engraving::SegmentType::ChordRest);
         }
 
-        if (ns) {
-            t2 = ns->tick();
-            x2 = ns->canvasPos().x();
-        } else {
-            t2 = measure->endTick();
-            // measure->width is not good enough because of courtesy keysig, timesig
-            mu::engraving::Segment* seg = measure->findSegment(mu::engraving::SegmentType::EndBarLine, measure->tick() + measure->ticks());
-            if (seg) {
-                x2 = seg->canvasPos().x();
-            } else {
-                x2 = measure->canvasPos().x() + measure->width(); // safety, should not happen
-            }
-        }
-
-        if (tick >= t1 && tick < t2) {
-            Fraction dt = t2 - t1;
-            qreal dx = x2 - x1;
-            x = x1 + dx * (tick - t1).ticks() / dt.ticks();
-            break;
-        }
         s = ns;
     }
 
-    if (!s) {
-        return RectF();
+    qreal endX = 0.0;
+    // measure->width is not good enough because of courtesy keysig, timesig
+    mu::engraving::Segment* seg = measure->findSegment(mu::engraving::SegmentType::EndBarLine, measure->tick() + measure->ticks());
+    if (seg) {
+        endX = seg->canvasPos().x();
+    } else {
+        endX = measure->canvasPos().x() + measure->width(); // safety, should not happen
     }
 
+    cache.points.push_back({ measure->endTick(), endX });
+
     double y = system->staffYpage(0) + system->page()->pos().y();
     double _spatium = score->style().spatium();
 
@@ -125,10 +159,15 @@ muse::RectF PlaybackCursor::resolveCursorRectByTick(muse::midi::tick_t _tick) co
     }
 
     h += y2;
-    x -= _spatium;
     y -= 3 * _spatium;
 
-    return RectF(x, y, w, h);
+    cache.y = y;
+    cache.width = w;
+    cache.height = h;
+    cache.spatium = _spatium;
+    cache.measure = measure;
+
+    return cache;
 }
 
 bool PlaybackCursor::visible() const
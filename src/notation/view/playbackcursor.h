@@ -44,18 +44,43 @@ public:
     void setNotation(INotationPtr notation);
     void move(muse::midi::tick_t tick);
 
+    //! NOTE Must be called when the layout of the score changes
+    void invalidate();
+
     bool visible() const;
     void setVisible(bool arg);
 
     const muse::RectF& rect() const;
 
 private:
+    struct MeasureCache {
+        struct Point {
+            Fraction tick;
+            qreal x = 0.0;
+        };
+
+        const Measure* measure = nullptr;
+        Fraction startTick;
+        Fraction endTick;
+
+        //! NOTE The visible chord rest segments and the end of the measure
+        std::vector<Point> points;
+
+        double y = 0.0;
+        double width = 0.0;
+        double height = 0.0;
+        double spatium = 0.0;
+    };
+
     QColor color() const;
     muse::RectF resolveCursorRectByTick(muse::midi::tick_t tick) const;
+    MeasureCache buildMeasureCache(const mu::engraving::Score* score, const Measure* measure) const;
 
     bool m_visible = false;
     muse::RectF m_rect;
 
+    mutable MeasureCache m_measureCache;
+
     INotationPtr m_notation;
 };
 }
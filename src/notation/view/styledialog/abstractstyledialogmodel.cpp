@@ -21,14 +21,27 @@
  */
 #include "abstractstyledialogmodel.h"
 
+#include "containers.h"
+
 #include "engraving/style/style.h"
 
 using namespace mu::notation;
 using namespace mu::engraving;
 
+static constexpr int STYLE_APPLY_INTERVAL_MS = 100;
+
 AbstractStyleDialogModel::AbstractStyleDialogModel(QObject* parent, std::set<StyleId> ids)
     : QObject(parent), muse::Injectable(muse::iocCtxForQmlObject(this)), m_ids(ids)
 {
+    m_applyTimer.setSingleShot(true);
+    m_applyTimer.setInterval(STYLE_APPLY_INTERVAL_MS);
+    connect(&m_applyTimer, &QTimer::timeout, this, &AbstractStyleDialogModel::applyPendingStyleValues);
+}
+
+AbstractStyleDialogModel::~AbstractStyleDialogModel()
+{
+    // don't lose the last modification when the dialog is closed right after it
+    applyPendingStyleValues();
 }
 
 StyleItem* AbstractStyleDialogModel::styleItem(StyleId id) const
@@ -40,6 +53,10 @@ StyleItem* AbstractStyleDialogModel::styleItem(StyleId id) const
 
         currentNotationStyle()->styleChanged().onNotify(this, [this]() {
             for (auto [id, item] : m_items) {
+                // the score doesn't have the pending value yet, keep the one shown
+                if (muse::contains(m_pendingValues, id)) {
+                    continue;
+                }
                 item->setValue(toUiValue(id, currentNotationStyle()->styleValue(id)));
             }
         });
@@ -63,12 +80,39 @@ StyleItem* AbstractStyleDialogModel::buildStyleItem(StyleId id) const
     StyleItem* item = new StyleItem(const_cast<AbstractStyleDialogModel*>(this), value, defaultValue);
 
     connect(item, &StyleItem::valueModified, this, [this, id](const QVariant& newValue) {
-        currentNotationStyle()->setStyleValue(id, fromUiValue(id, newValue));
+        scheduleStyleValue(id, newValue);
     });
 
     return item;
 }
 
+void AbstractStyleDialogModel::scheduleStyleValue(StyleId id, const QVariant& uiValue) const
+{
+    m_pendingValues.insert_or_assign(id, uiValue);
+    m_applyTimer.start();
+}
+
+void AbstractStyleDialogModel::applyPendingStyleValues()
+{
+    m_applyTimer.stop();
+
+    if (m_pendingValues.empty()) {
+        return;
+    }
+
+    std::map<StyleId, QVariant> values;
+    values.swap(m_pendingValues);
+
+    INotationPtr notation = context()->currentNotation();
+    if (!notation) {
+        return;
+    }
+
+    for (const auto& [id, uiValue] : values) {
+        notation->style()->setStyleValue(id, fromUiValue(id, uiValue));
+    }
+}
+
 QVariant AbstractStyleDialogModel::toUiValue(StyleId id, const PropertyValue& logicalValue) const
 {
     if (mu::engraving::MStyle::valueType(id) == P_TYPE::SPATIUM) {
@@ -22,8 +22,11 @@
 #ifndef MU_NOTATION_ABSTRACTSTYLEDIALOGMODEL_H
 #define MU_NOTATION_ABSTRACTSTYLEDIALOGMODEL_H
 
+#include <map>
 #include <unordered_map>
 
+#include <QTimer>
+
 #include "async/asyncable.h"
 
 #include "notationtypes.h"
@@ -43,6 +46,8 @@ class AbstractStyleDialogModel : public QObject, public muse::Injectable, public
 
 protected:
     explicit AbstractStyleDialogModel(QObject* parent, std::set<StyleId> ids);
+    ~AbstractStyleDialogModel() override;
+
     StyleItem* styleItem(StyleId id) const;
 
 private:
@@ -50,12 +55,20 @@ private:
 
     StyleItem* buildStyleItem(StyleId id) const;
 
+    void scheduleStyleValue(StyleId id, const QVariant& uiValue) const;
+    void applyPendingStyleValues();
+
     QVariant toUiValue(StyleId id, const PropertyValue& logicalValue) const;
     PropertyValue fromUiValue(StyleId id, const QVariant& uiValue) const;
 
     mutable bool m_inited = false;
     std::set<StyleId> m_ids;
     mutable std::unordered_map<StyleId, StyleItem*> m_items;
+
+    //! NOTE Values modified in quick succession (e.g. while dragging a slider) are applied together,
+    //! so that the score is relaid out once rather than for every intermediate value
+    mutable std::map<StyleId, QVariant> m_pendingValues;
+    mutable QTimer m_applyTimer;
 };
 }
 
@@ -22,6 +22,7 @@
 #include "palettecelliconengine.h"
 
 #include <QPainter>
+#include <QPixmapCache>
 
 #include "draw/types/geometry.h"
 #include "draw/painter.h"
@@ -52,21 +53,63 @@ QIconEngine* PaletteCellIconEngine::clone() const
 void PaletteCellIconEngine::paint(QPainter* qp, const QRect& rect, QIcon::Mode mode, QIcon::State state)
 {
     qreal dpi = qp->device()->logicalDpiX();
-    Painter p(qp, "palettecell");
-    p.save();
-    p.setAntialiasing(true);
-    paintCell(p, RectF::fromQRectF(rect), mode == QIcon::Selected, state == QIcon::On, dpi);
-    p.restore();
+
+    {
+        Painter p(qp, "palettecell");
+        p.save();
+        p.setAntialiasing(true);
+        paintBackground(p, RectF::fromQRectF(rect), mode == QIcon::Selected, state == QIcon::On);
+        p.restore();
+    }
+
+    QPixmap pixmap = cellPixmap(rect.size(), qp->device()->devicePixelRatioF(), dpi);
+    if (!pixmap.isNull()) {
+        qp->drawPixmap(rect.topLeft(), pixmap);
+    }
 }
 
-void PaletteCellIconEngine::paintCell(Painter& painter, const RectF& rect, bool selected, bool current, qreal dpi) const
+QPixmap PaletteCellIconEngine::cellPixmap(const QSize& size, qreal dpr, qreal dpi) const
 {
-    paintBackground(painter, rect, selected, current);
+    if (!m_cell || !m_cell->element || size.isEmpty()) {
+        return QPixmap();
+    }
 
-    if (!m_cell) {
-        return;
+    //! NOTE: laying out and drawing the element is expensive, and palettes repaint
+    //! all visible cells on every scroll, so keep the rendered element until any
+    //! of the parameters it depends on changes
+    const QString key = QString("palettecell_%1_%2_%3_%4_%5_%6_%7_%8_%9")
+                        .arg(m_cell->id)
+                        .arg(reinterpret_cast<quintptr>(m_cell->element.get()))
+                        .arg(m_cell->mag * m_extraMag)
+                        .arg(m_cell->xoffset)
+                        .arg(m_cell->yoffset)
+                        .arg(m_cell->drawStaff)
+                        .arg(configuration()->paletteSpatium())
+                        .arg(configuration()->elementsColor().rgba())
+                        .arg(QString("%1x%2@%3_%4").arg(size.width()).arg(size.height()).arg(dpr).arg(dpi));
+
+    QPixmap pixmap;
+    if (QPixmapCache::find(key, &pixmap)) {
+        return pixmap;
     }
 
+    pixmap = QPixmap(size * dpr);
+    pixmap.setDevicePixelRatio(dpr);
+    pixmap.fill(Qt::transparent);
+
+    {
+        Painter p(&pixmap, "palettecell");
+        p.setAntialiasing(true);
+        paintCell(p, RectF(0, 0, size.width(), size.height()), dpi);
+    }
+
+    QPixmapCache::insert(key, pixmap);
+
+    return pixmap;
+}
+
+void PaletteCellIconEngine::paintCell(Painter& painter, const RectF& rect, qreal dpi) const
+{
     EngravingItem* element = m_cell->element.get();
     if (!element) {
         return;
@@ -23,6 +23,7 @@
 #define MU_PALETTE_PALETTECELLICONENGINE_H
 
 #include <QIconEngine>
+#include <QPixmap>
 
 #include "palettecell.h"
 
@@ -48,7 +49,8 @@ public:
     void paint(QPainter* painter, const QRect& rect, QIcon::Mode mode, QIcon::State state) override;
 
 private:
-    void paintCell(muse::draw::Painter& painter, const muse::RectF& rect, bool selected, bool current, qreal dpi) const;
+    QPixmap cellPixmap(const QSize& size, qreal dpr, qreal dpi) const;
+    void paintCell(muse::draw::Painter& painter, const muse::RectF& rect, qreal dpi) const;
     void paintBackground(muse::draw::Painter& painter, const muse::RectF& rect, bool selected, bool current) const;
 
     PaletteCellConstPtr m_cell;
@@ -60,6 +60,10 @@ static const ActionCode REPEAT_CODE("repeat");
 static const ActionCode PLAY_CHORD_SYMBOLS_CODE("play-chord-symbols");
 static const ActionCode PLAYBACK_SETUP("playback-setup");
 
+//! NOTE Playback can start once the tracks sounding within this time from the beginning are loaded,
+//! the rest of the tracks join the playback as soon as they are ready
+static constexpr mpe::timestamp_t START_PLAYBACK_LOADING_WINDOW = 10 * 1000000;
+
 static AudioOutputParams makeReverbOutputParams()
 {
     AudioFxParams reverbParams;
@@ -187,7 +191,7 @@ bool PlaybackController::isPaused() const
 
 bool PlaybackController::isLoaded() const
 {
-    return m_loadingTrackCount == 0;
+    return m_loadingRequiredTrackCount == 0;
 }
 
 bool PlaybackController::isLoopEnabled() const
@@ -893,52 +897,51 @@ void PlaybackController::resetCurrentSequence()
     globalContext()->setCurrentPlayer(nullptr);
 }
 
-void PlaybackController::addTrack(const InstrumentTrackId& instrumentTrackId, const TrackAddFinished& onFinished)
+bool PlaybackController::addTrack(const InstrumentTrackId& instrumentTrackId, const TrackAddFinished& onFinished)
 {
     if (notationPlayback()->metronomeTrackId() == instrumentTrackId) {
-        doAddTrack(instrumentTrackId, muse::trc("playback", "Metronome"), onFinished);
-        return;
+        return doAddTrack(instrumentTrackId, muse::trc("playback", "Metronome"), onFinished);
     }
 
     const Part* part = masterNotationParts()->part(instrumentTrackId.partId);
     if (!part) {
-        return;
+        return false;
     }
 
     if (notationPlayback()->isChordSymbolsTrack(instrumentTrackId)) {
         const std::string trackName = muse::trc("playback", "Chords") + "." + part->partName().toStdString();
-        doAddTrack(instrumentTrackId, trackName, onFinished);
-        return;
+        return doAddTrack(instrumentTrackId, trackName, onFinished);
     }
 
     const muse::String primaryInstrId = part->instrument()->id();
     if (instrumentTrackId.instrumentId == primaryInstrId) {
         const std::string trackName = part->partName().toStdString();
-        doAddTrack(instrumentTrackId, trackName, onFinished);
-        return;
+        return doAddTrack(instrumentTrackId, trackName, onFinished);
     }
 
     const Instrument* instrument = part->instrumentById(instrumentTrackId.instrumentId);
     if (instrument != nullptr) {
         std::string trackName = "(" + instrument->trackName().toStdString() + ")";
-        doAddTrack(instrumentTrackId, trackName, onFinished);
+        return doAddTrack(instrumentTrackId, trackName, onFinished);
     }
+
+    return false;
 }
 
-void PlaybackController::doAddTrack(const InstrumentTrackId& instrumentTrackId, const std::string& title,
+bool PlaybackController::doAddTrack(const InstrumentTrackId& instrumentTrackId, const std::string& title,
                                     const TrackAddFinished& onFinished)
 {
     IF_ASSERT_FAILED(notationPlayback() && playback()) {
-        return;
+        return false;
     }
 
     if (!instrumentTrackId.isValid()) {
-        return;
+        return false;
     }
 
     mpe::PlaybackData playbackData = notationPlayback()->trackPlaybackData(instrumentTrackId);
     if (!playbackData.isValid()) {
-        return;
+        return false;
     }
 
     AudioInputParams inParams = audioSettings()->trackInputParams(instrumentTrackId);
@@ -1005,12 +1008,25 @@ void PlaybackController::doAddTrack(const InstrumentTrackId& instrumentTrackId,
     });
 
     m_loadingTrackCount++;
+
+    return true;
+}
+
+bool PlaybackController::isRequiredToStartPlayback(const InstrumentTrackId& instrumentTrackId) const
+{
+    if (notationPlayback()->metronomeTrackId() == instrumentTrackId) {
+        return true;
+    }
+
+    const mpe::PlaybackEventsMap& events = notationPlayback()->trackPlaybackData(instrumentTrackId).originEvents;
+
+    return events.empty() || events.cbegin()->first <= START_PLAYBACK_LOADING_WINDOW;
 }
 
-void PlaybackController::addAuxTrack(aux_channel_idx_t index, const TrackAddFinished& onFinished)
+bool PlaybackController::addAuxTrack(aux_channel_idx_t index, const TrackAddFinished& onFinished)
 {
     IF_ASSERT_FAILED(notationPlayback() && playback()) {
-        return;
+        return false;
     }
 
     AudioOutputParams outParams;
@@ -1048,6 +1064,8 @@ void PlaybackController::addAuxTrack(aux_channel_idx_t index, const TrackAddFini
     });
 
     m_loadingTrackCount++;
+
+    return true;
 }
 
 void PlaybackController::setTrackActivity(const engraving::InstrumentTrackId& instrumentTrackId, const bool isActive)
@@ -1243,6 +1261,7 @@ void PlaybackController::setupSequenceTracks()
     }
 
     m_loadingTrackCount = 0;
+    m_loadingRequiredTrackCount = 0;
 
     InstrumentTrackIdSet trackIdSet = notationPlayback()->existingTrackIdSet();
     size_t trackCount = trackIdSet.size() + AUX_CHANNEL_NUM;
@@ -1256,22 +1275,49 @@ void PlaybackController::setupSequenceTracks()
 
         if (m_loadingTrackCount == 0) {
             m_loadingProgress.finished.send(muse::make_ok());
+        }
+    };
+
+    auto onRequiredAddFinished = [this, onAddFinished]() {
+        m_loadingRequiredTrackCount--;
+        onAddFinished();
+
+        if (m_loadingRequiredTrackCount == 0) {
             m_isPlayAllowedChanged.notify();
         }
     };
 
+    //! NOTE The tracks are loaded one by one on the audio thread,
+    //! so load the ones needed to start the playback first
+    std::vector<InstrumentTrackId> deferredTrackIds;
+
     for (const InstrumentTrackId& trackId : trackIdSet) {
-        addTrack(trackId, onAddFinished);
+        if (!isRequiredToStartPlayback(trackId)) {
+            deferredTrackIds.push_back(trackId);
+            continue;
+        }
+
+        if (addTrack(trackId, onRequiredAddFinished)) {
+            m_loadingRequiredTrackCount++;
+        }
     }
 
     for (aux_channel_idx_t idx = 0; idx < AUX_CHANNEL_NUM; ++idx) {
-        addAuxTrack(idx, onAddFinished);
+        if (addAuxTrack(idx, onRequiredAddFinished)) {
+            m_loadingRequiredTrackCount++;
+        }
+    }
+
+    for (const InstrumentTrackId& trackId : deferredTrackIds) {
+        addTrack(trackId, onAddFinished);
     }
 
     m_loadingProgress.progressChanged.send(0, trackCount, title);
 
-    notationPlayback()->trackAdded().onReceive(this, [this, onAddFinished](const InstrumentTrackId& instrumentTrackId) {
-        addTrack(instrumentTrackId, onAddFinished);
+    notationPlayback()->trackAdded().onReceive(this, [this, onRequiredAddFinished](const InstrumentTrackId& instrumentTrackId) {
+        if (addTrack(instrumentTrackId, onRequiredAddFinished)) {
+            m_loadingRequiredTrackCount++;
+        }
     });
 
     notationPlayback()->trackRemoved().onReceive(this, [this](const InstrumentTrackId& instrumentTrackId) {
@@ -1279,12 +1325,15 @@ void PlaybackController::setupSequenceTracks()
     });
 
     NotifyList<const Part*> partList = masterNotationParts()->partList();
-    partList.onItemChanged(this, [this, onAddFinished](const Part* part) {
+    partList.onItemChanged(this, [this, onRequiredAddFinished](const Part* part) {
         for (const InstrumentTrackId& trackId : part->instrumentTrackIdSet()) {
             auto search = m_instrumentTrackIdMap.find(trackId);
             if (search == m_instrumentTrackIdMap.cend()) {
                 removeNonExistingTracks();
-                addTrack(trackId, onAddFinished);
+
+                if (addTrack(trackId, onRequiredAddFinished)) {
+                    m_loadingRequiredTrackCount++;
+                }
             }
         }
 
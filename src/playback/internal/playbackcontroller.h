@@ -193,9 +193,10 @@ private:
 
     using TrackAddFinished = std::function<void ()>;
 
-    void addTrack(const engraving::InstrumentTrackId& instrumentTrackId, const TrackAddFinished& onFinished);
-    void doAddTrack(const engraving::InstrumentTrackId& instrumentTrackId, const std::string& title, const TrackAddFinished& onFinished);
-    void addAuxTrack(muse::audio::aux_channel_idx_t index, const TrackAddFinished& onFinished);
+    bool addTrack(const engraving::InstrumentTrackId& instrumentTrackId, const TrackAddFinished& onFinished);
+    bool doAddTrack(const engraving::InstrumentTrackId& instrumentTrackId, const std::string& title, const TrackAddFinished& onFinished);
+    bool isRequiredToStartPlayback(const engraving::InstrumentTrackId& instrumentTrackId) const;
+    bool addAuxTrack(muse::audio::aux_channel_idx_t index, const TrackAddFinished& onFinished);
 
     void setTrackActivity(const engraving::InstrumentTrackId& instrumentTrackId, const bool isActive);
     muse::audio::AudioOutputParams trackOutputParams(const engraving::InstrumentTrackId& instrumentTrackId) const;
@@ -234,6 +235,7 @@ private:
 
     muse::Progress m_loadingProgress;
     size_t m_loadingTrackCount = 0;
+    size_t m_loadingRequiredTrackCount = 0;
 
     bool m_isExportingAudio = false;
     bool m_isRangeSelection = false;
@@ -24,6 +24,7 @@
 
 #include <memory>
 
+#include "async/promise.h"
 #include "io/path.h"
 #include "types/ret.h"
 
@@ -71,6 +72,10 @@ public:
 
     virtual muse::Ret save(
         const muse::io::path_t& path = muse::io::path_t(), SaveMode saveMode = SaveMode::Save, bool createBackup = true) = 0;
+
+    //! NOTE Serializes the project on the calling thread, and compresses and writes it on a worker thread
+    virtual muse::async::Promise<muse::Ret> autoSaveInBackground(const muse::io::path_t& path) = 0;
+
     virtual muse::Ret writeToDevice(QIODevice* device) = 0;
 
     virtual ProjectMeta metaInfo() const = 0;
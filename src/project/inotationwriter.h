@@ -61,6 +61,24 @@ public:
     virtual muse::Ret writeList(const notation::INotationPtrList& notations, muse::io::IODevice& device,
                                 const Options& options = Options()) = 0;
 
+    //! NOTE Writes every page of a PER_PAGE export, one device per page.
+    //! Writers that can overlap the work for several pages override this
+    virtual muse::Ret writePages(notation::INotationPtr notation, const std::vector<muse::io::IODevice*>& devices,
+                                 const Options& options = Options())
+    {
+        for (size_t i = 0; i < devices.size(); ++i) {
+            Options pageOptions = options;
+            pageOptions[OptionKey::PAGE_NUMBER] = muse::Val(static_cast<int>(i));
+
+            muse::Ret ret = write(notation, *devices[i], pageOptions);
+            if (!ret) {
+                return ret;
+            }
+        }
+
+        return muse::make_ok();
+    }
+
     virtual muse::Progress* progress() { return nullptr; }
     virtual void abort() {}
 };
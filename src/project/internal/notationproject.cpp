@@ -24,11 +24,14 @@
 #include <QBuffer>
 #include <QDir>
 #include <QFile>
+#include <QSaveFile>
 
 #include "global/io/buffer.h"
 #include "global/io/file.h"
 #include "global/io/ioretcodes.h"
 #include "global/io/devtools/allzerosfilecorruptor.h"
+#include "global/concurrency/concurrent.h"
+#include "global/serialization/zipwriter.h"
 
 #include "engraving/dom/undo.h"
 
@@ -76,6 +79,65 @@ static void setupScoreMetaTags(mu::engraving::MasterScore* masterScore, const Pr
     }
 }
 
+static std::string autoSaveFileSuffix(const muse::io::path_t& path)
+{
+    std::string suffix = io::suffix(path);
+    if (suffix == IProjectAutoSaver::AUTOSAVE_SUFFIX) {
+        suffix = io::suffix(io::completeBasename(path));
+    }
+
+    if (suffix.empty()) {
+        // Then it must be a MSCX folder
+        suffix = engraving::MSCX;
+    }
+
+    return suffix;
+}
+
+static Ret moveSavedDir(std::shared_ptr<IFileSystem> fileSystem, const QString& savePath, const QString& targetContainerPath)
+{
+    RetVal<io::paths_t> filesToBeMoved = fileSystem->scanFiles(savePath, { "*" }, io::ScanMode::FilesAndFoldersInCurrentDir);
+    if (!filesToBeMoved.ret) {
+        return filesToBeMoved.ret;
+    }
+
+    Ret ret = muse::make_ok();
+
+    for (const muse::io::path_t& fileToBeMoved : filesToBeMoved.val) {
+        muse::io::path_t destinationFile
+            = muse::io::path_t(targetContainerPath).appendingComponent(io::filename(fileToBeMoved));
+        LOGD() << fileToBeMoved << " to " << destinationFile;
+        ret = fileSystem->move(fileToBeMoved, destinationFile, true);
+        if (!ret) {
+            return ret;
+        }
+    }
+
+    // Try to remove the temp save folder (not problematic if fails)
+    ret = fileSystem->remove(savePath, true);
+    if (!ret) {
+        LOGW() << ret.toString();
+    }
+
+    return muse::make_ok();
+}
+
+static Ret writeFileSynced(const QString& filePath, const ByteArray& data)
+{
+    //! NOTE QSaveFile replaces the file atomically and flushes it to the disk on commit
+    QSaveFile file(filePath);
+    file.open(QIODevice::WriteOnly);
+    file.write(reinterpret_cast<const char*>(data.constData()), static_cast<qint64>(data.size()));
+
+    if (!file.commit()) {
+        Ret ret = make_ret(io::Err::FSWriteError);
+        ret.setText(file.errorString().toStdString());
+        return ret;
+    }
+
+    return muse::make_ok();
+}
+
 static QString scoreDefaultTitle()
 {
     return muse::qtrc("project", "Untitled score");
@@ -156,7 +218,8 @@ Ret NotationProject::doLoad(const muse::io::path_t& path, const muse::io::path_t
     m_engravingProject->setFileInfoProvider(std::make_shared<ProjectFileInfoProvider>(this));
 
     SettingsCompat settingsCompat;
-    ret = m_engravingProject->loadMscz(reader, settingsCompat, forceMode);
+    const path_t snapshotsPath = configuration()->useScoreSnapshots() ? configuration()->scoreSnapshotsPath() : path_t();
+    ret = m_engravingProject->loadMscz(reader, settingsCompat, forceMode, configuration()->lazyExcerptLoading(), snapshotsPath);
     if (!ret) {
         return ret;
     }
@@ -494,20 +557,92 @@ Ret NotationProject::save(const muse::io::path_t& path, SaveMode saveMode, bool
         return ret;
     }
     case SaveMode::AutoSave:
-        std::string suffix = io::suffix(path);
-        if (suffix == IProjectAutoSaver::AUTOSAVE_SUFFIX) {
-            suffix = io::suffix(io::completeBasename(path));
+        std::string suffix = autoSaveFileSuffix(path);
+        return saveScore(path, suffix, false /*generateBackup*/, false /*createThumbnail*/, true /*isAutosave*/);
+    }
+
+    return make_ret(notation::Err::UnknownError);
+}
+
+async::Promise<Ret> NotationProject::autoSaveInBackground(const muse::io::path_t& path)
+{
+    TRACEFUNC;
+
+    return async::Promise<Ret>([this, path](auto resolve, auto reject) {
+        MscIoMode ioMode = mscIoModeBySuffix(autoSaveFileSuffix(path));
+        IF_ASSERT_FAILED(ioMode != MscIoMode::Unknown) {
+            return reject(int(Ret::Code::InternalError), "Unknown save format");
         }
 
-        if (suffix.empty()) {
-            // Then it must be a MSCX folder
-            suffix = engraving::MSCX;
+        QString targetContainerPath = engraving::containerPath(path).toQString();
+        muse::io::path_t targetMainFilePath = engraving::mainFilePath(path);
+        QString savePath = targetContainerPath + "_saving";
+
+        Ret ret = checkSaveLocation(savePath, targetContainerPath, ioMode);
+        if (!ret) {
+            return reject(ret.code(), ret.text());
         }
 
-        return saveScore(path, suffix, false /*generateBackup*/, false /*createThumbnail*/, true /*isAutosave*/);
-    }
+        //! NOTE The score can only be serialized on the main thread, because it may be edited meanwhile.
+        //! The serialized files are kept in memory, and compressing and writing them is done on a worker thread
+        MscWriter::Params params;
+        params.filePath = savePath;
+        params.mainFileName = engraving::mainFileName(path).toQString();
+        params.mode = ioMode;
+        params.deferred = true;
+
+        //! NOTE Only the files changed since the previous autosave are compressed again.
+        //! Or none of them is compressed, if the speed matters more than the size of the autosave
+        params.zipCompressionEnabled = configuration()->isAutoSaveCompressionEnabled();
+        if (params.zipCompressionEnabled) {
+            if (!m_autoSaveCompressionCache) {
+                m_autoSaveCompressionCache = ZipWriter::makeCompressionCache();
+            }
+            params.zipCompressionCache = m_autoSaveCompressionCache;
+        }
 
-    return make_ret(notation::Err::UnknownError);
+        std::shared_ptr<MscWriter> msczWriter = std::make_shared<MscWriter>(params);
+        ret = writeProject(*msczWriter, false /*onlySelection*/, false /*createThumbnail*/);
+        msczWriter->close();
+        if (!ret) {
+            LOGE() << "failed write project: " << ret.toString();
+            return reject(ret.code(), ret.text());
+        }
+
+        std::shared_ptr<IFileSystem> fs = fileSystem();
+
+        Concurrent::run([fs, msczWriter, ioMode, savePath, targetContainerPath, targetMainFilePath, resolve, reject]() {
+            Ret ret = muse::make_ok();
+
+            if (ioMode == MscIoMode::Dir) {
+                ret = msczWriter->flush();
+                if (ret) {
+                    ret = moveSavedDir(fs, savePath, targetContainerPath);
+                }
+            } else {
+                ByteArray data;
+                Buffer buf(&data);
+                ret = msczWriter->flush(&buf);
+                if (ret) {
+                    ret = writeFileSynced(targetContainerPath, data);
+                }
+            }
+
+            if (!ret) {
+                LOGE() << "failed save file: " << targetContainerPath << ", err: " << ret.toString();
+                (void)reject(ret.code(), ret.text());
+                return;
+            }
+
+            QFile::setPermissions(targetMainFilePath.toQString(),
+                                  QFile::ReadOwner | QFile::WriteOwner | QFile::ReadUser | QFile::ReadGroup | QFile::ReadOther);
+
+            LOGI() << "success save file: " << targetContainerPath;
+            (void)resolve(make_ok());
+        });
+
+        return async::Promise<Ret>::Result::unchecked();
+    }, async::Promise<Ret>::AsynchronyType::ProvidedByBody);
 }
 
 Ret NotationProject::writeToDevice(QIODevice* device)
@@ -574,18 +709,9 @@ Ret NotationProject::doSave(const muse::io::path_t& path, engraving::MscIoMode i
 
     // Step 1: check writable
     {
-        if ((fileSystem()->exists(savePath) && !fileSystem()->isWritable(savePath))
-            || (fileSystem()->exists(targetContainerPath) && !fileSystem()->isWritable(targetContainerPath))) {
-            LOGE() << "failed save, not writable path: " << targetContainerPath;
-            return make_ret(io::Err::FSWriteError);
-        }
-
-        if (ioMode == engraving::MscIoMode::Dir) {
-            // Dir needs to be created, otherwise we can't move to it
-            if (!QDir(targetContainerPath).mkpath(".")) {
-                LOGE() << "Couldn't create container directory: " << targetContainerPath;
-                return make_ret(io::Err::FSMakingError);
-            }
+        Ret ret = checkSaveLocation(savePath, targetContainerPath, ioMode);
+        if (!ret) {
+            return ret;
         }
     }
 
@@ -606,9 +732,15 @@ Ret NotationProject::doSave(const muse::io::path_t& path, engraving::MscIoMode i
             params.device = new AllZerosFileCorruptor(savePath);
         }
 
+        //! NOTE The files are written at once when the project is written, so that they are compressed in parallel
+        params.deferred = true;
+
         MscWriter msczWriter(params);
         Ret ret = writeProject(msczWriter, false /*onlySelection*/, createThumbnail);
         msczWriter.close();
+        if (ret) {
+            ret = msczWriter.flush(params.device);
+        }
         if (params.device) {
             delete params.device;
             params.device = nullptr;
@@ -635,27 +767,9 @@ Ret NotationProject::doSave(const muse::io::path_t& path, engraving::MscIoMode i
     // Step 4: replace to saved file
     {
         if (ioMode == MscIoMode::Dir) {
-            RetVal<io::paths_t> filesToBeMoved = fileSystem()->scanFiles(savePath, { "*" }, io::ScanMode::FilesAndFoldersInCurrentDir);
-            if (!filesToBeMoved.ret) {
-                return filesToBeMoved.ret;
-            }
-
-            Ret ret = muse::make_ok();
-
-            for (const muse::io::path_t& fileToBeMoved : filesToBeMoved.val) {
-                muse::io::path_t destinationFile
-                    = muse::io::path_t(targetContainerPath).appendingComponent(io::filename(fileToBeMoved));
-                LOGD() << fileToBeMoved << " to " << destinationFile;
-                ret = fileSystem()->move(fileToBeMoved, destinationFile, true);
-                if (!ret) {
-                    return ret;
-                }
-            }
-
-            // Try to remove the temp save folder (not problematic if fails)
-            ret = fileSystem()->remove(savePath, true);
+            Ret ret = moveSavedDir(fileSystem(), savePath, targetContainerPath);
             if (!ret) {
-                LOGW() << ret.toString();
+                return ret;
             }
         } else {
             Ret ret = muse::make_ok();
@@ -694,6 +808,25 @@ Ret NotationProject::doSave(const muse::io::path_t& path, engraving::MscIoMode i
     return make_ret(Ret::Code::Ok);
 }
 
+Ret NotationProject::checkSaveLocation(const QString& savePath, const QString& targetContainerPath, engraving::MscIoMode ioMode) const
+{
+    if ((fileSystem()->exists(savePath) && !fileSystem()->isWritable(savePath))
+        || (fileSystem()->exists(targetContainerPath) && !fileSystem()->isWritable(targetContainerPath))) {
+        LOGE() << "failed save, not writable path: " << targetContainerPath;
+        return make_ret(io::Err::FSWriteError);
+    }
+
+    if (ioMode == engraving::MscIoMode::Dir) {
+        // Dir needs to be created, otherwise we can't move to it
+        if (!QDir(targetContainerPath).mkpath(".")) {
+            LOGE() << "Couldn't create container directory: " << targetContainerPath;
+            return make_ret(io::Err::FSMakingError);
+        }
+    }
+
+    return make_ok();
+}
+
 Ret NotationProject::makeBackup(muse::io::path_t filePath)
 {
     TRACEFUNC;
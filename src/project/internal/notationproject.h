@@ -41,6 +41,10 @@
 
 #include "global/iglobalconfiguration.h"
 
+namespace muse {
+struct ZipCompressionCache;
+}
+
 namespace mu::engraving {
 class MscReader;
 class MscWriter;
@@ -96,6 +100,7 @@ public:
 
     muse::Ret save(
         const muse::io::path_t& path = muse::io::path_t(), SaveMode saveMode = SaveMode::Save, bool createBackup = true) override;
+    muse::async::Promise<muse::Ret> autoSaveInBackground(const muse::io::path_t& path) override;
     muse::Ret writeToDevice(QIODevice* device) override;
 
     ProjectMeta metaInfo() const override;
@@ -118,6 +123,7 @@ private:
     muse::Ret exportProject(const muse::io::path_t& path, const std::string& suffix);
     muse::Ret doSave(const muse::io::path_t& path, engraving::MscIoMode ioMode, bool generateBackup = true, bool createThumbnail = true,
                      bool isAutosave = false);
+    muse::Ret checkSaveLocation(const QString& savePath, const QString& targetContainerPath, engraving::MscIoMode ioMode) const;
     muse::Ret makeBackup(muse::io::path_t filePath);
     muse::Ret writeProject(engraving::MscWriter& msczWriter, bool onlySelection, bool createThumbnail = true);
     muse::Ret checkSavedFileForCorruption(engraving::MscIoMode ioMode, const muse::io::path_t& path, const muse::io::path_t& scoreFileName);
@@ -142,6 +148,8 @@ private:
     bool m_isImported = false;
     bool m_needAutoSave = false;
     bool m_hasNonUndoStackChanges = false;
+
+    std::shared_ptr<muse::ZipCompressionCache> m_autoSaveCompressionCache;
 };
 }
 
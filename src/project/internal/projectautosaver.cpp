@@ -157,6 +157,11 @@ void ProjectAutoSaver::onTrySave()
         return;
     }
 
+    if (m_isSaving) {
+        LOGD() << "[autosave] previous save is still in progress";
+        return;
+    }
+
     if (!project->needAutoSave()) {
         LOGD() << "[autosave] project does not need save";
         return;
@@ -170,15 +175,31 @@ void ProjectAutoSaver::onTrySave()
     muse::io::path_t projectPath = this->projectPath(project);
     muse::io::path_t savePath = project->isNewlyCreated() ? projectPath : projectAutoSavePath(projectPath);
 
-    Ret ret = project->save(savePath, SaveMode::AutoSave);
-    if (!ret) {
-        LOGE() << "[autosave] failed to save project, err: " << ret.toString();
-        return;
-    }
-
+    //! NOTE Changes made while the file is being written will be saved next time
     project->setNeedAutoSave(false);
+    m_isSaving = true;
+
+    std::weak_ptr<INotationProject> weakProject = project;
 
-    LOGD() << "[autosave] successfully saved project";
+    project->autoSaveInBackground(savePath).onResolve(this, [this, projectPath](const Ret&) {
+        m_isSaving = false;
+
+        //! NOTE The project may have been saved or closed meanwhile, then this autosave is obsolete
+        if (m_lastProjectPathNeedingAutosave != projectPath) {
+            removeProjectUnsavedChanges(projectPath);
+            return;
+        }
+
+        LOGD() << "[autosave] successfully saved project";
+    }).onReject(this, [this, weakProject](int code, const std::string& msg) {
+        m_isSaving = false;
+
+        LOGE() << "[autosave] failed to save project, err: " << code << " " << msg;
+
+        if (INotationProjectPtr project = weakProject.lock()) {
+            project->setNeedAutoSave(true);
+        }
+    });
 }
 
 muse::io::path_t ProjectAutoSaver::projectPath(INotationProjectPtr project) const
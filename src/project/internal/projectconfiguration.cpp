@@ -53,6 +53,7 @@ static const Settings::Key PREFERRED_SCORE_CREATION_MODE_KEY(module_name, "proje
 static const Settings::Key MIGRATION_OPTIONS(module_name, "project/migration");
 static const Settings::Key AUTOSAVE_ENABLED_KEY(module_name, "project/autoSaveEnabled");
 static const Settings::Key AUTOSAVE_INTERVAL_KEY(module_name, "project/autoSaveInterval");
+static const Settings::Key AUTOSAVE_COMPRESSION_ENABLED_KEY(module_name, "project/autoSaveCompressionEnabled");
 static const Settings::Key ALSO_SHARE_AUDIO_COM_AFTER_PUBLISH(module_name, "project/alsoShareAudioCom");
 static const Settings::Key SHOW_ALSO_SHARE_AUDIO_COM_DIALOG(module_name, "project/showAlsoShareAudioComDialog");
 static const Settings::Key HAS_ASKED_ALSO_SHARE_AUDIO_COM(module_name, "project/hasAskedAlsoShareAudioCom");
@@ -64,6 +65,8 @@ static const Settings::Key NUMBER_OF_SAVES_TO_GENERATE_AUDIO_KEY(module_name, "p
 static const Settings::Key SHOW_CLOUD_IS_NOT_AVAILABLE_WARNING(module_name, "project/showCloudIsNotAvailableWarning");
 static const Settings::Key DISABLE_VERSION_CHECKING(module_name, "project/disableVersionChecking");
 static const Settings::Key CREATE_BACKUP_BEFORE_SAVING(module_name, "project/createBackupBeforeSaving");
+static const Settings::Key LAZY_EXCERPT_LOADING(module_name, "project/lazyExcerptLoading");
+static const Settings::Key USE_SCORE_SNAPSHOTS(module_name, "project/useScoreSnapshots");
 
 static const std::string DEFAULT_FILE_SUFFIX(".mscz");
 static const std::string DEFAULT_FILE_FILTER("*.mscz");
@@ -102,6 +105,8 @@ void ProjectConfiguration::init()
         m_autoSaveIntervalChanged.send(val.toInt());
     });
 
+    settings()->setDefaultValue(AUTOSAVE_COMPRESSION_ENABLED_KEY, Val(true));
+
     settings()->setDefaultValue(ALSO_SHARE_AUDIO_COM_AFTER_PUBLISH, Val(true));
     settings()->valueChanged(ALSO_SHARE_AUDIO_COM_AFTER_PUBLISH).onReceive(nullptr, [this](const Val& val) {
         m_alsoShareAudioComChanged.send(val.toBool());
@@ -124,6 +129,16 @@ void ProjectConfiguration::init()
                                                                       "Create backup of file on disk before saving new changes"));
     settings()->setCanBeManuallyEdited(CREATE_BACKUP_BEFORE_SAVING, true);
 
+    settings()->setDefaultValue(LAZY_EXCERPT_LOADING, Val(false));
+    settings()->setDescription(LAZY_EXCERPT_LOADING, muse::trc("project",
+                                                               "Read parts that were closed when saved only when they are first opened"));
+    settings()->setCanBeManuallyEdited(LAZY_EXCERPT_LOADING, true);
+
+    settings()->setDefaultValue(USE_SCORE_SNAPSHOTS, Val(false));
+    settings()->setDescription(USE_SCORE_SNAPSHOTS, muse::trc("project",
+                                                              "Keep a binary snapshot of each opened score to read it faster next time"));
+    settings()->setCanBeManuallyEdited(USE_SCORE_SNAPSHOTS, true);
+
     if (!userTemplatesPath().empty()) {
         fileSystem()->makePath(userTemplatesPath());
     }
@@ -548,6 +563,16 @@ muse::async::Channel<int> ProjectConfiguration::autoSaveIntervalChanged() const
     return m_autoSaveIntervalChanged;
 }
 
+bool ProjectConfiguration::isAutoSaveCompressionEnabled() const
+{
+    return settings()->value(AUTOSAVE_COMPRESSION_ENABLED_KEY).toBool();
+}
+
+void ProjectConfiguration::setAutoSaveCompressionEnabled(bool enabled)
+{
+    settings()->setSharedValue(AUTOSAVE_COMPRESSION_ENABLED_KEY, Val(enabled));
+}
+
 bool ProjectConfiguration::alsoShareAudioCom() const
 {
     return settings()->value(ALSO_SHARE_AUDIO_COM_AFTER_PUBLISH).toBool();
@@ -688,6 +713,31 @@ void ProjectConfiguration::setCreateBackupBeforeSaving(bool create)
     settings()->setSharedValue(CREATE_BACKUP_BEFORE_SAVING, Val(create));
 }
 
+bool ProjectConfiguration::lazyExcerptLoading() const
+{
+    return settings()->value(LAZY_EXCERPT_LOADING).toBool();
+}
+
+void ProjectConfiguration::setLazyExcerptLoading(bool lazy)
+{
+    settings()->setSharedValue(LAZY_EXCERPT_LOADING, Val(lazy));
+}
+
+bool ProjectConfiguration::useScoreSnapshots() const
+{
+    return settings()->value(USE_SCORE_SNAPSHOTS).toBool();
+}
+
+void ProjectConfiguration::setUseScoreSnapshots(bool use)
+{
+    settings()->setSharedValue(USE_SCORE_SNAPSHOTS, Val(use));
+}
+
+muse::io::path_t ProjectConfiguration::scoreSnapshotsPath() const
+{
+    return globalConfiguration()->userAppDataPath() + "/score_snapshots";
+}
+
 bool ProjectConfiguration::disableVersionChecking() const
 {
     return settings()->value(DISABLE_VERSION_CHECKING).toBool();
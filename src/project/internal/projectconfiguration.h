@@ -115,6 +115,9 @@ public:
     void setAutoSaveInterval(int minutes) override;
     muse::async::Channel<int> autoSaveIntervalChanged() const override;
 
+    bool isAutoSaveCompressionEnabled() const override;
+    void setAutoSaveCompressionEnabled(bool enabled) override;
+
     bool alsoShareAudioCom() const override;
     void setAlsoShareAudioCom(bool share) override;
     muse::async::Channel<bool> alsoShareAudioComChanged() const override;
@@ -158,6 +161,13 @@ public:
     bool createBackupBeforeSaving() const override;
     void setCreateBackupBeforeSaving(bool create) override;
 
+    bool lazyExcerptLoading() const override;
+    void setLazyExcerptLoading(bool lazy) override;
+
+    bool useScoreSnapshots() const override;
+    void setUseScoreSnapshots(bool use) override;
+    muse::io::path_t scoreSnapshotsPath() const override;
+
 private:
     muse::io::path_t appTemplatesPath() const;
     muse::io::path_t legacyCloudProjectsPath() const;
@@ -98,7 +98,7 @@ Templates TemplatesRepository::readTemplates(const io::paths_t& files, const QSt
 
     for (const muse::io::path_t& file : files) {
         muse::io::path_t path = dirPath.empty() ? file : dirPath + "/" + file;
-        RetVal<ProjectMeta> meta = mscReader()->readMeta(path);
+        RetVal<ProjectMeta> meta = readMeta(path);
         if (!meta.ret) {
             LOGE() << QString("failed read template %1: %2")
                 .arg(path.toQString())
@@ -116,3 +116,27 @@ Templates TemplatesRepository::readTemplates(const io::paths_t& files, const QSt
 
     return templates;
 }
+
+RetVal<ProjectMeta> TemplatesRepository::readMeta(const muse::io::path_t& path) const
+{
+    //! NOTE Reading the meta unpacks the template and decodes its thumbnail,
+    //! so it is kept until the file changes
+    DateTime lastModified = fileSystem()->lastModified(path);
+    RetVal<uint64_t> fileSize = fileSystem()->fileSize(path);
+
+    auto it = m_metaCache.find(path);
+    if (it != m_metaCache.end() && fileSize.ret
+        && it->second.lastModified == lastModified && it->second.fileSize == fileSize.val) {
+        return RetVal<ProjectMeta>::make_ok(it->second.meta);
+    }
+
+    RetVal<ProjectMeta> meta = mscReader()->readMeta(path);
+    if (!meta.ret || !fileSize.ret) {
+        m_metaCache.erase(path);
+        return meta;
+    }
+
+    m_metaCache.insert_or_assign(path, CachedMeta { lastModified, fileSize.val, meta.val });
+
+    return meta;
+}
@@ -23,7 +23,10 @@
 #ifndef MU_PROJECT_TEMPLATESREPOSITORY_H
 #define MU_PROJECT_TEMPLATESREPOSITORY_H
 
+#include <map>
+
 #include "modularity/ioc.h"
+#include "types/datetime.h"
 
 #include "itemplatesrepository.h"
 #include "project/iprojectconfiguration.h"
@@ -46,6 +49,16 @@ private:
 
     Templates readTemplates(const muse::io::paths_t& files, const QString& category, bool isCustom,
                             const muse::io::path_t& dirPath = muse::io::path_t()) const;
+
+    muse::RetVal<ProjectMeta> readMeta(const muse::io::path_t& path) const;
+
+    struct CachedMeta {
+        muse::DateTime lastModified;
+        uint64_t fileSize = 0;
+        ProjectMeta meta;
+    };
+
+    mutable std::map<muse::io::path_t, CachedMeta> m_metaCache;
 };
 }
 
@@ -120,6 +120,9 @@ public:
     virtual void setAutoSaveInterval(int minutes) = 0;
     virtual muse::async::Channel<int> autoSaveIntervalChanged() const = 0;
 
+    virtual bool isAutoSaveCompressionEnabled() const = 0;
+    virtual void setAutoSaveCompressionEnabled(bool enabled) = 0;
+
     virtual bool alsoShareAudioCom() const = 0;
     virtual void setAlsoShareAudioCom(bool share) = 0;
     virtual muse::async::Channel<bool> alsoShareAudioComChanged() const = 0;
@@ -163,6 +166,13 @@ public:
 
     virtual bool createBackupBeforeSaving() const = 0;
     virtual void setCreateBackupBeforeSaving(bool create) = 0;
+
+    virtual bool lazyExcerptLoading() const = 0;
+    virtual void setLazyExcerptLoading(bool lazy) = 0;
+
+    virtual bool useScoreSnapshots() const = 0;
+    virtual void setUseScoreSnapshots(bool use) = 0;
+    virtual muse::io::path_t scoreSnapshotsPath() const = 0;
 };
 }
 
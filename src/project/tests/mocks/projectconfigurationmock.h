@@ -97,6 +97,9 @@ public:
     MOCK_METHOD(void, setAutoSaveInterval, (int), (override));
     MOCK_METHOD(muse::async::Channel<int>, autoSaveIntervalChanged, (), (const, override));
 
+    MOCK_METHOD(bool, isAutoSaveCompressionEnabled, (), (const, override));
+    MOCK_METHOD(void, setAutoSaveCompressionEnabled, (bool), (override));
+
     MOCK_METHOD(bool, alsoShareAudioCom, (), (const, override));
     MOCK_METHOD(void, setAlsoShareAudioCom, (bool), (override));
     MOCK_METHOD(muse::async::Channel<bool>, alsoShareAudioComChanged, (), (const, override));
@@ -140,6 +143,13 @@ public:
 
     MOCK_METHOD(bool, createBackupBeforeSaving, (), (const, override));
     MOCK_METHOD(void, setCreateBackupBeforeSaving, (bool), (override));
+
+    MOCK_METHOD(bool, lazyExcerptLoading, (), (const, override));
+    MOCK_METHOD(void, setLazyExcerptLoading, (bool), (override));
+
+    MOCK_METHOD(bool, useScoreSnapshots, (), (const, override));
+    MOCK_METHOD(void, setUseScoreSnapshots, (bool), (override));
+    MOCK_METHOD(muse::io::path_t, scoreSnapshotsPath, (), (const, override));
 };
 }
 
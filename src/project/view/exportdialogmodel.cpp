@@ -493,6 +493,21 @@ void ExportDialogModel::setBitRate(int rate)
     emit bitRateChanged(rate);
 }
 
+bool ExportDialogModel::normalizeLoudness() const
+{
+    return audioExportConfiguration()->exportNormalizeLoudness();
+}
+
+void ExportDialogModel::setNormalizeLoudness(bool normalize)
+{
+    if (normalize == normalizeLoudness()) {
+        return;
+    }
+
+    audioExportConfiguration()->setExportNormalizeLoudness(normalize);
+    emit normalizeLoudnessChanged(normalize);
+}
+
 bool ExportDialogModel::midiExpandRepeats() const
 {
     return midiImportExportConfiguration()->isExpandRepeats();
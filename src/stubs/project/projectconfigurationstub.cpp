@@ -212,6 +212,15 @@ muse::async::Channel<int> ProjectConfigurationStub::autoSaveIntervalChanged() co
     return ch;
 }
 
+bool ProjectConfigurationStub::isAutoSaveCompressionEnabled() const
+{
+    return true;
+}
+
+void ProjectConfigurationStub::setAutoSaveCompressionEnabled(bool)
+{
+}
+
 bool ProjectConfigurationStub::alsoShareAudioCom() const
 {
     return false;
@@ -332,3 +341,26 @@ bool ProjectConfigurationStub::disableVersionChecking() const
 void ProjectConfigurationStub::setDisableVersionChecking(bool)
 {
 }
+
+bool ProjectConfigurationStub::lazyExcerptLoading() const
+{
+    return false;
+}
+
+void ProjectConfigurationStub::setLazyExcerptLoading(bool)
+{
+}
+
+bool ProjectConfigurationStub::useScoreSnapshots() const
+{
+    return false;
+}
+
+void ProjectConfigurationStub::setUseScoreSnapshots(bool)
+{
+}
+
+muse::io::path_t ProjectConfigurationStub::scoreSnapshotsPath() const
+{
+    return muse::io::path_t();
+}
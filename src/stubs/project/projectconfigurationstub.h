@@ -88,6 +88,9 @@ public:
     void setAutoSaveInterval(int minutes) override;
     muse::async::Channel<int> autoSaveIntervalChanged() const override;
 
+    bool isAutoSaveCompressionEnabled() const override;
+    void setAutoSaveCompressionEnabled(bool enabled) override;
+
     bool alsoShareAudioCom() const override;
     void setAlsoShareAudioCom(bool share) override;
     muse::async::Channel<bool> alsoShareAudioComChanged() const override;
@@ -128,6 +131,13 @@ public:
 
     bool disableVersionChecking() const override;
     void setDisableVersionChecking(bool disable) override;
+
+    bool lazyExcerptLoading() const override;
+    void setLazyExcerptLoading(bool lazy) override;
+
+    bool useScoreSnapshots() const override;
+    void setUseScoreSnapshots(bool use) override;
+    muse::io::path_t scoreSnapshotsPath() const override;
 };
 }
 
@@ -0,0 +1,86 @@
+#!/usr/bin/env bash
+# SPDX-License-Identifier: GPL-3.0-only
+# MuseScore-Studio-CLA-applies
+#
+# MuseScore Studio
+# Music Composition & Notation
+#
+# Copyright (C) 2024 MuseScore Limited
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License version 3 as
+# published by the Free Software Foundation.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this program.  If not, see <https://www.gnu.org/licenses/>.
+echo "MuseScore VTest Generate PNGs"
+echo "MuseScore VTest Benchmark"
+
+set -o pipefail
+
+HERE="$(dirname ${BASH_SOURCE[0]})"
+SCORES_DIR="$HERE/scores"
+OUTPUT_DIR="./vtest_benchmark"
+MSCORE_BIN=build.release/install/bin/mscore
+FORMATS="mscz musicxml pdf"
+
+while [[ "$#" -gt 0 ]]; do
+    case $1 in
+        -s|--scores) SCORES_DIR="$2"; shift ;;
+        -o|--output-dir) OUTPUT_DIR="$2"; shift ;;
+        -m|--mscore) MSCORE_BIN="$2"; shift ;;
+        -f|--formats) FORMATS="$2"; shift ;;
+        *) echo "Unknown parameter passed: $1"; exit 1 ;;
+    esac
+    shift
+done
+
+echo "::group::Configuration:"
+echo "SCORES_DIR: $SCORES_DIR"
+echo "OUTPUT_DIR: $OUTPUT_DIR"
+echo "MSCORE_BIN: $MSCORE_BIN"
+echo "FORMATS: $FORMATS"
+echo "::endgroup::"
+
+rm -rf $OUTPUT_DIR
+mkdir -p $OUTPUT_DIR
+
+LOG_FILE=$OUTPUT_DIR/benchmark.log
+JSON_FILE=$OUTPUT_DIR/benchmark.json
+
+now_ms() {
+    date +%s%3N
+}
+
+echo "::group::Running benchmark"
+echo "[" > $JSON_FILE
+SCORES_LIST=$(ls -p $SCORES_DIR | grep -v /)
+FIRST="true"
+for score in $SCORES_LIST ; do
+    for format in $FORMATS ; do
+        OUT_FILE=$OUTPUT_DIR/${score%.*}.$format
+        STAT_FILE=$OUTPUT_DIR/${score%.*}.$format.layout.json
+
+        START=$(now_ms)
+        $MSCORE_BIN "$SCORES_DIR/$score" -o "$OUT_FILE" --layout-statistics "$STAT_FILE" >> $LOG_FILE 2>&1
+        STATUS=$?
+        END=$(now_ms)
+
+        if [ -z "$FIRST" ]; then echo "," >> $JSON_FILE; fi
+        FIRST=""
+
+        LAYOUT="null"
+        if [ -f "$STAT_FILE" ]; then LAYOUT=$(cat "$STAT_FILE"); fi
+
+        echo "{ \"score\" : \"$score\", \"format\" : \"$format\", \"status\" : $STATUS, \"ms\" : $((END - START)), \"layout\" : $LAYOUT }" >> $JSON_FILE
+    done
+done
+echo "]" >> $JSON_FILE
+echo "::endgroup::"
+
+echo "Results: $JSON_FILE"